@@ -94,13 +94,20 @@ namespace Fsl
   void S03_Transform::Update(const DemoTime& demoTime)
   {
     // Set up rotation matrix rotating by angle around y axis.
-    m_matTransform = Matrix::CreateRotationY(m_angle);
+    m_matUpdateTransform = Matrix::CreateRotationY(m_angle);
 
     // Use demoTime.DeltaTime to make the animation frame rate independent.
     m_angle += 0.8f * demoTime.DeltaTime;
   }
 
 
+  void S03_Transform::SwapFrameState(const DemoTime& demoTime)
+  {
+    FSL_PARAM_NOT_USED(demoTime);
+    m_matTransform = m_matUpdateTransform;
+  }
+
+
   void S03_Transform::Draw(const FrameInfo& frameInfo)
   {
     FSL_PARAM_NOT_USED(frameInfo);
@@ -48,7 +48,9 @@ namespace Fsl
     GLint m_locColors;
     GLint m_locTransformMat;
 
+    // The update writes m_matUpdateTransform while the previous frame may still be drawing m_matTransform
     float m_angle;
+    Matrix m_matUpdateTransform;
     Matrix m_matTransform;
 
   public:
@@ -57,6 +59,7 @@ namespace Fsl
 
   protected:
     void Update(const DemoTime& demoTime) override;
+    void SwapFrameState(const DemoTime& demoTime) override;
     void Draw(const FrameInfo& frameInfo) override;
   };
 }
@@ -53,6 +53,10 @@ namespace Fsl
   {
     DemoAppHostConfigEGL config(g_eglConfigAttribs.data());
 
-    DemoAppRegister::GLES2::Register<S03_Transform>(rSetup, "GLES2.S03_Transform", config);
+    // The update only touches CPU state, so it can run while the previous frame is drawn
+    CustomDemoAppConfig customDemoAppConfig;
+    customDemoAppConfig.SupportsPipelinedUpdate = true;
+
+    DemoAppRegister::GLES2::Register<S03_Transform>(rSetup, "GLES2.S03_Transform", config, customDemoAppConfig);
   }
 }
@@ -146,6 +146,7 @@ namespace Fsl
 
 
     // IDemoAppExtension
+    bool SupportsPipelinedUpdate() const final;
     void OnKeyEvent(const KeyEvent& event) final;
     void OnMouseButtonEvent(const MouseButtonEvent& event) final;
     void OnMouseMoveEvent(const MouseMoveEvent& event) final;
@@ -159,6 +160,7 @@ namespace Fsl
     void Update(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) final;
     void PostUpdate(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) final;
     void Resolve(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) final;
+    void SwapFrameState(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) final;
     void OnDrawSkipped(const DemoAppExtensionCallOrder callOrder, const FrameInfo& frameInfo) final;
     void End(const DemoAppExtensionCallOrder callOrder) final;
   };
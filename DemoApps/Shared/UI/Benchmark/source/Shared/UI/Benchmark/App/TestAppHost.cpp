@@ -262,6 +262,12 @@ namespace Fsl
   }
 
 
+  bool TestAppHost::SupportsPipelinedUpdate() const
+  {
+    return !m_appRecord.DemoExtension || m_appRecord.DemoExtension->SupportsPipelinedUpdate();
+  }
+
+
   void TestAppHost::OnKeyEvent(const KeyEvent& event)
   {
     if (m_appRecord.DemoExtension)
@@ -400,6 +406,16 @@ namespace Fsl
     }
   }
 
+
+  void TestAppHost::SwapFrameState(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime)
+  {
+    if (m_appRecord.DemoExtension)
+    {
+      m_appRecord.DemoExtension->SwapFrameState(callOrder, demoTime);
+    }
+  }
+
+
   void TestAppHost::OnDrawSkipped(const DemoAppExtensionCallOrder callOrder, const FrameInfo& frameInfo)
   {
     if (m_appRecord.DemoExtension)
@@ -145,6 +145,14 @@ namespace Fsl
       }
     }
 
+    inline void InvokeSwapFrameState(IDemoAppExtension* pExtension, const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime)
+    {
+      if (pExtension != nullptr)
+      {
+        pExtension->SwapFrameState(callOrder, demoTime);
+      }
+    }
+
     inline void InvokeOnDrawSkipped(IDemoAppExtension* pExtension, const DemoAppExtensionCallOrder callOrder, const FrameInfo& frameInfo)
     {
       if (pExtension != nullptr)
@@ -162,6 +170,11 @@ namespace Fsl
     }
   }
 
+  bool DemoAppExtensionForwarder::SupportsPipelinedUpdate() const
+  {
+    return (!m_extension0 || m_extension0->SupportsPipelinedUpdate()) && (!m_extension1 || m_extension1->SupportsPipelinedUpdate());
+  }
+
   void DemoAppExtensionForwarder::OnKeyEvent(const KeyEvent& event)
   {
     InvokeOnKeyEvent(m_extension0.get(), event);
@@ -261,6 +274,12 @@ namespace Fsl
     InvokeResolve(m_extension1.get(), callOrder, demoTime);
   }
 
+  void DemoAppExtensionForwarder::SwapFrameState(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime)
+  {
+    InvokeSwapFrameState(m_extension0.get(), callOrder, demoTime);
+    InvokeSwapFrameState(m_extension1.get(), callOrder, demoTime);
+  }
+
   void DemoAppExtensionForwarder::OnDrawSkipped(const DemoAppExtensionCallOrder callOrder, const FrameInfo& frameInfo)
   {
     InvokeOnDrawSkipped(m_extension0.get(), callOrder, frameInfo);
@@ -102,6 +102,7 @@ namespace Fsl
       constexpr StringViewLite Indices("Indices:");
       constexpr StringViewLite Draw("Draw:");
       constexpr StringViewLite DrawIndexed("DrawIndexed:");
+      constexpr StringViewLite Reused("Reused:");
       constexpr StringViewLite EmulateDpi("Emulate dpi");
       constexpr StringViewLite SdfFont("SDF font");
     }
@@ -717,6 +718,7 @@ namespace Fsl
     overlay.Entries[5]->SetContent(stats.IndexCount);
     overlay.Entries[6]->SetContent(stats.DrawCalls);
     overlay.Entries[7]->SetContent(stats.DrawIndexCalls);
+    overlay.ReuseRatio->SetContent(stats.ReuseRatio() * 100.0f);
   }
 
 
@@ -983,6 +985,7 @@ namespace Fsl
     auto lblDesc5 = uiFactory.CreateLabel(LocalStrings::Indices);
     auto lblDesc6 = uiFactory.CreateLabel(LocalStrings::Draw);
     auto lblDesc7 = uiFactory.CreateLabel(LocalStrings::DrawIndexed);
+    auto lblDesc8 = uiFactory.CreateLabel(LocalStrings::Reused);
 
     auto lbl0 = uiFactory.CreateFmtValueLabel(static_cast<uint32_t>(0));
     auto lbl1 = uiFactory.CreateFmtValueLabel(static_cast<uint32_t>(0));
@@ -992,6 +995,7 @@ namespace Fsl
     auto lbl5 = uiFactory.CreateFmtValueLabel(static_cast<uint32_t>(0));
     auto lbl6 = uiFactory.CreateFmtValueLabel(static_cast<uint32_t>(0));
     auto lbl7 = uiFactory.CreateFmtValueLabel(static_cast<uint32_t>(0));
+    auto lbl8 = uiFactory.CreateFmtValueLabel(0.0f, "{:.0f}%");
     lbl0->SetAlignmentX(UI::ItemAlignment::Far);
     lbl1->SetAlignmentX(UI::ItemAlignment::Far);
     lbl2->SetAlignmentX(UI::ItemAlignment::Far);
@@ -1000,6 +1004,7 @@ namespace Fsl
     lbl5->SetAlignmentX(UI::ItemAlignment::Far);
     lbl6->SetAlignmentX(UI::ItemAlignment::Far);
     lbl7->SetAlignmentX(UI::ItemAlignment::Far);
+    lbl8->SetAlignmentX(UI::ItemAlignment::Far);
 
     overlay.Entries[0] = lbl0;
     overlay.Entries[1] = lbl1;
@@ -1009,6 +1014,7 @@ namespace Fsl
     overlay.Entries[5] = lbl5;
     overlay.Entries[6] = lbl6;
     overlay.Entries[7] = lbl7;
+    overlay.ReuseRatio = lbl8;
 
     auto layout = std::make_shared<UI::GridLayout>(context);
     layout->AddColumnDefinition(UI::GridColumnDefinition(UI::GridUnitType::Auto));
@@ -1022,6 +1028,7 @@ namespace Fsl
     layout->AddRowDefinition(UI::GridRowDefinition(UI::GridUnitType::Auto));
     layout->AddRowDefinition(UI::GridRowDefinition(UI::GridUnitType::Auto));
     layout->AddRowDefinition(UI::GridRowDefinition(UI::GridUnitType::Auto));
+    layout->AddRowDefinition(UI::GridRowDefinition(UI::GridUnitType::Auto));
 
     layout->AddChild(lblDesc0, 0, 0);
     layout->AddChild(lblDesc1, 0, 1);
@@ -1031,6 +1038,7 @@ namespace Fsl
     layout->AddChild(lblDesc5, 0, 5);
     layout->AddChild(lblDesc6, 0, 6);
     layout->AddChild(lblDesc7, 0, 7);
+    layout->AddChild(lblDesc8, 0, 8);
 
     layout->AddChild(overlay.Entries[0], 1, 0);
     layout->AddChild(overlay.Entries[1], 1, 1);
@@ -1040,6 +1048,7 @@ namespace Fsl
     layout->AddChild(overlay.Entries[5], 1, 5);
     layout->AddChild(overlay.Entries[6], 1, 6);
     layout->AddChild(overlay.Entries[7], 1, 7);
+    layout->AddChild(overlay.ReuseRatio, 1, 8);
 
     overlay.MainLayout = uiFactory.CreateBackgroundWindow(UI::Theme::WindowType::Transparent, layout);
     overlay.MainLayout->SetAlignmentX(UI::ItemAlignment::Far);
@@ -94,6 +94,8 @@ namespace Fsl
     struct StatsOverlayUI
     {
       std::array<std::shared_ptr<UI::FmtValueLabel<uint32_t>>, 8> Entries;
+      //! The percentage of draw commands that reused the meshes of a earlier frame
+      std::shared_ptr<UI::FmtValueLabel<float>> ReuseRatio;
       std::shared_ptr<UI::Background> MainLayout;
     };
 
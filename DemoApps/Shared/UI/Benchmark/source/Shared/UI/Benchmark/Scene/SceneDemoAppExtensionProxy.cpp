@@ -68,6 +68,12 @@ namespace Fsl
   }
 
 
+  bool SceneDemoAppExtensionProxy::SupportsPipelinedUpdate() const
+  {
+    return m_proxy.SupportsPipelinedUpdate();
+  }
+
+
   void SceneDemoAppExtensionProxy::OnKeyEvent(const KeyEvent& event)
   {
     if (m_proxy.IsReady() && AllowInputForwarding())
@@ -203,6 +209,12 @@ namespace Fsl
   }
 
 
+  void SceneDemoAppExtensionProxy::SwapFrameState(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime)
+  {
+    m_proxy.SwapFrameState(callOrder, GetDemoTime(demoTime));
+  }
+
+
   void SceneDemoAppExtensionProxy::OnDrawSkipped(const DemoAppExtensionCallOrder callOrder, const FrameInfo& frameInfo)
   {
     m_proxy.OnDrawSkipped(callOrder, frameInfo);
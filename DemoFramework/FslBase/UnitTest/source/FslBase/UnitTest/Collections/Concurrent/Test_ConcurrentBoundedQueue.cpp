@@ -0,0 +1,386 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/Concurrent/ConcurrentBoundedQueue.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestCollections_Concurrent_ConcurrentBoundedQueue = TestFixtureFslBase;
+
+  //! A element without a default constructor whose copy constructor throws on request
+  struct ThrowingCopy
+  {
+    uint32_t Value;
+    bool ThrowOnCopy;
+
+    ThrowingCopy(const uint32_t value, const bool throwOnCopy) noexcept
+      : Value(value)
+      , ThrowOnCopy(throwOnCopy)
+    {
+    }
+
+    ThrowingCopy(const ThrowingCopy& other)
+      : Value(other.Value)
+      , ThrowOnCopy(other.ThrowOnCopy)
+    {
+      if (ThrowOnCopy)
+      {
+        throw std::runtime_error("copy failed");
+      }
+    }
+
+    ThrowingCopy(ThrowingCopy&& other) noexcept = default;
+    ThrowingCopy& operator=(const ThrowingCopy& other) = default;
+    ThrowingCopy& operator=(ThrowingCopy&& other) noexcept = default;
+  };
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, Construct)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(4);
+
+  EXPECT_EQ(4u, queue.Capacity());
+  EXPECT_EQ(0u, queue.ApproximateCount());
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, Construct_CapacityRoundedUp)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(5);
+
+  EXPECT_EQ(8u, queue.Capacity());
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, Construct_MinimumCapacity)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(1);
+
+  EXPECT_EQ(2u, queue.Capacity());
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, Construct_InvalidCapacity)
+{
+  EXPECT_THROW(ConcurrentBoundedQueue<uint32_t>(0), std::invalid_argument);
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, Clear_Empty)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(4);
+  queue.Clear();
+  EXPECT_EQ(0u, queue.ApproximateCount());
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, TryDequeue_Empty)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(4);
+
+  uint32_t value = 1u;
+  EXPECT_FALSE(queue.TryDequeue(value));
+  EXPECT_EQ(0u, value);
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, TryDequeWait_Empty)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(4);
+
+  uint32_t value = 1u;
+  EXPECT_FALSE(queue.TryDequeueWait(value, std::chrono::milliseconds(1)));
+  EXPECT_EQ(0u, value);
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, EnqueueDeque)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(4);
+  queue.Enqueue(0x42);
+  EXPECT_EQ(1u, queue.ApproximateCount());
+  EXPECT_EQ(0x42u, queue.Dequeue());
+  EXPECT_EQ(0u, queue.ApproximateCount());
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, Enqueue_TryDeque)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(4);
+  queue.Enqueue(0x42);
+
+  uint32_t value = 0u;
+  EXPECT_TRUE(queue.TryDequeue(value));
+  EXPECT_EQ(0x42u, value);
+  EXPECT_FALSE(queue.TryDequeue(value));
+  EXPECT_EQ(0u, value);
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, Enqueue_TryDequeWait)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(4);
+  queue.Enqueue(0x42);
+
+  uint32_t value = 0;
+  EXPECT_TRUE(queue.TryDequeueWait(value, std::chrono::milliseconds(1)));
+  EXPECT_EQ(0x42u, value);
+  EXPECT_FALSE(queue.TryDequeueWait(value, std::chrono::milliseconds(1)));
+  EXPECT_EQ(0u, value);
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, EnqueueClear_TryDeque)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(4);
+  queue.Enqueue(0x42);
+  queue.Clear();
+
+  uint32_t value = 1;
+  EXPECT_FALSE(queue.TryDequeue(value));
+  EXPECT_EQ(0u, value);
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, TryEnqueue_Full)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(2);
+
+  EXPECT_TRUE(queue.TryEnqueue(1u));
+  EXPECT_TRUE(queue.TryEnqueue(2u));
+  EXPECT_FALSE(queue.TryEnqueue(3u));
+  EXPECT_EQ(2u, queue.ApproximateCount());
+
+  EXPECT_EQ(1u, queue.Dequeue());
+  EXPECT_TRUE(queue.TryEnqueue(3u));
+  EXPECT_EQ(2u, queue.Dequeue());
+  EXPECT_EQ(3u, queue.Dequeue());
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, WrapAround)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(4);
+
+  for (uint32_t i = 0; i < 100u; ++i)
+  {
+    EXPECT_TRUE(queue.TryEnqueue(i));
+    EXPECT_TRUE(queue.TryEnqueue(i + 1000u));
+    EXPECT_EQ(i, queue.Dequeue());
+    EXPECT_EQ(i + 1000u, queue.Dequeue());
+  }
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, MoveOnly)
+{
+  ConcurrentBoundedQueue<std::unique_ptr<uint32_t>> queue(4);
+
+  queue.Enqueue(std::make_unique<uint32_t>(42u));
+  auto value = std::make_unique<uint32_t>(43u);
+  EXPECT_TRUE(queue.TryEnqueue(std::move(value)));
+
+  std::unique_ptr<uint32_t> result;
+  EXPECT_TRUE(queue.TryDequeue(result));
+  ASSERT_NE(nullptr, result);
+  EXPECT_EQ(42u, *result);
+
+  result = queue.Dequeue();
+  ASSERT_NE(nullptr, result);
+  EXPECT_EQ(43u, *result);
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, MoveOnly_TryEnqueueFull_LeavesValueIntact)
+{
+  ConcurrentBoundedQueue<std::unique_ptr<uint32_t>> queue(2);
+
+  EXPECT_TRUE(queue.TryEnqueue(std::make_unique<uint32_t>(1u)));
+  EXPECT_TRUE(queue.TryEnqueue(std::make_unique<uint32_t>(1u)));
+
+  auto value = std::make_unique<uint32_t>(2u);
+  EXPECT_FALSE(queue.TryEnqueue(std::move(value)));
+  ASSERT_NE(nullptr, value);    // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(2u, *value);
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, NotDefaultConstructible)
+{
+  ConcurrentBoundedQueue<ThrowingCopy> queue(2);
+
+  queue.Enqueue(ThrowingCopy(1u, false));
+  EXPECT_EQ(1u, queue.Dequeue().Value);
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, ThrowingCopy_LeavesQueueUsable)
+{
+  ConcurrentBoundedQueue<ThrowingCopy> queue(2);
+  const ThrowingCopy failing(1u, true);
+  const ThrowingCopy working(2u, false);
+
+  // Run through the cells more than once so a cell left behind by a failed copy would block the queue
+  for (uint32_t i = 0; i < 4u; ++i)
+  {
+    EXPECT_THROW(queue.Enqueue(failing), std::runtime_error);
+    EXPECT_THROW(queue.TryEnqueue(failing), std::runtime_error);
+    EXPECT_EQ(0u, queue.ApproximateCount());
+
+    EXPECT_TRUE(queue.TryEnqueue(working));
+    queue.Enqueue(working);
+    EXPECT_FALSE(queue.TryEnqueue(working));
+    EXPECT_EQ(2u, queue.Dequeue().Value);
+    EXPECT_EQ(2u, queue.Dequeue().Value);
+  }
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, Destroy_ReleasesPending)
+{
+  auto sharedValue = std::make_shared<uint32_t>(42u);
+  {
+    ConcurrentBoundedQueue<std::shared_ptr<uint32_t>> queue(4);
+    queue.Enqueue(sharedValue);
+    queue.Enqueue(sharedValue);
+    EXPECT_EQ(3, sharedValue.use_count());
+  }
+  EXPECT_EQ(1, sharedValue.use_count());
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, Extract_SpanLarger)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(4);
+
+  queue.Enqueue(42);
+  queue.Enqueue(43);
+  queue.Enqueue(44);
+
+  std::vector<uint32_t> dst(4);
+  const auto written = queue.Extract(SpanUtil::AsSpan(dst));
+
+  EXPECT_EQ(3u, written);
+  EXPECT_EQ(42u, dst[0]);
+  EXPECT_EQ(43u, dst[1]);
+  EXPECT_EQ(44u, dst[2]);
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, Extract_SpanSmaller)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(4);
+
+  queue.Enqueue(42);
+  queue.Enqueue(43);
+  queue.Enqueue(44);
+
+  std::vector<uint32_t> dst(2);
+  const auto written = queue.Extract(SpanUtil::AsSpan(dst));
+
+  EXPECT_EQ(2u, written);
+  EXPECT_EQ(42u, dst[0]);
+  EXPECT_EQ(43u, dst[1]);
+  EXPECT_EQ(44u, queue.Dequeue());
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, ExtractEmpty_Span)
+{
+  ConcurrentBoundedQueue<uint32_t> queue(4);
+
+  std::vector<uint32_t> dst(3);
+  const auto written = queue.Extract(SpanUtil::AsSpan(dst));
+
+  EXPECT_EQ(0u, written);
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentBoundedQueue, MultiProducerMultiConsumer)
+{
+  constexpr uint32_t ProducerCount = 4;
+  constexpr uint32_t ConsumerCount = 3;
+  constexpr uint32_t EntriesPerProducer = 10000;
+  constexpr uint64_t TotalEntries = uint64_t(ProducerCount) * EntriesPerProducer;
+
+  // Use a small capacity so producers will block on a full queue
+  ConcurrentBoundedQueue<uint32_t> queue(16);
+  std::atomic<uint64_t> consumedCount{0};
+  std::atomic<uint64_t> consumedSum{0};
+
+  std::vector<std::thread> threads;
+  for (uint32_t consumerIndex = 0; consumerIndex < ConsumerCount; ++consumerIndex)
+  {
+    threads.emplace_back(
+      [&queue, &consumedCount, &consumedSum]()
+      {
+        uint32_t value = 0;
+        while (consumedCount.load() < TotalEntries)
+        {
+          if (queue.TryDequeueWait(value, std::chrono::milliseconds(5)))
+          {
+            consumedSum += value;
+            ++consumedCount;
+          }
+        }
+      });
+  }
+  for (uint32_t producerIndex = 0; producerIndex < ProducerCount; ++producerIndex)
+  {
+    threads.emplace_back(
+      [&queue]()
+      {
+        for (uint32_t i = 1; i <= EntriesPerProducer; ++i)
+        {
+          queue.Enqueue(i);
+        }
+      });
+  }
+  for (auto& rThread : threads)
+  {
+    rThread.join();
+  }
+
+  constexpr uint64_t ExpectedSum = uint64_t(ProducerCount) * ((uint64_t(EntriesPerProducer) * (EntriesPerProducer + 1u)) / 2u);
+  EXPECT_EQ(TotalEntries, consumedCount.load());
+  EXPECT_EQ(ExpectedSum, consumedSum.load());
+  EXPECT_EQ(0u, queue.ApproximateCount());
+}
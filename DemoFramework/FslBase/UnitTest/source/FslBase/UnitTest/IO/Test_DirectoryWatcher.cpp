@@ -0,0 +1,189 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/Directory.hpp>
+#include <FslBase/IO/DirectoryWatcher.hpp>
+#include <FslBase/IO/File.hpp>
+#include <FslBase/Log/IO/LogPath.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBaseContent.hpp>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestIO_DirectoryWatcher = TestFixtureFslBaseContent;
+
+  //! Creates a unique empty directory that is removed again on destruction
+  class ScopedTempDirectory
+  {
+    std::filesystem::path m_path;
+
+  public:
+    explicit ScopedTempDirectory(const std::string& name)
+      : m_path(std::filesystem::temp_directory_path() / name)
+    {
+      std::filesystem::remove_all(m_path);
+      std::filesystem::create_directories(m_path);
+    }
+
+    ~ScopedTempDirectory()
+    {
+      std::error_code error;
+      std::filesystem::remove_all(m_path, error);
+    }
+
+    ScopedTempDirectory(const ScopedTempDirectory&) = delete;
+    ScopedTempDirectory& operator=(const ScopedTempDirectory&) = delete;
+
+    IO::Path GetPath() const
+    {
+      return IO::Path(m_path.generic_string());
+    }
+  };
+
+  std::string GetUniqueName(const char* const pszName)
+  {
+    return std::string("FslBaseTest_DirectoryWatcher_") + pszName + "_" +
+           std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+  }
+
+  constexpr std::chrono::milliseconds DebounceTime(20);
+  constexpr std::chrono::milliseconds ChangeTimeout(2000);
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, Construct_RelativePath)
+{
+  EXPECT_THROW(IO::DirectoryWatcher("relative/path"), std::invalid_argument);
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, Construct_NotFound)
+{
+  EXPECT_THROW(IO::DirectoryWatcher(GetContentPath("DoesNotExist/Really")), DirectoryNotFoundException);
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, NoChanges)
+{
+  if (!IO::DirectoryWatcher::IsSupported(GetContentPath()))
+  {
+    GTEST_SKIP() << "DirectoryWatcher not supported";
+  }
+
+  IO::DirectoryWatcher watcher(GetContentPath(), IO::SearchOptions::AllDirectories, DebounceTime);
+
+  // There should not be any changes to the content directory during testing
+  std::vector<IO::Path> changedFiles;
+  EXPECT_FALSE(watcher.TryWaitForChanges(changedFiles, std::chrono::milliseconds(10)));
+  EXPECT_TRUE(changedFiles.empty());
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, WriteFile)
+{
+  ScopedTempDirectory tempDir(GetUniqueName("WriteFile"));
+  if (!IO::DirectoryWatcher::IsSupported(tempDir.GetPath()))
+  {
+    GTEST_SKIP() << "DirectoryWatcher not supported";
+  }
+
+  IO::DirectoryWatcher watcher(tempDir.GetPath(), IO::SearchOptions::AllDirectories, DebounceTime);
+
+  // A burst of writes to the same file should only be reported once
+  const IO::Path filePath(IO::Path::Combine(tempDir.GetPath(), "test.txt"));
+  IO::File::WriteAllText(filePath, "hello");
+  IO::File::WriteAllText(filePath, "world");
+
+  std::vector<IO::Path> changedFiles;
+  ASSERT_TRUE(watcher.TryWaitForChanges(changedFiles, ChangeTimeout));
+  ASSERT_EQ(1u, changedFiles.size());
+  EXPECT_EQ(filePath, changedFiles[0]);
+
+  EXPECT_FALSE(watcher.TryWaitForChanges(changedFiles, std::chrono::milliseconds(10)));
+  EXPECT_TRUE(changedFiles.empty());
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, WriteFile_NewSubDirectory)
+{
+  ScopedTempDirectory tempDir(GetUniqueName("NewSubDirectory"));
+  if (!IO::DirectoryWatcher::IsSupported(tempDir.GetPath()))
+  {
+    GTEST_SKIP() << "DirectoryWatcher not supported";
+  }
+
+  IO::DirectoryWatcher watcher(tempDir.GetPath(), IO::SearchOptions::AllDirectories, DebounceTime);
+
+  const IO::Path subDirPath(IO::Path::Combine(tempDir.GetPath(), "sub"));
+  const IO::Path filePath(IO::Path::Combine(subDirPath, "test.txt"));
+  IO::Directory::CreateDir(subDirPath);
+  IO::File::WriteAllText(filePath, "hello");
+
+  std::vector<IO::Path> changedFiles;
+  ASSERT_TRUE(watcher.TryWaitForChanges(changedFiles, ChangeTimeout));
+  ASSERT_EQ(1u, changedFiles.size());
+  EXPECT_EQ(filePath, changedFiles[0]);
+
+  // The new sub directory should now be monitored too
+  const IO::Path filePath2(IO::Path::Combine(subDirPath, "test2.txt"));
+  IO::File::WriteAllText(filePath2, "world");
+  ASSERT_TRUE(watcher.TryWaitForChanges(changedFiles, ChangeTimeout));
+  ASSERT_EQ(1u, changedFiles.size());
+  EXPECT_EQ(filePath2, changedFiles[0]);
+}
+
+
+TEST_F(TestIO_DirectoryWatcher, WriteFile_TopDirectoryOnly)
+{
+  ScopedTempDirectory tempDir(GetUniqueName("TopDirectoryOnly"));
+  const IO::Path subDirPath(IO::Path::Combine(tempDir.GetPath(), "sub"));
+  IO::Directory::CreateDir(subDirPath);
+  if (!IO::DirectoryWatcher::IsSupported(tempDir.GetPath(), IO::SearchOptions::TopDirectoryOnly))
+  {
+    GTEST_SKIP() << "DirectoryWatcher not supported";
+  }
+
+  IO::DirectoryWatcher watcher(tempDir.GetPath(), IO::SearchOptions::TopDirectoryOnly, DebounceTime);
+
+  IO::File::WriteAllText(IO::Path::Combine(subDirPath, "ignored.txt"), "hello");
+  const IO::Path filePath(IO::Path::Combine(tempDir.GetPath(), "test.txt"));
+  IO::File::WriteAllText(filePath, "hello");
+
+  std::vector<IO::Path> changedFiles;
+  ASSERT_TRUE(watcher.TryWaitForChanges(changedFiles, ChangeTimeout));
+  ASSERT_EQ(1u, changedFiles.size());
+  EXPECT_EQ(filePath, changedFiles[0]);
+}
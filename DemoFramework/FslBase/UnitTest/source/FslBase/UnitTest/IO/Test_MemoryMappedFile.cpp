@@ -0,0 +1,135 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/MemoryMappedFile.hpp>
+#include <FslBase/Log/IO/LogPath.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBaseContent.hpp>
+#include <string_view>
+#include <utility>
+
+using namespace Fsl;
+
+namespace
+{
+  class TestIoMemoryMappedFile : public TestFixtureFslBaseContent
+  {
+  protected:
+    IO::Path m_helloWorldFilename;
+    IO::Path m_notExistingFilename;
+
+  public:
+    TestIoMemoryMappedFile()
+      : m_helloWorldFilename(IO::Path::Combine(GetContentPath(), "HelloWorld.txt"))
+      , m_notExistingFilename(IO::Path::Combine(GetContentPath(), "ThisIsNotAFile.txt"))
+    {
+    }
+  };
+
+  std::string_view AsStringView(const IO::MemoryMappedFile& file)
+  {
+    const auto span = file.AsReadOnlySpan();
+    return {reinterpret_cast<const char*>(span.data()), span.size()};
+  }
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Construct_Empty)
+{
+  IO::MemoryMappedFile file;
+
+  EXPECT_TRUE(file.empty());
+  EXPECT_EQ(0u, file.size());
+  EXPECT_FALSE(file.IsMapped());
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Construct)
+{
+  IO::MemoryMappedFile file(m_helloWorldFilename);
+
+  EXPECT_EQ(11u, file.size());
+  EXPECT_EQ(std::string_view("Hello world"), AsStringView(file));
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Construct_ForceRead)
+{
+  IO::MemoryMappedFile file(m_helloWorldFilename, true);
+
+  EXPECT_FALSE(file.IsMapped());
+  EXPECT_EQ(std::string_view("Hello world"), AsStringView(file));
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Construct_FileDontExist)
+{
+  EXPECT_THROW(IO::MemoryMappedFile file(m_notExistingFilename), IOException);
+  EXPECT_THROW(IO::MemoryMappedFile file(m_notExistingFilename, true), IOException);
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Move)
+{
+  IO::MemoryMappedFile file(m_helloWorldFilename);
+  const bool isMapped = file.IsMapped();
+
+  IO::MemoryMappedFile file2(std::move(file));
+  EXPECT_TRUE(file.empty());    // NOLINT(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+  EXPECT_EQ(isMapped, file2.IsMapped());
+  EXPECT_EQ(std::string_view("Hello world"), AsStringView(file2));
+
+  IO::MemoryMappedFile file3;
+  file3 = std::move(file2);
+  EXPECT_TRUE(file2.empty());    // NOLINT(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+  EXPECT_EQ(std::string_view("Hello world"), AsStringView(file3));
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Move_ForceRead)
+{
+  IO::MemoryMappedFile file(m_helloWorldFilename, true);
+  IO::MemoryMappedFile file2(std::move(file));
+
+  EXPECT_TRUE(file.empty());    // NOLINT(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+  EXPECT_EQ(std::string_view("Hello world"), AsStringView(file2));
+}
+
+
+TEST_F(TestIoMemoryMappedFile, Reset)
+{
+  IO::MemoryMappedFile file(m_helloWorldFilename);
+  file.Reset();
+
+  EXPECT_TRUE(file.empty());
+  EXPECT_FALSE(file.IsMapped());
+}
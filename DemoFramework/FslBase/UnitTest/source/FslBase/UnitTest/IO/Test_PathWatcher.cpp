@@ -79,3 +79,15 @@ TEST_F(TestIO_PathWatcher, Remove)
   watcher.Add(GetContentPath());
   watcher.Remove(GetContentPath());
 }
+
+
+TEST_F(TestIO_PathWatcher, Check_ChangedPaths)
+{
+  IO::PathWatcher watcher;
+  watcher.Add(GetContentPath());
+
+  // There should not be any changes to the content directory during testing
+  std::vector<IO::Path> changedPaths;
+  EXPECT_FALSE(watcher.Check(changedPaths));
+  EXPECT_TRUE(changedPaths.empty());
+}
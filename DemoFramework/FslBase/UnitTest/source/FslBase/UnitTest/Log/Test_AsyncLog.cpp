@@ -0,0 +1,316 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/AsyncLog.hpp>
+#include <FslBase/Log/IAsyncLogOutput.hpp>
+#include <FslBase/Log/Logger0.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestLog_AsyncLog = TestFixtureFslBase;
+
+  //! Captures the lines instead of writing them to the console
+  class CapturingOutput final : public IAsyncLogOutput
+  {
+    mutable std::mutex m_lock;
+    std::string m_text;
+
+  public:
+    void WriteLines(const StringViewLite& lines) noexcept final
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      m_text.append(lines.data(), lines.size());
+    }
+
+    void Flush() noexcept final
+    {
+    }
+
+    std::string GetText() const
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      return m_text;
+    }
+
+    std::vector<std::string> GetLines() const
+    {
+      const std::string text = GetText();
+      std::vector<std::string> lines;
+      std::size_t startIndex = 0;
+      std::size_t endIndex = text.find('\n');
+      while (endIndex != std::string::npos)
+      {
+        lines.push_back(text.substr(startIndex, endIndex - startIndex));
+        startIndex = endIndex + 1;
+        endIndex = text.find('\n', startIndex);
+      }
+      return lines;
+    }
+  };
+
+  // Ensures the sink is disabled even if a test fails
+  class ScopedAsyncLog
+  {
+  public:
+    explicit ScopedAsyncLog(const AsyncLogConfig& config, std::shared_ptr<IAsyncLogOutput> output)
+    {
+      AsyncLog::Enable(config, std::move(output));
+    }
+
+    ~ScopedAsyncLog()
+    {
+      AsyncLog::Disable();
+    }
+  };
+
+  //! Each line is '<thread index> <line index>'
+  void LogLines(const uint32_t threadCount, const uint32_t linesPerThread)
+  {
+    std::vector<std::thread> threads;
+    for (uint32_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+    {
+      threads.emplace_back(
+        [threadIndex, linesPerThread]()
+        {
+          for (uint32_t i = 0; i < linesPerThread; ++i)
+          {
+            const std::string line = std::to_string(threadIndex) + " " + std::to_string(i);
+            Logger::WriteLine(LogType::Verbose6, line.c_str());
+          }
+        });
+    }
+    for (auto& rThread : threads)
+    {
+      rThread.join();
+    }
+  }
+
+  //! Check that the lines of each thread are in the order they were logged
+  void ExpectThreadOrder(const std::vector<std::string>& lines, const uint32_t threadCount)
+  {
+    std::vector<int64_t> lastLineIndex(threadCount, -1);
+    for (const std::string& line : lines)
+    {
+      const std::size_t splitIndex = line.find(' ');
+      ASSERT_NE(std::string::npos, splitIndex);
+      const auto threadIndex = std::stoul(line.substr(0, splitIndex));
+      const auto lineIndex = std::stoll(line.substr(splitIndex + 1));
+      ASSERT_LT(threadIndex, threadCount);
+      EXPECT_LT(lastLineIndex[threadIndex], lineIndex);
+      lastLineIndex[threadIndex] = lineIndex;
+    }
+  }
+}
+
+
+TEST(TestLog_AsyncLog, EnableDisable)
+{
+  if (!AsyncLog::IsSupported())
+  {
+    GTEST_SKIP();
+  }
+
+  EXPECT_FALSE(AsyncLog::IsEnabled());
+  {
+    ScopedAsyncLog scope(AsyncLogConfig(), std::make_shared<CapturingOutput>());
+    EXPECT_TRUE(AsyncLog::IsEnabled());
+  }
+  EXPECT_FALSE(AsyncLog::IsEnabled());
+}
+
+
+TEST(TestLog_AsyncLog, Enable_Twice)
+{
+  if (!AsyncLog::IsSupported())
+  {
+    GTEST_SKIP();
+  }
+
+  ScopedAsyncLog scope(AsyncLogConfig(), std::make_shared<CapturingOutput>());
+  EXPECT_THROW(AsyncLog::Enable(AsyncLogConfig()), UsageErrorException);
+}
+
+
+TEST(TestLog_AsyncLog, Disable_NotEnabled)
+{
+  AsyncLog::Disable();
+  EXPECT_FALSE(AsyncLog::IsEnabled());
+}
+
+
+TEST(TestLog_AsyncLog, Flush_WritesAllLines)
+{
+  if (!AsyncLog::IsSupported())
+  {
+    GTEST_SKIP();
+  }
+
+  auto output = std::make_shared<CapturingOutput>();
+  const AsyncLogStats statsBefore = AsyncLog::GetStats();
+  {
+    ScopedAsyncLog scope(AsyncLogConfig(), output);
+    Logger::WriteLine(LogType::Verbose6, "AsyncLog test line 1");
+    Logger::WriteLine(LogType::Verbose6, "AsyncLog test line 2");
+    AsyncLog::Flush();
+
+    EXPECT_EQ("AsyncLog test line 1\nAsyncLog test line 2\n", output->GetText());
+    const AsyncLogStats stats = AsyncLog::GetStats();
+    EXPECT_EQ(statsBefore.LinesWritten + 2u, stats.LinesWritten);
+    EXPECT_EQ(statsBefore.LinesDropped, stats.LinesDropped);
+    EXPECT_EQ(0u, stats.BacklogDepth);
+  }
+}
+
+
+TEST(TestLog_AsyncLog, Flush_WarningAndErrorPrefix)
+{
+  if (!AsyncLog::IsSupported())
+  {
+    GTEST_SKIP();
+  }
+
+  auto output = std::make_shared<CapturingOutput>();
+  {
+    ScopedAsyncLog scope(AsyncLogConfig(), output);
+    Logger::WriteLine(LogType::Warning, "warning");
+    Logger::WriteLine(LogType::Error, "error");
+    AsyncLog::Flush();
+  }
+  EXPECT_EQ("WARNING: warning\nERROR: error\n", output->GetText());
+}
+
+
+TEST(TestLog_AsyncLog, MultiThreaded_KeepsLogOrder)
+{
+  if (!AsyncLog::IsSupported())
+  {
+    GTEST_SKIP();
+  }
+
+  auto output = std::make_shared<CapturingOutput>();
+  {
+    // A long flush interval keeps all lines in the thread buffers until the flush
+    ScopedAsyncLog scope(AsyncLogConfig(AsyncLogOverflowPolicy::Block, AsyncLogConfig::DefaultThreadBufferCapacity, std::chrono::hours(1)), output);
+    Logger::WriteLine(LogType::Verbose6, "1");
+    std::thread thread([]() { Logger::WriteLine(LogType::Verbose6, "2"); });
+    thread.join();
+    Logger::WriteLine(LogType::Verbose6, "3");
+    AsyncLog::Flush();
+  }
+  EXPECT_EQ("1\n2\n3\n", output->GetText());
+}
+
+
+TEST(TestLog_AsyncLog, Block_MultiThreaded_NoLinesLost)
+{
+  if (!AsyncLog::IsSupported())
+  {
+    GTEST_SKIP();
+  }
+
+  constexpr uint32_t ThreadCount = 4;
+  constexpr uint32_t LinesPerThread = 500;
+
+  auto output = std::make_shared<CapturingOutput>();
+  const AsyncLogStats statsBefore = AsyncLog::GetStats();
+  {
+    // Use the smallest buffer to force the producers to wait on the writer
+    ScopedAsyncLog scope(AsyncLogConfig(AsyncLogOverflowPolicy::Block, 256, std::chrono::milliseconds(1)), output);
+    LogLines(ThreadCount, LinesPerThread);
+  }
+  const AsyncLogStats stats = AsyncLog::GetStats();
+  EXPECT_EQ(statsBefore.LinesWritten + (ThreadCount * LinesPerThread), stats.LinesWritten);
+  EXPECT_EQ(statsBefore.LinesDropped, stats.LinesDropped);
+  EXPECT_EQ(0u, stats.BacklogDepth);
+
+  const std::vector<std::string> lines = output->GetLines();
+  EXPECT_EQ(ThreadCount * LinesPerThread, lines.size());
+  ExpectThreadOrder(lines, ThreadCount);
+}
+
+
+TEST(TestLog_AsyncLog, Drop_MultiThreaded_AllLinesAccountedFor)
+{
+  if (!AsyncLog::IsSupported())
+  {
+    GTEST_SKIP();
+  }
+
+  constexpr uint32_t ThreadCount = 4;
+  constexpr uint32_t LinesPerThread = 500;
+
+  auto output = std::make_shared<CapturingOutput>();
+  const AsyncLogStats statsBefore = AsyncLog::GetStats();
+  {
+    ScopedAsyncLog scope(AsyncLogConfig(AsyncLogOverflowPolicy::Drop, 256, std::chrono::milliseconds(1)), output);
+    LogLines(ThreadCount, LinesPerThread);
+  }
+  const AsyncLogStats stats = AsyncLog::GetStats();
+  const uint64_t written = stats.LinesWritten - statsBefore.LinesWritten;
+  const uint64_t dropped = stats.LinesDropped - statsBefore.LinesDropped;
+  EXPECT_EQ(uint64_t(ThreadCount) * LinesPerThread, written + dropped);
+  EXPECT_EQ(0u, stats.BacklogDepth);
+
+  const std::vector<std::string> lines = output->GetLines();
+  EXPECT_EQ(written, lines.size());
+  ExpectThreadOrder(lines, ThreadCount);
+}
+
+
+TEST(TestLog_AsyncLog, LineLargerThanBuffer_WrittenAfterPendingLines)
+{
+  if (!AsyncLog::IsSupported())
+  {
+    GTEST_SKIP();
+  }
+
+  auto output = std::make_shared<CapturingOutput>();
+  const std::string longLine(1024, 'X');
+  const AsyncLogStats statsBefore = AsyncLog::GetStats();
+  {
+    ScopedAsyncLog scope(AsyncLogConfig(AsyncLogOverflowPolicy::Drop, 256, std::chrono::hours(1)), output);
+    Logger::WriteLine(LogType::Verbose6, "pending");
+    Logger::WriteLine(LogType::Verbose6, longLine.c_str());
+    EXPECT_EQ("pending\n" + longLine + "\n", output->GetText());
+  }
+  const AsyncLogStats stats = AsyncLog::GetStats();
+  EXPECT_EQ(statsBefore.LinesWritten + 2u, stats.LinesWritten);
+  EXPECT_EQ(statsBefore.LinesDropped, stats.LinesDropped);
+}
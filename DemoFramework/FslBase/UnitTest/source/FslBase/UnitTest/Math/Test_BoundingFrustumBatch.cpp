@@ -0,0 +1,296 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Math/BoundingBoxSoA.hpp>
+#include <FslBase/Math/BoundingFrustum.hpp>
+#include <FslBase/Math/BoundingFrustumBatch.hpp>
+#include <FslBase/Math/BoundingSphereSoA.hpp>
+#include <FslBase/Math/MathHelper.hpp>
+#include <FslBase/Math/Matrix.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestMath_BoundingFrustumBatch = TestFixtureFslBase;
+
+  constexpr std::array<BoundingFrustumBatchKernelSet, 4> AllKernelSets = {BoundingFrustumBatchKernelSet::Scalar, BoundingFrustumBatchKernelSet::SSE41,
+                                                                          BoundingFrustumBatchKernelSet::AVX2, BoundingFrustumBatchKernelSet::Neon};
+
+  BoundingFrustum CreateFrustum()
+  {
+    const Matrix view = Matrix::CreateLookAt(Vector3(5.0f, 2.0f, 20.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3::Up());
+    const Matrix projection = Matrix::CreatePerspectiveFieldOfView(MathHelper::ToRadians(60.0f), 16.0f / 9.0f, 0.5f, 60.0f);
+    return BoundingFrustum(view * projection);
+  }
+
+  std::vector<BoundingBox> CreateBoxes(const uint32_t count)
+  {
+    std::mt19937 random(1337);
+    std::uniform_real_distribution<float> positionDistribution(-80.0f, 80.0f);
+    std::uniform_real_distribution<float> extentDistribution(0.01f, 6.0f);
+    std::vector<BoundingBox> boxes(count);
+    for (auto& rBox : boxes)
+    {
+      const Vector3 center(positionDistribution(random), positionDistribution(random), positionDistribution(random));
+      const Vector3 extent(extentDistribution(random), extentDistribution(random), extentDistribution(random));
+      rBox = BoundingBox(center - extent, center + extent);
+    }
+    return boxes;
+  }
+
+  std::vector<BoundingSphere> CreateSpheres(const uint32_t count)
+  {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> positionDistribution(-80.0f, 80.0f);
+    std::uniform_real_distribution<float> radiusDistribution(0.01f, 6.0f);
+    std::vector<BoundingSphere> spheres(count);
+    for (auto& rSphere : spheres)
+    {
+      rSphere = BoundingSphere(Vector3(positionDistribution(random), positionDistribution(random), positionDistribution(random)),
+                               radiusDistribution(random));
+    }
+    return spheres;
+  }
+
+  template <typename T>
+  std::vector<uint32_t> CalcExpectedMask(const BoundingFrustum& frustum, const std::vector<T>& volumes)
+  {
+    std::vector<uint32_t> mask(BoundingFrustumBatch::CalcVisibilityMaskLength(static_cast<uint32_t>(volumes.size())));
+    for (std::size_t i = 0; i < volumes.size(); ++i)
+    {
+      if (frustum.Intersects(volumes[i]))
+      {
+        mask[i / 32u] |= 1u << (i % 32u);
+      }
+    }
+    return mask;
+  }
+
+  template <typename T>
+  std::vector<uint32_t> CalcExpectedIndices(const BoundingFrustum& frustum, const std::vector<T>& volumes)
+  {
+    std::vector<uint32_t> indices;
+    for (std::size_t i = 0; i < volumes.size(); ++i)
+    {
+      if (frustum.Intersects(volumes[i]))
+      {
+        indices.push_back(static_cast<uint32_t>(i));
+      }
+    }
+    return indices;
+  }
+}
+
+
+TEST(TestMath_BoundingFrustumBatch, CalcVisibilityMaskLength)
+{
+  EXPECT_EQ(0u, BoundingFrustumBatch::CalcVisibilityMaskLength(0));
+  EXPECT_EQ(1u, BoundingFrustumBatch::CalcVisibilityMaskLength(1));
+  EXPECT_EQ(1u, BoundingFrustumBatch::CalcVisibilityMaskLength(32));
+  EXPECT_EQ(2u, BoundingFrustumBatch::CalcVisibilityMaskLength(33));
+}
+
+
+TEST(TestMath_BoundingFrustumBatch, IsSupported_Scalar)
+{
+  EXPECT_TRUE(BoundingFrustumBatch::IsSupported(BoundingFrustumBatchKernelSet::Scalar));
+  EXPECT_TRUE(BoundingFrustumBatch::IsSupported(BoundingFrustumBatch::GetBestKernelSet()));
+}
+
+
+TEST(TestMath_BoundingFrustumBatch, SoA_RoundTrip)
+{
+  const auto boxes = CreateBoxes(5);
+  const BoundingBoxSoA boxesSoA(SpanUtil::AsReadOnlySpan(boxes));
+  ASSERT_EQ(boxes.size(), boxesSoA.Count());
+  for (uint32_t i = 0; i < boxesSoA.Count(); ++i)
+  {
+    EXPECT_EQ(boxes[i], boxesSoA.Get(i));
+  }
+
+  const auto spheres = CreateSpheres(5);
+  BoundingSphereSoA spheresSoA(SpanUtil::AsReadOnlySpan(spheres));
+  ASSERT_EQ(spheres.size(), spheresSoA.Count());
+  for (uint32_t i = 0; i < spheresSoA.Count(); ++i)
+  {
+    EXPECT_EQ(spheres[i], spheresSoA.Get(i));
+  }
+  spheresSoA.Set(1, spheres[0]);
+  EXPECT_EQ(spheres[0], spheresSoA.Get(1));
+}
+
+
+TEST(TestMath_BoundingFrustumBatch, CalcVisibilityMask_Empty)
+{
+  const BoundingFrustum frustum = CreateFrustum();
+  EXPECT_NO_THROW(BoundingFrustumBatch::CalcVisibilityMask(frustum, BoundingBoxSoA(), Span<uint32_t>()));
+  EXPECT_NO_THROW(BoundingFrustumBatch::CalcVisibilityMask(frustum, BoundingSphereSoA(), Span<uint32_t>()));
+}
+
+
+TEST(TestMath_BoundingFrustumBatch, CalcVisibilityMask_TooSmall)
+{
+  const BoundingFrustum frustum = CreateFrustum();
+  const BoundingBoxSoA boxes(SpanUtil::AsReadOnlySpan(CreateBoxes(33)));
+  std::vector<uint32_t> mask(1);
+  EXPECT_THROW(BoundingFrustumBatch::CalcVisibilityMask(frustum, boxes, SpanUtil::AsSpan(mask)), std::invalid_argument);
+  std::vector<uint32_t> indices(32);
+  EXPECT_THROW(BoundingFrustumBatch::CalcVisibleIndices(frustum, boxes, SpanUtil::AsSpan(indices)), std::invalid_argument);
+}
+
+
+TEST(TestMath_BoundingFrustumBatch, CalcVisibilityMask_Box_AllKernelSets)
+{
+  const BoundingFrustum frustum = CreateFrustum();
+  // Use a count that leaves a partial mask entry so the scalar tail of the SIMD kernels is exercised
+  const auto boxes = CreateBoxes((32 * 100) + 13);
+  const BoundingBoxSoA boxesSoA(SpanUtil::AsReadOnlySpan(boxes));
+  const auto expected = CalcExpectedMask(frustum, boxes);
+
+  uint32_t visibleCount = 0;
+  for (const auto entry : expected)
+  {
+    visibleCount += static_cast<uint32_t>(std::popcount(entry));
+  }
+  // Ensure the test data contains both visible and culled boxes
+  ASSERT_GT(visibleCount, 0u);
+  ASSERT_LT(visibleCount, boxes.size());
+
+  for (const auto kernelSet : AllKernelSets)
+  {
+    if (BoundingFrustumBatch::IsSupported(kernelSet))
+    {
+      std::vector<uint32_t> mask(expected.size(), 0xFFFFFFFF);
+      BoundingFrustumBatch::CalcVisibilityMask(kernelSet, frustum, boxesSoA, SpanUtil::AsSpan(mask));
+      EXPECT_EQ(expected, mask) << "KernelSet: " << static_cast<int>(kernelSet);
+    }
+    else
+    {
+      std::vector<uint32_t> mask(expected.size());
+      EXPECT_THROW(BoundingFrustumBatch::CalcVisibilityMask(kernelSet, frustum, boxesSoA, SpanUtil::AsSpan(mask)), NotSupportedException);
+    }
+  }
+}
+
+
+TEST(TestMath_BoundingFrustumBatch, CalcVisibilityMask_Sphere_AllKernelSets)
+{
+  const BoundingFrustum frustum = CreateFrustum();
+  const auto spheres = CreateSpheres((32 * 100) + 7);
+  const BoundingSphereSoA spheresSoA(SpanUtil::AsReadOnlySpan(spheres));
+  const auto expected = CalcExpectedMask(frustum, spheres);
+
+  for (const auto kernelSet : AllKernelSets)
+  {
+    if (BoundingFrustumBatch::IsSupported(kernelSet))
+    {
+      std::vector<uint32_t> mask(expected.size(), 0xFFFFFFFF);
+      BoundingFrustumBatch::CalcVisibilityMask(kernelSet, frustum, spheresSoA, SpanUtil::AsSpan(mask));
+      EXPECT_EQ(expected, mask) << "KernelSet: " << static_cast<int>(kernelSet);
+    }
+  }
+}
+
+
+TEST(TestMath_BoundingFrustumBatch, CalcVisibilityMask_JobSystem)
+{
+  JobSystem jobSystem(3);
+  const BoundingFrustum frustum = CreateFrustum();
+  // Large enough to be split into multiple jobs
+  const auto boxes = CreateBoxes((100 * 1024) + 5);
+  const auto spheres = CreateSpheres((100 * 1024) + 5);
+  const BoundingBoxSoA boxesSoA(SpanUtil::AsReadOnlySpan(boxes));
+  const BoundingSphereSoA spheresSoA(SpanUtil::AsReadOnlySpan(spheres));
+
+  {
+    const auto expected = CalcExpectedMask(frustum, boxes);
+    std::vector<uint32_t> mask(expected.size(), 0xFFFFFFFF);
+    BoundingFrustumBatch::CalcVisibilityMask(jobSystem, frustum, boxesSoA, SpanUtil::AsSpan(mask));
+    EXPECT_EQ(expected, mask);
+  }
+  {
+    const auto expected = CalcExpectedMask(frustum, spheres);
+    std::vector<uint32_t> mask(expected.size(), 0xFFFFFFFF);
+    BoundingFrustumBatch::CalcVisibilityMask(jobSystem, frustum, spheresSoA, SpanUtil::AsSpan(mask));
+    EXPECT_EQ(expected, mask);
+  }
+}
+
+
+TEST(TestMath_BoundingFrustumBatch, CalcVisibleIndices)
+{
+  const BoundingFrustum frustum = CreateFrustum();
+  // Larger than a internal batch
+  const auto boxes = CreateBoxes(5000);
+  const auto spheres = CreateSpheres(5000);
+  const BoundingBoxSoA boxesSoA(SpanUtil::AsReadOnlySpan(boxes));
+  const BoundingSphereSoA spheresSoA(SpanUtil::AsReadOnlySpan(spheres));
+
+  {
+    const auto expected = CalcExpectedIndices(frustum, boxes);
+    std::vector<uint32_t> indices(boxes.size());
+    const uint32_t count = BoundingFrustumBatch::CalcVisibleIndices(frustum, boxesSoA, SpanUtil::AsSpan(indices));
+    indices.resize(count);
+    EXPECT_EQ(expected, indices);
+  }
+  {
+    const auto expected = CalcExpectedIndices(frustum, spheres);
+    std::vector<uint32_t> indices(spheres.size());
+    const uint32_t count = BoundingFrustumBatch::CalcVisibleIndices(frustum, spheresSoA, SpanUtil::AsSpan(indices));
+    indices.resize(count);
+    EXPECT_EQ(expected, indices);
+  }
+}
+
+
+TEST(TestMath_BoundingFrustumBatch, CompactVisibilityMask)
+{
+  // The bits past the count are ignored
+  const std::array<uint32_t, 2> mask = {0x80000005u, 0xFFFFFFFAu};
+  std::array<uint32_t, 36> indices{};
+  const uint32_t count = BoundingFrustumBatch::CompactVisibilityMask(ReadOnlySpan<uint32_t>(mask.data(), mask.size()), 36,
+                                                                     Span<uint32_t>(indices.data(), indices.size()));
+  ASSERT_EQ(5u, count);
+  EXPECT_EQ(0u, indices[0]);
+  EXPECT_EQ(2u, indices[1]);
+  EXPECT_EQ(31u, indices[2]);
+  EXPECT_EQ(33u, indices[3]);
+  EXPECT_EQ(35u, indices[4]);
+}
@@ -0,0 +1,371 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/Math/LogMatrix.hpp>
+#include <FslBase/Log/Math/LogVector3.hpp>
+#include <FslBase/Log/Math/LogVector4.hpp>
+#include <FslBase/Math/MathHelper.hpp>
+#include <FslBase/Math/MatrixBatch.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestMath_MatrixBatch = TestFixtureFslBase;
+
+  constexpr std::array<MatrixBatchKernelSet, 3> AllKernelSets = {MatrixBatchKernelSet::Scalar, MatrixBatchKernelSet::SSE41,
+                                                                 MatrixBatchKernelSet::Neon};
+
+  // The SIMD kernels use the same operation order as the scalar code, but the compiler is allowed to contract the scalar code into FMA
+  // instructions on some platforms so we allow a tiny relative error.
+  constexpr float TransformTolerance = 1e-6f;
+  // The SIMD inverse is calculated in single precision
+  constexpr float InvertTolerance = 1e-4f;
+
+  bool IsNear(const float expected, const float actual, const float tolerance)
+  {
+    return std::abs(expected - actual) <= (tolerance * std::max(1.0f, std::abs(expected)));
+  }
+
+  ::testing::AssertionResult IsNear(const Vector3& expected, const Vector3& actual, const float tolerance = TransformTolerance)
+  {
+    if (IsNear(expected.X, actual.X, tolerance) && IsNear(expected.Y, actual.Y, tolerance) && IsNear(expected.Z, actual.Z, tolerance))
+    {
+      return ::testing::AssertionSuccess();
+    }
+    return ::testing::AssertionFailure() << "expected " << expected << " got " << actual;
+  }
+
+  ::testing::AssertionResult IsNear(const Vector4& expected, const Vector4& actual, const float tolerance = TransformTolerance)
+  {
+    if (IsNear(expected.X, actual.X, tolerance) && IsNear(expected.Y, actual.Y, tolerance) && IsNear(expected.Z, actual.Z, tolerance) &&
+        IsNear(expected.W, actual.W, tolerance))
+    {
+      return ::testing::AssertionSuccess();
+    }
+    return ::testing::AssertionFailure() << "expected " << expected << " got " << actual;
+  }
+
+  ::testing::AssertionResult IsNear(const Matrix& expected, const Matrix& actual, const float tolerance = TransformTolerance)
+  {
+    for (std::size_t i = 0; i < Matrix::NumElements; ++i)
+    {
+      if (!IsNear(expected.DirectAccess()[i], actual.DirectAccess()[i], tolerance))
+      {
+        return ::testing::AssertionFailure() << "expected " << expected << " got " << actual;
+      }
+    }
+    return ::testing::AssertionSuccess();
+  }
+
+  Matrix CreateTransform(std::mt19937& rRandom)
+  {
+    std::uniform_real_distribution<float> angleDistribution(0.0f, MathHelper::TO_RADS * 360.0f);
+    std::uniform_real_distribution<float> scaleDistribution(0.5f, 2.0f);
+    std::uniform_real_distribution<float> positionDistribution(-50.0f, 50.0f);
+    return Matrix::CreateScale(scaleDistribution(rRandom), scaleDistribution(rRandom), scaleDistribution(rRandom)) *
+           Matrix::CreateFromYawPitchRoll(angleDistribution(rRandom), angleDistribution(rRandom), angleDistribution(rRandom)) *
+           Matrix::CreateTranslation(positionDistribution(rRandom), positionDistribution(rRandom), positionDistribution(rRandom));
+  }
+
+  std::vector<Matrix> CreateMatrices(const std::size_t count, const uint32_t seed)
+  {
+    std::mt19937 random(seed);
+    std::vector<Matrix> matrices(count);
+    for (auto& rMatrix : matrices)
+    {
+      rMatrix = CreateTransform(random);
+    }
+    return matrices;
+  }
+
+  std::vector<Vector3> CreateVector3(const std::size_t count)
+  {
+    std::mt19937 random(1337);
+    std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+    std::vector<Vector3> vectors(count);
+    for (auto& rVector : vectors)
+    {
+      rVector = Vector3(distribution(random), distribution(random), distribution(random));
+    }
+    return vectors;
+  }
+
+  std::vector<Vector4> CreateVector4(const std::size_t count)
+  {
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+    std::vector<Vector4> vectors(count);
+    for (auto& rVector : vectors)
+    {
+      rVector = Vector4(distribution(random), distribution(random), distribution(random), distribution(random));
+    }
+    return vectors;
+  }
+
+  Matrix CreatePerspectiveViewMatrix()
+  {
+    const Matrix view = Matrix::CreateLookAt(Vector3(5.0f, 2.0f, 20.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3::Up());
+    const Matrix projection = Matrix::CreatePerspectiveFieldOfView(MathHelper::ToRadians(60.0f), 16.0f / 9.0f, 0.5f, 60.0f);
+    return view * projection;
+  }
+}
+
+
+TEST(TestMath_MatrixBatch, IsSupported_Scalar)
+{
+  EXPECT_TRUE(MatrixBatch::IsSupported(MatrixBatchKernelSet::Scalar));
+  EXPECT_TRUE(MatrixBatch::IsSupported(MatrixBatch::GetBestKernelSet()));
+}
+
+
+TEST(TestMath_MatrixBatch, Unsupported_Throws)
+{
+  const std::vector<Vector3> src = CreateVector3(4);
+  std::vector<Vector3> dst(src.size());
+  for (const auto kernelSet : AllKernelSets)
+  {
+    if (!MatrixBatch::IsSupported(kernelSet))
+    {
+      EXPECT_THROW(MatrixBatch::Transform(kernelSet, SpanUtil::AsReadOnlySpan(src), Matrix::GetIdentity(), SpanUtil::AsSpan(dst)),
+                   NotSupportedException);
+    }
+  }
+}
+
+
+TEST(TestMath_MatrixBatch, Transform_Vector3)
+{
+  const Matrix matrix = CreatePerspectiveViewMatrix();
+  // Use a count that leaves a remainder for the scalar tail of the SIMD kernels
+  const std::vector<Vector3> src = CreateVector3(37);
+  for (const auto kernelSet : AllKernelSets)
+  {
+    if (MatrixBatch::IsSupported(kernelSet))
+    {
+      std::vector<Vector3> dst(src.size());
+      MatrixBatch::Transform(kernelSet, SpanUtil::AsReadOnlySpan(src), matrix, SpanUtil::AsSpan(dst));
+      for (std::size_t i = 0; i < src.size(); ++i)
+      {
+        EXPECT_TRUE(IsNear(Vector3::Transform(src[i], matrix), dst[i])) << "kernelSet " << static_cast<int>(kernelSet) << " index " << i;
+      }
+    }
+  }
+}
+
+
+TEST(TestMath_MatrixBatch, Transform_Vector3_InPlace)
+{
+  std::mt19937 random(7);
+  const Matrix matrix = CreateTransform(random);
+  const std::vector<Vector3> src = CreateVector3(19);
+  for (const auto kernelSet : AllKernelSets)
+  {
+    if (MatrixBatch::IsSupported(kernelSet))
+    {
+      std::vector<Vector3> values(src);
+      MatrixBatch::Transform(kernelSet, SpanUtil::AsReadOnlySpan(values), matrix, SpanUtil::AsSpan(values));
+      for (std::size_t i = 0; i < src.size(); ++i)
+      {
+        EXPECT_TRUE(IsNear(Vector3::Transform(src[i], matrix), values[i])) << "kernelSet " << static_cast<int>(kernelSet) << " index " << i;
+      }
+    }
+  }
+}
+
+
+TEST(TestMath_MatrixBatch, TransformNormal_Vector3)
+{
+  std::mt19937 random(3);
+  const Matrix matrix = CreateTransform(random);
+  const std::vector<Vector3> src = CreateVector3(37);
+  for (const auto kernelSet : AllKernelSets)
+  {
+    if (MatrixBatch::IsSupported(kernelSet))
+    {
+      std::vector<Vector3> dst(src.size());
+      MatrixBatch::TransformNormal(kernelSet, SpanUtil::AsReadOnlySpan(src), matrix, SpanUtil::AsSpan(dst));
+      for (std::size_t i = 0; i < src.size(); ++i)
+      {
+        EXPECT_TRUE(IsNear(Vector3::TransformNormal(src[i], matrix), dst[i])) << "kernelSet " << static_cast<int>(kernelSet) << " index " << i;
+      }
+    }
+  }
+}
+
+
+TEST(TestMath_MatrixBatch, Transform_Vector4)
+{
+  const Matrix matrix = CreatePerspectiveViewMatrix();
+  const std::vector<Vector4> src = CreateVector4(13);
+  for (const auto kernelSet : AllKernelSets)
+  {
+    if (MatrixBatch::IsSupported(kernelSet))
+    {
+      std::vector<Vector4> dst(src.size());
+      MatrixBatch::Transform(kernelSet, SpanUtil::AsReadOnlySpan(src), matrix, SpanUtil::AsSpan(dst));
+      for (std::size_t i = 0; i < src.size(); ++i)
+      {
+        EXPECT_TRUE(IsNear(Vector4::Transform(src[i], matrix), dst[i])) << "kernelSet " << static_cast<int>(kernelSet) << " index " << i;
+      }
+    }
+  }
+}
+
+
+TEST(TestMath_MatrixBatch, Multiply)
+{
+  const std::vector<Matrix> lhs = CreateMatrices(9, 1);
+  const std::vector<Matrix> rhs = CreateMatrices(9, 2);
+  const Matrix viewProjection = CreatePerspectiveViewMatrix();
+  for (const auto kernelSet : AllKernelSets)
+  {
+    if (MatrixBatch::IsSupported(kernelSet))
+    {
+      std::vector<Matrix> dst1(lhs.size());
+      std::vector<Matrix> dst2(lhs.size());
+      std::vector<Matrix> dst3(lhs.size());
+      MatrixBatch::Multiply(kernelSet, SpanUtil::AsReadOnlySpan(lhs), viewProjection, SpanUtil::AsSpan(dst1));
+      MatrixBatch::Multiply(kernelSet, viewProjection, SpanUtil::AsReadOnlySpan(rhs), SpanUtil::AsSpan(dst2));
+      MatrixBatch::Multiply(kernelSet, SpanUtil::AsReadOnlySpan(lhs), SpanUtil::AsReadOnlySpan(rhs), SpanUtil::AsSpan(dst3));
+      for (std::size_t i = 0; i < lhs.size(); ++i)
+      {
+        EXPECT_TRUE(IsNear(Matrix::Multiply(lhs[i], viewProjection), dst1[i])) << "kernelSet " << static_cast<int>(kernelSet) << " index " << i;
+        EXPECT_TRUE(IsNear(Matrix::Multiply(viewProjection, rhs[i]), dst2[i])) << "kernelSet " << static_cast<int>(kernelSet) << " index " << i;
+        EXPECT_TRUE(IsNear(Matrix::Multiply(lhs[i], rhs[i]), dst3[i])) << "kernelSet " << static_cast<int>(kernelSet) << " index " << i;
+      }
+    }
+  }
+}
+
+
+TEST(TestMath_MatrixBatch, Multiply_InPlace)
+{
+  const std::vector<Matrix> src = CreateMatrices(5, 3);
+  const Matrix viewProjection = CreatePerspectiveViewMatrix();
+  for (const auto kernelSet : AllKernelSets)
+  {
+    if (MatrixBatch::IsSupported(kernelSet))
+    {
+      std::vector<Matrix> values(src);
+      MatrixBatch::Multiply(kernelSet, SpanUtil::AsReadOnlySpan(values), viewProjection, SpanUtil::AsSpan(values));
+      for (std::size_t i = 0; i < src.size(); ++i)
+      {
+        EXPECT_TRUE(IsNear(Matrix::Multiply(src[i], viewProjection), values[i])) << "kernelSet " << static_cast<int>(kernelSet) << " index " << i;
+      }
+    }
+  }
+}
+
+
+TEST(TestMath_MatrixBatch, Transpose)
+{
+  const std::vector<Matrix> src = CreateMatrices(5, 4);
+  for (const auto kernelSet : AllKernelSets)
+  {
+    if (MatrixBatch::IsSupported(kernelSet))
+    {
+      std::vector<Matrix> dst(src.size());
+      MatrixBatch::Transpose(kernelSet, SpanUtil::AsReadOnlySpan(src), SpanUtil::AsSpan(dst));
+      for (std::size_t i = 0; i < src.size(); ++i)
+      {
+        EXPECT_EQ(Matrix::Transpose(src[i]), dst[i]) << "kernelSet " << static_cast<int>(kernelSet) << " index " << i;
+      }
+    }
+  }
+}
+
+
+TEST(TestMath_MatrixBatch, Invert)
+{
+  constexpr std::size_t numAffine = 8;
+  std::vector<Matrix> src = CreateMatrices(numAffine, 5);
+  src.push_back(CreatePerspectiveViewMatrix());
+  src.push_back(Matrix::GetIdentity());
+  for (const auto kernelSet : AllKernelSets)
+  {
+    if (MatrixBatch::IsSupported(kernelSet))
+    {
+      std::vector<Matrix> dst(src.size());
+      MatrixBatch::Invert(kernelSet, SpanUtil::AsReadOnlySpan(src), SpanUtil::AsSpan(dst));
+      for (std::size_t i = 0; i < src.size(); ++i)
+      {
+        EXPECT_TRUE(IsNear(Matrix::Invert(src[i]), dst[i], InvertTolerance)) << "kernelSet " << static_cast<int>(kernelSet) << " index " << i;
+        if (i < numAffine)
+        {
+          EXPECT_TRUE(IsNear(Matrix::GetIdentity(), src[i] * dst[i], InvertTolerance))
+            << "kernelSet " << static_cast<int>(kernelSet) << " index " << i;
+        }
+      }
+
+      // In place
+      std::vector<Matrix> values(src);
+      MatrixBatch::Invert(kernelSet, SpanUtil::AsReadOnlySpan(values), SpanUtil::AsSpan(values));
+      for (std::size_t i = 0; i < src.size(); ++i)
+      {
+        EXPECT_EQ(dst[i], values[i]) << "kernelSet " << static_cast<int>(kernelSet) << " index " << i;
+      }
+    }
+  }
+}
+
+
+TEST(TestMath_MatrixBatch, Empty)
+{
+  const std::vector<Vector3> src;
+  std::vector<Vector3> dst;
+  EXPECT_NO_THROW(MatrixBatch::Transform(SpanUtil::AsReadOnlySpan(src), Matrix::GetIdentity(), SpanUtil::AsSpan(dst)));
+}
+
+
+TEST(TestMath_MatrixBatch, InvalidArguments)
+{
+  const std::vector<Vector3> src3 = CreateVector3(4);
+  std::vector<Vector3> dst3(src3.size() - 1);
+  EXPECT_THROW(MatrixBatch::Transform(SpanUtil::AsReadOnlySpan(src3), Matrix::GetIdentity(), SpanUtil::AsSpan(dst3)), std::invalid_argument);
+  EXPECT_THROW(MatrixBatch::TransformNormal(SpanUtil::AsReadOnlySpan(src3), Matrix::GetIdentity(), SpanUtil::AsSpan(dst3)), std::invalid_argument);
+
+  const std::vector<Matrix> lhs = CreateMatrices(3, 1);
+  const std::vector<Matrix> rhs = CreateMatrices(2, 2);
+  std::vector<Matrix> dst(lhs.size());
+  EXPECT_THROW(MatrixBatch::Multiply(SpanUtil::AsReadOnlySpan(lhs), SpanUtil::AsReadOnlySpan(rhs), SpanUtil::AsSpan(dst)), std::invalid_argument);
+  std::vector<Matrix> smallDst(lhs.size() - 1);
+  EXPECT_THROW(MatrixBatch::Multiply(SpanUtil::AsReadOnlySpan(lhs), Matrix::GetIdentity(), SpanUtil::AsSpan(smallDst)), std::invalid_argument);
+  EXPECT_THROW(MatrixBatch::Invert(SpanUtil::AsReadOnlySpan(lhs), SpanUtil::AsSpan(smallDst)), std::invalid_argument);
+}
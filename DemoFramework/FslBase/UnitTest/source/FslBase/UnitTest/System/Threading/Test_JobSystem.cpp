@@ -0,0 +1,326 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <array>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestSystem_Threading_JobSystem = TestFixtureFslBase;
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Construct)
+{
+  JobSystem jobSystem(2);
+
+  EXPECT_EQ(2u, jobSystem.GetWorkerThreadCount());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Construct_ZeroThreads)
+{
+  JobSystem jobSystem(0);
+
+  EXPECT_EQ(1u, jobSystem.GetWorkerThreadCount());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Schedule_Wait)
+{
+  JobSystem jobSystem(2);
+  std::atomic<uint32_t> value{0};
+
+  JobHandle handle = jobSystem.Schedule([&value]() { value = 42; });
+  jobSystem.Wait(handle);
+
+  EXPECT_TRUE(handle.IsCompleted());
+  EXPECT_EQ(42u, value.load());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Schedule_Empty)
+{
+  JobSystem jobSystem(1);
+
+  EXPECT_THROW(jobSystem.Schedule(std::function<void()>()), std::invalid_argument);
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Wait_InvalidHandle)
+{
+  JobSystem jobSystem(1);
+
+  EXPECT_THROW(jobSystem.Wait(JobHandle()), std::invalid_argument);
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Wait_RethrowsException)
+{
+  JobSystem jobSystem(2);
+
+  JobHandle handle = jobSystem.Schedule([]() { throw std::runtime_error("failed"); });
+
+  EXPECT_THROW(jobSystem.Wait(handle), std::runtime_error);
+  EXPECT_TRUE(handle.IsCompleted());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Schedule_Many)
+{
+  JobSystem jobSystem(3);
+  std::atomic<uint32_t> counter{0};
+
+  std::vector<JobHandle> handles;
+  for (uint32_t i = 0; i < 1000; ++i)
+  {
+    handles.push_back(jobSystem.Schedule([&counter]() { ++counter; }));
+  }
+  jobSystem.WaitAll(ReadOnlySpan<JobHandle>(handles.data(), handles.size()));
+
+  EXPECT_EQ(1000u, counter.load());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Schedule_NestedWait)
+{
+  JobSystem jobSystem(1);
+  std::atomic<uint32_t> counter{0};
+
+  // With a single worker the outer job can only finish if waiting helps executing the inner jobs
+  JobHandle outer = jobSystem.Schedule(
+    [&jobSystem, &counter]()
+    {
+      std::array<JobHandle, 8> inner;
+      for (auto& rHandle : inner)
+      {
+        rHandle = jobSystem.Schedule([&counter]() { ++counter; });
+      }
+      jobSystem.WaitAll(ReadOnlySpan<JobHandle>(inner.data(), inner.size()));
+    });
+  jobSystem.Wait(outer);
+
+  EXPECT_EQ(8u, counter.load());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Schedule_Dependencies)
+{
+  JobSystem jobSystem(3);
+  std::atomic<uint32_t> counter{0};
+  std::atomic<uint32_t> counterSeenByFinal{0};
+
+  std::array<JobHandle, 16> dependencies;
+  for (auto& rHandle : dependencies)
+  {
+    rHandle = jobSystem.Schedule([&counter]() { ++counter; });
+  }
+  JobHandle final =
+    jobSystem.Schedule([&counter, &counterSeenByFinal]() { counterSeenByFinal = counter.load(); }, ReadOnlySpan<JobHandle>(dependencies.data(), dependencies.size()));
+  jobSystem.Wait(final);
+
+  EXPECT_EQ(16u, counterSeenByFinal.load());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Schedule_DependencyCompleted)
+{
+  JobSystem jobSystem(2);
+  std::atomic<uint32_t> value{0};
+
+  JobHandle first = jobSystem.Schedule([&value]() { value = 1; });
+  jobSystem.Wait(first);
+  JobHandle second = jobSystem.Schedule([&value]() { value = value.load() + 1; }, ReadOnlySpan<JobHandle>(&first, 1u));
+  jobSystem.Wait(second);
+
+  EXPECT_EQ(2u, value.load());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, ContinueWith_Chain)
+{
+  JobSystem jobSystem(2);
+  std::vector<uint32_t> order;
+
+  // The chain is executed in order, so no locking is needed for the vector
+  JobHandle handle = jobSystem.Schedule([&order]() { order.push_back(0); });
+  for (uint32_t i = 1; i < 10; ++i)
+  {
+    handle = jobSystem.ContinueWith(handle, [&order, i]() { order.push_back(i); });
+  }
+  jobSystem.Wait(handle);
+
+  ASSERT_EQ(10u, order.size());
+  for (uint32_t i = 0; i < 10; ++i)
+  {
+    EXPECT_EQ(i, order[i]);
+  }
+}
+
+
+TEST(TestSystem_Threading_JobSystem, ContinueWith_AfterException)
+{
+  JobSystem jobSystem(2);
+  std::atomic<bool> executed{false};
+
+  JobHandle failed = jobSystem.Schedule([]() { throw std::runtime_error("failed"); });
+  JobHandle continuation = jobSystem.ContinueWith(failed, [&executed]() { executed = true; });
+  jobSystem.Wait(continuation);
+
+  EXPECT_TRUE(executed.load());
+  EXPECT_THROW(jobSystem.Wait(failed), std::runtime_error);
+}
+
+
+TEST(TestSystem_Threading_JobSystem, ParallelFor)
+{
+  JobSystem jobSystem(3);
+  std::vector<uint32_t> hits(1001, 0u);
+
+  jobSystem.ParallelFor(hits.size(), 16,
+                        [&hits](const std::size_t begin, const std::size_t end)
+                        {
+                          for (std::size_t i = begin; i < end; ++i)
+                          {
+                            ++hits[i];
+                          }
+                        });
+
+  for (const uint32_t value : hits)
+  {
+    EXPECT_EQ(1u, value);
+  }
+}
+
+
+TEST(TestSystem_Threading_JobSystem, ParallelFor_Empty)
+{
+  JobSystem jobSystem(1);
+  bool called = false;
+
+  jobSystem.ParallelFor(0, 16, [&called](const std::size_t /*begin*/, const std::size_t /*end*/) { called = true; });
+
+  EXPECT_FALSE(called);
+}
+
+
+TEST(TestSystem_Threading_JobSystem, ParallelFor_ZeroGrainSize)
+{
+  JobSystem jobSystem(2);
+  std::atomic<std::size_t> total{0};
+
+  jobSystem.ParallelFor(10, 0, [&total](const std::size_t begin, const std::size_t end) { total += end - begin; });
+
+  EXPECT_EQ(10u, total.load());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, ParallelFor_Span)
+{
+  JobSystem jobSystem(2);
+  std::vector<uint32_t> values(500);
+  std::iota(values.begin(), values.end(), 0u);
+
+  jobSystem.ParallelFor(Span<uint32_t>(values.data(), values.size()), 7,
+                        [](Span<uint32_t> span)
+                        {
+                          for (auto& rValue : span)
+                          {
+                            rValue *= 2u;
+                          }
+                        });
+
+  for (uint32_t i = 0; i < values.size(); ++i)
+  {
+    EXPECT_EQ(i * 2u, values[i]);
+  }
+}
+
+
+TEST(TestSystem_Threading_JobSystem, ParallelFor_ReadOnlySpan)
+{
+  JobSystem jobSystem(2);
+  std::vector<uint32_t> values(500);
+  std::iota(values.begin(), values.end(), 0u);
+  std::atomic<uint64_t> sum{0};
+
+  jobSystem.ParallelFor(ReadOnlySpan<uint32_t>(values.data(), values.size()), 32,
+                        [&sum](ReadOnlySpan<uint32_t> span)
+                        {
+                          uint64_t localSum = 0;
+                          for (const auto value : span)
+                          {
+                            localSum += value;
+                          }
+                          sum += localSum;
+                        });
+
+  EXPECT_EQ(uint64_t(499u * 500u / 2u), sum.load());
+}
+
+
+TEST(TestSystem_Threading_JobSystem, ParallelFor_Exception)
+{
+  JobSystem jobSystem(2);
+
+  EXPECT_THROW(jobSystem.ParallelFor(100, 1,
+                                     [](const std::size_t begin, const std::size_t /*end*/)
+                                     {
+                                       if (begin == 50u)
+                                       {
+                                         throw std::runtime_error("failed");
+                                       }
+                                     }),
+               std::runtime_error);
+}
+
+
+TEST(TestSystem_Threading_JobSystem, Destruct_ExecutesQueuedJobs)
+{
+  std::atomic<uint32_t> counter{0};
+  {
+    JobSystem jobSystem(2);
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+      jobSystem.Schedule([&counter]() { ++counter; });
+    }
+  }
+  EXPECT_EQ(100u, counter.load());
+}
@@ -0,0 +1,423 @@
+#ifndef FSLBASE_COLLECTIONS_CONCURRENT_CONCURRENTBOUNDEDQUEUE_HPP
+#define FSLBASE_COLLECTIONS_CONCURRENT_CONCURRENTBOUNDEDQUEUE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/Concurrent/ConcurrentBoundedQueue_fwd.hpp>
+#include <algorithm>
+#include <limits>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace Fsl
+{
+  namespace ConcurrentBoundedQueueHelper
+  {
+    inline std::size_t CalcCapacity(const std::size_t capacity)
+    {
+      if (capacity <= 0u || capacity > (std::numeric_limits<std::size_t>::max() / 2u))
+      {
+        throw std::invalid_argument("capacity must be > 0 and <= max/2");
+      }
+      // The cell sequence scheme needs at least two cells to tell a full cell from a free one
+      std::size_t result = 2u;
+      while (result < capacity)
+      {
+        result <<= 1u;
+      }
+      return result;
+    }
+
+    inline void Spin(const uint32_t spinIndex, const uint32_t yieldAfter)
+    {
+      if (spinIndex >= yieldAfter)
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+
+  template <typename T>
+  ConcurrentBoundedQueue<T>::ConcurrentBoundedQueue(const std::size_t capacity)
+    : m_mask(ConcurrentBoundedQueueHelper::CalcCapacity(capacity) - 1u)
+  {
+    const std::size_t finalCapacity = m_mask + 1u;
+    m_cells = std::make_unique<Cell[]>(finalCapacity);
+    for (std::size_t i = 0; i < finalCapacity; ++i)
+    {
+      m_cells[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+
+  template <typename T>
+  ConcurrentBoundedQueue<T>::~ConcurrentBoundedQueue()
+  {
+    // No other thread is allowed to access the queue at this point, so every reserved cell has been committed
+    const std::size_t enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+    for (std::size_t pos = m_dequeuePos.load(std::memory_order_acquire); pos != enqueuePos; ++pos)
+    {
+      Cell& rCell = m_cells[pos & m_mask];
+      if (rCell.Sequence.load(std::memory_order_acquire) == (pos + 1u))
+      {
+        std::launder(reinterpret_cast<T*>(rCell.Storage))->~T();
+      }
+    }
+  }
+
+
+  template <typename T>
+  std::size_t ConcurrentBoundedQueue<T>::ApproximateCount() const noexcept
+  {
+    const std::size_t dequeuePos = m_dequeuePos.load(std::memory_order_relaxed);
+    const std::size_t enqueuePos = m_enqueuePos.load(std::memory_order_relaxed);
+    return enqueuePos >= dequeuePos ? std::min(enqueuePos - dequeuePos, m_mask + 1u) : 0u;
+  }
+
+
+  template <typename T>
+  void ConcurrentBoundedQueue<T>::Clear()
+  {
+    bool removed = false;
+    while (DoTryDequeue().has_value())
+    {
+      removed = true;
+    }
+    if (removed)
+    {
+      WakeProducer();
+    }
+  }
+
+
+  template <typename T>
+  void ConcurrentBoundedQueue<T>::Enqueue(const T& value)
+  {
+    if constexpr (std::is_nothrow_copy_constructible_v<T>)
+    {
+      DoEnqueue(value);
+    }
+    else
+    {
+      DoEnqueue(T(value));
+    }
+  }
+
+
+  template <typename T>
+  void ConcurrentBoundedQueue<T>::Enqueue(T&& value)
+  {
+    DoEnqueue(std::move(value));
+  }
+
+
+  template <typename T>
+  bool ConcurrentBoundedQueue<T>::TryEnqueue(const T& value)
+  {
+    bool added = false;
+    if constexpr (std::is_nothrow_copy_constructible_v<T>)
+    {
+      added = DoTryEnqueue(value);
+    }
+    else
+    {
+      added = DoTryEnqueue(T(value));
+    }
+    if (!added)
+    {
+      return false;
+    }
+    WakeConsumer();
+    return true;
+  }
+
+
+  template <typename T>
+  bool ConcurrentBoundedQueue<T>::TryEnqueue(T&& value)
+  {
+    if (!DoTryEnqueue(std::move(value)))
+    {
+      return false;
+    }
+    WakeConsumer();
+    return true;
+  }
+
+
+  template <typename T>
+  T ConcurrentBoundedQueue<T>::Dequeue()
+  {
+    std::optional<T> result = DoTryDequeue();
+    if (!result.has_value())
+    {
+      for (uint32_t i = 0; i < SpinCount && !result.has_value(); ++i)
+      {
+        ConcurrentBoundedQueueHelper::Spin(i, SpinYieldAfter);
+        result = DoTryDequeue();
+      }
+      if (!result.has_value())
+      {
+        std::unique_lock<std::mutex> lock(m_parkMutex);
+        m_parkedConsumers.fetch_add(1u);
+        // Pairs with the fence in WakeConsumer so either we see the element or the producer sees us parked
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        result = DoTryDequeue();
+        while (!result.has_value())
+        {
+          m_waitForMsgCondition.wait(lock);
+          result = DoTryDequeue();
+        }
+        m_parkedConsumers.fetch_sub(1u);
+      }
+    }
+    WakeProducer();
+    return std::move(result.value());
+  }
+
+
+  template <typename T>
+  bool ConcurrentBoundedQueue<T>::TryDequeue(T& rValue)
+  {
+    std::optional<T> result = DoTryDequeue();
+    if (!result.has_value())
+    {
+      rValue = T();
+      return false;
+    }
+    WakeProducer();
+    rValue = std::move(result.value());
+    return true;
+  }
+
+
+  template <typename T>
+  bool ConcurrentBoundedQueue<T>::TryDequeueWait(T& rValue, const std::chrono::milliseconds& duration)
+  {
+    std::optional<T> result = DoTryDequeue();
+    if (!result.has_value() && duration.count() > 0)
+    {
+      const auto deadline = std::chrono::steady_clock::now() + duration;
+      for (uint32_t i = 0; i < SpinCount && !result.has_value(); ++i)
+      {
+        ConcurrentBoundedQueueHelper::Spin(i, SpinYieldAfter);
+        result = DoTryDequeue();
+      }
+      if (!result.has_value())
+      {
+        std::unique_lock<std::mutex> lock(m_parkMutex);
+        m_parkedConsumers.fetch_add(1u);
+        // Pairs with the fence in WakeConsumer so either we see the element or the producer sees us parked
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        result = DoTryDequeue();
+        while (!result.has_value() && m_waitForMsgCondition.wait_until(lock, deadline) != std::cv_status::timeout)
+        {
+          result = DoTryDequeue();
+        }
+        if (!result.has_value())
+        {
+          result = DoTryDequeue();
+        }
+        m_parkedConsumers.fetch_sub(1u);
+      }
+    }
+
+    if (!result.has_value())
+    {
+      rValue = T();
+      return false;
+    }
+    WakeProducer();
+    rValue = std::move(result.value());
+    return true;
+  }
+
+
+  template <typename T>
+  std::size_t ConcurrentBoundedQueue<T>::Extract(Span<T> dstSpan)
+  {
+    std::size_t count = 0;
+    while (count < dstSpan.size())
+    {
+      std::optional<T> result = DoTryDequeue();
+      if (!result.has_value())
+      {
+        break;
+      }
+      dstSpan[count] = std::move(result.value());
+      ++count;
+    }
+    if (count > 0u)
+    {
+      WakeProducer();
+    }
+    return count;
+  }
+
+
+  template <typename T>
+  template <typename TValue>
+  bool ConcurrentBoundedQueue<T>::DoTryEnqueue(TValue&& value)
+  {
+    // Constructing the element must not throw once the cell is reserved, otherwise its sequence would never be published
+    static_assert(std::is_nothrow_constructible_v<T, TValue&&>, "the element construction must be nothrow");
+    Cell* pCell = nullptr;
+    std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+      pCell = &m_cells[pos & m_mask];
+      const std::size_t seq = pCell->Sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0)
+      {
+        // The cell is free, try to reserve it
+        if (m_enqueuePos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+      else if (diff < 0)
+      {
+        // The queue is full
+        return false;
+      }
+      else
+      {
+        // Another producer got the cell, retry with the latest position
+        pos = m_enqueuePos.load(std::memory_order_relaxed);
+      }
+    }
+    new (pCell->Storage) T(std::forward<TValue>(value));
+    pCell->Sequence.store(pos + 1u, std::memory_order_release);
+    return true;
+  }
+
+
+  template <typename T>
+  std::optional<T> ConcurrentBoundedQueue<T>::DoTryDequeue()
+  {
+    Cell* pCell = nullptr;
+    std::size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+      pCell = &m_cells[pos & m_mask];
+      const std::size_t seq = pCell->Sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1u);
+      if (diff == 0)
+      {
+        // The cell contains a element, try to claim it
+        if (m_dequeuePos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+      else if (diff < 0)
+      {
+        // The queue is empty
+        return {};
+      }
+      else
+      {
+        // Another consumer got the cell, retry with the latest position
+        pos = m_dequeuePos.load(std::memory_order_relaxed);
+      }
+    }
+    // Move the element straight into the result, this is nothrow so the cell is always published
+    T* pValue = std::launder(reinterpret_cast<T*>(pCell->Storage));
+    std::optional<T> result(std::in_place, std::move(*pValue));
+    pValue->~T();
+    // Mark the cell as free for the producer that wraps around to it
+    pCell->Sequence.store(pos + m_mask + 1u, std::memory_order_release);
+    return result;
+  }
+
+
+  template <typename T>
+  template <typename TValue>
+  void ConcurrentBoundedQueue<T>::DoEnqueue(TValue&& value)
+  {
+    bool added = DoTryEnqueue(std::forward<TValue>(value));
+    for (uint32_t i = 0; i < SpinCount && !added; ++i)
+    {
+      ConcurrentBoundedQueueHelper::Spin(i, SpinYieldAfter);
+      added = DoTryEnqueue(std::forward<TValue>(value));
+    }
+    if (!added)
+    {
+      std::unique_lock<std::mutex> lock(m_parkMutex);
+      m_parkedProducers.fetch_add(1u);
+      // Pairs with the fence in WakeProducer so either we see the free cell or the consumer sees us parked
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      while (!DoTryEnqueue(std::forward<TValue>(value)))
+      {
+        m_waitForSpaceCondition.wait(lock);
+      }
+      m_parkedProducers.fetch_sub(1u);
+    }
+    WakeConsumer();
+  }
+
+
+  template <typename T>
+  void ConcurrentBoundedQueue<T>::WakeConsumer()
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_parkedConsumers.load(std::memory_order_relaxed) > 0u)
+    {
+      {
+        // Ensure that the parked thread is either waiting or will see the new element
+        std::lock_guard<std::mutex> lock(m_parkMutex);
+      }
+      m_waitForMsgCondition.notify_one();
+    }
+  }
+
+
+  template <typename T>
+  void ConcurrentBoundedQueue<T>::WakeProducer()
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_parkedProducers.load(std::memory_order_relaxed) > 0u)
+    {
+      {
+        // Ensure that the parked thread is either waiting or will see the free cell
+        std::lock_guard<std::mutex> lock(m_parkMutex);
+      }
+      m_waitForSpaceCondition.notify_one();
+    }
+  }
+}
+
+#endif
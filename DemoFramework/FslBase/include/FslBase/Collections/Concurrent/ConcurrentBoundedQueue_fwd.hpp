@@ -0,0 +1,151 @@
+#ifndef FSLBASE_COLLECTIONS_CONCURRENT_CONCURRENTBOUNDEDQUEUE_FWD_HPP
+#define FSLBASE_COLLECTIONS_CONCURRENT_CONCURRENTBOUNDEDQUEUE_FWD_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/Span.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+
+namespace Fsl
+{
+  //! @brief A bounded lock free multi producer / multi consumer queue.
+  //!        The element storage is a fixed size ring buffer where each cell carries a sequence number (Dmitry Vyukov's bounded MPMC queue).
+  //!        Enqueue and dequeue are lock free, only the blocking calls will park the thread on a condition variable once spinning didn't help.
+  //! @note  The capacity is rounded up to the nearest power of two (minimum two).
+  //!        T must be nothrow move constructible and nothrow destructible, a reserved cell is always published so an exception
+  //!        can not leave it behind. Copies are made before a cell is reserved.
+  template <typename T>
+  class ConcurrentBoundedQueue
+  {
+    static_assert(std::is_nothrow_move_constructible_v<T>, "T must be nothrow move constructible");
+    static_assert(std::is_nothrow_destructible_v<T>, "T must be nothrow destructible");
+
+    // Assume a 64 byte cache line, this keeps the producer and consumer positions from false sharing
+    static constexpr std::size_t CacheLineSize = 64;
+    // The number of times we retry before we park the thread
+    static constexpr uint32_t SpinCount = 64;
+    // The number of spins we do before we start to yield
+    static constexpr uint32_t SpinYieldAfter = 16;
+
+    struct Cell
+    {
+      std::atomic<std::size_t> Sequence{0};
+      alignas(T) unsigned char Storage[sizeof(T)];
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    std::size_t m_mask;
+
+    alignas(CacheLineSize) std::atomic<std::size_t> m_enqueuePos{0};
+    alignas(CacheLineSize) std::atomic<std::size_t> m_dequeuePos{0};
+
+    alignas(CacheLineSize) std::atomic<uint32_t> m_parkedConsumers{0};
+    std::atomic<uint32_t> m_parkedProducers{0};
+    std::mutex m_parkMutex;
+    std::condition_variable m_waitForMsgCondition;
+    std::condition_variable m_waitForSpaceCondition;
+
+  public:
+    ConcurrentBoundedQueue(const ConcurrentBoundedQueue&) = delete;
+    ConcurrentBoundedQueue& operator=(const ConcurrentBoundedQueue&) = delete;
+
+    //! @brief Create a queue that can hold at least 'capacity' elements
+    //! @note  The capacity is rounded up to the nearest power of two (minimum two).
+    explicit ConcurrentBoundedQueue(const std::size_t capacity);
+    ~ConcurrentBoundedQueue();
+
+    using value_type = T;
+
+    //! @brief Get the maximum number of elements the queue can contain
+    std::size_t Capacity() const noexcept
+    {
+      return m_mask + 1u;
+    }
+
+    //! @brief Get a approximate element count.
+    //! @note  The value is a snapshot and might be outdated the moment it is returned.
+    std::size_t ApproximateCount() const noexcept;
+
+    //! @brief Clear all elements from the queue
+    //! @note  Elements added concurrently by producers might or might not be removed.
+    void Clear();
+
+    //! @brief Add element to queue, blocking while the queue is full
+    void Enqueue(const T& value);
+
+    //! @brief Add element to queue, blocking while the queue is full
+    void Enqueue(T&& value);
+
+    //! @brief Tries to add a element to the queue
+    //! @return true on success, false if the queue was full.
+    bool TryEnqueue(const T& value);
+
+    //! @brief Tries to add a element to the queue
+    //! @return true on success, false if the queue was full (in which case value is left untouched).
+    bool TryEnqueue(T&& value);
+
+    //! @brief Remove element form queue, blocking until one is available
+    T Dequeue();
+
+    //! @brief Tries to remove and return the element at the beginning of the concurrent queue.
+    //! @return true on success, false if unsuccessful. When false rValue will be set to T().
+    bool TryDequeue(T& rValue);
+
+    //! @brief Tries to remove and return the element at the beginning of the concurrent queue, waiting at most 'duration' for one to arrive.
+    //! @return true on success, false if unsuccessful. When false rValue will be set to T().
+    bool TryDequeueWait(T& rValue, const std::chrono::milliseconds& duration);
+
+    //! @brief Extract all pending messages that can fit into the supplied span
+    //! @return the number of entries written to the span.
+    std::size_t Extract(Span<T> dstSpan);
+
+  private:
+    template <typename TValue>
+    bool DoTryEnqueue(TValue&& value);
+    std::optional<T> DoTryDequeue();
+
+    template <typename TValue>
+    void DoEnqueue(TValue&& value);
+
+    void WakeConsumer();
+    void WakeProducer();
+  };
+}
+
+#endif
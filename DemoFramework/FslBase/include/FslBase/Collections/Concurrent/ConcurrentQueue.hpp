@@ -32,6 +32,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Collections/Concurrent/ConcurrentQueue_fwd.hpp>
+#include <algorithm>
 #include <utility>
 
 namespace Fsl
@@ -64,6 +65,22 @@ namespace Fsl
   }
 
 
+  template <typename T>
+  void ConcurrentQueue<T>::Enqueue(T&& value)
+  {
+    bool wasEmpty = false;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      wasEmpty = m_queue.empty();
+      m_queue.push(std::move(value));
+    }
+    if (wasEmpty)
+    {
+      UnsafeWake();
+    }
+  }
+
+
   template <typename T>
   T ConcurrentQueue<T>::Dequeue()
   {
@@ -75,7 +92,7 @@ namespace Fsl
       m_waitForMsgCondition.wait(lock);
     }
 
-    const T result = m_queue.front();
+    T result = std::move(m_queue.front());
     m_queue.pop();
     return result;
   }
@@ -91,7 +108,7 @@ namespace Fsl
       rValue = T();
       return false;
     }
-    rValue = m_queue.front();
+    rValue = std::move(m_queue.front());
     m_queue.pop();
     return true;
   }
@@ -117,10 +134,8 @@ namespace Fsl
       return false;
     }
 
-
-    const T result = m_queue.front();
+    rValue = std::move(m_queue.front());
     m_queue.pop();
-    rValue = result;
     return true;
   }
 
@@ -155,7 +170,7 @@ namespace Fsl
 
     while (!m_queue.empty())
     {
-      rDstQueue.push(m_queue.front());
+      rDstQueue.push(std::move(m_queue.front()));
       m_queue.pop();
     }
   }
@@ -169,7 +184,7 @@ namespace Fsl
     const std::size_t count = std::min(m_queue.size(), dstSpan.size());
     for (std::size_t i = 0; i < count; ++i)
     {
-      dstSpan[i] = m_queue.front();
+      dstSpan[i] = std::move(m_queue.front());
       m_queue.pop();
     }
     return count;
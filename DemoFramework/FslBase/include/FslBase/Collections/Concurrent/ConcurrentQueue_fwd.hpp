@@ -59,6 +59,9 @@ namespace Fsl
     //! @brief Add element to queue
     void Enqueue(const T& value);
 
+    //! @brief Add element to queue
+    void Enqueue(T&& value);
+
     //! @brief Remove element form queue
     T Dequeue();
 
@@ -0,0 +1,86 @@
+#ifndef FSLBASE_IO_DIRECTORYWATCHER_HPP
+#define FSLBASE_IO_DIRECTORYWATCHER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/IO/PathDeque.hpp>
+#include <FslBase/IO/SearchOptions.hpp>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace Fsl::IO
+{
+  class PlatformDirectoryMonitorToken;
+
+  //! @brief Monitors all files in a directory using the OS change notifications and reports exactly which files changed.
+  //! @note  Use IsSupported to check if the platform supports it, if not fall back to the polling based PathWatcher.
+  //! @note Experimental class, might change.
+  class DirectoryWatcher
+  {
+    std::shared_ptr<PlatformDirectoryMonitorToken> m_token;
+    std::chrono::milliseconds m_debounceTime;
+    PathDeque m_scratchpad;
+
+  public:
+    //! The default time we wait for a burst of changes to settle before reporting them
+    static constexpr std::chrono::milliseconds DefaultDebounceTime = std::chrono::milliseconds(100);
+    //! Changes are always reported after this multiple of the debounce time even if the burst hasn't settled.
+    static constexpr int32_t MaxDebounceFactor = 10;
+
+    DirectoryWatcher(const DirectoryWatcher&) = delete;
+    DirectoryWatcher& operator=(const DirectoryWatcher&) = delete;
+
+    //! @brief Start monitoring the directory.
+    //! @throws std::invalid_argument if the path isn't absolute.
+    //! @throws DirectoryNotFoundException if the directory doesn't exist.
+    //! @throws NotSupportedException if the platform doesn't support it or the OS refused to create the watches.
+    explicit DirectoryWatcher(const IO::Path& fullPath, const SearchOptions searchOptions = SearchOptions::AllDirectories,
+                              const std::chrono::milliseconds debounceTime = DefaultDebounceTime);
+    ~DirectoryWatcher();
+
+    //! @brief Check if a DirectoryWatcher can be created for the given directory
+    //! @throws std::invalid_argument if the path isn't absolute.
+    //! @throws DirectoryNotFoundException if the directory doesn't exist.
+    static bool IsSupported(const IO::Path& fullPath, const SearchOptions searchOptions = SearchOptions::AllDirectories);
+
+    //! @brief Wait at most 'timeout' for a change, when a change is detected we keep collecting changes until no new ones have been
+    //!        seen for the debounce time. This prevents a burst of writes to be reported as multiple changes.
+    //! @param rChangedFiles receives the sorted full paths of the files that changed (each file is only reported once).
+    //!        If the OS dropped notifications it will contain the monitored directory itself, meaning 'anything might have changed'.
+    //! @return true if any changes were detected
+    bool TryWaitForChanges(std::vector<IO::Path>& rChangedFiles, const std::chrono::milliseconds timeout);
+  };
+}
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef FSLBASE_IO_MEMORYMAPPEDFILE_HPP
+#define FSLBASE_IO_MEMORYMAPPEDFILE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <memory>
+#include <vector>
+
+namespace Fsl::IO
+{
+  class PlatformMemoryMappedFile;
+
+  //! @brief Provides read only access to the entire content of a file.
+  //!        The file is memory mapped where the platform supports it, otherwise the content is read into memory.
+  class MemoryMappedFile
+  {
+    std::shared_ptr<PlatformMemoryMappedFile> m_mapping;
+    std::vector<uint8_t> m_fallbackContent;
+    ReadOnlySpan<uint8_t> m_content;
+
+  public:
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+    MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+    MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+    //! @brief Create a empty file
+    MemoryMappedFile() noexcept;
+
+    //! @brief Open the given file for read only access
+    //! @param forceRead if true the file content is always read into memory instead of being mapped.
+    //! @throws IOException if the file isn't found or something goes wrong reading it.
+    explicit MemoryMappedFile(const Path& path, const bool forceRead = false);
+    ~MemoryMappedFile() noexcept;
+
+    //! @brief Release the file content, this invalidates all spans acquired from this object
+    void Reset() noexcept;
+
+    //! @brief Check if the content is memory mapped (false if it was read into memory)
+    bool IsMapped() const noexcept
+    {
+      return m_mapping != nullptr;
+    }
+
+    std::size_t size() const noexcept
+    {
+      return m_content.size();
+    }
+
+    bool empty() const noexcept
+    {
+      return m_content.empty();
+    }
+
+    //! @brief Get the file content, the span is valid until the object is destroyed or Reset
+    ReadOnlySpan<uint8_t> AsReadOnlySpan() const noexcept
+    {
+      return m_content;
+    }
+  };
+}
+
+#endif
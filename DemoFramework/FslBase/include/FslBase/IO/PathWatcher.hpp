@@ -34,12 +34,14 @@
 #include <FslBase/IO/Path.hpp>
 #include <list>
 #include <memory>
+#include <vector>
 
 namespace Fsl::IO
 {
   class PathWatcherInternalRecord;
 
   //! @note Experimental class, might change it is probably also quite slow compared to proper OS change notifications.
+  //!       Prefer the DirectoryWatcher where it is supported.
   class PathWatcher
   {
   public:
@@ -66,6 +68,11 @@ namespace Fsl::IO
     //! @brief Perform a check
     //! @return true if something was changed.
     bool Check();
+
+    //! @brief Perform a check of all watched paths
+    //! @param rChangedPaths receives the full path of every watched path that changed.
+    //! @return true if something was changed.
+    bool Check(std::vector<IO::Path>& rChangedPaths);
   };
 }
 
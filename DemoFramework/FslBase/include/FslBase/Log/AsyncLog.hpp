@@ -0,0 +1,79 @@
+#ifndef FSLBASE_LOG_ASYNCLOG_HPP
+#define FSLBASE_LOG_ASYNCLOG_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/AsyncLogConfig.hpp>
+#include <FslBase/Log/AsyncLogStats.hpp>
+#include <memory>
+
+namespace Fsl
+{
+  class IAsyncLogOutput;
+}
+
+namespace Fsl::AsyncLog
+{
+  //! @brief Route all Logger::WriteLine calls through the async sink.
+  //!        Each logging thread copies its formatted line into its own lock free ring buffer and a background thread writes the lines to the
+  //!        output in batches, so the calling thread never blocks on console I/O.
+  //!        Every line is stamped with a global sequence number when it is added to a thread buffer and the background thread merges the
+  //!        buffers by it, so lines from different threads are written in the order they were added to the buffers.
+  //! @note  Lines longer than the thread buffer are written on the calling thread after the pending lines have been written.
+  //! @throws NotSupportedException if the platform does not support the async sink.
+  //! @throws UsageErrorException if the sink is already enabled.
+  void Enable(const AsyncLogConfig& config);
+
+  //! @brief Same as Enable(config) but the lines are written to the supplied output instead of the console.
+  //! @param output the output to write to (if null the console is used).
+  void Enable(const AsyncLogConfig& config, std::shared_ptr<IAsyncLogOutput> output);
+
+  //! @brief Write all pending lines, stop the background thread and return to synchronous logging.
+  void Disable() noexcept;
+
+  //! @brief Check if the async sink is enabled
+  bool IsEnabled() noexcept;
+
+  //! @brief Check if the async sink is supported on this platform
+  bool IsSupported() noexcept;
+
+  //! @brief Write all pending lines on the calling thread before returning.
+  void Flush() noexcept;
+
+  //! @brief Ask the background writer to flush as soon as possible.
+  //! @note  This only touches a lock free atomic so it is safe to call from a signal handler.
+  void RequestFlush() noexcept;
+
+  //! @brief Get the current sink statistics
+  AsyncLogStats GetStats() noexcept;
+}
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef FSLBASE_LOG_ASYNCLOGCONFIG_HPP
+#define FSLBASE_LOG_ASYNCLOGCONFIG_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/AsyncLogOverflowPolicy.hpp>
+#include <chrono>
+#include <cstdint>
+
+namespace Fsl
+{
+  struct AsyncLogConfig
+  {
+    static constexpr uint32_t DefaultThreadBufferCapacity = 64 * 1024;
+    static constexpr std::chrono::milliseconds DefaultFlushInterval{10};
+
+    AsyncLogOverflowPolicy OverflowPolicy{AsyncLogOverflowPolicy::Block};
+    //! The size in bytes of the ring buffer allocated for each thread that logs (rounded up to a power of two)
+    uint32_t ThreadBufferCapacity{DefaultThreadBufferCapacity};
+    //! The maximum time a line can stay in the buffer before the background writer picks it up
+    std::chrono::milliseconds FlushInterval{DefaultFlushInterval};
+
+    constexpr AsyncLogConfig() noexcept = default;
+
+    constexpr explicit AsyncLogConfig(const AsyncLogOverflowPolicy overflowPolicy) noexcept
+      : OverflowPolicy(overflowPolicy)
+    {
+    }
+
+    constexpr AsyncLogConfig(const AsyncLogOverflowPolicy overflowPolicy, const uint32_t threadBufferCapacity,
+                             const std::chrono::milliseconds flushInterval) noexcept
+      : OverflowPolicy(overflowPolicy)
+      , ThreadBufferCapacity(threadBufferCapacity)
+      , FlushInterval(flushInterval)
+    {
+    }
+  };
+}
+
+#endif
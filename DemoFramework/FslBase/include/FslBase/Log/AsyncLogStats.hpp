@@ -0,0 +1,62 @@
+#ifndef FSLBASE_LOG_ASYNCLOGSTATS_HPP
+#define FSLBASE_LOG_ASYNCLOGSTATS_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <cstdint>
+
+namespace Fsl
+{
+  struct AsyncLogStats
+  {
+    //! The number of lines written to the output by the async sink
+    uint64_t LinesWritten{0};
+    //! The number of lines that was discarded because a thread buffer was full (AsyncLogOverflowPolicy::Drop)
+    uint64_t LinesDropped{0};
+    //! The number of lines currently waiting to be written
+    uint64_t BacklogDepth{0};
+    //! The highest backlog depth observed by the background writer
+    uint64_t MaxBacklogDepth{0};
+
+    constexpr AsyncLogStats() noexcept = default;
+
+    constexpr AsyncLogStats(const uint64_t linesWritten, const uint64_t linesDropped, const uint64_t backlogDepth,
+                            const uint64_t maxBacklogDepth) noexcept
+      : LinesWritten(linesWritten)
+      , LinesDropped(linesDropped)
+      , BacklogDepth(backlogDepth)
+      , MaxBacklogDepth(maxBacklogDepth)
+    {
+    }
+  };
+}
+
+#endif
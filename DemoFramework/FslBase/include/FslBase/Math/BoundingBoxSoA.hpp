@@ -0,0 +1,161 @@
+#ifndef FSLBASE_MATH_BOUNDINGBOXSOA_HPP
+#define FSLBASE_MATH_BOUNDINGBOXSOA_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/BoundingBox.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <cassert>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief A structure of arrays storage of BoundingBox'es, which allows them to be processed efficiently in bulk.
+  class BoundingBoxSoA
+  {
+    std::vector<float> m_minX;
+    std::vector<float> m_minY;
+    std::vector<float> m_minZ;
+    std::vector<float> m_maxX;
+    std::vector<float> m_maxY;
+    std::vector<float> m_maxZ;
+
+  public:
+    BoundingBoxSoA() = default;
+
+    explicit BoundingBoxSoA(const ReadOnlySpan<BoundingBox> boxes)
+    {
+      Assign(boxes);
+    }
+
+    uint32_t Count() const noexcept
+    {
+      return static_cast<uint32_t>(m_minX.size());
+    }
+
+    bool Empty() const noexcept
+    {
+      return m_minX.empty();
+    }
+
+    void Clear() noexcept
+    {
+      m_minX.clear();
+      m_minY.clear();
+      m_minZ.clear();
+      m_maxX.clear();
+      m_maxY.clear();
+      m_maxZ.clear();
+    }
+
+    void Reserve(const uint32_t capacity)
+    {
+      m_minX.reserve(capacity);
+      m_minY.reserve(capacity);
+      m_minZ.reserve(capacity);
+      m_maxX.reserve(capacity);
+      m_maxY.reserve(capacity);
+      m_maxZ.reserve(capacity);
+    }
+
+    void Assign(const ReadOnlySpan<BoundingBox> boxes)
+    {
+      Clear();
+      Reserve(NumericCast<uint32_t>(boxes.size()));
+      for (const BoundingBox& box : boxes)
+      {
+        Add(box);
+      }
+    }
+
+    void Add(const BoundingBox& box)
+    {
+      m_minX.push_back(box.Min.X);
+      m_minY.push_back(box.Min.Y);
+      m_minZ.push_back(box.Min.Z);
+      m_maxX.push_back(box.Max.X);
+      m_maxY.push_back(box.Max.Y);
+      m_maxZ.push_back(box.Max.Z);
+    }
+
+    void Set(const uint32_t index, const BoundingBox& box)
+    {
+      assert(index < Count());
+      m_minX[index] = box.Min.X;
+      m_minY[index] = box.Min.Y;
+      m_minZ[index] = box.Min.Z;
+      m_maxX[index] = box.Max.X;
+      m_maxY[index] = box.Max.Y;
+      m_maxZ[index] = box.Max.Z;
+    }
+
+    BoundingBox Get(const uint32_t index) const
+    {
+      assert(index < Count());
+      return {Vector3(m_minX[index], m_minY[index], m_minZ[index]), Vector3(m_maxX[index], m_maxY[index], m_maxZ[index])};
+    }
+
+    ReadOnlySpan<float> MinX() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_minX);
+    }
+
+    ReadOnlySpan<float> MinY() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_minY);
+    }
+
+    ReadOnlySpan<float> MinZ() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_minZ);
+    }
+
+    ReadOnlySpan<float> MaxX() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_maxX);
+    }
+
+    ReadOnlySpan<float> MaxY() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_maxY);
+    }
+
+    ReadOnlySpan<float> MaxZ() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_maxZ);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef FSLBASE_MATH_BOUNDINGFRUSTUMBATCH_HPP
+#define FSLBASE_MATH_BOUNDINGFRUSTUMBATCH_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+
+namespace Fsl
+{
+  class BoundingBoxSoA;
+  class BoundingFrustum;
+  class BoundingSphereSoA;
+  class JobSystem;
+
+  //! @brief The instruction set used by the bulk frustum culling kernels
+  enum class BoundingFrustumBatchKernelSet
+  {
+    Scalar,
+    SSE41,
+    AVX2,
+    Neon
+  };
+
+  //! @brief Bulk versions of BoundingFrustum::Intersects that test a structure of arrays of volumes against the frustum.
+  //!        The results are identical to calling BoundingFrustum::Intersects for each volume.
+  //!
+  //! The visibility mask stores the result of volume 'i' in bit (i % 32) of entry (i / 32), unused bits of the last entry are cleared.
+  namespace BoundingFrustumBatch
+  {
+    //! @brief Get the number of uint32_t entries needed to store the visibility mask of 'count' volumes
+    constexpr uint32_t CalcVisibilityMaskLength(const uint32_t count) noexcept
+    {
+      return (count / 32u) + ((count % 32u) != 0u ? 1u : 0u);
+    }
+
+    //! @brief Check if the kernel set is supported by the current CPU
+    bool IsSupported(const BoundingFrustumBatchKernelSet kernelSet) noexcept;
+
+    //! @brief Get the fastest kernel set supported by the current CPU
+    BoundingFrustumBatchKernelSet GetBestKernelSet() noexcept;
+
+    //! @brief Calculate the visibility mask of the boxes.
+    //! @param dstVisibilityMask must be able to hold at least CalcVisibilityMaskLength(boxes.Count()) entries.
+    void CalcVisibilityMask(const BoundingFrustum& frustum, const BoundingBoxSoA& boxes, Span<uint32_t> dstVisibilityMask);
+
+    //! @brief Calculate the visibility mask of the spheres.
+    //! @param dstVisibilityMask must be able to hold at least CalcVisibilityMaskLength(spheres.Count()) entries.
+    void CalcVisibilityMask(const BoundingFrustum& frustum, const BoundingSphereSoA& spheres, Span<uint32_t> dstVisibilityMask);
+
+    //! @brief Calculate the visibility mask using the given kernel set
+    //! @throws NotSupportedException if the kernel set is unsupported by the current CPU
+    void CalcVisibilityMask(const BoundingFrustumBatchKernelSet kernelSet, const BoundingFrustum& frustum, const BoundingBoxSoA& boxes,
+                            Span<uint32_t> dstVisibilityMask);
+
+    //! @brief Calculate the visibility mask using the given kernel set
+    //! @throws NotSupportedException if the kernel set is unsupported by the current CPU
+    void CalcVisibilityMask(const BoundingFrustumBatchKernelSet kernelSet, const BoundingFrustum& frustum, const BoundingSphereSoA& spheres,
+                            Span<uint32_t> dstVisibilityMask);
+
+    //! @brief Calculate the visibility mask by splitting large inputs across the job system (small inputs are processed on the calling thread).
+    void CalcVisibilityMask(JobSystem& jobSystem, const BoundingFrustum& frustum, const BoundingBoxSoA& boxes, Span<uint32_t> dstVisibilityMask);
+
+    //! @brief Calculate the visibility mask by splitting large inputs across the job system (small inputs are processed on the calling thread).
+    void CalcVisibilityMask(JobSystem& jobSystem, const BoundingFrustum& frustum, const BoundingSphereSoA& spheres,
+                            Span<uint32_t> dstVisibilityMask);
+
+    //! @brief Write the indices of the visible boxes.
+    //! @param dstIndices must be able to hold at least boxes.Count() entries.
+    //! @return the number of visible boxes written to dstIndices.
+    uint32_t CalcVisibleIndices(const BoundingFrustum& frustum, const BoundingBoxSoA& boxes, Span<uint32_t> dstIndices);
+
+    //! @brief Write the indices of the visible spheres.
+    //! @param dstIndices must be able to hold at least spheres.Count() entries.
+    //! @return the number of visible spheres written to dstIndices.
+    uint32_t CalcVisibleIndices(const BoundingFrustum& frustum, const BoundingSphereSoA& spheres, Span<uint32_t> dstIndices);
+
+    //! @brief Convert a visibility mask to a compacted list of the visible indices.
+    //! @param count the number of volumes described by the mask.
+    //! @param dstIndices must be able to hold at least 'count' entries.
+    //! @return the number of indices written to dstIndices.
+    uint32_t CompactVisibilityMask(const ReadOnlySpan<uint32_t> visibilityMask, const uint32_t count, Span<uint32_t> dstIndices);
+  }
+}
+
+#endif
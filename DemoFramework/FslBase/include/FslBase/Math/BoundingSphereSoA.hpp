@@ -0,0 +1,141 @@
+#ifndef FSLBASE_MATH_BOUNDINGSPHERESOA_HPP
+#define FSLBASE_MATH_BOUNDINGSPHERESOA_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/BoundingSphere.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <cassert>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief A structure of arrays storage of BoundingSphere's, which allows them to be processed efficiently in bulk.
+  class BoundingSphereSoA
+  {
+    std::vector<float> m_centerX;
+    std::vector<float> m_centerY;
+    std::vector<float> m_centerZ;
+    std::vector<float> m_radius;
+
+  public:
+    BoundingSphereSoA() = default;
+
+    explicit BoundingSphereSoA(const ReadOnlySpan<BoundingSphere> spheres)
+    {
+      Assign(spheres);
+    }
+
+    uint32_t Count() const noexcept
+    {
+      return static_cast<uint32_t>(m_centerX.size());
+    }
+
+    bool Empty() const noexcept
+    {
+      return m_centerX.empty();
+    }
+
+    void Clear() noexcept
+    {
+      m_centerX.clear();
+      m_centerY.clear();
+      m_centerZ.clear();
+      m_radius.clear();
+    }
+
+    void Reserve(const uint32_t capacity)
+    {
+      m_centerX.reserve(capacity);
+      m_centerY.reserve(capacity);
+      m_centerZ.reserve(capacity);
+      m_radius.reserve(capacity);
+    }
+
+    void Assign(const ReadOnlySpan<BoundingSphere> spheres)
+    {
+      Clear();
+      Reserve(NumericCast<uint32_t>(spheres.size()));
+      for (const BoundingSphere& sphere : spheres)
+      {
+        Add(sphere);
+      }
+    }
+
+    void Add(const BoundingSphere& sphere)
+    {
+      m_centerX.push_back(sphere.Center.X);
+      m_centerY.push_back(sphere.Center.Y);
+      m_centerZ.push_back(sphere.Center.Z);
+      m_radius.push_back(sphere.Radius);
+    }
+
+    void Set(const uint32_t index, const BoundingSphere& sphere)
+    {
+      assert(index < Count());
+      m_centerX[index] = sphere.Center.X;
+      m_centerY[index] = sphere.Center.Y;
+      m_centerZ[index] = sphere.Center.Z;
+      m_radius[index] = sphere.Radius;
+    }
+
+    BoundingSphere Get(const uint32_t index) const
+    {
+      assert(index < Count());
+      return {Vector3(m_centerX[index], m_centerY[index], m_centerZ[index]), m_radius[index]};
+    }
+
+    ReadOnlySpan<float> CenterX() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_centerX);
+    }
+
+    ReadOnlySpan<float> CenterY() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_centerY);
+    }
+
+    ReadOnlySpan<float> CenterZ() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_centerZ);
+    }
+
+    ReadOnlySpan<float> Radius() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_radius);
+    }
+  };
+}
+
+#endif
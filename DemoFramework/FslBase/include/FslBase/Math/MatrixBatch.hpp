@@ -0,0 +1,104 @@
+#ifndef FSLBASE_MATH_MATRIXBATCH_HPP
+#define FSLBASE_MATH_MATRIXBATCH_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Matrix.hpp>
+#include <FslBase/Math/Vector3.hpp>
+#include <FslBase/Math/Vector4.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+
+namespace Fsl
+{
+  //! @brief The instruction set used by the batch matrix kernels
+  enum class MatrixBatchKernelSet
+  {
+    Scalar,
+    SSE41,
+    Neon
+  };
+
+  //! @brief Batch versions of the Matrix and Vector transform operations.
+  //!        Transform, TransformNormal, Multiply and Transpose produce the same results as calling the Vector3, Vector4 and Matrix methods for
+  //!        each entry (the SIMD kernels use the same operation order and no FMA).
+  //!        Invert is calculated in single precision by the SIMD kernels, so it can differ slightly from Matrix::Invert which uses double precision.
+  //!
+  //! The dst span must be able to hold the result of every src entry. The dst span can be the src span (in place), but partially overlapping
+  //! spans are not supported.
+  namespace MatrixBatch
+  {
+    //! @brief Check if the kernel set is supported by the current CPU
+    bool IsSupported(const MatrixBatchKernelSet kernelSet) noexcept;
+
+    //! @brief Get the fastest kernel set supported by the current CPU
+    MatrixBatchKernelSet GetBestKernelSet() noexcept;
+
+    //! @brief dst[i] = Vector3::Transform(src[i], matrix)
+    void Transform(const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector3> dst);
+
+    //! @brief dst[i] = Vector3::TransformNormal(src[i], matrix)
+    void TransformNormal(const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector3> dst);
+
+    //! @brief dst[i] = Vector4::Transform(src[i], matrix)
+    void Transform(const ReadOnlySpan<Vector4> src, const Matrix& matrix, Span<Vector4> dst);
+
+    //! @brief dst[i] = Matrix::Multiply(lhs[i], rhs)
+    void Multiply(const ReadOnlySpan<Matrix> lhs, const Matrix& rhs, Span<Matrix> dst);
+
+    //! @brief dst[i] = Matrix::Multiply(lhs, rhs[i])
+    void Multiply(const Matrix& lhs, const ReadOnlySpan<Matrix> rhs, Span<Matrix> dst);
+
+    //! @brief dst[i] = Matrix::Multiply(lhs[i], rhs[i])
+    //! @note lhs and rhs must be of the same size
+    void Multiply(const ReadOnlySpan<Matrix> lhs, const ReadOnlySpan<Matrix> rhs, Span<Matrix> dst);
+
+    //! @brief dst[i] = Matrix::Transpose(src[i])
+    void Transpose(const ReadOnlySpan<Matrix> src, Span<Matrix> dst);
+
+    //! @brief dst[i] = Matrix::Invert(src[i])
+    void Invert(const ReadOnlySpan<Matrix> src, Span<Matrix> dst);
+
+    // The same operations using the given kernel set, they throw a NotSupportedException if the kernel set is unsupported by the current CPU.
+
+    void Transform(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector3> dst);
+    void TransformNormal(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector3> dst);
+    void Transform(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Vector4> src, const Matrix& matrix, Span<Vector4> dst);
+    void Multiply(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Matrix> lhs, const Matrix& rhs, Span<Matrix> dst);
+    void Multiply(const MatrixBatchKernelSet kernelSet, const Matrix& lhs, const ReadOnlySpan<Matrix> rhs, Span<Matrix> dst);
+    void Multiply(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Matrix> lhs, const ReadOnlySpan<Matrix> rhs, Span<Matrix> dst);
+    void Transpose(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Matrix> src, Span<Matrix> dst);
+    void Invert(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Matrix> src, Span<Matrix> dst);
+  }
+}
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef FSLBASE_SYSTEM_CPUFEATURES_HPP
+#define FSLBASE_SYSTEM_CPUFEATURES_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+// Compile time detection of the CPU architecture we are building for
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || (defined(_M_IX86) && !defined(_M_ARM64EC))
+#define FSL_CPU_X86 1
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define FSL_CPU_ARM64 1
+#endif
+
+// Allow individual functions to be compiled for a instruction set extension that is only used after a runtime check.
+// MSVC allows all intrinsics to be used without any special compiler flags.
+#if defined(FSL_CPU_X86) && (defined(__GNUC__) || defined(__clang__))
+#define FSL_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define FSL_TARGET_AVX2 __attribute__((target("avx2")))
+#define FSL_TARGET_F16C __attribute__((target("avx,f16c")))
+#else
+#define FSL_TARGET_SSE41
+#define FSL_TARGET_AVX2
+#define FSL_TARGET_F16C
+#endif
+
+namespace Fsl
+{
+  //! @brief Runtime detection of the instruction set extensions supported by the CPU (and the OS).
+  //!        The detection is done once and cached.
+  class CpuFeatures
+  {
+  public:
+    static bool HasSSE41() noexcept;
+    static bool HasAVX2() noexcept;
+    //! @brief Half precision float conversion instructions
+    static bool HasF16C() noexcept;
+    //! @brief Advanced SIMD (this is always available on ARM64)
+    static bool HasNeon() noexcept;
+  };
+}
+
+#endif
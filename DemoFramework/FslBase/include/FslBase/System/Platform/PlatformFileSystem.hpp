@@ -35,11 +35,15 @@
 #include <FslBase/IO/FileAttributes.hpp>
 #include <FslBase/IO/Path.hpp>
 #include <FslBase/IO/SearchOptions.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <chrono>
 #include <memory>
 
 namespace Fsl::IO
 {
   class PathDeque;
+  class PlatformDirectoryMonitorToken;
+  class PlatformMemoryMappedFile;
   class PlatformPathMonitorToken;
 
   //! @note Be very careful with what is used here as its the bottom layer.
@@ -63,6 +67,26 @@ namespace Fsl::IO
     //! @note Experimental interface, might change.
     static bool CheckPathForChanges(const std::shared_ptr<PlatformPathMonitorToken>& token);
 
+    //! @brief Create a platform specific token that receives change notifications for the files in the given directory
+    //! @return return the platform specific token or null if not supported (or if the OS refused to create the required watches)
+    //! @note Experimental interface, might change.
+    static std::shared_ptr<PlatformDirectoryMonitorToken> CreateDirectoryMonitorToken(const Path& fullPath, const SearchOptions searchOptions);
+
+    //! @brief Wait at most 'timeout' for change notifications and append the full path of each changed file to rChangedFiles.
+    //! @return true if changes were detected, false if not
+    //! @note If the OS dropped notifications the watched directory itself is appended, which means 'anything might have changed'.
+    //!       The same file can be appended multiple times.
+    //! @note Experimental interface, might change.
+    static bool WaitForDirectoryChanges(const std::shared_ptr<PlatformDirectoryMonitorToken>& token, PathDeque& rChangedFiles,
+                                        const std::chrono::milliseconds timeout);
+
+    //! @brief Map the entire file into memory for read only access.
+    //! @return return the platform specific mapping or null if memory mapping is not supported (the caller should fall back to reading the file)
+    //! @throws IOException if the file could not be opened or mapped
+    static std::shared_ptr<PlatformMemoryMappedFile> TryMapFile(const Path& path);
+
+    //! @brief Get the content of a mapping created by TryMapFile. The content stays valid for as long as the mapping is alive.
+    static ReadOnlySpan<uint8_t> GetMappedContent(const std::shared_ptr<PlatformMemoryMappedFile>& mapping);
 
     //! @brief Get the files under the path directory
     static void GetFiles(PathDeque& rResult, const Path& path, const SearchOptions searchOptions);
@@ -0,0 +1,79 @@
+#ifndef FSLBASE_SYSTEM_THREADING_JOBHANDLE_HPP
+#define FSLBASE_SYSTEM_THREADING_JOBHANDLE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <memory>
+#include <utility>
+
+namespace Fsl
+{
+  class JobSystem;
+  class JobRecord;
+
+  //! @brief A reference to a job scheduled on a JobSystem.
+  //!        The handle can be used to wait for the job or to schedule work that depends on it.
+  class JobHandle
+  {
+    friend class JobSystem;
+
+    std::shared_ptr<JobRecord> m_record;
+
+    explicit JobHandle(std::shared_ptr<JobRecord> record) noexcept
+      : m_record(std::move(record))
+    {
+    }
+
+  public:
+    JobHandle() noexcept = default;
+
+    //! @brief Check if the handle refers to a job
+    bool IsValid() const noexcept
+    {
+      return m_record != nullptr;
+    }
+
+    //! @brief Check if the job has finished executing (a invalid handle is never completed)
+    bool IsCompleted() const noexcept;
+
+    bool operator==(const JobHandle& rhs) const noexcept
+    {
+      return m_record == rhs.m_record;
+    }
+
+    bool operator!=(const JobHandle& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
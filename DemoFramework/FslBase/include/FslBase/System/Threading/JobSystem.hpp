@@ -0,0 +1,140 @@
+#ifndef FSLBASE_SYSTEM_THREADING_JOBSYSTEM_HPP
+#define FSLBASE_SYSTEM_THREADING_JOBSYSTEM_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <FslBase/System/Threading/JobHandle.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief A work stealing job system.
+  //!        Every worker thread owns a queue, jobs scheduled from a worker are pushed to its own queue (and executed LIFO) while idle workers
+  //!        steal from the front of the other queues. Jobs scheduled from other threads are placed in a shared queue.
+  //!        A thread that waits for a job helps executing the pending jobs so it is safe to wait from inside a job.
+  //! @note  All methods are thread safe.
+  class JobSystem
+  {
+    struct WorkerQueue;
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+    std::vector<std::thread> m_threads;
+    std::mutex m_sleepLock;
+    std::condition_variable m_wakeCondition;
+    //! The number of jobs in the queues, only ever incremented while m_sleepLock is held to prevent lost wakeups
+    std::atomic<std::size_t> m_queuedJobCount{0};
+    //! Guarded by m_sleepLock
+    bool m_stop{false};
+
+  public:
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    //! @brief Create a job system with the default number of worker threads
+    JobSystem();
+
+    //! @brief Create a job system
+    //! @param workerThreadCount the number of worker threads to create (at least one worker thread is always created).
+    explicit JobSystem(const uint32_t workerThreadCount);
+
+    //! @brief Waits for all queued jobs to be executed before shutting down the worker threads.
+    //! @note  jobs with dependencies that never complete are discarded.
+    ~JobSystem() noexcept;
+
+    //! @brief Get the default number of worker threads (one less than the hardware concurrency, but at least one)
+    static uint32_t GetDefaultWorkerThreadCount() noexcept;
+
+    uint32_t GetWorkerThreadCount() const noexcept
+    {
+      return static_cast<uint32_t>(m_threads.size());
+    }
+
+    //! @brief Schedule a job for execution
+    JobHandle Schedule(std::function<void()> job);
+
+    //! @brief Schedule a job that will be executed once all the dependencies have completed, this can be used to build task graphs.
+    //! @note  A job is executed even if one of its dependencies failed with a exception.
+    JobHandle Schedule(std::function<void()> job, const ReadOnlySpan<JobHandle> dependencies);
+
+    //! @brief Schedule a continuation that will be executed once the given job has completed
+    JobHandle ContinueWith(const JobHandle& job, std::function<void()> continuation);
+
+    //! @brief Wait for the job to complete, while waiting the calling thread helps executing pending jobs.
+    //!        If the job failed with a exception the exception is rethrown here.
+    void Wait(const JobHandle& job);
+
+    //! @brief Wait for all the jobs to complete (see Wait).
+    //!        If multiple jobs failed the exception of the first failed job in the span is rethrown.
+    void WaitAll(const ReadOnlySpan<JobHandle> jobs);
+
+    //! @brief Split the range [0, count) into chunks of at most grainSize entries and call fnRange(begin, end) for each chunk in parallel.
+    //!        The calling thread participates and the call returns once all chunks have been processed.
+    //!        If fnRange throws no new chunks are started and the first exception is rethrown.
+    //! @note  fnRange will be called concurrently so it must be thread safe.
+    void ParallelFor(const std::size_t count, const std::size_t grainSize, const std::function<void(std::size_t, std::size_t)>& fnRange);
+
+    //! @brief Call fnRange(Span<T>) in parallel for each chunk of at most grainSize entries of the span.
+    template <typename T, typename TFunc>
+    void ParallelFor(const Span<T> span, const std::size_t grainSize, TFunc fnRange)
+    {
+      ParallelFor(span.size(), grainSize,
+                  [span, &fnRange](const std::size_t begin, const std::size_t end) { fnRange(span.subspan(begin, end - begin)); });
+    }
+
+    //! @brief Call fnRange(ReadOnlySpan<T>) in parallel for each chunk of at most grainSize entries of the span.
+    template <typename T, typename TFunc>
+    void ParallelFor(const ReadOnlySpan<T> span, const std::size_t grainSize, TFunc fnRange)
+    {
+      ParallelFor(span.size(), grainSize,
+                  [span, &fnRange](const std::size_t begin, const std::size_t end) { fnRange(span.subspan(begin, end - begin)); });
+    }
+
+  private:
+    void WorkerMain(const uint32_t workerIndex);
+    uint32_t GetQueueIndex() const noexcept;
+    void Enqueue(std::shared_ptr<JobRecord> record);
+    bool TryExecuteOne();
+    std::shared_ptr<JobRecord> TryDequeue(const uint32_t queueIndex);
+    void Execute(const std::shared_ptr<JobRecord>& record);
+    void ReleaseDependency(const std::shared_ptr<JobRecord>& record);
+  };
+}
+
+#endif
@@ -0,0 +1,90 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/DirectoryWatcher.hpp>
+#include <FslBase/System/Platform/PlatformFileSystem.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace Fsl::IO
+{
+  DirectoryWatcher::DirectoryWatcher(const IO::Path& fullPath, const SearchOptions searchOptions, const std::chrono::milliseconds debounceTime)
+    : m_token(PlatformFileSystem::CreateDirectoryMonitorToken(fullPath, searchOptions))
+    , m_debounceTime(debounceTime)
+  {
+    if (!m_token)
+    {
+      throw NotSupportedException("DirectoryWatcher not supported");
+    }
+    if (debounceTime.count() < 0)
+    {
+      throw std::invalid_argument("debounceTime can not be negative");
+    }
+  }
+
+
+  DirectoryWatcher::~DirectoryWatcher() = default;
+
+
+  bool DirectoryWatcher::IsSupported(const IO::Path& fullPath, const SearchOptions searchOptions)
+  {
+    return PlatformFileSystem::CreateDirectoryMonitorToken(fullPath, searchOptions) != nullptr;
+  }
+
+
+  bool DirectoryWatcher::TryWaitForChanges(std::vector<IO::Path>& rChangedFiles, const std::chrono::milliseconds timeout)
+  {
+    rChangedFiles.clear();
+    m_scratchpad.clear();
+    if (!PlatformFileSystem::WaitForDirectoryChanges(m_token, m_scratchpad, timeout))
+    {
+      return false;
+    }
+
+    // Debounce: keep collecting until the burst settles (or we have waited for too long)
+    const auto deadline = std::chrono::steady_clock::now() + (m_debounceTime * MaxDebounceFactor);
+    while (std::chrono::steady_clock::now() < deadline && PlatformFileSystem::WaitForDirectoryChanges(m_token, m_scratchpad, m_debounceTime))
+    {
+    }
+
+    rChangedFiles.reserve(m_scratchpad.size());
+    for (const auto& entry : m_scratchpad)
+    {
+      rChangedFiles.push_back(*entry);
+    }
+    m_scratchpad.clear();
+
+    std::sort(rChangedFiles.begin(), rChangedFiles.end());
+    rChangedFiles.erase(std::unique(rChangedFiles.begin(), rChangedFiles.end()), rChangedFiles.end());
+    return true;
+  }
+}
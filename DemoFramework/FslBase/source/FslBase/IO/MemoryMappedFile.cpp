@@ -0,0 +1,92 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/File.hpp>
+#include <FslBase/IO/MemoryMappedFile.hpp>
+#include <FslBase/System/Platform/PlatformFileSystem.hpp>
+#include <utility>
+
+namespace Fsl::IO
+{
+  MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+    : m_mapping(std::move(other.m_mapping))
+    , m_fallbackContent(std::move(other.m_fallbackContent))
+    , m_content(other.m_content)
+  {
+    // Moving a vector never relocates its content so the span stays valid
+    other.m_content = {};
+  }
+
+
+  MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+  {
+    if (this != &other)
+    {
+      m_mapping = std::move(other.m_mapping);
+      m_fallbackContent = std::move(other.m_fallbackContent);
+      m_content = other.m_content;
+      other.m_content = {};
+    }
+    return *this;
+  }
+
+
+  MemoryMappedFile::MemoryMappedFile() noexcept = default;
+
+
+  MemoryMappedFile::MemoryMappedFile(const Path& path, const bool forceRead)
+  {
+    if (!forceRead)
+    {
+      m_mapping = PlatformFileSystem::TryMapFile(path);
+    }
+    if (m_mapping)
+    {
+      m_content = PlatformFileSystem::GetMappedContent(m_mapping);
+    }
+    else
+    {
+      File::ReadAllBytes(m_fallbackContent, path);
+      m_content = ReadOnlySpan<uint8_t>(m_fallbackContent.data(), m_fallbackContent.size());
+    }
+  }
+
+
+  MemoryMappedFile::~MemoryMappedFile() noexcept = default;
+
+
+  void MemoryMappedFile::Reset() noexcept
+  {
+    m_content = {};
+    m_mapping.reset();
+    m_fallbackContent.clear();
+  }
+}
@@ -134,4 +134,18 @@ namespace Fsl::IO
     }
     return false;
   }
+
+
+  bool PathWatcher::Check(std::vector<IO::Path>& rChangedPaths)
+  {
+    rChangedPaths.clear();
+    for (auto& rEntry : SysPaths)
+    {
+      if (rEntry->CheckForChanges())
+      {
+        rChangedPaths.push_back(rEntry->FullPath);
+      }
+    }
+    return !rChangedPaths.empty();
+  }
 }
@@ -0,0 +1,684 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/AsyncLog.hpp>
+#include <FslBase/Log/IAsyncLogOutput.hpp>
+#include <FslBase/Log/Logger0.hpp>
+#include "AsyncLogInternal.hpp"
+
+#if defined(__ANDROID__) || defined(FSL_PLATFORM_FREERTOS) || defined(FSLBASE_THREAD_BACKEND_NOT_SUPPORTED)
+#define LOCAL_ASYNC_LOG_NOT_SUPPORTED
+#endif
+
+#ifdef LOCAL_ASYNC_LOG_NOT_SUPPORTED
+
+namespace Fsl
+{
+  namespace AsyncLogInternal
+  {
+    bool TryWriteLine(const LogType /*logType*/, const char* const /*psz*/) noexcept
+    {
+      return false;
+    }
+  }
+
+  namespace AsyncLog
+  {
+    void Enable(const AsyncLogConfig& /*config*/)
+    {
+      throw NotSupportedException("AsyncLog is not supported on this platform");
+    }
+
+    void Enable(const AsyncLogConfig& /*config*/, std::shared_ptr<IAsyncLogOutput> /*output*/)
+    {
+      throw NotSupportedException("AsyncLog is not supported on this platform");
+    }
+
+    void Disable() noexcept
+    {
+    }
+
+    bool IsEnabled() noexcept
+    {
+      return false;
+    }
+
+    bool IsSupported() noexcept
+    {
+      return false;
+    }
+
+    void Flush() noexcept
+    {
+    }
+
+    void RequestFlush() noexcept
+    {
+    }
+
+    AsyncLogStats GetStats() noexcept
+    {
+      return {};
+    }
+  }
+}
+
+#else
+
+#include <FslBase/Bits/BitsUtil.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr uint32_t MinThreadBufferCapacity = 256;
+      // The batch is written to the output once it reaches this size
+      constexpr std::size_t MaxBatchSize = 64 * 1024;
+      // Assume a 64 byte cache line, this keeps the producer and consumer positions from false sharing
+      constexpr std::size_t CacheLineSize = 64;
+      constexpr uint32_t EmergencyDrainAttempts = 100;
+    }
+
+    struct RecordHeader
+    {
+      uint64_t Sequence{0};
+      uint32_t Length{0};
+      uint32_t Type{0};
+    };
+
+
+    //! A single producer (the owning thread) / single consumer (the drain) byte ring buffer
+    class ThreadRingBuffer
+    {
+      std::unique_ptr<uint8_t[]> m_buffer;
+      std::size_t m_capacity;
+      std::size_t m_mask;
+      alignas(LocalConfig::CacheLineSize) std::atomic<std::size_t> m_writePos{0};
+      alignas(LocalConfig::CacheLineSize) std::atomic<std::size_t> m_readPos{0};
+
+    public:
+      explicit ThreadRingBuffer(const std::size_t capacity)
+        : m_buffer(std::make_unique<uint8_t[]>(capacity))
+        , m_capacity(capacity)
+        , m_mask(capacity - 1u)
+      {
+      }
+
+      std::size_t Capacity() const noexcept
+      {
+        return m_capacity;
+      }
+
+      std::size_t UsedBytes() const noexcept
+      {
+        return m_writePos.load(std::memory_order_relaxed) - m_readPos.load(std::memory_order_relaxed);
+      }
+
+      bool IsEmpty() const noexcept
+      {
+        return m_readPos.load(std::memory_order_acquire) == m_writePos.load(std::memory_order_acquire);
+      }
+
+      //! Producer side, the sequence number is only taken once there is room for the record so every taken number is published
+      bool TryWrite(const LogType logType, const char* const pStr, const uint32_t length, std::atomic<uint64_t>& rSequence) noexcept
+      {
+        const std::size_t recordSize = sizeof(RecordHeader) + length;
+        const std::size_t writePos = m_writePos.load(std::memory_order_relaxed);
+        const std::size_t readPos = m_readPos.load(std::memory_order_acquire);
+        if ((m_capacity - (writePos - readPos)) < recordSize)
+        {
+          return false;
+        }
+        const RecordHeader header{rSequence.fetch_add(1u), length, static_cast<uint32_t>(logType)};
+        CopyIn(writePos, &header, sizeof(RecordHeader));
+        CopyIn(writePos + sizeof(RecordHeader), pStr, header.Length);
+        m_writePos.store(writePos + recordSize, std::memory_order_release);
+        return true;
+      }
+
+      //! Consumer side
+      bool TryPeekHeader(RecordHeader& rHeader) const noexcept
+      {
+        const std::size_t readPos = m_readPos.load(std::memory_order_relaxed);
+        if (readPos == m_writePos.load(std::memory_order_acquire))
+        {
+          return false;
+        }
+        CopyOut(readPos, &rHeader, sizeof(RecordHeader));
+        return true;
+      }
+
+      //! Consumer side, append the payload of the record returned by TryPeekHeader to rDst and release its space.
+      void ConsumeRecord(const RecordHeader& header, fmt::memory_buffer& rDst)
+      {
+        const std::size_t readPos = m_readPos.load(std::memory_order_relaxed);
+        const std::size_t dstOffset = rDst.size();
+        rDst.resize(dstOffset + header.Length);
+        CopyOut(readPos + sizeof(RecordHeader), rDst.data() + dstOffset, header.Length);
+        m_readPos.store(readPos + sizeof(RecordHeader) + header.Length, std::memory_order_release);
+      }
+
+    private:
+      void CopyIn(const std::size_t pos, const void* const pSrc, const std::size_t count) noexcept
+      {
+        const std::size_t index = pos & m_mask;
+        const std::size_t firstCount = std::min(count, m_capacity - index);
+        std::memcpy(m_buffer.get() + index, pSrc, firstCount);
+        std::memcpy(m_buffer.get(), static_cast<const uint8_t*>(pSrc) + firstCount, count - firstCount);
+      }
+
+      void CopyOut(const std::size_t pos, void* const pDst, const std::size_t count) const noexcept
+      {
+        const std::size_t index = pos & m_mask;
+        const std::size_t firstCount = std::min(count, m_capacity - index);
+        std::memcpy(pDst, m_buffer.get() + index, firstCount);
+        std::memcpy(static_cast<uint8_t*>(pDst) + firstCount, m_buffer.get(), count - firstCount);
+      }
+    };
+
+
+    struct ThreadLocalRing
+    {
+      std::shared_ptr<ThreadRingBuffer> Ring;
+      uint32_t Generation{0};
+    };
+
+    thread_local ThreadLocalRing t_ring;
+
+
+    class AsyncLogSink
+    {
+      std::mutex m_controlMutex;
+      std::atomic<bool> m_enabled{false};
+      std::atomic<uint32_t> m_activeWriters{0};
+      std::atomic<uint32_t> m_generation{0};
+      std::atomic<bool> m_flushRequested{false};
+      //! Only modified while the sink is disabled
+      AsyncLogConfig m_config;
+      std::shared_ptr<IAsyncLogOutput> m_output;
+      std::terminate_handler m_oldTerminateHandler{nullptr};
+
+      std::mutex m_registryMutex;
+      std::vector<std::shared_ptr<ThreadRingBuffer>> m_rings;
+
+      //! Guards m_batch, m_drainRings and m_nextSequence
+      std::mutex m_drainMutex;
+      fmt::memory_buffer m_batch;
+      std::vector<std::shared_ptr<ThreadRingBuffer>> m_drainRings;
+      //! The sequence number of the next line to write
+      uint64_t m_nextSequence{0};
+
+      std::mutex m_wakeMutex;
+      std::condition_variable m_wakeCondition;
+      bool m_quit{false};
+      std::thread m_thread;
+
+      std::atomic<uint64_t> m_sequence{0};
+      std::atomic<uint64_t> m_linesEnqueued{0};
+      std::atomic<uint64_t> m_linesWritten{0};
+      std::atomic<uint64_t> m_linesDropped{0};
+      std::atomic<uint64_t> m_maxBacklogDepth{0};
+
+    public:
+      AsyncLogSink(const AsyncLogSink&) = delete;
+      AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+      AsyncLogSink() = default;
+
+      ~AsyncLogSink()
+      {
+        Disable();
+      }
+
+      bool IsEnabled() const noexcept
+      {
+        return m_enabled.load(std::memory_order_relaxed);
+      }
+
+      void Enable(const AsyncLogConfig& config, std::shared_ptr<IAsyncLogOutput> output, std::terminate_handler terminateHandler)
+      {
+        std::lock_guard<std::mutex> lock(m_controlMutex);
+        if (m_enabled.load())
+        {
+          throw UsageErrorException("AsyncLog is already enabled");
+        }
+
+        m_config = config;
+        m_config.ThreadBufferCapacity = BitsUtil::NextPowerOfTwo(std::max(config.ThreadBufferCapacity, LocalConfig::MinThreadBufferCapacity));
+        m_output = std::move(output);
+        // Invalidate the ring buffers cached by the threads
+        m_generation.fetch_add(1u);
+        {
+          std::lock_guard<std::mutex> wakeLock(m_wakeMutex);
+          m_quit = false;
+        }
+        m_thread = std::thread([this]() { ThreadMain(); });
+        m_oldTerminateHandler = std::set_terminate(terminateHandler);
+        m_enabled.store(true);
+      }
+
+      void Disable() noexcept
+      {
+        try
+        {
+          std::lock_guard<std::mutex> lock(m_controlMutex);
+          if (!m_enabled.load())
+          {
+            return;
+          }
+          m_enabled.store(false);
+          // Wait for the threads that are currently writing a line
+          while (m_activeWriters.load() > 0u)
+          {
+            std::this_thread::yield();
+          }
+          {
+            std::lock_guard<std::mutex> wakeLock(m_wakeMutex);
+            m_quit = true;
+          }
+          m_wakeCondition.notify_one();
+          m_thread.join();
+          Drain(true);
+          std::set_terminate(m_oldTerminateHandler);
+          m_oldTerminateHandler = nullptr;
+          m_output.reset();
+
+          std::lock_guard<std::mutex> registryLock(m_registryMutex);
+          m_rings.clear();
+        }
+        catch (const std::exception&)
+        {
+          // the logging functionality should never kill the program
+        }
+      }
+
+      bool TryWriteLine(const LogType logType, const char* const psz) noexcept
+      {
+        m_activeWriters.fetch_add(1u);
+        bool handled = false;
+        // Disable waits for m_activeWriters to reach zero, so the sink can not be torn down while we use it
+        if (m_enabled.load())
+        {
+          try
+          {
+            handled = DoWriteLine(logType, psz);
+          }
+          catch (const std::exception&)
+          {
+            handled = false;
+          }
+        }
+        m_activeWriters.fetch_sub(1u);
+        return handled;
+      }
+
+      void Flush() noexcept
+      {
+        try
+        {
+          Drain(true);
+        }
+        catch (const std::exception&)
+        {
+          // the logging functionality should never kill the program
+        }
+      }
+
+      void RequestFlush() noexcept
+      {
+        m_flushRequested.store(true);
+      }
+
+      void EmergencyFlush() noexcept
+      {
+        // The thread that died might be the one draining, so never block here
+        for (uint32_t i = 0; i < LocalConfig::EmergencyDrainAttempts; ++i)
+        {
+          std::unique_lock<std::mutex> lock(m_drainMutex, std::try_to_lock);
+          if (lock.owns_lock())
+          {
+            try
+            {
+              // Do not wait for lines that are still being added, the thread adding them might be gone
+              UnsafeDrain(true, false);
+            }
+            catch (const std::exception&)
+            {
+            }
+            return;
+          }
+          std::this_thread::yield();
+        }
+      }
+
+      std::terminate_handler GetOldTerminateHandler() const noexcept
+      {
+        return m_oldTerminateHandler;
+      }
+
+      AsyncLogStats GetStats() const noexcept
+      {
+        const uint64_t linesWritten = m_linesWritten.load();
+        const uint64_t linesEnqueued = m_linesEnqueued.load();
+        return {linesWritten, m_linesDropped.load(), linesEnqueued > linesWritten ? linesEnqueued - linesWritten : 0u, m_maxBacklogDepth.load()};
+      }
+
+    private:
+      bool DoWriteLine(const LogType logType, const char* const psz)
+      {
+        const std::size_t length = std::strlen(psz);
+        ThreadRingBuffer& rRing = GetThreadRing();
+        if ((sizeof(RecordHeader) + length) > rRing.Capacity())
+        {
+          // The line can never fit in the ring, so write everything pending followed by the line
+          WriteLineNow(logType, psz, length);
+          return true;
+        }
+
+        while (!rRing.TryWrite(logType, psz, static_cast<uint32_t>(length), m_sequence))
+        {
+          if (m_config.OverflowPolicy == AsyncLogOverflowPolicy::Drop)
+          {
+            m_linesDropped.fetch_add(1u);
+            return true;
+          }
+          m_wakeCondition.notify_one();
+          std::this_thread::yield();
+        }
+        m_linesEnqueued.fetch_add(1u);
+
+        // Warnings and errors are written as soon as possible, the rest waits for the flush interval unless the buffer is filling up
+        if (logType <= LogType::Warning || rRing.UsedBytes() >= (rRing.Capacity() / 2u))
+        {
+          m_wakeCondition.notify_one();
+        }
+        return true;
+      }
+
+      ThreadRingBuffer& GetThreadRing()
+      {
+        const uint32_t generation = m_generation.load(std::memory_order_relaxed);
+        if (!t_ring.Ring || t_ring.Generation != generation)
+        {
+          auto ring = std::make_shared<ThreadRingBuffer>(m_config.ThreadBufferCapacity);
+          {
+            std::lock_guard<std::mutex> lock(m_registryMutex);
+            m_rings.push_back(ring);
+          }
+          t_ring.Ring = std::move(ring);
+          t_ring.Generation = generation;
+        }
+        return *t_ring.Ring;
+      }
+
+      void ThreadMain()
+      {
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        while (!m_quit)
+        {
+          m_wakeCondition.wait_for(lock, m_config.FlushInterval);
+          lock.unlock();
+          try
+          {
+            Drain(m_flushRequested.exchange(false));
+          }
+          catch (const std::exception&)
+          {
+            // the logging functionality should never kill the program
+          }
+          lock.lock();
+        }
+      }
+
+      void Drain(const bool forceFlush)
+      {
+        std::lock_guard<std::mutex> lock(m_drainMutex);
+        UnsafeDrain(forceFlush, true);
+      }
+
+      void WriteLineNow(const LogType logType, const char* const psz, const std::size_t length)
+      {
+        std::lock_guard<std::mutex> lock(m_drainMutex);
+        UnsafeDrain(false, true);
+        AppendPrefix(m_batch, logType);
+        m_batch.append(psz, psz + length);
+        m_batch.push_back('\n');
+        WriteBatch(1u);
+        FlushOutput();
+      }
+
+      void RefreshDrainRings()
+      {
+        std::lock_guard<std::mutex> registryLock(m_registryMutex);
+        m_drainRings.assign(m_rings.begin(), m_rings.end());
+      }
+
+      //! The caller must hold m_drainMutex
+      //! @param waitForMissingLines if true lines are never written before a line with a lower sequence number that is still being added
+      void UnsafeDrain(const bool forceFlush, const bool waitForMissingLines)
+      {
+        RefreshDrainRings();
+
+        {
+          const uint64_t backlogDepth = GetStats().BacklogDepth;
+          uint64_t maxDepth = m_maxBacklogDepth.load(std::memory_order_relaxed);
+          while (backlogDepth > maxDepth && !m_maxBacklogDepth.compare_exchange_weak(maxDepth, backlogDepth))
+          {
+          }
+        }
+
+        // Merge the rings by sequence number so the output keeps the order the lines were logged in
+        uint64_t linesInBatch = 0;
+        while (true)
+        {
+          ThreadRingBuffer* pNextRing = nullptr;
+          RecordHeader nextHeader;
+          for (const auto& ring : m_drainRings)
+          {
+            RecordHeader header;
+            if (ring->TryPeekHeader(header) && (pNextRing == nullptr || header.Sequence < nextHeader.Sequence))
+            {
+              pNextRing = ring.get();
+              nextHeader = header;
+            }
+          }
+          if (pNextRing == nullptr)
+          {
+            break;
+          }
+          if (nextHeader.Sequence > m_nextSequence && waitForMissingLines)
+          {
+            // The missing line has its sequence number but is still being copied into its buffer (which might be newer than our snapshot)
+            RefreshDrainRings();
+            std::this_thread::yield();
+            continue;
+          }
+          m_nextSequence = std::max(m_nextSequence, nextHeader.Sequence + 1u);
+
+          AppendPrefix(m_batch, static_cast<LogType>(nextHeader.Type));
+          pNextRing->ConsumeRecord(nextHeader, m_batch);
+          m_batch.push_back('\n');
+          ++linesInBatch;
+
+          if (m_batch.size() >= LocalConfig::MaxBatchSize)
+          {
+            WriteBatch(linesInBatch);
+            linesInBatch = 0;
+          }
+        }
+        if (linesInBatch > 0u)
+        {
+          WriteBatch(linesInBatch);
+        }
+        if (forceFlush)
+        {
+          FlushOutput();
+        }
+        m_drainRings.clear();
+
+        // Release the rings of threads that have exited once they have been drained
+        std::lock_guard<std::mutex> registryLock(m_registryMutex);
+        m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(),
+                                     [](const std::shared_ptr<ThreadRingBuffer>& ring) { return ring.use_count() == 1 && ring->IsEmpty(); }),
+                      m_rings.end());
+      }
+
+      void WriteBatch(const uint64_t lineCount) noexcept
+      {
+        if (m_output)
+        {
+          m_output->WriteLines(StringViewLite(m_batch.data(), m_batch.size()));
+        }
+        else
+        {
+          AsyncLogInternal::WriteFormattedLines(m_batch.data(), m_batch.size());
+        }
+        m_linesWritten.fetch_add(lineCount);
+        m_batch.clear();
+      }
+
+      void FlushOutput() noexcept
+      {
+        if (m_output)
+        {
+          m_output->Flush();
+        }
+        else
+        {
+          AsyncLogInternal::FlushOutput();
+        }
+      }
+
+      static void AppendPrefix(fmt::memory_buffer& rDst, const LogType logType)
+      {
+        switch (logType)
+        {
+        case LogType::Warning:
+          AppendString(rDst, "WARNING: ");
+          break;
+        case LogType::Error:
+          AppendString(rDst, "ERROR: ");
+          break;
+        default:
+          break;
+        }
+      }
+
+      static void AppendString(fmt::memory_buffer& rDst, const std::string_view str)
+      {
+        rDst.append(str.data(), str.data() + str.size());
+      }
+    };
+
+    AsyncLogSink g_sink;
+
+    void OnTerminate()
+    {
+      g_sink.EmergencyFlush();
+      const std::terminate_handler oldHandler = g_sink.GetOldTerminateHandler();
+      if (oldHandler != nullptr)
+      {
+        oldHandler();
+      }
+      std::abort();
+    }
+  }
+
+  namespace AsyncLogInternal
+  {
+    bool TryWriteLine(const LogType logType, const char* const psz) noexcept
+    {
+      return g_sink.IsEnabled() && g_sink.TryWriteLine(logType, psz);
+    }
+  }
+
+  namespace AsyncLog
+  {
+    void Enable(const AsyncLogConfig& config)
+    {
+      g_sink.Enable(config, {}, OnTerminate);
+    }
+
+    void Enable(const AsyncLogConfig& config, std::shared_ptr<IAsyncLogOutput> output)
+    {
+      g_sink.Enable(config, std::move(output), OnTerminate);
+    }
+
+    void Disable() noexcept
+    {
+      g_sink.Disable();
+    }
+
+    bool IsEnabled() noexcept
+    {
+      return g_sink.IsEnabled();
+    }
+
+    bool IsSupported() noexcept
+    {
+      return true;
+    }
+
+    void Flush() noexcept
+    {
+      if (g_sink.IsEnabled())
+      {
+        g_sink.Flush();
+      }
+    }
+
+    void RequestFlush() noexcept
+    {
+      g_sink.RequestFlush();
+    }
+
+    AsyncLogStats GetStats() noexcept
+    {
+      return g_sink.GetStats();
+    }
+  }
+}
+#endif
@@ -36,6 +36,7 @@
 #include <FslBase/Log/Logger0.hpp>
 #include <exception>
 #include <iterator>
+#include "AsyncLogInternal.hpp"
 
 #ifdef __ANDROID__
 #include <android/log.h>
@@ -51,6 +52,8 @@
   }
 #else
 #include <fmt/format.h>
+#include <cstdio>
+#include <string_view>
 #if defined(_WIN32) && !defined(NDEBUG)
 #include <windows.h>
 
@@ -106,6 +109,29 @@ namespace Fsl
 #endif
   }
 
+#if !defined(__ANDROID__) && !defined(FSL_PLATFORM_FREERTOS)
+  namespace AsyncLogInternal
+  {
+    void WriteFormattedLines(const char* const pStr, const std::size_t length) noexcept
+    {
+      try
+      {
+        std::fwrite(pStr, 1, length, stdout);
+        IDE_LOG("{}", std::string_view(pStr, length));
+      }
+      catch (const std::exception&)
+      {
+        /// the logging functionality should never kill the program
+      }
+    }
+
+    void FlushOutput() noexcept
+    {
+      std::fflush(stdout);
+    }
+  }
+#endif
+
   LogType LogConfig::g_logLevel = LogType::Info;
 
   namespace Logger
@@ -134,6 +160,10 @@ namespace Fsl
         }
         __android_log_print(androidLogType, "FSL_LOG_TAG", "%s", psz);
 #else
+        if (AsyncLogInternal::TryWriteLine(logType, psz))
+        {
+          return;
+        }
         SafePrint(logType, psz);
         switch (logType)
         {
@@ -180,6 +210,10 @@ namespace Fsl
         }
         __android_log_print(androidLogType, "FSL_LOG_TAG", "%s", psz);
 #else
+        if (AsyncLogInternal::TryWriteLine(logType, psz))
+        {
+          return;
+        }
         SafePrint(logType, psz);
         switch (logType)
         {
@@ -0,0 +1,236 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/BoundingBoxSoA.hpp>
+#include <FslBase/Math/BoundingFrustum.hpp>
+#include <FslBase/Math/BoundingFrustumBatch.hpp>
+#include <FslBase/Math/BoundingSphereSoA.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <stdexcept>
+#include "Kernels/BoundingFrustumBatchKernelsInternal.hpp"
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! Inputs smaller than this are processed on the calling thread as the job overhead would dominate
+      constexpr uint32_t ParallelMinCount = 32 * 1024;
+      //! The number of mask entries processed by each job (8192 volumes)
+      constexpr std::size_t ParallelGrainEntries = 256;
+      //! The number of mask entries produced per batch when generating a index list
+      constexpr uint32_t IndexBatchEntries = 64;
+    }
+
+    using namespace BoundingFrustumBatchKernelsInternal;
+
+    std::array<PlaneInput, PlaneCount> GetPlanes(const BoundingFrustum& frustum) noexcept
+    {
+      const std::array<Plane, PlaneCount> planes = {frustum.Near(), frustum.Far(), frustum.Left(), frustum.Right(), frustum.Top(), frustum.Bottom()};
+      std::array<PlaneInput, PlaneCount> result{};
+      for (uint32_t i = 0; i < PlaneCount; ++i)
+      {
+        result[i] = PlaneInput{planes[i].Normal.X, planes[i].Normal.Y, planes[i].Normal.Z, planes[i].D};
+      }
+      return result;
+    }
+
+    BoxInput CreateInput(const BoundingFrustum& frustum, const BoundingBoxSoA& boxes) noexcept
+    {
+      const std::array<PlaneInput, PlaneCount> planes = GetPlanes(frustum);
+      BoxInput input{};
+      for (uint32_t i = 0; i < PlaneCount; ++i)
+      {
+        // Pick the 'negative vertex' exactly like BoundingBox::Intersects(const Plane&)
+        const PlaneInput& plane = planes[i];
+        input[i].Plane = plane;
+        input[i].pX = plane.NormalX >= 0 ? boxes.MinX().data() : boxes.MaxX().data();
+        input[i].pY = plane.NormalY >= 0 ? boxes.MinY().data() : boxes.MaxY().data();
+        input[i].pZ = plane.NormalZ >= 0 ? boxes.MinZ().data() : boxes.MaxZ().data();
+      }
+      return input;
+    }
+
+    SphereInput CreateInput(const BoundingFrustum& frustum, const BoundingSphereSoA& spheres) noexcept
+    {
+      return {GetPlanes(frustum), spheres.CenterX().data(), spheres.CenterY().data(), spheres.CenterZ().data(), spheres.Radius().data()};
+    }
+
+    void ValidateMask(const uint32_t count, const Span<uint32_t> dstVisibilityMask)
+    {
+      if (dstVisibilityMask.size() < BoundingFrustumBatch::CalcVisibilityMaskLength(count))
+      {
+        throw std::invalid_argument("dstVisibilityMask is too small");
+      }
+    }
+
+    void ValidateIndices(const uint32_t count, const Span<uint32_t> dstIndices)
+    {
+      if (dstIndices.size() < count)
+      {
+        throw std::invalid_argument("dstIndices is too small");
+      }
+    }
+
+    uint32_t Compact(const uint32_t* pVisibilityMask, const uint32_t count, const uint32_t indexOffset, uint32_t* pDstIndices) noexcept
+    {
+      const uint32_t entryCount = BoundingFrustumBatch::CalcVisibilityMaskLength(count);
+      uint32_t written = 0;
+      for (uint32_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+      {
+        uint32_t bits = pVisibilityMask[entryIndex];
+        if ((entryIndex + 1u) == entryCount && (count % 32u) != 0u)
+        {
+          bits &= (1u << (count % 32u)) - 1u;
+        }
+        const uint32_t baseIndex = indexOffset + (entryIndex * 32u);
+        while (bits != 0u)
+        {
+          pDstIndices[written] = baseIndex + static_cast<uint32_t>(std::countr_zero(bits));
+          ++written;
+          bits &= bits - 1u;
+        }
+      }
+      return written;
+    }
+
+    template <typename TInput, typename TKernel>
+    void ParallelVisibilityMask(JobSystem& jobSystem, const TKernel fnKernel, const TInput& input, const uint32_t count,
+                                Span<uint32_t> dstVisibilityMask)
+    {
+      if (count < LocalConfig::ParallelMinCount)
+      {
+        fnKernel(input, 0u, count, dstVisibilityMask.data());
+        return;
+      }
+
+      // Each job writes its own range of mask entries, so no synchronization is needed
+      uint32_t* const pDst = dstVisibilityMask.data();
+      jobSystem.ParallelFor(BoundingFrustumBatch::CalcVisibilityMaskLength(count), LocalConfig::ParallelGrainEntries,
+                            [fnKernel, &input, count, pDst](const std::size_t begin, const std::size_t end)
+                            {
+                              const auto startIndex = static_cast<uint32_t>(begin * 32u);
+                              const auto endIndex = static_cast<uint32_t>(std::min(end * 32u, static_cast<std::size_t>(count)));
+                              fnKernel(input, startIndex, endIndex - startIndex, pDst + begin);
+                            });
+    }
+
+    template <typename TInput, typename TKernel>
+    uint32_t VisibleIndices(const TKernel fnKernel, const TInput& input, const uint32_t count, Span<uint32_t> dstIndices) noexcept
+    {
+      constexpr uint32_t BatchCount = LocalConfig::IndexBatchEntries * 32u;
+      std::array<uint32_t, LocalConfig::IndexBatchEntries> visibilityMask{};
+      uint32_t written = 0;
+      for (uint32_t startIndex = 0; startIndex < count; startIndex += BatchCount)
+      {
+        const uint32_t batchCount = std::min(count - startIndex, BatchCount);
+        fnKernel(input, startIndex, batchCount, visibilityMask.data());
+        written += Compact(visibilityMask.data(), batchCount, startIndex, dstIndices.data() + written);
+      }
+      return written;
+    }
+  }
+
+
+  void BoundingFrustumBatch::CalcVisibilityMask(const BoundingFrustum& frustum, const BoundingBoxSoA& boxes, Span<uint32_t> dstVisibilityMask)
+  {
+    ValidateMask(boxes.Count(), dstVisibilityMask);
+    GetKernels().BoxVisibilityMask(CreateInput(frustum, boxes), 0u, boxes.Count(), dstVisibilityMask.data());
+  }
+
+
+  void BoundingFrustumBatch::CalcVisibilityMask(const BoundingFrustum& frustum, const BoundingSphereSoA& spheres, Span<uint32_t> dstVisibilityMask)
+  {
+    ValidateMask(spheres.Count(), dstVisibilityMask);
+    GetKernels().SphereVisibilityMask(CreateInput(frustum, spheres), 0u, spheres.Count(), dstVisibilityMask.data());
+  }
+
+
+  void BoundingFrustumBatch::CalcVisibilityMask(const BoundingFrustumBatchKernelSet kernelSet, const BoundingFrustum& frustum,
+                                                const BoundingBoxSoA& boxes, Span<uint32_t> dstVisibilityMask)
+  {
+    ValidateMask(boxes.Count(), dstVisibilityMask);
+    GetKernels(kernelSet).BoxVisibilityMask(CreateInput(frustum, boxes), 0u, boxes.Count(), dstVisibilityMask.data());
+  }
+
+
+  void BoundingFrustumBatch::CalcVisibilityMask(const BoundingFrustumBatchKernelSet kernelSet, const BoundingFrustum& frustum,
+                                                const BoundingSphereSoA& spheres, Span<uint32_t> dstVisibilityMask)
+  {
+    ValidateMask(spheres.Count(), dstVisibilityMask);
+    GetKernels(kernelSet).SphereVisibilityMask(CreateInput(frustum, spheres), 0u, spheres.Count(), dstVisibilityMask.data());
+  }
+
+
+  void BoundingFrustumBatch::CalcVisibilityMask(JobSystem& jobSystem, const BoundingFrustum& frustum, const BoundingBoxSoA& boxes,
+                                                Span<uint32_t> dstVisibilityMask)
+  {
+    ValidateMask(boxes.Count(), dstVisibilityMask);
+    ParallelVisibilityMask(jobSystem, GetKernels().BoxVisibilityMask, CreateInput(frustum, boxes), boxes.Count(), dstVisibilityMask);
+  }
+
+
+  void BoundingFrustumBatch::CalcVisibilityMask(JobSystem& jobSystem, const BoundingFrustum& frustum, const BoundingSphereSoA& spheres,
+                                                Span<uint32_t> dstVisibilityMask)
+  {
+    ValidateMask(spheres.Count(), dstVisibilityMask);
+    ParallelVisibilityMask(jobSystem, GetKernels().SphereVisibilityMask, CreateInput(frustum, spheres), spheres.Count(), dstVisibilityMask);
+  }
+
+
+  uint32_t BoundingFrustumBatch::CalcVisibleIndices(const BoundingFrustum& frustum, const BoundingBoxSoA& boxes, Span<uint32_t> dstIndices)
+  {
+    ValidateIndices(boxes.Count(), dstIndices);
+    return VisibleIndices(GetKernels().BoxVisibilityMask, CreateInput(frustum, boxes), boxes.Count(), dstIndices);
+  }
+
+
+  uint32_t BoundingFrustumBatch::CalcVisibleIndices(const BoundingFrustum& frustum, const BoundingSphereSoA& spheres, Span<uint32_t> dstIndices)
+  {
+    ValidateIndices(spheres.Count(), dstIndices);
+    return VisibleIndices(GetKernels().SphereVisibilityMask, CreateInput(frustum, spheres), spheres.Count(), dstIndices);
+  }
+
+
+  uint32_t BoundingFrustumBatch::CompactVisibilityMask(const ReadOnlySpan<uint32_t> visibilityMask, const uint32_t count, Span<uint32_t> dstIndices)
+  {
+    if (visibilityMask.size() < CalcVisibilityMaskLength(count))
+    {
+      throw std::invalid_argument("visibilityMask is too small");
+    }
+    ValidateIndices(count, dstIndices);
+    return Compact(visibilityMask.data(), count, 0u, dstIndices.data());
+  }
+}
@@ -0,0 +1,178 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/System/CpuFeatures.hpp>
+#include "BoundingFrustumBatchKernelsInternal.hpp"
+
+namespace Fsl
+{
+  namespace BoundingFrustumBatchKernelsInternal
+  {
+    void BoxVisibilityMaskScalar(const BoxInput& input, const uint32_t startIndex, const uint32_t count, uint32_t* pDstMask) noexcept
+    {
+      uint32_t mask = 0;
+      uint32_t bitIndex = 0;
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        const uint32_t index = startIndex + i;
+        bool visible = true;
+        for (const BoxPlaneInput& entry : input)
+        {
+          const float distance =
+            entry.Plane.NormalX * entry.pX[index] + entry.Plane.NormalY * entry.pY[index] + entry.Plane.NormalZ * entry.pZ[index] + entry.Plane.D;
+          if (distance > 0)
+          {
+            visible = false;
+            break;
+          }
+        }
+        mask |= (visible ? 1u : 0u) << bitIndex;
+        if (++bitIndex == 32u)
+        {
+          *pDstMask = mask;
+          ++pDstMask;
+          mask = 0;
+          bitIndex = 0;
+        }
+      }
+      if (bitIndex > 0u)
+      {
+        *pDstMask = mask;
+      }
+    }
+
+
+    void SphereVisibilityMaskScalar(const SphereInput& input, const uint32_t startIndex, const uint32_t count, uint32_t* pDstMask) noexcept
+    {
+      uint32_t mask = 0;
+      uint32_t bitIndex = 0;
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        const uint32_t index = startIndex + i;
+        const float radius = input.pRadius[index];
+        bool visible = true;
+        for (const PlaneInput& plane : input.Planes)
+        {
+          float distance = plane.NormalX * input.pCenterX[index] + plane.NormalY * input.pCenterY[index] + plane.NormalZ * input.pCenterZ[index];
+          distance += plane.D;
+          if (distance > radius)
+          {
+            visible = false;
+            break;
+          }
+        }
+        mask |= (visible ? 1u : 0u) << bitIndex;
+        if (++bitIndex == 32u)
+        {
+          *pDstMask = mask;
+          ++pDstMask;
+          mask = 0;
+          bitIndex = 0;
+        }
+      }
+      if (bitIndex > 0u)
+      {
+        *pDstMask = mask;
+      }
+    }
+  }
+
+  namespace
+  {
+    constexpr BoundingFrustumBatchKernelsInternal::Kernels ScalarKernels{BoundingFrustumBatchKernelsInternal::BoxVisibilityMaskScalar,
+                                                                         BoundingFrustumBatchKernelsInternal::SphereVisibilityMaskScalar};
+
+    const BoundingFrustumBatchKernelsInternal::Kernels* TryGetKernels(const BoundingFrustumBatchKernelSet kernelSet) noexcept
+    {
+      switch (kernelSet)
+      {
+      case BoundingFrustumBatchKernelSet::Scalar:
+        return &ScalarKernels;
+      case BoundingFrustumBatchKernelSet::SSE41:
+        return CpuFeatures::HasSSE41() ? BoundingFrustumBatchKernelsInternal::TryGetSSE41Kernels() : nullptr;
+      case BoundingFrustumBatchKernelSet::AVX2:
+        return CpuFeatures::HasAVX2() ? BoundingFrustumBatchKernelsInternal::TryGetAVX2Kernels() : nullptr;
+      case BoundingFrustumBatchKernelSet::Neon:
+        return CpuFeatures::HasNeon() ? BoundingFrustumBatchKernelsInternal::TryGetNeonKernels() : nullptr;
+      }
+      return nullptr;
+    }
+
+    BoundingFrustumBatchKernelSet DetectBestKernelSet() noexcept
+    {
+      if (BoundingFrustumBatch::IsSupported(BoundingFrustumBatchKernelSet::AVX2))
+      {
+        return BoundingFrustumBatchKernelSet::AVX2;
+      }
+      if (BoundingFrustumBatch::IsSupported(BoundingFrustumBatchKernelSet::SSE41))
+      {
+        return BoundingFrustumBatchKernelSet::SSE41;
+      }
+      if (BoundingFrustumBatch::IsSupported(BoundingFrustumBatchKernelSet::Neon))
+      {
+        return BoundingFrustumBatchKernelSet::Neon;
+      }
+      return BoundingFrustumBatchKernelSet::Scalar;
+    }
+  }
+
+
+  bool BoundingFrustumBatch::IsSupported(const BoundingFrustumBatchKernelSet kernelSet) noexcept
+  {
+    return TryGetKernels(kernelSet) != nullptr;
+  }
+
+
+  BoundingFrustumBatchKernelSet BoundingFrustumBatch::GetBestKernelSet() noexcept
+  {
+    static const BoundingFrustumBatchKernelSet g_bestKernelSet = DetectBestKernelSet();
+    return g_bestKernelSet;
+  }
+
+
+  const BoundingFrustumBatchKernelsInternal::Kernels& BoundingFrustumBatchKernelsInternal::GetKernels(const BoundingFrustumBatchKernelSet kernelSet)
+  {
+    const Kernels* pKernels = TryGetKernels(kernelSet);
+    if (pKernels == nullptr)
+    {
+      throw NotSupportedException("The kernel set is not supported by this CPU");
+    }
+    return *pKernels;
+  }
+
+
+  const BoundingFrustumBatchKernelsInternal::Kernels& BoundingFrustumBatchKernelsInternal::GetKernels() noexcept
+  {
+    static const Kernels* const g_pKernels = TryGetKernels(BoundingFrustumBatch::GetBestKernelSet());
+    return *g_pKernels;
+  }
+}
@@ -0,0 +1,100 @@
+#ifndef FSLBASE_MATH_KERNELS_BOUNDINGFRUSTUMBATCHKERNELSINTERNAL_HPP
+#define FSLBASE_MATH_KERNELS_BOUNDINGFRUSTUMBATCHKERNELSINTERNAL_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/BoundingFrustumBatch.hpp>
+#include <array>
+
+namespace Fsl::BoundingFrustumBatchKernelsInternal
+{
+  //! The number of planes in a frustum
+  constexpr uint32_t PlaneCount = 6;
+
+  struct PlaneInput
+  {
+    float NormalX{0.0f};
+    float NormalY{0.0f};
+    float NormalZ{0.0f};
+    float D{0.0f};
+  };
+
+  //! A box is outside a plane if the vertex closest to the inside of the plane is in front of it. As the normal is constant for a plane the
+  //! vertex coordinates can be picked per plane from either the min or max array.
+  struct BoxPlaneInput
+  {
+    PlaneInput Plane;
+    const float* pX{nullptr};
+    const float* pY{nullptr};
+    const float* pZ{nullptr};
+  };
+
+  using BoxInput = std::array<BoxPlaneInput, PlaneCount>;
+
+  struct SphereInput
+  {
+    std::array<PlaneInput, PlaneCount> Planes;
+    const float* pCenterX{nullptr};
+    const float* pCenterY{nullptr};
+    const float* pCenterZ{nullptr};
+    const float* pRadius{nullptr};
+  };
+
+  //! The kernels process 'count' volumes starting at 'startIndex' (which must be a multiple of 32).
+  //! pDstMask points to the mask entry of startIndex and the last partially filled entry gets its unused bits cleared.
+  struct Kernels
+  {
+    void (*BoxVisibilityMask)(const BoxInput& input, const uint32_t startIndex, const uint32_t count, uint32_t* pDstMask) noexcept;
+    void (*SphereVisibilityMask)(const SphereInput& input, const uint32_t startIndex, const uint32_t count, uint32_t* pDstMask) noexcept;
+  };
+
+  // The scalar reference kernels, these are also used by the SIMD kernels to process the volumes that does not fill a entire mask entry.
+  // They use the exact same operation order as BoundingBox::Intersects(const Plane&) and BoundingSphere::Intersects(const Plane&)
+  void BoxVisibilityMaskScalar(const BoxInput& input, const uint32_t startIndex, const uint32_t count, uint32_t* pDstMask) noexcept;
+  void SphereVisibilityMaskScalar(const SphereInput& input, const uint32_t startIndex, const uint32_t count, uint32_t* pDstMask) noexcept;
+
+  //! @return the kernels or nullptr if they are not available on this platform
+  const Kernels* TryGetSSE41Kernels() noexcept;
+  //! @return the kernels or nullptr if they are not available on this platform
+  const Kernels* TryGetAVX2Kernels() noexcept;
+  //! @return the kernels or nullptr if they are not available on this platform
+  const Kernels* TryGetNeonKernels() noexcept;
+
+  //! @brief Get the kernels for the given set
+  //! @throws NotSupportedException if the kernel set is unsupported by the current CPU
+  const Kernels& GetKernels(const BoundingFrustumBatchKernelSet kernelSet);
+
+  //! @brief Get the fastest kernels supported by the current CPU
+  const Kernels& GetKernels() noexcept;
+}
+
+#endif
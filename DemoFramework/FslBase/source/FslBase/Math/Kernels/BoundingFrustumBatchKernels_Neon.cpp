@@ -0,0 +1,148 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/CpuFeatures.hpp>
+#include "BoundingFrustumBatchKernelsInternal.hpp"
+#if defined(FSL_CPU_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace Fsl::BoundingFrustumBatchKernelsInternal
+{
+#if defined(FSL_CPU_ARM64)
+  namespace
+  {
+    struct PlaneNeon
+    {
+      float32x4_t NormalX;
+      float32x4_t NormalY;
+      float32x4_t NormalZ;
+      float32x4_t D;
+    };
+
+    inline PlaneNeon LoadPlaneNeon(const PlaneInput& plane) noexcept
+    {
+      return {vdupq_n_f32(plane.NormalX), vdupq_n_f32(plane.NormalY), vdupq_n_f32(plane.NormalZ), vdupq_n_f32(plane.D)};
+    }
+
+    inline float32x4_t CalcDistanceNeon(const PlaneNeon& plane, const float32x4_t x, const float32x4_t y, const float32x4_t z) noexcept
+    {
+      return vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(plane.NormalX, x), vmulq_f32(plane.NormalY, y)), vmulq_f32(plane.NormalZ, z)), plane.D);
+    }
+
+    //! Convert a lane mask to the visibility bits of the four lanes
+    inline uint32_t ToVisibleBits(const uint32x4_t outside) noexcept
+    {
+      static constexpr uint32_t LaneBits[4] = {1u, 2u, 4u, 8u};
+      return vaddvq_u32(vandq_u32(vmvnq_u32(outside), vld1q_u32(LaneBits)));
+    }
+
+    void BoxVisibilityMaskNeon(const BoxInput& input, const uint32_t startIndex, const uint32_t count, uint32_t* pDstMask) noexcept
+    {
+      std::array<PlaneNeon, PlaneCount> planes{};
+      for (uint32_t i = 0; i < PlaneCount; ++i)
+      {
+        planes[i] = LoadPlaneNeon(input[i].Plane);
+      }
+
+      const float32x4_t zero = vdupq_n_f32(0.0f);
+      const uint32_t entryCount = count / 32u;
+      for (uint32_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+      {
+        uint32_t mask = 0;
+        for (uint32_t group = 0; group < 8u; ++group)
+        {
+          const uint32_t index = startIndex + (entryIndex * 32u) + (group * 4u);
+          uint32x4_t outside = vdupq_n_u32(0);
+          for (uint32_t i = 0; i < PlaneCount; ++i)
+          {
+            const BoxPlaneInput& entry = input[i];
+            const float32x4_t distance =
+              CalcDistanceNeon(planes[i], vld1q_f32(entry.pX + index), vld1q_f32(entry.pY + index), vld1q_f32(entry.pZ + index));
+            outside = vorrq_u32(outside, vcgtq_f32(distance, zero));
+          }
+          mask |= ToVisibleBits(outside) << (group * 4u);
+        }
+        pDstMask[entryIndex] = mask;
+      }
+      const uint32_t processed = entryCount * 32u;
+      BoxVisibilityMaskScalar(input, startIndex + processed, count - processed, pDstMask + entryCount);
+    }
+
+
+    void SphereVisibilityMaskNeon(const SphereInput& input, const uint32_t startIndex, const uint32_t count, uint32_t* pDstMask) noexcept
+    {
+      std::array<PlaneNeon, PlaneCount> planes{};
+      for (uint32_t i = 0; i < PlaneCount; ++i)
+      {
+        planes[i] = LoadPlaneNeon(input.Planes[i]);
+      }
+
+      const uint32_t entryCount = count / 32u;
+      for (uint32_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+      {
+        uint32_t mask = 0;
+        for (uint32_t group = 0; group < 8u; ++group)
+        {
+          const uint32_t index = startIndex + (entryIndex * 32u) + (group * 4u);
+          const float32x4_t x = vld1q_f32(input.pCenterX + index);
+          const float32x4_t y = vld1q_f32(input.pCenterY + index);
+          const float32x4_t z = vld1q_f32(input.pCenterZ + index);
+          const float32x4_t radius = vld1q_f32(input.pRadius + index);
+          uint32x4_t outside = vdupq_n_u32(0);
+          for (const PlaneNeon& plane : planes)
+          {
+            outside = vorrq_u32(outside, vcgtq_f32(CalcDistanceNeon(plane, x, y, z), radius));
+          }
+          mask |= ToVisibleBits(outside) << (group * 4u);
+        }
+        pDstMask[entryIndex] = mask;
+      }
+      const uint32_t processed = entryCount * 32u;
+      SphereVisibilityMaskScalar(input, startIndex + processed, count - processed, pDstMask + entryCount);
+    }
+
+    constexpr Kernels NeonKernels{BoxVisibilityMaskNeon, SphereVisibilityMaskNeon};
+  }
+
+
+  const Kernels* TryGetNeonKernels() noexcept
+  {
+    return &NeonKernels;
+  }
+#else
+  const Kernels* TryGetNeonKernels() noexcept
+  {
+    // not implemented on this platform
+    return nullptr;
+  }
+#endif
+}
@@ -0,0 +1,246 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/CpuFeatures.hpp>
+#include "BoundingFrustumBatchKernelsInternal.hpp"
+#if defined(FSL_CPU_X86)
+#include <immintrin.h>
+#endif
+
+namespace Fsl::BoundingFrustumBatchKernelsInternal
+{
+#if defined(FSL_CPU_X86)
+  namespace
+  {
+    // The kernels test a full mask entry (32 volumes) at a time, the remainder is handled by the scalar kernel.
+    // The plane distance is calculated with the same operation order as the scalar code (and no FMA) so the results are bit exact.
+
+    struct PlaneSSE
+    {
+      __m128 NormalX;
+      __m128 NormalY;
+      __m128 NormalZ;
+      __m128 D;
+    };
+
+    FSL_TARGET_SSE41 inline PlaneSSE LoadPlaneSSE(const PlaneInput& plane) noexcept
+    {
+      return {_mm_set1_ps(plane.NormalX), _mm_set1_ps(plane.NormalY), _mm_set1_ps(plane.NormalZ), _mm_set1_ps(plane.D)};
+    }
+
+    FSL_TARGET_SSE41 inline __m128 CalcDistanceSSE(const PlaneSSE& plane, const __m128 x, const __m128 y, const __m128 z) noexcept
+    {
+      return _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(plane.NormalX, x), _mm_mul_ps(plane.NormalY, y)), _mm_mul_ps(plane.NormalZ, z)), plane.D);
+    }
+
+    FSL_TARGET_SSE41 void BoxVisibilityMaskSSE41(const BoxInput& input, const uint32_t startIndex, const uint32_t count, uint32_t* pDstMask) noexcept
+    {
+      std::array<PlaneSSE, PlaneCount> planes{};
+      for (uint32_t i = 0; i < PlaneCount; ++i)
+      {
+        planes[i] = LoadPlaneSSE(input[i].Plane);
+      }
+
+      const __m128 zero = _mm_setzero_ps();
+      const uint32_t entryCount = count / 32u;
+      for (uint32_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+      {
+        uint32_t mask = 0;
+        for (uint32_t group = 0; group < 8u; ++group)
+        {
+          const uint32_t index = startIndex + (entryIndex * 32u) + (group * 4u);
+          __m128 outside = zero;
+          for (uint32_t i = 0; i < PlaneCount; ++i)
+          {
+            const BoxPlaneInput& entry = input[i];
+            const __m128 distance =
+              CalcDistanceSSE(planes[i], _mm_loadu_ps(entry.pX + index), _mm_loadu_ps(entry.pY + index), _mm_loadu_ps(entry.pZ + index));
+            outside = _mm_or_ps(outside, _mm_cmpgt_ps(distance, zero));
+          }
+          mask |= (static_cast<uint32_t>(~_mm_movemask_ps(outside)) & 0xFu) << (group * 4u);
+        }
+        pDstMask[entryIndex] = mask;
+      }
+      const uint32_t processed = entryCount * 32u;
+      BoxVisibilityMaskScalar(input, startIndex + processed, count - processed, pDstMask + entryCount);
+    }
+
+
+    FSL_TARGET_SSE41 void SphereVisibilityMaskSSE41(const SphereInput& input, const uint32_t startIndex, const uint32_t count,
+                                                    uint32_t* pDstMask) noexcept
+    {
+      std::array<PlaneSSE, PlaneCount> planes{};
+      for (uint32_t i = 0; i < PlaneCount; ++i)
+      {
+        planes[i] = LoadPlaneSSE(input.Planes[i]);
+      }
+
+      const uint32_t entryCount = count / 32u;
+      for (uint32_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+      {
+        uint32_t mask = 0;
+        for (uint32_t group = 0; group < 8u; ++group)
+        {
+          const uint32_t index = startIndex + (entryIndex * 32u) + (group * 4u);
+          const __m128 x = _mm_loadu_ps(input.pCenterX + index);
+          const __m128 y = _mm_loadu_ps(input.pCenterY + index);
+          const __m128 z = _mm_loadu_ps(input.pCenterZ + index);
+          const __m128 radius = _mm_loadu_ps(input.pRadius + index);
+          __m128 outside = _mm_setzero_ps();
+          for (const PlaneSSE& plane : planes)
+          {
+            outside = _mm_or_ps(outside, _mm_cmpgt_ps(CalcDistanceSSE(plane, x, y, z), radius));
+          }
+          mask |= (static_cast<uint32_t>(~_mm_movemask_ps(outside)) & 0xFu) << (group * 4u);
+        }
+        pDstMask[entryIndex] = mask;
+      }
+      const uint32_t processed = entryCount * 32u;
+      SphereVisibilityMaskScalar(input, startIndex + processed, count - processed, pDstMask + entryCount);
+    }
+
+
+    struct PlaneAVX
+    {
+      __m256 NormalX;
+      __m256 NormalY;
+      __m256 NormalZ;
+      __m256 D;
+    };
+
+    FSL_TARGET_AVX2 inline PlaneAVX LoadPlaneAVX(const PlaneInput& plane) noexcept
+    {
+      return {_mm256_set1_ps(plane.NormalX), _mm256_set1_ps(plane.NormalY), _mm256_set1_ps(plane.NormalZ), _mm256_set1_ps(plane.D)};
+    }
+
+    FSL_TARGET_AVX2 inline __m256 CalcDistanceAVX(const PlaneAVX& plane, const __m256 x, const __m256 y, const __m256 z) noexcept
+    {
+      return _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(plane.NormalX, x), _mm256_mul_ps(plane.NormalY, y)),
+                                         _mm256_mul_ps(plane.NormalZ, z)),
+                           plane.D);
+    }
+
+    FSL_TARGET_AVX2 void BoxVisibilityMaskAVX2(const BoxInput& input, const uint32_t startIndex, const uint32_t count, uint32_t* pDstMask) noexcept
+    {
+      std::array<PlaneAVX, PlaneCount> planes{};
+      for (uint32_t i = 0; i < PlaneCount; ++i)
+      {
+        planes[i] = LoadPlaneAVX(input[i].Plane);
+      }
+
+      const __m256 zero = _mm256_setzero_ps();
+      const uint32_t entryCount = count / 32u;
+      for (uint32_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+      {
+        uint32_t mask = 0;
+        for (uint32_t group = 0; group < 4u; ++group)
+        {
+          const uint32_t index = startIndex + (entryIndex * 32u) + (group * 8u);
+          __m256 outside = zero;
+          for (uint32_t i = 0; i < PlaneCount; ++i)
+          {
+            const BoxPlaneInput& entry = input[i];
+            const __m256 distance =
+              CalcDistanceAVX(planes[i], _mm256_loadu_ps(entry.pX + index), _mm256_loadu_ps(entry.pY + index), _mm256_loadu_ps(entry.pZ + index));
+            outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, zero, _CMP_GT_OQ));
+          }
+          mask |= (static_cast<uint32_t>(~_mm256_movemask_ps(outside)) & 0xFFu) << (group * 8u);
+        }
+        pDstMask[entryIndex] = mask;
+      }
+      const uint32_t processed = entryCount * 32u;
+      BoxVisibilityMaskScalar(input, startIndex + processed, count - processed, pDstMask + entryCount);
+    }
+
+
+    FSL_TARGET_AVX2 void SphereVisibilityMaskAVX2(const SphereInput& input, const uint32_t startIndex, const uint32_t count,
+                                                  uint32_t* pDstMask) noexcept
+    {
+      std::array<PlaneAVX, PlaneCount> planes{};
+      for (uint32_t i = 0; i < PlaneCount; ++i)
+      {
+        planes[i] = LoadPlaneAVX(input.Planes[i]);
+      }
+
+      const uint32_t entryCount = count / 32u;
+      for (uint32_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+      {
+        uint32_t mask = 0;
+        for (uint32_t group = 0; group < 4u; ++group)
+        {
+          const uint32_t index = startIndex + (entryIndex * 32u) + (group * 8u);
+          const __m256 x = _mm256_loadu_ps(input.pCenterX + index);
+          const __m256 y = _mm256_loadu_ps(input.pCenterY + index);
+          const __m256 z = _mm256_loadu_ps(input.pCenterZ + index);
+          const __m256 radius = _mm256_loadu_ps(input.pRadius + index);
+          __m256 outside = _mm256_setzero_ps();
+          for (const PlaneAVX& plane : planes)
+          {
+            outside = _mm256_or_ps(outside, _mm256_cmp_ps(CalcDistanceAVX(plane, x, y, z), radius, _CMP_GT_OQ));
+          }
+          mask |= (static_cast<uint32_t>(~_mm256_movemask_ps(outside)) & 0xFFu) << (group * 8u);
+        }
+        pDstMask[entryIndex] = mask;
+      }
+      const uint32_t processed = entryCount * 32u;
+      SphereVisibilityMaskScalar(input, startIndex + processed, count - processed, pDstMask + entryCount);
+    }
+
+    constexpr Kernels SSE41Kernels{BoxVisibilityMaskSSE41, SphereVisibilityMaskSSE41};
+    constexpr Kernels AVX2Kernels{BoxVisibilityMaskAVX2, SphereVisibilityMaskAVX2};
+  }
+
+
+  const Kernels* TryGetSSE41Kernels() noexcept
+  {
+    return &SSE41Kernels;
+  }
+
+
+  const Kernels* TryGetAVX2Kernels() noexcept
+  {
+    return &AVX2Kernels;
+  }
+#else
+  const Kernels* TryGetSSE41Kernels() noexcept
+  {
+    // not implemented on this platform
+    return nullptr;
+  }
+
+
+  const Kernels* TryGetAVX2Kernels() noexcept
+  {
+    // not implemented on this platform
+    return nullptr;
+  }
+#endif
+}
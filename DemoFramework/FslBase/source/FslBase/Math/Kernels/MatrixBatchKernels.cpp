@@ -0,0 +1,161 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/System/CpuFeatures.hpp>
+#include "MatrixBatchKernelsInternal.hpp"
+
+namespace Fsl
+{
+  namespace MatrixBatchKernelsInternal
+  {
+    void TransformVector3Scalar(const Vector3* pSrc, const Matrix& matrix, Vector3* pDst, const std::size_t count) noexcept
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        Vector3::Transform(pSrc[i], matrix, pDst[i]);
+      }
+    }
+
+
+    void TransformNormalVector3Scalar(const Vector3* pSrc, const Matrix& matrix, Vector3* pDst, const std::size_t count) noexcept
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        Vector3::TransformNormal(pSrc[i], matrix, pDst[i]);
+      }
+    }
+
+
+    void TransformVector4Scalar(const Vector4* pSrc, const Matrix& matrix, Vector4* pDst, const std::size_t count) noexcept
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        Vector4::Transform(pSrc[i], matrix, pDst[i]);
+      }
+    }
+
+
+    void MultiplyScalar(const Matrix* pLhs, const std::size_t lhsStep, const Matrix* pRhs, const std::size_t rhsStep, Matrix* pDst,
+                        const std::size_t count) noexcept
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        pDst[i] = Matrix::Multiply(pLhs[i * lhsStep], pRhs[i * rhsStep]);
+      }
+    }
+
+
+    void TransposeScalar(const Matrix* pSrc, Matrix* pDst, const std::size_t count) noexcept
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        pDst[i] = Matrix::Transpose(pSrc[i]);
+      }
+    }
+
+
+    void InvertScalar(const Matrix* pSrc, Matrix* pDst, const std::size_t count) noexcept
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        Matrix::Invert(pSrc[i], pDst[i]);
+      }
+    }
+  }
+
+
+  namespace
+  {
+    constexpr MatrixBatchKernelsInternal::Kernels ScalarKernels{
+      MatrixBatchKernelsInternal::TransformVector3Scalar, MatrixBatchKernelsInternal::TransformNormalVector3Scalar,
+      MatrixBatchKernelsInternal::TransformVector4Scalar, MatrixBatchKernelsInternal::MultiplyScalar,
+      MatrixBatchKernelsInternal::TransposeScalar,        MatrixBatchKernelsInternal::InvertScalar};
+
+    const MatrixBatchKernelsInternal::Kernels* TryGetKernels(const MatrixBatchKernelSet kernelSet) noexcept
+    {
+      switch (kernelSet)
+      {
+      case MatrixBatchKernelSet::Scalar:
+        return &ScalarKernels;
+      case MatrixBatchKernelSet::SSE41:
+        return CpuFeatures::HasSSE41() ? MatrixBatchKernelsInternal::TryGetSSE41Kernels() : nullptr;
+      case MatrixBatchKernelSet::Neon:
+        return CpuFeatures::HasNeon() ? MatrixBatchKernelsInternal::TryGetNeonKernels() : nullptr;
+      }
+      return nullptr;
+    }
+
+    MatrixBatchKernelSet DetectBestKernelSet() noexcept
+    {
+      if (MatrixBatch::IsSupported(MatrixBatchKernelSet::SSE41))
+      {
+        return MatrixBatchKernelSet::SSE41;
+      }
+      if (MatrixBatch::IsSupported(MatrixBatchKernelSet::Neon))
+      {
+        return MatrixBatchKernelSet::Neon;
+      }
+      return MatrixBatchKernelSet::Scalar;
+    }
+  }
+
+
+  bool MatrixBatch::IsSupported(const MatrixBatchKernelSet kernelSet) noexcept
+  {
+    return TryGetKernels(kernelSet) != nullptr;
+  }
+
+
+  MatrixBatchKernelSet MatrixBatch::GetBestKernelSet() noexcept
+  {
+    static const MatrixBatchKernelSet g_bestKernelSet = DetectBestKernelSet();
+    return g_bestKernelSet;
+  }
+
+
+  const MatrixBatchKernelsInternal::Kernels& MatrixBatchKernelsInternal::GetKernels(const MatrixBatchKernelSet kernelSet)
+  {
+    const Kernels* pKernels = TryGetKernels(kernelSet);
+    if (pKernels == nullptr)
+    {
+      throw NotSupportedException("The kernel set is not supported by this CPU");
+    }
+    return *pKernels;
+  }
+
+
+  const MatrixBatchKernelsInternal::Kernels& MatrixBatchKernelsInternal::GetKernels() noexcept
+  {
+    static const Kernels* const g_pKernels = TryGetKernels(MatrixBatch::GetBestKernelSet());
+    return *g_pKernels;
+  }
+}
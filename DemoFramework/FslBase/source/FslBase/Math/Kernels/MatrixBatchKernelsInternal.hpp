@@ -0,0 +1,76 @@
+#ifndef FSLBASE_MATH_KERNELS_MATRIXBATCHKERNELSINTERNAL_HPP
+#define FSLBASE_MATH_KERNELS_MATRIXBATCHKERNELSINTERNAL_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/MatrixBatch.hpp>
+#include <cstddef>
+
+namespace Fsl::MatrixBatchKernelsInternal
+{
+  //! All kernels process 'count' entries and support pDst being equal to pSrc (in place).
+  struct Kernels
+  {
+    void (*TransformVector3)(const Vector3* pSrc, const Matrix& matrix, Vector3* pDst, const std::size_t count) noexcept;
+    void (*TransformNormalVector3)(const Vector3* pSrc, const Matrix& matrix, Vector3* pDst, const std::size_t count) noexcept;
+    void (*TransformVector4)(const Vector4* pSrc, const Matrix& matrix, Vector4* pDst, const std::size_t count) noexcept;
+    //! pDst[i] = pLhs[i * lhsStep] * pRhs[i * rhsStep] (a step of zero reuses the same matrix for all entries)
+    void (*Multiply)(const Matrix* pLhs, const std::size_t lhsStep, const Matrix* pRhs, const std::size_t rhsStep, Matrix* pDst,
+                     const std::size_t count) noexcept;
+    void (*Transpose)(const Matrix* pSrc, Matrix* pDst, const std::size_t count) noexcept;
+    void (*Invert)(const Matrix* pSrc, Matrix* pDst, const std::size_t count) noexcept;
+  };
+
+  // The scalar reference kernels, these are also used by the SIMD kernels to process the entries that does not fill a entire SIMD batch.
+  // They call the Vector3, Vector4 and Matrix methods so the results are identical by definition.
+  void TransformVector3Scalar(const Vector3* pSrc, const Matrix& matrix, Vector3* pDst, const std::size_t count) noexcept;
+  void TransformNormalVector3Scalar(const Vector3* pSrc, const Matrix& matrix, Vector3* pDst, const std::size_t count) noexcept;
+  void TransformVector4Scalar(const Vector4* pSrc, const Matrix& matrix, Vector4* pDst, const std::size_t count) noexcept;
+  void MultiplyScalar(const Matrix* pLhs, const std::size_t lhsStep, const Matrix* pRhs, const std::size_t rhsStep, Matrix* pDst,
+                      const std::size_t count) noexcept;
+  void TransposeScalar(const Matrix* pSrc, Matrix* pDst, const std::size_t count) noexcept;
+  void InvertScalar(const Matrix* pSrc, Matrix* pDst, const std::size_t count) noexcept;
+
+  //! @return the kernels or nullptr if they are not available on this platform
+  const Kernels* TryGetSSE41Kernels() noexcept;
+  //! @return the kernels or nullptr if they are not available on this platform
+  const Kernels* TryGetNeonKernels() noexcept;
+
+  //! @brief Get the kernels for the given set
+  //! @throws NotSupportedException if the kernel set is unsupported by the current CPU
+  const Kernels& GetKernels(const MatrixBatchKernelSet kernelSet);
+
+  //! @brief Get the fastest kernels supported by the current CPU
+  const Kernels& GetKernels() noexcept;
+}
+
+#endif
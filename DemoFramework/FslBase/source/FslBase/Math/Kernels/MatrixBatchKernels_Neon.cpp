@@ -0,0 +1,178 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/CpuFeatures.hpp>
+#include "MatrixBatchKernelsInternal.hpp"
+#if defined(FSL_CPU_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace Fsl::MatrixBatchKernelsInternal
+{
+#if defined(FSL_CPU_ARM64)
+  namespace
+  {
+    // The sums are done in the same order as the scalar code using separate multiply and add instructions (no FMA).
+    // The inverse uses the scalar kernel.
+
+    struct MatrixNeon
+    {
+      float32x4_t Row0;
+      float32x4_t Row1;
+      float32x4_t Row2;
+      float32x4_t Row3;
+    };
+
+    inline MatrixNeon LoadMatrixNeon(const Matrix& matrix) noexcept
+    {
+      const float* pMatrix = matrix.DirectAccess();
+      return {vld1q_f32(pMatrix), vld1q_f32(pMatrix + 4), vld1q_f32(pMatrix + 8), vld1q_f32(pMatrix + 12)};
+    }
+
+    inline void StoreMatrixNeon(Matrix& rMatrix, const MatrixNeon& value) noexcept
+    {
+      float* pMatrix = rMatrix.DirectAccess();
+      vst1q_f32(pMatrix, value.Row0);
+      vst1q_f32(pMatrix + 4, value.Row1);
+      vst1q_f32(pMatrix + 8, value.Row2);
+      vst1q_f32(pMatrix + 12, value.Row3);
+    }
+
+    //! @brief ((v.x * m.Row0 + v.y * m.Row1) + v.z * m.Row2) + v.w * m.Row3
+    inline float32x4_t TransformRowNeon(const float32x4_t value, const MatrixNeon& matrix) noexcept
+    {
+      return vaddq_f32(vaddq_f32(vaddq_f32(vmulq_laneq_f32(matrix.Row0, value, 0), vmulq_laneq_f32(matrix.Row1, value, 1)),
+                                 vmulq_laneq_f32(matrix.Row2, value, 2)),
+                       vmulq_laneq_f32(matrix.Row3, value, 3));
+    }
+
+    //! The Vector3 kernels work on four vectors at a time as a structure of arrays (vld3q/vst3q does the conversion)
+    template <bool TAddTranslation>
+    inline void TransformVector3x4Neon(const Vector3* pSrc, const Matrix& matrix, Vector3* pDst, const std::size_t count) noexcept
+    {
+      const float* pMatrix = matrix.DirectAccess();
+      const float32x4_t m11 = vdupq_n_f32(pMatrix[0]);
+      const float32x4_t m12 = vdupq_n_f32(pMatrix[1]);
+      const float32x4_t m13 = vdupq_n_f32(pMatrix[2]);
+      const float32x4_t m21 = vdupq_n_f32(pMatrix[4]);
+      const float32x4_t m22 = vdupq_n_f32(pMatrix[5]);
+      const float32x4_t m23 = vdupq_n_f32(pMatrix[6]);
+      const float32x4_t m31 = vdupq_n_f32(pMatrix[8]);
+      const float32x4_t m32 = vdupq_n_f32(pMatrix[9]);
+      const float32x4_t m33 = vdupq_n_f32(pMatrix[10]);
+      const float32x4_t m41 = vdupq_n_f32(pMatrix[12]);
+      const float32x4_t m42 = vdupq_n_f32(pMatrix[13]);
+      const float32x4_t m43 = vdupq_n_f32(pMatrix[14]);
+
+      const auto* pSrcFloats = reinterpret_cast<const float*>(pSrc);
+      auto* pDstFloats = reinterpret_cast<float*>(pDst);
+      const std::size_t batchCount = count / 4u;
+      for (std::size_t i = 0; i < batchCount; ++i)
+      {
+        const float32x4x3_t src = vld3q_f32(pSrcFloats + (i * 12u));
+        float32x4x3_t res;
+        res.val[0] = vaddq_f32(vaddq_f32(vmulq_f32(src.val[0], m11), vmulq_f32(src.val[1], m21)), vmulq_f32(src.val[2], m31));
+        res.val[1] = vaddq_f32(vaddq_f32(vmulq_f32(src.val[0], m12), vmulq_f32(src.val[1], m22)), vmulq_f32(src.val[2], m32));
+        res.val[2] = vaddq_f32(vaddq_f32(vmulq_f32(src.val[0], m13), vmulq_f32(src.val[1], m23)), vmulq_f32(src.val[2], m33));
+        if constexpr (TAddTranslation)
+        {
+          res.val[0] = vaddq_f32(res.val[0], m41);
+          res.val[1] = vaddq_f32(res.val[1], m42);
+          res.val[2] = vaddq_f32(res.val[2], m43);
+        }
+        vst3q_f32(pDstFloats + (i * 12u), res);
+      }
+    }
+
+    void TransformVector3Neon(const Vector3* pSrc, const Matrix& matrix, Vector3* pDst, const std::size_t count) noexcept
+    {
+      TransformVector3x4Neon<true>(pSrc, matrix, pDst, count);
+      const std::size_t processed = (count / 4u) * 4u;
+      TransformVector3Scalar(pSrc + processed, matrix, pDst + processed, count - processed);
+    }
+
+    void TransformNormalVector3Neon(const Vector3* pSrc, const Matrix& matrix, Vector3* pDst, const std::size_t count) noexcept
+    {
+      TransformVector3x4Neon<false>(pSrc, matrix, pDst, count);
+      const std::size_t processed = (count / 4u) * 4u;
+      TransformNormalVector3Scalar(pSrc + processed, matrix, pDst + processed, count - processed);
+    }
+
+    void TransformVector4Neon(const Vector4* pSrc, const Matrix& matrix, Vector4* pDst, const std::size_t count) noexcept
+    {
+      const MatrixNeon m = LoadMatrixNeon(matrix);
+      const auto* pSrcFloats = reinterpret_cast<const float*>(pSrc);
+      auto* pDstFloats = reinterpret_cast<float*>(pDst);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        vst1q_f32(pDstFloats + (i * 4u), TransformRowNeon(vld1q_f32(pSrcFloats + (i * 4u)), m));
+      }
+    }
+
+    void MultiplyNeon(const Matrix* pLhs, const std::size_t lhsStep, const Matrix* pRhs, const std::size_t rhsStep, Matrix* pDst,
+                      const std::size_t count) noexcept
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        // Load both matrices before storing anything so pDst can be equal to pLhs or pRhs
+        const MatrixNeon lhs = LoadMatrixNeon(pLhs[i * lhsStep]);
+        const MatrixNeon rhs = LoadMatrixNeon(pRhs[i * rhsStep]);
+        StoreMatrixNeon(pDst[i], {TransformRowNeon(lhs.Row0, rhs), TransformRowNeon(lhs.Row1, rhs), TransformRowNeon(lhs.Row2, rhs),
+                                  TransformRowNeon(lhs.Row3, rhs)});
+      }
+    }
+
+    void TransposeNeon(const Matrix* pSrc, Matrix* pDst, const std::size_t count) noexcept
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        // The de-interleaving load produces the columns
+        const float32x4x4_t columns = vld4q_f32(pSrc[i].DirectAccess());
+        StoreMatrixNeon(pDst[i], {columns.val[0], columns.val[1], columns.val[2], columns.val[3]});
+      }
+    }
+
+    constexpr Kernels NeonKernels{TransformVector3Neon, TransformNormalVector3Neon, TransformVector4Neon, MultiplyNeon, TransposeNeon, InvertScalar};
+  }
+
+
+  const Kernels* TryGetNeonKernels() noexcept
+  {
+    return &NeonKernels;
+  }
+#else
+  const Kernels* TryGetNeonKernels() noexcept
+  {
+    // not implemented on this platform
+    return nullptr;
+  }
+#endif
+}
@@ -0,0 +1,289 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/CpuFeatures.hpp>
+#include "MatrixBatchKernelsInternal.hpp"
+#if defined(FSL_CPU_X86)
+#include <immintrin.h>
+#endif
+
+namespace Fsl::MatrixBatchKernelsInternal
+{
+#if defined(FSL_CPU_X86)
+  namespace
+  {
+    // The matrix is stored row by row and vectors are row vectors, so a transformed vector is the sum of the matrix rows scaled by the vector
+    // components. The sums are done in the same order as the scalar code (and without FMA) so the results are bit exact.
+
+    constexpr int Shuffle(const int i0, const int i1, const int i2, const int i3) noexcept
+    {
+      return i0 | (i1 << 2) | (i2 << 4) | (i3 << 6);
+    }
+
+    struct MatrixSSE
+    {
+      __m128 Row0;
+      __m128 Row1;
+      __m128 Row2;
+      __m128 Row3;
+    };
+
+    FSL_TARGET_SSE41 inline MatrixSSE LoadMatrixSSE(const Matrix& matrix) noexcept
+    {
+      const float* pMatrix = matrix.DirectAccess();
+      return {_mm_loadu_ps(pMatrix), _mm_loadu_ps(pMatrix + 4), _mm_loadu_ps(pMatrix + 8), _mm_loadu_ps(pMatrix + 12)};
+    }
+
+    FSL_TARGET_SSE41 inline void StoreMatrixSSE(Matrix& rMatrix, const MatrixSSE& value) noexcept
+    {
+      float* pMatrix = rMatrix.DirectAccess();
+      _mm_storeu_ps(pMatrix, value.Row0);
+      _mm_storeu_ps(pMatrix + 4, value.Row1);
+      _mm_storeu_ps(pMatrix + 8, value.Row2);
+      _mm_storeu_ps(pMatrix + 12, value.Row3);
+    }
+
+    //! @brief ((v.x * m.Row0 + v.y * m.Row1) + v.z * m.Row2) + v.w * m.Row3
+    FSL_TARGET_SSE41 inline __m128 TransformRowSSE(const __m128 value, const MatrixSSE& matrix) noexcept
+    {
+      const __m128 x = _mm_shuffle_ps(value, value, Shuffle(0, 0, 0, 0));
+      const __m128 y = _mm_shuffle_ps(value, value, Shuffle(1, 1, 1, 1));
+      const __m128 z = _mm_shuffle_ps(value, value, Shuffle(2, 2, 2, 2));
+      const __m128 w = _mm_shuffle_ps(value, value, Shuffle(3, 3, 3, 3));
+      return _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, matrix.Row0), _mm_mul_ps(y, matrix.Row1)), _mm_mul_ps(z, matrix.Row2)),
+                        _mm_mul_ps(w, matrix.Row3));
+    }
+
+    //! @brief Convert four packed Vector3 (stored in a, b, c) to a structure of arrays
+    FSL_TARGET_SSE41 inline void LoadVector3x4SSE(const Vector3* pSrc, __m128& rX, __m128& rY, __m128& rZ) noexcept
+    {
+      const auto* pSrcFloats = reinterpret_cast<const float*>(pSrc);
+      // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+      const __m128 a = _mm_loadu_ps(pSrcFloats);
+      const __m128 b = _mm_loadu_ps(pSrcFloats + 4);
+      const __m128 c = _mm_loadu_ps(pSrcFloats + 8);
+      rX = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, Shuffle(2, 2, 1, 1)), Shuffle(0, 3, 0, 2));
+      rY = _mm_shuffle_ps(_mm_shuffle_ps(a, b, Shuffle(1, 1, 0, 0)), _mm_shuffle_ps(b, c, Shuffle(3, 3, 2, 2)), Shuffle(0, 2, 0, 2));
+      rZ = _mm_shuffle_ps(_mm_shuffle_ps(a, b, Shuffle(2, 2, 1, 1)), c, Shuffle(0, 2, 0, 3));
+    }
+
+    //! @brief Convert a structure of arrays back to four packed Vector3
+    FSL_TARGET_SSE41 inline void StoreVector3x4SSE(Vector3* pDst, const __m128 x, const __m128 y, const __m128 z) noexcept
+    {
+      auto* pDstFloats = reinterpret_cast<float*>(pDst);
+      const __m128 a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, Shuffle(0, 0, 0, 0)), _mm_shuffle_ps(z, x, Shuffle(0, 0, 1, 1)), Shuffle(0, 2, 0, 2));
+      const __m128 b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, Shuffle(1, 1, 1, 1)), _mm_shuffle_ps(x, y, Shuffle(2, 2, 2, 2)), Shuffle(0, 2, 0, 2));
+      const __m128 c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, Shuffle(2, 2, 3, 3)), _mm_shuffle_ps(y, z, Shuffle(3, 3, 3, 3)), Shuffle(0, 2, 0, 2));
+      _mm_storeu_ps(pDstFloats, a);
+      _mm_storeu_ps(pDstFloats + 4, b);
+      _mm_storeu_ps(pDstFloats + 8, c);
+    }
+
+    //! The Vector3 kernels work on four vectors at a time as a structure of arrays
+    template <bool TAddTranslation>
+    FSL_TARGET_SSE41 inline void TransformVector3x4SSE(const Vector3* pSrc, const Matrix& matrix, Vector3* pDst, const std::size_t count) noexcept
+    {
+      const float* pMatrix = matrix.DirectAccess();
+      const __m128 m11 = _mm_set1_ps(pMatrix[0]);
+      const __m128 m12 = _mm_set1_ps(pMatrix[1]);
+      const __m128 m13 = _mm_set1_ps(pMatrix[2]);
+      const __m128 m21 = _mm_set1_ps(pMatrix[4]);
+      const __m128 m22 = _mm_set1_ps(pMatrix[5]);
+      const __m128 m23 = _mm_set1_ps(pMatrix[6]);
+      const __m128 m31 = _mm_set1_ps(pMatrix[8]);
+      const __m128 m32 = _mm_set1_ps(pMatrix[9]);
+      const __m128 m33 = _mm_set1_ps(pMatrix[10]);
+      const __m128 m41 = _mm_set1_ps(pMatrix[12]);
+      const __m128 m42 = _mm_set1_ps(pMatrix[13]);
+      const __m128 m43 = _mm_set1_ps(pMatrix[14]);
+
+      const std::size_t batchCount = count / 4u;
+      for (std::size_t i = 0; i < batchCount; ++i)
+      {
+        __m128 x;
+        __m128 y;
+        __m128 z;
+        LoadVector3x4SSE(pSrc + (i * 4u), x, y, z);
+        __m128 resX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m11), _mm_mul_ps(y, m21)), _mm_mul_ps(z, m31));
+        __m128 resY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m12), _mm_mul_ps(y, m22)), _mm_mul_ps(z, m32));
+        __m128 resZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m13), _mm_mul_ps(y, m23)), _mm_mul_ps(z, m33));
+        if constexpr (TAddTranslation)
+        {
+          resX = _mm_add_ps(resX, m41);
+          resY = _mm_add_ps(resY, m42);
+          resZ = _mm_add_ps(resZ, m43);
+        }
+        StoreVector3x4SSE(pDst + (i * 4u), resX, resY, resZ);
+      }
+    }
+
+    FSL_TARGET_SSE41 void TransformVector3SSE41(const Vector3* pSrc, const Matrix& matrix, Vector3* pDst, const std::size_t count) noexcept
+    {
+      TransformVector3x4SSE<true>(pSrc, matrix, pDst, count);
+      const std::size_t processed = (count / 4u) * 4u;
+      TransformVector3Scalar(pSrc + processed, matrix, pDst + processed, count - processed);
+    }
+
+    FSL_TARGET_SSE41 void TransformNormalVector3SSE41(const Vector3* pSrc, const Matrix& matrix, Vector3* pDst, const std::size_t count) noexcept
+    {
+      TransformVector3x4SSE<false>(pSrc, matrix, pDst, count);
+      const std::size_t processed = (count / 4u) * 4u;
+      TransformNormalVector3Scalar(pSrc + processed, matrix, pDst + processed, count - processed);
+    }
+
+    FSL_TARGET_SSE41 void TransformVector4SSE41(const Vector4* pSrc, const Matrix& matrix, Vector4* pDst, const std::size_t count) noexcept
+    {
+      const MatrixSSE m = LoadMatrixSSE(matrix);
+      const auto* pSrcFloats = reinterpret_cast<const float*>(pSrc);
+      auto* pDstFloats = reinterpret_cast<float*>(pDst);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        _mm_storeu_ps(pDstFloats + (i * 4u), TransformRowSSE(_mm_loadu_ps(pSrcFloats + (i * 4u)), m));
+      }
+    }
+
+    FSL_TARGET_SSE41 void MultiplySSE41(const Matrix* pLhs, const std::size_t lhsStep, const Matrix* pRhs, const std::size_t rhsStep, Matrix* pDst,
+                                        const std::size_t count) noexcept
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        // Load both matrices before storing anything so pDst can be equal to pLhs or pRhs
+        const MatrixSSE lhs = LoadMatrixSSE(pLhs[i * lhsStep]);
+        const MatrixSSE rhs = LoadMatrixSSE(pRhs[i * rhsStep]);
+        // Each row of the result is the lhs row transformed by the rhs matrix
+        StoreMatrixSSE(pDst[i], {TransformRowSSE(lhs.Row0, rhs), TransformRowSSE(lhs.Row1, rhs), TransformRowSSE(lhs.Row2, rhs),
+                                 TransformRowSSE(lhs.Row3, rhs)});
+      }
+    }
+
+    FSL_TARGET_SSE41 void TransposeSSE41(const Matrix* pSrc, Matrix* pDst, const std::size_t count) noexcept
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        MatrixSSE m = LoadMatrixSSE(pSrc[i]);
+        _MM_TRANSPOSE4_PS(m.Row0, m.Row1, m.Row2, m.Row3);
+        StoreMatrixSSE(pDst[i], m);
+      }
+    }
+
+    // The 2x2 sub matrix helpers used by the block wise inverse.
+    // A 2x2 matrix is stored as (m11, m12, m21, m22) in one register.
+
+    //! @brief a * b
+    FSL_TARGET_SSE41 inline __m128 Mat2Mul(const __m128 a, const __m128 b) noexcept
+    {
+      return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, Shuffle(0, 3, 0, 3))),
+                        _mm_mul_ps(_mm_shuffle_ps(a, a, Shuffle(1, 0, 3, 2)), _mm_shuffle_ps(b, b, Shuffle(2, 1, 2, 1))));
+    }
+
+    //! @brief adjugate(a) * b
+    FSL_TARGET_SSE41 inline __m128 Mat2AdjMul(const __m128 a, const __m128 b) noexcept
+    {
+      return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, Shuffle(3, 3, 0, 0)), b),
+                        _mm_mul_ps(_mm_shuffle_ps(a, a, Shuffle(1, 1, 2, 2)), _mm_shuffle_ps(b, b, Shuffle(2, 3, 0, 1))));
+    }
+
+    //! @brief a * adjugate(b)
+    FSL_TARGET_SSE41 inline __m128 Mat2MulAdj(const __m128 a, const __m128 b) noexcept
+    {
+      return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, Shuffle(3, 0, 3, 0))),
+                        _mm_mul_ps(_mm_shuffle_ps(a, a, Shuffle(1, 0, 3, 2)), _mm_shuffle_ps(b, b, Shuffle(2, 1, 2, 1))));
+    }
+
+    //! @brief Block wise inverse of the 4x4 matrix in single precision.
+    //!        M = | A B |  and the inverse is calculated from the adjugates and determinants of the 2x2 sub matrices.
+    //!            | C D |
+    FSL_TARGET_SSE41 inline MatrixSSE InvertSSE(const MatrixSSE& m) noexcept
+    {
+      const __m128 a = _mm_movelh_ps(m.Row0, m.Row1);
+      const __m128 b = _mm_movehl_ps(m.Row1, m.Row0);
+      const __m128 c = _mm_movelh_ps(m.Row2, m.Row3);
+      const __m128 d = _mm_movehl_ps(m.Row3, m.Row2);
+
+      // The determinants of the sub matrices (|A| |B| |C| |D|)
+      const __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(m.Row0, m.Row2, Shuffle(0, 2, 0, 2)), _mm_shuffle_ps(m.Row1, m.Row3, Shuffle(1, 3, 1, 3))),
+        _mm_mul_ps(_mm_shuffle_ps(m.Row0, m.Row2, Shuffle(1, 3, 1, 3)), _mm_shuffle_ps(m.Row1, m.Row3, Shuffle(0, 2, 0, 2))));
+      const __m128 detA = _mm_shuffle_ps(detSub, detSub, Shuffle(0, 0, 0, 0));
+      const __m128 detB = _mm_shuffle_ps(detSub, detSub, Shuffle(1, 1, 1, 1));
+      const __m128 detC = _mm_shuffle_ps(detSub, detSub, Shuffle(2, 2, 2, 2));
+      const __m128 detD = _mm_shuffle_ps(detSub, detSub, Shuffle(3, 3, 3, 3));
+
+      const __m128 dc = Mat2AdjMul(d, c);
+      const __m128 ab = Mat2AdjMul(a, b);
+      // The adjugates of the result blocks
+      __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Mat2Mul(b, dc));
+      __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Mat2Mul(c, ab));
+      __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Mat2MulAdj(d, ab));
+      __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Mat2MulAdj(a, dc));
+
+      // |M| = |A|*|D| + |B|*|C| - trace(adjugate(A)B * adjugate(D)C)
+      __m128 trace = _mm_mul_ps(ab, _mm_shuffle_ps(dc, dc, Shuffle(0, 2, 1, 3)));
+      trace = _mm_hadd_ps(trace, trace);
+      trace = _mm_hadd_ps(trace, trace);
+      const __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+      const __m128 rcpDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+      x = _mm_mul_ps(x, rcpDetM);
+      y = _mm_mul_ps(y, rcpDetM);
+      z = _mm_mul_ps(z, rcpDetM);
+      w = _mm_mul_ps(w, rcpDetM);
+
+      // Apply the adjugate and recombine the blocks into rows
+      return {_mm_shuffle_ps(x, y, Shuffle(3, 1, 3, 1)), _mm_shuffle_ps(x, y, Shuffle(2, 0, 2, 0)), _mm_shuffle_ps(z, w, Shuffle(3, 1, 3, 1)),
+              _mm_shuffle_ps(z, w, Shuffle(2, 0, 2, 0))};
+    }
+
+    FSL_TARGET_SSE41 void InvertSSE41(const Matrix* pSrc, Matrix* pDst, const std::size_t count) noexcept
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        StoreMatrixSSE(pDst[i], InvertSSE(LoadMatrixSSE(pSrc[i])));
+      }
+    }
+
+    constexpr Kernels SSE41Kernels{TransformVector3SSE41, TransformNormalVector3SSE41, TransformVector4SSE41, MultiplySSE41, TransposeSSE41,
+                                   InvertSSE41};
+  }
+
+
+  const Kernels* TryGetSSE41Kernels() noexcept
+  {
+    return &SSE41Kernels;
+  }
+#else
+  const Kernels* TryGetSSE41Kernels() noexcept
+  {
+    // not implemented on this platform
+    return nullptr;
+  }
+#endif
+}
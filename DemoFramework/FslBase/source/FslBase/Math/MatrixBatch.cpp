@@ -0,0 +1,203 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/MatrixBatch.hpp>
+#include <stdexcept>
+#include "Kernels/MatrixBatchKernelsInternal.hpp"
+
+namespace Fsl
+{
+  namespace
+  {
+    // The kernels access the vectors and matrices as packed floats
+    static_assert(sizeof(Vector3) == (sizeof(float) * 3), "Vector3 must be three packed floats");
+    static_assert(sizeof(Vector4) == (sizeof(float) * 4), "Vector4 must be four packed floats");
+    static_assert(sizeof(Matrix) == (sizeof(float) * 16), "Matrix must be sixteen packed floats");
+
+    void ValidateDst(const std::size_t count, const std::size_t dstCount)
+    {
+      if (dstCount < count)
+      {
+        throw std::invalid_argument("dst is too small");
+      }
+    }
+
+    void DoTransform(const MatrixBatchKernelsInternal::Kernels& kernels, const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector3> dst)
+    {
+      ValidateDst(src.size(), dst.size());
+      kernels.TransformVector3(src.data(), matrix, dst.data(), src.size());
+    }
+
+    void DoTransformNormal(const MatrixBatchKernelsInternal::Kernels& kernels, const ReadOnlySpan<Vector3> src, const Matrix& matrix,
+                           Span<Vector3> dst)
+    {
+      ValidateDst(src.size(), dst.size());
+      kernels.TransformNormalVector3(src.data(), matrix, dst.data(), src.size());
+    }
+
+    void DoTransform(const MatrixBatchKernelsInternal::Kernels& kernels, const ReadOnlySpan<Vector4> src, const Matrix& matrix, Span<Vector4> dst)
+    {
+      ValidateDst(src.size(), dst.size());
+      kernels.TransformVector4(src.data(), matrix, dst.data(), src.size());
+    }
+
+    void DoMultiply(const MatrixBatchKernelsInternal::Kernels& kernels, const ReadOnlySpan<Matrix> lhs, const Matrix& rhs, Span<Matrix> dst)
+    {
+      ValidateDst(lhs.size(), dst.size());
+      kernels.Multiply(lhs.data(), 1u, &rhs, 0u, dst.data(), lhs.size());
+    }
+
+    void DoMultiply(const MatrixBatchKernelsInternal::Kernels& kernels, const Matrix& lhs, const ReadOnlySpan<Matrix> rhs, Span<Matrix> dst)
+    {
+      ValidateDst(rhs.size(), dst.size());
+      kernels.Multiply(&lhs, 0u, rhs.data(), 1u, dst.data(), rhs.size());
+    }
+
+    void DoMultiply(const MatrixBatchKernelsInternal::Kernels& kernels, const ReadOnlySpan<Matrix> lhs, const ReadOnlySpan<Matrix> rhs,
+                    Span<Matrix> dst)
+    {
+      if (lhs.size() != rhs.size())
+      {
+        throw std::invalid_argument("lhs and rhs must be of the same size");
+      }
+      ValidateDst(lhs.size(), dst.size());
+      kernels.Multiply(lhs.data(), 1u, rhs.data(), 1u, dst.data(), lhs.size());
+    }
+
+    void DoTranspose(const MatrixBatchKernelsInternal::Kernels& kernels, const ReadOnlySpan<Matrix> src, Span<Matrix> dst)
+    {
+      ValidateDst(src.size(), dst.size());
+      kernels.Transpose(src.data(), dst.data(), src.size());
+    }
+
+    void DoInvert(const MatrixBatchKernelsInternal::Kernels& kernels, const ReadOnlySpan<Matrix> src, Span<Matrix> dst)
+    {
+      ValidateDst(src.size(), dst.size());
+      kernels.Invert(src.data(), dst.data(), src.size());
+    }
+  }
+
+
+  void MatrixBatch::Transform(const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector3> dst)
+  {
+    DoTransform(MatrixBatchKernelsInternal::GetKernels(), src, matrix, dst);
+  }
+
+
+  void MatrixBatch::TransformNormal(const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector3> dst)
+  {
+    DoTransformNormal(MatrixBatchKernelsInternal::GetKernels(), src, matrix, dst);
+  }
+
+
+  void MatrixBatch::Transform(const ReadOnlySpan<Vector4> src, const Matrix& matrix, Span<Vector4> dst)
+  {
+    DoTransform(MatrixBatchKernelsInternal::GetKernels(), src, matrix, dst);
+  }
+
+
+  void MatrixBatch::Multiply(const ReadOnlySpan<Matrix> lhs, const Matrix& rhs, Span<Matrix> dst)
+  {
+    DoMultiply(MatrixBatchKernelsInternal::GetKernels(), lhs, rhs, dst);
+  }
+
+
+  void MatrixBatch::Multiply(const Matrix& lhs, const ReadOnlySpan<Matrix> rhs, Span<Matrix> dst)
+  {
+    DoMultiply(MatrixBatchKernelsInternal::GetKernels(), lhs, rhs, dst);
+  }
+
+
+  void MatrixBatch::Multiply(const ReadOnlySpan<Matrix> lhs, const ReadOnlySpan<Matrix> rhs, Span<Matrix> dst)
+  {
+    DoMultiply(MatrixBatchKernelsInternal::GetKernels(), lhs, rhs, dst);
+  }
+
+
+  void MatrixBatch::Transpose(const ReadOnlySpan<Matrix> src, Span<Matrix> dst)
+  {
+    DoTranspose(MatrixBatchKernelsInternal::GetKernels(), src, dst);
+  }
+
+
+  void MatrixBatch::Invert(const ReadOnlySpan<Matrix> src, Span<Matrix> dst)
+  {
+    DoInvert(MatrixBatchKernelsInternal::GetKernels(), src, dst);
+  }
+
+
+  void MatrixBatch::Transform(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector3> dst)
+  {
+    DoTransform(MatrixBatchKernelsInternal::GetKernels(kernelSet), src, matrix, dst);
+  }
+
+
+  void MatrixBatch::TransformNormal(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Vector3> src, const Matrix& matrix, Span<Vector3> dst)
+  {
+    DoTransformNormal(MatrixBatchKernelsInternal::GetKernels(kernelSet), src, matrix, dst);
+  }
+
+
+  void MatrixBatch::Transform(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Vector4> src, const Matrix& matrix, Span<Vector4> dst)
+  {
+    DoTransform(MatrixBatchKernelsInternal::GetKernels(kernelSet), src, matrix, dst);
+  }
+
+
+  void MatrixBatch::Multiply(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Matrix> lhs, const Matrix& rhs, Span<Matrix> dst)
+  {
+    DoMultiply(MatrixBatchKernelsInternal::GetKernels(kernelSet), lhs, rhs, dst);
+  }
+
+
+  void MatrixBatch::Multiply(const MatrixBatchKernelSet kernelSet, const Matrix& lhs, const ReadOnlySpan<Matrix> rhs, Span<Matrix> dst)
+  {
+    DoMultiply(MatrixBatchKernelsInternal::GetKernels(kernelSet), lhs, rhs, dst);
+  }
+
+
+  void MatrixBatch::Multiply(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Matrix> lhs, const ReadOnlySpan<Matrix> rhs, Span<Matrix> dst)
+  {
+    DoMultiply(MatrixBatchKernelsInternal::GetKernels(kernelSet), lhs, rhs, dst);
+  }
+
+
+  void MatrixBatch::Transpose(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Matrix> src, Span<Matrix> dst)
+  {
+    DoTranspose(MatrixBatchKernelsInternal::GetKernels(kernelSet), src, dst);
+  }
+
+
+  void MatrixBatch::Invert(const MatrixBatchKernelSet kernelSet, const ReadOnlySpan<Matrix> src, Span<Matrix> dst)
+  {
+    DoInvert(MatrixBatchKernelsInternal::GetKernels(kernelSet), src, dst);
+  }
+}
@@ -0,0 +1,155 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/CpuFeatures.hpp>
+#if defined(FSL_CPU_X86)
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace Fsl
+{
+  namespace
+  {
+    struct FeatureRecord
+    {
+      bool SSE41{false};
+      bool AVX2{false};
+      bool F16C{false};
+      bool Neon{false};
+    };
+
+#if defined(FSL_CPU_X86)
+    struct CpuIdResult
+    {
+      uint32_t Eax{0};
+      uint32_t Ebx{0};
+      uint32_t Ecx{0};
+      uint32_t Edx{0};
+    };
+
+    CpuIdResult CpuId(const uint32_t leaf) noexcept
+    {
+      CpuIdResult result;
+#if defined(_MSC_VER)
+      int regs[4]{};
+      __cpuidex(regs, static_cast<int>(leaf), 0);
+      result.Eax = static_cast<uint32_t>(regs[0]);
+      result.Ebx = static_cast<uint32_t>(regs[1]);
+      result.Ecx = static_cast<uint32_t>(regs[2]);
+      result.Edx = static_cast<uint32_t>(regs[3]);
+#else
+      __cpuid_count(leaf, 0, result.Eax, result.Ebx, result.Ecx, result.Edx);
+#endif
+      return result;
+    }
+
+    //! Check that the OS saves the SSE and AVX registers on context switches
+    bool IsAVXStateEnabledByOS() noexcept
+    {
+#if defined(_MSC_VER)
+      const uint64_t xcr0 = _xgetbv(0);
+#else
+      uint32_t eax = 0;
+      uint32_t edx = 0;
+      __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+      const uint64_t xcr0 = (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+      return (xcr0 & 0x6) == 0x6;
+    }
+
+    FeatureRecord DetectFeatures() noexcept
+    {
+      FeatureRecord features;
+      const uint32_t maxLeaf = CpuId(0).Eax;
+      if (maxLeaf < 1)
+      {
+        return features;
+      }
+      const CpuIdResult leaf1 = CpuId(1);
+      features.SSE41 = (leaf1.Ecx & (1u << 19)) != 0u;
+      const bool osxsave = (leaf1.Ecx & (1u << 27)) != 0u;
+      const bool avx = (leaf1.Ecx & (1u << 28)) != 0u;
+      const bool avxUsable = osxsave && avx && IsAVXStateEnabledByOS();
+      features.F16C = avxUsable && (leaf1.Ecx & (1u << 29)) != 0u;
+      if (maxLeaf >= 7)
+      {
+        const CpuIdResult leaf7 = CpuId(7);
+        features.AVX2 = avxUsable && (leaf7.Ebx & (1u << 5)) != 0u;
+      }
+      return features;
+    }
+#else
+    FeatureRecord DetectFeatures() noexcept
+    {
+      FeatureRecord features;
+#if defined(FSL_CPU_ARM64)
+      features.Neon = true;
+#endif
+      return features;
+    }
+#endif
+
+    const FeatureRecord& GetFeatures() noexcept
+    {
+      static const FeatureRecord g_features = DetectFeatures();
+      return g_features;
+    }
+  }
+
+
+  bool CpuFeatures::HasSSE41() noexcept
+  {
+    return GetFeatures().SSE41;
+  }
+
+
+  bool CpuFeatures::HasAVX2() noexcept
+  {
+    return GetFeatures().AVX2;
+  }
+
+
+  bool CpuFeatures::HasF16C() noexcept
+  {
+    return GetFeatures().F16C;
+  }
+
+
+  bool CpuFeatures::HasNeon() noexcept
+  {
+    return GetFeatures().Neon;
+  }
+}
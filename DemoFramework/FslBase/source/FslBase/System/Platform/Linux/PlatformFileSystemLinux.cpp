@@ -32,19 +32,37 @@
 
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/IO/PathDeque.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
 #include <FslBase/System/Platform/PlatformFileSystem.hpp>
 #include <dirent.h>
 #include <fmt/format.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
+#include <limits>
 #include <utility>
+#include <vector>
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#define LOCAL_INOTIFY_SUPPORTED
+#define LOCAL_MMAP_SUPPORTED
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <unordered_map>
+#endif
 
 namespace Fsl::IO
 {
   using SafeStat = struct stat;
   using SafeDirent = struct dirent;
+#ifdef LOCAL_INOTIFY_SUPPORTED
+  using SafeInotifyEvent = struct inotify_event;
+#endif
 
   struct FileData
   {
@@ -82,6 +100,74 @@ namespace Fsl::IO
     }
   };
 
+#ifdef LOCAL_INOTIFY_SUPPORTED
+  class PlatformDirectoryMonitorToken
+  {
+  public:
+    Path FullPath;
+    bool Recursive;
+    int Fd;
+    //! inotify watch descriptor -> directory
+    std::unordered_map<int, Path> WatchToDirectory;
+    std::vector<char> EventBuffer;
+
+    PlatformDirectoryMonitorToken(Path fullPath, const bool recursive)
+      : FullPath(std::move(fullPath))
+      , Recursive(recursive)
+      , Fd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+      , EventBuffer(16 * (sizeof(SafeInotifyEvent) + NAME_MAX + 1))
+    {
+    }
+
+    ~PlatformDirectoryMonitorToken()
+    {
+      if (Fd >= 0)
+      {
+        close(Fd);
+      }
+    }
+
+    PlatformDirectoryMonitorToken(const PlatformDirectoryMonitorToken&) = delete;
+    PlatformDirectoryMonitorToken& operator=(const PlatformDirectoryMonitorToken&) = delete;
+  };
+#else
+  // Directory change notifications are not available on this platform, so this is never instantiated
+  class PlatformDirectoryMonitorToken
+  {
+  };
+#endif
+
+#ifdef LOCAL_MMAP_SUPPORTED
+  class PlatformMemoryMappedFile
+  {
+  public:
+    void* pContent{nullptr};
+    std::size_t ByteSize{0};
+
+    PlatformMemoryMappedFile(void* const pTheContent, const std::size_t byteSize) noexcept
+      : pContent(pTheContent)
+      , ByteSize(byteSize)
+    {
+    }
+
+    ~PlatformMemoryMappedFile()
+    {
+      if (pContent != nullptr)
+      {
+        munmap(pContent, ByteSize);
+      }
+    }
+
+    PlatformMemoryMappedFile(const PlatformMemoryMappedFile&) = delete;
+    PlatformMemoryMappedFile& operator=(const PlatformMemoryMappedFile&) = delete;
+  };
+#else
+  // Memory mapping is not available on this platform, so this is never instantiated
+  class PlatformMemoryMappedFile
+  {
+  };
+#endif
+
 
   namespace
   {
@@ -125,6 +211,135 @@ namespace Fsl::IO
         throw DirectoryNotFoundException(path.ToAsciiString());
       }
     }
+
+#ifdef LOCAL_INOTIFY_SUPPORTED
+    constexpr uint32_t DirectoryWatchMask =
+      IN_CLOSE_WRITE | IN_MODIFY | IN_ATTRIB | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+
+    bool IsDirectory(const Path& parentPath, const SafeDirent& entry)
+    {
+      if (entry.d_type != DT_UNKNOWN)
+      {
+        return entry.d_type == DT_DIR;
+      }
+      // Not all filesystems fill in d_type
+      FileAttributes attr;
+      return PlatformFileSystem::TryGetAttributes(Path::Combine(parentPath, entry.d_name), attr) && attr.HasFlag(FileAttributes::Directory);
+    }
+
+    //! @brief Add a watch for the directory (and its sub directories if the token is recursive).
+    //! @param pExistingFiles if not null all files found in the directories are appended to it
+    //!                       (used for directories that appear while monitoring as their content was never seen)
+    //! @return false if the OS refused to create a watch (typically because the 'max_user_watches' limit was reached).
+    bool TryAddDirectoryWatch(PlatformDirectoryMonitorToken& rToken, const Path& directory, PathDeque* const pExistingFiles)
+    {
+      const int watchDescriptor = inotify_add_watch(rToken.Fd, directory.ToUTF8String().c_str(), DirectoryWatchMask);
+      if (watchDescriptor < 0)
+      {
+        // The directory can legally disappear before we get to add a watch for it
+        const auto error = errno;
+        return error == ENOENT || error == ENOTDIR;
+      }
+      rToken.WatchToDirectory[watchDescriptor] = directory;
+
+      if (!rToken.Recursive && pExistingFiles == nullptr)
+      {
+        return true;
+      }
+
+      // Collect the sub directories before recursing so we never hold more than one directory handle open at a time
+      std::vector<Path> subDirectories;
+      DIR* pDir = opendir(directory.ToUTF8String().c_str());
+      if (pDir == nullptr)
+      {
+        return true;
+      }
+      SafeDirent* pEnt = nullptr;
+      while ((pEnt = readdir(pDir)) != nullptr)
+      {
+        if (std::strcmp(pEnt->d_name, ".") != 0 && std::strcmp(pEnt->d_name, "..") != 0)
+        {
+          if (IsDirectory(directory, *pEnt))
+          {
+            if (rToken.Recursive)
+            {
+              subDirectories.emplace_back(Path::Combine(directory, pEnt->d_name));
+            }
+          }
+          else if (pExistingFiles != nullptr)
+          {
+            pExistingFiles->push_back(std::make_shared<Path>(Path::Combine(directory, pEnt->d_name)));
+          }
+        }
+      }
+      closedir(pDir);
+
+      for (const auto& subDirectory : subDirectories)
+      {
+        if (!TryAddDirectoryWatch(rToken, subDirectory, pExistingFiles))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+
+    void ProcessEvent(PlatformDirectoryMonitorToken& rToken, const SafeInotifyEvent& event, const char* const pszName, PathDeque& rChangedFiles)
+    {
+      if ((event.mask & IN_Q_OVERFLOW) != 0u)
+      {
+        // Events were lost, so we have no idea what changed
+        rChangedFiles.push_back(std::make_shared<Path>(rToken.FullPath));
+        return;
+      }
+
+      auto itr = rToken.WatchToDirectory.find(event.wd);
+      if (itr == rToken.WatchToDirectory.end())
+      {
+        return;
+      }
+      if ((event.mask & IN_IGNORED) != 0u)
+      {
+        rToken.WatchToDirectory.erase(itr);
+        return;
+      }
+      if (event.len == 0u)
+      {
+        // The event is about the watched directory itself
+        if ((event.mask & (IN_DELETE_SELF | IN_MOVE_SELF)) != 0u)
+        {
+          if (itr->second == rToken.FullPath)
+          {
+            rChangedFiles.push_back(std::make_shared<Path>(rToken.FullPath));
+          }
+          else if ((event.mask & IN_MOVE_SELF) != 0u)
+          {
+            // The new location is watched via the IN_MOVED_TO event of its new parent (if it is still inside the monitored tree)
+            inotify_rm_watch(rToken.Fd, event.wd);
+            rToken.WatchToDirectory.erase(itr);
+          }
+        }
+        return;
+      }
+
+      // Take a copy as TryAddDirectoryWatch might modify the map
+      Path fullPath(Path::Combine(itr->second, pszName));
+      if ((event.mask & IN_ISDIR) != 0u)
+      {
+        if (rToken.Recursive && (event.mask & (IN_CREATE | IN_MOVED_TO)) != 0u)
+        {
+          // Files can be created inside the new directory before the watch is added, so report everything inside it
+          if (!TryAddDirectoryWatch(rToken, fullPath, &rChangedFiles))
+          {
+            rChangedFiles.push_back(std::make_shared<Path>(rToken.FullPath));
+          }
+        }
+        return;
+      }
+      rChangedFiles.push_back(std::make_shared<Path>(std::move(fullPath)));
+    }
+#endif
   }
 
 
@@ -182,6 +397,157 @@ namespace Fsl::IO
   }
 
 
+  std::shared_ptr<PlatformDirectoryMonitorToken> PlatformFileSystem::CreateDirectoryMonitorToken(const Path& fullPath,
+                                                                                               const SearchOptions searchOptions)
+  {
+    if (!Path::IsPathRooted(fullPath))
+    {
+      throw std::invalid_argument("path must be rooted");
+    }
+    FileAttributes attr;
+    if (!TryGetAttributes(fullPath, attr) || !attr.HasFlag(FileAttributes::Directory))
+    {
+      throw DirectoryNotFoundException(fullPath.ToAsciiString());
+    }
+
+#ifdef LOCAL_INOTIFY_SUPPORTED
+    bool recursive = false;
+    switch (searchOptions)
+    {
+    case SearchOptions::TopDirectoryOnly:
+      break;
+    case SearchOptions::AllDirectories:
+      recursive = true;
+      break;
+    default:
+      throw NotSupportedException("Unknown search option");
+    }
+
+    auto result = std::make_shared<PlatformDirectoryMonitorToken>(fullPath, recursive);
+    if (result->Fd < 0 || !TryAddDirectoryWatch(*result, fullPath, nullptr))
+    {
+      return {};
+    }
+    return result;
+#else
+    FSL_PARAM_NOT_USED(searchOptions);
+    return {};
+#endif
+  }
+
+
+  bool PlatformFileSystem::WaitForDirectoryChanges(const std::shared_ptr<PlatformDirectoryMonitorToken>& token, PathDeque& rChangedFiles,
+                                                   const std::chrono::milliseconds timeout)
+  {
+    if (!token)
+    {
+      throw std::invalid_argument("token can not be null");
+    }
+#ifdef LOCAL_INOTIFY_SUPPORTED
+    pollfd pollEntry{token->Fd, POLLIN, 0};
+    const auto timeoutMs = static_cast<int>(std::clamp(timeout.count(), static_cast<std::chrono::milliseconds::rep>(0),
+                                                       static_cast<std::chrono::milliseconds::rep>(std::numeric_limits<int>::max())));
+    const int pollResult = poll(&pollEntry, 1, timeoutMs);
+    if (pollResult <= 0)
+    {
+      if (pollResult < 0 && errno != EINTR)
+      {
+        throw IOException("Failed to wait for directory changes");
+      }
+      return false;
+    }
+
+    const auto oldSize = rChangedFiles.size();
+    auto& rBuffer = token->EventBuffer;
+    // The fd is non blocking, so we just drain everything that is queued
+    ssize_t bytesRead = 0;
+    while ((bytesRead = read(token->Fd, rBuffer.data(), rBuffer.size())) > 0)
+    {
+      std::size_t offset = 0;
+      while (offset < static_cast<std::size_t>(bytesRead))
+      {
+        SafeInotifyEvent event{};
+        std::memcpy(&event, rBuffer.data() + offset, sizeof(SafeInotifyEvent));
+        // The name is stored right after the fixed size part of the event and it is zero terminated (and padded)
+        ProcessEvent(*token, event, rBuffer.data() + offset + sizeof(SafeInotifyEvent), rChangedFiles);
+        offset += sizeof(SafeInotifyEvent) + event.len;
+      }
+    }
+    return rChangedFiles.size() != oldSize;
+#else
+    FSL_PARAM_NOT_USED(rChangedFiles);
+    FSL_PARAM_NOT_USED(timeout);
+    throw NotSupportedException("WaitForDirectoryChanges not supported");
+#endif
+  }
+
+
+  std::shared_ptr<PlatformMemoryMappedFile> PlatformFileSystem::TryMapFile(const Path& path)
+  {
+#ifdef LOCAL_MMAP_SUPPORTED
+    const auto& strPath = path.ToUTF8String();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    const int fd = open(strPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+      throw IOException(fmt::format("Failed to open file: '{}'", strPath));
+    }
+
+    SafeStat s{};
+    if (fstat(fd, &s) != 0 || !S_ISREG(s.st_mode))
+    {
+      close(fd);
+      throw IOException(fmt::format("Failed to query file: '{}'", strPath));
+    }
+
+    const auto byteSize = static_cast<std::size_t>(s.st_size);
+    if (byteSize == 0u)
+    {
+      // Its not possible to map a empty file
+      close(fd);
+      return std::make_shared<PlatformMemoryMappedFile>(nullptr, 0u);
+    }
+
+    void* pContent = mmap(nullptr, byteSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file
+    close(fd);
+    if (pContent == MAP_FAILED)
+    {
+      throw IOException(fmt::format("Failed to map file: '{}'", strPath));
+    }
+    // The content is normally consumed front to back, so let the kernel read ahead aggressively.
+    // The advice values are not flags so they are given one at a time, both are hints so a failure is not fatal.
+    {
+      const int resSequential = madvise(pContent, byteSize, MADV_SEQUENTIAL);
+      FSLLOG3_DEBUG_WARNING_IF(resSequential != 0, "madvise MADV_SEQUENTIAL failed for '{}' errno: {}", strPath, errno);
+      const int resWillNeed = madvise(pContent, byteSize, MADV_WILLNEED);
+      FSLLOG3_DEBUG_WARNING_IF(resWillNeed != 0, "madvise MADV_WILLNEED failed for '{}' errno: {}", strPath, errno);
+      FSL_PARAM_NOT_USED(resSequential);
+      FSL_PARAM_NOT_USED(resWillNeed);
+    }
+    return std::make_shared<PlatformMemoryMappedFile>(pContent, byteSize);
+#else
+    FSL_PARAM_NOT_USED(path);
+    // Not supported, so the caller should fall back to reading the file
+    return {};
+#endif
+  }
+
+
+  ReadOnlySpan<uint8_t> PlatformFileSystem::GetMappedContent(const std::shared_ptr<PlatformMemoryMappedFile>& mapping)
+  {
+    if (!mapping)
+    {
+      throw std::invalid_argument("mapping can not be null");
+    }
+#ifdef LOCAL_MMAP_SUPPORTED
+    return ReadOnlySpan<uint8_t>(static_cast<const uint8_t*>(mapping->pContent), mapping->ByteSize);
+#else
+    throw NotSupportedException("GetMappedContent not supported");
+#endif
+  }
+
+
   void PlatformFileSystem::GetFiles(PathDeque& rResult, const Path& path, const SearchOptions searchOptions)
   {
     rResult.clear();
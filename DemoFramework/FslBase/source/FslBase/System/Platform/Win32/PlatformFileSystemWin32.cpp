@@ -78,6 +78,16 @@ namespace Fsl::IO
     }
   };
 
+  // Directory change notifications are not implemented on this platform (yet), so this is never instantiated
+  class PlatformDirectoryMonitorToken
+  {
+  };
+
+  // Memory mapping is not implemented on this platform (yet), so this is never instantiated
+  class PlatformMemoryMappedFile
+  {
+  };
+
   namespace
   {
     void ExtractData(FileData& rData, const Path& fullPath)
@@ -180,6 +190,46 @@ namespace Fsl::IO
   }
 
 
+  std::shared_ptr<PlatformDirectoryMonitorToken> PlatformFileSystem::CreateDirectoryMonitorToken(const Path& fullPath,
+                                                                                               const SearchOptions /*searchOptions*/)
+  {
+    if (!Path::IsPathRooted(fullPath))
+    {
+      throw std::invalid_argument("path must be rooted");
+    }
+    // Not supported, so the caller should fall back to CreatePathMonitorToken
+    return {};
+  }
+
+
+  bool PlatformFileSystem::WaitForDirectoryChanges(const std::shared_ptr<PlatformDirectoryMonitorToken>& token, PathDeque& /*rChangedFiles*/,
+                                                   const std::chrono::milliseconds /*timeout*/)
+  {
+    if (!token)
+    {
+      throw std::invalid_argument("token can not be null");
+    }
+    throw NotSupportedException("WaitForDirectoryChanges not supported");
+  }
+
+
+  std::shared_ptr<PlatformMemoryMappedFile> PlatformFileSystem::TryMapFile(const Path& /*path*/)
+  {
+    // Not supported, so the caller should fall back to reading the file
+    return {};
+  }
+
+
+  ReadOnlySpan<uint8_t> PlatformFileSystem::GetMappedContent(const std::shared_ptr<PlatformMemoryMappedFile>& mapping)
+  {
+    if (!mapping)
+    {
+      throw std::invalid_argument("mapping can not be null");
+    }
+    throw NotSupportedException("GetMappedContent not supported");
+  }
+
+
   void PlatformFileSystem::GetFiles(PathDeque& rResult, const Path& path, const SearchOptions searchOptions)
   {
     rResult.clear();
@@ -0,0 +1,421 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <utility>
+
+namespace Fsl
+{
+  class JobRecord
+  {
+  public:
+    std::function<void()> Work;
+    //! Starts at one to guard the job while its dependencies are being registered
+    std::atomic<uint32_t> PendingDependencies{1};
+    std::atomic<bool> Completed{false};
+    std::atomic<uint32_t> WaiterCount{0};
+    std::exception_ptr Exception;
+
+    std::mutex ContinuationLock;
+    //! Guarded by ContinuationLock
+    bool ContinuationsReleased{false};
+    //! Guarded by ContinuationLock
+    std::vector<std::shared_ptr<JobRecord>> Continuations;
+
+    explicit JobRecord(std::function<void()> work)
+      : Work(std::move(work))
+    {
+    }
+  };
+
+  struct JobSystem::WorkerQueue
+  {
+    std::mutex Lock;
+    std::deque<std::shared_ptr<JobRecord>> Jobs;
+  };
+
+  namespace
+  {
+    struct CurrentWorker
+    {
+      const JobSystem* pOwner{nullptr};
+      uint32_t QueueIndex{0};
+    };
+
+    thread_local CurrentWorker g_currentWorker;
+  }
+
+
+  bool JobHandle::IsCompleted() const noexcept
+  {
+    return m_record && m_record->Completed.load();
+  }
+
+
+  JobSystem::JobSystem()
+    : JobSystem(GetDefaultWorkerThreadCount())
+  {
+  }
+
+
+  JobSystem::JobSystem(const uint32_t workerThreadCount)
+  {
+    const uint32_t threadCount = std::max(workerThreadCount, 1u);
+    // One queue per worker + the shared queue used by all other threads
+    m_queues.reserve(threadCount + 1u);
+    for (uint32_t i = 0; i <= threadCount; ++i)
+    {
+      m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    m_threads.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; ++i)
+    {
+      m_threads.emplace_back([this, i]() { WorkerMain(i); });
+    }
+  }
+
+
+  JobSystem::~JobSystem() noexcept
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_sleepLock);
+      m_stop = true;
+    }
+    m_wakeCondition.notify_all();
+    for (auto& rThread : m_threads)
+    {
+      rThread.join();
+    }
+  }
+
+
+  uint32_t JobSystem::GetDefaultWorkerThreadCount() noexcept
+  {
+    const uint32_t hardwareConcurrency = std::thread::hardware_concurrency();
+    return hardwareConcurrency > 2u ? hardwareConcurrency - 1u : 1u;
+  }
+
+
+  JobHandle JobSystem::Schedule(std::function<void()> job)
+  {
+    return Schedule(std::move(job), {});
+  }
+
+
+  JobHandle JobSystem::Schedule(std::function<void()> job, const ReadOnlySpan<JobHandle> dependencies)
+  {
+    if (!job)
+    {
+      throw std::invalid_argument("job can not be empty");
+    }
+    for (const JobHandle& dependency : dependencies)
+    {
+      if (!dependency.IsValid())
+      {
+        throw std::invalid_argument("dependencies must be valid");
+      }
+    }
+
+    auto record = std::make_shared<JobRecord>(std::move(job));
+    for (const JobHandle& dependency : dependencies)
+    {
+      JobRecord& rDependency = *dependency.m_record;
+      std::lock_guard<std::mutex> lock(rDependency.ContinuationLock);
+      if (!rDependency.ContinuationsReleased)
+      {
+        record->PendingDependencies.fetch_add(1u);
+        rDependency.Continuations.push_back(record);
+      }
+    }
+    // Release the scheduling guard
+    ReleaseDependency(record);
+    return JobHandle(std::move(record));
+  }
+
+
+  JobHandle JobSystem::ContinueWith(const JobHandle& job, std::function<void()> continuation)
+  {
+    return Schedule(std::move(continuation), ReadOnlySpan<JobHandle>(&job, 1u));
+  }
+
+
+  void JobSystem::Wait(const JobHandle& job)
+  {
+    if (!job.IsValid())
+    {
+      throw std::invalid_argument("job must be valid");
+    }
+    JobRecord& rRecord = *job.m_record;
+    rRecord.WaiterCount.fetch_add(1u);
+    while (!rRecord.Completed.load())
+    {
+      if (!TryExecuteOne())
+      {
+        std::unique_lock<std::mutex> lock(m_sleepLock);
+        m_wakeCondition.wait(lock, [this, &rRecord]() { return rRecord.Completed.load() || m_queuedJobCount.load() > 0u; });
+      }
+    }
+    rRecord.WaiterCount.fetch_sub(1u);
+    if (rRecord.Exception)
+    {
+      std::rethrow_exception(rRecord.Exception);
+    }
+  }
+
+
+  void JobSystem::WaitAll(const ReadOnlySpan<JobHandle> jobs)
+  {
+    std::exception_ptr firstException;
+    for (const JobHandle& job : jobs)
+    {
+      try
+      {
+        Wait(job);
+      }
+      catch (...)
+      {
+        if (!firstException)
+        {
+          firstException = std::current_exception();
+        }
+      }
+    }
+    if (firstException)
+    {
+      std::rethrow_exception(firstException);
+    }
+  }
+
+
+  void JobSystem::ParallelFor(const std::size_t count, const std::size_t grainSize, const std::function<void(std::size_t, std::size_t)>& fnRange)
+  {
+    if (count <= 0u)
+    {
+      return;
+    }
+    const std::size_t chunkSize = std::max(grainSize, static_cast<std::size_t>(1u));
+    const std::size_t chunkCount = ((count - 1u) / chunkSize) + 1u;
+    if (chunkCount <= 1u)
+    {
+      fnRange(0u, count);
+      return;
+    }
+
+    // The chunks are handed out through a shared counter so the helpers that get scheduled early naturally take more of the work
+    std::atomic<std::size_t> nextChunk{0u};
+    auto processChunks = [&nextChunk, chunkCount, chunkSize, count, &fnRange]()
+    {
+      std::size_t chunkIndex = nextChunk.fetch_add(1u);
+      while (chunkIndex < chunkCount)
+      {
+        const std::size_t begin = chunkIndex * chunkSize;
+        try
+        {
+          fnRange(begin, std::min(begin + chunkSize, count));
+        }
+        catch (...)
+        {
+          // Prevent any further chunks from being started
+          nextChunk.store(chunkCount);
+          throw;
+        }
+        chunkIndex = nextChunk.fetch_add(1u);
+      }
+    };
+
+    const std::size_t helperCount = std::min(chunkCount - 1u, static_cast<std::size_t>(m_threads.size()));
+    std::vector<JobHandle> helpers;
+    helpers.reserve(helperCount);
+    std::exception_ptr callerException;
+    try
+    {
+      for (std::size_t i = 0; i < helperCount; ++i)
+      {
+        helpers.push_back(Schedule(processChunks));
+      }
+      processChunks();
+    }
+    catch (...)
+    {
+      nextChunk.store(chunkCount);
+      callerException = std::current_exception();
+    }
+    // The helpers reference the local state, so we must always wait for them before returning
+    try
+    {
+      WaitAll(ReadOnlySpan<JobHandle>(helpers.data(), helpers.size()));
+    }
+    catch (...)
+    {
+      if (!callerException)
+      {
+        callerException = std::current_exception();
+      }
+    }
+    if (callerException)
+    {
+      std::rethrow_exception(callerException);
+    }
+  }
+
+
+  void JobSystem::WorkerMain(const uint32_t workerIndex)
+  {
+    g_currentWorker.pOwner = this;
+    g_currentWorker.QueueIndex = workerIndex;
+    while (true)
+    {
+      if (!TryExecuteOne())
+      {
+        std::unique_lock<std::mutex> lock(m_sleepLock);
+        m_wakeCondition.wait(lock, [this]() { return m_stop || m_queuedJobCount.load() > 0u; });
+        if (m_stop && m_queuedJobCount.load() <= 0u)
+        {
+          break;
+        }
+      }
+    }
+    g_currentWorker = {};
+  }
+
+
+  uint32_t JobSystem::GetQueueIndex() const noexcept
+  {
+    // Threads that are not owned by this job system use the shared queue which is placed last
+    return g_currentWorker.pOwner == this ? g_currentWorker.QueueIndex : static_cast<uint32_t>(m_threads.size());
+  }
+
+
+  void JobSystem::Enqueue(std::shared_ptr<JobRecord> record)
+  {
+    {
+      WorkerQueue& rQueue = *m_queues[GetQueueIndex()];
+      std::lock_guard<std::mutex> lock(rQueue.Lock);
+      rQueue.Jobs.push_back(std::move(record));
+    }
+    {
+      std::lock_guard<std::mutex> lock(m_sleepLock);
+      m_queuedJobCount.fetch_add(1u);
+    }
+    m_wakeCondition.notify_one();
+  }
+
+
+  bool JobSystem::TryExecuteOne()
+  {
+    const auto queueCount = static_cast<uint32_t>(m_queues.size());
+    const uint32_t ownQueueIndex = GetQueueIndex();
+    for (uint32_t i = 0; i < queueCount; ++i)
+    {
+      // Start with our own queue and then steal from the following ones, so the thieves spread out
+      const uint32_t queueIndex = (ownQueueIndex + i) % queueCount;
+      std::shared_ptr<JobRecord> record = TryDequeue(queueIndex);
+      if (record)
+      {
+        Execute(record);
+        return true;
+      }
+    }
+    return false;
+  }
+
+
+  std::shared_ptr<JobRecord> JobSystem::TryDequeue(const uint32_t queueIndex)
+  {
+    WorkerQueue& rQueue = *m_queues[queueIndex];
+    std::lock_guard<std::mutex> lock(rQueue.Lock);
+    if (rQueue.Jobs.empty())
+    {
+      return {};
+    }
+    std::shared_ptr<JobRecord> record;
+    // A worker takes the most recently scheduled job from its own queue (as its data is most likely cached) everybody else takes the oldest
+    if (queueIndex == g_currentWorker.QueueIndex && g_currentWorker.pOwner == this)
+    {
+      record = std::move(rQueue.Jobs.back());
+      rQueue.Jobs.pop_back();
+    }
+    else
+    {
+      record = std::move(rQueue.Jobs.front());
+      rQueue.Jobs.pop_front();
+    }
+    m_queuedJobCount.fetch_sub(1u);
+    return record;
+  }
+
+
+  void JobSystem::Execute(const std::shared_ptr<JobRecord>& record)
+  {
+    try
+    {
+      record->Work();
+    }
+    catch (...)
+    {
+      record->Exception = std::current_exception();
+    }
+    // Release anything captured by the job as soon as possible
+    record->Work = {};
+
+    std::vector<std::shared_ptr<JobRecord>> continuations;
+    {
+      std::lock_guard<std::mutex> lock(record->ContinuationLock);
+      record->ContinuationsReleased = true;
+      std::swap(continuations, record->Continuations);
+    }
+    record->Completed.store(true);
+    if (record->WaiterCount.load() > 0u)
+    {
+      {    // Ensure that the waiter either sees the completed flag or is already waiting for the notification
+        std::lock_guard<std::mutex> lock(m_sleepLock);
+      }
+      m_wakeCondition.notify_all();
+    }
+    for (const auto& continuation : continuations)
+    {
+      ReleaseDependency(continuation);
+    }
+  }
+
+
+  void JobSystem::ReleaseDependency(const std::shared_ptr<JobRecord>& record)
+  {
+    if (record->PendingDependencies.fetch_sub(1u) == 1u)
+    {
+      Enqueue(record);
+    }
+  }
+}
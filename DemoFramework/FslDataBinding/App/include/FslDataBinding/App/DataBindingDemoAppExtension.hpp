@@ -52,6 +52,7 @@ namespace Fsl
     const std::shared_ptr<DataBinding::DataBindingService>& GetDataBinding() const;
     std::shared_ptr<DataBinding::DataBindingService> GetDataBinding();
 
+    bool SupportsPipelinedUpdate() const override;
     void OnKeyEvent(const KeyEvent& event) override;
     void OnMouseButtonEvent(const MouseButtonEvent& event) override;
     void OnMouseMoveEvent(const MouseMoveEvent& event) override;
@@ -66,6 +67,7 @@ namespace Fsl
     void Update(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) override;
     void PostUpdate(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) override;
     void Resolve(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) override;
+    void SwapFrameState(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) override;
     void OnDrawSkipped(const DemoAppExtensionCallOrder callOrder, const FrameInfo& frameInfo) override;
     void End(const DemoAppExtensionCallOrder callOrder) override;
   };
@@ -57,6 +57,12 @@ namespace Fsl
   }
 
 
+  bool DataBindingDemoAppExtension::SupportsPipelinedUpdate() const
+  {
+    // The data binding service is not thread safe
+    return false;
+  }
+
   void DataBindingDemoAppExtension::OnKeyEvent(const KeyEvent& event)
   {
     FSL_PARAM_NOT_USED(event);
@@ -150,6 +156,12 @@ namespace Fsl
     }
   }
 
+  void DataBindingDemoAppExtension::SwapFrameState(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime)
+  {
+    FSL_PARAM_NOT_USED(callOrder);
+    FSL_PARAM_NOT_USED(demoTime);
+  }
+
   void DataBindingDemoAppExtension::OnDrawSkipped(const DemoAppExtensionCallOrder callOrder, const FrameInfo& frameInfo)
   {
     FSL_PARAM_NOT_USED(frameInfo);
@@ -0,0 +1,164 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <memory>
+#include "UTDependencyObject.hpp"
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_ExecuteChanges = TestFixtureFslBase;
+}
+
+
+TEST(Test_ExecuteChanges, RepeatedChangesAreCoalesced)
+{
+  auto dataBindingService = std::make_shared<DataBinding::DataBindingService>();
+
+  UTDependencyObject s0(dataBindingService);
+  UTDependencyObject s1(dataBindingService);
+  UTDependencyObject t0(dataBindingService);
+  UTDependencyObject t1(dataBindingService);
+
+  t0.SetBinding(UTDependencyObject::Property0, s0.GetPropertyHandle(UTDependencyObject::Property0));
+  t1.SetBinding(UTDependencyObject::Property0, s1.GetPropertyHandle(UTDependencyObject::Property0));
+  dataBindingService->ExecuteChanges();
+  EXPECT_EQ(0u, dataBindingService->PendingChanges());
+
+  // Interleave the changes so the pending entries keep being moved (and the pending change list gets compacted)
+  constexpr uint32_t ChangeCount = 500;
+  for (uint32_t i = 1; i <= ChangeCount; ++i)
+  {
+    s0.SetProperty0Value(i);
+    s1.SetProperty0Value(i * 2);
+    EXPECT_EQ(2u, dataBindingService->PendingChanges());
+  }
+
+  dataBindingService->ExecuteChanges();
+
+  EXPECT_EQ(0u, dataBindingService->PendingChanges());
+  EXPECT_EQ(ChangeCount, t0.GetProperty0Value());
+  EXPECT_EQ(ChangeCount * 2, t1.GetProperty0Value());
+}
+
+
+TEST(Test_ExecuteChanges, TwoWay_LastChangeWinsAcrossExecutes)
+{
+  auto dataBindingService = std::make_shared<DataBinding::DataBindingService>();
+
+  UTDependencyObject t0(dataBindingService);
+  UTDependencyObject t1(dataBindingService);
+  UTDependencyObject t2(dataBindingService);
+
+  t1.SetBinding(UTDependencyObject::Property0, t0.GetPropertyHandle(UTDependencyObject::Property0), DataBinding::BindingMode::TwoWay);
+  t2.SetBinding(UTDependencyObject::Property0, t0.GetPropertyHandle(UTDependencyObject::Property0), DataBinding::BindingMode::TwoWay);
+  dataBindingService->ExecuteChanges();
+
+  // The group is reused between the executes, but the last change inside the group must still win
+  t1.SetProperty0Value(10);
+  t2.SetProperty0Value(20);
+  dataBindingService->ExecuteChanges();
+  EXPECT_EQ(20u, t0.GetProperty0Value());
+  EXPECT_EQ(20u, t1.GetProperty0Value());
+  EXPECT_EQ(20u, t2.GetProperty0Value());
+
+  t2.SetProperty0Value(30);
+  t1.SetProperty0Value(40);
+  dataBindingService->ExecuteChanges();
+  EXPECT_EQ(40u, t0.GetProperty0Value());
+  EXPECT_EQ(40u, t1.GetProperty0Value());
+  EXPECT_EQ(40u, t2.GetProperty0Value());
+}
+
+
+TEST(Test_ExecuteChanges, TwoWay_GroupRebuiltAfterClearBinding)
+{
+  auto dataBindingService = std::make_shared<DataBinding::DataBindingService>();
+
+  UTDependencyObject t0(dataBindingService);
+  UTDependencyObject t1(dataBindingService);
+  UTDependencyObject t2(dataBindingService);
+
+  t1.SetBinding(UTDependencyObject::Property0, t0.GetPropertyHandle(UTDependencyObject::Property0), DataBinding::BindingMode::TwoWay);
+  t2.SetBinding(UTDependencyObject::Property0, t0.GetPropertyHandle(UTDependencyObject::Property0), DataBinding::BindingMode::TwoWay);
+  t1.SetProperty0Value(10);
+  dataBindingService->ExecuteChanges();
+  EXPECT_EQ(10u, t2.GetProperty0Value());
+
+  // t1 leaves the group
+  t1.ClearBinding(UTDependencyObject::Property0);
+  t1.SetProperty0Value(20);
+  t2.SetProperty0Value(30);
+  dataBindingService->ExecuteChanges();
+  EXPECT_EQ(30u, t0.GetProperty0Value());
+  EXPECT_EQ(20u, t1.GetProperty0Value());
+  EXPECT_EQ(30u, t2.GetProperty0Value());
+
+  // t1 joins the group again
+  t1.SetBinding(UTDependencyObject::Property0, t0.GetPropertyHandle(UTDependencyObject::Property0), DataBinding::BindingMode::TwoWay);
+  dataBindingService->ExecuteChanges();
+  t2.SetProperty0Value(50);
+  t1.SetProperty0Value(40);
+  dataBindingService->ExecuteChanges();
+  EXPECT_EQ(40u, t0.GetProperty0Value());
+  EXPECT_EQ(40u, t1.GetProperty0Value());
+  EXPECT_EQ(40u, t2.GetProperty0Value());
+}
+
+
+TEST(Test_ExecuteChanges, TwoWay_GroupRebuiltAfterDestroy)
+{
+  auto dataBindingService = std::make_shared<DataBinding::DataBindingService>();
+
+  UTDependencyObject t0(dataBindingService);
+  UTDependencyObject t1(dataBindingService);
+
+  t1.SetBinding(UTDependencyObject::Property0, t0.GetPropertyHandle(UTDependencyObject::Property0), DataBinding::BindingMode::TwoWay);
+  {
+    UTDependencyObject t2(dataBindingService);
+    t2.SetBinding(UTDependencyObject::Property0, t0.GetPropertyHandle(UTDependencyObject::Property0), DataBinding::BindingMode::TwoWay);
+    t2.SetProperty0Value(10);
+    dataBindingService->ExecuteChanges();
+    EXPECT_EQ(10u, t1.GetProperty0Value());
+  }
+  // The handles of the destroyed object can be reused by the new object
+  UTDependencyObject t3(dataBindingService);
+  t3.SetProperty0Value(20);
+  t1.SetProperty0Value(30);
+  dataBindingService->ExecuteChanges();
+
+  EXPECT_EQ(30u, t0.GetProperty0Value());
+  EXPECT_EQ(30u, t1.GetProperty0Value());
+  EXPECT_EQ(20u, t3.GetProperty0Value());
+}
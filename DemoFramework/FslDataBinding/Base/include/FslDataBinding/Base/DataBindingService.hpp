@@ -162,7 +162,10 @@ namespace Fsl::DataBinding
     HandleVector<Internal::ServiceBindingRecord> m_instances;
     // We ensure that this vector can always hold m_instances.Count entries (so the schedule of a destroy will never fail)
     std::vector<DataBindingInstanceHandle> m_scheduledForDestroy;
+    //! Coalesced changes are re-pushed instead of moved, so this can contain stale entries (see ServiceBindingRecord::PendingChangeSlot)
     std::vector<DataBindingInstanceHandle> m_pendingChanges;
+    //! The number of live entries in m_pendingChanges
+    std::size_t m_pendingChangeCount{0};
     std::queue<DataBindingInstanceHandle> m_changesOneWay;
     std::queue<DataBindingInstanceHandle> m_changesTwoWay;
     std::queue<ObserverRecord> m_pendingObserverCallbacks;
@@ -184,7 +187,7 @@ namespace Fsl::DataBinding
 
     std::size_t PendingChanges() const noexcept
     {
-      return m_pendingChanges.size();
+      return m_pendingChangeCount;
     }
 
     std::size_t PendingDestroys() const noexcept
@@ -244,6 +247,9 @@ namespace Fsl::DataBinding
                                                                const DataBindingInstanceType propertyType,
                                                                const Internal::InstanceState::Flags flags);
 
+    void PushPendingChange(const DataBindingInstanceHandle hChangedInstance, Internal::ServiceBindingRecord& rChangedInstance);
+    void MovePendingChangeToBack(const DataBindingInstanceHandle hChangedInstance, Internal::ServiceBindingRecord& rChangedInstance);
+    void CompactPendingChanges() noexcept;
     void DeterminePendingChanges();
     void DeterminePendingChange(const DataBindingInstanceHandle hChangedInstance, Internal::ServiceBindingRecord& rChangedInstance);
     void ScheduleTwoWayChanges();
@@ -74,6 +74,9 @@ namespace Fsl::DataBinding::Internal
 
   public:
     Internal::InstanceState Instance;
+    //! One based index of the live entry in the services pending change list (zero means that no entry exist).
+    //! Placed next to Instance to use its padding
+    uint32_t PendingChangeSlot{0};
     // It's still public for erase atm
     TightHostedVector<DataBindingInstanceHandle, 3> SysHandles;
     std::unique_ptr<Internal::IPropertyMethods> Methods;
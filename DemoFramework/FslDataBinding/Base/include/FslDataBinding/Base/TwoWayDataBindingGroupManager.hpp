@@ -36,25 +36,33 @@
 #include <FslDataBinding/Base/DataBindingInstanceHandle.hpp>
 #include <FslDataBinding/Base/PropertyChangeReason.hpp>
 #include <unordered_map>
+#include <vector>
 
 namespace Fsl::DataBinding
 {
+  //! @brief Tracks the two-way binding groups (the connected components of two-way bound instances).
+  //!        The groups are cached between change passes and only need to be rebuilt once the binding graph is modified.
   class TwoWayDataBindingGroupManager final
   {
     struct GroupRecord
     {
       DataBindingInstanceHandle ChangedInstanceHandle;
       PropertyChangeReason Reason{PropertyChangeReason::Refresh};
+      //! Set if the group has been changed during the current change pass
+      bool IsActive{false};
 
       GroupRecord() = default;
-      GroupRecord(const DataBindingInstanceHandle hChangedInstanceHandle, const PropertyChangeReason reason)
+      GroupRecord(const DataBindingInstanceHandle hChangedInstanceHandle, const PropertyChangeReason reason, const bool isActive)
         : ChangedInstanceHandle(hChangedInstanceHandle)
         , Reason(reason)
+        , IsActive(isActive)
       {
       }
     };
 
     HandleVector<GroupRecord> m_groups;
+    //! The groups changed during the current change pass in the order they were first changed
+    std::vector<DataBindingGroupInstanceHandle> m_activeGroups;
 
     std::unordered_map<uint32_t, DataBindingGroupInstanceHandle> m_instanceToGroupMap;
 
@@ -65,21 +73,38 @@ namespace Fsl::DataBinding
       return itrFind != m_instanceToGroupMap.end() ? itrFind->second : DataBindingGroupInstanceHandle();
     }
 
+    //! @brief Create a new group and mark it as active
     DataBindingGroupInstanceHandle CreateGroup(const DataBindingInstanceHandle hChangedInstanceHandle, const PropertyChangeReason reason);
+
+    //! @brief Mark a cached group as active.
+    //! @return true if the group was activated, false if it was already active (and therefore left untouched)
+    bool TryActivateGroup(const DataBindingGroupInstanceHandle hGroup, const DataBindingInstanceHandle hChangedInstanceHandle,
+                          const PropertyChangeReason reason);
     void UncheckedSetGroupInfo(const DataBindingGroupInstanceHandle hGroup, const DataBindingInstanceHandle hChangedInstanceHandle,
                                const PropertyChangeReason reason);
     void AddToGroup(const DataBindingGroupInstanceHandle hGroup, const DataBindingInstanceHandle hInstance);
     bool TryAddToGroup(const DataBindingGroupInstanceHandle hGroup, const DataBindingInstanceHandle hInstance);
-    void ClearGroups();
+
+    //! @brief Deactivate all active groups, the cached groups are kept.
+    void ClearActiveGroups() noexcept;
+
+    //! @brief Remove all groups. This must be called whenever the binding graph is modified.
+    void ClearGroups() noexcept;
 
     uint32_t GroupCount() const noexcept
     {
       return m_groups.Count();
     }
 
-    DataBindingInstanceHandle operator[](const uint32_t index) const noexcept
+    uint32_t ActiveGroupCount() const noexcept
+    {
+      return static_cast<uint32_t>(m_activeGroups.size());
+    }
+
+    //! @brief Get the last changed instance of the active group at the given index
+    DataBindingInstanceHandle operator[](const uint32_t activeIndex) const noexcept
     {
-      return m_groups[index].ChangedInstanceHandle;
+      return m_groups.FastGet(m_activeGroups[activeIndex].Value).ChangedInstanceHandle;
     }
   };
 }
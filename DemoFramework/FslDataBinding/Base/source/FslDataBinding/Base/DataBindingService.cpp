@@ -74,6 +74,8 @@ namespace Fsl::DataBinding
     namespace LocalConfig
     {
       constexpr uint32_t MaxExecuteLoopCount = 1024;
+      //! The pending change list is compacted once it contains this many more stale entries than live ones
+      constexpr std::size_t MinPendingChangeCompactCount = 64;
     }
 
     struct HandleArrayVector
@@ -752,6 +754,8 @@ namespace Fsl::DataBinding
     {
       throw DeadInstanceException("hSource must be alive");
     }
+    // The binding graph is being modified so the cached two-way groups are no longer valid
+    m_groupManager.ClearGroups();
     return ClearSourceBindings(m_instances, hTarget);
   }
 
@@ -854,6 +858,7 @@ namespace Fsl::DataBinding
     }
     catch (const std::exception&)
     {
+      m_groupManager.ClearGroups();
       ClearSourceBindings(m_instances, hTarget);
       LOCAL_DO_SANITY_CHECK();
       throw;
@@ -862,6 +867,8 @@ namespace Fsl::DataBinding
     const bool changed = IsSourceBindingsBeingChanged(m_instances, hTarget, binding);
     if (changed)
     {
+      // The binding graph is being modified so the cached two-way groups are no longer valid
+      m_groupManager.ClearGroups();
       // the binding was changed, so delete the old binding (if it exist)
       ClearSourceBindings(m_instances, hTarget);
     }
@@ -962,28 +969,22 @@ namespace Fsl::DataBinding
       {    // Untouched instance, so just mark it with the reason and push a instance changed entry
         rChangedInstance.Instance.SetPropertyChangeState(Internal::PropertyChangeStateUtil::UncheckedToPropertyChangeState(changeReason));
         // The instance can not exist already as any 'pushed' entries are marked with a different PropertyChangeState
-        assert(std::find(m_pendingChanges.begin(), m_pendingChanges.end(), hChangedInstance) == m_pendingChanges.end());
-        m_pendingChanges.push_back(hChangedInstance);
+        assert(rChangedInstance.PendingChangeSlot == 0u);
+        PushPendingChange(hChangedInstance, rChangedInstance);
+        ++m_pendingChangeCount;
       }
       else if (instanceChangeState == Internal::PropertyChangeState::Refresh && changeReason == PropertyChangeReason::Refresh)
       {    // the instance is marked as a refresh change and the new change is also a refresh request, so just remove the initial queued entry and
            // insert a new one
         assert(instanceChangeState == Internal::PropertyChangeState::Refresh);
-        // Replace the 'refresh' request with a more serious modify request
-        auto itrFind = std::find(m_pendingChanges.begin(), m_pendingChanges.end(), hChangedInstance);
-        assert(itrFind != m_pendingChanges.end());
-        m_pendingChanges.erase(itrFind);
-        m_pendingChanges.push_back(hChangedInstance);
+        MovePendingChangeToBack(hChangedInstance, rChangedInstance);
       }
       else if (changeReason == PropertyChangeReason::Modified)
       {    // as its a modify we just replace any existing entry with the new state
         assert(instanceChangeState == Internal::PropertyChangeState::Refresh || instanceChangeState == Internal::PropertyChangeState::Modified);
         // Replace the 'refresh' request with a more serious modify request
-        auto itrFind = std::find(m_pendingChanges.begin(), m_pendingChanges.end(), hChangedInstance);
-        assert(itrFind != m_pendingChanges.end());
-        m_pendingChanges.erase(itrFind);
+        MovePendingChangeToBack(hChangedInstance, rChangedInstance);
         rChangedInstance.Instance.SetPropertyChangeState(Internal::PropertyChangeState::Modified);
-        m_pendingChanges.push_back(hChangedInstance);
       }
     }
     // the new design always allow the local changes and rely on the 'ExecuteChanges' to correct it
@@ -991,6 +992,51 @@ namespace Fsl::DataBinding
   }
 
 
+  void DataBindingService::PushPendingChange(const DataBindingInstanceHandle hChangedInstance, Internal::ServiceBindingRecord& rChangedInstance)
+  {
+    m_pendingChanges.push_back(hChangedInstance);
+    rChangedInstance.PendingChangeSlot = static_cast<uint32_t>(m_pendingChanges.size());
+  }
+
+
+  void DataBindingService::MovePendingChangeToBack(const DataBindingInstanceHandle hChangedInstance, Internal::ServiceBindingRecord& rChangedInstance)
+  {
+    assert(rChangedInstance.PendingChangeSlot > 0u && rChangedInstance.PendingChangeSlot <= m_pendingChanges.size());
+    assert(m_pendingChanges[rChangedInstance.PendingChangeSlot - 1u] == hChangedInstance);
+    if (rChangedInstance.PendingChangeSlot == m_pendingChanges.size())
+    {    // Already the last entry
+      return;
+    }
+    // Instead of erasing the old entry (which is O(n)) a new entry is pushed and the old one is left behind as a stale entry.
+    // Once there are more stale entries than live ones the list is compacted so it can not grow unbounded.
+    const std::size_t staleCount = m_pendingChanges.size() - m_pendingChangeCount;
+    if (staleCount >= (m_pendingChangeCount + LocalConfig::MinPendingChangeCompactCount))
+    {
+      CompactPendingChanges();
+    }
+    PushPendingChange(hChangedInstance, rChangedInstance);
+  }
+
+
+  void DataBindingService::CompactPendingChanges() noexcept
+  {
+    std::size_t dstIndex = 0;
+    for (std::size_t srcIndex = 0; srcIndex < m_pendingChanges.size(); ++srcIndex)
+    {
+      const DataBindingInstanceHandle hChangedInstance = m_pendingChanges[srcIndex];
+      Internal::ServiceBindingRecord* pChangedInstance = m_instances.TryGet(hChangedInstance.Value);
+      if (pChangedInstance != nullptr && pChangedInstance->PendingChangeSlot == (srcIndex + 1u))
+      {
+        m_pendingChanges[dstIndex] = hChangedInstance;
+        ++dstIndex;
+        pChangedInstance->PendingChangeSlot = static_cast<uint32_t>(dstIndex);
+      }
+    }
+    m_pendingChanges.resize(dstIndex);
+    assert(m_pendingChanges.size() == m_pendingChangeCount);
+  }
+
+
   void DataBindingService::RecursiveMarkAsChanged(const DataBindingInstanceHandle hInstance, Internal::ServiceBindingRecord& rInstance)
   {
     assert(rInstance.Instance.GetState() == DataBindingInstanceState::Alive);
@@ -1116,7 +1162,7 @@ namespace Fsl::DataBinding
     }
     for (uint32_t i = 0; i < m_instances.Count(); ++i)
     {
-      if (m_instances[i].Instance.GetPropertyChangeState() != Internal::PropertyChangeState::Unchanged)
+      if (m_instances[i].Instance.GetPropertyChangeState() != Internal::PropertyChangeState::Unchanged || m_instances[i].PendingChangeSlot != 0u)
       {
         return false;
       }
@@ -1225,17 +1271,21 @@ namespace Fsl::DataBinding
   {
     assert(m_changesOneWay.empty());
 
-    m_groupManager.ClearGroups();
-    for (const DataBindingInstanceHandle hChangedInstance : m_pendingChanges)
+    assert(m_groupManager.ActiveGroupCount() == 0u);
+    for (std::size_t i = 0; i < m_pendingChanges.size(); ++i)
     {
+      const DataBindingInstanceHandle hChangedInstance = m_pendingChanges[i];
       Internal::ServiceBindingRecord* pChangedInstance = m_instances.TryGet(hChangedInstance.Value);
-      if (pChangedInstance != nullptr)
+      // Stale entries (left behind when a change was coalesced) are skipped
+      if (pChangedInstance != nullptr && pChangedInstance->PendingChangeSlot == (i + 1u))
       {
         DeterminePendingChange(hChangedInstance, *pChangedInstance);
         pChangedInstance->Instance.ClearPropertyChangeState();
+        pChangedInstance->PendingChangeSlot = 0u;
       }
     }
     m_pendingChanges.clear();
+    m_pendingChangeCount = 0u;
 
     // m_groupManager now contains information about the last element that was changed inside a two-way binding group
     ScheduleTwoWayChanges();
@@ -1250,17 +1300,27 @@ namespace Fsl::DataBinding
     {
       if (IsTwoWayBound(m_instances, rChangedInstance))
       {    // A two way binding, so we need to resolve
+        // The groups are cached until the binding graph is modified, so normally this is just a lookup
         DataBindingGroupInstanceHandle hTwoWayGroup = m_groupManager.TryGetGroup(hChangedInstance);
         const auto changeReason =
           Internal::PropertyChangeStateUtil::UncheckedToPropertyChangeReason(rChangedInstance.Instance.GetPropertyChangeState());
         if (!hTwoWayGroup.IsValid())
         {
           hTwoWayGroup = m_groupManager.CreateGroup(hChangedInstance, changeReason);
-          CreateTwoWayGroupContext context(m_groupManager, m_instances, hTwoWayGroup);
-          AddToGroup(context, hChangedInstance, rChangedInstance);
+          try
+          {
+            CreateTwoWayGroupContext context(m_groupManager, m_instances, hTwoWayGroup);
+            AddToGroup(context, hChangedInstance, rChangedInstance);
+          }
+          catch (const std::exception&)
+          {
+            // Never keep a partially filled group
+            m_groupManager.ClearGroups();
+            throw;
+          }
           assert(hTwoWayGroup.IsValid());
         }
-        else if (changeReason != PropertyChangeReason::Refresh)
+        else if (!m_groupManager.TryActivateGroup(hTwoWayGroup, hChangedInstance, changeReason) && changeReason != PropertyChangeReason::Refresh)
         {    // Only update the info if its something else than refresh
           m_groupManager.UncheckedSetGroupInfo(hTwoWayGroup, hChangedInstance, changeReason);
         }
@@ -1287,14 +1347,14 @@ namespace Fsl::DataBinding
   void DataBindingService::ScheduleTwoWayChanges()
   {
     assert(m_changesTwoWay.empty());
-    const uint32_t groupCount = m_groupManager.GroupCount();
+    const uint32_t groupCount = m_groupManager.ActiveGroupCount();
     for (uint32_t i = 0; i < groupCount; ++i)
     {
       const DataBindingInstanceHandle hChangedInstanceHandle = m_groupManager[i];
       m_changesTwoWay.push(hChangedInstanceHandle);
     }
-    // Clear the group manager content as its no longer needed
-    m_groupManager.ClearGroups();
+    // Deactivate the groups, the groups themselves are kept until the binding graph changes
+    m_groupManager.ClearActiveGroups();
   }
 
   // Beware this modifies the m_pendingObserverCallbacks with observer instances that need to be executed
@@ -1666,6 +1726,9 @@ namespace Fsl::DataBinding
       pRecord->Instance.SetDataBindingInstanceState(DataBindingInstanceState::Destroyed);
       FSLLOG3_VERBOSE4("Destroying instance {}", hInstance.Value);
 
+      // The binding graph is being modified (and the handle can be reused) so the cached two-way groups are no longer valid
+      m_groupManager.ClearGroups();
+
       // Remove all bindings that use this instance as a target
       if (pRecord->HasValidSourceHandles())
       {
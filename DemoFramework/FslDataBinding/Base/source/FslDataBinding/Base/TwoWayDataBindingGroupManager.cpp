@@ -31,13 +31,41 @@
 
 #include <FslDataBinding/Base/TwoWayDataBindingGroupManager.hpp>
 #include <cassert>
+#include <exception>
 
 namespace Fsl::DataBinding
 {
   DataBindingGroupInstanceHandle TwoWayDataBindingGroupManager::CreateGroup(const DataBindingInstanceHandle hChangedInstanceHandle,
                                                                             const PropertyChangeReason reason)
   {
-    return DataBindingGroupInstanceHandle(m_groups.Add(GroupRecord(hChangedInstanceHandle, reason)));
+    // Reserve the active entry first so a failed push can not leave a active group that is not tracked
+    m_activeGroups.emplace_back();
+    try
+    {
+      m_activeGroups.back() = DataBindingGroupInstanceHandle(m_groups.Add(GroupRecord(hChangedInstanceHandle, reason, true)));
+    }
+    catch (const std::exception&)
+    {
+      m_activeGroups.pop_back();
+      throw;
+    }
+    return m_activeGroups.back();
+  }
+
+
+  bool TwoWayDataBindingGroupManager::TryActivateGroup(const DataBindingGroupInstanceHandle hGroup,
+                                                       const DataBindingInstanceHandle hChangedInstanceHandle, const PropertyChangeReason reason)
+  {
+    GroupRecord& rGroupEntry = m_groups.FastGet(hGroup.Value);
+    if (rGroupEntry.IsActive)
+    {
+      return false;
+    }
+    m_activeGroups.push_back(hGroup);
+    rGroupEntry.ChangedInstanceHandle = hChangedInstanceHandle;
+    rGroupEntry.Reason = reason;
+    rGroupEntry.IsActive = true;
+    return true;
   }
 
 
@@ -45,6 +73,7 @@ namespace Fsl::DataBinding
                                                             const DataBindingInstanceHandle hChangedInstanceHandle, const PropertyChangeReason reason)
   {
     GroupRecord& rGroupEntry = m_groups.FastGet(hGroup.Value);
+    assert(rGroupEntry.IsActive);
     rGroupEntry.ChangedInstanceHandle = hChangedInstanceHandle;
     rGroupEntry.Reason = reason;
   }
@@ -68,9 +97,20 @@ namespace Fsl::DataBinding
   }
 
 
-  void TwoWayDataBindingGroupManager::ClearGroups()
+  void TwoWayDataBindingGroupManager::ClearActiveGroups() noexcept
+  {
+    for (const DataBindingGroupInstanceHandle hGroup : m_activeGroups)
+    {
+      m_groups.FastGet(hGroup.Value).IsActive = false;
+    }
+    m_activeGroups.clear();
+  }
+
+
+  void TwoWayDataBindingGroupManager::ClearGroups() noexcept
   {
     m_groups.Clear();
+    m_activeGroups.clear();
     m_instanceToGroupMap.clear();
   }
 }
@@ -83,6 +83,8 @@ namespace Fsl
     void _Update(const DemoTime& demoTime) override;
     void _PostUpdate(const DemoTime& demoTime) override;
     void _Resolve(const DemoTime& demoTime) override;
+    bool _SupportsPipelinedUpdate() const override;
+    void _SwapFrameState(const DemoTime& demoTime) override;
     AppDrawResult _TryPrepareDraw(const FrameInfo& frameInfo) override;
     void _BeginDraw(const FrameInfo& frameInfo) override;
     void _Draw(const FrameInfo& frameInfo) override;
@@ -179,6 +181,16 @@ namespace Fsl
       FSL_PARAM_NOT_USED(demoTime);
     }
 
+    //! @brief Only called if CustomDemoAppConfig::SupportsPipelinedUpdate is set.
+    //!        When pipelined update is enabled the update of the next frame runs on a worker thread while the current frame is drawn,
+    //!        so the state written by the update methods and the state read by the draw methods must be kept in separate buffers.
+    //!        This is called on the main thread when nothing else is running and is the place to swap (or copy) the freshly updated
+    //!        state into the buffer used by draw.
+    virtual void SwapFrameState(const DemoTime& demoTime)
+    {
+      FSL_PARAM_NOT_USED(demoTime);
+    }
+
     virtual void BeginDraw(const FrameInfo& frameInfo)
     {
       FSL_PARAM_NOT_USED(frameInfo);
@@ -77,6 +77,13 @@ namespace Fsl
     //! Set this to true if this app is
     ColorSpaceType AppColorSpaceType{ColorSpaceType::Gamma};
     bool HDREnabled{false};
+    //! Set this to true if the app keeps its update and draw state in separate buffers (see ADemoApp::SwapFrameState).
+    //! This allows the host to run the update of the next frame on a worker thread while the current frame is drawn if pipelined update
+    //! is enabled on the command line. The update is only pipelined while all registered app extensions opt in
+    //! (see IDemoAppExtension::SupportsPipelinedUpdate), frames where the window metrics changed or the update timer was reset run serially.
+    //! As the update of the next frame runs before the input that arrives during the current draw is processed, pipelining adds one frame
+    //! of input latency.
+    bool SupportsPipelinedUpdate{false};
 
     CustomDemoAppConfig() = default;
 
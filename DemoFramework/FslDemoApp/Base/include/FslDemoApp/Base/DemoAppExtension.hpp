@@ -48,6 +48,12 @@ namespace Fsl
   class DemoAppExtension : public IDemoAppExtension
   {
   public:
+    //! Extensions are not safe to update while the app draws unless they opt in
+    bool SupportsPipelinedUpdate() const override
+    {
+      return false;
+    }
+
     void OnKeyEvent(const KeyEvent& event) override
     {
       FSL_PARAM_NOT_USED(event);
@@ -119,6 +125,13 @@ namespace Fsl
       FSL_PARAM_NOT_USED(demoTime);
     }
 
+    //! Called before and after the app 'SwapFrameState'
+    void SwapFrameState(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) override
+    {
+      FSL_PARAM_NOT_USED(callOrder);
+      FSL_PARAM_NOT_USED(demoTime);
+    }
+
     //    virtual void Draw() {}
 
     //! Called before and after the app 'OnDrawSkipped'
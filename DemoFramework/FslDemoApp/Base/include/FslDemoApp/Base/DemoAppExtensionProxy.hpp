@@ -66,6 +66,11 @@ namespace Fsl
       return m_proxy;
     }
 
+    bool SupportsPipelinedUpdate() const override
+    {
+      return !m_proxy || m_proxy->SupportsPipelinedUpdate();
+    }
+
     value_type* TryGet()
     {
       return m_proxy.get();
@@ -189,6 +194,14 @@ namespace Fsl
       }
     }
 
+    void SwapFrameState(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) override
+    {
+      if (m_proxy)
+      {
+        m_proxy->SwapFrameState(callOrder, demoTime);
+      }
+    }
+
     void OnDrawSkipped(const DemoAppExtensionCallOrder callOrder, const FrameInfo& frameInfo) override
     {
       if (m_proxy)
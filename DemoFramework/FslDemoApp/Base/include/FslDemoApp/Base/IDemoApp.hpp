@@ -72,6 +72,14 @@ namespace Fsl
     virtual void _PostUpdate(const DemoTime& demoTime) = 0;
     // NOLINTNEXTLINE(readability-identifier-naming)
     virtual void _Resolve(const DemoTime& demoTime) = 0;
+    //! @brief Check if the update stage can run on a worker thread while the app draws.
+    //!        This is only true if the app itself and all of its registered extensions support it.
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    virtual bool _SupportsPipelinedUpdate() const = 0;
+    //! @brief Called after the update stage has completed and before the frame is drawn, but only for apps that set
+    //!        CustomDemoAppConfig::SupportsPipelinedUpdate. Hand the state produced by the update stage over to the draw stage here.
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    virtual void _SwapFrameState(const DemoTime& demoTime) = 0;
     // NOLINTNEXTLINE(readability-identifier-naming)
     virtual AppDrawResult _TryPrepareDraw(const FrameInfo& frameInfo) = 0;
     // NOLINTNEXTLINE(readability-identifier-naming)
@@ -50,6 +50,9 @@ namespace Fsl
   public:
     virtual ~IDemoAppExtension() = default;
 
+    //! @brief Check if the extension can run its update methods on a worker thread while the app draws (see CustomDemoAppConfig).
+    //!        Extensions must explicitly opt in as the host will only pipeline the update when all registered extensions support it.
+    virtual bool SupportsPipelinedUpdate() const = 0;
     virtual void OnKeyEvent(const KeyEvent& event) = 0;
     virtual void OnMouseButtonEvent(const MouseButtonEvent& event) = 0;
     virtual void OnMouseMoveEvent(const MouseMoveEvent& event) = 0;
@@ -63,6 +66,7 @@ namespace Fsl
     virtual void Update(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) = 0;
     virtual void PostUpdate(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) = 0;
     virtual void Resolve(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) = 0;
+    virtual void SwapFrameState(const DemoAppExtensionCallOrder callOrder, const DemoTime& demoTime) = 0;
     virtual void OnDrawSkipped(const DemoAppExtensionCallOrder callOrder, const FrameInfo& frameInfo) = 0;
     virtual void End(const DemoAppExtensionCallOrder callOrder) = 0;
   };
@@ -42,16 +42,19 @@ namespace Fsl
     bool StatOverlay{false};
     bool PreloadBasic2D{false};
     DemoAppStatsFlags LogStatsFlags{DemoAppStatsFlags::Nothing};
+    //! True if the host is running a benchmark, extensions can use this to register additional profiler counters
+    bool Benchmark{false};
 
     HostConfig() = default;
 
     HostConfig(const bool appFirewall, const bool contentMonitor, const bool statOverlay, const bool preloadBasic2D,
-               const DemoAppStatsFlags logStatsFlags)
+               const DemoAppStatsFlags logStatsFlags, const bool benchmark)
       : AppFirewall(appFirewall)
       , ContentMonitor(contentMonitor)
       , StatOverlay(statOverlay)
       , PreloadBasic2D(preloadBasic2D)
       , LogStatsFlags(logStatsFlags)
+      , Benchmark(benchmark)
     {
     }
   };
@@ -116,6 +116,16 @@ namespace Fsl
     FSL_PARAM_NOT_USED(demoTime);
   }
 
+  bool AConsoleDemoApp::_SupportsPipelinedUpdate() const
+  {
+    return false;
+  }
+
+  void AConsoleDemoApp::_SwapFrameState(const DemoTime& demoTime)
+  {
+    FSL_PARAM_NOT_USED(demoTime);
+  }
+
 
   AppDrawResult AConsoleDemoApp::_TryPrepareDraw(const FrameInfo& frameInfo)
   {
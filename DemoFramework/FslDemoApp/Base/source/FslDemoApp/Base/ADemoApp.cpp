@@ -396,6 +396,38 @@ namespace Fsl
     CallExtensionsPost(m_extensions, fn);
   }
 
+  bool ADemoApp::_SupportsPipelinedUpdate() const
+  {
+    if (!m_demoAppConfig.CustomConfig.SupportsPipelinedUpdate)
+    {
+      return false;
+    }
+    // Every registered extension must opt in as well
+    for (const auto& entry : m_extensions)
+    {
+      const auto extension = entry.lock();
+      if (extension && !extension->SupportsPipelinedUpdate())
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void ADemoApp::_SwapFrameState(const DemoTime& demoTime)
+  {
+    VERBOSE_LOG("ADemoApp::_SwapFrameState()");
+
+    auto fn = [demoTime](IDemoAppExtension& rExt, const DemoAppExtensionCallOrder callOrder) { rExt.SwapFrameState(callOrder, demoTime); };
+    CallExtensionsPre(m_extensions, fn);
+
+    // Done this way to prevent common mistakes where people forget to call the base class
+    SwapFrameState(demoTime);
+
+    // Call all registered extensions
+    CallExtensionsPost(m_extensions, fn);
+  }
+
   AppDrawResult ADemoApp::_TryPrepareDraw(const FrameInfo& frameInfo)
   {
     VERBOSE_LOG("ADemoApp::_TryPrepareDraw()");
@@ -319,6 +319,36 @@ namespace Fsl
   }
 
 
+  bool DemoAppFirewall::_SupportsPipelinedUpdate() const
+  {
+    // The firewall can dispose the app from inside a update, so it never allows the update to run concurrently with the draw
+    return false;
+  }
+
+
+  void DemoAppFirewall::_SwapFrameState(const DemoTime& demoTime)
+  {
+    if (!m_app)
+    {
+      ADemoApp::_SwapFrameState(demoTime);
+      return;
+    }
+
+    try
+    {
+      m_app->_SwapFrameState(demoTime);
+    }
+    catch (const std::exception& ex)
+    {
+      std::string message;
+      message = GetExceptionFormatter().TryFormatException(ex, message) ? message : SafeStr(ex.what());
+      FSLLOG3_ERROR("App._SwapFrameState threw exception: {}", message);
+      SafeDispose();
+      BuildErrorString("App._SwapFrameState threw exception:", message);
+    }
+  }
+
+
   AppDrawResult DemoAppFirewall::_TryPrepareDraw(const FrameInfo& frameInfo)
   {
     if (!m_app)
@@ -0,0 +1,497 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/ExceptionMessageFormatter.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslDemoApp/Base/Host/IDemoAppFactory.hpp>
+#include <FslDemoApp/Base/IDemoApp.hpp>
+#include <FslDemoHost/Base/DemoAppManager.hpp>
+#include <FslDemoHost/Base/Service/AppInfo/AppInfoService.hpp>
+#include <FslDemoHost/Base/Service/DemoAppControl/DemoAppControlService.hpp>
+#include <FslDemoHost/Base/Service/DemoPlatformControl/IDemoPlatformControl.hpp>
+#include <FslDemoHost/Base/Service/Events/EventsService.hpp>
+#include <FslDemoHost/Base/Service/Profiler/ProfilerService.hpp>
+#include <FslDemoHost/Base/Service/Profiler/ProfilerServiceOptionParser.hpp>
+#include <FslDemoService/JobSystem/IJobService.hpp>
+#include <FslService/Consumer/IServiceProvider.hpp>
+#include <FslService/Impl/Exceptions.hpp>
+#include <FslService/Impl/ServiceType/Local/ThreadLocalService.hpp>
+#include <fmt/format.h>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_DemoAppManager = TestFixtureFslBase;
+
+  namespace LocalConfig
+  {
+    constexpr uint32_t FrameCount = 4;
+    constexpr DemoWindowMetrics WindowMetrics(PxExtent2D::Create(640, 480), Vector2(160, 160), 160);
+    constexpr DemoWindowMetrics ResizedWindowMetrics(PxExtent2D::Create(800, 600), Vector2(160, 160), 160);
+  }
+
+  class TestServiceProvider final : public IServiceProvider
+  {
+    std::map<ServiceId, std::shared_ptr<IBasicService>> m_services;
+
+  public:
+    template <typename TInterface>
+    void Add(const std::shared_ptr<IBasicService>& service)
+    {
+      m_services[ServiceId(typeid(TInterface))] = service;
+    }
+
+    std::shared_ptr<IBasicService> TryGet(const ServiceId& serviceId) const final
+    {
+      auto itrFind = m_services.find(serviceId);
+      return itrFind != m_services.end() ? itrFind->second : std::shared_ptr<IBasicService>();
+    }
+
+    std::shared_ptr<IBasicService> Get(const ServiceId& serviceId) const final
+    {
+      auto service = TryGet(serviceId);
+      if (!service)
+      {
+        throw UnknownServiceException(fmt::format("Unknown service: {}", serviceId.Get().name()));
+      }
+      return service;
+    }
+
+    std::shared_ptr<IBasicService> TryGet(const ServiceId& serviceId, const ProviderId& providerId) const final
+    {
+      FSL_PARAM_NOT_USED(providerId);
+      return TryGet(serviceId);
+    }
+
+    std::shared_ptr<IBasicService> Get(const ServiceId& serviceId, const ProviderId& providerId) const final
+    {
+      FSL_PARAM_NOT_USED(providerId);
+      return Get(serviceId);
+    }
+
+    void Get(BasicServiceDeque& rServices, const ServiceId& serviceId) const final
+    {
+      auto service = TryGet(serviceId);
+      if (service)
+      {
+        rServices.push_back(service);
+      }
+    }
+  };
+
+  class TestDemoPlatformControl final
+    : public ThreadLocalService
+    , public IDemoPlatformControl
+  {
+    bool m_hasExitRequest{false};
+
+  public:
+    explicit TestDemoPlatformControl(const ServiceProvider& serviceProvider)
+      : ThreadLocalService(serviceProvider)
+    {
+    }
+
+    void RequestExit() final
+    {
+      m_hasExitRequest = true;
+    }
+
+    bool HasExitRequest() const final
+    {
+      return m_hasExitRequest;
+    }
+  };
+
+  class TestJobService final
+    : public ThreadLocalService
+    , public IJobService
+  {
+    std::shared_ptr<JobSystem> m_jobSystem;
+
+  public:
+    explicit TestJobService(const ServiceProvider& serviceProvider)
+      : ThreadLocalService(serviceProvider)
+      , m_jobSystem(std::make_shared<JobSystem>(1u))
+    {
+    }
+
+    uint32_t GetWorkerThreadCount() const final
+    {
+      return m_jobSystem->GetWorkerThreadCount();
+    }
+
+    std::shared_ptr<JobSystem> GetJobSystem() const final
+    {
+      return m_jobSystem;
+    }
+  };
+
+  //! The update stage writes the update state, the swap copies it to the draw state and the draw records the draw state it saw.
+  struct TestAppState
+  {
+    bool SupportsPipelinedUpdate{true};
+    std::atomic<uint32_t> UpdateCount{0};
+    uint32_t ConfigurationChangedCount{0};
+    uint32_t UpdateState{0};
+    uint32_t DrawState{0};
+    std::vector<uint32_t> DrawnStates;
+  };
+
+  class TestDemoApp final : public IDemoApp
+  {
+    std::shared_ptr<TestAppState> m_state;
+
+  public:
+    explicit TestDemoApp(std::shared_ptr<TestAppState> state)
+      : m_state(std::move(state))
+    {
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _PostConstruct() final
+    {
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _PreDestruct() final
+    {
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _Begin() final
+    {
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _OnEvent(IEvent* const pEvent) final
+    {
+      FSL_PARAM_NOT_USED(pEvent);
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _ConfigurationChanged(const DemoWindowMetrics& windowMetrics) final
+    {
+      FSL_PARAM_NOT_USED(windowMetrics);
+      ++m_state->ConfigurationChangedCount;
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _PreUpdate(const DemoTime& demoTime) final
+    {
+      FSL_PARAM_NOT_USED(demoTime);
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _FixedUpdate(const DemoTime& demoTime) final
+    {
+      FSL_PARAM_NOT_USED(demoTime);
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _Update(const DemoTime& demoTime) final
+    {
+      FSL_PARAM_NOT_USED(demoTime);
+      m_state->UpdateState = ++m_state->UpdateCount;
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _PostUpdate(const DemoTime& demoTime) final
+    {
+      FSL_PARAM_NOT_USED(demoTime);
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _Resolve(const DemoTime& demoTime) final
+    {
+      FSL_PARAM_NOT_USED(demoTime);
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    bool _SupportsPipelinedUpdate() const final
+    {
+      return m_state->SupportsPipelinedUpdate;
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _SwapFrameState(const DemoTime& demoTime) final
+    {
+      FSL_PARAM_NOT_USED(demoTime);
+      m_state->DrawState = m_state->UpdateState;
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    AppDrawResult _TryPrepareDraw(const FrameInfo& frameInfo) final
+    {
+      FSL_PARAM_NOT_USED(frameInfo);
+      return AppDrawResult::Completed;
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _BeginDraw(const FrameInfo& frameInfo) final
+    {
+      FSL_PARAM_NOT_USED(frameInfo);
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _Draw(const FrameInfo& frameInfo) final
+    {
+      FSL_PARAM_NOT_USED(frameInfo);
+      m_state->DrawnStates.push_back(m_state->DrawState);
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _EndDraw(const FrameInfo& frameInfo) final
+    {
+      FSL_PARAM_NOT_USED(frameInfo);
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _OnDrawSkipped(const FrameInfo& frameInfo) final
+    {
+      FSL_PARAM_NOT_USED(frameInfo);
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    AppDrawResult _TrySwapBuffers(const FrameInfo& frameInfo) final
+    {
+      FSL_PARAM_NOT_USED(frameInfo);
+      return AppDrawResult::Completed;
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void _End() final
+    {
+    }
+  };
+
+  class TestDemoAppFactory final : public IDemoAppFactory
+  {
+    std::shared_ptr<TestAppState> m_state;
+
+  public:
+    explicit TestDemoAppFactory(std::shared_ptr<TestAppState> state)
+      : m_state(std::move(state))
+    {
+    }
+
+    std::shared_ptr<IDemoApp> Allocate(const DemoAppConfig& config) final
+    {
+      FSL_PARAM_NOT_USED(config);
+      return std::make_shared<TestDemoApp>(m_state);
+    }
+  };
+
+  //! Hosts a DemoAppManager with the minimal set of services it requires
+  struct TestHost
+  {
+    std::shared_ptr<TestAppState> State{std::make_shared<TestAppState>()};
+    std::shared_ptr<TestServiceProvider> Provider{std::make_shared<TestServiceProvider>()};
+    std::shared_ptr<DemoAppControlService> AppControl;
+    std::unique_ptr<DemoAppManager> Manager;
+    //! The number of updates that were executed while a frame was drawn
+    uint32_t PipelinedUpdateCount{0};
+
+    explicit TestHost(const bool enablePipelinedUpdate)
+    {
+      const ServiceProvider serviceProvider(Provider);
+
+      auto events = std::make_shared<EventsService>(serviceProvider);
+      Provider->Add<IEventService>(events);
+      Provider->Add<IEventPoster>(events);
+      Provider->Add<IDemoPlatformControl>(std::make_shared<TestDemoPlatformControl>(serviceProvider));
+
+      auto profiler = std::make_shared<ProfilerService>(serviceProvider, std::make_shared<ProfilerServiceOptionParser>());
+      Provider->Add<IProfilerService>(profiler);
+      Provider->Add<IProfilerServiceControl>(profiler);
+      Provider->Add<IAppInfoControlService>(std::make_shared<AppInfoService>(serviceProvider));
+      Provider->Add<IJobService>(std::make_shared<TestJobService>(serviceProvider));
+
+      AppControl = std::make_shared<DemoAppControlService>(serviceProvider, 0);
+      Provider->Add<IDemoAppControlEx>(AppControl);
+
+      CustomDemoAppConfig customConfig;
+      customConfig.RestartFlags = CustomDemoAppConfigRestartFlags::Never;
+      customConfig.SupportsPipelinedUpdate = true;
+      DemoAppSetup setup("TestApp", customConfig, std::make_shared<TestDemoAppFactory>(State));
+      const DemoAppConfig config(std::shared_ptr<ADemoOptionParser>(), ExceptionMessageFormatter(), LocalConfig::WindowMetrics, serviceProvider,
+                                 customConfig);
+
+      Manager = std::make_unique<DemoAppManager>(std::move(setup), config, false, LogStatsMode::Disabled, DemoAppStatsFlags(), false, false,
+                                                 TimeSpan(), false, enablePipelinedUpdate);
+    }
+
+    ~TestHost()
+    {
+      Manager.reset();
+    }
+
+    TestHost(const TestHost&) = delete;
+    TestHost& operator=(const TestHost&) = delete;
+
+    void Draw()
+    {
+      const uint32_t updateCount = State->UpdateCount;
+      ASSERT_EQ(AppDrawResult::Completed, Manager->TryDraw());
+      PipelinedUpdateCount += State->UpdateCount - updateCount;
+      ASSERT_EQ(AppDrawResult::Completed, Manager->TryAppSwapBuffers());
+      Manager->OnFrameSwapCompleted();
+      Manager->ProcessDone();
+    }
+
+    void RunFrame(const DemoWindowMetrics& windowMetrics = LocalConfig::WindowMetrics)
+    {
+      ASSERT_EQ(DemoAppManagerProcessResult::Command::Draw, Manager->Process(windowMetrics, false).Cmd);
+      Draw();
+    }
+  };
+
+  void CheckDrawnStates(const TestAppState& state)
+  {
+    // Every frame must draw the state produced by exactly one update, never the update that runs concurrently with the draw
+    for (std::size_t i = 0; i < state.DrawnStates.size(); ++i)
+    {
+      EXPECT_EQ(i + 1u, state.DrawnStates[i]);
+    }
+  }
+}
+
+
+TEST(Test_DemoAppManager, Serial)
+{
+  TestHost host(false);
+  for (uint32_t i = 0; i < LocalConfig::FrameCount; ++i)
+  {
+    host.RunFrame();
+  }
+
+  EXPECT_EQ(LocalConfig::FrameCount, host.State->UpdateCount.load());
+  EXPECT_EQ(0u, host.PipelinedUpdateCount);
+  ASSERT_EQ(LocalConfig::FrameCount, host.State->DrawnStates.size());
+  CheckDrawnStates(*host.State);
+}
+
+
+TEST(Test_DemoAppManager, Pipelined)
+{
+  TestHost host(true);
+  for (uint32_t i = 0; i < LocalConfig::FrameCount; ++i)
+  {
+    const uint32_t updateCount = host.State->UpdateCount;
+    ASSERT_EQ(DemoAppManagerProcessResult::Command::Draw, host.Manager->Process(LocalConfig::WindowMetrics, false).Cmd);
+    // Only the first frame updates serially, the update of all other frames was executed while the previous frame was drawn
+    EXPECT_EQ(i == 0 ? updateCount + 1 : updateCount, host.State->UpdateCount.load());
+
+    host.Draw();
+    EXPECT_EQ(updateCount + (i == 0 ? 2 : 1), host.State->UpdateCount.load());
+  }
+
+  // The update of the next frame has already been executed
+  EXPECT_EQ(LocalConfig::FrameCount + 1, host.State->UpdateCount.load());
+  EXPECT_EQ(LocalConfig::FrameCount, host.PipelinedUpdateCount);
+  ASSERT_EQ(LocalConfig::FrameCount, host.State->DrawnStates.size());
+  CheckDrawnStates(*host.State);
+}
+
+
+TEST(Test_DemoAppManager, Pipelined_AppDoesNotSupportIt)
+{
+  TestHost host(true);
+  // Simulates a app with a registered extension that has not opted in to pipelined updates
+  host.State->SupportsPipelinedUpdate = false;
+  for (uint32_t i = 0; i < LocalConfig::FrameCount; ++i)
+  {
+    host.RunFrame();
+  }
+
+  EXPECT_EQ(LocalConfig::FrameCount, host.State->UpdateCount.load());
+  EXPECT_EQ(0u, host.PipelinedUpdateCount);
+  CheckDrawnStates(*host.State);
+}
+
+
+TEST(Test_DemoAppManager, Pipelined_WindowMetricsChangedForcesSerialUpdate)
+{
+  TestHost host(true);
+  for (uint32_t i = 0; i < LocalConfig::FrameCount; ++i)
+  {
+    host.RunFrame();
+  }
+  const uint32_t updateCount = host.State->UpdateCount;
+  ASSERT_EQ(0u, host.State->ConfigurationChangedCount);
+
+  // The pipelined update ran before the app saw the new metrics, so a serial update must be run after the configuration change
+  ASSERT_EQ(DemoAppManagerProcessResult::Command::Draw, host.Manager->Process(LocalConfig::ResizedWindowMetrics, false).Cmd);
+  EXPECT_EQ(1u, host.State->ConfigurationChangedCount);
+  EXPECT_EQ(updateCount + 1, host.State->UpdateCount.load());
+
+  host.Draw();
+  ASSERT_FALSE(host.State->DrawnStates.empty());
+  EXPECT_EQ(updateCount + 1, host.State->DrawnStates.back());
+
+  // Pipelining resumes on the following frames
+  host.RunFrame(LocalConfig::ResizedWindowMetrics);
+  EXPECT_EQ(updateCount + 3, host.State->UpdateCount.load());
+  EXPECT_EQ(updateCount + 2, host.State->DrawnStates.back());
+}
+
+
+TEST(Test_DemoAppManager, Pipelined_TimerResetForcesSerialUpdate)
+{
+  TestHost host(true);
+  for (uint32_t i = 0; i < LocalConfig::FrameCount; ++i)
+  {
+    host.RunFrame();
+  }
+  const uint32_t updateCount = host.State->UpdateCount;
+
+  // A reset requested after the pipelined update ran must result in a serial update
+  host.AppControl->RequestUpdateTimerReset();
+  ASSERT_EQ(DemoAppManagerProcessResult::Command::Draw, host.Manager->Process(LocalConfig::WindowMetrics, false).Cmd);
+  EXPECT_EQ(updateCount + 1, host.State->UpdateCount.load());
+
+  // A reset requested before the draw must prevent the update from being pipelined
+  host.AppControl->RequestUpdateTimerReset();
+  host.Draw();
+  EXPECT_EQ(updateCount + 1, host.State->UpdateCount.load());
+  EXPECT_EQ(updateCount + 1, host.State->DrawnStates.back());
+
+  host.RunFrame();
+  EXPECT_EQ(updateCount + 3, host.State->UpdateCount.load());
+  EXPECT_EQ(updateCount + 2, host.State->DrawnStates.back());
+}
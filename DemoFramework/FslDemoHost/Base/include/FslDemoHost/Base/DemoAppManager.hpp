@@ -33,6 +33,7 @@
 
 #include <FslBase/Math/Point2.hpp>
 #include <FslBase/System/HighResolutionTimer.hpp>
+#include <FslBase/System/Threading/JobHandle.hpp>
 #include <FslDemoApp/Base/AppDrawResult.hpp>
 #include <FslDemoApp/Base/DemoAppConfig.hpp>
 #include <FslDemoApp/Base/DemoAppStatsFlags.hpp>
@@ -45,6 +46,7 @@
 #include <FslDemoHost/Base/LogStatsMode.hpp>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace Fsl
 {
@@ -55,6 +57,7 @@ namespace Fsl
   class IGraphicsServiceControl;
   class IProfilerService;
   class IProfilerServiceControl;
+  class JobSystem;
   struct TimeSpan;
 
   class DemoAppManager
@@ -90,6 +93,24 @@ namespace Fsl
       TickCount TimeAfterUpdate{0u};
       TickCount TimeAfterDraw{0u};
       TickCount LastFrameSwapCompletedTime{0};
+      //! Only used when the update was pipelined
+      TickCount TimeBeforeDraw{0u};
+      //! Only used when the update was pipelined
+      TickCount TimeBeforeUpdateWait{0u};
+      //! Only used when the update was pipelined
+      TickCount TimeAfterUpdateWait{0u};
+      //! True if the update of the next frame was executed while this frame was drawn
+      bool IsPipelined{false};
+    };
+
+    struct PipelinedUpdate
+    {
+      //! The job system used to execute the update stage (null if pipelined update is disabled)
+      std::shared_ptr<JobSystem> Jobs;
+      //! The fixed update times for the update stage, they are captured on the main thread before the update stage is scheduled
+      std::vector<DemoTime> FixedUpdateTimes;
+      //! True if the update stage of the upcoming frame was executed while the previous frame was drawn
+      bool IsUpdateReady{false};
     };
 
     std::unique_ptr<DemoAppProfilerOverlay> m_demoAppProfilerOverlay;
@@ -109,6 +130,7 @@ namespace Fsl
     DemoTime m_currentDemoTimeDraw;
     Stats m_stats;
     OnDemandRendering m_onDemandRendering;
+    PipelinedUpdate m_pipelinedUpdate;
     LogStatsMode m_logStatsMode;
     DemoAppStatsFlags m_logStatsFlags;
     bool m_enableStats;
@@ -119,7 +141,7 @@ namespace Fsl
   public:
     DemoAppManager(DemoAppSetup demoAppSetup, const DemoAppConfig& demoAppConfig, const bool enableStats, const LogStatsMode logStatsMode,
                    const DemoAppStatsFlags& logStatsFlags, const bool enableFirewall, const bool enableContentMonitor,
-                   const TimeSpan& forcedUpdateTime, const bool renderSystemOverlay);
+                   const TimeSpan& forcedUpdateTime, const bool renderSystemOverlay, const bool enablePipelinedUpdate);
     virtual ~DemoAppManager();
 
     uint32_t GetFrameIndex() const
@@ -155,6 +177,17 @@ namespace Fsl
     void UpdateAppTimers();
     DemoAppManagerProcessResult ProcessOnDemandRendering();
 
+    //! @brief Run the update stage on the main thread
+    void RunSerialUpdateStage();
+    //! @brief Check if the update stage of the next frame can be executed while the current frame is drawn
+    bool CanPipelineUpdate() const;
+    //! @brief Prepare the update stage of the next frame on the main thread and schedule it on the job system
+    JobHandle BeginPipelinedUpdate();
+    //! @brief Wait for the update stage scheduled by BeginPipelinedUpdate to complete
+    void EndPipelinedUpdate(const JobHandle& updateJob);
+    //! @brief Execute the update stage, this will be called from a job system thread
+    void RunPipelinedUpdateStage(const DemoTime& updateTime);
+
     //! @brief Manage exit requests
     //! @return true if exit should occur right away
     bool ManageExitRequests(const bool bCheckExternalOnly);
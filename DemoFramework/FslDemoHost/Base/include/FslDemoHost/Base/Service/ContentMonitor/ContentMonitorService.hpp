@@ -35,7 +35,7 @@
 #include <FslDemoApp/Base/Service/Content/IContentManager.hpp>
 #include <FslDemoApp/Base/Service/ContentMonitor/IContentMonitor.hpp>
 #include <FslDemoApp/Base/Service/DemoAppControl/IDemoAppControl.hpp>
-#include <FslDemoHost/Base/Service/ContentMonitor/ContentMonitorResultCommand.hpp>
+#include <FslDemoHost/Base/Service/ContentMonitor/ContentMonitorResult.hpp>
 #include <FslService/Consumer/ServiceProvider.hpp>
 #include <FslService/Impl/ServiceType/Local/ThreadLocalService.hpp>
 #include <memory>
@@ -43,16 +43,12 @@
 namespace Fsl
 {
   class ContentMonitorThread;
-  namespace IO
-  {
-    class PathWatcher;
-  }
 
   class ContentMonitorService final
     : public ThreadLocalService
     , public IContentMonitor
   {
-    std::shared_ptr<ConcurrentQueue<ContentMonitorResultCommand>> m_commandQueue;
+    std::shared_ptr<ConcurrentQueue<ContentMonitorResult>> m_commandQueue;
     std::shared_ptr<ContentMonitorThread> m_contentMonitorThread;
     std::shared_ptr<IContentManager> m_contentManager;
     std::shared_ptr<IDemoAppControl> m_appControl;
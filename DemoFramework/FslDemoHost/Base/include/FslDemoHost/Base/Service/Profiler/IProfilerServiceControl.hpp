@@ -41,7 +41,8 @@ namespace Fsl
     virtual ~IProfilerServiceControl() = default;
 
     //! @brief Add frame times
-    virtual void AddFrameTimes(const uint64_t updateTime, const uint64_t drawTime, const uint64_t totalTime) = 0;
+    //! @param updateWaitTime the time the draw stage waited for a pipelined update to complete (zero when not pipelined)
+    virtual void AddFrameTimes(const uint64_t updateTime, const uint64_t drawTime, const uint64_t totalTime, const uint64_t updateWaitTime) = 0;
   };
 }
 
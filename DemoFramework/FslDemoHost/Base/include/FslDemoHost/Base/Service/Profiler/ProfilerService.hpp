@@ -63,13 +63,15 @@ namespace Fsl
       int64_t UpdateTime{0};
       int64_t DrawTime{0};
       int64_t TotalTime{0};
+      int64_t UpdateWaitTime{0};
 
       ProfilerRecord() = default;
 
-      ProfilerRecord(const int64_t updateTime, const int64_t drawTime, const int64_t totalTime)
+      ProfilerRecord(const int64_t updateTime, const int64_t drawTime, const int64_t totalTime, const int64_t updateWaitTime)
         : UpdateTime(updateTime)
         , DrawTime(drawTime)
         , TotalTime(totalTime)
+        , UpdateWaitTime(updateWaitTime)
       {
       }
     };
@@ -101,7 +103,7 @@ namespace Fsl
     bool IsValidHandle(const ProfilerCustomCounterHandle& handle) const final;
 
     // From IProfilerServiceControl
-    void AddFrameTimes(const uint64_t updateTime, const uint64_t drawTime, const uint64_t totalTime) final;
+    void AddFrameTimes(const uint64_t updateTime, const uint64_t drawTime, const uint64_t totalTime, const uint64_t updateWaitTime) final;
 
   private:
     inline int32_t ConvertHandleToIndex(const ProfilerCustomCounterHandle& handle) const;
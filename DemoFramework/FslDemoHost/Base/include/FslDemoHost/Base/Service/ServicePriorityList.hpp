@@ -50,6 +50,7 @@ namespace Fsl
     static Priority ImageConverterLibraryService();
     static Priority ImageLibraryService();
     static Priority ImageService();
+    static Priority JobService();
     static Priority NativeGraphicsService();
     static Priority NativeWindowEventsService();
     static Priority Options();
@@ -34,13 +34,19 @@
 #include <FslDemoApp/Base/Service/Texture/ITextureService.hpp>
 #include <FslService/Consumer/ServiceProvider.hpp>
 #include <FslService/Impl/ServiceType/Local/ThreadLocalService.hpp>
+#include <memory>
 
 namespace Fsl
 {
+  class IJobService;
+
   class TextureService final
     : public ThreadLocalService
     , public ITextureService
   {
+    //! Optional, when available the mip maps are generated in parallel
+    std::shared_ptr<IJobService> m_jobService;
+
   public:
     explicit TextureService(const ServiceProvider& serviceProvider);
     ~TextureService() final;
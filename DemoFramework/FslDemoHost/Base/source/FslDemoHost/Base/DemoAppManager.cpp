@@ -32,6 +32,7 @@
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/Log/Log3Core.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
 #include <FslBase/Time/TimeSpanUtil.hpp>
 #include <FslDemoApp/Base/DemoAppFirewall.hpp>
 #include <FslDemoApp/Base/FrameInfo.hpp>
@@ -46,6 +47,7 @@
 #include <FslDemoHost/Base/Service/Profiler/IProfilerServiceControl.hpp>
 #include <FslDemoService/CpuStats/ICpuStatsService.hpp>
 #include <FslDemoService/Graphics/Control/IGraphicsServiceControl.hpp>
+#include <FslDemoService/JobSystem/IJobService.hpp>
 #include <FslDemoService/Profiler/IProfilerService.hpp>
 #include <FslService/Consumer/ServiceProvider.hpp>
 #include <cassert>
@@ -68,7 +70,8 @@ namespace Fsl
 
   DemoAppManager::DemoAppManager(DemoAppSetup demoAppSetup, const DemoAppConfig& demoAppConfig, const bool enableStats,
                                  const LogStatsMode logStatsMode, const DemoAppStatsFlags& logStatsFlags, const bool enableFirewall,
-                                 const bool enableContentMonitor, const TimeSpan& forcedUpdateTime, const bool renderSystemOverlay)
+                                 const bool enableContentMonitor, const TimeSpan& forcedUpdateTime, const bool renderSystemOverlay,
+                                 const bool enablePipelinedUpdate)
     : m_eventListener(std::make_shared<DemoAppManagerEventListener>())
     , m_demoAppSetup(std::move(demoAppSetup))
     , m_demoAppConfig(demoAppConfig)
@@ -93,6 +96,23 @@ namespace Fsl
 
     m_demoAppControl->SetRenderLoopMaxFramesInFlight(m_demoAppSetup.CustomAppConfig.MaxFramesInFlight);
 
+    if (enablePipelinedUpdate)
+    {
+      if (m_demoAppSetup.CustomAppConfig.SupportsPipelinedUpdate)
+      {
+        auto jobService = m_demoAppConfig.DemoServiceProvider.TryGet<IJobService>();
+        if (jobService)
+        {
+          m_pipelinedUpdate.Jobs = jobService->GetJobSystem();
+        }
+        FSLLOG3_WARNING_IF(!jobService, "Pipelined update disabled as the job service is unavailable");
+      }
+      else
+      {
+        FSLLOG3_INFO("Pipelined update disabled as the app does not support it");
+      }
+    }
+
     if (enableContentMonitor)
     {
       std::shared_ptr<IContentMonitor> contentMonitor = m_demoAppConfig.DemoServiceProvider.Get<IContentMonitor>();
@@ -166,7 +186,8 @@ namespace Fsl
     m_record.DemoApp->_Begin();
 
     // Detect metrics changes
-    if (windowMetrics != m_demoAppConfig.WindowMetrics)
+    const bool windowMetricsChanged = windowMetrics != m_demoAppConfig.WindowMetrics;
+    if (windowMetricsChanged)
     {
       m_demoAppConfig.UpdateWindowMetrics(windowMetrics);
 
@@ -179,42 +200,37 @@ namespace Fsl
 
     // Check if the update timer should be reset or not
     assert(m_demoAppControl);
-    if (m_demoAppControl->HasUpdateTimerResetRequest())
+    const bool resetTimer = m_demoAppControl->HasUpdateTimerResetRequest();
+    if (resetTimer)
     {
       m_demoAppControl->ClearUpdateTimerResetRequest();
       ResetTimer();
     }
 
+    m_stats.IsPipelined = false;
+    if (!m_pipelinedUpdate.IsUpdateReady)
     {
-      if (m_cachedState.CachedTimeStepMode == TimeStepMode::Step)
-      {
-        m_demoAppControl->SetTimeStepMode(TimeStepMode::Paused);
-      }
-      const DemoTime currentUpdateTime = m_appTiming.GetUpdateTime();
-
-      m_stats.TimeBeforeUpdate = m_timer.GetTimestamp();
+      RunSerialUpdateStage();
+    }
+    else
+    {
+      // The update stage of this frame was executed while the previous frame was drawn
+      m_pipelinedUpdate.IsUpdateReady = false;
+      if (windowMetricsChanged || resetTimer)
       {
-        m_record.DemoApp->_PreUpdate(currentUpdateTime);
-
-        {    // Run all missing fixed updates
-          std::optional<DemoTime> fixedTime = m_appTiming.TryFixedUpdate();
-          while (fixedTime.has_value())
-          {
-            m_record.DemoApp->_FixedUpdate(fixedTime.value());
-            fixedTime = m_appTiming.TryFixedUpdate();
-          }
-        }
-
-        if (m_graphicsService)
+        // The pipelined update ran before the app saw the new configuration or timer reset, so run a serial update on top of it.
+        // Unless the timer was reset, advance the timers so the time already consumed by the pipelined update is not applied twice.
+        if (!resetTimer)
         {
-          m_graphicsService->PreUpdate();
+          UpdateAppTimers();
         }
-
-        m_record.DemoApp->_Update(currentUpdateTime);
-        m_record.DemoApp->_PostUpdate(currentUpdateTime);
-        m_record.DemoApp->_Resolve(currentUpdateTime);
+        RunSerialUpdateStage();
       }
-      m_stats.TimeAfterUpdate = m_timer.GetTimestamp();
+    }
+
+    if (m_demoAppSetup.CustomAppConfig.SupportsPipelinedUpdate)
+    {
+      m_record.DemoApp->_SwapFrameState(m_appTiming.GetUpdateTime());
     }
 
     ManageExitRequests(false);
@@ -228,30 +244,56 @@ namespace Fsl
   {
     FrameInfo frameInfo(m_record.FrameIndex, m_currentDemoTimeDraw);
 
+    m_stats.TimeBeforeDraw = m_timer.GetTimestamp();
     auto result = m_record.DemoApp->_TryPrepareDraw(frameInfo);
     if (result != AppDrawResult::Completed)
     {
       return result;
     }
 
-    m_record.DemoApp->_BeginDraw(frameInfo);
+    const JobHandle updateJob = CanPipelineUpdate() ? BeginPipelinedUpdate() : JobHandle();
     try
     {
-      m_record.DemoApp->_Draw(frameInfo);
-      m_record.DemoApp->_EndDraw(frameInfo);
+      m_record.DemoApp->_BeginDraw(frameInfo);
+      try
+      {
+        m_record.DemoApp->_Draw(frameInfo);
+        m_record.DemoApp->_EndDraw(frameInfo);
+      }
+      catch (std::exception& ex)
+      {
+        FSLLOG3_ERROR("Exception during draw: {}", ex.what());
+        m_record.DemoApp->_EndDraw(frameInfo);
+        throw;
+      }
+
+      m_stats.TimeAfterDraw = m_timer.GetTimestamp();
+
+      if (m_enableStats && m_state == DemoState::Running && m_demoAppProfilerOverlay)
+      {
+        m_demoAppProfilerOverlay->Draw(m_demoAppConfig.WindowMetrics);
+      }
     }
-    catch (std::exception& ex)
+    catch (const std::exception&)
     {
-      FSLLOG3_ERROR("Exception during draw: {}", ex.what());
-      m_record.DemoApp->_EndDraw(frameInfo);
+      // The update stage must never be left running while the exception unwinds the frame
+      if (updateJob.IsValid())
+      {
+        try
+        {
+          m_pipelinedUpdate.Jobs->Wait(updateJob);
+        }
+        catch (const std::exception& ex)
+        {
+          FSLLOG3_ERROR("Exception during pipelined update: {}", ex.what());
+        }
+      }
       throw;
     }
 
-    m_stats.TimeAfterDraw = m_timer.GetTimestamp();
-
-    if (m_enableStats && m_state == DemoState::Running && m_demoAppProfilerOverlay)
+    if (updateJob.IsValid())
     {
-      m_demoAppProfilerOverlay->Draw(m_demoAppConfig.WindowMetrics);
+      EndPipelinedUpdate(updateJob);
     }
 
     ManageExitRequests(false);
@@ -306,10 +348,17 @@ namespace Fsl
   {
     if (m_state == DemoState::Running)
     {
-      UpdateAppTimers();
+      // When the update was pipelined the timers were advanced before the update stage of the next frame was scheduled
+      if (!m_stats.IsPipelined)
+      {
+        UpdateAppTimers();
+      }
 
+      // When pipelined the update stage belongs to the next frame and it ran concurrently with the draw, so the stages are timed separately
       const auto deltaTimeUpdate = m_stats.TimeAfterUpdate - m_stats.TimeBeforeUpdate;
-      const auto deltaTimeDraw = m_stats.TimeAfterDraw - m_stats.TimeAfterUpdate;
+      const auto deltaTimeDraw =
+        m_stats.IsPipelined ? m_stats.TimeAfterDraw - m_stats.TimeBeforeDraw : m_stats.TimeAfterDraw - m_stats.TimeAfterUpdate;
+      const auto deltaTimeUpdateWait = m_stats.IsPipelined ? m_stats.TimeAfterUpdateWait - m_stats.TimeBeforeUpdateWait : TimeSpan();
 
       const auto timeNow = m_timer.GetTimestamp();
       const auto deltaFrameSwapCompletedTime = timeNow - m_stats.LastFrameSwapCompletedTime;
@@ -317,7 +366,8 @@ namespace Fsl
 
       m_profilerServiceControl->AddFrameTimes(TimeSpanUtil::ToClampedMicrosecondsUInt64(deltaTimeUpdate),
                                               TimeSpanUtil::ToClampedMicrosecondsUInt64(deltaTimeDraw),
-                                              TimeSpanUtil::ToClampedMicrosecondsUInt64(deltaFrameSwapCompletedTime));
+                                              TimeSpanUtil::ToClampedMicrosecondsUInt64(deltaFrameSwapCompletedTime),
+                                              TimeSpanUtil::ToClampedMicrosecondsUInt64(deltaTimeUpdateWait));
 
       const auto averageTime = m_profilerService->GetAverageFrameTime();
       const auto averageTotalTime = TimeSpanUtil::FromMicroseconds(averageTime.TotalTime);
@@ -482,6 +532,114 @@ namespace Fsl
   }
 
 
+  void DemoAppManager::RunSerialUpdateStage()
+  {
+    if (m_cachedState.CachedTimeStepMode == TimeStepMode::Step)
+    {
+      m_demoAppControl->SetTimeStepMode(TimeStepMode::Paused);
+    }
+    const DemoTime currentUpdateTime = m_appTiming.GetUpdateTime();
+
+    m_stats.TimeBeforeUpdate = m_timer.GetTimestamp();
+    {
+      m_record.DemoApp->_PreUpdate(currentUpdateTime);
+
+      {    // Run all missing fixed updates
+        std::optional<DemoTime> fixedTime = m_appTiming.TryFixedUpdate();
+        while (fixedTime.has_value())
+        {
+          m_record.DemoApp->_FixedUpdate(fixedTime.value());
+          fixedTime = m_appTiming.TryFixedUpdate();
+        }
+      }
+
+      if (m_graphicsService)
+      {
+        m_graphicsService->PreUpdate();
+      }
+
+      m_record.DemoApp->_Update(currentUpdateTime);
+      m_record.DemoApp->_PostUpdate(currentUpdateTime);
+      m_record.DemoApp->_Resolve(currentUpdateTime);
+    }
+    m_stats.TimeAfterUpdate = m_timer.GetTimestamp();
+  }
+
+
+  bool DemoAppManager::CanPipelineUpdate() const
+  {
+    // A pending timer reset must be applied by Process before the next update runs, so that frame is executed serially.
+    // The app is asked every frame as extensions can be registered at any time.
+    return m_pipelinedUpdate.Jobs && !m_pipelinedUpdate.IsUpdateReady && m_state == DemoState::Running && !m_hasExitRequest &&
+           !m_demoAppControl->HasExitRequest() && !HasRestartRequest() && !m_demoAppControl->HasUpdateTimerResetRequest() &&
+           m_record.DemoApp->_SupportsPipelinedUpdate();
+  }
+
+
+  JobHandle DemoAppManager::BeginPipelinedUpdate()
+  {
+    assert(m_pipelinedUpdate.Jobs);
+    assert(!m_pipelinedUpdate.IsUpdateReady);
+
+    // The update stage of the next frame starts before the frame swap completes, so advance the timers now
+    UpdateAppTimers();
+
+    if (m_cachedState.CachedTimeStepMode == TimeStepMode::Step)
+    {
+      m_demoAppControl->SetTimeStepMode(TimeStepMode::Paused);
+    }
+    const DemoTime updateTime = m_appTiming.GetUpdateTime();
+
+    // Capture all missing fixed updates here so the timing is only ever modified on the main thread
+    m_pipelinedUpdate.FixedUpdateTimes.clear();
+    {
+      std::optional<DemoTime> fixedTime = m_appTiming.TryFixedUpdate();
+      while (fixedTime.has_value())
+      {
+        m_pipelinedUpdate.FixedUpdateTimes.push_back(fixedTime.value());
+        fixedTime = m_appTiming.TryFixedUpdate();
+      }
+    }
+
+    // The graphics service is not thread safe so its pre-update is done here on the main thread. This moves it from the start of the frame
+    // to between _TryPrepareDraw and _BeginDraw of the frame being drawn. It still runs exactly once per frame and before the app update it
+    // prepares, which is what matters as its deferred garbage collection counts the calls as frames (running it again at the start of the
+    // next frame would release resources a frame early). Nothing has been recorded for the current frame yet at this point.
+    if (m_graphicsService)
+    {
+      m_graphicsService->PreUpdate();
+    }
+
+    m_stats.IsPipelined = true;
+    return m_pipelinedUpdate.Jobs->Schedule([this, updateTime]() { RunPipelinedUpdateStage(updateTime); });
+  }
+
+
+  void DemoAppManager::EndPipelinedUpdate(const JobHandle& updateJob)
+  {
+    assert(m_pipelinedUpdate.Jobs);
+    m_stats.TimeBeforeUpdateWait = m_timer.GetTimestamp();
+    m_pipelinedUpdate.Jobs->Wait(updateJob);
+    m_stats.TimeAfterUpdateWait = m_timer.GetTimestamp();
+    m_pipelinedUpdate.IsUpdateReady = true;
+  }
+
+
+  void DemoAppManager::RunPipelinedUpdateStage(const DemoTime& updateTime)
+  {
+    m_stats.TimeBeforeUpdate = m_timer.GetTimestamp();
+    m_record.DemoApp->_PreUpdate(updateTime);
+    for (const DemoTime& fixedTime : m_pipelinedUpdate.FixedUpdateTimes)
+    {
+      m_record.DemoApp->_FixedUpdate(fixedTime);
+    }
+    m_record.DemoApp->_Update(updateTime);
+    m_record.DemoApp->_PostUpdate(updateTime);
+    m_record.DemoApp->_Resolve(updateTime);
+    m_stats.TimeAfterUpdate = m_timer.GetTimestamp();
+  }
+
+
   bool DemoAppManager::ManageExitRequests(const bool bCheckExternalOnly)
   {
     assert(m_demoAppControl);
@@ -564,6 +722,8 @@ namespace Fsl
 
   void DemoAppManager::DoShutdownAppNow()
   {
+    // A update that was executed ahead of time belongs to the app instance that is being released
+    m_pipelinedUpdate.IsUpdateReady = false;
     if (m_record.DemoApp)
     {
       try
@@ -31,6 +31,7 @@
 
 #include <FslBase/Collections/Concurrent/ConcurrentQueue.hpp>
 #include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/IO/FmtPath.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
 #include <FslDemoHost/Base/Service/ContentMonitor/ContentMonitorService.hpp>
 #include <cassert>
@@ -57,20 +58,31 @@ namespace Fsl
       return;
     }
 
-    ContentMonitorResultCommand command{};
-    if (!m_commandQueue->TryDequeue(command))
+    // Process everything that is queued so a burst of changes only causes one restart
+    bool restart = false;
+    ContentMonitorResult result;
+    while (m_commandQueue->TryDequeue(result))
     {
-      return;
+      switch (result.Command)
+      {
+      case ContentMonitorResultCommand::Restart:
+        FSLLOG3_INFO("ContentMonitor: {} file(s) changed", result.ChangedFiles.size());
+        for (const auto& changedFile : result.ChangedFiles)
+        {
+          FSLLOG3_VERBOSE("- '{}'", changedFile);
+        }
+        restart = true;
+        break;
+      default:
+        FSLLOG3_WARNING("Unknown command: {}", static_cast<int32_t>(result.Command));
+        break;
+      }
     }
 
-    switch (command)
+    if (restart)
     {
-    case ContentMonitorResultCommand::Restart:
+      // The app has no way to reload individual assets, so we restart it to pick up the changes
       m_appControl->RequestAppRestart();
-      break;
-    default:
-      FSLLOG3_WARNING("Unknown command: {}", static_cast<int32_t>(command));
-      break;
     }
   }
 
@@ -84,7 +96,7 @@ namespace Fsl
 
     if (enabled)
     {
-      m_commandQueue = std::make_shared<ConcurrentQueue<ContentMonitorResultCommand>>();
+      m_commandQueue = std::make_shared<ConcurrentQueue<ContentMonitorResult>>();
       m_contentMonitorThread = std::make_shared<ContentMonitorThread>(m_commandQueue, m_contentManager->GetContentPath());
     }
     else
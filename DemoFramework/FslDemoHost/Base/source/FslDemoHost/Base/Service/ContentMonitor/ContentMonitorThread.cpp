@@ -31,19 +31,43 @@
 
 #include "ContentMonitorThread.hpp"
 #include <FslBase/Collections/Concurrent/ConcurrentQueue.hpp>
+#include <FslBase/Exceptions.hpp>
 #include <FslBase/IO/Directory.hpp>
+#include <FslBase/IO/DirectoryWatcher.hpp>
 #include <FslBase/IO/PathDeque.hpp>
 #include <FslBase/IO/PathWatcher.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
 #include <FslBase/System/IThreadContext.hpp>
 #include <FslBase/System/Threading/Thread.hpp>
 #include <cassert>
+#include <memory>
 #include <utility>
+#include <vector>
 
 namespace Fsl
 {
   namespace
   {
+    namespace LocalConfig
+    {
+      constexpr std::chrono::milliseconds CheckInterval(1000 / 5);
+    }
+
+    //! @brief Try to create a OS change notification based watcher
+    //! @return the watcher or null if its not supported
+    std::unique_ptr<IO::DirectoryWatcher> TryCreateDirectoryWatcher(const IO::Path& contentPath)
+    {
+      try
+      {
+        return std::make_unique<IO::DirectoryWatcher>(contentPath, IO::SearchOptions::AllDirectories);
+      }
+      catch (const NotSupportedException&)
+      {
+        FSLLOG3_VERBOSE("ContentMonitor: directory change notifications not available, falling back to polling");
+        return {};
+      }
+    }
+
     void AddCurrentContentFiles(IO::PathWatcher& rPathWatcher, const IO::Path& contentPath)
     {
       IO::PathDeque files;
@@ -59,11 +83,11 @@ namespace Fsl
     class ContentMonitorThreadTask
     {
       std::shared_ptr<ConcurrentQueue<bool>> m_toQueue;
-      std::weak_ptr<ConcurrentQueue<ContentMonitorResultCommand>> m_ownerQueue;
+      std::weak_ptr<ConcurrentQueue<ContentMonitorResult>> m_ownerQueue;
       IO::Path m_contentPath;
 
     public:
-      ContentMonitorThreadTask(std::shared_ptr<ConcurrentQueue<bool>> toQueue, std::weak_ptr<ConcurrentQueue<ContentMonitorResultCommand>> ownerQueue,
+      ContentMonitorThreadTask(std::shared_ptr<ConcurrentQueue<bool>> toQueue, std::weak_ptr<ConcurrentQueue<ContentMonitorResult>> ownerQueue,
                                IO::Path contentPath)
         : m_toQueue(std::move(toQueue))
         , m_ownerQueue(std::move(ownerQueue))
@@ -72,42 +96,71 @@ namespace Fsl
       }
 
       void Run()
+      {
+        std::unique_ptr<IO::DirectoryWatcher> directoryWatcher = TryCreateDirectoryWatcher(m_contentPath);
+        if (directoryWatcher)
+        {
+          RunDirectoryWatcher(*directoryWatcher);
+        }
+        else
+        {
+          RunPathWatcher();
+        }
+      }
+
+    private:
+      void RunDirectoryWatcher(IO::DirectoryWatcher& rDirectoryWatcher)
+      {
+        std::vector<IO::Path> changedFiles;
+        // As we use the queue as a cancellation token this means that if a message is in it we should shutdown
+        bool queueEntry = false;
+        while (!m_toQueue->TryDequeue(queueEntry))
+        {
+          if (rDirectoryWatcher.TryWaitForChanges(changedFiles, LocalConfig::CheckInterval) && !TrySendChanges(std::move(changedFiles)))
+          {
+            return;
+          }
+        }
+      }
+
+      //! Fallback that polls every content file for changes
+      void RunPathWatcher()
       {
         IO::PathWatcher pathWatcher;
         AddCurrentContentFiles(pathWatcher, m_contentPath);
 
+        std::vector<IO::Path> changedFiles;
         // As we use the queue as a cancellation token this means that if a message is in it we should shutdown
         bool queueEntry = false;
-        bool stopNow = false;
-        while (!stopNow && !m_toQueue->TryDequeueWait(queueEntry, std::chrono::milliseconds(1000 / 5)))
+        while (!m_toQueue->TryDequeueWait(queueEntry, LocalConfig::CheckInterval))
         {
-          // A even better solution will use the 'platform dependent' filesystem change notification interfaces.
-          // But that will also require more development time.
-
-          if (pathWatcher.Check())
+          if (pathWatcher.Check(changedFiles) && !TrySendChanges(std::move(changedFiles)))
           {
-            std::shared_ptr<ConcurrentQueue<ContentMonitorResultCommand>> ownerQueue = m_ownerQueue.lock();
-            if (ownerQueue)
-            {
-              ownerQueue->Enqueue(ContentMonitorResultCommand::Restart);
-            }
-            else
-            {
-              stopNow = true;
-            }
+            return;
           }
         }
       }
+
+      bool TrySendChanges(std::vector<IO::Path> changedFiles)
+      {
+        std::shared_ptr<ConcurrentQueue<ContentMonitorResult>> ownerQueue = m_ownerQueue.lock();
+        if (!ownerQueue)
+        {
+          return false;
+        }
+        ownerQueue->Enqueue(ContentMonitorResult(ContentMonitorResultCommand::Restart, std::move(changedFiles)));
+        return true;
+      }
     };
 
 
     struct LocalThreadContext : public IThreadContext
     {
       std::shared_ptr<ConcurrentQueue<bool>> Queue;
-      std::weak_ptr<ConcurrentQueue<ContentMonitorResultCommand>> FromQueue;
+      std::weak_ptr<ConcurrentQueue<ContentMonitorResult>> FromQueue;
       IO::Path ContentPath;
 
-      LocalThreadContext(std::shared_ptr<ConcurrentQueue<bool>> queue, std::weak_ptr<ConcurrentQueue<ContentMonitorResultCommand>> fromQueue,
+      LocalThreadContext(std::shared_ptr<ConcurrentQueue<bool>> queue, std::weak_ptr<ConcurrentQueue<ContentMonitorResult>> fromQueue,
                          IO::Path contentPath)
         : Queue(std::move(queue))
         , FromQueue(std::move(fromQueue))
@@ -135,7 +188,7 @@ namespace Fsl
   }
 
 
-  ContentMonitorThread::ContentMonitorThread(const std::weak_ptr<ConcurrentQueue<ContentMonitorResultCommand>>& fromQueue,
+  ContentMonitorThread::ContentMonitorThread(const std::weak_ptr<ConcurrentQueue<ContentMonitorResult>>& fromQueue,
                                              const IO::Path& contentPath)
     : m_queue(std::make_shared<ConcurrentQueue<bool>>())
     , m_threadTask(std::make_shared<LocalThreadContext>(m_queue, fromQueue, contentPath))
@@ -34,7 +34,7 @@
 #include <FslBase/Collections/Concurrent/ConcurrentQueue_fwd.hpp>
 #include <FslBase/IO/Path.hpp>
 #include <FslBase/System/Platform/PlatformThread.hpp>
-#include <FslDemoHost/Base/Service/ContentMonitor/ContentMonitorResultCommand.hpp>
+#include <FslDemoHost/Base/Service/ContentMonitor/ContentMonitorResult.hpp>
 
 namespace Fsl
 {
@@ -46,7 +46,7 @@ namespace Fsl
     PlatformThread m_thread;
 
   public:
-    ContentMonitorThread(const std::weak_ptr<ConcurrentQueue<ContentMonitorResultCommand>>& fromQueue, const IO::Path& contentPath);
+    ContentMonitorThread(const std::weak_ptr<ConcurrentQueue<ContentMonitorResult>>& fromQueue, const IO::Path& contentPath);
     ~ContentMonitorThread() noexcept;
   };
 }
@@ -77,7 +77,7 @@ namespace Fsl
     if (!m_entries.empty())
     {
       const ProfilerRecord entry = m_entries.back();
-      return {entry.UpdateTime, entry.DrawTime, entry.TotalTime};
+      return {entry.UpdateTime, entry.DrawTime, entry.TotalTime, entry.UpdateWaitTime};
     }
 
     return {};
@@ -89,7 +89,8 @@ namespace Fsl
     const auto numFrames = static_cast<int32_t>(m_entries.size());
     if (numFrames > 0)
     {
-      return {m_combinedTime.UpdateTime / numFrames, m_combinedTime.DrawTime / numFrames, m_combinedTime.TotalTime / numFrames};
+      return {m_combinedTime.UpdateTime / numFrames, m_combinedTime.DrawTime / numFrames, m_combinedTime.TotalTime / numFrames,
+              m_combinedTime.UpdateWaitTime / numFrames};
     }
 
     return {};
@@ -209,11 +210,12 @@ namespace Fsl
   }
 
 
-  void ProfilerService::AddFrameTimes(const uint64_t updateTime, const uint64_t drawTime, const uint64_t totalTime)
+  void ProfilerService::AddFrameTimes(const uint64_t updateTime, const uint64_t drawTime, const uint64_t totalTime, const uint64_t updateWaitTime)
   {
     const int32_t cappedUpdateTime = CapTime(updateTime);
     const int32_t cappedDrawTime = CapTime(drawTime);
     const int32_t cappedTotalTime = CapTime(totalTime);
+    const int32_t cappedUpdateWaitTime = CapTime(updateWaitTime);
 
     if (m_entries.size() >= m_maxCapacity)
     {
@@ -222,17 +224,20 @@ namespace Fsl
       m_combinedTime.UpdateTime -= frontEntry.UpdateTime;
       m_combinedTime.DrawTime -= frontEntry.DrawTime;
       m_combinedTime.TotalTime -= frontEntry.TotalTime;
+      m_combinedTime.UpdateWaitTime -= frontEntry.UpdateWaitTime;
 
       assert(m_combinedTime.UpdateTime >= 0);
       assert(m_combinedTime.DrawTime >= 0);
       assert(m_combinedTime.TotalTime >= 0);
+      assert(m_combinedTime.UpdateWaitTime >= 0);
     }
 
-    m_entries.push_back(ProfilerRecord(cappedUpdateTime, cappedDrawTime, cappedTotalTime));
+    m_entries.push_back(ProfilerRecord(cappedUpdateTime, cappedDrawTime, cappedTotalTime, cappedUpdateWaitTime));
 
     m_combinedTime.UpdateTime += cappedUpdateTime;
     m_combinedTime.DrawTime += cappedDrawTime;
     m_combinedTime.TotalTime += cappedTotalTime;
+    m_combinedTime.UpdateWaitTime += cappedUpdateWaitTime;
   }
 
 
@@ -88,6 +88,11 @@ namespace Fsl
     return Priority::Max() - 50;
   }
 
+  Priority ServicePriorityList::JobService()
+  {
+    return Priority::Max();
+  }
+
   Priority ServicePriorityList::NativeGraphicsService()
   {
     return Priority::Max() - 40;
@@ -30,14 +30,16 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
 #include <FslDemoHost/Base/Service/Texture/TextureService.hpp>
+#include <FslDemoService/JobSystem/IJobService.hpp>
 #include <FslGraphics/Texture/TextureMipMapUtil.hpp>
 
 namespace Fsl
 {
   TextureService::TextureService(const ServiceProvider& serviceProvider)
     : ThreadLocalService(serviceProvider)
-
+    , m_jobService(serviceProvider.TryGet<IJobService>())    // Try to acquire the job service so we can use it if its available.
   {
   }
 
@@ -102,21 +104,25 @@ namespace Fsl
 
   Texture TextureService::GenerateMipMaps(const Bitmap& src, const TextureMipMapFilter filter)
   {
-    return TextureMipMapUtil::GenerateMipMaps(src, filter);
+    std::shared_ptr<JobSystem> jobSystem = m_jobService ? m_jobService->GetJobSystem() : std::shared_ptr<JobSystem>();
+    return jobSystem ? TextureMipMapUtil::GenerateMipMaps(src, filter, *jobSystem) : TextureMipMapUtil::GenerateMipMaps(src, filter);
   }
 
   Texture TextureService::GenerateMipMaps(const Texture& src, const TextureMipMapFilter filter)
   {
-    return TextureMipMapUtil::GenerateMipMaps(src, filter);
+    std::shared_ptr<JobSystem> jobSystem = m_jobService ? m_jobService->GetJobSystem() : std::shared_ptr<JobSystem>();
+    return jobSystem ? TextureMipMapUtil::GenerateMipMaps(src, filter, *jobSystem) : TextureMipMapUtil::GenerateMipMaps(src, filter);
   }
 
   Texture TextureService::GenerateMipMaps(const ReadOnlyRawBitmap& src, const TextureMipMapFilter filter)
   {
-    return TextureMipMapUtil::GenerateMipMaps(src, filter);
+    std::shared_ptr<JobSystem> jobSystem = m_jobService ? m_jobService->GetJobSystem() : std::shared_ptr<JobSystem>();
+    return jobSystem ? TextureMipMapUtil::GenerateMipMaps(src, filter, *jobSystem) : TextureMipMapUtil::GenerateMipMaps(src, filter);
   }
 
   Texture TextureService::GenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter)
   {
-    return TextureMipMapUtil::GenerateMipMaps(src, filter);
+    std::shared_ptr<JobSystem> jobSystem = m_jobService ? m_jobService->GetJobSystem() : std::shared_ptr<JobSystem>();
+    return jobSystem ? TextureMipMapUtil::GenerateMipMaps(src, filter, *jobSystem) : TextureMipMapUtil::GenerateMipMaps(src, filter);
   }
 }
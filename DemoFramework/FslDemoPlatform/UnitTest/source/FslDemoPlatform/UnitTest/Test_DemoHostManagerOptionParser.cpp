@@ -0,0 +1,165 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Getopt/OptionParser.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/Time/TimeSpanUtil.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslDemoPlatform/DemoHostManagerOptionParser.hpp>
+#include <initializer_list>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestDemoHostManagerOptionParser = TestFixtureFslBase;
+
+  OptionParser::Result Parse(DemoHostManagerOptionParser& rParser, const std::initializer_list<StringViewLite> args)
+  {
+    const std::vector<StringViewLite> argList(args);
+    return OptionParser::Parse(SpanUtil::AsReadOnlySpan(argList), rParser, "help caption").Status;
+  }
+}
+
+
+TEST(TestDemoHostManagerOptionParser, Bench_Default)
+{
+  DemoHostManagerOptionParser parser(ColorSpaceType::Gamma, false);
+  EXPECT_EQ(OptionParser::Result::OK, Parse(parser, {}));
+
+  const BenchmarkConfig& config = parser.GetBenchmarkConfig();
+  EXPECT_FALSE(config.Enabled);
+  EXPECT_EQ(0u, config.FrameCount);
+  EXPECT_EQ(60u, config.WarmupFrameCount);
+  EXPECT_TRUE(config.OutputFile.IsEmpty());
+  EXPECT_EQ(-1, parser.GetExitAfterFrame());
+  EXPECT_EQ(0, parser.GetForceUpdateTime().Ticks());
+}
+
+
+TEST(TestDemoHostManagerOptionParser, Bench)
+{
+  DemoHostManagerOptionParser parser(ColorSpaceType::Gamma, false);
+  EXPECT_EQ(OptionParser::Result::OK, Parse(parser, {"--Bench", "100"}));
+
+  const BenchmarkConfig& config = parser.GetBenchmarkConfig();
+  EXPECT_TRUE(config.Enabled);
+  EXPECT_EQ(100u, config.FrameCount);
+  EXPECT_EQ(60u, config.WarmupFrameCount);
+  EXPECT_TRUE(config.OutputFile.IsEmpty());
+  // The benchmark exits after the warmup and measured frames using a fixed 60Hz update time
+  EXPECT_EQ(160, parser.GetExitAfterFrame());
+  EXPECT_EQ(TimeSpanUtil::FromMicroseconds(16667), parser.GetForceUpdateTime());
+}
+
+
+TEST(TestDemoHostManagerOptionParser, Bench_AllOptions)
+{
+  DemoHostManagerOptionParser parser(ColorSpaceType::Gamma, false);
+  EXPECT_EQ(OptionParser::Result::OK, Parse(parser, {"--Bench", "10", "--BenchWarmup", "0", "--BenchOutput", "bench.json", "--ForceUpdateTime",
+                                                     "1000", "--ExitAfterFrame", "5"}));
+
+  const BenchmarkConfig& config = parser.GetBenchmarkConfig();
+  EXPECT_TRUE(config.Enabled);
+  EXPECT_EQ(10u, config.FrameCount);
+  EXPECT_EQ(0u, config.WarmupFrameCount);
+  EXPECT_EQ(IO::Path("bench.json"), config.OutputFile);
+  // The benchmark controls the exit frame but respects the forced update time
+  EXPECT_EQ(10, parser.GetExitAfterFrame());
+  EXPECT_EQ(TimeSpanUtil::FromMicroseconds(1000), parser.GetForceUpdateTime());
+}
+
+
+TEST(TestDemoHostManagerOptionParser, BenchWarmup_WithoutBench)
+{
+  DemoHostManagerOptionParser parser(ColorSpaceType::Gamma, false);
+  EXPECT_EQ(OptionParser::Result::OK, Parse(parser, {"--BenchWarmup", "5"}));
+
+  EXPECT_FALSE(parser.GetBenchmarkConfig().Enabled);
+  EXPECT_EQ(5u, parser.GetBenchmarkConfig().WarmupFrameCount);
+  EXPECT_EQ(-1, parser.GetExitAfterFrame());
+  EXPECT_EQ(0, parser.GetForceUpdateTime().Ticks());
+}
+
+
+TEST(TestDemoHostManagerOptionParser, Bench_Invalid)
+{
+  {
+    DemoHostManagerOptionParser parser(ColorSpaceType::Gamma, false);
+    EXPECT_EQ(OptionParser::Result::Failed, Parse(parser, {"--Bench", "0"}));
+    EXPECT_FALSE(parser.GetBenchmarkConfig().Enabled);
+  }
+  {
+    DemoHostManagerOptionParser parser(ColorSpaceType::Gamma, false);
+    EXPECT_EQ(OptionParser::Result::Failed, Parse(parser, {"--Bench", "-1"}));
+    EXPECT_FALSE(parser.GetBenchmarkConfig().Enabled);
+  }
+  {
+    DemoHostManagerOptionParser parser(ColorSpaceType::Gamma, false);
+    EXPECT_EQ(OptionParser::Result::Failed, Parse(parser, {"--Bench", "abc"}));
+    EXPECT_FALSE(parser.GetBenchmarkConfig().Enabled);
+  }
+  {
+    DemoHostManagerOptionParser parser(ColorSpaceType::Gamma, false);
+    EXPECT_EQ(OptionParser::Result::Failed, Parse(parser, {"--Bench", "4294967296"}));
+    EXPECT_FALSE(parser.GetBenchmarkConfig().Enabled);
+  }
+}
+
+
+TEST(TestDemoHostManagerOptionParser, BenchWarmup_Invalid)
+{
+  {
+    DemoHostManagerOptionParser parser(ColorSpaceType::Gamma, false);
+    EXPECT_EQ(OptionParser::Result::Failed, Parse(parser, {"--Bench", "10", "--BenchWarmup", "-1"}));
+  }
+  {
+    DemoHostManagerOptionParser parser(ColorSpaceType::Gamma, false);
+    EXPECT_EQ(OptionParser::Result::Failed, Parse(parser, {"--Bench", "10", "--BenchWarmup", "abc"}));
+  }
+}
+
+
+TEST(TestDemoHostManagerOptionParser, BenchOutput_Empty)
+{
+  DemoHostManagerOptionParser parser(ColorSpaceType::Gamma, false);
+  EXPECT_EQ(OptionParser::Result::Failed, Parse(parser, {"--Bench", "10", "--BenchOutput", ""}));
+}
+
+
+TEST(TestDemoHostManagerOptionParser, Bench_FrameCountTooLarge)
+{
+  // The warmup and measured frames must fit in the exit frame
+  DemoHostManagerOptionParser parser(ColorSpaceType::Gamma, false);
+  EXPECT_EQ(OptionParser::Result::Exit, Parse(parser, {"--Bench", "2147483647", "--BenchWarmup", "1"}));
+}
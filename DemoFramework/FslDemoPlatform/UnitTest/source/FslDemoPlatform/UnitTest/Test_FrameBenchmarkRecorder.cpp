@@ -0,0 +1,228 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Time/TimeSpanUtil.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslDemoPlatform/FrameBenchmarkRecorder.hpp>
+#include <FslDemoService/Profiler/IProfilerService.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestFrameBenchmarkRecorder = TestFixtureFslBase;
+
+  //! A profiler that returns the values set by the test
+  class StubProfilerService final : public IProfilerService
+  {
+    struct Counter
+    {
+      ProfilerCustomCounterDesc Desc;
+      int32_t Value{0};
+    };
+
+    ProfilerFrameTime m_frameTime;
+    std::vector<Counter> m_counters;
+
+  public:
+    void SetFrameTime(const ProfilerFrameTime& frameTime)
+    {
+      m_frameTime = frameTime;
+    }
+
+    ProfilerFrameTime GetLastFrameTime() const override
+    {
+      return m_frameTime;
+    }
+
+    ProfilerFrameTime GetAverageFrameTime() const override
+    {
+      return m_frameTime;
+    }
+
+    int32_t GetCustomCounterCapacity() const override
+    {
+      return 16;
+    }
+
+    int32_t GetCustomCounterCount() const override
+    {
+      return static_cast<int32_t>(m_counters.size());
+    }
+
+    ProfilerCustomCounterHandle GetCustomCounterHandle(const int32_t index) const override
+    {
+      return ProfilerCustomCounterHandle(index);
+    }
+
+    ProfilerCustomCounterHandle CreateCustomCounter(const std::string& name, const int32_t minValue, const int32_t maxValue,
+                                                    const Color& colorHint) override
+    {
+      m_counters.push_back(Counter{ProfilerCustomCounterDesc(name, minValue, maxValue, colorHint), minValue});
+      return ProfilerCustomCounterHandle(static_cast<int32_t>(m_counters.size()) - 1);
+    }
+
+    void DestroyCustomCounter(const ProfilerCustomCounterHandle& handle) override
+    {
+      m_counters.erase(m_counters.begin() + handle.Value);
+    }
+
+    int32_t Get(const ProfilerCustomCounterHandle& handle) const override
+    {
+      return m_counters.at(handle.Value).Value;
+    }
+
+    void Set(const ProfilerCustomCounterHandle& handle, const int32_t value) override
+    {
+      m_counters.at(handle.Value).Value = value;
+    }
+
+    ProfilerCustomCounterDesc GetDescription(const ProfilerCustomCounterHandle& handle) const override
+    {
+      return m_counters.at(handle.Value).Desc;
+    }
+
+    uint32_t GetCustomConfigurationRevision() const override
+    {
+      return 1;
+    }
+
+    bool IsValidHandle(const ProfilerCustomCounterHandle& handle) const override
+    {
+      return handle.Value >= 0 && static_cast<std::size_t>(handle.Value) < m_counters.size();
+    }
+  };
+
+  BenchmarkConfig CreateConfig(const uint32_t frameCount, const uint32_t warmupFrameCount)
+  {
+    return {true, frameCount, warmupFrameCount, IO::Path()};
+  }
+}
+
+
+TEST(TestFrameBenchmarkRecorder, Construct_NullProfiler)
+{
+  EXPECT_THROW(FrameBenchmarkRecorder(CreateConfig(10, 0), "Test", TimeSpanUtil::FromMicroseconds(16667), {}), std::invalid_argument);
+}
+
+
+TEST(TestFrameBenchmarkRecorder, OnFrameCompleted_SkipsWarmupFrames)
+{
+  auto profiler = std::make_shared<StubProfilerService>();
+  FrameBenchmarkRecorder recorder(CreateConfig(10, 2), "Test", TimeSpanUtil::FromMicroseconds(16667), profiler);
+
+  EXPECT_EQ(0u, recorder.GetMeasuredFrameCount());
+  recorder.OnFrameCompleted();
+  recorder.OnFrameCompleted();
+  EXPECT_EQ(0u, recorder.GetMeasuredFrameCount());
+  recorder.OnFrameCompleted();
+  EXPECT_EQ(1u, recorder.GetMeasuredFrameCount());
+}
+
+
+TEST(TestFrameBenchmarkRecorder, ToJson_NoFrames)
+{
+  auto profiler = std::make_shared<StubProfilerService>();
+  FrameBenchmarkRecorder recorder(CreateConfig(10, 2), "Test", TimeSpanUtil::FromMicroseconds(16667), profiler);
+  recorder.OnFrameCompleted();
+
+  const std::string expected =
+    "{\n"
+    "  \"app\": \"Test\",\n"
+    "  \"frames\": 0,\n"
+    "  \"warmupFrames\": 2,\n"
+    "  \"fixedUpdateTimeUs\": 16667,\n"
+    "  \"unit\": \"us\",\n"
+    "  \"frame\": {\n"
+    "    \"update\": {\"samples\": 0, \"min\": 0, \"max\": 0, \"mean\": 0.00, \"p50\": 0, \"p95\": 0, \"p99\": 0},\n"
+    "    \"draw\": {\"samples\": 0, \"min\": 0, \"max\": 0, \"mean\": 0.00, \"p50\": 0, \"p95\": 0, \"p99\": 0},\n"
+    "    \"total\": {\"samples\": 0, \"min\": 0, \"max\": 0, \"mean\": 0.00, \"p50\": 0, \"p95\": 0, \"p99\": 0},\n"
+    "    \"updateWait\": {\"samples\": 0, \"min\": 0, \"max\": 0, \"mean\": 0.00, \"p50\": 0, \"p95\": 0, \"p99\": 0}\n"
+    "  },\n"
+    "  \"counters\": {}\n"
+    "}\n";
+  EXPECT_EQ(expected, recorder.ToJson());
+}
+
+
+TEST(TestFrameBenchmarkRecorder, ToJson_FramesAndCounters)
+{
+  auto profiler = std::make_shared<StubProfilerService>();
+  const ProfilerCustomCounterHandle hBatches = profiler->CreateCustomCounter("batches", 0, 100, Colors::White());
+  FrameBenchmarkRecorder recorder(CreateConfig(3, 1), "Test \"UI\"\\", TimeSpanUtil::FromMicroseconds(1000), profiler);
+
+  // Warmup frame, it is not recorded
+  profiler->SetFrameTime(ProfilerFrameTime(1000, 1000, 1000, 1000));
+  profiler->Set(hBatches, 1000);
+  recorder.OnFrameCompleted();
+
+  profiler->SetFrameTime(ProfilerFrameTime(30, 10, 45, 0));
+  profiler->Set(hBatches, 4);
+  recorder.OnFrameCompleted();
+  profiler->SetFrameTime(ProfilerFrameTime(10, 20, 35, 1));
+  profiler->Set(hBatches, 5);
+  recorder.OnFrameCompleted();
+
+  // A counter created during the measurement only has the samples of the frames it existed in
+  const ProfilerCustomCounterHandle hTabs = profiler->CreateCustomCounter("a\tb", 0, 100, Colors::White());
+  profiler->Set(hTabs, 9);
+  profiler->SetFrameTime(ProfilerFrameTime(20, 30, 55, 2));
+  profiler->Set(hBatches, 4);
+  recorder.OnFrameCompleted();
+
+  EXPECT_EQ(3u, recorder.GetMeasuredFrameCount());
+
+  const std::string expected =
+    "{\n"
+    "  \"app\": \"Test \\\"UI\\\"\\\\\",\n"
+    "  \"frames\": 3,\n"
+    "  \"warmupFrames\": 1,\n"
+    "  \"fixedUpdateTimeUs\": 1000,\n"
+    "  \"unit\": \"us\",\n"
+    "  \"frame\": {\n"
+    "    \"update\": {\"samples\": 3, \"min\": 10, \"max\": 30, \"mean\": 20.00, \"p50\": 20, \"p95\": 30, \"p99\": 30},\n"
+    "    \"draw\": {\"samples\": 3, \"min\": 10, \"max\": 30, \"mean\": 20.00, \"p50\": 20, \"p95\": 30, \"p99\": 30},\n"
+    "    \"total\": {\"samples\": 3, \"min\": 35, \"max\": 55, \"mean\": 45.00, \"p50\": 45, \"p95\": 55, \"p99\": 55},\n"
+    "    \"updateWait\": {\"samples\": 3, \"min\": 0, \"max\": 2, \"mean\": 1.00, \"p50\": 1, \"p95\": 2, \"p99\": 2}\n"
+    "  },\n"
+    "  \"counters\": {\n"
+    "    \"batches\": {\"samples\": 3, \"min\": 4, \"max\": 5, \"mean\": 4.33, \"p50\": 4, \"p95\": 5, \"p99\": 5},\n"
+    "    \"a\\u0009b\": {\"samples\": 1, \"min\": 9, \"max\": 9, \"mean\": 9.00, \"p50\": 9, \"p95\": 9, \"p99\": 9}\n"
+    "  }\n"
+    "}\n";
+  EXPECT_EQ(expected, recorder.ToJson());
+}
@@ -0,0 +1,163 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslDemoPlatform/FrameBenchmarkSummary.hpp>
+#include <stdexcept>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestFrameBenchmarkSummary = TestFixtureFslBase;
+
+  std::vector<int64_t> CreateSequence(const int64_t count)
+  {
+    std::vector<int64_t> values;
+    for (int64_t i = 1; i <= count; ++i)
+    {
+      values.push_back(i);
+    }
+    return values;
+  }
+}
+
+
+TEST(TestFrameBenchmarkSummary, GetPercentile_NoSamples)
+{
+  const std::vector<int64_t> values;
+  EXPECT_THROW(FrameBenchmarkSummaryUtil::GetPercentile(values, 0), std::invalid_argument);
+  EXPECT_THROW(FrameBenchmarkSummaryUtil::GetPercentile(values, 50), std::invalid_argument);
+  EXPECT_THROW(FrameBenchmarkSummaryUtil::GetPercentile(values, 100), std::invalid_argument);
+}
+
+
+TEST(TestFrameBenchmarkSummary, GetPercentile_InvalidPercentile)
+{
+  const std::vector<int64_t> values = CreateSequence(10);
+  EXPECT_THROW(FrameBenchmarkSummaryUtil::GetPercentile(values, 101), std::invalid_argument);
+}
+
+
+TEST(TestFrameBenchmarkSummary, GetPercentile_SingleSample)
+{
+  const std::vector<int64_t> values = {42};
+  EXPECT_EQ(42, FrameBenchmarkSummaryUtil::GetPercentile(values, 0));
+  EXPECT_EQ(42, FrameBenchmarkSummaryUtil::GetPercentile(values, 50));
+  EXPECT_EQ(42, FrameBenchmarkSummaryUtil::GetPercentile(values, 99));
+  EXPECT_EQ(42, FrameBenchmarkSummaryUtil::GetPercentile(values, 100));
+}
+
+
+TEST(TestFrameBenchmarkSummary, GetPercentile_HundredSamples)
+{
+  const std::vector<int64_t> values = CreateSequence(100);
+  EXPECT_EQ(1, FrameBenchmarkSummaryUtil::GetPercentile(values, 0));
+  EXPECT_EQ(1, FrameBenchmarkSummaryUtil::GetPercentile(values, 1));
+  EXPECT_EQ(50, FrameBenchmarkSummaryUtil::GetPercentile(values, 50));
+  EXPECT_EQ(99, FrameBenchmarkSummaryUtil::GetPercentile(values, 99));
+  EXPECT_EQ(100, FrameBenchmarkSummaryUtil::GetPercentile(values, 100));
+}
+
+
+TEST(TestFrameBenchmarkSummary, GetPercentile_TenSamples)
+{
+  // The nearest rank is rounded up, so p99 of ten samples is the largest sample
+  const std::vector<int64_t> values = {10, 20, 30, 40, 50, 60, 70, 80, 90, 100};
+  EXPECT_EQ(10, FrameBenchmarkSummaryUtil::GetPercentile(values, 0));
+  EXPECT_EQ(10, FrameBenchmarkSummaryUtil::GetPercentile(values, 10));
+  EXPECT_EQ(20, FrameBenchmarkSummaryUtil::GetPercentile(values, 11));
+  EXPECT_EQ(50, FrameBenchmarkSummaryUtil::GetPercentile(values, 50));
+  EXPECT_EQ(60, FrameBenchmarkSummaryUtil::GetPercentile(values, 51));
+  EXPECT_EQ(100, FrameBenchmarkSummaryUtil::GetPercentile(values, 99));
+  EXPECT_EQ(100, FrameBenchmarkSummaryUtil::GetPercentile(values, 100));
+}
+
+
+TEST(TestFrameBenchmarkSummary, Summarize_NoSamples)
+{
+  const FrameBenchmarkSummary summary = FrameBenchmarkSummaryUtil::Summarize({});
+
+  EXPECT_EQ(0u, summary.Samples);
+  EXPECT_EQ(0, summary.Min);
+  EXPECT_EQ(0, summary.Max);
+  EXPECT_EQ(0.0, summary.Mean);
+  EXPECT_EQ(0, summary.P50);
+  EXPECT_EQ(0, summary.P95);
+  EXPECT_EQ(0, summary.P99);
+}
+
+
+TEST(TestFrameBenchmarkSummary, Summarize_SingleSample)
+{
+  const FrameBenchmarkSummary summary = FrameBenchmarkSummaryUtil::Summarize({7});
+
+  EXPECT_EQ(1u, summary.Samples);
+  EXPECT_EQ(7, summary.Min);
+  EXPECT_EQ(7, summary.Max);
+  EXPECT_EQ(7.0, summary.Mean);
+  EXPECT_EQ(7, summary.P50);
+  EXPECT_EQ(7, summary.P95);
+  EXPECT_EQ(7, summary.P99);
+}
+
+
+TEST(TestFrameBenchmarkSummary, Summarize_Unsorted)
+{
+  const FrameBenchmarkSummary summary = FrameBenchmarkSummaryUtil::Summarize({5, -1, 4, 2, 3, 2});
+
+  EXPECT_EQ(6u, summary.Samples);
+  EXPECT_EQ(-1, summary.Min);
+  EXPECT_EQ(5, summary.Max);
+  EXPECT_DOUBLE_EQ(15.0 / 6.0, summary.Mean);
+  EXPECT_EQ(2, summary.P50);
+  EXPECT_EQ(5, summary.P95);
+  EXPECT_EQ(5, summary.P99);
+}
+
+
+TEST(TestFrameBenchmarkSummary, Summarize_HundredSamples)
+{
+  const std::vector<int64_t> values = CreateSequence(100);
+  // Reverse the order to check that the values are sorted
+  const std::vector<int64_t> reversed(values.rbegin(), values.rend());
+  const FrameBenchmarkSummary summary = FrameBenchmarkSummaryUtil::Summarize(reversed);
+
+  EXPECT_EQ(100u, summary.Samples);
+  EXPECT_EQ(1, summary.Min);
+  EXPECT_EQ(100, summary.Max);
+  EXPECT_DOUBLE_EQ(50.5, summary.Mean);
+  EXPECT_EQ(50, summary.P50);
+  EXPECT_EQ(95, summary.P95);
+  EXPECT_EQ(99, summary.P99);
+}
@@ -0,0 +1,62 @@
+#ifndef FSLDEMOPLATFORM_BENCHMARKCONFIG_HPP
+#define FSLDEMOPLATFORM_BENCHMARKCONFIG_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <utility>
+
+namespace Fsl
+{
+  struct BenchmarkConfig
+  {
+    bool Enabled{false};
+    //! The number of frames that are measured
+    uint32_t FrameCount{0};
+    //! The number of frames that are rendered before the measurement starts
+    uint32_t WarmupFrameCount{0};
+    //! The file the json report is written to, if empty the report is written to the log
+    IO::Path OutputFile;
+
+    BenchmarkConfig() = default;
+
+    BenchmarkConfig(const bool enabled, const uint32_t frameCount, const uint32_t warmupFrameCount, IO::Path outputFile)
+      : Enabled(enabled)
+      , FrameCount(frameCount)
+      , WarmupFrameCount(warmupFrameCount)
+      , OutputFile(std::move(outputFile))
+    {
+    }
+  };
+}
+
+#endif
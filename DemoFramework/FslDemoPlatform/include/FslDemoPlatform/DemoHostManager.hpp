@@ -44,6 +44,7 @@ namespace Fsl
   struct Point2;
   class DemoAppManager;
   class DemoHostManagerOptionParser;
+  class FrameBenchmarkRecorder;
   struct DemoWindowMetrics;
   class IDemoHost;
   class IGraphicsServiceControl;
@@ -82,6 +83,8 @@ namespace Fsl
     HighResolutionTimer m_timer;
     //! Only used if m_exitAfterDuration.Enabled is true
     std::chrono::microseconds m_exitTime;
+    //! Only allocated when benchmarking
+    std::unique_ptr<FrameBenchmarkRecorder> m_benchmarkRecorder;
 
   public:
     DemoHostManager(const DemoSetup& demoSetup, const std::shared_ptr<DemoHostManagerOptionParser>& demoHostManagerOptionParser);
@@ -33,10 +33,12 @@
 
 #include <FslBase/Getopt/IOptionParser.hpp>
 #include <FslBase/ITag.hpp>
+#include <FslBase/Log/AsyncLogConfig.hpp>
 #include <FslBase/Time/TimeSpan.hpp>
 #include <FslDemoApp/Base/DemoAppStatsFlags.hpp>
 #include <FslDemoHost/Base/LogStatsMode.hpp>
 #include <FslDemoHost/Base/Service/Test/TestScreenshotConfig.hpp>
+#include <FslDemoPlatform/BenchmarkConfig.hpp>
 #include <FslDemoPlatform/DurationExitConfig.hpp>
 #include <FslDemoService/Graphics/ColorSpaceType.hpp>
 #include <FslGraphics/ImageFormat.hpp>
@@ -60,6 +62,10 @@ namespace Fsl
     bool m_appFirewall{false};
     bool m_enableBasic2DPrealloc{false};
     bool m_contentMonitor{false};
+    bool m_logAsync{false};
+    bool m_pipelinedUpdate{false};
+    AsyncLogConfig m_asyncLogConfig;
+    BenchmarkConfig m_benchmarkConfig;
 
   public:
     DemoHostManagerOptionParser(const DemoHostManagerOptionParser&) = delete;
@@ -129,9 +135,33 @@ namespace Fsl
 
     void RequestEnableAppFirewall();
 
+    //! Check if the async log sink was requested
+    bool IsLogAsyncEnabled() const noexcept
+    {
+      return m_logAsync;
+    }
+
+    AsyncLogConfig GetAsyncLogConfig() const noexcept
+    {
+      return m_asyncLogConfig;
+    }
+
+    //! Check if pipelined update was requested (it is only used for apps that support it)
+    bool IsPipelinedUpdateEnabled() const noexcept
+    {
+      return m_pipelinedUpdate;
+    }
+
+    //! Get the benchmark config
+    const BenchmarkConfig& GetBenchmarkConfig() const noexcept
+    {
+      return m_benchmarkConfig;
+    }
+
   private:
     OptionParseResult ParseDurationExitConfig(const StringViewLite& strOptArg);
     OptionParseResult ParseScreenshotNamePrefix(const StringViewLite& strOptArg);
+    OptionParseResult ParseBenchmarkOutput(const StringViewLite& strOptArg);
   };
 }
 
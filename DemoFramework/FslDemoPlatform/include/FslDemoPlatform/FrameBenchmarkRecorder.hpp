@@ -0,0 +1,98 @@
+#ifndef FSLDEMOPLATFORM_FRAMEBENCHMARKRECORDER_HPP
+#define FSLDEMOPLATFORM_FRAMEBENCHMARKRECORDER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Time/TimeSpan.hpp>
+#include <FslDemoPlatform/BenchmarkConfig.hpp>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Fsl
+{
+  class IProfilerService;
+
+  //! @brief Records the profiler times of each frame while benchmarking and produces a json report with the percentiles.
+  class FrameBenchmarkRecorder
+  {
+    struct Channel
+    {
+      std::string Name;
+      std::vector<int64_t> Values;
+
+      explicit Channel(std::string name, const std::size_t capacity)
+        : Name(std::move(name))
+      {
+        Values.reserve(capacity);
+      }
+    };
+
+    BenchmarkConfig m_config;
+    std::string m_appName;
+    TimeSpan m_fixedUpdateTime;
+    std::shared_ptr<IProfilerService> m_profilerService;
+    uint32_t m_completedFrames{0};
+    //! The update, draw, total and update wait times in microseconds
+    std::vector<Channel> m_frameChannels;
+    //! The custom profiler counters, they are matched by name as apps can create and destroy them at any time
+    std::vector<Channel> m_counterChannels;
+
+  public:
+    FrameBenchmarkRecorder(const FrameBenchmarkRecorder&) = delete;
+    FrameBenchmarkRecorder& operator=(const FrameBenchmarkRecorder&) = delete;
+
+    FrameBenchmarkRecorder(BenchmarkConfig config, std::string appName, const TimeSpan fixedUpdateTime,
+                           std::shared_ptr<IProfilerService> profilerService);
+
+    //! @brief Should be called after each frame swap has been completed, the warmup frames are skipped.
+    void OnFrameCompleted();
+
+    //! @brief Get the number of measured frames
+    uint32_t GetMeasuredFrameCount() const noexcept
+    {
+      return m_completedFrames > m_config.WarmupFrameCount ? m_completedFrames - m_config.WarmupFrameCount : 0u;
+    }
+
+    //! @brief Get the json report
+    std::string ToJson() const;
+
+    //! @brief Write the report to the configured output file or the log
+    void WriteReport() const;
+
+  private:
+    Channel& GetCounterChannel(const std::string& name);
+    static void AppendChannels(std::string& rDst, const char* const pszName, const std::vector<Channel>& channels);
+  };
+}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef FSLDEMOPLATFORM_FRAMEBENCHMARKSUMMARY_HPP
+#define FSLDEMOPLATFORM_FRAMEBENCHMARKSUMMARY_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief The statistics of one benchmark channel, all values are zero if there were no samples
+  struct FrameBenchmarkSummary
+  {
+    std::size_t Samples{0};
+    int64_t Min{0};
+    int64_t Max{0};
+    double Mean{0.0};
+    int64_t P50{0};
+    int64_t P95{0};
+    int64_t P99{0};
+  };
+
+  namespace FrameBenchmarkSummaryUtil
+  {
+    //! @brief Get the nearest rank percentile of the sorted values.
+    //! @param sortedValues the values sorted in ascending order (can not be empty)
+    //! @param percentile the percentile (0 <= percentile <= 100), zero returns the smallest value.
+    //! @throws std::invalid_argument if sortedValues is empty or the percentile is larger than 100.
+    int64_t GetPercentile(const std::vector<int64_t>& sortedValues, const uint32_t percentile);
+
+    //! @brief Summarize the values (they do not need to be sorted)
+    FrameBenchmarkSummary Summarize(std::vector<int64_t> values);
+  }
+}
+
+#endif
@@ -41,7 +41,9 @@
 #include <FslDemoHost/Base/Service/Test/ITestService.hpp>
 #include <FslDemoPlatform/DemoHostManager.hpp>
 #include <FslDemoPlatform/DemoHostManagerOptionParser.hpp>
+#include <FslDemoPlatform/FrameBenchmarkRecorder.hpp>
 #include <FslDemoService/Graphics/Control/IGraphicsServiceControl.hpp>
+#include <FslDemoService/Profiler/IProfilerService.hpp>
 #include <FslNativeWindow/Base/NativeWindowEventQueue.hpp>
 #include <FslService/Impl/Threading/IServiceHostLooper.hpp>
 #include <cassert>
@@ -65,8 +67,10 @@ namespace Fsl
     m_nativeWindowEventSender = serviceProvider.Get<INativeWindowEventSender>();
     m_hostInfoControl = serviceProvider.Get<IHostInfoControl>();
 
+    const BenchmarkConfig& benchmarkConfig = demoHostManagerOptionParser->GetBenchmarkConfig();
     HostConfig hostConfig(demoHostManagerOptionParser->IsAppFirewallEnabled(), demoHostManagerOptionParser->IsContentMonitorEnabled(),
-                          demoHostManagerOptionParser->IsStatsEnabled(), m_basic2DPreallocEnabled, demoHostManagerOptionParser->GetAppStatsFlags());
+                          demoHostManagerOptionParser->IsStatsEnabled(), m_basic2DPreallocEnabled, demoHostManagerOptionParser->GetAppStatsFlags(),
+                          benchmarkConfig.Enabled);
     m_hostInfoControl->SetConfig(hostConfig);
 
     // Set the config we are using for the app host so it can be retrieved from IHostInfo
@@ -89,7 +93,16 @@ namespace Fsl
     m_demoAppManager = std::make_shared<DemoAppManager>(
       demoSetup.App.AppSetup, demoAppConfig, hostConfig.StatOverlay, demoHostManagerOptionParser->GetLogStatsMode(),
       demoHostManagerOptionParser->GetAppStatsFlags(), hostConfig.AppFirewall, hostConfig.ContentMonitor,
-      demoHostManagerOptionParser->GetForceUpdateTime(), !m_demoHostCaps.IsEnabled(DemoHostCaps::Flags::AppRenderedSystemOverlay));
+      demoHostManagerOptionParser->GetForceUpdateTime(), !m_demoHostCaps.IsEnabled(DemoHostCaps::Flags::AppRenderedSystemOverlay),
+      demoHostManagerOptionParser->IsPipelinedUpdateEnabled());
+
+    if (benchmarkConfig.Enabled)
+    {
+      FSLLOG3_WARNING_IF(!m_demoHost->IsConsoleBaseHost(), "Benchmarking with a windowed host, the frame times include the presentation");
+      m_benchmarkRecorder = std::make_unique<FrameBenchmarkRecorder>(benchmarkConfig, demoSetup.App.AppSetup.ApplicationName,
+                                                                     demoHostManagerOptionParser->GetForceUpdateTime(),
+                                                                     serviceProvider.Get<IProfilerService>());
+    }
 
     FSLLOG3_VERBOSE("DemoHostManager: Processing messages");
 
@@ -147,6 +160,10 @@ namespace Fsl
         mainLoopCallbackFunction();
       }
     }
+    if (m_benchmarkRecorder)
+    {
+      m_benchmarkRecorder->WriteReport();
+    }
     return m_demoAppManager->CloseApp();
   }
 
@@ -162,6 +179,10 @@ namespace Fsl
       case SwapBuffersResult::Completed:
         m_demoAppManager->OnFrameSwapCompleted();
         m_testService->OnFrameSwapCompleted();
+        if (m_benchmarkRecorder)
+        {
+          m_benchmarkRecorder->OnFrameCompleted();
+        }
         m_demoAppManager->ProcessDone();
 
         // Provide support for exiting after a number of successfully rendered frames
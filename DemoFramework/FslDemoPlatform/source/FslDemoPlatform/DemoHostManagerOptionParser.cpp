@@ -46,6 +46,7 @@
 #include <FslVersion/FslVersion.hpp>
 #include <fmt/format.h>
 #include <array>
+#include <limits>
 
 namespace Fsl
 {
@@ -69,6 +70,18 @@ namespace Fsl
       constexpr auto ContentMonitor = "ContentMonitor";
       constexpr auto ForceUpdateTime = "ForceUpdateTime";
       constexpr auto Version = "Version";
+      constexpr auto LogAsync = "LogAsync";
+      constexpr auto PipelinedUpdate = "PipelinedUpdate";
+      constexpr auto Bench = "Bench";
+      constexpr auto BenchWarmup = "BenchWarmup";
+      constexpr auto BenchOutput = "BenchOutput";
+    }
+
+    namespace LocalConfig
+    {
+      constexpr uint32_t DefaultBenchmarkWarmupFrames = 60;
+      //! The fixed update time used while benchmarking unless ForceUpdateTime was specified (60Hz)
+      constexpr uint32_t DefaultBenchmarkUpdateTimeMicroseconds = 16667;
     }
 
 
@@ -91,7 +104,12 @@ namespace Fsl
         EnableBasic2DPrealloc,
         ScreenshotNameScheme,
         ForceUpdateTime,
-        Version
+        Version,
+        LogAsync,
+        PipelinedUpdate,
+        Bench,
+        BenchWarmup,
+        BenchOutput
       };
     };
 
@@ -129,6 +147,11 @@ namespace Fsl
       OptionArg<BasicToneMapper>("clamp", "default, colors are clamped to SDR ranges", BasicToneMapper::Clamp)};
 
 
+    constexpr std::array<OptionArg<AsyncLogOverflowPolicy>, 2> LogAsyncArgs = {
+      OptionArg<AsyncLogOverflowPolicy>("block", "default, wait for room when the log buffer is full", AsyncLogOverflowPolicy::Block),
+      OptionArg<AsyncLogOverflowPolicy>("drop", "discard lines when the log buffer is full", AsyncLogOverflowPolicy::Drop)};
+
+
     constexpr ReadOnlySpan<OptionArg<ImageFormat>> GetScreenshotFormat(const bool hdrEnabled) noexcept
     {
       return hdrEnabled ? SpanUtil::AsReadOnlySpan(ScreenshotFormatHDR) : SpanUtil::AsReadOnlySpan(ScreenshotFormat);
@@ -159,6 +182,7 @@ namespace Fsl
     : m_colorSpaceType(colorSpaceType)
     , m_hdrEnabled(hdrEnabled)
     , m_screenshotConfig(TestScreenshotNameScheme::FrameNumber, ImageFormat::Png, 0, "Screenshot", BasicToneMapper::Clamp)
+    , m_benchmarkConfig(false, 0, LocalConfig::DefaultBenchmarkWarmupFrames, IO::Path())
   {
   }
 
@@ -204,6 +228,20 @@ namespace Fsl
       ArgName::ForceUpdateTime, OptionArgument::OptionRequired, CommandId::ForceUpdateTime,
       "Force the update time to be the given value in microseconds (can be useful when taking a lot of screen-shots). If 0 this option is disabled");
     rOptions.emplace_back(ArgName::Version, OptionArgument::OptionNone, CommandId::Version, "Print version information");
+    rOptions.emplace_back(ArgName::LogAsync, OptionArgument::OptionRequired, CommandId::LogAsync,
+                          fmt::format("Write log lines from a background thread so logging never blocks on console output: {}.",
+                                      OptionArgUtil::BuildArgumentString(SpanUtil::AsReadOnlySpan(LogAsyncArgs), true)));
+    rOptions.emplace_back(ArgName::PipelinedUpdate, OptionArgument::OptionRequired, CommandId::PipelinedUpdate,
+                          "Enable/disable pipelined update. If the app supports it the update of the next frame runs on a worker thread while "
+                          "the current frame is drawn (defaults to false)");
+    rOptions.emplace_back(ArgName::Bench, OptionArgument::OptionRequired, CommandId::Bench,
+                          "Run the app for the given number of frames using a fixed update time and report the percentiles of the update, draw "
+                          "and profiler counter times as json. Use it with the Stub host to measure the CPU cost without a GPU");
+    rOptions.emplace_back(ArgName::BenchWarmup, OptionArgument::OptionRequired, CommandId::BenchWarmup,
+                          fmt::format("The number of frames to render before the benchmark measurement starts (defaults to {})",
+                                      LocalConfig::DefaultBenchmarkWarmupFrames));
+    rOptions.emplace_back(ArgName::BenchOutput, OptionArgument::OptionRequired, CommandId::BenchOutput,
+                          "Write the benchmark json report to the given file instead of the log");
   }
 
 
@@ -277,6 +315,27 @@ namespace Fsl
       StringParseUtil::Parse(boolValue, strOptArg);
       m_enableBasic2DPrealloc = boolValue;
       return OptionParseResult::Parsed;
+    case CommandId::LogAsync:
+      m_logAsync = true;
+      return OptionArgUtil::TryParseOptionArg(ArgName::LogAsync, SpanUtil::AsReadOnlySpan(LogAsyncArgs), strOptArg, m_asyncLogConfig.OverflowPolicy);
+    case CommandId::PipelinedUpdate:
+      StringParseUtil::Parse(boolValue, strOptArg);
+      m_pipelinedUpdate = boolValue;
+      return OptionParseResult::Parsed;
+    case CommandId::Bench:
+      StringParseUtil::Parse(m_benchmarkConfig.FrameCount, strOptArg);
+      if (m_benchmarkConfig.FrameCount == 0u)
+      {
+        FSLLOG3_ERROR("{} must be at least one frame", ArgName::Bench);
+        return OptionParseResult::Failed;
+      }
+      m_benchmarkConfig.Enabled = true;
+      return OptionParseResult::Parsed;
+    case CommandId::BenchWarmup:
+      StringParseUtil::Parse(m_benchmarkConfig.WarmupFrameCount, strOptArg);
+      return OptionParseResult::Parsed;
+    case CommandId::BenchOutput:
+      return ParseBenchmarkOutput(strOptArg);
     case CommandId::Version:
       FSLLOG3_INFO("Release {}, GitCommit '{}'", ReleaseVersion::CurrentVersion(), ReleaseVersion::GetGitCommit());
       return OptionParseResult::Parsed;
@@ -289,6 +348,24 @@ namespace Fsl
 
   bool DemoHostManagerOptionParser::ParsingComplete()
   {
+    if (m_benchmarkConfig.Enabled)
+    {
+      // The benchmark controls the frame count
+      const uint64_t totalFrames = static_cast<uint64_t>(m_benchmarkConfig.WarmupFrameCount) + m_benchmarkConfig.FrameCount;
+      if (totalFrames > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()))
+      {
+        FSLLOG3_ERROR("The benchmark frame count is too large");
+        return false;
+      }
+      FSLLOG3_WARNING_IF(m_exitAfterFrame >= 0, "{} is ignored when {} is used", ArgName::ExitAfterFrame, ArgName::Bench);
+      m_exitAfterFrame = static_cast<int32_t>(totalFrames);
+
+      // Use a fixed time step so the app does the same work each run
+      if (m_forceUpdateTime.Ticks() == 0)
+      {
+        m_forceUpdateTime = TimeSpanUtil::FromMicroseconds(LocalConfig::DefaultBenchmarkUpdateTimeMicroseconds);
+      }
+    }
     return true;
   }
 
@@ -376,6 +453,26 @@ namespace Fsl
     return OptionParseResult::Parsed;
   }
 
+  OptionParseResult DemoHostManagerOptionParser::ParseBenchmarkOutput(const StringViewLite& strOptArg)
+  {
+    if (strOptArg.empty())
+    {
+      FSLLOG3_ERROR("{} can not be empty", ArgName::BenchOutput);
+      return OptionParseResult::Failed;
+    }
+    try
+    {
+      m_benchmarkConfig.OutputFile = IO::Path(strOptArg);
+      return OptionParseResult::Parsed;
+    }
+    catch (const std::exception& ex)
+    {
+      FSLLOG3_ERROR("Failed to parse benchmark output file with error: {}", ex.what());
+      return OptionParseResult::Failed;
+    }
+  }
+
+
   OptionParseResult DemoHostManagerOptionParser::ParseScreenshotNamePrefix(const StringViewLite& strOptArg)
   {
     try
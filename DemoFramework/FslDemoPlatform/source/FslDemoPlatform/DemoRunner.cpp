@@ -32,6 +32,7 @@
 #include <FslBase/ExceptionMessageFormatter.hpp>
 #include <FslBase/Getopt/OptionBaseValues.hpp>
 #include <FslBase/Getopt/OptionParser.hpp>
+#include <FslBase/Log/AsyncLog.hpp>
 #include <FslBase/Log/Log3Core.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
 #include <FslBase/Span/SpanUtil_Vector.hpp>
@@ -110,6 +111,44 @@ namespace Fsl
       return verbosityLevel;
     }
 
+    //! Route logging through the async sink while the demo runs (if requested)
+    class ScopedAsyncLog
+    {
+      bool m_enabled{false};
+
+    public:
+      ScopedAsyncLog(const ScopedAsyncLog&) = delete;
+      ScopedAsyncLog& operator=(const ScopedAsyncLog&) = delete;
+
+      explicit ScopedAsyncLog(const DemoHostManagerOptionParser& optionParser)
+      {
+        if (optionParser.IsLogAsyncEnabled())
+        {
+          if (AsyncLog::IsSupported())
+          {
+            AsyncLog::Enable(optionParser.GetAsyncLogConfig());
+            m_enabled = true;
+          }
+          else
+          {
+            FSLLOG3_WARNING("LogAsync is not supported on this platform, logging synchronously");
+          }
+        }
+      }
+
+      ~ScopedAsyncLog()
+      {
+        if (m_enabled)
+        {
+          AsyncLog::Disable();
+          const AsyncLogStats stats = AsyncLog::GetStats();
+          FSLLOG3_VERBOSE("AsyncLog: {} lines written, {} lines dropped, max backlog {}", stats.LinesWritten, stats.LinesDropped,
+                          stats.MaxBacklogDepth);
+        }
+      }
+    };
+
+
     OptionParser::ParseResult TryParseInputArguments(ReadOnlySpan<StringViewLite> arguments, const DemoBasicSetup& demoSetup,
                                                      const std::shared_ptr<DemoHostManagerOptionParser>& demoHostManagerOptionParser)
     {
@@ -237,6 +276,8 @@ namespace Fsl
         return parseResult.Status == OptionParser::Result::Failed ? EXIT_FAILURE : EXIT_SUCCESS;
       }
 
+      ScopedAsyncLog scopedAsyncLog(*demoHostManagerOptionParser);
+
       // Start the services, after the command line parameters have been processed
       serviceFramework->LaunchGlobalServices();
       serviceFramework->LaunchThreads();
@@ -31,6 +31,7 @@
 
 
 #include "DemoSignalHandler.hpp"
+#include <FslBase/Log/AsyncLog.hpp>
 #include <cstdlib>
 #if defined(__QNXNTO__)
 #include <signal.h>
@@ -117,4 +118,6 @@ extern "C" void DemoFrameworkSignalHandler(int /*signum*/)
   // WARNING: code inside this should more or less behave as if you are creating a interrupt handler
   //          so be EXTREMELY careful here!!!
   g_terminationRequested = 1;
+  // Only sets a lock free atomic flag, so the background log writer flushes pending lines before we exit
+  Fsl::AsyncLog::RequestFlush();
 }
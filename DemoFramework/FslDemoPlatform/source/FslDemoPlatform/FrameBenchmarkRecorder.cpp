@@ -0,0 +1,187 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/File.hpp>
+#include <FslBase/Log/IO/FmtPath.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslDemoPlatform/FrameBenchmarkRecorder.hpp>
+#include <FslDemoPlatform/FrameBenchmarkSummary.hpp>
+#include <FslDemoService/Profiler/IProfilerService.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr std::size_t FrameChannelUpdate = 0;
+      constexpr std::size_t FrameChannelDraw = 1;
+      constexpr std::size_t FrameChannelTotal = 2;
+      constexpr std::size_t FrameChannelUpdateWait = 3;
+    }
+
+    void AppendJsonString(std::string& rDst, const std::string& value)
+    {
+      rDst += '"';
+      for (const char ch : value)
+      {
+        switch (ch)
+        {
+        case '"':
+          rDst += "\\\"";
+          break;
+        case '\\':
+          rDst += "\\\\";
+          break;
+        default:
+          if (static_cast<unsigned char>(ch) < 0x20)
+          {
+            fmt::format_to(std::back_inserter(rDst), "\\u{:04x}", static_cast<uint32_t>(static_cast<unsigned char>(ch)));
+          }
+          else
+          {
+            rDst += ch;
+          }
+          break;
+        }
+      }
+      rDst += '"';
+    }
+  }
+
+
+  FrameBenchmarkRecorder::FrameBenchmarkRecorder(BenchmarkConfig config, std::string appName, const TimeSpan fixedUpdateTime,
+                                                 std::shared_ptr<IProfilerService> profilerService)
+    : m_config(std::move(config))
+    , m_appName(std::move(appName))
+    , m_fixedUpdateTime(fixedUpdateTime)
+    , m_profilerService(std::move(profilerService))
+  {
+    if (!m_profilerService)
+    {
+      throw std::invalid_argument("profilerService can not be null");
+    }
+    m_frameChannels.reserve(4);
+    m_frameChannels.emplace_back("update", m_config.FrameCount);
+    m_frameChannels.emplace_back("draw", m_config.FrameCount);
+    m_frameChannels.emplace_back("total", m_config.FrameCount);
+    m_frameChannels.emplace_back("updateWait", m_config.FrameCount);
+  }
+
+
+  void FrameBenchmarkRecorder::OnFrameCompleted()
+  {
+    ++m_completedFrames;
+    if (m_completedFrames <= m_config.WarmupFrameCount)
+    {
+      return;
+    }
+
+    const ProfilerFrameTime frameTime = m_profilerService->GetLastFrameTime();
+    m_frameChannels[LocalConfig::FrameChannelUpdate].Values.push_back(frameTime.UpdateTime);
+    m_frameChannels[LocalConfig::FrameChannelDraw].Values.push_back(frameTime.DrawTime);
+    m_frameChannels[LocalConfig::FrameChannelTotal].Values.push_back(frameTime.TotalTime);
+    m_frameChannels[LocalConfig::FrameChannelUpdateWait].Values.push_back(frameTime.UpdateWaitTime);
+
+    const int32_t counterCount = m_profilerService->GetCustomCounterCount();
+    for (int32_t i = 0; i < counterCount; ++i)
+    {
+      const ProfilerCustomCounterHandle hCounter = m_profilerService->GetCustomCounterHandle(i);
+      const ProfilerCustomCounterDesc desc = m_profilerService->GetDescription(hCounter);
+      GetCounterChannel(desc.Name).Values.push_back(m_profilerService->Get(hCounter));
+    }
+  }
+
+
+  std::string FrameBenchmarkRecorder::ToJson() const
+  {
+    std::string json("{\n  \"app\": ");
+    AppendJsonString(json, m_appName);
+    fmt::format_to(std::back_inserter(json), ",\n  \"frames\": {},\n  \"warmupFrames\": {},\n  \"fixedUpdateTimeUs\": {},\n  \"unit\": \"us\",\n",
+                   GetMeasuredFrameCount(), m_config.WarmupFrameCount, m_fixedUpdateTime.Ticks() / TimeSpan::TicksPerMicrosecond);
+    AppendChannels(json, "frame", m_frameChannels);
+    json += ",\n";
+    AppendChannels(json, "counters", m_counterChannels);
+    json += "\n}\n";
+    return json;
+  }
+
+
+  void FrameBenchmarkRecorder::WriteReport() const
+  {
+    FSLLOG3_WARNING_IF(GetMeasuredFrameCount() < m_config.FrameCount, "Benchmark only measured {} of {} frames", GetMeasuredFrameCount(),
+                       m_config.FrameCount);
+    const std::string json = ToJson();
+    if (m_config.OutputFile.IsEmpty())
+    {
+      FSLLOG3_INFO("{}", json);
+    }
+    else
+    {
+      IO::File::WriteAllText(m_config.OutputFile, json);
+      FSLLOG3_INFO("Benchmark report written to '{}'", m_config.OutputFile);
+    }
+  }
+
+
+  FrameBenchmarkRecorder::Channel& FrameBenchmarkRecorder::GetCounterChannel(const std::string& name)
+  {
+    auto itrFind = std::find_if(m_counterChannels.begin(), m_counterChannels.end(), [&name](const Channel& entry) { return entry.Name == name; });
+    if (itrFind != m_counterChannels.end())
+    {
+      return *itrFind;
+    }
+    return m_counterChannels.emplace_back(name, m_config.FrameCount);
+  }
+
+
+  void FrameBenchmarkRecorder::AppendChannels(std::string& rDst, const char* const pszName, const std::vector<Channel>& channels)
+  {
+    fmt::format_to(std::back_inserter(rDst), "  \"{}\": {{", pszName);
+    bool isFirst = true;
+    for (const auto& channel : channels)
+    {
+      const FrameBenchmarkSummary summary = FrameBenchmarkSummaryUtil::Summarize(channel.Values);
+      rDst += isFirst ? "\n    " : ",\n    ";
+      isFirst = false;
+      AppendJsonString(rDst, channel.Name);
+      fmt::format_to(std::back_inserter(rDst),
+                     ": {{\"samples\": {}, \"min\": {}, \"max\": {}, \"mean\": {:.2f}, \"p50\": {}, \"p95\": {}, \"p99\": {}}}", summary.Samples,
+                     summary.Min, summary.Max, summary.Mean, summary.P50, summary.P95, summary.P99);
+    }
+    rDst += isFirst ? "}" : "\n  }";
+  }
+}
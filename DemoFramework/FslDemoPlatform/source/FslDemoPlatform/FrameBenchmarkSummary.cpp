@@ -0,0 +1,76 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslDemoPlatform/FrameBenchmarkSummary.hpp>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace Fsl::FrameBenchmarkSummaryUtil
+{
+  int64_t GetPercentile(const std::vector<int64_t>& sortedValues, const uint32_t percentile)
+  {
+    if (sortedValues.empty())
+    {
+      throw std::invalid_argument("sortedValues can not be empty");
+    }
+    if (percentile > 100u)
+    {
+      throw std::invalid_argument("percentile must be <= 100");
+    }
+    const auto rank = static_cast<std::size_t>(std::ceil((static_cast<double>(percentile) / 100.0) * static_cast<double>(sortedValues.size())));
+    return sortedValues[std::clamp(rank, std::size_t(1), sortedValues.size()) - 1u];
+  }
+
+
+  FrameBenchmarkSummary Summarize(std::vector<int64_t> values)
+  {
+    FrameBenchmarkSummary summary;
+    if (!values.empty())
+    {
+      std::sort(values.begin(), values.end());
+      double sum = 0.0;
+      for (const int64_t value : values)
+      {
+        sum += static_cast<double>(value);
+      }
+      summary.Samples = values.size();
+      summary.Min = values.front();
+      summary.Max = values.back();
+      summary.Mean = sum / static_cast<double>(values.size());
+      summary.P50 = GetPercentile(values, 50);
+      summary.P95 = GetPercentile(values, 95);
+      summary.P99 = GetPercentile(values, 99);
+    }
+    return summary;
+  }
+}
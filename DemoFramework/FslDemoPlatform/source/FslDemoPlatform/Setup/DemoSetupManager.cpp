@@ -52,6 +52,7 @@
 #include <FslDemoPlatform/Setup/DemoHostAppSetupBuilder.hpp>
 #include <FslDemoPlatform/Setup/DemoHostRegistry.hpp>
 #include <FslDemoPlatform/Setup/DemoSetupManager.hpp>
+#include <FslDemoService/JobSystem/Impl/JobServiceFactory.hpp>
 #include <FslService/Impl/Registry/ServiceRegistry.hpp>
 #include <FslService/Impl/ServiceOptionParserDeque.hpp>
 #include <FslService/Impl/ServiceType/Local/ThreadLocalSingletonServiceFactoryTemplate.hpp>
@@ -115,6 +116,7 @@ namespace Fsl
     serviceRegistry.Register<ContentMonitorServiceFactory>(ServicePriorityList::ContentMonitor());
     serviceRegistry.Register<AppInfoServiceFactory>(ServicePriorityList::AppInfoService());
     serviceRegistry.Register<OptionsServiceFactory>(ServicePriorityList::Options());
+    serviceRegistry.Register<JobServiceFactory>(ServicePriorityList::JobService());
 
     // Prepare the hosts
     PlatformConfig::Configure(hostRegistry, serviceRegistry, rEnableFirewallRequest);
@@ -63,6 +63,8 @@ namespace Fsl::GLES2
       bool IsValid{false};
       BasicNativeBufferHandle IndexBufferHandle;
       BasicNativeBufferHandle VertexBufferHandle;
+      uint32_t IndexBufferByteOffset{0};
+      uint32_t VertexBufferByteOffset{0};
       BasicNativeMaterialHandle MaterialHandle;
       GLenum MaterialPrimitiveType{GL_TRIANGLES};
       ExtendedCameraInfo CameraInfo;
@@ -180,8 +182,8 @@ namespace Fsl::GLES2
 
     void CmdBindMaterial(const BasicNativeMaterialHandle material, const BasicMaterialVariables& materialVariables,
                          const ReadOnlySpan<BasicNativeTextureHandle> textures) final;
-    void CmdBindIndexBuffer(const BasicNativeBufferHandle indexBuffer) final;
-    void CmdBindVertexBuffer(const BasicNativeBufferHandle vertexBuffer) final;
+    void CmdBindIndexBuffer(const BasicNativeBufferHandle indexBuffer, const uint32_t byteOffset) final;
+    void CmdBindVertexBuffer(const BasicNativeBufferHandle vertexBuffer, const uint32_t byteOffset) final;
 
     void CmdDraw(const uint32_t vertexCount, const uint32_t firstVertex) noexcept final;
     void CmdDrawIndexed(const uint32_t indexCount, const uint32_t firstIndex) noexcept final;
@@ -105,7 +105,8 @@ namespace Fsl::GLES2
       Reset();
     }
 
-    void ChangeAttribs(const VertexElementAttribLinks& attribs)
+    //! @param byteOffset the byte offset of the first vertex inside the bound vertex buffer
+    void ChangeAttribs(const VertexElementAttribLinks& attribs, const uint32_t byteOffset = 0)
     {
       const auto vertexStride = UncheckedNumericCast<GLint>(attribs.VertexStride());
       auto span = attribs.AsSpan();
@@ -122,7 +123,7 @@ namespace Fsl::GLES2
           for (uint16_t i = 0; i < count; ++i)
           {
             const auto& entry = span[i];
-            AddAttrib(entry.AttribIndex, ToVertexAttribState(entry, vertexStride));
+            AddAttrib(entry.AttribIndex, ToVertexAttribState(entry, vertexStride, byteOffset));
           }
         }
         assert(span.size() == m_count);
@@ -162,12 +163,12 @@ namespace Fsl::GLES2
             const auto& entry = span[i];
             if (i < m_count && entry.AttribIndex == m_vertexAttribs[i].AttribIndex)
             {
-              UpdateAttribAt(i, ToVertexAttribState(entry, vertexStride));
+              UpdateAttribAt(i, ToVertexAttribState(entry, vertexStride, byteOffset));
             }
             else
             {
               assert(i >= m_count || entry.AttribIndex < m_vertexAttribs[i].AttribIndex);
-              InsertAttribAt(i, entry.AttribIndex, ToVertexAttribState(entry, vertexStride));
+              InsertAttribAt(i, entry.AttribIndex, ToVertexAttribState(entry, vertexStride, byteOffset));
             }
           }
         }
@@ -176,9 +177,12 @@ namespace Fsl::GLES2
     }
 
   private:
-    static inline VertexAttribState ToVertexAttribState(const GLVertexElementAttribConfig& entry, const GLint vertexStride) noexcept
+    static inline VertexAttribState ToVertexAttribState(const GLVertexElementAttribConfig& entry, const GLint vertexStride,
+                                                        const uint32_t byteOffset) noexcept
     {
-      return {true, {entry.Size, UncheckedNumericCast<GLint>(entry.Type), entry.Normalized != GL_FALSE, vertexStride, entry.Pointer}};
+      // The pointer is a byte offset into the bound vertex buffer
+      const auto* const pPointer = reinterpret_cast<const GLvoid*>(reinterpret_cast<uintptr_t>(entry.Pointer) + byteOffset);
+      return {true, {entry.Size, UncheckedNumericCast<GLint>(entry.Type), entry.Normalized != GL_FALSE, vertexStride, pPointer}};
     }
 
 
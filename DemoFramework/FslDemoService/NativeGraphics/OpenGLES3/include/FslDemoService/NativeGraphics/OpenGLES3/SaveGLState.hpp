@@ -338,10 +338,10 @@ namespace Fsl::GLES3
       }
     }
 
-    void ChangeVertexAttribsLinks(const VertexElementAttribLinks& vertexElementAttribLinks)
+    void ChangeVertexAttribsLinks(const VertexElementAttribLinks& vertexElementAttribLinks, const uint32_t byteOffset)
     {
       assert(m_hasSavedState);
-      m_attribCache.ChangeAttribs(vertexElementAttribLinks);
+      m_attribCache.ChangeAttribs(vertexElementAttribLinks, byteOffset);
     }
 
   private:
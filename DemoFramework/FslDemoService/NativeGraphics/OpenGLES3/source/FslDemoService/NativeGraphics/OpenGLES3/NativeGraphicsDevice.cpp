@@ -319,7 +319,7 @@ namespace Fsl::GLES3
   }
 
 
-  void NativeGraphicsDevice::CmdBindIndexBuffer(const BasicNativeBufferHandle indexBuffer)
+  void NativeGraphicsDevice::CmdBindIndexBuffer(const BasicNativeBufferHandle indexBuffer, const uint32_t byteOffset)
   {
     // If this fires BeginFrame was not called.
     assert(m_frame.IsValid);
@@ -339,6 +339,7 @@ namespace Fsl::GLES3
       m_frame.Cache.SavedState.BindIndexBuffer(0);
     }
     m_frame.Commands.IndexBufferHandle = indexBuffer;
+    m_frame.Commands.IndexBufferByteOffset = byteOffset;
   }
 
 
@@ -509,7 +510,7 @@ namespace Fsl::GLES3
   }
 
 
-  void NativeGraphicsDevice::CmdBindVertexBuffer(const BasicNativeBufferHandle vertexBuffer)
+  void NativeGraphicsDevice::CmdBindVertexBuffer(const BasicNativeBufferHandle vertexBuffer, const uint32_t byteOffset)
   {
     // If this fires BeginFrame was not called.
     assert(m_frame.IsValid);
@@ -529,6 +530,7 @@ namespace Fsl::GLES3
       m_frame.Cache.SavedState.BindVertexBuffer(0);
     }
     m_frame.Commands.VertexBufferHandle = vertexBuffer;
+    m_frame.Commands.VertexBufferByteOffset = byteOffset;
     m_frame.Commands.VertexBufferModified = true;
   }
 
@@ -561,7 +563,7 @@ namespace Fsl::GLES3
           FSLLOG3_DEBUG_WARNING("material record was not found, draw command ignored");
           return;
         }
-        m_frame.Cache.SavedState.ChangeVertexAttribsLinks(*pVertexElementAttribLinks);
+        m_frame.Cache.SavedState.ChangeVertexAttribsLinks(*pVertexElementAttribLinks, m_frame.Commands.VertexBufferByteOffset);
       }
     }
 
@@ -599,12 +601,12 @@ namespace Fsl::GLES3
           FSLLOG3_DEBUG_WARNING("material record was not found, draw command ignored");
           return;
         }
-        m_frame.Cache.SavedState.ChangeVertexAttribsLinks(*pVertexElementAttribLinks);
+        m_frame.Cache.SavedState.ChangeVertexAttribsLinks(*pVertexElementAttribLinks, m_frame.Commands.VertexBufferByteOffset);
       }
     }
 
     glDrawElements(m_frame.Commands.MaterialPrimitiveType, UncheckedNumericCast<GLsizei>(indexCount), GL_UNSIGNED_SHORT,
-                   reinterpret_cast<const void*>(sizeof(uint16_t) * firstIndex));
+                   reinterpret_cast<const void*>(m_frame.Commands.IndexBufferByteOffset + (sizeof(uint16_t) * firstIndex)));
   }
 
   // void NativeGraphicsDevice::DisableAttribArrays()
@@ -160,10 +160,10 @@ namespace Fsl::Vulkan
     void EndCmds() noexcept final;
 
     void CmdSetCamera(const BasicCameraInfo& cameraInfo) final;
-    void CmdBindIndexBuffer(const BasicNativeBufferHandle indexBuffer) final;
+    void CmdBindIndexBuffer(const BasicNativeBufferHandle indexBuffer, const uint32_t byteOffset) final;
     void CmdBindMaterial(const BasicNativeMaterialHandle material, const BasicMaterialVariables& materialVariables,
                          const ReadOnlySpan<BasicNativeTextureHandle> textures) final;
-    void CmdBindVertexBuffer(const BasicNativeBufferHandle vertexBuffer) final;
+    void CmdBindVertexBuffer(const BasicNativeBufferHandle vertexBuffer, const uint32_t byteOffset) final;
 
     void CmdDraw(const uint32_t vertexCount, const uint32_t firstVertex) noexcept final;
     void CmdDrawIndexed(const uint32_t indexCount, const uint32_t firstIndex) noexcept final;
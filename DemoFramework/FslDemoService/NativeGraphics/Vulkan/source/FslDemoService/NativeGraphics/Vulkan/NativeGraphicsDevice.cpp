@@ -308,7 +308,7 @@ namespace Fsl::Vulkan
   }
 
 
-  void NativeGraphicsDevice::CmdBindIndexBuffer(const BasicNativeBufferHandle indexBuffer)
+  void NativeGraphicsDevice::CmdBindIndexBuffer(const BasicNativeBufferHandle indexBuffer, const uint32_t byteOffset)
   {
     // If this fires BeginFrame was not called.
     assert(m_frame.IsValid());
@@ -319,8 +319,7 @@ namespace Fsl::Vulkan
 
     m_frame.Commands.BoundIndexBufferHandle = indexBuffer;
 
-    constexpr VkDeviceSize Offset = 0u;
-    vkCmdBindIndexBuffer(m_frame.CommandBuffer, buffer.GetBuffer(), Offset, VK_INDEX_TYPE_UINT16);
+    vkCmdBindIndexBuffer(m_frame.CommandBuffer, buffer.GetBuffer(), VkDeviceSize(byteOffset), VK_INDEX_TYPE_UINT16);
   }
 
 
@@ -368,7 +367,7 @@ namespace Fsl::Vulkan
   }
 
 
-  void NativeGraphicsDevice::CmdBindVertexBuffer(const BasicNativeBufferHandle vertexBuffer)
+  void NativeGraphicsDevice::CmdBindVertexBuffer(const BasicNativeBufferHandle vertexBuffer, const uint32_t byteOffset)
   {
     // If this fires BeginFrame was not called.
     assert(m_frame.IsValid());
@@ -379,7 +378,7 @@ namespace Fsl::Vulkan
 
     m_frame.Commands.BoundVertexBufferHandle = vertexBuffer;
 
-    const VkDeviceSize offset = 0u;
+    const VkDeviceSize offset = byteOffset;
     vkCmdBindVertexBuffers(m_frame.CommandBuffer, 0, 1, buffer.GetBufferPointer(), &offset);
   }
 
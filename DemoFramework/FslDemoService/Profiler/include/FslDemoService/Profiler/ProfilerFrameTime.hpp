@@ -41,6 +41,9 @@ namespace Fsl
     int64_t UpdateTime{0};
     int64_t DrawTime{0};
     int64_t TotalTime{0};
+    //! The time the draw stage spent waiting for a pipelined update to complete (zero when update and draw run serially).
+    //! When pipelined the UpdateTime and DrawTime overlap, so the frame is bound by the slowest of the two.
+    int64_t UpdateWaitTime{0};
 
     ProfilerFrameTime() = default;
 
@@ -51,6 +54,14 @@ namespace Fsl
     {
     }
 
+    ProfilerFrameTime(const int64_t updateTime, const int64_t drawTime, const int64_t totalTime, const int64_t updateWaitTime)
+      : UpdateTime(updateTime)
+      , DrawTime(drawTime)
+      , TotalTime(totalTime)
+      , UpdateWaitTime(updateWaitTime)
+    {
+    }
+
     float GetFramePerSecond() const
     {
       return TotalTime > 0 ? (1000000.0f / static_cast<float>(TotalTime)) : 0.0f;
@@ -0,0 +1,231 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslGraphics/Bitmap/RawBitmapKernels.hpp>
+#include <FslGraphics/UnitTest/Helper/Common.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestBitmap_RawBitmapKernels = TestFixtureFslGraphics;
+
+  constexpr std::array<RawBitmapKernelSet, 3> SimdKernelSets{RawBitmapKernelSet::SSE41, RawBitmapKernelSet::AVX2, RawBitmapKernelSet::Neon};
+
+  // Covers the empty row, the rows that are too short for the SIMD code and plenty of tail lengths
+  constexpr uint32_t MaxTestWidth = 100;
+
+  std::vector<uint8_t> CreateRandomBytes(const std::size_t count, const uint32_t seed)
+  {
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<uint32_t> distribution(0, 255);
+    std::vector<uint8_t> bytes(count);
+    for (auto& rByte : bytes)
+    {
+      rByte = static_cast<uint8_t>(distribution(random));
+    }
+    return bytes;
+  }
+
+  std::vector<RawBitmapKernelSet> GetSupportedSimdKernelSets()
+  {
+    std::vector<RawBitmapKernelSet> result;
+    for (const auto kernelSet : SimdKernelSets)
+    {
+      if (RawBitmapKernels::IsSupported(kernelSet))
+      {
+        result.push_back(kernelSet);
+      }
+    }
+    return result;
+  }
+
+  //! Run the operation on a copy of the same random data using the scalar and the simd kernels and compare the full buffers
+  template <typename TFunc>
+  void CompareWithScalar(const std::size_t srcBytes, const std::size_t dstBytes, TFunc fnOperation)
+  {
+    const std::vector<uint8_t> src = CreateRandomBytes(srcBytes, 1234);
+    const std::vector<uint8_t> dst = CreateRandomBytes(dstBytes, 4321);
+
+    std::vector<uint8_t> expectedDst(dst);
+    fnOperation(RawBitmapKernels::GetKernels(RawBitmapKernelSet::Scalar), expectedDst.data(), src.data());
+
+    for (const auto kernelSet : GetSupportedSimdKernelSets())
+    {
+      std::vector<uint8_t> actualDst(dst);
+      fnOperation(RawBitmapKernels::GetKernels(kernelSet), actualDst.data(), src.data());
+      EXPECT_EQ(expectedDst, actualDst) << "kernelSet: " << static_cast<int>(kernelSet);
+    }
+  }
+
+  //! Run the operation in-place on a copy of the same random data using the scalar and the simd kernels and compare the results
+  template <typename TFunc>
+  void CompareInPlaceWithScalar(const std::size_t bytes, TFunc fnOperation)
+  {
+    const std::vector<uint8_t> buffer = CreateRandomBytes(bytes, 1234);
+
+    std::vector<uint8_t> expected(buffer);
+    fnOperation(RawBitmapKernels::GetKernels(RawBitmapKernelSet::Scalar), expected.data());
+
+    for (const auto kernelSet : GetSupportedSimdKernelSets())
+    {
+      std::vector<uint8_t> actual(buffer);
+      fnOperation(RawBitmapKernels::GetKernels(kernelSet), actual.data());
+      EXPECT_EQ(expected, actual) << "kernelSet: " << static_cast<int>(kernelSet);
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapKernels, Scalar_IsSupported)
+{
+  EXPECT_TRUE(RawBitmapKernels::IsSupported(RawBitmapKernelSet::Scalar));
+}
+
+
+TEST(TestBitmap_RawBitmapKernels, GetBestKernelSet)
+{
+  const RawBitmapKernelSet kernelSet = RawBitmapKernels::GetBestKernelSet();
+
+  EXPECT_TRUE(RawBitmapKernels::IsSupported(kernelSet));
+  EXPECT_EQ(&RawBitmapKernels::GetKernels(kernelSet), &RawBitmapKernels::GetKernels());
+}
+
+
+TEST(TestBitmap_RawBitmapKernels, GetKernels_Unsupported)
+{
+  for (const auto kernelSet : SimdKernelSets)
+  {
+    if (!RawBitmapKernels::IsSupported(kernelSet))
+    {
+      EXPECT_THROW(RawBitmapKernels::GetKernels(kernelSet), NotSupportedException);
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapKernels, Swizzle24)
+{
+  constexpr std::array<std::array<uint32_t, 3>, 4> Indices{{{0, 1, 2}, {2, 1, 0}, {1, 2, 0}, {0, 0, 2}}};
+  for (const auto& idx : Indices)
+  {
+    for (uint32_t width = 0; width <= MaxTestWidth; ++width)
+    {
+      CompareWithScalar(width * 3, width * 3, [&](const RawBitmapRowKernels& kernels, uint8_t* pDst, const uint8_t* pSrc)
+                        { kernels.Swizzle24(pDst, pSrc, width, idx[0], idx[1], idx[2]); });
+      CompareInPlaceWithScalar(width * 3, [&](const RawBitmapRowKernels& kernels, uint8_t* pBuffer)
+                               { kernels.Swizzle24(pBuffer, pBuffer, width, idx[0], idx[1], idx[2]); });
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapKernels, Swizzle32)
+{
+  constexpr std::array<std::array<uint32_t, 4>, 4> Indices{{{0, 1, 2, 3}, {2, 1, 0, 3}, {3, 2, 1, 0}, {1, 1, 3, 3}}};
+  for (const auto& idx : Indices)
+  {
+    for (uint32_t width = 0; width <= MaxTestWidth; ++width)
+    {
+      CompareWithScalar(width * 4, width * 4, [&](const RawBitmapRowKernels& kernels, uint8_t* pDst, const uint8_t* pSrc)
+                        { kernels.Swizzle32(pDst, pSrc, width, idx[0], idx[1], idx[2], idx[3]); });
+      CompareInPlaceWithScalar(width * 4, [&](const RawBitmapRowKernels& kernels, uint8_t* pBuffer)
+                               { kernels.Swizzle32(pBuffer, pBuffer, width, idx[0], idx[1], idx[2], idx[3]); });
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapKernels, Swizzle32To24)
+{
+  constexpr std::array<std::array<uint32_t, 3>, 4> Indices{{{0, 1, 2}, {2, 1, 0}, {3, 2, 1}, {1, 1, 3}}};
+  for (const auto& idx : Indices)
+  {
+    for (uint32_t width = 0; width <= MaxTestWidth; ++width)
+    {
+      CompareWithScalar(width * 4, width * 3, [&](const RawBitmapRowKernels& kernels, uint8_t* pDst, const uint8_t* pSrc)
+                        { kernels.Swizzle32To24(pDst, pSrc, width, idx[0], idx[1], idx[2]); });
+      CompareInPlaceWithScalar(width * 4, [&](const RawBitmapRowKernels& kernels, uint8_t* pBuffer)
+                               { kernels.Swizzle32To24(pBuffer, pBuffer, width, idx[0], idx[1], idx[2]); });
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapKernels, Swizzle32To24_InPlaceMultipleRows)
+{
+  // In-place conversion of a tightly packed image where the dst rows end up before the src rows
+  constexpr uint32_t Width = 37;
+  constexpr uint32_t Height = 5;
+  CompareInPlaceWithScalar(Width * Height * 4,
+                           [&](const RawBitmapRowKernels& kernels, uint8_t* pBuffer)
+                           {
+                             for (uint32_t y = 0; y < Height; ++y)
+                             {
+                               kernels.Swizzle32To24(pBuffer + (y * Width * 3), pBuffer + (y * Width * 4), Width, 2, 1, 0);
+                             }
+                           });
+}
+
+
+TEST(TestBitmap_RawBitmapKernels, Swizzle24To32)
+{
+  // The last entry is not a permutation so one of the dst bytes is left untouched
+  constexpr std::array<std::array<uint32_t, 4>, 4> Indices{{{0, 1, 2, 3}, {2, 1, 0, 3}, {3, 0, 1, 2}, {0, 0, 1, 3}}};
+  for (const auto& idx : Indices)
+  {
+    for (uint32_t width = 0; width <= MaxTestWidth; ++width)
+    {
+      CompareWithScalar(width * 3, width * 4, [&](const RawBitmapRowKernels& kernels, uint8_t* pDst, const uint8_t* pSrc)
+                        { kernels.Swizzle24To32(pDst, pSrc, width, idx[0], idx[1], idx[2], idx[3], 0xA5); });
+      CompareInPlaceWithScalar(width * 4, [&](const RawBitmapRowKernels& kernels, uint8_t* pBuffer)
+                               { kernels.Swizzle24To32(pBuffer, pBuffer, width, idx[0], idx[1], idx[2], idx[3], 0xA5); });
+    }
+  }
+}
+
+
+TEST(TestBitmap_RawBitmapKernels, Expand1ByteToNBytes)
+{
+  for (uint32_t bytesPerPixel = 1; bytesPerPixel <= 8; ++bytesPerPixel)
+  {
+    for (uint32_t width = 0; width <= MaxTestWidth; ++width)
+    {
+      CompareWithScalar(width, width * bytesPerPixel, [&](const RawBitmapRowKernels& kernels, uint8_t* pDst, const uint8_t* pSrc)
+                        { kernels.Expand1ByteToNBytes(pDst, pSrc, width, bytesPerPixel); });
+    }
+  }
+}
@@ -0,0 +1,268 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Math/Pixel/LogPxAreaRectangleF.hpp>
+#include <FslBase/Log/Math/Pixel/LogPxSize2D.hpp>
+#include <FslBase/Span/SpanUtil_Array.hpp>
+#include <FslGraphics/Sprite/Font/SpriteFontLayoutCache.hpp>
+#include <FslGraphics/Sprite/Font/TextureAtlasSpriteFont.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <array>
+#include <string>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestFont_SpriteFontLayoutCache = TestFixtureFslGraphics;
+
+  SpriteFontGlyphPosition CreateGlyph(const float x)
+  {
+    return {PxAreaRectangleF::Create(x, 0.0f, 10.0f, 20.0f), NativeTextureArea()};
+  }
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, Construct)
+{
+  SpriteFontLayoutCache cache;
+
+  EXPECT_EQ(SpriteFontLayoutCache::DefaultCapacity, cache.GetCapacity());
+  EXPECT_EQ(SpriteFontLayoutCacheStats(), cache.GetStats());
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, MeasuredSize_MissThenHit)
+{
+  SpriteFontLayoutCache cache;
+  const BitmapFontConfig fontConfig(1.0f, true);
+
+  EXPECT_FALSE(cache.TryGetMeasuredSize("hello", fontConfig).has_value());
+  cache.SetMeasuredSize("hello", fontConfig, PxSize2D::Create(50, 20));
+
+  const auto result = cache.TryGetMeasuredSize("hello", fontConfig);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(PxSize2D::Create(50, 20), result.value());
+  EXPECT_EQ(SpriteFontLayoutCacheStats(1, 1, 0, 1), cache.GetStats());
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, MeasuredSize_ConfigIsPartOfTheKey)
+{
+  SpriteFontLayoutCache cache;
+  cache.SetMeasuredSize("hello", BitmapFontConfig(1.0f, true), PxSize2D::Create(50, 20));
+
+  EXPECT_FALSE(cache.TryGetMeasuredSize("hello", BitmapFontConfig(1.0f, false)).has_value());
+  EXPECT_FALSE(cache.TryGetMeasuredSize("hello", BitmapFontConfig(2.0f, true)).has_value());
+  EXPECT_FALSE(cache.TryGetMeasuredSize("hell", BitmapFontConfig(1.0f, true)).has_value());
+  EXPECT_TRUE(cache.TryGetMeasuredSize("hello", BitmapFontConfig(1.0f, true)).has_value());
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, NotCacheable)
+{
+  SpriteFontLayoutCache cache;
+  const BitmapFontConfig fontConfig;
+  const std::string longTextString(SpriteFontLayoutCache::MaxTextLength + 1, 'a');
+  const StringViewLite longText(longTextString);
+
+  cache.SetMeasuredSize("", fontConfig, PxSize2D::Create(1, 1));
+  cache.SetMeasuredSize(longText, fontConfig, PxSize2D::Create(1, 1));
+
+  EXPECT_FALSE(cache.TryGetMeasuredSize("", fontConfig).has_value());
+  EXPECT_FALSE(cache.TryGetMeasuredSize(longText, fontConfig).has_value());
+  // Requests that can not be cached are not counted
+  EXPECT_EQ(SpriteFontLayoutCacheStats(), cache.GetStats());
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, RenderRules_MissThenHit)
+{
+  SpriteFontLayoutCache cache;
+  const BitmapFontConfig fontConfig;
+  const std::array<SpriteFontGlyphPosition, 3> glyphs = {CreateGlyph(0.0f), CreateGlyph(10.0f), CreateGlyph(20.0f)};
+  std::array<SpriteFontGlyphPosition, 3> dst{};
+
+  EXPECT_FALSE(cache.TryCopyRenderRules(SpanUtil::AsSpan(dst), "abc", fontConfig).has_value());
+  cache.SetRenderRules("abc", fontConfig, true, SpanUtil::AsReadOnlySpan(glyphs));
+
+  const auto result = cache.TryCopyRenderRules(SpanUtil::AsSpan(dst), "abc", fontConfig);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result.value());
+  for (std::size_t i = 0; i < dst.size(); ++i)
+  {
+    EXPECT_EQ(glyphs[i].DstRectPxf, dst[i].DstRectPxf);
+  }
+  EXPECT_EQ(SpriteFontLayoutCacheStats(1, 1, 0, 1), cache.GetStats());
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, RenderRules_EmptyResult)
+{
+  SpriteFontLayoutCache cache;
+  const BitmapFontConfig fontConfig(0.0f);
+  std::array<SpriteFontGlyphPosition, 1> dst = {CreateGlyph(42.0f)};
+
+  cache.SetRenderRules("abc", fontConfig, false, {});
+
+  const auto result = cache.TryCopyRenderRules(SpanUtil::AsSpan(dst), "abc", fontConfig);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_FALSE(result.value());
+  // dst is not modified
+  EXPECT_EQ(CreateGlyph(42.0f).DstRectPxf, dst[0].DstRectPxf);
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, RenderRules_DstTooSmall)
+{
+  SpriteFontLayoutCache cache;
+  const BitmapFontConfig fontConfig;
+  const std::array<SpriteFontGlyphPosition, 3> glyphs = {CreateGlyph(0.0f), CreateGlyph(10.0f), CreateGlyph(20.0f)};
+  std::array<SpriteFontGlyphPosition, 2> dst{};
+
+  cache.SetRenderRules("abc", fontConfig, true, SpanUtil::AsReadOnlySpan(glyphs));
+
+  EXPECT_THROW(cache.TryCopyRenderRules(SpanUtil::AsSpan(dst), "abc", fontConfig), std::invalid_argument);
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, MeasureAndRenderRulesShareTheEntry)
+{
+  SpriteFontLayoutCache cache;
+  const BitmapFontConfig fontConfig;
+  const std::array<SpriteFontGlyphPosition, 1> glyphs = {CreateGlyph(0.0f)};
+  std::array<SpriteFontGlyphPosition, 1> dst{};
+
+  cache.SetMeasuredSize("a", fontConfig, PxSize2D::Create(10, 20));
+  // The render rules of the entry are not known yet
+  EXPECT_FALSE(cache.TryCopyRenderRules(SpanUtil::AsSpan(dst), "a", fontConfig).has_value());
+  cache.SetRenderRules("a", fontConfig, true, SpanUtil::AsReadOnlySpan(glyphs));
+
+  EXPECT_TRUE(cache.TryGetMeasuredSize("a", fontConfig).has_value());
+  EXPECT_TRUE(cache.TryCopyRenderRules(SpanUtil::AsSpan(dst), "a", fontConfig).has_value());
+  EXPECT_EQ(SpriteFontLayoutCacheStats(2, 1, 0, 1), cache.GetStats());
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, Eviction_LeastRecentlyUsed)
+{
+  SpriteFontLayoutCache cache(2);
+  const BitmapFontConfig fontConfig;
+
+  cache.SetMeasuredSize("a", fontConfig, PxSize2D::Create(1, 1));
+  cache.SetMeasuredSize("b", fontConfig, PxSize2D::Create(2, 2));
+  // Touch 'a' so 'b' becomes the least recently used entry
+  EXPECT_TRUE(cache.TryGetMeasuredSize("a", fontConfig).has_value());
+  cache.SetMeasuredSize("c", fontConfig, PxSize2D::Create(3, 3));
+
+  EXPECT_TRUE(cache.TryGetMeasuredSize("a", fontConfig).has_value());
+  EXPECT_FALSE(cache.TryGetMeasuredSize("b", fontConfig).has_value());
+  EXPECT_EQ(PxSize2D::Create(3, 3), cache.TryGetMeasuredSize("c", fontConfig).value());
+  EXPECT_EQ(SpriteFontLayoutCacheStats(3, 1, 1, 2), cache.GetStats());
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, Eviction_Many)
+{
+  SpriteFontLayoutCache cache(4);
+  const BitmapFontConfig fontConfig;
+
+  for (int32_t i = 0; i < 100; ++i)
+  {
+    cache.SetMeasuredSize(StringViewLite(std::to_string(i)), fontConfig, PxSize2D::Create(i, i));
+  }
+
+  for (int32_t i = 0; i < 96; ++i)
+  {
+    EXPECT_FALSE(cache.TryGetMeasuredSize(StringViewLite(std::to_string(i)), fontConfig).has_value());
+  }
+  for (int32_t i = 96; i < 100; ++i)
+  {
+    EXPECT_EQ(PxSize2D::Create(i, i), cache.TryGetMeasuredSize(StringViewLite(std::to_string(i)), fontConfig).value());
+  }
+  EXPECT_EQ(96u, cache.GetStats().Evictions);
+  EXPECT_EQ(4u, cache.GetStats().EntryCount);
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, Clear)
+{
+  SpriteFontLayoutCache cache;
+  const BitmapFontConfig fontConfig;
+  cache.SetMeasuredSize("a", fontConfig, PxSize2D::Create(1, 1));
+
+  cache.Clear();
+
+  EXPECT_FALSE(cache.TryGetMeasuredSize("a", fontConfig).has_value());
+  EXPECT_EQ(0u, cache.GetStats().EntryCount);
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, SetCapacity_ZeroDisablesTheCache)
+{
+  SpriteFontLayoutCache cache;
+  const BitmapFontConfig fontConfig;
+  cache.SetMeasuredSize("a", fontConfig, PxSize2D::Create(1, 1));
+
+  cache.SetCapacity(0);
+  cache.SetMeasuredSize("a", fontConfig, PxSize2D::Create(1, 1));
+
+  EXPECT_EQ(0u, cache.GetCapacity());
+  EXPECT_FALSE(cache.TryGetMeasuredSize("a", fontConfig).has_value());
+  EXPECT_EQ(0u, cache.GetStats().EntryCount);
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, TextureAtlasSpriteFont_MeasureString)
+{
+  TextureAtlasSpriteFont font;
+
+  const PxSize2D sizePx = font.MeasureString("Hello world");
+  EXPECT_EQ(sizePx, font.MeasureString("Hello world"));
+  EXPECT_EQ(sizePx, font.MeasureString("Hello world", BitmapFontConfig(1.0f, false)));
+
+  // The font has no kerning, so the kerning flag does not create a new entry
+  const SpriteFontLayoutCacheStats stats = font.GetLayoutCacheStats();
+  EXPECT_EQ(2u, stats.Hits);
+  EXPECT_EQ(1u, stats.Misses);
+  EXPECT_EQ(1u, stats.EntryCount);
+}
+
+
+TEST(TestFont_SpriteFontLayoutCache, TextureAtlasSpriteFont_Reset)
+{
+  TextureAtlasSpriteFont font;
+  font.MeasureString("Hello world");
+
+  font.Reset();
+
+  EXPECT_EQ(0u, font.GetLayoutCacheStats().EntryCount);
+}
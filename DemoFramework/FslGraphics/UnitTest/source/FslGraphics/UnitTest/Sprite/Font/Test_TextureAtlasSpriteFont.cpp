@@ -0,0 +1,86 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Math/Pixel/LogPxAreaRectangleF.hpp>
+#include <FslBase/Log/Math/Pixel/LogPxSize2D.hpp>
+#include <FslBase/Span/SpanUtil_Array.hpp>
+#include <FslGraphics/Font/BitmapFont.hpp>
+#include <FslGraphics/Sprite/Font/TextureAtlasSpriteFont.hpp>
+#include <FslGraphics/Sprite/SpriteNativeAreaCalc.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <array>
+#include <utility>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestFont_TextureAtlasSpriteFont = TestFixtureFslGraphics;
+
+  constexpr uint32_t Dpi = 160;
+  //! U+1F600 (grinning face) is encoded as a four byte UTF8 sequence
+  constexpr uint32_t SmileyCodePoint = 0x1F600;
+  constexpr const char* const SmileyUtf8 = "\xF0\x9F\x98\x80";
+
+  TextureAtlasSpriteFont CreateFont()
+  {
+    std::vector<BitmapFontChar> chars = {
+      BitmapFontChar('A', PxRectangleU32::Create(0, 0, 10, 20), PxPoint2::Create(0, 0), PxValueU16(11)),
+      BitmapFontChar(SmileyCodePoint, PxRectangleU32::Create(10, 0, 16, 16), PxPoint2::Create(1, 2), PxValueU16(18)),
+    };
+    const BitmapFont bitmapFont(StringViewLite("font"), Dpi, 20, PxValueU16(24), PxValueU16(20), PxThicknessU16(), StringViewLite("texture"),
+                                BitmapFontType::Bitmap, BitmapFont::SdfParams(), std::move(chars), std::vector<BitmapFontKerning>());
+    return TextureAtlasSpriteFont(SpriteNativeAreaCalc(false), PxExtent2D::Create(64, 32), bitmapFont, Dpi);
+  }
+}
+
+
+TEST(TestFont_TextureAtlasSpriteFont, MeasureString_Utf8FourByte)
+{
+  TextureAtlasSpriteFont font = CreateFont();
+
+  EXPECT_EQ(PxSize2D::Create(1 + 16, 2 + 16), font.MeasureString(SmileyUtf8));
+  EXPECT_EQ(PxSize2D::Create(11 + 1 + 16, 20), font.MeasureString("A\xF0\x9F\x98\x80"));
+}
+
+
+TEST(TestFont_TextureAtlasSpriteFont, ExtractRenderRules_Utf8FourByte)
+{
+  TextureAtlasSpriteFont font = CreateFont();
+  // The destination must have room for one entry per byte, the entries that are not used by a glyph are padded
+  std::array<SpriteFontGlyphPosition, 5> dst{};
+
+  ASSERT_TRUE(font.ExtractRenderRules(SpanUtil::AsSpan(dst), "A\xF0\x9F\x98\x80"));
+  EXPECT_EQ(PxAreaRectangleF::Create(0, 0, 10, 20), dst[0].DstRectPxf);
+  EXPECT_EQ(PxAreaRectangleF::Create(11 + 1, 2, 16, 16), dst[1].DstRectPxf);
+  EXPECT_EQ(PxAreaRectangleF(), dst[2].DstRectPxf);
+}
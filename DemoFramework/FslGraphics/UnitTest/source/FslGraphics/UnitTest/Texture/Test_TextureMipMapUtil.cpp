@@ -32,12 +32,21 @@
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/Log/Math/LogPoint2.hpp>
 #include <FslBase/Log/Math/Pixel/LogPxExtent2D.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/ColorSpaceConversion.hpp>
+#include <FslGraphics/Exceptions.hpp>
 #include <FslGraphics/Log/LogPixelFormat.hpp>
 #include <FslGraphics/Log/LogStrideRequirement.hpp>
+#include <FslGraphics/PixelFormatUtil.hpp>
+#include <FslGraphics/Texture/TextureBlobBuilder.hpp>
 #include <FslGraphics/Texture/TextureMipMapUtil.hpp>
 #include <FslGraphics/UnitTest/Helper/Common.hpp>
 #include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
 #include <cassert>
+#include <cstring>
+#include <random>
+#include <vector>
 
 using namespace Fsl;
 
@@ -72,6 +81,51 @@ namespace
     auto c3 = BoxFilterChannel(pixelColor00 & 0xFF, pixelColor10 & 0xFF, pixelColor01 & 0xFF, pixelColor11 & 0xFF);
     return (c0 << 24) | (c1 << 16) | (c2 << 8) | c3;
   }
+
+  Texture CreateTexture(const TextureType textureType, const uint32_t size, const PixelFormat pixelFormat, const uint32_t layers,
+                        const ReadOnlySpan<uint8_t> content)
+  {
+    const TextureInfo textureInfo(1u, textureType, layers);
+    Texture texture(TextureBlobBuilder(textureType, PxExtent3D::Create(size, size, 1u), pixelFormat, textureInfo, BitmapOrigin::UpperLeft, true));
+    Texture::ScopedDirectReadWriteAccess access(texture);
+    RawTextureEx rawTexture = access.AsRawTexture();
+    assert(rawTexture.GetByteSize() == content.size());
+    std::memcpy(rawTexture.GetContent(), content.data(), content.size());
+    return texture;
+  }
+
+  Texture CreateRandomTexture(const TextureType textureType, const uint32_t size, const PixelFormat pixelFormat, const uint32_t layers)
+  {
+    const TextureInfo textureInfo(1u, textureType, layers);
+    const std::size_t byteSize = std::size_t(size) * size * PixelFormatUtil::GetBytesPerPixel(pixelFormat) * textureInfo.Faces * layers;
+    std::mt19937 random(1234);
+    std::uniform_int_distribution<uint32_t> distribution(0, 255);
+    std::vector<uint8_t> content(byteSize);
+    for (auto& rEntry : content)
+    {
+      rEntry = static_cast<uint8_t>(distribution(random));
+    }
+    return CreateTexture(textureType, size, pixelFormat, layers, SpanUtil::AsReadOnlySpan(content));
+  }
+
+  template <typename T>
+  std::vector<T> GetBlob(const Texture& texture, const uint32_t level, const uint32_t face = 0, const uint32_t layer = 0)
+  {
+    Texture::ScopedDirectReadAccess access(texture);
+    const ReadOnlyRawTexture rawTexture = access.AsRawTexture();
+    const BlobRecord blob = rawTexture.GetTextureBlob(level, face, layer);
+    std::vector<T> result(blob.Size / sizeof(T));
+    std::memcpy(result.data(), static_cast<const uint8_t*>(rawTexture.GetContent()) + blob.Offset, result.size() * sizeof(T));
+    return result;
+  }
+
+  std::vector<uint8_t> GetContent(const Texture& texture)
+  {
+    Texture::ScopedDirectReadAccess access(texture);
+    const ReadOnlyRawTexture rawTexture = access.AsRawTexture();
+    const auto* const pContent = static_cast<const uint8_t*>(rawTexture.GetContent());
+    return {pContent, pContent + rawTexture.GetByteSize()};
+  }
 }
 
 TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_From1X1Bitmap_Box)
@@ -226,3 +280,171 @@ TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_From4X4Bitmap_Box)
   const uint32_t mip2Color00 = BoxFilter(mip1Color00, mip1Color10, mip1Color01, mip1Color11);
   EXPECT_EQ(mip2Color00, GetR8G8B8A8Pixel(result, 2, 0, 0, PxPoint2::Create(0, 0)));
 }
+
+
+TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_From2X2Bitmap_GammaCorrectBox_Srgb)
+{
+  Bitmap src(2, 2, PixelFormat::R8G8B8A8_SRGB, BitmapOrigin::UpperLeft);
+  src.SetNativePixel(0, 0, 0x00000000);
+  src.SetNativePixel(1, 0, 0xFFFFFFFF);
+  src.SetNativePixel(0, 1, 0x00000000);
+  src.SetNativePixel(1, 1, 0xFFFFFFFF);
+  Texture result = TextureMipMapUtil::GenerateMipMaps(src, TextureMipMapFilter::GammaCorrectBox);
+
+  EXPECT_EQ(2u, result.GetLevels());
+  // The color channels are averaged in linear space while alpha is averaged as is
+  const uint32_t expectedColor = ColorSpaceConversion::ConvertLinearToSRGBUInt8(0.5f);
+  const uint32_t expectedAlpha = 128u;
+  EXPECT_EQ(expectedColor | (expectedColor << 8) | (expectedColor << 16) | (expectedAlpha << 24),
+            GetR8G8B8A8Pixel(result, 1, 0, 0, PxPoint2::Create(0, 0)));
+  // While the normal box filter ignores the srgb encoding
+  Texture resultBox = TextureMipMapUtil::GenerateMipMaps(src, TextureMipMapFilter::Box);
+  EXPECT_EQ(0x7F7F7F7Fu, GetR8G8B8A8Pixel(resultBox, 1, 0, 0, PxPoint2::Create(0, 0)));
+}
+
+
+TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_Box_R32G32B32A32Float)
+{
+  const std::array<float, 16> content = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, -1.0f, 0.0f, 100.0f, 0.5f, 3.0f, 2.0f, 1.0f, 0.5f};
+  const Texture src = CreateTexture(TextureType::Tex2D, 2, PixelFormat::R32G32B32A32_SFLOAT, 1,
+                                    ReadOnlySpan<uint8_t>(reinterpret_cast<const uint8_t*>(content.data()), content.size() * sizeof(float)));
+  Texture result = TextureMipMapUtil::GenerateMipMaps(src, TextureMipMapFilter::Box);
+
+  const std::vector<float> mip1 = GetBlob<float>(result, 1);
+  ASSERT_EQ(4u, mip1.size());
+  EXPECT_FLOAT_EQ(2.0f, mip1[0]);
+  EXPECT_FLOAT_EQ(2.5f, mip1[1]);
+  EXPECT_FLOAT_EQ(27.75f, mip1[2]);
+  EXPECT_FLOAT_EQ(3.25f, mip1[3]);
+}
+
+
+TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_Box_R16G16B16A16Float)
+{
+  // 1.0, 2.0, 3.0, 4.0 and 65504 (max)
+  const std::array<uint16_t, 16> content = {0x3C00, 0x4000, 0x4200, 0x7BFF, 0x4000, 0x4000, 0x4200, 0x7BFF,
+                                            0x4200, 0x4000, 0x4200, 0x7BFF, 0x4400, 0x4000, 0x4200, 0x7BFF};
+  const Texture src = CreateTexture(TextureType::Tex2D, 2, PixelFormat::R16G16B16A16_SFLOAT, 1,
+                                    ReadOnlySpan<uint8_t>(reinterpret_cast<const uint8_t*>(content.data()), content.size() * sizeof(uint16_t)));
+  Texture result = TextureMipMapUtil::GenerateMipMaps(src, TextureMipMapFilter::Box);
+
+  const std::vector<uint16_t> mip1 = GetBlob<uint16_t>(result, 1);
+  ASSERT_EQ(4u, mip1.size());
+  // 2.5, 2.0, 3.0, 65504
+  EXPECT_EQ(0x4100u, mip1[0]);
+  EXPECT_EQ(0x4000u, mip1[1]);
+  EXPECT_EQ(0x4200u, mip1[2]);
+  EXPECT_EQ(0x7BFFu, mip1[3]);
+}
+
+
+TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_WindowedSinc_ConstantColor)
+{
+  const uint32_t pixelColor = 0x80604020;
+  Bitmap src(16, 16, PixelFormat::R8G8B8A8_UNORM, BitmapOrigin::UpperLeft);
+  for (uint32_t y = 0; y < 16u; ++y)
+  {
+    for (uint32_t x = 0; x < 16u; ++x)
+    {
+      src.SetNativePixel(x, y, pixelColor);
+    }
+  }
+
+  // The filters are normalized so a constant color must be preserved at all levels (including the edges)
+  for (const auto filter : {TextureMipMapFilter::Lanczos3, TextureMipMapFilter::Kaiser})
+  {
+    Texture result = TextureMipMapUtil::GenerateMipMaps(src, filter);
+    ASSERT_EQ(5u, result.GetLevels());
+    for (uint32_t level = 1; level < result.GetLevels(); ++level)
+    {
+      const uint32_t levelSize = 16u >> level;
+      for (uint32_t y = 0; y < levelSize; ++y)
+      {
+        for (uint32_t x = 0; x < levelSize; ++x)
+        {
+          EXPECT_EQ(pixelColor, GetR8G8B8A8Pixel(result, level, 0, 0, PxPoint2::Create(UncheckedNumericCast<int32_t>(x), UncheckedNumericCast<int32_t>(y))));
+        }
+      }
+    }
+  }
+}
+
+
+TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_Lanczos3_PreservesEdge)
+{
+  // A vertical edge: left half black, right half white
+  Bitmap src(8, 8, PixelFormat::R8G8B8A8_UNORM, BitmapOrigin::UpperLeft);
+  for (uint32_t y = 0; y < 8u; ++y)
+  {
+    for (uint32_t x = 0; x < 8u; ++x)
+    {
+      src.SetNativePixel(x, y, x < 4u ? 0xFF000000 : 0xFFFFFFFF);
+    }
+  }
+  Texture result = TextureMipMapUtil::GenerateMipMaps(src, TextureMipMapFilter::Lanczos3);
+
+  // The pixels next to the edge are darker/brighter than a box filter would produce, the ringing is clamped by the unorm format
+  const uint32_t left = GetR8G8B8A8Pixel(result, 1, 0, 0, PxPoint2::Create(1, 2)) & 0xFF;
+  const uint32_t right = GetR8G8B8A8Pixel(result, 1, 0, 0, PxPoint2::Create(2, 2)) & 0xFF;
+  EXPECT_LT(left, 0x20u);
+  EXPECT_GT(right, 0xE0u);
+  EXPECT_EQ(0u, GetR8G8B8A8Pixel(result, 1, 0, 0, PxPoint2::Create(0, 0)) & 0xFF);
+  EXPECT_EQ(0xFFu, GetR8G8B8A8Pixel(result, 1, 0, 0, PxPoint2::Create(3, 0)) & 0xFF);
+}
+
+
+TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_Parallel_MatchesSerial)
+{
+  JobSystem jobSystem(3);
+  const std::array<TextureMipMapFilter, 5> filters = {TextureMipMapFilter::Nearest, TextureMipMapFilter::Box, TextureMipMapFilter::GammaCorrectBox,
+                                                      TextureMipMapFilter::Lanczos3, TextureMipMapFilter::Kaiser};
+  const Texture cube = CreateRandomTexture(TextureType::TexCube, 128, PixelFormat::R8G8B8A8_SRGB, 1);
+  const Texture array = CreateRandomTexture(TextureType::Tex2DArray, 256, PixelFormat::R16G16B16A16_UNORM, 3);
+  for (const auto filter : filters)
+  {
+    const Texture serialCube = TextureMipMapUtil::GenerateMipMaps(cube, filter);
+    const Texture parallelCube = TextureMipMapUtil::GenerateMipMaps(cube, filter, jobSystem);
+    EXPECT_EQ(6u, parallelCube.GetFaces());
+    EXPECT_EQ(8u, parallelCube.GetLevels());
+    EXPECT_EQ(GetContent(serialCube), GetContent(parallelCube));
+
+    const Texture serialArray = TextureMipMapUtil::GenerateMipMaps(array, filter);
+    const Texture parallelArray = TextureMipMapUtil::GenerateMipMaps(array, filter, jobSystem);
+    EXPECT_EQ(3u, parallelArray.GetLayers());
+    EXPECT_EQ(9u, parallelArray.GetLevels());
+    EXPECT_EQ(GetContent(serialArray), GetContent(parallelArray));
+  }
+}
+
+
+TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_Array_LayersAreIndependent)
+{
+  const Texture src = CreateRandomTexture(TextureType::Tex2DArray, 8, PixelFormat::R8G8B8A8_UNORM, 2);
+  Texture result = TextureMipMapUtil::GenerateMipMaps(src, TextureMipMapFilter::Box);
+  ASSERT_EQ(2u, result.GetLayers());
+
+  for (uint32_t layer = 0; layer < 2u; ++layer)
+  {
+    // Compare against generating the mip maps of the layer as a single bitmap
+    Bitmap layerBitmap(8, 8, PixelFormat::R8G8B8A8_UNORM, BitmapOrigin::UpperLeft);
+    for (uint32_t y = 0; y < 8u; ++y)
+    {
+      for (uint32_t x = 0; x < 8u; ++x)
+      {
+        layerBitmap.SetNativePixel(x, y, GetR8G8B8A8Pixel(src, 0, 0, layer, PxPoint2::Create(UncheckedNumericCast<int32_t>(x), UncheckedNumericCast<int32_t>(y))));
+      }
+    }
+    Texture expected = TextureMipMapUtil::GenerateMipMaps(layerBitmap, TextureMipMapFilter::Box);
+    for (uint32_t level = 0; level < expected.GetLevels(); ++level)
+    {
+      EXPECT_EQ(GetBlob<uint8_t>(expected, level), GetBlob<uint8_t>(result, level, 0, layer));
+    }
+  }
+}
+
+
+TEST(TestTexture_TextureMipMapUtil, GenerateMipMaps_UnsupportedFormat)
+{
+  Bitmap src(2, 2, PixelFormat::R5G6B5_UNORM_PACK16, BitmapOrigin::UpperLeft);
+  EXPECT_THROW(TextureMipMapUtil::GenerateMipMaps(src, TextureMipMapFilter::Lanczos3), UnsupportedPixelFormatException);
+}
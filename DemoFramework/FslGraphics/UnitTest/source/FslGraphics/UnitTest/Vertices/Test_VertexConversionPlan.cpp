@@ -0,0 +1,304 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/Math/LogVector3.hpp>
+#include <FslBase/Log/Math/LogVector4.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/Log/LogColor.hpp>
+#include <FslGraphics/UnitTest/Helper/Common.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <FslGraphics/Vertices/VertexConversionPlan.hpp>
+#include <FslGraphics/Vertices/VertexConverter.hpp>
+#include <FslGraphics/Vertices/VertexPosition.hpp>
+#include <FslGraphics/Vertices/VertexPositionColor.hpp>
+#include <FslGraphics/Vertices/VertexPositionColorF.hpp>
+#include <FslGraphics/Vertices/VertexPositionColorNormalTexture.hpp>
+#include <FslGraphics/Vertices/VertexPositionNormalTexture.hpp>
+#include <FslGraphics/Vertices/VertexPositionTexture.hpp>
+#include <FslGraphics/Vertices/VertexPositionTexture3.hpp>
+#include <array>
+#include <cstring>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestVertices_VertexConversionPlan = TestFixtureFslGraphics;
+  using OperationType = VertexConversionPlan::OperationType;
+  using Operation = VertexConversionPlan::Operation;
+
+  template <typename TDst, typename TSrc>
+  VertexConversionPlan CreatePlan(const TDst& dstDefaultValue = TDst())
+  {
+    return {TDst::AsVertexDeclarationSpan(), TSrc::AsVertexDeclarationSpan(), &dstDefaultValue, sizeof(TDst)};
+  }
+
+  std::vector<VertexPositionColorNormalTexture> CreateVertices(const std::size_t count)
+  {
+    std::vector<VertexPositionColorNormalTexture> vertices(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const auto value = static_cast<float>(i);
+      vertices[i] = VertexPositionColorNormalTexture(Vector3(value, value + 1.0f, value + 2.0f), Vector4(0.25f, 0.5f, 0.75f, 1.0f),
+                                                     Vector3(-value, -value - 1.0f, -value - 2.0f), Vector2(value * 0.5f, value * 2.0f));
+    }
+    return vertices;
+  }
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Construct_Default)
+{
+  VertexConversionPlan plan;
+
+  EXPECT_FALSE(plan.IsValid());
+  EXPECT_FALSE(plan.IsBulkCopy());
+  EXPECT_TRUE(plan.GetOperations().empty());
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Construct_InvalidDefaultValues)
+{
+  const VertexDeclarationSpan dst = VertexPositionColorF::AsVertexDeclarationSpan();
+  const VertexDeclarationSpan src = VertexPosition::AsVertexDeclarationSpan();
+  const VertexPositionColorF defaultValue;
+
+  EXPECT_THROW(VertexConversionPlan(dst, src, nullptr, sizeof(VertexPositionColorF)), std::invalid_argument);
+  EXPECT_THROW(VertexConversionPlan(dst, src, &defaultValue, sizeof(VertexPositionColorF) - 1), std::invalid_argument);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Construct_UnsupportedConversion)
+{
+  EXPECT_THROW((CreatePlan<VertexPositionTexture3, VertexPositionTexture>()), NotImplementedException);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Construct_IdenticalIsBulkCopy)
+{
+  const auto plan = CreatePlan<VertexPositionColorNormalTexture, VertexPositionColorNormalTexture>();
+
+  EXPECT_TRUE(plan.IsValid());
+  EXPECT_TRUE(plan.IsBulkCopy());
+  ASSERT_EQ(1u, plan.GetOperations().size());
+  EXPECT_EQ(Operation(OperationType::Copy, 0u, 0u, sizeof(VertexPositionColorNormalTexture)), plan.GetOperations()[0]);
+  const VertexDeclarationSpan srcVertexDeclaration = VertexPositionColorNormalTexture::AsVertexDeclarationSpan();
+  EXPECT_TRUE(plan.IsPlanFor(srcVertexDeclaration, srcVertexDeclaration));
+  EXPECT_FALSE(plan.IsPlanFor(VertexPositionNormalTexture::AsVertexDeclarationSpan(), srcVertexDeclaration));
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Construct_MergesContiguousCopies)
+{
+  const auto plan = CreatePlan<VertexPositionNormalTexture, VertexPositionColorNormalTexture>();
+
+  EXPECT_FALSE(plan.IsBulkCopy());
+  // The normal and texture coordinate are stored next to each other in both formats so they are merged into one copy
+  ASSERT_EQ(2u, plan.GetOperations().size());
+  EXPECT_EQ(Operation(OperationType::Copy, offsetof(VertexPositionNormalTexture, Position), offsetof(VertexPositionColorNormalTexture, Position),
+                      sizeof(Vector3)),
+            plan.GetOperations()[0]);
+  EXPECT_EQ(Operation(OperationType::Copy, offsetof(VertexPositionNormalTexture, Normal), offsetof(VertexPositionColorNormalTexture, Normal),
+                      sizeof(Vector3) + sizeof(Vector2)),
+            plan.GetOperations()[1]);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Construct_MergesContiguousFills)
+{
+  const auto plan = CreatePlan<VertexPositionColorNormalTexture, VertexPosition>();
+
+  ASSERT_EQ(2u, plan.GetOperations().size());
+  EXPECT_EQ(OperationType::Copy, plan.GetOperations()[0].Type);
+  EXPECT_EQ(Operation(OperationType::Fill, offsetof(VertexPositionColorNormalTexture, Color), offsetof(VertexPositionColorNormalTexture, Color),
+                      sizeof(Vector4) + sizeof(Vector3) + sizeof(Vector2)),
+            plan.GetOperations()[1]);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Apply_BulkCopy)
+{
+  const auto src = CreateVertices(300);
+  std::vector<VertexPositionColorNormalTexture> dst(src.size());
+
+  const auto plan = CreatePlan<VertexPositionColorNormalTexture, VertexPositionColorNormalTexture>();
+  plan.Apply(dst.data(), dst.size() * sizeof(VertexPositionColorNormalTexture), src.data(), src.size() * sizeof(VertexPositionColorNormalTexture),
+             src.size());
+
+  EXPECT_EQ(src, dst);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Apply_CopyAndFill)
+{
+  // Use a vertex count that is not a multiple of the internal chunk size
+  const auto src = CreateVertices(517);
+  std::vector<VertexPositionNormalTexture> dst(src.size());
+
+  const auto plan = CreatePlan<VertexPositionNormalTexture, VertexPositionColorNormalTexture>();
+  plan.Apply(dst.data(), dst.size() * sizeof(VertexPositionNormalTexture), src.data(), src.size() * sizeof(VertexPositionColorNormalTexture),
+             src.size());
+
+  for (std::size_t i = 0; i < src.size(); ++i)
+  {
+    EXPECT_EQ(src[i].Position, dst[i].Position);
+    EXPECT_EQ(src[i].Normal, dst[i].Normal);
+    EXPECT_EQ(src[i].TextureCoordinate, dst[i].TextureCoordinate);
+  }
+
+  const VertexPositionColorF defaultValue(Vector3(), Vector4(0.1f, 0.2f, 0.3f, 0.4f));
+  std::vector<VertexPositionColorF> dst2(src.size());
+  const auto plan2 = CreatePlan<VertexPositionColorF, VertexPosition>(defaultValue);
+  std::vector<VertexPosition> src2(src.size());
+  for (std::size_t i = 0; i < src.size(); ++i)
+  {
+    src2[i].Position = src[i].Position;
+  }
+  plan2.Apply(dst2.data(), dst2.size() * sizeof(VertexPositionColorF), src2.data(), src2.size() * sizeof(VertexPosition), src2.size());
+  for (std::size_t i = 0; i < src.size(); ++i)
+  {
+    EXPECT_EQ(src2[i].Position, dst2[i].Position);
+    EXPECT_EQ(defaultValue.Color, dst2[i].Color);
+  }
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Apply_Vector4ToUNorm8)
+{
+  const std::array<VertexPositionColorF, 3> src = {VertexPositionColorF(Vector3(1.0f, 2.0f, 3.0f), Vector4(0.0f, 0.25f, 0.5f, 1.0f)),
+                                                   VertexPositionColorF(Vector3(4.0f, 5.0f, 6.0f), Vector4(1.0f, 0.75f, 0.5f, 0.0f)),
+                                                   VertexPositionColorF(Vector3(7.0f, 8.0f, 9.0f), Vector4(-1.0f, 2.0f, 0.1f, 0.9f))};
+  std::array<VertexPositionColor, 3> dst;
+
+  const auto plan = CreatePlan<VertexPositionColor, VertexPositionColorF>();
+  ASSERT_EQ(2u, plan.GetOperations().size());
+  EXPECT_EQ(OperationType::Vector4ToX8Y8Z8W8Unorm, plan.GetOperations()[1].Type);
+
+  plan.Apply(dst.data(), dst.size() * sizeof(VertexPositionColor), src.data(), src.size() * sizeof(VertexPositionColorF), src.size());
+
+  for (std::size_t i = 0; i < src.size(); ++i)
+  {
+    EXPECT_EQ(src[i].Position, dst[i].Position);
+    EXPECT_EQ(Color(src[i].Color), dst[i].Color);
+  }
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Apply_UNorm8ToVector4)
+{
+  const std::array<VertexPositionColor, 2> src = {VertexPositionColor(Vector3(1.0f, 2.0f, 3.0f), Color(0u, 64u, 128u, 255u)),
+                                                  VertexPositionColor(Vector3(4.0f, 5.0f, 6.0f), Color(255u, 1u, 2u, 3u))};
+  std::array<VertexPositionColorF, 2> dst;
+
+  const auto plan = CreatePlan<VertexPositionColorF, VertexPositionColor>();
+  plan.Apply(dst.data(), dst.size() * sizeof(VertexPositionColorF), src.data(), src.size() * sizeof(VertexPositionColor), src.size());
+
+  for (std::size_t i = 0; i < src.size(); ++i)
+  {
+    EXPECT_EQ(src[i].Position, dst[i].Position);
+    EXPECT_EQ(src[i].Color.ToVector4(), dst[i].Color);
+  }
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Apply_UnalignedSrc)
+{
+  const auto vertices = CreateVertices(33);
+  const std::size_t cbSrc = vertices.size() * sizeof(VertexPositionColorNormalTexture);
+  std::vector<uint8_t> srcBuffer(cbSrc + 1);
+  std::memcpy(srcBuffer.data() + 1, vertices.data(), cbSrc);
+  std::vector<VertexPositionColor> dst(vertices.size());
+
+  const auto plan = CreatePlan<VertexPositionColor, VertexPositionColorNormalTexture>();
+  plan.Apply(dst.data(), dst.size() * sizeof(VertexPositionColor), srcBuffer.data() + 1, cbSrc, vertices.size());
+
+  for (std::size_t i = 0; i < vertices.size(); ++i)
+  {
+    EXPECT_EQ(vertices[i].Position, dst[i].Position);
+    EXPECT_EQ(Color(vertices[i].Color), dst[i].Color);
+  }
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Apply_MatchesGenericConvert)
+{
+  const auto src = CreateVertices(1000);
+  std::vector<VertexPositionNormalTexture> dstPlan(src.size());
+  std::vector<VertexPositionNormalTexture> dstConverter(src.size());
+
+  const auto plan = CreatePlan<VertexPositionNormalTexture, VertexPositionColorNormalTexture>();
+  plan.Apply(dstPlan.data(), dstPlan.size() * sizeof(VertexPositionNormalTexture), src.data(),
+             src.size() * sizeof(VertexPositionColorNormalTexture), src.size());
+  VertexConverter::Convert(dstConverter.data(), dstConverter.size(), src.data(), src.size());
+
+  EXPECT_EQ(dstConverter, dstPlan);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Apply_Parallel)
+{
+  const auto src = CreateVertices(100000);
+  std::vector<VertexPositionColor> dstSerial(src.size());
+  std::vector<VertexPositionColor> dstParallel(src.size());
+
+  const auto plan = CreatePlan<VertexPositionColor, VertexPositionColorNormalTexture>();
+  plan.Apply(dstSerial.data(), dstSerial.size() * sizeof(VertexPositionColor), src.data(), src.size() * sizeof(VertexPositionColorNormalTexture),
+             src.size());
+  JobSystem jobSystem(3);
+  plan.Apply(jobSystem, dstParallel.data(), dstParallel.size() * sizeof(VertexPositionColor), src.data(),
+             src.size() * sizeof(VertexPositionColorNormalTexture), src.size());
+
+  EXPECT_EQ(dstSerial, dstParallel);
+}
+
+
+TEST(TestVertices_VertexConversionPlan, Apply_Invalid)
+{
+  const auto src = CreateVertices(4);
+  std::vector<VertexPosition> dst(src.size());
+
+  EXPECT_THROW(VertexConversionPlan().Apply(dst.data(), dst.size() * sizeof(VertexPosition), src.data(),
+                                            src.size() * sizeof(VertexPositionColorNormalTexture), src.size()),
+               UsageErrorException);
+
+  const auto plan = CreatePlan<VertexPosition, VertexPositionColorNormalTexture>();
+  EXPECT_THROW(
+    plan.Apply(nullptr, dst.size() * sizeof(VertexPosition), src.data(), src.size() * sizeof(VertexPositionColorNormalTexture), src.size()),
+    std::invalid_argument);
+  EXPECT_THROW(plan.Apply(dst.data(), dst.size() * sizeof(VertexPosition), src.data(), src.size() * sizeof(VertexPositionColorNormalTexture) - 1,
+                          src.size()),
+               std::invalid_argument);
+  EXPECT_THROW(
+    plan.Apply(dst.data(), dst.size() * sizeof(VertexPosition) - 1, src.data(), src.size() * sizeof(VertexPositionColorNormalTexture), src.size()),
+    std::invalid_argument);
+}
@@ -0,0 +1,81 @@
+#ifndef FSLGRAPHICS_BITMAP_RAWBITMAPKERNELS_HPP
+#define FSLGRAPHICS_BITMAP_RAWBITMAPKERNELS_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+namespace Fsl
+{
+  //! @brief The instruction set used by a set of bitmap row kernels
+  enum class RawBitmapKernelSet
+  {
+    Scalar,
+    SSE41,
+    AVX2,
+    Neon
+  };
+
+  //! @brief Row kernels used by RawBitmapUtil. Each kernel processes a single row of 'width' pixels.
+  //!        The kernels support the same in-place usage as the scalar code: pDst == pSrc or pDst located before pSrc (a smaller dst stride).
+  struct RawBitmapRowKernels
+  {
+    void (*Swizzle24)(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                      const uint32_t srcIdx2) noexcept;
+    void (*Swizzle32)(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1, const uint32_t srcIdx2,
+                      const uint32_t srcIdx3) noexcept;
+    void (*Swizzle32To24)(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                          const uint32_t srcIdx2) noexcept;
+    //! @note The row is processed back to front which allows in-place expansion.
+    void (*Swizzle24To32)(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t dstIdx0, const uint32_t dstIdx1,
+                          const uint32_t dstIdx2, const uint32_t dstIdx3, const uint8_t value3) noexcept;
+    //! @note pDst and pSrc can not overlap
+    void (*Expand1ByteToNBytes)(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t dstBytesPerPixel) noexcept;
+  };
+
+  namespace RawBitmapKernels
+  {
+    //! @brief Check if the kernel set is supported by the current CPU
+    bool IsSupported(const RawBitmapKernelSet kernelSet) noexcept;
+
+    //! @brief Get the fastest kernel set supported by the current CPU
+    RawBitmapKernelSet GetBestKernelSet() noexcept;
+
+    //! @brief Get the kernels for the given set
+    //! @throws NotSupportedException if the kernel set is unsupported by the current CPU
+    const RawBitmapRowKernels& GetKernels(const RawBitmapKernelSet kernelSet);
+
+    //! @brief Get the fastest kernels supported by the current CPU
+    const RawBitmapRowKernels& GetKernels() noexcept;
+  }
+}
+
+#endif
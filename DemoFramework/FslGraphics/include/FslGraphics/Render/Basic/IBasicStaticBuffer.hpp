@@ -49,6 +49,10 @@ namespace Fsl
 
     //! @brief Try to acquire the current native handle (do not cache this, it will only be valid until the next frame!)
     virtual BasicNativeBufferHandle TryGetNativeHandle() const noexcept = 0;
+
+    //! @brief Get the byte offset of the buffer content inside the native buffer (do not cache this, it will only be valid until the next frame!)
+    //! @note This is non zero when the buffer has been sub-allocated from a larger native buffer.
+    virtual uint32_t GetNativeByteOffset() const noexcept = 0;
   };
 }
 
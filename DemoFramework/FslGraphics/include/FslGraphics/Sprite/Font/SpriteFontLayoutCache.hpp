@@ -0,0 +1,131 @@
+#ifndef FSLGRAPHICS_SPRITE_FONT_SPRITEFONTLAYOUTCACHE_HPP
+#define FSLGRAPHICS_SPRITE_FONT_SPRITEFONTLAYOUTCACHE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxSize2D.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <FslGraphics/Font/BitmapFontConfig.hpp>
+#include <FslGraphics/Sprite/Font/SpriteFontGlyphPosition.hpp>
+#include <FslGraphics/Sprite/Font/SpriteFontLayoutCacheStats.hpp>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief A least recently used cache of the measured size and glyph positions of strings laid out with a font.
+  //!        Each entry is keyed by the font config and the string. The cache stores the results of the font, it does not calculate them.
+  //! @note  All methods are thread safe.
+  class SpriteFontLayoutCache
+  {
+    static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+    struct Record
+    {
+      std::size_t Hash{0};
+      BitmapFontConfig FontConfig;
+      std::string Text;
+      std::optional<PxSize2D> MeasuredSizePx;
+      //! If set it contains the result of ExtractRenderRules (false means the string would not render anything)
+      std::optional<bool> RenderRulesResult;
+      std::vector<SpriteFontGlyphPosition> Glyphs;
+      uint32_t PrevIndex{InvalidIndex};
+      uint32_t NextIndex{InvalidIndex};
+    };
+
+    mutable std::mutex m_lock;
+    uint32_t m_capacity;
+    std::vector<Record> m_records;
+    std::unordered_map<std::size_t, uint32_t> m_lookup;
+    //! The head of the least recently used list
+    uint32_t m_mostRecentIndex{InvalidIndex};
+    uint32_t m_leastRecentIndex{InvalidIndex};
+    SpriteFontLayoutCacheStats m_stats;
+
+  public:
+    //! The default maximum number of entries
+    static constexpr uint32_t DefaultCapacity = 512;
+    //! Strings longer than this are never cached
+    static constexpr uint32_t MaxTextLength = 256;
+
+    SpriteFontLayoutCache(const SpriteFontLayoutCache&) = delete;
+    SpriteFontLayoutCache& operator=(const SpriteFontLayoutCache&) = delete;
+
+    //! @param capacity the maximum number of entries (zero disables the cache)
+    explicit SpriteFontLayoutCache(const uint32_t capacity = DefaultCapacity);
+
+    //! @brief Check if the string can be stored in the cache
+    static bool IsCacheable(const StringViewLite& strView) noexcept
+    {
+      return !strView.empty() && strView.size() <= MaxTextLength;
+    }
+
+    uint32_t GetCapacity() const noexcept;
+
+    //! @brief Change the maximum number of entries, this clears the cache (zero disables the cache)
+    void SetCapacity(const uint32_t capacity);
+
+    //! @brief Remove all entries (the stats are not reset)
+    void Clear() noexcept;
+
+    SpriteFontLayoutCacheStats GetStats() const noexcept;
+
+    //! @brief Try to get the cached measured size of the string
+    std::optional<PxSize2D> TryGetMeasuredSize(const StringViewLite& strView, const BitmapFontConfig& fontConfig);
+
+    //! @brief Store the measured size of the string
+    void SetMeasuredSize(const StringViewLite& strView, const BitmapFontConfig& fontConfig, const PxSize2D sizePx);
+
+    //! @brief Try to copy the cached glyph positions of the string to dst.
+    //! @param dst must be able to contain strView.size() entries.
+    //! @return the cached ExtractRenderRules result (dst is only modified if it is true) or nullopt if the string was not cached.
+    std::optional<bool> TryCopyRenderRules(Span<SpriteFontGlyphPosition> dst, const StringViewLite& strView, const BitmapFontConfig& fontConfig);
+
+    //! @brief Store the glyph positions of the string
+    //! @param result the ExtractRenderRules result, if true glyphs should contain the strView.size() extracted entries.
+    void SetRenderRules(const StringViewLite& strView, const BitmapFontConfig& fontConfig, const bool result,
+                        const ReadOnlySpan<SpriteFontGlyphPosition> glyphs);
+
+  private:
+    Record* TryGet(const StringViewLite& strView, const BitmapFontConfig& fontConfig);
+    Record& GetOrCreate(const StringViewLite& strView, const BitmapFontConfig& fontConfig);
+    void MarkAsMostRecent(const uint32_t index) noexcept;
+    void Unlink(const uint32_t index) noexcept;
+  };
+}
+
+#endif
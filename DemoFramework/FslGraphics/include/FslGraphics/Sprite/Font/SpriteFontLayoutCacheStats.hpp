@@ -0,0 +1,71 @@
+#ifndef FSLGRAPHICS_SPRITE_FONT_SPRITEFONTLAYOUTCACHESTATS_HPP
+#define FSLGRAPHICS_SPRITE_FONT_SPRITEFONTLAYOUTCACHESTATS_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+namespace Fsl
+{
+  struct SpriteFontLayoutCacheStats
+  {
+    //! The number of measure and render rule requests that were served from the cache
+    uint64_t Hits{0};
+    //! The number of cacheable requests that had to be calculated
+    uint64_t Misses{0};
+    //! The number of entries that were evicted to make room for new entries
+    uint64_t Evictions{0};
+    //! The current number of entries
+    uint32_t EntryCount{0};
+
+    constexpr SpriteFontLayoutCacheStats() noexcept = default;
+
+    constexpr SpriteFontLayoutCacheStats(const uint64_t hits, const uint64_t misses, const uint64_t evictions, const uint32_t entryCount) noexcept
+      : Hits(hits)
+      , Misses(misses)
+      , Evictions(evictions)
+      , EntryCount(entryCount)
+    {
+    }
+
+    constexpr bool operator==(const SpriteFontLayoutCacheStats& rhs) const noexcept
+    {
+      return Hits == rhs.Hits && Misses == rhs.Misses && Evictions == rhs.Evictions && EntryCount == rhs.EntryCount;
+    }
+
+    constexpr bool operator!=(const SpriteFontLayoutCacheStats& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
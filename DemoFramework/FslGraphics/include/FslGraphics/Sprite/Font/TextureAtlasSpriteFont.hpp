@@ -43,6 +43,8 @@
 #include <FslGraphics/Font/FontGlyphRange.hpp>
 #include <FslGraphics/Sprite/Font/SpriteFontFastLookup.hpp>
 #include <FslGraphics/Sprite/Font/SpriteFontGlyphPosition.hpp>
+#include <FslGraphics/Sprite/Font/SpriteFontLayoutCache.hpp>
+#include <memory>
 
 namespace Fsl
 {
@@ -57,6 +59,8 @@ namespace Fsl
     SpriteFontCharInfo m_unknownChar;
     PxThicknessU16 m_charPaddingPx;
     BitmapFontType m_fontType{BitmapFontType::Bitmap};
+    //! Cache of the measured strings and their glyph positions (nullptr if the font was moved from)
+    std::unique_ptr<SpriteFontLayoutCache> m_layoutCache{std::make_unique<SpriteFontLayoutCache>()};
 
   public:
     // move assignment operator
@@ -72,6 +76,7 @@ namespace Fsl
         m_unknownChar = other.m_unknownChar;
         m_charPaddingPx = other.m_charPaddingPx;
         m_fontType = other.m_fontType;
+        m_layoutCache = std::move(other.m_layoutCache);
 
         // Remove the data from other
         other.m_unknownChar = {};
@@ -87,6 +92,7 @@ namespace Fsl
       , m_unknownChar(other.m_unknownChar)
       , m_charPaddingPx(other.m_charPaddingPx)
       , m_fontType(other.m_fontType)
+      , m_layoutCache(std::move(other.m_layoutCache))
     {
       other.m_unknownChar = {};
       other.m_charPaddingPx = {};
@@ -106,6 +112,10 @@ namespace Fsl
     {
       m_lookup.Clear();
       m_unknownChar = {};
+      if (m_layoutCache)
+      {
+        m_layoutCache->Clear();
+      }
     }
 
     void Reset(const SpriteNativeAreaCalc& spriteNativeAreaCalc, const PxExtent2D textureExtentPx, const BitmapFont& bitmapFont,
@@ -176,8 +186,23 @@ namespace Fsl
       return m_lookup.GetChar(charId, m_unknownChar);
     }
 
+    //! @brief Get the hit and miss statistics of the layout cache shared by MeasureString and ExtractRenderRules
+    SpriteFontLayoutCacheStats GetLayoutCacheStats() const noexcept
+    {
+      return m_layoutCache ? m_layoutCache->GetStats() : SpriteFontLayoutCacheStats();
+    }
+
+    //! @brief Set the maximum number of strings stored in the layout cache (zero disables the cache)
+    void SetLayoutCacheCapacity(const uint32_t capacity);
 
   private:
+    BitmapFontConfig ToCacheFontConfig(const BitmapFontConfig& fontConfig) const noexcept
+    {
+      return BitmapFontConfig(fontConfig.Scale, fontConfig.Kerning && m_lookup.HasKerning());
+    }
+
+    PxSize2D MeasureStringUncached(const StringViewLite& strView, const BitmapFontConfig& fontConfig) const;
+    bool ExtractRenderRulesUncached(Span<SpriteFontGlyphPosition> dst, const StringViewLite& strView, const BitmapFontConfig& fontConfig) const;
     // void DoConstruct(const ITextureAtlas& textureAtlas, const IFontBasicKerning& basicFontKerning);
   };
 }
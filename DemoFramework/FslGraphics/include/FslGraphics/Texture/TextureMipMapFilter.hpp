@@ -38,6 +38,12 @@ namespace Fsl
   {
     Nearest,
     Box,
+    //! A box filter that averages the SRGB encoded color channels in linear space.
+    GammaCorrectBox,
+    //! A Lanczos (a=3) windowed sinc filter. Sharper than box, but can produce minor ringing. SRGB formats are filtered in linear space.
+    Lanczos3,
+    //! A Kaiser (alpha=4, width=3) windowed sinc filter. SRGB formats are filtered in linear space.
+    Kaiser,
   };
 }
 
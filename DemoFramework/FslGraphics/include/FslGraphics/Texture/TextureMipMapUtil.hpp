@@ -37,6 +37,7 @@
 namespace Fsl
 {
   class Bitmap;
+  class JobSystem;
   class ReadOnlyRawBitmap;
   class ReadOnlyRawTexture;
 
@@ -57,6 +58,20 @@ namespace Fsl
 
     //! @brief Generate a new texture with mip maps based on the src
     extern Texture GenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter);
+
+    //! @brief Generate a new texture with mip maps based on the src, each level is generated in parallel across faces, layers and row tiles.
+    extern Texture GenerateMipMaps(const Bitmap& src, const TextureMipMapFilter filter, JobSystem& rJobSystem);
+
+    //! @brief Generate a new texture with mip maps based on the src, each level is generated in parallel across faces, layers and row tiles.
+    extern Texture GenerateMipMaps(const Texture& src, const TextureMipMapFilter filter, JobSystem& rJobSystem);
+
+    //! @brief Generate a new texture with mip maps based on the src, each level is generated in parallel across faces, layers and row tiles.
+    extern Texture GenerateMipMaps(const ReadOnlyRawBitmap& src, const TextureMipMapFilter filter, JobSystem& rJobSystem);
+
+    //! @brief Generate a new texture with mip maps based on the src, each level is generated in parallel across faces, layers and row tiles.
+    //! @note  Nearest and Box use RawBitmapUtil for the formats it supports (32bit R8G8B8A8 compatible) and produce identical results.
+    //!        All other filters and formats are filtered in floating point (8/16bit UNorm, SRGB, 16/32bit SFloat formats are supported).
+    extern Texture GenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter, JobSystem& rJobSystem);
   };
 }
 
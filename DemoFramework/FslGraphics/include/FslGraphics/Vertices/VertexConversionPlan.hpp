@@ -0,0 +1,180 @@
+#ifndef FSLGRAPHICS_VERTICES_VERTEXCONVERSIONPLAN_HPP
+#define FSLGRAPHICS_VERTICES_VERTEXCONVERSIONPLAN_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslGraphics/Vertices/VertexDeclaration.hpp>
+#include <FslGraphics/Vertices/VertexDeclarationSpan.hpp>
+#include <cstdlib>
+#include <vector>
+
+namespace Fsl
+{
+  class JobSystem;
+
+  //! @brief A precompiled conversion from one vertex declaration to another.
+  //!        The plan is built once per declaration pair and can then be applied to any number of vertex spans.
+  //!        - Elements that are stored contiguously in both the src and dst vertex are merged into one copy operation.
+  //!        - Default value fills for contiguous dst elements are merged into one fill operation.
+  //!        - If the declarations are identical the whole vertex span is copied with one memcpy.
+  //!        - Known format pairs are converted with specialized kernels.
+  class VertexConversionPlan
+  {
+  public:
+    enum class OperationType : uint8_t
+    {
+      //! Copy ByteSize bytes from SrcOffset to DstOffset
+      Copy,
+      //! Fill ByteSize bytes at DstOffset with the dst default values
+      Fill,
+      //! Vector4 -> X8Y8Z8W8_UNORM (the float values are clamped to [0,1])
+      Vector4ToX8Y8Z8W8Unorm,
+      //! Vector4 -> X16Y16Z16W16_UNORM (the float values are clamped to [0,1])
+      Vector4ToX16Y16Z16W16Unorm,
+      //! X8Y8Z8W8_UNORM -> Vector4
+      X8Y8Z8W8UnormToVector4,
+      //! X16Y16Z16W16_UNORM -> Vector4
+      X16Y16Z16W16UnormToVector4,
+    };
+
+    struct Operation
+    {
+      OperationType Type{OperationType::Copy};
+      uint32_t DstOffset{0};
+      uint32_t SrcOffset{0};
+      //! The number of dst bytes written by the operation
+      uint32_t ByteSize{0};
+
+      constexpr Operation() noexcept = default;
+      constexpr Operation(const OperationType type, const uint32_t dstOffset, const uint32_t srcOffset, const uint32_t byteSize) noexcept
+        : Type(type)
+        , DstOffset(dstOffset)
+        , SrcOffset(srcOffset)
+        , ByteSize(byteSize)
+      {
+      }
+
+      constexpr bool operator==(const Operation& rhs) const noexcept
+      {
+        return Type == rhs.Type && DstOffset == rhs.DstOffset && SrcOffset == rhs.SrcOffset && ByteSize == rhs.ByteSize;
+      }
+
+      constexpr bool operator!=(const Operation& rhs) const noexcept
+      {
+        return !(*this == rhs);
+      }
+    };
+
+  private:
+    VertexDeclaration m_dstVertexDeclaration;
+    VertexDeclaration m_srcVertexDeclaration;
+    std::vector<Operation> m_operations;
+    std::vector<uint8_t> m_dstDefaultValues;
+    bool m_isValid{false};
+    bool m_isBulkCopy{false};
+
+  public:
+    VertexConversionPlan(const VertexConversionPlan&) = default;
+    VertexConversionPlan& operator=(const VertexConversionPlan&) = default;
+    VertexConversionPlan(VertexConversionPlan&& other) noexcept = default;
+    VertexConversionPlan& operator=(VertexConversionPlan&& other) noexcept = default;
+
+    VertexConversionPlan() = default;
+
+    //! @brief Build a conversion plan
+    //! @param dstVertexDeclaration the format of the dst vertices.
+    //! @param srcVertexDeclaration the format of the src vertices.
+    //! @param pDstDefaultValues points to one dst type vertex that holds the default values which is used to fill in required fields in a dst vertex
+    //! which are missing from a src vertex (the values are copied into the plan).
+    //! @param cbDstDefaultValues the number of bytes used for the default vertex.
+    //! @note Fields that are present in dst but not in src are filled with the supplied default values. Src fields that isn't present in the dst
+    //! format will be ignored.
+    //! @throws NotImplementedException if a element needs a format conversion that is not supported.
+    VertexConversionPlan(VertexDeclarationSpan dstVertexDeclaration, VertexDeclarationSpan srcVertexDeclaration, const void* const pDstDefaultValues,
+                         const uint32_t cbDstDefaultValues);
+
+    bool IsValid() const noexcept
+    {
+      return m_isValid;
+    }
+
+    //! @brief Check if the plan converts between the two declarations
+    bool IsPlanFor(VertexDeclarationSpan dstVertexDeclaration, VertexDeclarationSpan srcVertexDeclaration) const noexcept
+    {
+      return m_isValid && m_dstVertexDeclaration.AsSpan() == dstVertexDeclaration && m_srcVertexDeclaration.AsSpan() == srcVertexDeclaration;
+    }
+
+    //! @brief If true the src and dst vertices are identical and Apply will do one memcpy of the entire vertex span.
+    bool IsBulkCopy() const noexcept
+    {
+      return m_isBulkCopy;
+    }
+
+    VertexDeclarationSpan DstVertexDeclaration() const noexcept
+    {
+      return m_dstVertexDeclaration.AsSpan();
+    }
+
+    VertexDeclarationSpan SrcVertexDeclaration() const noexcept
+    {
+      return m_srcVertexDeclaration.AsSpan();
+    }
+
+    //! @brief Get the operations that are executed for each vertex (ordered by dst offset)
+    ReadOnlySpan<Operation> GetOperations() const noexcept
+    {
+      return ReadOnlySpan<Operation>(m_operations.data(), m_operations.size());
+    }
+
+    //! @brief Convert vertexCount vertices from pSrc to pDst.
+    //! @param pDst the dst vertices that should be written to (of the format described by DstVertexDeclaration). This points to the start of the
+    //! first element.
+    //! @param cbDst the number of bytes the pDst array can hold.
+    //! @param pSrc the src vertices that should be converted (of the format described by SrcVertexDeclaration). This points to the start of the
+    //! first element. The src is not required to be aligned.
+    //! @param cbSrc the number of bytes the pSrc array holds.
+    //! @param vertexCount the number of vertices that should be converted.
+    //! @note The src and dst memory may not overlap.
+    void Apply(void* const pDst, const std::size_t cbDst, const void* const pSrc, const std::size_t cbSrc, const std::size_t vertexCount) const;
+
+    //! @brief Convert vertexCount vertices from pSrc to pDst splitting large spans into ranges that are converted in parallel.
+    //! @note See Apply above for a description of the parameters.
+    void Apply(JobSystem& jobSystem, void* const pDst, const std::size_t cbDst, const void* const pSrc, const std::size_t cbSrc,
+               const std::size_t vertexCount) const;
+
+  private:
+    void ApplyRange(uint8_t* const pDst, const uint8_t* const pSrc, const std::size_t vertexCount) const noexcept;
+  };
+}
+
+#endif
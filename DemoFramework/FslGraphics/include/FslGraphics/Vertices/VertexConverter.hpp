@@ -126,6 +126,7 @@ namespace Fsl
     //! @param cbDstDefaultValues the number of bytes used for the default vertex.
     //! @note Fields that are present in dst but not in src are filled with the supplied default values. Src fields that isn't present in the dst
     //! format will be ignored.
+    //! @note This builds a VertexConversionPlan for each call, if the same declarations are converted repeatedly build the plan once and reuse it.
     static void GenericConvert(void* const pDst, const std::size_t cbDst, VertexDeclarationSpan dstVertexDeclaration, const void* const pSrc,
                                const std::size_t cbSrc, VertexDeclarationSpan srcVertexDeclaration, const std::size_t srcVertexCount,
                                const void* const pDstDefaultValues, const uint32_t cbDstDefaultValues);
@@ -144,6 +145,7 @@ namespace Fsl
     //! @param cbDstDefaultValues the number of bytes used for the default vertex.
     //! @note Fields that are present in dst but not in src are filled with the supplied default values. Src fields that isn't present in the dst
     //! format will be ignored.
+    //! @note This builds a VertexConversionPlan for each call, if the same declarations are converted repeatedly build the plan once and reuse it.
     static void GenericConvert(void* const pDst, const std::size_t cbDst, VertexDeclarationSpan dstVertexDeclaration, const void* const pSrc,
                                const std::size_t cbSrc, VertexDeclarationSpan srcVertexDeclaration, const std::size_t srcVertexStartIndex,
                                const std::size_t srcVertexCount, const void* const pDstDefaultValues, const uint32_t cbDstDefaultValues);
@@ -0,0 +1,189 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/System/CpuFeatures.hpp>
+#include <FslGraphics/Bitmap/RawBitmapKernels.hpp>
+#include "RawBitmapKernelsInternal.hpp"
+
+namespace Fsl
+{
+  namespace RawBitmapKernelsInternal
+  {
+    void Swizzle24Scalar(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                         const uint32_t srcIdx2) noexcept
+    {
+      for (uint32_t x = 0; x < width; ++x)
+      {
+        const auto c0 = pSrc[(x * 3) + srcIdx0];
+        const auto c1 = pSrc[(x * 3) + srcIdx1];
+        const auto c2 = pSrc[(x * 3) + srcIdx2];
+        pDst[(x * 3) + 0] = c0;
+        pDst[(x * 3) + 1] = c1;
+        pDst[(x * 3) + 2] = c2;
+      }
+    }
+
+
+    void Swizzle32Scalar(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                         const uint32_t srcIdx2, const uint32_t srcIdx3) noexcept
+    {
+      for (uint32_t x = 0; x < width; ++x)
+      {
+        const uint8_t b0 = pSrc[(x * 4) + srcIdx0];
+        const uint8_t b1 = pSrc[(x * 4) + srcIdx1];
+        const uint8_t b2 = pSrc[(x * 4) + srcIdx2];
+        const uint8_t b3 = pSrc[(x * 4) + srcIdx3];
+        pDst[(x * 4) + 0] = b0;
+        pDst[(x * 4) + 1] = b1;
+        pDst[(x * 4) + 2] = b2;
+        pDst[(x * 4) + 3] = b3;
+      }
+    }
+
+
+    void Swizzle32To24Scalar(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                             const uint32_t srcIdx2) noexcept
+    {
+      for (uint32_t x = 0; x < width; ++x)
+      {
+        const uint8_t b0 = pSrc[(x * 4) + srcIdx0];
+        const uint8_t b1 = pSrc[(x * 4) + srcIdx1];
+        const uint8_t b2 = pSrc[(x * 4) + srcIdx2];
+        pDst[(x * 3) + 0] = b0;
+        pDst[(x * 3) + 1] = b1;
+        pDst[(x * 3) + 2] = b2;
+      }
+    }
+
+
+    void Swizzle24To32Scalar(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t dstIdx0, const uint32_t dstIdx1,
+                             const uint32_t dstIdx2, const uint32_t dstIdx3, const uint8_t value3) noexcept
+    {
+      // Back to front to allow in-place expansion
+      for (uint32_t x = width; x > 0; --x)
+      {
+        const uint32_t index = x - 1;
+        const uint8_t b0 = pSrc[(index * 3) + 0];
+        const uint8_t b1 = pSrc[(index * 3) + 1];
+        const uint8_t b2 = pSrc[(index * 3) + 2];
+        pDst[(index * 4) + dstIdx0] = b0;
+        pDst[(index * 4) + dstIdx1] = b1;
+        pDst[(index * 4) + dstIdx2] = b2;
+        pDst[(index * 4) + dstIdx3] = value3;
+      }
+    }
+
+
+    void Expand1ByteToNBytesScalar(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t dstBytesPerPixel) noexcept
+    {
+      for (uint32_t x = 0; x < width; ++x)
+      {
+        const uint8_t b0 = pSrc[x];
+        for (uint32_t i = 0; i < dstBytesPerPixel; ++i)
+        {
+          pDst[(x * dstBytesPerPixel) + i] = b0;
+        }
+      }
+    }
+  }
+
+  namespace
+  {
+    constexpr RawBitmapRowKernels ScalarKernels{RawBitmapKernelsInternal::Swizzle24Scalar, RawBitmapKernelsInternal::Swizzle32Scalar,
+                                                RawBitmapKernelsInternal::Swizzle32To24Scalar, RawBitmapKernelsInternal::Swizzle24To32Scalar,
+                                                RawBitmapKernelsInternal::Expand1ByteToNBytesScalar};
+
+    const RawBitmapRowKernels* TryGetKernels(const RawBitmapKernelSet kernelSet) noexcept
+    {
+      switch (kernelSet)
+      {
+      case RawBitmapKernelSet::Scalar:
+        return &ScalarKernels;
+      case RawBitmapKernelSet::SSE41:
+        return CpuFeatures::HasSSE41() ? RawBitmapKernelsInternal::TryGetSSE41Kernels() : nullptr;
+      case RawBitmapKernelSet::AVX2:
+        return CpuFeatures::HasAVX2() ? RawBitmapKernelsInternal::TryGetAVX2Kernels() : nullptr;
+      case RawBitmapKernelSet::Neon:
+        return CpuFeatures::HasNeon() ? RawBitmapKernelsInternal::TryGetNeonKernels() : nullptr;
+      }
+      return nullptr;
+    }
+
+    RawBitmapKernelSet DetectBestKernelSet() noexcept
+    {
+      if (RawBitmapKernels::IsSupported(RawBitmapKernelSet::AVX2))
+      {
+        return RawBitmapKernelSet::AVX2;
+      }
+      if (RawBitmapKernels::IsSupported(RawBitmapKernelSet::SSE41))
+      {
+        return RawBitmapKernelSet::SSE41;
+      }
+      if (RawBitmapKernels::IsSupported(RawBitmapKernelSet::Neon))
+      {
+        return RawBitmapKernelSet::Neon;
+      }
+      return RawBitmapKernelSet::Scalar;
+    }
+  }
+
+
+  bool RawBitmapKernels::IsSupported(const RawBitmapKernelSet kernelSet) noexcept
+  {
+    return TryGetKernels(kernelSet) != nullptr;
+  }
+
+
+  RawBitmapKernelSet RawBitmapKernels::GetBestKernelSet() noexcept
+  {
+    static const RawBitmapKernelSet g_bestKernelSet = DetectBestKernelSet();
+    return g_bestKernelSet;
+  }
+
+
+  const RawBitmapRowKernels& RawBitmapKernels::GetKernels(const RawBitmapKernelSet kernelSet)
+  {
+    const RawBitmapRowKernels* pKernels = TryGetKernels(kernelSet);
+    if (pKernels == nullptr)
+    {
+      throw NotSupportedException("The kernel set is not supported by this CPU");
+    }
+    return *pKernels;
+  }
+
+
+  const RawBitmapRowKernels& RawBitmapKernels::GetKernels() noexcept
+  {
+    static const RawBitmapRowKernels* const g_pKernels = TryGetKernels(GetBestKernelSet());
+    return *g_pKernels;
+  }
+}
@@ -0,0 +1,65 @@
+#ifndef FSLGRAPHICS_BITMAP_KERNELS_RAWBITMAPKERNELSINTERNAL_HPP
+#define FSLGRAPHICS_BITMAP_KERNELS_RAWBITMAPKERNELSINTERNAL_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslGraphics/Bitmap/RawBitmapKernels.hpp>
+
+namespace Fsl::RawBitmapKernelsInternal
+{
+  // The scalar reference kernels, these are also used by the SIMD kernels to process the part of a row that does not fill a SIMD register.
+
+  void Swizzle24Scalar(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                       const uint32_t srcIdx2) noexcept;
+  void Swizzle32Scalar(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                       const uint32_t srcIdx2, const uint32_t srcIdx3) noexcept;
+  void Swizzle32To24Scalar(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                           const uint32_t srcIdx2) noexcept;
+  void Swizzle24To32Scalar(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t dstIdx0, const uint32_t dstIdx1,
+                           const uint32_t dstIdx2, const uint32_t dstIdx3, const uint8_t value3) noexcept;
+  void Expand1ByteToNBytesScalar(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t dstBytesPerPixel) noexcept;
+
+  //! Check if the four indices are a permutation of 0,1,2,3 (which means every byte of the pixel is written exactly once)
+  constexpr bool IsPermutation(const uint32_t idx0, const uint32_t idx1, const uint32_t idx2, const uint32_t idx3) noexcept
+  {
+    return idx0 <= 3u && idx1 <= 3u && idx2 <= 3u && idx3 <= 3u && ((1u << idx0) | (1u << idx1) | (1u << idx2) | (1u << idx3)) == 0xFu;
+  }
+
+  //! @return the kernels or nullptr if they are not available on this platform
+  const RawBitmapRowKernels* TryGetSSE41Kernels() noexcept;
+  //! @return the kernels or nullptr if they are not available on this platform
+  const RawBitmapRowKernels* TryGetAVX2Kernels() noexcept;
+  //! @return the kernels or nullptr if they are not available on this platform
+  const RawBitmapRowKernels* TryGetNeonKernels() noexcept;
+}
+
+#endif
@@ -0,0 +1,165 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/CpuFeatures.hpp>
+#include "RawBitmapKernelsInternal.hpp"
+#if defined(FSL_CPU_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace Fsl::RawBitmapKernelsInternal
+{
+#if defined(FSL_CPU_ARM64)
+  namespace
+  {
+    // The NEON structure loads/stores de-interleave the channels so a swizzle is just a reordering of the registers.
+
+    void Swizzle24Neon(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                       const uint32_t srcIdx2) noexcept
+    {
+      uint32_t x = 0;
+      for (; (x + 16) <= width; x += 16)
+      {
+        const uint8x16x3_t pixels = vld3q_u8(pSrc + (x * 3));
+        uint8x16x3_t swizzled;
+        swizzled.val[0] = pixels.val[srcIdx0];
+        swizzled.val[1] = pixels.val[srcIdx1];
+        swizzled.val[2] = pixels.val[srcIdx2];
+        vst3q_u8(pDst + (x * 3), swizzled);
+      }
+      Swizzle24Scalar(pDst + (x * 3), pSrc + (x * 3), width - x, srcIdx0, srcIdx1, srcIdx2);
+    }
+
+
+    void Swizzle32Neon(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                       const uint32_t srcIdx2, const uint32_t srcIdx3) noexcept
+    {
+      uint32_t x = 0;
+      for (; (x + 16) <= width; x += 16)
+      {
+        const uint8x16x4_t pixels = vld4q_u8(pSrc + (x * 4));
+        uint8x16x4_t swizzled;
+        swizzled.val[0] = pixels.val[srcIdx0];
+        swizzled.val[1] = pixels.val[srcIdx1];
+        swizzled.val[2] = pixels.val[srcIdx2];
+        swizzled.val[3] = pixels.val[srcIdx3];
+        vst4q_u8(pDst + (x * 4), swizzled);
+      }
+      Swizzle32Scalar(pDst + (x * 4), pSrc + (x * 4), width - x, srcIdx0, srcIdx1, srcIdx2, srcIdx3);
+    }
+
+
+    void Swizzle32To24Neon(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                           const uint32_t srcIdx2) noexcept
+    {
+      uint32_t x = 0;
+      for (; (x + 16) <= width; x += 16)
+      {
+        const uint8x16x4_t pixels = vld4q_u8(pSrc + (x * 4));
+        uint8x16x3_t swizzled;
+        swizzled.val[0] = pixels.val[srcIdx0];
+        swizzled.val[1] = pixels.val[srcIdx1];
+        swizzled.val[2] = pixels.val[srcIdx2];
+        vst3q_u8(pDst + (x * 3), swizzled);
+      }
+      Swizzle32To24Scalar(pDst + (x * 3), pSrc + (x * 4), width - x, srcIdx0, srcIdx1, srcIdx2);
+    }
+
+
+    void Swizzle24To32Neon(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t dstIdx0, const uint32_t dstIdx1,
+                           const uint32_t dstIdx2, const uint32_t dstIdx3, const uint8_t value3) noexcept
+    {
+      const uint32_t simdPixels = IsPermutation(dstIdx0, dstIdx1, dstIdx2, dstIdx3) ? (width & ~15u) : 0u;
+      // Back to front to allow in-place expansion, so we start with the tail
+      Swizzle24To32Scalar(pDst + (simdPixels * 4), pSrc + (simdPixels * 3), width - simdPixels, dstIdx0, dstIdx1, dstIdx2, dstIdx3, value3);
+      const uint8x16_t value = vdupq_n_u8(value3);
+      for (uint32_t x = simdPixels; x > 0;)
+      {
+        x -= 16;
+        const uint8x16x3_t pixels = vld3q_u8(pSrc + (x * 3));
+        uint8x16x4_t swizzled;
+        swizzled.val[dstIdx0] = pixels.val[0];
+        swizzled.val[dstIdx1] = pixels.val[1];
+        swizzled.val[dstIdx2] = pixels.val[2];
+        swizzled.val[dstIdx3] = value;
+        vst4q_u8(pDst + (x * 4), swizzled);
+      }
+    }
+
+
+    void Expand1ByteToNBytesNeon(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t dstBytesPerPixel) noexcept
+    {
+      uint32_t x = 0;
+      switch (dstBytesPerPixel)
+      {
+      case 2:
+        for (; (x + 16) <= width; x += 16)
+        {
+          const uint8x16_t pixels = vld1q_u8(pSrc + x);
+          vst2q_u8(pDst + (x * 2), uint8x16x2_t{{pixels, pixels}});
+        }
+        break;
+      case 3:
+        for (; (x + 16) <= width; x += 16)
+        {
+          const uint8x16_t pixels = vld1q_u8(pSrc + x);
+          vst3q_u8(pDst + (x * 3), uint8x16x3_t{{pixels, pixels, pixels}});
+        }
+        break;
+      case 4:
+        for (; (x + 16) <= width; x += 16)
+        {
+          const uint8x16_t pixels = vld1q_u8(pSrc + x);
+          vst4q_u8(pDst + (x * 4), uint8x16x4_t{{pixels, pixels, pixels, pixels}});
+        }
+        break;
+      default:
+        break;
+      }
+      Expand1ByteToNBytesScalar(pDst + (x * dstBytesPerPixel), pSrc + x, width - x, dstBytesPerPixel);
+    }
+
+    constexpr RawBitmapRowKernels NeonKernels{Swizzle24Neon, Swizzle32Neon, Swizzle32To24Neon, Swizzle24To32Neon, Expand1ByteToNBytesNeon};
+  }
+
+
+  const RawBitmapRowKernels* TryGetNeonKernels() noexcept
+  {
+    return &NeonKernels;
+  }
+#else
+  const RawBitmapRowKernels* TryGetNeonKernels() noexcept
+  {
+    // not implemented on this platform
+    return nullptr;
+  }
+#endif
+}
@@ -0,0 +1,338 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/CpuFeatures.hpp>
+#include "RawBitmapKernelsInternal.hpp"
+#if defined(FSL_CPU_X86)
+#include <immintrin.h>
+#include <array>
+#endif
+
+namespace Fsl::RawBitmapKernelsInternal
+{
+#if defined(FSL_CPU_X86)
+  namespace
+  {
+    using ByteMask = std::array<uint8_t, 16>;
+
+    //! Marks a byte in a shuffle mask that should be zero
+    constexpr uint8_t ShuffleZero = 0x80;
+
+    FSL_TARGET_SSE41 inline __m128i LoadMask(const ByteMask& mask) noexcept
+    {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask.data()));
+    }
+
+    //! Five 24bpp pixels, the last byte keeps its original value so the 16 byte store is harmless
+    ByteMask CreateSwizzle24Mask(const uint32_t srcIdx0, const uint32_t srcIdx1, const uint32_t srcIdx2) noexcept
+    {
+      ByteMask mask{};
+      for (uint32_t i = 0; i < 5; ++i)
+      {
+        mask[(i * 3) + 0] = static_cast<uint8_t>((i * 3) + srcIdx0);
+        mask[(i * 3) + 1] = static_cast<uint8_t>((i * 3) + srcIdx1);
+        mask[(i * 3) + 2] = static_cast<uint8_t>((i * 3) + srcIdx2);
+      }
+      mask[15] = 15;
+      return mask;
+    }
+
+    ByteMask CreateSwizzle32Mask(const uint32_t srcIdx0, const uint32_t srcIdx1, const uint32_t srcIdx2, const uint32_t srcIdx3) noexcept
+    {
+      ByteMask mask{};
+      for (uint32_t i = 0; i < 4; ++i)
+      {
+        mask[(i * 4) + 0] = static_cast<uint8_t>((i * 4) + srcIdx0);
+        mask[(i * 4) + 1] = static_cast<uint8_t>((i * 4) + srcIdx1);
+        mask[(i * 4) + 2] = static_cast<uint8_t>((i * 4) + srcIdx2);
+        mask[(i * 4) + 3] = static_cast<uint8_t>((i * 4) + srcIdx3);
+      }
+      return mask;
+    }
+
+    //! Four 32bpp pixels to four 24bpp pixels stored in the first 12 bytes
+    ByteMask CreateSwizzle32To24Mask(const uint32_t srcIdx0, const uint32_t srcIdx1, const uint32_t srcIdx2) noexcept
+    {
+      ByteMask mask{};
+      for (uint32_t i = 0; i < 4; ++i)
+      {
+        mask[(i * 3) + 0] = static_cast<uint8_t>((i * 4) + srcIdx0);
+        mask[(i * 3) + 1] = static_cast<uint8_t>((i * 4) + srcIdx1);
+        mask[(i * 3) + 2] = static_cast<uint8_t>((i * 4) + srcIdx2);
+      }
+      for (uint32_t i = 12; i < 16; ++i)
+      {
+        mask[i] = ShuffleZero;
+      }
+      return mask;
+    }
+
+    //! Four 24bpp pixels (the first 12 bytes) to four 32bpp pixels, the dstIdx3 channel is zeroed.
+    //! Requires that the dst indices is a permutation
+    ByteMask CreateSwizzle24To32Mask(const uint32_t dstIdx0, const uint32_t dstIdx1, const uint32_t dstIdx2, const uint32_t dstIdx3) noexcept
+    {
+      ByteMask mask{};
+      for (uint32_t i = 0; i < 4; ++i)
+      {
+        mask[(i * 4) + dstIdx0] = static_cast<uint8_t>((i * 3) + 0);
+        mask[(i * 4) + dstIdx1] = static_cast<uint8_t>((i * 3) + 1);
+        mask[(i * 4) + dstIdx2] = static_cast<uint8_t>((i * 3) + 2);
+        mask[(i * 4) + dstIdx3] = ShuffleZero;
+      }
+      return mask;
+    }
+
+    ByteMask CreateSwizzle24To32Value(const uint32_t dstIdx3, const uint8_t value3) noexcept
+    {
+      ByteMask mask{};
+      for (uint32_t i = 0; i < 4; ++i)
+      {
+        mask[(i * 4) + dstIdx3] = value3;
+      }
+      return mask;
+    }
+
+    //! Byte 'index' of the 'bytesPerPixel' expanded output of sixteen 8bpp pixels
+    ByteMask CreateExpandMask(const uint32_t index, const uint32_t bytesPerPixel) noexcept
+    {
+      ByteMask mask{};
+      for (uint32_t i = 0; i < 16; ++i)
+      {
+        mask[i] = static_cast<uint8_t>(((index * 16) + i) / bytesPerPixel);
+      }
+      return mask;
+    }
+
+    //! The number of pixels at the start of the row that the back to front Swizzle24To32 SIMD loop can handle.
+    //! The loop process groups of 'groupPixels' and reads 'loadBytes' for each group which must stay inside the row.
+    constexpr uint32_t CalcSwizzle24To32SimdPixels(const uint32_t width, const uint32_t groupPixels, const uint32_t loadBytes) noexcept
+    {
+      const uint32_t byteWidth = width * 3;
+      return byteWidth >= loadBytes ? (((byteWidth - loadBytes) / (groupPixels * 3)) + 1) * groupPixels : 0u;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------------------
+    // SSE4.1
+    // -----------------------------------------------------------------------------------------------------------------------------------------
+
+    FSL_TARGET_SSE41 void Swizzle24SSE41(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                                         const uint32_t srcIdx2) noexcept
+    {
+      const uint32_t byteWidth = width * 3;
+      uint32_t offset = 0;
+      if (byteWidth >= 16)
+      {
+        const __m128i mask = LoadMask(CreateSwizzle24Mask(srcIdx0, srcIdx1, srcIdx2));
+        for (; (offset + 16) <= byteWidth; offset += 15)
+        {
+          const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + offset));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + offset), _mm_shuffle_epi8(pixels, mask));
+        }
+      }
+      Swizzle24Scalar(pDst + offset, pSrc + offset, (byteWidth - offset) / 3, srcIdx0, srcIdx1, srcIdx2);
+    }
+
+
+    FSL_TARGET_SSE41 void Swizzle32SSE41(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                                         const uint32_t srcIdx2, const uint32_t srcIdx3) noexcept
+    {
+      const __m128i mask = LoadMask(CreateSwizzle32Mask(srcIdx0, srcIdx1, srcIdx2, srcIdx3));
+      const uint32_t byteWidth = width * 4;
+      uint32_t offset = 0;
+      for (; (offset + 16) <= byteWidth; offset += 16)
+      {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + offset));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + offset), _mm_shuffle_epi8(pixels, mask));
+      }
+      Swizzle32Scalar(pDst + offset, pSrc + offset, (byteWidth - offset) / 4, srcIdx0, srcIdx1, srcIdx2, srcIdx3);
+    }
+
+
+    FSL_TARGET_SSE41 void Swizzle32To24SSE41(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0,
+                                             const uint32_t srcIdx1, const uint32_t srcIdx2) noexcept
+    {
+      const __m128i mask = LoadMask(CreateSwizzle32To24Mask(srcIdx0, srcIdx1, srcIdx2));
+      // The store writes 16 bytes, but only 12 are valid so the stored bytes must stay inside the dst row
+      uint32_t x = 0;
+      for (; ((x * 3) + 16) <= (width * 3); x += 4)
+      {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + (x * 4)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + (x * 3)), _mm_shuffle_epi8(pixels, mask));
+      }
+      Swizzle32To24Scalar(pDst + (x * 3), pSrc + (x * 4), width - x, srcIdx0, srcIdx1, srcIdx2);
+    }
+
+
+    FSL_TARGET_SSE41 void Swizzle24To32SSE41(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t dstIdx0,
+                                             const uint32_t dstIdx1, const uint32_t dstIdx2, const uint32_t dstIdx3, const uint8_t value3) noexcept
+    {
+      const uint32_t simdPixels = IsPermutation(dstIdx0, dstIdx1, dstIdx2, dstIdx3) ? CalcSwizzle24To32SimdPixels(width, 4, 16) : 0u;
+      // Back to front to allow in-place expansion, so we start with the tail
+      Swizzle24To32Scalar(pDst + (simdPixels * 4), pSrc + (simdPixels * 3), width - simdPixels, dstIdx0, dstIdx1, dstIdx2, dstIdx3, value3);
+      if (simdPixels > 0)
+      {
+        const __m128i mask = LoadMask(CreateSwizzle24To32Mask(dstIdx0, dstIdx1, dstIdx2, dstIdx3));
+        const __m128i value = LoadMask(CreateSwizzle24To32Value(dstIdx3, value3));
+        for (uint32_t x = simdPixels; x > 0;)
+        {
+          x -= 4;
+          const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + (x * 3)));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + (x * 4)), _mm_or_si128(_mm_shuffle_epi8(pixels, mask), value));
+        }
+      }
+    }
+
+
+    FSL_TARGET_SSE41 void Expand1ByteToNBytesSSE41(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t dstBytesPerPixel) noexcept
+    {
+      uint32_t x = 0;
+      if (dstBytesPerPixel >= 2 && dstBytesPerPixel <= 4)
+      {
+        // Each group of 16 source pixels is expanded to dstBytesPerPixel stores of 16 bytes
+        __m128i masks[4];    // NOLINT(modernize-avoid-c-arrays)
+        for (uint32_t i = 0; i < dstBytesPerPixel; ++i)
+        {
+          masks[i] = LoadMask(CreateExpandMask(i, dstBytesPerPixel));
+        }
+        for (; (x + 16) <= width; x += 16)
+        {
+          const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + x));
+          uint8_t* pDstPixels = pDst + (x * dstBytesPerPixel);
+          for (uint32_t i = 0; i < dstBytesPerPixel; ++i)
+          {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDstPixels + (i * 16)), _mm_shuffle_epi8(pixels, masks[i]));
+          }
+        }
+      }
+      Expand1ByteToNBytesScalar(pDst + (x * dstBytesPerPixel), pSrc + x, width - x, dstBytesPerPixel);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------------------
+    // AVX2
+    // -----------------------------------------------------------------------------------------------------------------------------------------
+
+    FSL_TARGET_AVX2 inline __m256i LoadMask256(const ByteMask& mask) noexcept
+    {
+      return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(mask.data())));
+    }
+
+    FSL_TARGET_AVX2 inline __m256i LoadMask256(const ByteMask& maskLow, const ByteMask& maskHigh) noexcept
+    {
+      return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(maskLow.data()))),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(maskHigh.data())), 1);
+    }
+
+
+    FSL_TARGET_AVX2 void Swizzle32AVX2(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                                       const uint32_t srcIdx2, const uint32_t srcIdx3) noexcept
+    {
+      const __m256i mask = LoadMask256(CreateSwizzle32Mask(srcIdx0, srcIdx1, srcIdx2, srcIdx3));
+      const uint32_t byteWidth = width * 4;
+      uint32_t offset = 0;
+      for (; (offset + 32) <= byteWidth; offset += 32)
+      {
+        const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + offset));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + offset), _mm256_shuffle_epi8(pixels, mask));
+      }
+      Swizzle32Scalar(pDst + offset, pSrc + offset, (byteWidth - offset) / 4, srcIdx0, srcIdx1, srcIdx2, srcIdx3);
+    }
+
+
+    FSL_TARGET_AVX2 void Swizzle32To24AVX2(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t srcIdx0, const uint32_t srcIdx1,
+                                           const uint32_t srcIdx2) noexcept
+    {
+      const __m256i mask = LoadMask256(CreateSwizzle32To24Mask(srcIdx0, srcIdx1, srcIdx2));
+      // Each lane holds 12 valid bytes, move them next to each other
+      const __m256i compact = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+      // The store writes 32 bytes, but only 24 are valid so the stored bytes must stay inside the dst row
+      uint32_t x = 0;
+      for (; ((x * 3) + 32) <= (width * 3); x += 8)
+      {
+        const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + (x * 4)));
+        const __m256i swizzled = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(pixels, mask), compact);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + (x * 3)), swizzled);
+      }
+      Swizzle32To24SSE41(pDst + (x * 3), pSrc + (x * 4), width - x, srcIdx0, srcIdx1, srcIdx2);
+    }
+
+
+    FSL_TARGET_AVX2 void Expand1ByteToNBytesAVX2(uint8_t* pDst, const uint8_t* pSrc, const uint32_t width, const uint32_t dstBytesPerPixel) noexcept
+    {
+      if (dstBytesPerPixel != 4)
+      {
+        Expand1ByteToNBytesSSE41(pDst, pSrc, width, dstBytesPerPixel);
+        return;
+      }
+      const __m256i mask0 = LoadMask256(CreateExpandMask(0, 4), CreateExpandMask(1, 4));
+      const __m256i mask1 = LoadMask256(CreateExpandMask(2, 4), CreateExpandMask(3, 4));
+      uint32_t x = 0;
+      for (; (x + 16) <= width; x += 16)
+      {
+        const __m256i pixels = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + x)));
+        uint8_t* pDstPixels = pDst + (x * 4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDstPixels), _mm256_shuffle_epi8(pixels, mask0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDstPixels + 32), _mm256_shuffle_epi8(pixels, mask1));
+      }
+      Expand1ByteToNBytesScalar(pDst + (x * 4), pSrc + x, width - x, 4);
+    }
+
+    // The AVX2 set reuses the SSE4.1 kernels where the wider registers bring no benefit. 24bpp data does not fit the 128bit lanes and
+    // a 256bit Swizzle24To32 built from two overlapping loads benchmarked slower than the SSE4.1 version.
+    constexpr RawBitmapRowKernels SSE41Kernels{Swizzle24SSE41, Swizzle32SSE41, Swizzle32To24SSE41, Swizzle24To32SSE41, Expand1ByteToNBytesSSE41};
+    constexpr RawBitmapRowKernels AVX2Kernels{Swizzle24SSE41, Swizzle32AVX2, Swizzle32To24AVX2, Swizzle24To32SSE41, Expand1ByteToNBytesAVX2};
+  }
+
+
+  const RawBitmapRowKernels* TryGetSSE41Kernels() noexcept
+  {
+    return &SSE41Kernels;
+  }
+
+
+  const RawBitmapRowKernels* TryGetAVX2Kernels() noexcept
+  {
+    return &AVX2Kernels;
+  }
+#else
+  const RawBitmapRowKernels* TryGetSSE41Kernels() noexcept
+  {
+    // not implemented on this platform
+    return nullptr;
+  }
+
+
+  const RawBitmapRowKernels* TryGetAVX2Kernels() noexcept
+  {
+    // not implemented on this platform
+    return nullptr;
+  }
+#endif
+}
@@ -31,6 +31,7 @@
 
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslGraphics/Bitmap/RawBitmapEx.hpp>
+#include <FslGraphics/Bitmap/RawBitmapKernels.hpp>
 #include <FslGraphics/Bitmap/RawBitmapUtil.hpp>
 #include <FslGraphics/Exceptions.hpp>
 #include <FslGraphics/PixelFormatUtil.hpp>
@@ -409,22 +410,13 @@ namespace Fsl
       throw UsageErrorException("Swizzle24From012To210 does not support overlapping buffers");
     }
 
-    // Generic slow swizzle for 24bpp formats
-    const uint32_t srcWidthM3 = srcBitmap.RawUnsignedWidth() * 3;
+    const RawBitmapRowKernels& kernels = RawBitmapKernels::GetKernels();
+    const uint32_t srcWidth = srcBitmap.RawUnsignedWidth();
     const uint32_t srcHeight = srcBitmap.RawUnsignedHeight();
 
     for (uint32_t y = 0; y < srcHeight; ++y)
     {
-      for (uint32_t x = 0; x < srcWidthM3; x += 3)
-      {
-        const auto c0 = pSrc[x + 2];
-        const auto c1 = pSrc[x + 1];
-        const auto c2 = pSrc[x + 0];
-
-        pDst[x + 0] = c0;
-        pDst[x + 1] = c1;
-        pDst[x + 2] = c2;
-      }
+      kernels.Swizzle24(pDst, pSrc, srcWidth, 2, 1, 0);
       pSrc += srcStride;
       pDst += dstStride;
     }
@@ -470,22 +462,13 @@ namespace Fsl
       throw UsageErrorException("Swizzle24 does not support overlapping buffers");
     }
 
-    // Generic slow swizzle for 24bpp formats
-
+    const RawBitmapRowKernels& kernels = RawBitmapKernels::GetKernels();
     const uint32_t srcWidth = srcBitmap.RawUnsignedWidth();
     const uint32_t srcHeight = srcBitmap.RawUnsignedHeight();
 
     for (uint32_t y = 0; y < srcHeight; ++y)
     {
-      for (uint32_t x = 0; x < srcWidth; ++x)
-      {
-        const auto c0 = pSrc[(x * 3) + srcIdx0];
-        const auto c1 = pSrc[(x * 3) + srcIdx1];
-        const auto c2 = pSrc[(x * 3) + srcIdx2];
-        pDst[(x * 3) + 0] = c0;
-        pDst[(x * 3) + 1] = c1;
-        pDst[(x * 3) + 2] = c2;
-      }
+      kernels.Swizzle24(pDst, pSrc, srcWidth, srcIdx0, srcIdx1, srcIdx2);
       pSrc += srcStride;
       pDst += dstStride;
     }
@@ -531,23 +514,13 @@ namespace Fsl
       throw UsageErrorException("Swizzle32 does not support overlapping buffers");
     }
 
-    // Generic slow swizzle for 32bpp formats
+    const RawBitmapRowKernels& kernels = RawBitmapKernels::GetKernels();
     const uint32_t srcWidth = srcBitmap.RawUnsignedWidth();
     const uint32_t srcHeight = srcBitmap.RawUnsignedHeight();
 
     for (uint32_t y = 0; y < srcHeight; ++y)
     {
-      for (uint32_t x = 0; x < srcWidth; ++x)
-      {
-        const uint8_t b0 = pSrc[(x * 4) + srcIdx0];
-        const uint8_t b1 = pSrc[(x * 4) + srcIdx1];
-        const uint8_t b2 = pSrc[(x * 4) + srcIdx2];
-        const uint8_t b3 = pSrc[(x * 4) + srcIdx3];
-        pDst[(x * 4) + 0] = b0;
-        pDst[(x * 4) + 1] = b1;
-        pDst[(x * 4) + 2] = b2;
-        pDst[(x * 4) + 3] = b3;
-      }
+      kernels.Swizzle32(pDst, pSrc, srcWidth, srcIdx0, srcIdx1, srcIdx2, srcIdx3);
       pSrc += srcStride;
       pDst += dstStride;
     }
@@ -593,19 +566,11 @@ namespace Fsl
       throw UsageErrorException("Swizzle32 does not support overlapping buffers");
     }
 
-    // Generic slow swizzle for 32bpp to 24bpp formats
+    const RawBitmapRowKernels& kernels = RawBitmapKernels::GetKernels();
     const uint32_t width = srcBitmap.RawUnsignedWidth();
     while (pDst < pDstEnd)
     {
-      for (uint32_t x = 0; x < width; ++x)
-      {
-        const uint8_t b0 = pSrc[(x * 4) + srcIdx0];
-        const uint8_t b1 = pSrc[(x * 4) + srcIdx1];
-        const uint8_t b2 = pSrc[(x * 4) + srcIdx2];
-        pDst[(x * 3) + 0] = b0;
-        pDst[(x * 3) + 1] = b1;
-        pDst[(x * 3) + 2] = b2;
-      }
+      kernels.Swizzle32To24(pDst, pSrc, width, srcIdx0, srcIdx1, srcIdx2);
       pSrc += srcStride;
       pDst += dstStride;
     }
@@ -651,20 +616,12 @@ namespace Fsl
       throw UsageErrorException("Swizzle32 does not support overlapping buffers");
     }
 
-    // Generic slow swizzle for 24bpp to 32bpp formats
-    const int32_t width = srcBitmap.RawWidth() - 1;
+    // The kernel process the row back to front
+    const RawBitmapRowKernels& kernels = RawBitmapKernels::GetKernels();
+    const uint32_t width = srcBitmap.RawUnsignedWidth();
     while (pDst < pDstEnd)
     {
-      for (int32_t x = width; x >= 0; --x)
-      {
-        const uint8_t b0 = pSrc[(x * 3) + 0];
-        const uint8_t b1 = pSrc[(x * 3) + 1];
-        const uint8_t b2 = pSrc[(x * 3) + 2];
-        pDst[(x * 4) + dstIdx0] = b0;
-        pDst[(x * 4) + dstIdx1] = b1;
-        pDst[(x * 4) + dstIdx2] = b2;
-        pDst[(x * 4) + dstIdx3] = value3;
-      }
+      kernels.Swizzle24To32(pDst, pSrc, width, dstIdx0, dstIdx1, dstIdx2, dstIdx3, value3);
       pSrc += srcStride;
       pDst += dstStride;
     }
@@ -817,19 +774,13 @@ namespace Fsl
       throw UsageErrorException("Swizzle32 does not support overlapping buffers");
     }
 
+    const RawBitmapRowKernels& kernels = RawBitmapKernels::GetKernels();
     const uint32_t srcWidth = srcBitmap.RawUnsignedWidth();
     const uint32_t srcHeight = srcBitmap.RawUnsignedHeight();
 
     for (uint32_t y = 0; y < srcHeight; ++y)
     {
-      for (uint32_t x = 0; x < srcWidth; ++x)
-      {
-        const uint8_t b0 = pSrc[x];
-        for (uint32_t i = 0; i < dstBytesPerPixel; ++i)
-        {
-          pDst[(x * dstBytesPerPixel) + i] = b0;
-        }
-      }
+      kernels.Expand1ByteToNBytes(pDst, pSrc, srcWidth, UncheckedNumericCast<uint32_t>(dstBytesPerPixel));
       pSrc += srcStride;
       pDst += dstStride;
     }
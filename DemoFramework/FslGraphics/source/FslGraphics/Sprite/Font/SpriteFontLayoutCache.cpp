@@ -0,0 +1,303 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/NumericCast.hpp>
+#include <FslBase/String/StringViewLiteUtil.hpp>
+#include <FslGraphics/Sprite/Font/SpriteFontLayoutCache.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+
+namespace Fsl
+{
+  namespace
+  {
+    std::size_t CalcHash(const StringViewLite& strView, const BitmapFontConfig& fontConfig) noexcept
+    {
+      uint32_t scaleBits = 0;
+      static_assert(sizeof(scaleBits) == sizeof(fontConfig.Scale));
+      std::memcpy(&scaleBits, &fontConfig.Scale, sizeof(scaleBits));
+      const std::size_t configHash = (static_cast<std::size_t>(scaleBits) << 1) | (fontConfig.Kerning ? 1u : 0u);
+
+      std::size_t hash = std::hash<std::string_view>()(strView.AsStringView());
+      hash ^= configHash + 0x9e3779b9u + (hash << 6) + (hash >> 2);
+      return hash;
+    }
+  }
+
+
+  SpriteFontLayoutCache::SpriteFontLayoutCache(const uint32_t capacity)
+    : m_capacity(capacity)
+  {
+  }
+
+
+  uint32_t SpriteFontLayoutCache::GetCapacity() const noexcept
+  {
+    std::lock_guard<std::mutex> lock(m_lock);
+    return m_capacity;
+  }
+
+
+  void SpriteFontLayoutCache::SetCapacity(const uint32_t capacity)
+  {
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_records.clear();
+    m_records.shrink_to_fit();
+    m_lookup.clear();
+    m_mostRecentIndex = InvalidIndex;
+    m_leastRecentIndex = InvalidIndex;
+    m_stats.EntryCount = 0;
+    m_capacity = capacity;
+  }
+
+
+  void SpriteFontLayoutCache::Clear() noexcept
+  {
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_records.clear();
+    m_lookup.clear();
+    m_mostRecentIndex = InvalidIndex;
+    m_leastRecentIndex = InvalidIndex;
+    m_stats.EntryCount = 0;
+  }
+
+
+  SpriteFontLayoutCacheStats SpriteFontLayoutCache::GetStats() const noexcept
+  {
+    std::lock_guard<std::mutex> lock(m_lock);
+    return m_stats;
+  }
+
+
+  std::optional<PxSize2D> SpriteFontLayoutCache::TryGetMeasuredSize(const StringViewLite& strView, const BitmapFontConfig& fontConfig)
+  {
+    if (!IsCacheable(strView))
+    {
+      return {};
+    }
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (m_capacity <= 0u)
+    {
+      return {};
+    }
+    const Record* const pRecord = TryGet(strView, fontConfig);
+    if (pRecord == nullptr || !pRecord->MeasuredSizePx.has_value())
+    {
+      ++m_stats.Misses;
+      return {};
+    }
+    ++m_stats.Hits;
+    return pRecord->MeasuredSizePx;
+  }
+
+
+  void SpriteFontLayoutCache::SetMeasuredSize(const StringViewLite& strView, const BitmapFontConfig& fontConfig, const PxSize2D sizePx)
+  {
+    if (!IsCacheable(strView))
+    {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (m_capacity > 0u)
+    {
+      GetOrCreate(strView, fontConfig).MeasuredSizePx = sizePx;
+    }
+  }
+
+
+  std::optional<bool> SpriteFontLayoutCache::TryCopyRenderRules(Span<SpriteFontGlyphPosition> dst, const StringViewLite& strView,
+                                                                const BitmapFontConfig& fontConfig)
+  {
+    if (!IsCacheable(strView))
+    {
+      return {};
+    }
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (m_capacity <= 0u)
+    {
+      return {};
+    }
+    const Record* const pRecord = TryGet(strView, fontConfig);
+    if (pRecord == nullptr || !pRecord->RenderRulesResult.has_value())
+    {
+      ++m_stats.Misses;
+      return {};
+    }
+    if (pRecord->RenderRulesResult.value())
+    {
+      if (dst.size() < pRecord->Glyphs.size())
+      {
+        throw std::invalid_argument("dst is too small");
+      }
+      std::copy(pRecord->Glyphs.begin(), pRecord->Glyphs.end(), dst.data());
+    }
+    ++m_stats.Hits;
+    return pRecord->RenderRulesResult;
+  }
+
+
+  void SpriteFontLayoutCache::SetRenderRules(const StringViewLite& strView, const BitmapFontConfig& fontConfig, const bool result,
+                                             const ReadOnlySpan<SpriteFontGlyphPosition> glyphs)
+  {
+    if (!IsCacheable(strView))
+    {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (m_capacity > 0u)
+    {
+      Record& rRecord = GetOrCreate(strView, fontConfig);
+      rRecord.RenderRulesResult = result;
+      if (result)
+      {
+        rRecord.Glyphs.assign(glyphs.begin(), glyphs.end());
+      }
+      else
+      {
+        rRecord.Glyphs.clear();
+      }
+    }
+  }
+
+
+  SpriteFontLayoutCache::Record* SpriteFontLayoutCache::TryGet(const StringViewLite& strView, const BitmapFontConfig& fontConfig)
+  {
+    const auto itrFind = m_lookup.find(CalcHash(strView, fontConfig));
+    if (itrFind == m_lookup.end())
+    {
+      return nullptr;
+    }
+    Record& rRecord = m_records[itrFind->second];
+    // The hash is not unique so verify the key
+    if (rRecord.FontConfig != fontConfig || rRecord.Text != strView)
+    {
+      return nullptr;
+    }
+    MarkAsMostRecent(itrFind->second);
+    return &rRecord;
+  }
+
+
+  SpriteFontLayoutCache::Record& SpriteFontLayoutCache::GetOrCreate(const StringViewLite& strView, const BitmapFontConfig& fontConfig)
+  {
+    assert(m_capacity > 0u);
+    const std::size_t hash = CalcHash(strView, fontConfig);
+    uint32_t index = InvalidIndex;
+    const auto itrFind = m_lookup.find(hash);
+    if (itrFind != m_lookup.end())
+    {
+      index = itrFind->second;
+      Record& rRecord = m_records[index];
+      if (rRecord.FontConfig == fontConfig && rRecord.Text == strView)
+      {
+        MarkAsMostRecent(index);
+        return rRecord;
+      }
+      // Hash collision, the new key replaces the old one
+    }
+    else if (m_records.size() < m_capacity)
+    {
+      index = UncheckedNumericCast<uint32_t>(m_records.size());
+      m_records.emplace_back();
+      m_lookup.emplace(hash, index);
+      ++m_stats.EntryCount;
+    }
+    else
+    {
+      // Reuse the least recently used record
+      index = m_leastRecentIndex;
+      assert(index != InvalidIndex);
+      m_lookup.erase(m_records[index].Hash);
+      m_lookup.emplace(hash, index);
+      ++m_stats.Evictions;
+    }
+
+    Record& rRecord = m_records[index];
+    rRecord.Hash = hash;
+    rRecord.FontConfig = fontConfig;
+    rRecord.Text.assign(strView.data(), strView.size());
+    rRecord.MeasuredSizePx.reset();
+    rRecord.RenderRulesResult.reset();
+    rRecord.Glyphs.clear();
+    MarkAsMostRecent(index);
+    return rRecord;
+  }
+
+
+  void SpriteFontLayoutCache::MarkAsMostRecent(const uint32_t index) noexcept
+  {
+    if (index == m_mostRecentIndex)
+    {
+      return;
+    }
+    Unlink(index);
+    Record& rRecord = m_records[index];
+    rRecord.PrevIndex = InvalidIndex;
+    rRecord.NextIndex = m_mostRecentIndex;
+    if (m_mostRecentIndex != InvalidIndex)
+    {
+      m_records[m_mostRecentIndex].PrevIndex = index;
+    }
+    m_mostRecentIndex = index;
+    if (m_leastRecentIndex == InvalidIndex)
+    {
+      m_leastRecentIndex = index;
+    }
+  }
+
+
+  void SpriteFontLayoutCache::Unlink(const uint32_t index) noexcept
+  {
+    Record& rRecord = m_records[index];
+    if (rRecord.PrevIndex != InvalidIndex)
+    {
+      m_records[rRecord.PrevIndex].NextIndex = rRecord.NextIndex;
+    }
+    else if (m_mostRecentIndex == index)
+    {
+      m_mostRecentIndex = rRecord.NextIndex;
+    }
+    if (rRecord.NextIndex != InvalidIndex)
+    {
+      m_records[rRecord.NextIndex].PrevIndex = rRecord.PrevIndex;
+    }
+    else if (m_leastRecentIndex == index)
+    {
+      m_leastRecentIndex = rRecord.PrevIndex;
+    }
+    rRecord.PrevIndex = InvalidIndex;
+    rRecord.NextIndex = InvalidIndex;
+  }
+}
@@ -39,6 +39,8 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <memory>
+#include <optional>
 #include <string>
 
 namespace Fsl
@@ -91,7 +93,7 @@ namespace Fsl
             const uint32_t char1 = m_pStr[0];
             const uint32_t char2 = m_pStr[1];
             m_pStr += 2;
-            result = ((char0 & 0x1F) << 12) | ((char1 & 0x3f) << 6) | (char2 & 0x3f);
+            result = ((char0 & 0x0F) << 12) | ((char1 & 0x3f) << 6) | (char2 & 0x3f);
             FSLLOG3_DEBUG_WARNING_IF((char1 & 0xC0) != 0x80 || (char2 & 0xC0) != 0x80, "invalid UTF8 encoding encountered");
           }
           else if ((m_pStr + 2) < m_pStrEnd && (char0 & 0xF8) == 0xF0 && char0 <= 0xF4)
@@ -100,7 +102,7 @@ namespace Fsl
             const uint32_t char2 = m_pStr[1];
             const uint32_t char3 = m_pStr[2];
             m_pStr += 3;
-            result = ((char0 & 0x1F) << 18) | ((char1 & 0x3f) << 12) | ((char2 & 0x3f) << 6) | (char3 & 0x3f);
+            result = ((char0 & 0x07) << 18) | ((char1 & 0x3f) << 12) | ((char2 & 0x3f) << 6) | (char3 & 0x3f);
             FSLLOG3_DEBUG_WARNING_IF((char1 & 0xC0) != 0x80 || (char2 & 0xC0) != 0x80 || (char3 & 0xC0) != 0x80, "invalid UTF8 encoding encountered");
           }
           else
@@ -648,6 +650,10 @@ namespace Fsl
     m_lookup = SpriteFontFastLookup(spriteNativeAreaCalc, textureExtentPx, bitmapFont, densityDpi);
     m_charPaddingPx = bitmapFont.GetPaddingPx();
     m_fontType = bitmapFont.GetFontType();
+    if (!m_layoutCache)
+    {
+      m_layoutCache = std::make_unique<SpriteFontLayoutCache>();
+    }
   }
 
   void TextureAtlasSpriteFont::Reset(const SpriteNativeAreaCalc& spriteNativeAreaCalc, const PxExtent2D textureExtentPx,
@@ -657,6 +663,19 @@ namespace Fsl
   }
 
 
+  void TextureAtlasSpriteFont::SetLayoutCacheCapacity(const uint32_t capacity)
+  {
+    if (!m_layoutCache)
+    {
+      m_layoutCache = std::make_unique<SpriteFontLayoutCache>(capacity);
+    }
+    else
+    {
+      m_layoutCache->SetCapacity(capacity);
+    }
+  }
+
+
   PxValueU16 TextureAtlasSpriteFont::BaseLinePx(const BitmapFontConfig& fontConfig) const
   {
     return ScaledBaseLinePx(m_lookup.GetBaseLinePx(), fontConfig.Scale);
@@ -672,11 +691,53 @@ namespace Fsl
 
   PxSize2D TextureAtlasSpriteFont::MeasureString(const StringViewLite& strView) const
   {
-    return m_lookup.HasKerning() ? DoMeasureStringWithKerning(m_lookup, m_unknownChar, strView) : DoMeasureString(m_lookup, m_unknownChar, strView);
+    return MeasureString(strView, BitmapFontConfig(1.0f, m_lookup.HasKerning()));
   }
 
 
   PxSize2D TextureAtlasSpriteFont::MeasureString(const StringViewLite& strView, const BitmapFontConfig& fontConfig) const
+  {
+    if (!m_layoutCache || !SpriteFontLayoutCache::IsCacheable(strView))
+    {
+      return MeasureStringUncached(strView, fontConfig);
+    }
+    const BitmapFontConfig cacheFontConfig = ToCacheFontConfig(fontConfig);
+    const std::optional<PxSize2D> cachedSizePx = m_layoutCache->TryGetMeasuredSize(strView, cacheFontConfig);
+    if (cachedSizePx.has_value())
+    {
+      return cachedSizePx.value();
+    }
+    const PxSize2D result = MeasureStringUncached(strView, fontConfig);
+    m_layoutCache->SetMeasuredSize(strView, cacheFontConfig, result);
+    return result;
+  }
+
+  bool TextureAtlasSpriteFont::ExtractRenderRules(Span<SpriteFontGlyphPosition> dst, const StringViewLite& strView) const
+  {
+    return ExtractRenderRules(dst, strView, BitmapFontConfig(1.0f, m_lookup.HasKerning()));
+  }
+
+  bool TextureAtlasSpriteFont::ExtractRenderRules(Span<SpriteFontGlyphPosition> dst, const StringViewLite& strView,
+                                                  const BitmapFontConfig& fontConfig) const
+  {
+    if (!m_layoutCache || !SpriteFontLayoutCache::IsCacheable(strView))
+    {
+      return ExtractRenderRulesUncached(dst, strView, fontConfig);
+    }
+    const BitmapFontConfig cacheFontConfig = ToCacheFontConfig(fontConfig);
+    const std::optional<bool> cachedResult = m_layoutCache->TryCopyRenderRules(dst, strView, cacheFontConfig);
+    if (cachedResult.has_value())
+    {
+      return cachedResult.value();
+    }
+    const bool result = ExtractRenderRulesUncached(dst, strView, fontConfig);
+    const ReadOnlySpan<SpriteFontGlyphPosition> glyphs = result ? dst.AsReadOnlySpan(0, strView.size()) : ReadOnlySpan<SpriteFontGlyphPosition>();
+    m_layoutCache->SetRenderRules(strView, cacheFontConfig, result, glyphs);
+    return result;
+  }
+
+
+  PxSize2D TextureAtlasSpriteFont::MeasureStringUncached(const StringViewLite& strView, const BitmapFontConfig& fontConfig) const
   {
     PxSize2D result;
     if (fontConfig.Kerning && m_lookup.HasKerning())
@@ -699,13 +760,8 @@ namespace Fsl
     return result;
   }
 
-  bool TextureAtlasSpriteFont::ExtractRenderRules(Span<SpriteFontGlyphPosition> dst, const StringViewLite& strView) const
-  {
-    return ExtractRenderRules(dst, strView, BitmapFontConfig(1.0f, m_lookup.HasKerning()));
-  }
-
-  bool TextureAtlasSpriteFont::ExtractRenderRules(Span<SpriteFontGlyphPosition> dst, const StringViewLite& strView,
-                                                  const BitmapFontConfig& fontConfig) const
+  bool TextureAtlasSpriteFont::ExtractRenderRulesUncached(Span<SpriteFontGlyphPosition> dst, const StringViewLite& strView,
+                                                          const BitmapFontConfig& fontConfig) const
   {
     bool result = false;
     if (fontConfig.Kerning && m_lookup.HasKerning())
@@ -0,0 +1,449 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Math/MathHelper_Clamp.hpp>
+#include <FslBase/UncheckedNumericCast.hpp>
+#include <FslGraphics/Bitmap/RawBitmapEx.hpp>
+#include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
+#include <FslGraphics/ColorSpaceConversion.hpp>
+#include <FslGraphics/Exceptions.hpp>
+#include <FslGraphics/PixelFormatUtil.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include "MipMapLevelDownscaler.hpp"
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr double Pi = 3.14159265358979323846;
+      constexpr double LanczosRadius = 3.0;
+      constexpr double KaiserRadius = 3.0;
+      constexpr double KaiserAlpha = 4.0;
+    }
+
+    double Sinc(const double x) noexcept
+    {
+      if (std::abs(x) < 1e-9)
+      {
+        return 1.0;
+      }
+      const double value = LocalConfig::Pi * x;
+      return std::sin(value) / value;
+    }
+
+    //! Zero order modified Bessel function of the first kind
+    double BesselI0(const double x) noexcept
+    {
+      double sum = 1.0;
+      double term = 1.0;
+      const double halfX = x * 0.5;
+      for (int32_t k = 1; k < 64 && term > (sum * 1e-12); ++k)
+      {
+        const double value = halfX / k;
+        term *= value * value;
+        sum += term;
+      }
+      return sum;
+    }
+
+    double FilterRadius(const TextureMipMapFilter filter)
+    {
+      switch (filter)
+      {
+      case TextureMipMapFilter::Box:
+      case TextureMipMapFilter::GammaCorrectBox:
+        return 0.5;
+      case TextureMipMapFilter::Lanczos3:
+        return LocalConfig::LanczosRadius;
+      case TextureMipMapFilter::Kaiser:
+        return LocalConfig::KaiserRadius;
+      default:
+        throw NotSupportedException("Unsupported filter");
+      }
+    }
+
+    //! Evaluate the filter at the distance x (measured in dst pixels)
+    double EvaluateFilter(const TextureMipMapFilter filter, const double x) noexcept
+    {
+      switch (filter)
+      {
+      case TextureMipMapFilter::Lanczos3:
+        return std::abs(x) < LocalConfig::LanczosRadius ? Sinc(x) * Sinc(x / LocalConfig::LanczosRadius) : 0.0;
+      case TextureMipMapFilter::Kaiser:
+        {
+          const double t = x / LocalConfig::KaiserRadius;
+          if (std::abs(t) >= 1.0)
+          {
+            return 0.0;
+          }
+          const double window = BesselI0(LocalConfig::KaiserAlpha * std::sqrt(1.0 - (t * t))) / BesselI0(LocalConfig::KaiserAlpha);
+          return Sinc(x) * window;
+        }
+      default:
+        return std::abs(x) <= 0.5 ? 1.0 : 0.0;
+      }
+    }
+
+    // Software fp16 conversion (round to nearest even), FslGraphics has no dependency on a half float library
+
+    float HalfToFloat(const uint16_t value) noexcept
+    {
+      const uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+      const uint32_t exponent = (value >> 10) & 0x1Fu;
+      uint32_t mantissa = value & 0x3FFu;
+      uint32_t bits = sign;
+      if (exponent == 0x1Fu)
+      {
+        bits |= 0x7F800000u | (mantissa << 13);
+      }
+      else if (exponent != 0u)
+      {
+        bits |= ((exponent + 112u) << 23) | (mantissa << 13);
+      }
+      else if (mantissa != 0u)
+      {
+        // Subnormal, normalize it
+        uint32_t normalizedExponent = 113u;
+        while ((mantissa & 0x400u) == 0u)
+        {
+          mantissa <<= 1;
+          --normalizedExponent;
+        }
+        bits |= (normalizedExponent << 23) | ((mantissa & 0x3FFu) << 13);
+      }
+      float result = 0.0f;
+      std::memcpy(&result, &bits, sizeof(result));
+      return result;
+    }
+
+    uint16_t FloatToHalf(const float value) noexcept
+    {
+      uint32_t bits = 0;
+      std::memcpy(&bits, &value, sizeof(bits));
+      const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+      const uint32_t absBits = bits & 0x7FFFFFFFu;
+      if (absBits >= 0x7F800000u)
+      {
+        // Inf or NaN (keep NaN a quiet NaN)
+        return static_cast<uint16_t>(sign | 0x7C00u | (absBits > 0x7F800000u ? 0x200u : 0u));
+      }
+      if (absBits >= 0x477FF000u)
+      {
+        // Rounds to a value larger than the max fp16 value
+        return static_cast<uint16_t>(sign | 0x7C00u);
+      }
+      const uint32_t exponent = absBits >> 23;
+      uint32_t mantissa = (absBits & 0x7FFFFFu) | 0x800000u;
+      uint32_t shift = 13;
+      uint32_t base = 0;
+      if (exponent >= 113u)
+      {
+        base = (exponent - 112u) << 10;
+        mantissa &= 0x7FFFFFu;
+      }
+      else
+      {
+        shift = 126u - exponent;
+        if (shift > 24u)
+        {
+          return sign;
+        }
+      }
+      const uint32_t truncated = mantissa >> shift;
+      const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+      const uint32_t halfway = 1u << (shift - 1u);
+      uint32_t result = base + truncated;
+      if (remainder > halfway || (remainder == halfway && (truncated & 1u) != 0u))
+      {
+        ++result;
+      }
+      return static_cast<uint16_t>(sign | result);
+    }
+
+    float ClampUNorm(const float value) noexcept
+    {
+      return MathHelper::Clamp(value, 0.0f, 1.0f);
+    }
+
+    int32_t ClampIndex(const int32_t index, const int32_t maxIndex) noexcept
+    {
+      return std::clamp(index, 0, maxIndex);
+    }
+  }
+
+
+  bool MipMapLevelDownscaler::IsSupported(const PixelFormat pixelFormat) noexcept
+  {
+    if (PixelFormatUtil::IsCompressed(pixelFormat) || PixelFormatUtil::IsPacked(pixelFormat))
+    {
+      return false;
+    }
+    const auto numericFormat = PixelFormatUtil::GetNumericFormat(pixelFormat);
+    switch (PixelFormatUtil::GetPixelFormatLayout(pixelFormat))
+    {
+    case PixelFormatLayout::R8:
+    case PixelFormatLayout::R8G8:
+    case PixelFormatLayout::R8G8B8:
+    case PixelFormatLayout::B8G8R8:
+    case PixelFormatLayout::R8G8B8A8:
+    case PixelFormatLayout::B8G8R8A8:
+      return numericFormat == PixelFormatFlags::NF_UNorm || numericFormat == PixelFormatFlags::NF_Srgb;
+    case PixelFormatLayout::R16:
+    case PixelFormatLayout::R16G16:
+    case PixelFormatLayout::R16G16B16:
+    case PixelFormatLayout::R16G16B16A16:
+      return numericFormat == PixelFormatFlags::NF_UNorm || numericFormat == PixelFormatFlags::NF_SFloat;
+    case PixelFormatLayout::R32:
+    case PixelFormatLayout::R32G32:
+    case PixelFormatLayout::R32G32B32:
+    case PixelFormatLayout::R32G32B32A32:
+      return numericFormat == PixelFormatFlags::NF_SFloat;
+    default:
+      return false;
+    }
+  }
+
+
+  MipMapLevelDownscaler::MipMapLevelDownscaler(const TextureMipMapFilter filter, const PixelFormat pixelFormat)
+  {
+    if (!IsSupported(pixelFormat))
+    {
+      throw UnsupportedPixelFormatException("MipMapLevelDownscaler", pixelFormat);
+    }
+    m_channelCount = PixelFormatUtil::GetChannelCount(pixelFormat);
+    const auto numericFormat = PixelFormatUtil::GetNumericFormat(pixelFormat);
+    const uint32_t bytesPerChannel = PixelFormatUtil::GetBytesPerPixel(pixelFormat) / m_channelCount;
+    switch (bytesPerChannel)
+    {
+    case 1:
+      m_channelType = ChannelType::UNorm8;
+      break;
+    case 2:
+      m_channelType = numericFormat == PixelFormatFlags::NF_SFloat ? ChannelType::Float16 : ChannelType::UNorm16;
+      break;
+    default:
+      m_channelType = ChannelType::Float32;
+      break;
+    }
+
+    // The box filter keeps the SRGB encoding to match RawBitmapUtil::DownscaleBoxFilter, all other filters work in linear space
+    if (numericFormat == PixelFormatFlags::NF_Srgb && filter != TextureMipMapFilter::Box && filter != TextureMipMapFilter::Nearest)
+    {
+      // The alpha channel is never SRGB encoded
+      m_srgbChannelCount = std::min(m_channelCount, 3u);
+      for (uint32_t i = 0; i < m_srgbToLinear.size(); ++i)
+      {
+        m_srgbToLinear[i] = ColorSpaceConversion::ConvertSRGBToLinearFloat(static_cast<uint8_t>(i));
+      }
+    }
+
+    if (filter == TextureMipMapFilter::Nearest)
+    {
+      m_weights.push_back(1.0f);
+      return;
+    }
+
+    // The dst pixel x is centered at src position 2x+1 and src pixel i is centered at i+0.5, so tap k (i = 2x+k) is at distance (k-0.5)/2
+    // measured in dst pixels. A filter with radius r therefore touches the src taps where |k-0.5| < 2r.
+    const double radius = FilterRadius(filter);
+    const auto firstTap = static_cast<int32_t>(std::floor(0.5 - (2.0 * radius))) + 1;
+    const auto lastTap = static_cast<int32_t>(std::ceil(0.5 + (2.0 * radius))) - 1;
+    std::vector<double> weights;
+    double sum = 0.0;
+    for (int32_t tap = firstTap; tap <= lastTap; ++tap)
+    {
+      const double weight = EvaluateFilter(filter, (tap - 0.5) / 2.0);
+      weights.push_back(weight);
+      sum += weight;
+    }
+    assert(sum > 0.0);
+    m_firstTapOffset = firstTap;
+    m_weights.reserve(weights.size());
+    for (const double weight : weights)
+    {
+      m_weights.push_back(static_cast<float>(weight / sum));
+    }
+  }
+
+
+  void MipMapLevelDownscaler::Downscale(RawBitmapEx& rDstBitmap, const ReadOnlyRawBitmap& srcBitmap, const uint32_t dstRowBegin,
+                                        const uint32_t dstRowEnd) const
+  {
+    assert(rDstBitmap.GetPixelFormat() == srcBitmap.GetPixelFormat());
+    assert(dstRowBegin <= dstRowEnd);
+    assert(dstRowEnd <= rDstBitmap.RawUnsignedHeight());
+    const uint32_t srcWidth = srcBitmap.RawUnsignedWidth();
+    const uint32_t srcHeight = srcBitmap.RawUnsignedHeight();
+    const uint32_t dstWidth = rDstBitmap.RawUnsignedWidth();
+    if (dstRowBegin >= dstRowEnd || dstWidth <= 0u || srcWidth <= 0u || srcHeight <= 0u)
+    {
+      return;
+    }
+
+    const auto tapCount = UncheckedNumericCast<int32_t>(m_weights.size());
+    const auto maxSrcRow = UncheckedNumericCast<int32_t>(srcHeight - 1u);
+    // The range of src rows touched by the dst rows (clamped to the bitmap)
+    const int32_t srcRowBegin = ClampIndex((UncheckedNumericCast<int32_t>(dstRowBegin) * 2) + m_firstTapOffset, maxSrcRow);
+    const int32_t srcRowEnd = ClampIndex((UncheckedNumericCast<int32_t>(dstRowEnd - 1u) * 2) + m_firstTapOffset + tapCount - 1, maxSrcRow) + 1;
+
+    const uint32_t dstRowEntries = dstWidth * m_channelCount;
+    std::vector<float> decodedRow(std::size_t(srcWidth) * m_channelCount);
+    std::vector<float> horizontalRows(std::size_t(srcRowEnd - srcRowBegin) * dstRowEntries);
+    std::vector<float> dstRow(dstRowEntries);
+
+    // Horizontal pass
+    const auto* const pSrcContent = static_cast<const uint8_t*>(srcBitmap.Content());
+    for (int32_t srcY = srcRowBegin; srcY < srcRowEnd; ++srcY)
+    {
+      DecodeRow(decodedRow.data(), pSrcContent + (std::size_t(srcY) * srcBitmap.Stride()), srcWidth);
+      FilterRowHorizontal(horizontalRows.data() + (std::size_t(srcY - srcRowBegin) * dstRowEntries), decodedRow.data(), srcWidth, dstWidth);
+    }
+
+    // Vertical pass
+    auto* const pDstContent = static_cast<uint8_t*>(rDstBitmap.Content());
+    for (uint32_t dstY = dstRowBegin; dstY < dstRowEnd; ++dstY)
+    {
+      std::fill(dstRow.begin(), dstRow.end(), 0.0f);
+      const int32_t firstSrcY = (UncheckedNumericCast<int32_t>(dstY) * 2) + m_firstTapOffset;
+      for (int32_t tap = 0; tap < tapCount; ++tap)
+      {
+        const int32_t srcY = ClampIndex(firstSrcY + tap, maxSrcRow);
+        assert(srcY >= srcRowBegin && srcY < srcRowEnd);
+        const float* const pRow = horizontalRows.data() + (std::size_t(srcY - srcRowBegin) * dstRowEntries);
+        const float weight = m_weights[tap];
+        for (uint32_t i = 0; i < dstRowEntries; ++i)
+        {
+          dstRow[i] += weight * pRow[i];
+        }
+      }
+      EncodeRow(pDstContent + (std::size_t(dstY) * rDstBitmap.Stride()), dstRow.data(), dstWidth);
+    }
+  }
+
+
+  void MipMapLevelDownscaler::DecodeRow(float* pDst, const uint8_t* pSrc, const uint32_t width) const noexcept
+  {
+    const uint32_t channelCount = m_channelCount;
+    const uint32_t entries = width * channelCount;
+    switch (m_channelType)
+    {
+    case ChannelType::UNorm8:
+      for (uint32_t i = 0; i < entries; ++i)
+      {
+        pDst[i] = (i % channelCount) < m_srgbChannelCount ? m_srgbToLinear[pSrc[i]] : static_cast<float>(pSrc[i]) / 255.0f;
+      }
+      break;
+    case ChannelType::UNorm16:
+      for (uint32_t i = 0; i < entries; ++i)
+      {
+        uint16_t value = 0;
+        std::memcpy(&value, pSrc + (i * sizeof(uint16_t)), sizeof(uint16_t));
+        pDst[i] = static_cast<float>(value) / 65535.0f;
+      }
+      break;
+    case ChannelType::Float16:
+      for (uint32_t i = 0; i < entries; ++i)
+      {
+        uint16_t value = 0;
+        std::memcpy(&value, pSrc + (i * sizeof(uint16_t)), sizeof(uint16_t));
+        pDst[i] = HalfToFloat(value);
+      }
+      break;
+    case ChannelType::Float32:
+      std::memcpy(pDst, pSrc, entries * sizeof(float));
+      break;
+    }
+  }
+
+
+  void MipMapLevelDownscaler::EncodeRow(uint8_t* pDst, const float* pSrc, const uint32_t width) const noexcept
+  {
+    const uint32_t channelCount = m_channelCount;
+    const uint32_t entries = width * channelCount;
+    switch (m_channelType)
+    {
+    case ChannelType::UNorm8:
+      for (uint32_t i = 0; i < entries; ++i)
+      {
+        pDst[i] = (i % channelCount) < m_srgbChannelCount ? ColorSpaceConversion::ConvertLinearToSRGBUInt8(pSrc[i])
+                                                          : static_cast<uint8_t>(std::lround(ClampUNorm(pSrc[i]) * 255.0f));
+      }
+      break;
+    case ChannelType::UNorm16:
+      for (uint32_t i = 0; i < entries; ++i)
+      {
+        const auto value = static_cast<uint16_t>(std::lround(ClampUNorm(pSrc[i]) * 65535.0f));
+        std::memcpy(pDst + (i * sizeof(uint16_t)), &value, sizeof(uint16_t));
+      }
+      break;
+    case ChannelType::Float16:
+      for (uint32_t i = 0; i < entries; ++i)
+      {
+        const uint16_t value = FloatToHalf(pSrc[i]);
+        std::memcpy(pDst + (i * sizeof(uint16_t)), &value, sizeof(uint16_t));
+      }
+      break;
+    case ChannelType::Float32:
+      std::memcpy(pDst, pSrc, entries * sizeof(float));
+      break;
+    }
+  }
+
+
+  void MipMapLevelDownscaler::FilterRowHorizontal(float* pDst, const float* pSrc, const uint32_t srcWidth, const uint32_t dstWidth) const noexcept
+  {
+    const uint32_t channelCount = m_channelCount;
+    const auto tapCount = UncheckedNumericCast<int32_t>(m_weights.size());
+    const auto maxSrcX = UncheckedNumericCast<int32_t>(srcWidth - 1u);
+    for (uint32_t dstX = 0; dstX < dstWidth; ++dstX)
+    {
+      float* const pDstPixel = pDst + (dstX * channelCount);
+      std::fill(pDstPixel, pDstPixel + channelCount, 0.0f);
+      const int32_t firstSrcX = (UncheckedNumericCast<int32_t>(dstX) * 2) + m_firstTapOffset;
+      for (int32_t tap = 0; tap < tapCount; ++tap)
+      {
+        const float* const pSrcPixel = pSrc + (std::size_t(ClampIndex(firstSrcX + tap, maxSrcX)) * channelCount);
+        const float weight = m_weights[tap];
+        for (uint32_t channel = 0; channel < channelCount; ++channel)
+        {
+          pDstPixel[channel] += weight * pSrcPixel[channel];
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,85 @@
+#ifndef FSLGRAPHICS_TEXTURE_MIPMAPLEVELDOWNSCALER_HPP
+#define FSLGRAPHICS_TEXTURE_MIPMAPLEVELDOWNSCALER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslGraphics/PixelFormat.hpp>
+#include <FslGraphics/Texture/TextureMipMapFilter.hpp>
+#include <array>
+#include <vector>
+
+namespace Fsl
+{
+  class RawBitmapEx;
+  class ReadOnlyRawBitmap;
+
+  //! @brief Downscales a bitmap to half its size using a separable 2:1 filter evaluated in floating point.
+  //!        SRGB encoded color channels are converted to linear before filtering and back afterwards (alpha is left as is).
+  //!        The destination is processed in row ranges that are independent of each other so they can be processed concurrently.
+  //! @note  Pixels outside the bitmap are clamped to the edge, so cube map faces are filtered independently.
+  class MipMapLevelDownscaler
+  {
+    enum class ChannelType
+    {
+      UNorm8,
+      UNorm16,
+      Float16,
+      Float32
+    };
+
+    ChannelType m_channelType{ChannelType::UNorm8};
+    uint32_t m_channelCount{0};
+    //! The number of channels that are SRGB encoded (zero for linear formats)
+    uint32_t m_srgbChannelCount{0};
+    //! The source offset of the first filter tap relative to 2 * dstIndex
+    int32_t m_firstTapOffset{0};
+    std::vector<float> m_weights;
+    std::array<float, 256> m_srgbToLinear{};
+
+  public:
+    //! @brief Check if the pixel format can be processed by the downscaler
+    static bool IsSupported(const PixelFormat pixelFormat) noexcept;
+
+    MipMapLevelDownscaler(const TextureMipMapFilter filter, const PixelFormat pixelFormat);
+
+    //! @brief Generate the dst rows [dstRowBegin, dstRowEnd) from the src bitmap.
+    //! @note  The dst bitmap must be half the size of the src and use the same pixel format.
+    void Downscale(RawBitmapEx& rDstBitmap, const ReadOnlyRawBitmap& srcBitmap, const uint32_t dstRowBegin, const uint32_t dstRowEnd) const;
+
+  private:
+    void DecodeRow(float* pDst, const uint8_t* pSrc, const uint32_t width) const noexcept;
+    void EncodeRow(uint8_t* pDst, const float* pSrc, const uint32_t width) const noexcept;
+    void FilterRowHorizontal(float* pDst, const float* pSrc, const uint32_t srcWidth, const uint32_t dstWidth) const noexcept;
+  };
+}
+
+#endif
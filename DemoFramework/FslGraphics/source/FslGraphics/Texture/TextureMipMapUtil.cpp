@@ -31,6 +31,8 @@
 
 #include <FslBase/Math/MathHelper.hpp>
 #include <FslBase/NumericCast.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslBase/UncheckedNumericCast.hpp>
 #include <FslGraphics/Bitmap/Bitmap.hpp>
 #include <FslGraphics/Bitmap/RawBitmapUtil.hpp>
 #include <FslGraphics/Log/Texture/FmtTextureType.hpp>
@@ -38,11 +40,67 @@
 #include <FslGraphics/Texture/RawTextureHelper.hpp>
 #include <FslGraphics/Texture/TextureBlobBuilder.hpp>
 #include <FslGraphics/Texture/TextureMipMapUtil.hpp>
+#include <algorithm>
+#include <optional>
+#include "MipMapLevelDownscaler.hpp"
 
 namespace Fsl
 {
   namespace TextureMipMapUtil
   {
+    namespace
+    {
+      namespace LocalConfig
+      {
+        //! The number of dst rows processed by each job
+        constexpr uint32_t TileRows = 64;
+      }
+
+      //! Nearest and box filtering of 32bit R8G8B8A8 compatible formats is handled by RawBitmapUtil
+      bool UseRawBitmapUtil(const TextureMipMapFilter filter, const PixelFormat pixelFormat)
+      {
+        return (filter == TextureMipMapFilter::Nearest || filter == TextureMipMapFilter::Box) &&
+               PixelFormatLayoutUtil::IsSwizzleCompatible(PixelFormatUtil::GetPixelFormatLayout(pixelFormat), PixelFormatLayout::R8G8B8A8);
+      }
+
+      void DownscaleRows(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap, const TextureMipMapFilter filter,
+                         const std::optional<MipMapLevelDownscaler>& downscaler, const uint32_t dstRowBegin, const uint32_t dstRowEnd)
+      {
+        if (downscaler.has_value())
+        {
+          downscaler->Downscale(dstBitmap, srcBitmap, dstRowBegin, dstRowEnd);
+          return;
+        }
+
+        // Create bitmaps that only cover the rows, the 2:1 mapping between dst and src rows makes the result identical to processing it all.
+        const uint32_t dstStride = dstBitmap.Stride();
+        const uint32_t srcStride = srcBitmap.Stride();
+        const uint32_t dstRows = dstRowEnd - dstRowBegin;
+        const PixelFormat pixelFormat = srcBitmap.GetPixelFormat();
+        const BitmapOrigin origin = srcBitmap.GetOrigin();
+        ReadOnlyRawBitmap srcRows(ReadOnlyRawBitmap::UncheckedCreate(
+          static_cast<const uint8_t*>(srcBitmap.Content()) + (std::size_t(dstRowBegin) * 2u * srcStride), dstRows * 2u * srcStride,
+          PxSize2D::Create(srcBitmap.RawWidth(), UncheckedNumericCast<int32_t>(dstRows * 2u)), pixelFormat, srcStride, origin));
+        RawBitmapEx dstRowsBitmap(RawBitmapEx::UncheckedCreate(static_cast<uint8_t*>(dstBitmap.Content()) + (std::size_t(dstRowBegin) * dstStride),
+                                                               dstRows * dstStride,
+                                                               PxSize2D::Create(dstBitmap.RawWidth(), UncheckedNumericCast<int32_t>(dstRows)),
+                                                               pixelFormat, dstStride, origin));
+        switch (filter)
+        {
+        case TextureMipMapFilter::Nearest:
+          RawBitmapUtil::DownscaleNearest(dstRowsBitmap, srcRows);
+          break;
+        case TextureMipMapFilter::Box:
+          RawBitmapUtil::DownscaleBoxFilter(dstRowsBitmap, srcRows);
+          break;
+        default:
+          throw NotSupportedException("Unsupported filter");
+        }
+      }
+
+      Texture DoGenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter, JobSystem* const pJobSystem);
+    }
+
     uint32_t CountMipMapLevels(uint32_t size)
     {
       if (!MathHelper::IsPowerOfTwo(size))
@@ -79,94 +137,157 @@ namespace Fsl
 
     Texture GenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter)
     {
-      if (!src.IsValid())
-      {
-        throw std::invalid_argument("src must be valid");
-      }
-      const PixelFormat pixelFormat = src.GetPixelFormat();
-      const BitmapOrigin origin = src.GetBitmapOrigin();
-      if (PixelFormatUtil::IsCompressed(pixelFormat))
-      {
-        throw std::invalid_argument("src pixel format can not be compressed");
-      }
-      PxExtent2D extent = src.GetExtent2D();
-      if (extent.Width != extent.Height || !MathHelper::IsPowerOfTwo(extent.Width.Value))
-      {
-        throw NotSupportedException("We expect a square pow2 texture");
-      }
-      if (src.GetLayers() != 1u || src.GetLevels() != 1u)
-      {
-        throw NotSupportedException("texture Layers and Faces must be 1");
-      }
+      return DoGenerateMipMaps(src, filter, nullptr);
+    }
+
+
+    Texture GenerateMipMaps(const Bitmap& src, const TextureMipMapFilter filter, JobSystem& rJobSystem)
+    {
+      const Bitmap::ScopedDirectReadAccess access(src);
+      return GenerateMipMaps(access.AsRawBitmap(), filter, rJobSystem);
+    }
 
-      switch (src.GetTextureType())
-      {
-      case TextureType::Tex1D:
-      case TextureType::Tex2D:
-      case TextureType::TexCube:
-        break;
-      default:
-        throw NotSupportedException(fmt::format("unsupported texture type: {}", src.GetTextureType()));
-      }
 
-      const uint32_t mipLevels = CountMipMapLevels(extent.Width.Value);
-      const TextureInfo textureInfo(mipLevels, src.GetFaces(), src.GetLayers());
-      Texture result(TextureBlobBuilder(src.GetTextureType(), src.GetExtent(), pixelFormat, textureInfo, origin, true));
+    Texture GenerateMipMaps(const Texture& src, const TextureMipMapFilter filter, JobSystem& rJobSystem)
+    {
+      Texture::ScopedDirectReadAccess access(src);
+      return GenerateMipMaps(access.AsRawTexture(), filter, rJobSystem);
+    }
+
+
+    Texture GenerateMipMaps(const ReadOnlyRawBitmap& src, const TextureMipMapFilter filter, JobSystem& rJobSystem)
+    {
+      ReadOnlyRawTexture srcTexture = RawTextureHelper::ToRawTexture(src);
+      return GenerateMipMaps(srcTexture, filter, rJobSystem);
+    }
+
+
+    Texture GenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter, JobSystem& rJobSystem)
+    {
+      return DoGenerateMipMaps(src, filter, &rJobSystem);
+    }
+
+
+    namespace
+    {
+      Texture DoGenerateMipMaps(const ReadOnlyRawTexture& src, const TextureMipMapFilter filter, JobSystem* const pJobSystem)
       {
-        Texture::ScopedDirectReadWriteAccess dstAccess(result);
-        RawTextureEx rawDstTexture = dstAccess.AsRawTexture();
-
-        auto* const pDstStart = static_cast<uint8_t*>(rawDstTexture.GetContent());
-        {    // Copy the original 'faces' directly
-          const auto* const pSrcStart = static_cast<const uint8_t*>(src.GetContent());
-          for (uint32_t faceIndex = 0; faceIndex < textureInfo.Faces; ++faceIndex)
-          {
-            BlobRecord srcBlobRecord = src.GetTextureBlob(0, faceIndex, 0);
-            BlobRecord dstBlobRecord = rawDstTexture.GetTextureBlob(0, faceIndex, 0);
-            if (srcBlobRecord.Size != dstBlobRecord.Size)
+        if (!src.IsValid())
+        {
+          throw std::invalid_argument("src must be valid");
+        }
+        const PixelFormat pixelFormat = src.GetPixelFormat();
+        const BitmapOrigin origin = src.GetBitmapOrigin();
+        if (PixelFormatUtil::IsCompressed(pixelFormat))
+        {
+          throw std::invalid_argument("src pixel format can not be compressed");
+        }
+        PxExtent2D extent = src.GetExtent2D();
+        if (extent.Width != extent.Height || !MathHelper::IsPowerOfTwo(extent.Width.Value))
+        {
+          throw NotSupportedException("We expect a square pow2 texture");
+        }
+        if (src.GetLevels() != 1u)
+        {
+          throw NotSupportedException("texture Levels must be 1");
+        }
+
+        switch (src.GetTextureType())
+        {
+        case TextureType::Tex1D:
+        case TextureType::Tex2D:
+        case TextureType::TexCube:
+        case TextureType::Tex1DArray:
+        case TextureType::Tex2DArray:
+        case TextureType::TexCubeArray:
+          break;
+        default:
+          throw NotSupportedException(fmt::format("unsupported texture type: {}", src.GetTextureType()));
+        }
+
+        // Validate the filter and pixel format combination before doing any work
+        std::optional<MipMapLevelDownscaler> downscaler;
+        if (!UseRawBitmapUtil(filter, pixelFormat))
+        {
+          downscaler.emplace(filter, pixelFormat);
+        }
+
+        const uint32_t mipLevels = CountMipMapLevels(extent.Width.Value);
+        const TextureInfo textureInfo(mipLevels, src.GetFaces(), src.GetLayers());
+        Texture result(TextureBlobBuilder(src.GetTextureType(), src.GetExtent(), pixelFormat, textureInfo, origin, true));
+        {
+          Texture::ScopedDirectReadWriteAccess dstAccess(result);
+          RawTextureEx rawDstTexture = dstAccess.AsRawTexture();
+
+          auto* const pDstStart = static_cast<uint8_t*>(rawDstTexture.GetContent());
+          {    // Copy the original 'faces' and 'layers' directly
+            const auto* const pSrcStart = static_cast<const uint8_t*>(src.GetContent());
+            for (uint32_t layerIndex = 0; layerIndex < textureInfo.Layers; ++layerIndex)
             {
-              throw std::logic_error("internal error, the blob sizes did not match");
+              for (uint32_t faceIndex = 0; faceIndex < textureInfo.Faces; ++faceIndex)
+              {
+                BlobRecord srcBlobRecord = src.GetTextureBlob(0, faceIndex, layerIndex);
+                BlobRecord dstBlobRecord = rawDstTexture.GetTextureBlob(0, faceIndex, layerIndex);
+                if (srcBlobRecord.Size != dstBlobRecord.Size)
+                {
+                  throw std::logic_error("internal error, the blob sizes did not match");
+                }
+                const uint8_t* const pSrc = (pSrcStart + srcBlobRecord.Offset);
+                uint8_t* pDst = (pDstStart + dstBlobRecord.Offset);
+                std::memcpy(pDst, pSrc, dstBlobRecord.Size);
+              }
             }
-            const uint8_t* const pSrc = (pSrcStart + srcBlobRecord.Offset);
-            uint8_t* pDst = (pDstStart + dstBlobRecord.Offset);
-            std::memcpy(pDst, pSrc, dstBlobRecord.Size);
           }
-        }
-        if (textureInfo.Layers > 0u)
-        {    // Generate the mip maps
-          const uint32_t finalSrcLevel = textureInfo.Levels - 1;
-          uint32_t width = extent.Width.Value;
-          uint32_t height = extent.Height.Value;
-          for (uint32_t levelIndex = 0; levelIndex < finalSrcLevel; ++levelIndex)
-          {
-            for (uint32_t faceIndex = 0; faceIndex < textureInfo.Faces; ++faceIndex)
+          if (textureInfo.Layers > 0u)
+          {    // Generate the mip maps, each level depends on the previous one but the faces, layers and row tiles of a level are independent
+            const uint32_t finalSrcLevel = textureInfo.Levels - 1;
+            const uint32_t imageCount = textureInfo.Faces * textureInfo.Layers;
+            uint32_t width = extent.Width.Value;
+            uint32_t height = extent.Height.Value;
+            for (uint32_t levelIndex = 0; levelIndex < finalSrcLevel; ++levelIndex)
             {
-              BlobRecord srcBlobRecord = rawDstTexture.GetTextureBlob(levelIndex, faceIndex, 0);
-              BlobRecord dstBlobRecord = rawDstTexture.GetTextureBlob(levelIndex + 1, faceIndex, 0);
-              // Since we copied the original data to dest and are reusing the previous mipmaps pDstStart is the base
-              ReadOnlyRawBitmap srcBitmap(ReadOnlyRawBitmap::UncheckedCreate(
-                pDstStart + srcBlobRecord.Offset, NumericCast<uint32_t>(srcBlobRecord.Size), PxExtent2D::Create(width, height), pixelFormat, origin));
-              RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(pDstStart + dstBlobRecord.Offset, NumericCast<uint32_t>(dstBlobRecord.Size),
-                                                                 PxExtent2D::Create(width / 2, height / 2), pixelFormat, origin));
-
-              switch (filter)
+              const uint32_t dstHeight = height / 2;
+              const uint32_t tilesPerImage = (dstHeight + LocalConfig::TileRows - 1) / LocalConfig::TileRows;
+              const auto processWorkItems = [&](const std::size_t begin, const std::size_t end)
+              {
+                for (std::size_t workIndex = begin; workIndex < end; ++workIndex)
+                {
+                  const auto imageIndex = static_cast<uint32_t>(workIndex / tilesPerImage);
+                  const auto tileIndex = static_cast<uint32_t>(workIndex % tilesPerImage);
+                  const uint32_t faceIndex = imageIndex % textureInfo.Faces;
+                  const uint32_t layerIndex = imageIndex / textureInfo.Faces;
+
+                  BlobRecord srcBlobRecord = rawDstTexture.GetTextureBlob(levelIndex, faceIndex, layerIndex);
+                  BlobRecord dstBlobRecord = rawDstTexture.GetTextureBlob(levelIndex + 1, faceIndex, layerIndex);
+                  // Since we copied the original data to dest and are reusing the previous mipmaps pDstStart is the base
+                  ReadOnlyRawBitmap srcBitmap(ReadOnlyRawBitmap::UncheckedCreate(pDstStart + srcBlobRecord.Offset,
+                                                                                 NumericCast<uint32_t>(srcBlobRecord.Size),
+                                                                                 PxExtent2D::Create(width, height), pixelFormat, origin));
+                  RawBitmapEx dstBitmap(RawBitmapEx::UncheckedCreate(pDstStart + dstBlobRecord.Offset, NumericCast<uint32_t>(dstBlobRecord.Size),
+                                                                     PxExtent2D::Create(width / 2, dstHeight), pixelFormat, origin));
+
+                  const uint32_t dstRowBegin = tileIndex * LocalConfig::TileRows;
+                  const uint32_t dstRowEnd = std::min(dstRowBegin + LocalConfig::TileRows, dstHeight);
+                  DownscaleRows(dstBitmap, srcBitmap, filter, downscaler, dstRowBegin, dstRowEnd);
+                }
+              };
+
+              const std::size_t workItemCount = std::size_t(imageCount) * tilesPerImage;
+              if (pJobSystem != nullptr && workItemCount > 1u)
+              {
+                pJobSystem->ParallelFor(workItemCount, 1u, processWorkItems);
+              }
+              else
               {
-              case TextureMipMapFilter::Nearest:
-                RawBitmapUtil::DownscaleNearest(dstBitmap, srcBitmap);
-                break;
-              case TextureMipMapFilter::Box:
-                RawBitmapUtil::DownscaleBoxFilter(dstBitmap, srcBitmap);
-                break;
-              default:
-                throw NotSupportedException("Unsupported filter");
+                processWorkItems(0u, workItemCount);
               }
+              width /= 2;
+              height = dstHeight;
             }
-            width /= 2;
-            height /= 2;
           }
         }
+        return result;
       }
-      return result;
     }
-  };
+  }
 }
@@ -0,0 +1,407 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/ColorChannelConverter.hpp>
+#include <FslGraphics/Vertices/VertexConversionPlan.hpp>
+#include <FslGraphics/Vertices/VertexElementFormatUtil.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! The vertices are processed in chunks so each operation runs a tight loop over vertices that are still in the cache
+      constexpr std::size_t ChunkVertexCount = 256;
+      //! Spans with less vertices than this are always converted on the calling thread
+      constexpr std::size_t MinParallelVertexCount = 32768;
+      constexpr std::size_t ParallelGrainSize = 8192;
+    }
+
+    using OperationType = VertexConversionPlan::OperationType;
+    using Operation = VertexConversionPlan::Operation;
+
+    bool TryGetConversion(const VertexElementFormat dstFormat, const VertexElementFormat srcFormat, OperationType& rType) noexcept
+    {
+      if (srcFormat == VertexElementFormat::Vector4)
+      {
+        switch (dstFormat)
+        {
+        case VertexElementFormat::X8Y8Z8W8_UNORM:
+          rType = OperationType::Vector4ToX8Y8Z8W8Unorm;
+          return true;
+        case VertexElementFormat::X16Y16Z16W16_UNORM:
+          rType = OperationType::Vector4ToX16Y16Z16W16Unorm;
+          return true;
+        default:
+          break;
+        }
+      }
+      else if (dstFormat == VertexElementFormat::Vector4)
+      {
+        switch (srcFormat)
+        {
+        case VertexElementFormat::X8Y8Z8W8_UNORM:
+          rType = OperationType::X8Y8Z8W8UnormToVector4;
+          return true;
+        case VertexElementFormat::X16Y16Z16W16_UNORM:
+          rType = OperationType::X16Y16Z16W16UnormToVector4;
+          return true;
+        default:
+          break;
+        }
+      }
+      return false;
+    }
+
+    bool TryMerge(Operation& rLast, const Operation& op) noexcept
+    {
+      if (rLast.Type != op.Type || (rLast.DstOffset + rLast.ByteSize) != op.DstOffset)
+      {
+        return false;
+      }
+      switch (op.Type)
+      {
+      case OperationType::Copy:
+        if ((rLast.SrcOffset + rLast.ByteSize) != op.SrcOffset)
+        {
+          return false;
+        }
+        break;
+      case OperationType::Fill:
+        // Fills always read the default vertex at the dst offset
+        break;
+      default:
+        return false;
+      }
+      rLast.ByteSize += op.ByteSize;
+      return true;
+    }
+
+
+    void ValidateApplyArguments(const void* const pDst, const std::size_t cbDst, const std::size_t dstVertexStride, const void* const pSrc,
+                                const std::size_t cbSrc, const std::size_t srcVertexStride, const std::size_t vertexCount)
+    {
+      if (pDst == nullptr || pSrc == nullptr)
+      {
+        throw std::invalid_argument("invalid argument");
+      }
+      if (cbSrc < (srcVertexStride * vertexCount))
+      {
+        throw std::invalid_argument("out of bounds. pSrc does not hold the intended number of elements");
+      }
+      if (cbDst < (dstVertexStride * vertexCount))
+      {
+        throw std::invalid_argument("out of bounds. pDst can not hold the intended number of elements");
+      }
+    }
+
+
+    template <std::size_t TByteSize>
+    inline void CopyFixed(uint8_t* pDst, const std::size_t dstStride, const uint8_t* pSrc, const std::size_t srcStride,
+                          const std::size_t vertexCount) noexcept
+    {
+      for (std::size_t i = 0; i < vertexCount; ++i)
+      {
+        std::memcpy(pDst, pSrc, TByteSize);
+        pDst += dstStride;
+        pSrc += srcStride;
+      }
+    }
+
+    //! @note a srcStride of zero is used to repeat the same src value (fill)
+    void Copy(uint8_t* pDst, const std::size_t dstStride, const uint8_t* pSrc, const std::size_t srcStride, const std::size_t vertexCount,
+              const std::size_t cbEntry) noexcept
+    {
+      // Let the compiler inline the common element sizes
+      switch (cbEntry)
+      {
+      case 4:
+        CopyFixed<4>(pDst, dstStride, pSrc, srcStride, vertexCount);
+        return;
+      case 8:
+        CopyFixed<8>(pDst, dstStride, pSrc, srcStride, vertexCount);
+        return;
+      case 12:
+        CopyFixed<12>(pDst, dstStride, pSrc, srcStride, vertexCount);
+        return;
+      case 16:
+        CopyFixed<16>(pDst, dstStride, pSrc, srcStride, vertexCount);
+        return;
+      case 20:
+        CopyFixed<20>(pDst, dstStride, pSrc, srcStride, vertexCount);
+        return;
+      case 24:
+        CopyFixed<24>(pDst, dstStride, pSrc, srcStride, vertexCount);
+        return;
+      case 32:
+        CopyFixed<32>(pDst, dstStride, pSrc, srcStride, vertexCount);
+        return;
+      default:
+        for (std::size_t i = 0; i < vertexCount; ++i)
+        {
+          std::memcpy(pDst, pSrc, cbEntry);
+          pDst += dstStride;
+          pSrc += srcStride;
+        }
+        return;
+      }
+    }
+
+    // The src vertices are not guaranteed to be aligned so all reads are done with memcpy
+
+    void ConvertVector4ToX8Y8Z8W8Unorm(uint8_t* pDst, const std::size_t dstStride, const uint8_t* pSrc, const std::size_t srcStride,
+                                       const std::size_t vertexCount) noexcept
+    {
+      std::array<float, 4> src{};
+      std::array<uint8_t, 4> dst{};
+      for (std::size_t i = 0; i < vertexCount; ++i)
+      {
+        std::memcpy(src.data(), pSrc, sizeof(src));
+        dst[0] = ColorChannelConverter::RawF32ToRawU8(src[0]);
+        dst[1] = ColorChannelConverter::RawF32ToRawU8(src[1]);
+        dst[2] = ColorChannelConverter::RawF32ToRawU8(src[2]);
+        dst[3] = ColorChannelConverter::RawF32ToRawU8(src[3]);
+        std::memcpy(pDst, dst.data(), sizeof(dst));
+        pDst += dstStride;
+        pSrc += srcStride;
+      }
+    }
+
+    void ConvertVector4ToX16Y16Z16W16Unorm(uint8_t* pDst, const std::size_t dstStride, const uint8_t* pSrc, const std::size_t srcStride,
+                                           const std::size_t vertexCount) noexcept
+    {
+      std::array<float, 4> src{};
+      std::array<uint16_t, 4> dst{};
+      for (std::size_t i = 0; i < vertexCount; ++i)
+      {
+        std::memcpy(src.data(), pSrc, sizeof(src));
+        dst[0] = ColorChannelConverter::RawF32ToRawU16(src[0]);
+        dst[1] = ColorChannelConverter::RawF32ToRawU16(src[1]);
+        dst[2] = ColorChannelConverter::RawF32ToRawU16(src[2]);
+        dst[3] = ColorChannelConverter::RawF32ToRawU16(src[3]);
+        std::memcpy(pDst, dst.data(), sizeof(dst));
+        pDst += dstStride;
+        pSrc += srcStride;
+      }
+    }
+
+    void ConvertX8Y8Z8W8UnormToVector4(uint8_t* pDst, const std::size_t dstStride, const uint8_t* pSrc, const std::size_t srcStride,
+                                       const std::size_t vertexCount) noexcept
+    {
+      std::array<uint8_t, 4> src{};
+      std::array<float, 4> dst{};
+      for (std::size_t i = 0; i < vertexCount; ++i)
+      {
+        std::memcpy(src.data(), pSrc, sizeof(src));
+        dst[0] = ColorChannelConverter::RawU8ToRawF32(src[0]);
+        dst[1] = ColorChannelConverter::RawU8ToRawF32(src[1]);
+        dst[2] = ColorChannelConverter::RawU8ToRawF32(src[2]);
+        dst[3] = ColorChannelConverter::RawU8ToRawF32(src[3]);
+        std::memcpy(pDst, dst.data(), sizeof(dst));
+        pDst += dstStride;
+        pSrc += srcStride;
+      }
+    }
+
+    void ConvertX16Y16Z16W16UnormToVector4(uint8_t* pDst, const std::size_t dstStride, const uint8_t* pSrc, const std::size_t srcStride,
+                                           const std::size_t vertexCount) noexcept
+    {
+      std::array<uint16_t, 4> src{};
+      std::array<float, 4> dst{};
+      for (std::size_t i = 0; i < vertexCount; ++i)
+      {
+        std::memcpy(src.data(), pSrc, sizeof(src));
+        dst[0] = ColorChannelConverter::RawU16ToRawF32(src[0]);
+        dst[1] = ColorChannelConverter::RawU16ToRawF32(src[1]);
+        dst[2] = ColorChannelConverter::RawU16ToRawF32(src[2]);
+        dst[3] = ColorChannelConverter::RawU16ToRawF32(src[3]);
+        std::memcpy(pDst, dst.data(), sizeof(dst));
+        pDst += dstStride;
+        pSrc += srcStride;
+      }
+    }
+  }
+
+
+  VertexConversionPlan::VertexConversionPlan(VertexDeclarationSpan dstVertexDeclaration, VertexDeclarationSpan srcVertexDeclaration,
+                                             const void* const pDstDefaultValues, const uint32_t cbDstDefaultValues)
+    : m_dstVertexDeclaration(dstVertexDeclaration)
+    , m_srcVertexDeclaration(srcVertexDeclaration)
+  {
+    const uint32_t dstVertexStride = dstVertexDeclaration.VertexStride();
+    if (pDstDefaultValues == nullptr || cbDstDefaultValues < dstVertexStride)
+    {
+      throw std::invalid_argument("invalid argument");
+    }
+
+    m_dstDefaultValues.resize(dstVertexStride);
+    std::memcpy(m_dstDefaultValues.data(), pDstDefaultValues, dstVertexStride);
+
+    if (dstVertexDeclaration == srcVertexDeclaration && !dstVertexDeclaration.Empty())
+    {
+      // Identical layouts, so the entire vertex can be copied (this also copies any padding)
+      m_operations.emplace_back(OperationType::Copy, 0u, 0u, dstVertexStride);
+      m_isBulkCopy = true;
+      m_isValid = true;
+      return;
+    }
+
+    m_operations.reserve(dstVertexDeclaration.Count());
+    // The elements of a vertex declaration are sorted by offset, so the operations will be too
+    for (uint32_t i = 0; i < dstVertexDeclaration.Count(); ++i)
+    {
+      const VertexElement& dstElement = dstVertexDeclaration[i];
+      const auto cbDstEntry = static_cast<uint32_t>(VertexElementFormatUtil::GetBytesPerElement(dstElement.Format));
+
+      Operation op(OperationType::Fill, dstElement.Offset, dstElement.Offset, cbDstEntry);
+      const int32_t srcIndex = srcVertexDeclaration.VertexElementIndexOf(dstElement.Usage, dstElement.UsageIndex);
+      if (srcIndex >= 0)
+      {
+        const VertexElement& srcElement = srcVertexDeclaration[static_cast<uint32_t>(srcIndex)];
+        op.SrcOffset = srcElement.Offset;
+        if (dstElement.Format == srcElement.Format)
+        {
+          op.Type = OperationType::Copy;
+        }
+        else if (!TryGetConversion(dstElement.Format, srcElement.Format, op.Type))
+        {
+          throw NotImplementedException("Element format conversion not implemented");
+        }
+      }
+
+      if (m_operations.empty() || !TryMerge(m_operations.back(), op))
+      {
+        m_operations.push_back(op);
+      }
+    }
+
+    m_isBulkCopy = m_operations.size() == 1u && m_operations[0].Type == OperationType::Copy && m_operations[0].DstOffset == 0u &&
+                   m_operations[0].SrcOffset == 0u && m_operations[0].ByteSize == dstVertexStride &&
+                   dstVertexStride == srcVertexDeclaration.VertexStride();
+    m_isValid = true;
+  }
+
+
+  void VertexConversionPlan::Apply(void* const pDst, const std::size_t cbDst, const void* const pSrc, const std::size_t cbSrc,
+                                   const std::size_t vertexCount) const
+  {
+    if (!m_isValid)
+    {
+      throw UsageErrorException("Apply called on a invalid object");
+    }
+    ValidateApplyArguments(pDst, cbDst, m_dstVertexDeclaration.VertexStride(), pSrc, cbSrc, m_srcVertexDeclaration.VertexStride(), vertexCount);
+    ApplyRange(static_cast<uint8_t*>(pDst), static_cast<const uint8_t*>(pSrc), vertexCount);
+  }
+
+
+  void VertexConversionPlan::Apply(JobSystem& jobSystem, void* const pDst, const std::size_t cbDst, const void* const pSrc, const std::size_t cbSrc,
+                                   const std::size_t vertexCount) const
+  {
+    if (vertexCount < LocalConfig::MinParallelVertexCount)
+    {
+      Apply(pDst, cbDst, pSrc, cbSrc, vertexCount);
+      return;
+    }
+    if (!m_isValid)
+    {
+      throw UsageErrorException("Apply called on a invalid object");
+    }
+    const std::size_t srcVertexStride = m_srcVertexDeclaration.VertexStride();
+    const std::size_t dstVertexStride = m_dstVertexDeclaration.VertexStride();
+    ValidateApplyArguments(pDst, cbDst, dstVertexStride, pSrc, cbSrc, srcVertexStride, vertexCount);
+
+    auto* const pDstBuffer = static_cast<uint8_t*>(pDst);
+    const auto* const pSrcBuffer = static_cast<const uint8_t*>(pSrc);
+    jobSystem.ParallelFor(vertexCount, LocalConfig::ParallelGrainSize,
+                          [this, pDstBuffer, pSrcBuffer, srcVertexStride, dstVertexStride](const std::size_t begin, const std::size_t end)
+                          { ApplyRange(pDstBuffer + (begin * dstVertexStride), pSrcBuffer + (begin * srcVertexStride), end - begin); });
+  }
+
+
+  void VertexConversionPlan::ApplyRange(uint8_t* const pDst, const uint8_t* const pSrc, const std::size_t vertexCount) const noexcept
+  {
+    if (m_isBulkCopy)
+    {
+      std::memcpy(pDst, pSrc, std::size_t(m_dstVertexDeclaration.VertexStride()) * vertexCount);
+      return;
+    }
+
+    const std::size_t srcVertexStride = m_srcVertexDeclaration.VertexStride();
+    const std::size_t dstVertexStride = m_dstVertexDeclaration.VertexStride();
+    const uint8_t* const pDefaultValues = m_dstDefaultValues.data();
+
+    std::size_t vertexIndex = 0;
+    while (vertexIndex < vertexCount)
+    {
+      const std::size_t chunkVertexCount = std::min(vertexCount - vertexIndex, LocalConfig::ChunkVertexCount);
+      uint8_t* const pDstChunk = pDst + (vertexIndex * dstVertexStride);
+      const uint8_t* const pSrcChunk = pSrc + (vertexIndex * srcVertexStride);
+
+      for (const Operation& op : m_operations)
+      {
+        uint8_t* const pDstEntry = pDstChunk + op.DstOffset;
+        const uint8_t* const pSrcEntry = pSrcChunk + op.SrcOffset;
+        switch (op.Type)
+        {
+        case OperationType::Copy:
+          Copy(pDstEntry, dstVertexStride, pSrcEntry, srcVertexStride, chunkVertexCount, op.ByteSize);
+          break;
+        case OperationType::Fill:
+          Copy(pDstEntry, dstVertexStride, pDefaultValues + op.SrcOffset, 0u, chunkVertexCount, op.ByteSize);
+          break;
+        case OperationType::Vector4ToX8Y8Z8W8Unorm:
+          ConvertVector4ToX8Y8Z8W8Unorm(pDstEntry, dstVertexStride, pSrcEntry, srcVertexStride, chunkVertexCount);
+          break;
+        case OperationType::Vector4ToX16Y16Z16W16Unorm:
+          ConvertVector4ToX16Y16Z16W16Unorm(pDstEntry, dstVertexStride, pSrcEntry, srcVertexStride, chunkVertexCount);
+          break;
+        case OperationType::X8Y8Z8W8UnormToVector4:
+          ConvertX8Y8Z8W8UnormToVector4(pDstEntry, dstVertexStride, pSrcEntry, srcVertexStride, chunkVertexCount);
+          break;
+        case OperationType::X16Y16Z16W16UnormToVector4:
+          ConvertX16Y16Z16W16UnormToVector4(pDstEntry, dstVertexStride, pSrcEntry, srcVertexStride, chunkVertexCount);
+          break;
+        default:
+          assert(false);
+          break;
+        }
+      }
+      vertexIndex += chunkVertexCount;
+    }
+  }
+}
@@ -30,33 +30,12 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Exceptions.hpp>
+#include <FslGraphics/Vertices/VertexConversionPlan.hpp>
 #include <FslGraphics/Vertices/VertexConverter.hpp>
-#include <FslGraphics/Vertices/VertexElementFormatUtil.hpp>
-#include <cassert>
 #include <cstring>
-#include <limits>
 
 namespace Fsl
 {
-  namespace
-  {
-    int32_t IndexOf(VertexDeclarationSpan vertexDeclaration, const VertexElementUsage usage, const std::size_t usageIndex)
-    {
-      for (std::size_t i = 0; i < vertexDeclaration.Count(); ++i)
-      {
-        const VertexElement element = vertexDeclaration.At(i);
-        if (usage == element.Usage && usageIndex == element.UsageIndex)
-        {
-          static_assert(static_cast<uint32_t>(std::numeric_limits<int32_t>::max()) < std::numeric_limits<std::size_t>::max(),
-                        "std::size assumptions are wrong");
-          assert(i <= static_cast<std::size_t>(std::numeric_limits<int32_t>::max()));
-          return static_cast<int32_t>(i);
-        }
-      }
-      return -1;
-    }
-  }
-
   void VertexConverter::GenericConvert(void* const pDst, const std::size_t cbDst, VertexDeclarationSpan dstVertexDeclaration, const void* const pSrc,
                                        const std::size_t cbSrc, VertexDeclarationSpan srcVertexDeclaration, const std::size_t srcVertexCount,
                                        const void* const pDstDefaultValues, const uint32_t cbDstDefaultValues)
@@ -87,36 +66,8 @@ namespace Fsl
     }
 
 
-    for (std::size_t i = 0; i < dstVertexDeclaration.Count(); ++i)
-    {
-      const VertexElement dstElement = dstVertexDeclaration.At(i);
-      const int32_t srcIndex = IndexOf(srcVertexDeclaration, dstElement.Usage, dstElement.UsageIndex);
-      if (srcIndex >= 0)
-      {
-        const VertexElement srcElement = srcVertexDeclaration.At(static_cast<uint32_t>(srcIndex));
-
-        // We found it so now we just need to look at the format
-        if (dstElement.Format == srcElement.Format)
-        {
-          // Straight forward copy
-          const auto cbFormatEntry = VertexElementFormatUtil::GetBytesPerElement(dstElement.Format);
-          VertexConverter::GenericElementCopy(pDst, cbDst, dstVertexStride, dstElement.Offset, pSrc, cbSrc, srcVertexStride, srcElement.Offset,
-                                              cbFormatEntry, srcVertexCount);
-        }
-        else
-        {
-          // We need to do a format conversion
-          throw NotImplementedException("Element format conversion not implemented");
-        }
-      }
-      else
-      {
-        // Not found, so assign the default value
-        const auto cbFormatEntry = VertexElementFormatUtil::GetBytesPerElement(dstElement.Format);
-        VertexConverter::GenericElementFill(pDst, cbDst, dstVertexStride, dstElement.Offset, pDstDefaultValues, cbDstDefaultValues, dstElement.Offset,
-                                            cbFormatEntry, srcVertexCount);
-      }
-    }
+    const VertexConversionPlan plan(dstVertexDeclaration, srcVertexDeclaration, pDstDefaultValues, cbDstDefaultValues);
+    plan.Apply(pDst, cbDst, pSrc, cbSrc, srcVertexCount);
   }
 
 
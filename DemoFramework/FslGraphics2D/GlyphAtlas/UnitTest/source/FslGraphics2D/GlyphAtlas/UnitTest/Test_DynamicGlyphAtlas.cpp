@@ -0,0 +1,356 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Math/Pixel/LogPxAreaRectangleF.hpp>
+#include <FslBase/Log/Math/Pixel/LogPxSize2D.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/UnitTest/Helper/Common.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <FslGraphics2D/GlyphAtlas/DynamicGlyphAtlas.hpp>
+#include <FslGraphics2D/GlyphAtlas/IGlyphRasterizer.hpp>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestDynamicGlyphAtlas = TestFixtureFslGraphics;
+
+  //! Every glyph is a 8x10 image filled with the lower byte of its code point, except space which has no image.
+  class TestGlyphRasterizer final : public IGlyphRasterizer
+  {
+  public:
+    static constexpr uint32_t GlyphWidth = 8;
+    static constexpr uint32_t GlyphHeight = 10;
+    static constexpr int32_t XAdvance = 9;
+    static constexpr int32_t BaseLine = 12;
+
+    mutable std::atomic<uint32_t> RasterizeCount{0};
+    //! Rasterize throws for this code point (zero disables it)
+    uint32_t FailingCodePoint{0};
+
+    BitmapFontType GetFontType() const final
+    {
+      return BitmapFontType::Bitmap;
+    }
+
+    uint16_t GetSdfSpread() const final
+    {
+      return 0;
+    }
+
+    GlyphAtlasFontMetrics GetFontMetrics() const final
+    {
+      return {PxSize1D::Create(16), PxSize1D::Create(BaseLine)};
+    }
+
+    GlyphAtlasGlyphMetrics GetGlyphMetrics(const uint32_t codePoint) const final
+    {
+      if (codePoint == ' ')
+      {
+        return {PxPoint2(), PxExtent2D(), PxValue(XAdvance)};
+      }
+      return {PxPoint2::Create(1, BaseLine - static_cast<int32_t>(GlyphHeight)), PxExtent2D::Create(GlyphWidth, GlyphHeight), PxValue(XAdvance)};
+    }
+
+    PxValue GetKerning(const uint32_t first, const uint32_t second) const final
+    {
+      return PxValue(first == 'A' && second == 'V' ? -2 : 0);
+    }
+
+    RasterizedGlyph Rasterize(const uint32_t codePoint) const final
+    {
+      ++RasterizeCount;
+      if (codePoint == FailingCodePoint)
+      {
+        throw std::runtime_error("rasterize failed");
+      }
+      const GlyphAtlasGlyphMetrics metrics = GetGlyphMetrics(codePoint);
+      const std::size_t pixelCount = static_cast<std::size_t>(metrics.ExtentPx.Width.Value) * metrics.ExtentPx.Height.Value;
+      return {codePoint, metrics, std::vector<uint8_t>(pixelCount, static_cast<uint8_t>(codePoint & 0xFF))};
+    }
+  };
+
+  //! Room for exactly four glyphs per page (including the padding)
+  DynamicGlyphAtlasConfig CreateSmallConfig(const uint32_t maxPageCount)
+  {
+    return {PxExtent2D::Create((TestGlyphRasterizer::GlyphWidth + 1) * 2, (TestGlyphRasterizer::GlyphHeight + 1) * 2), maxPageCount, 1};
+  }
+
+  uint8_t GetPixel(const ReadOnlyRawBitmap& bitmap, const uint32_t x, const uint32_t y)
+  {
+    return static_cast<const uint8_t*>(bitmap.Content())[(y * bitmap.Stride()) + x];
+  }
+}
+
+
+TEST(TestDynamicGlyphAtlas, Construct)
+{
+  auto rasterizer = std::make_shared<TestGlyphRasterizer>();
+  DynamicGlyphAtlas atlas(SpriteNativeAreaCalc(false), rasterizer, DynamicGlyphAtlasConfig());
+
+  EXPECT_EQ(BitmapFontType::Bitmap, atlas.GetFontType());
+  EXPECT_EQ(rasterizer->GetFontMetrics(), atlas.GetFontMetrics());
+  EXPECT_EQ(0u, atlas.GetPageCount());
+  EXPECT_EQ(DynamicGlyphAtlasStats(), atlas.GetStats());
+}
+
+
+TEST(TestDynamicGlyphAtlas, Construct_Invalid)
+{
+  auto rasterizer = std::make_shared<TestGlyphRasterizer>();
+  EXPECT_THROW(DynamicGlyphAtlas(SpriteNativeAreaCalc(false), {}, DynamicGlyphAtlasConfig()), std::invalid_argument);
+  EXPECT_THROW(DynamicGlyphAtlas(SpriteNativeAreaCalc(false), rasterizer, DynamicGlyphAtlasConfig(PxExtent2D(), 1)), std::invalid_argument);
+  EXPECT_THROW(DynamicGlyphAtlas(SpriteNativeAreaCalc(false), rasterizer, DynamicGlyphAtlasConfig(PxExtent2D::Create(64, 64), 0)),
+               std::invalid_argument);
+}
+
+
+TEST(TestDynamicGlyphAtlas, MeasureString)
+{
+  DynamicGlyphAtlas atlas(SpriteNativeAreaCalc(false), std::make_shared<TestGlyphRasterizer>(), DynamicGlyphAtlasConfig());
+
+  EXPECT_EQ(PxSize2D(), atlas.MeasureString(""));
+  // 'A' + kerning -2 + 'V': the last glyph starts at 9 - 2 = 7 and ends at 7 + 1 + 8
+  EXPECT_EQ(PxSize2D::Create(16, 12), atlas.MeasureString("AV"));
+  // The trailing space has no image
+  EXPECT_EQ(PxSize2D::Create(9, 12), atlas.MeasureString("A "));
+  // Measuring does not request the glyph images
+  EXPECT_EQ(0u, atlas.GetStats().PendingGlyphCount);
+}
+
+
+TEST(TestDynamicGlyphAtlas, ExtractRenderRules_RequestsMissingGlyphs)
+{
+  auto rasterizer = std::make_shared<TestGlyphRasterizer>();
+  DynamicGlyphAtlas atlas(SpriteNativeAreaCalc(false), rasterizer, DynamicGlyphAtlasConfig());
+  std::vector<DynamicGlyphAtlasGlyphPosition> dst(3);
+
+  EXPECT_FALSE(atlas.ExtractRenderRules(SpanUtil::AsSpan(dst), "AVA"));
+  EXPECT_EQ(PxAreaRectangleF(), dst[0].DstRectPxf);
+  EXPECT_EQ(2u, atlas.GetStats().PendingGlyphCount);
+  EXPECT_EQ(0u, rasterizer->RasterizeCount.load());
+
+  atlas.Update();
+
+  EXPECT_EQ(2u, rasterizer->RasterizeCount.load());
+  EXPECT_EQ(0u, atlas.GetStats().PendingGlyphCount);
+  EXPECT_EQ(2u, atlas.GetStats().ResidentGlyphCount);
+  EXPECT_EQ(1u, atlas.GetPageCount());
+
+  EXPECT_TRUE(atlas.ExtractRenderRules(SpanUtil::AsSpan(dst), "AVA"));
+  EXPECT_EQ(PxAreaRectangleF::Create(1, 2, 8, 10), dst[0].DstRectPxf);
+  EXPECT_EQ(PxAreaRectangleF::Create(1 + 7, 2, 8, 10), dst[1].DstRectPxf);
+  EXPECT_EQ(PxAreaRectangleF::Create(1 + 7 + 9, 2, 8, 10), dst[2].DstRectPxf);
+  EXPECT_EQ(0u, dst[0].PageIndex);
+  EXPECT_NE(dst[0].TextureArea, dst[1].TextureArea);
+  EXPECT_EQ(dst[0].TextureArea, dst[2].TextureArea);
+  // The glyphs are only rasterized once
+  EXPECT_EQ(2u, rasterizer->RasterizeCount.load());
+}
+
+
+TEST(TestDynamicGlyphAtlas, ExtractRenderRules_DstTooSmall)
+{
+  DynamicGlyphAtlas atlas(SpriteNativeAreaCalc(false), std::make_shared<TestGlyphRasterizer>(), DynamicGlyphAtlasConfig());
+  std::vector<DynamicGlyphAtlasGlyphPosition> dst(2);
+
+  EXPECT_THROW(static_cast<void>(atlas.ExtractRenderRules(SpanUtil::AsSpan(dst), "abc")), std::invalid_argument);
+}
+
+
+TEST(TestDynamicGlyphAtlas, ExtractRenderRules_Utf8)
+{
+  DynamicGlyphAtlas atlas(SpriteNativeAreaCalc(false), std::make_shared<TestGlyphRasterizer>(), DynamicGlyphAtlasConfig());
+  // U+4E2D (3 bytes) and U+1F600 (4 bytes)
+  const StringViewLite strView("\xE4\xB8\xAD\xF0\x9F\x98\x80");
+  std::vector<DynamicGlyphAtlasGlyphPosition> dst(strView.size());
+
+  EXPECT_FALSE(atlas.RequestGlyphs(strView));
+  atlas.Update();
+
+  EXPECT_TRUE(atlas.ExtractRenderRules(SpanUtil::AsSpan(dst), strView));
+  EXPECT_EQ(PxAreaRectangleF::Create(1, 2, 8, 10), dst[0].DstRectPxf);
+  EXPECT_EQ(PxAreaRectangleF::Create(1 + 9, 2, 8, 10), dst[1].DstRectPxf);
+  // The remaining entries are padding
+  for (std::size_t i = 2; i < dst.size(); ++i)
+  {
+    EXPECT_EQ(PxAreaRectangleF(), dst[i].DstRectPxf);
+  }
+  EXPECT_EQ(2u, atlas.GetStats().ResidentGlyphCount);
+}
+
+
+TEST(TestDynamicGlyphAtlas, Update_CopiesGlyphImageToPage)
+{
+  DynamicGlyphAtlas atlas(SpriteNativeAreaCalc(false), std::make_shared<TestGlyphRasterizer>(), CreateSmallConfig(1));
+
+  EXPECT_FALSE(atlas.RequestGlyphs("A"));
+  atlas.Update();
+
+  ASSERT_EQ(1u, atlas.GetPageCount());
+  const ReadOnlyRawBitmap page = atlas.GetPageBitmap(0);
+  EXPECT_EQ(PixelFormat::R8_UNORM, page.GetPixelFormat());
+  EXPECT_EQ(static_cast<uint8_t>('A'), GetPixel(page, 0, 0));
+  EXPECT_EQ(static_cast<uint8_t>('A'), GetPixel(page, TestGlyphRasterizer::GlyphWidth - 1, TestGlyphRasterizer::GlyphHeight - 1));
+  // Padding
+  EXPECT_EQ(0u, GetPixel(page, TestGlyphRasterizer::GlyphWidth, 0));
+  EXPECT_EQ(0u, GetPixel(page, 0, TestGlyphRasterizer::GlyphHeight));
+}
+
+
+TEST(TestDynamicGlyphAtlas, Update_PageVersion)
+{
+  DynamicGlyphAtlas atlas(SpriteNativeAreaCalc(false), std::make_shared<TestGlyphRasterizer>(), CreateSmallConfig(1));
+
+  EXPECT_FALSE(atlas.RequestGlyphs("A"));
+  atlas.Update();
+  const uint32_t version = atlas.GetPageVersion(0);
+
+  atlas.Update();
+  EXPECT_EQ(version, atlas.GetPageVersion(0));
+
+  EXPECT_FALSE(atlas.RequestGlyphs("B"));
+  atlas.Update();
+  EXPECT_NE(version, atlas.GetPageVersion(0));
+}
+
+
+TEST(TestDynamicGlyphAtlas, Update_GlyphWithoutImage)
+{
+  DynamicGlyphAtlas atlas(SpriteNativeAreaCalc(false), std::make_shared<TestGlyphRasterizer>(), CreateSmallConfig(1));
+
+  EXPECT_FALSE(atlas.RequestGlyphs(" "));
+  atlas.Update();
+
+  EXPECT_TRUE(atlas.RequestGlyphs(" "));
+  EXPECT_EQ(0u, atlas.GetPageCount());
+}
+
+
+TEST(TestDynamicGlyphAtlas, Update_RasterizeFailed)
+{
+  auto rasterizer = std::make_shared<TestGlyphRasterizer>();
+  rasterizer->FailingCodePoint = 'B';
+  DynamicGlyphAtlas atlas(SpriteNativeAreaCalc(false), rasterizer, CreateSmallConfig(1));
+
+  EXPECT_FALSE(atlas.RequestGlyphs("AB"));
+  EXPECT_NO_THROW(atlas.Update());
+  EXPECT_EQ(2u, rasterizer->RasterizeCount.load());
+  EXPECT_EQ(0u, atlas.GetStats().PendingGlyphCount);
+  EXPECT_EQ(2u, atlas.GetStats().ResidentGlyphCount);
+
+  // The failed glyph is resident without an image so it is not rasterized again
+  EXPECT_TRUE(atlas.RequestGlyphs("AB"));
+  atlas.Update();
+  EXPECT_EQ(2u, rasterizer->RasterizeCount.load());
+  EXPECT_EQ(1u, atlas.GetPageCount());
+}
+
+
+TEST(TestDynamicGlyphAtlas, Update_AddsPages)
+{
+  DynamicGlyphAtlas atlas(SpriteNativeAreaCalc(false), std::make_shared<TestGlyphRasterizer>(), CreateSmallConfig(3));
+
+  EXPECT_FALSE(atlas.RequestGlyphs("ABCDEFGHI"));
+  atlas.Update();
+
+  EXPECT_EQ(3u, atlas.GetPageCount());
+  EXPECT_EQ(9u, atlas.GetStats().ResidentGlyphCount);
+  EXPECT_EQ(0u, atlas.GetStats().EvictedPageCount);
+  EXPECT_TRUE(atlas.RequestGlyphs("ABCDEFGHI"));
+}
+
+
+TEST(TestDynamicGlyphAtlas, Update_EvictsLeastRecentlyUsedPage)
+{
+  DynamicGlyphAtlas atlas(SpriteNativeAreaCalc(false), std::make_shared<TestGlyphRasterizer>(), CreateSmallConfig(2));
+
+  // Fill both pages
+  EXPECT_FALSE(atlas.RequestGlyphs("ABCD"));
+  atlas.Update();
+  EXPECT_FALSE(atlas.RequestGlyphs("EFGH"));
+  atlas.Update();
+  EXPECT_EQ(2u, atlas.GetPageCount());
+
+  // Use the first page so the second page becomes the least recently used one
+  EXPECT_TRUE(atlas.RequestGlyphs("A"));
+  EXPECT_FALSE(atlas.RequestGlyphs("I"));
+  atlas.Update();
+
+  const DynamicGlyphAtlasStats stats = atlas.GetStats();
+  EXPECT_EQ(1u, stats.EvictedPageCount);
+  EXPECT_EQ(4u, stats.EvictedGlyphCount);
+  EXPECT_EQ(5u, stats.ResidentGlyphCount);
+  EXPECT_TRUE(atlas.RequestGlyphs("ABCDI"));
+  // The evicted glyphs are requested again
+  EXPECT_FALSE(atlas.RequestGlyphs("E"));
+}
+
+
+TEST(TestDynamicGlyphAtlas, Update_PagesInUseAreNotEvicted)
+{
+  DynamicGlyphAtlas atlas(SpriteNativeAreaCalc(false), std::make_shared<TestGlyphRasterizer>(), CreateSmallConfig(1));
+
+  // Five glyphs are used in the same frame but only four fit
+  EXPECT_FALSE(atlas.RequestGlyphs("ABCDE"));
+  atlas.Update();
+  EXPECT_EQ(4u, atlas.GetStats().ResidentGlyphCount);
+  EXPECT_EQ(1u, atlas.GetStats().PendingGlyphCount);
+  EXPECT_EQ(0u, atlas.GetStats().EvictedPageCount);
+
+  // The next frame only uses the last glyph, so the page can be evicted
+  atlas.Update();
+  EXPECT_EQ(1u, atlas.GetStats().EvictedPageCount);
+  EXPECT_EQ(1u, atlas.GetStats().ResidentGlyphCount);
+  EXPECT_TRUE(atlas.RequestGlyphs("E"));
+}
+
+
+TEST(TestDynamicGlyphAtlas, JobSystem)
+{
+  auto rasterizer = std::make_shared<TestGlyphRasterizer>();
+  DynamicGlyphAtlas atlas(SpriteNativeAreaCalc(false), rasterizer, DynamicGlyphAtlasConfig(), std::make_shared<JobSystem>(2));
+
+  EXPECT_FALSE(atlas.RequestGlyphs("Hello world"));
+  EXPECT_EQ(8u, atlas.GetStats().PendingGlyphCount);
+
+  atlas.WaitForPendingGlyphs();
+
+  EXPECT_EQ(8u, rasterizer->RasterizeCount.load());
+  EXPECT_EQ(0u, atlas.GetStats().PendingGlyphCount);
+  EXPECT_EQ(8u, atlas.GetStats().ResidentGlyphCount);
+  EXPECT_TRUE(atlas.RequestGlyphs("Hello world"));
+}
@@ -0,0 +1,135 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Math/Pixel/LogPxRectangleU32.hpp>
+#include <FslGraphics/UnitTest/Helper/Common.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <FslGraphics2D/GlyphAtlas/SkylinePacker.hpp>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestSkylinePacker = TestFixtureFslGraphics;
+
+  bool Overlaps(const PxRectangleU32& lhs, const PxRectangleU32& rhs)
+  {
+    return lhs.RawLeft() < rhs.RawRight() && rhs.RawLeft() < lhs.RawRight() && lhs.RawTop() < rhs.RawBottom() && rhs.RawTop() < lhs.RawBottom();
+  }
+}
+
+
+TEST(TestSkylinePacker, Construct)
+{
+  SkylinePacker packer(PxExtent2D::Create(64, 32));
+
+  EXPECT_EQ(PxExtent2D::Create(64, 32), packer.GetExtent());
+  EXPECT_EQ(0u, packer.GetUsedArea());
+}
+
+
+TEST(TestSkylinePacker, TryAllocate_Empty)
+{
+  SkylinePacker packer(PxExtent2D::Create(64, 32));
+
+  EXPECT_FALSE(packer.TryAllocate(PxExtent2D::Create(0, 10)).has_value());
+  EXPECT_FALSE(packer.TryAllocate(PxExtent2D::Create(10, 0)).has_value());
+}
+
+
+TEST(TestSkylinePacker, TryAllocate_TooLarge)
+{
+  SkylinePacker packer(PxExtent2D::Create(64, 32));
+
+  EXPECT_FALSE(packer.TryAllocate(PxExtent2D::Create(65, 10)).has_value());
+  EXPECT_FALSE(packer.TryAllocate(PxExtent2D::Create(10, 33)).has_value());
+  EXPECT_TRUE(packer.TryAllocate(PxExtent2D::Create(64, 32)).has_value());
+}
+
+
+TEST(TestSkylinePacker, TryAllocate_BottomLeft)
+{
+  SkylinePacker packer(PxExtent2D::Create(64, 32));
+
+  EXPECT_EQ(PxRectangleU32::Create(0, 0, 16, 8), packer.TryAllocate(PxExtent2D::Create(16, 8)));
+  EXPECT_EQ(PxRectangleU32::Create(16, 0, 16, 4), packer.TryAllocate(PxExtent2D::Create(16, 4)));
+  // The lowest skyline level is to the right of the two first rectangles
+  EXPECT_EQ(PxRectangleU32::Create(32, 0, 32, 8), packer.TryAllocate(PxExtent2D::Create(32, 8)));
+  // The level above the second rectangle is the lowest one
+  EXPECT_EQ(PxRectangleU32::Create(16, 4, 16, 4), packer.TryAllocate(PxExtent2D::Create(16, 4)));
+  // The skyline is now flat at 8
+  EXPECT_EQ(PxRectangleU32::Create(0, 8, 64, 8), packer.TryAllocate(PxExtent2D::Create(64, 8)));
+  EXPECT_EQ(static_cast<uint64_t>(16 * 8 + 16 * 4 + 32 * 8 + 16 * 4 + 64 * 8), packer.GetUsedArea());
+}
+
+
+TEST(TestSkylinePacker, TryAllocate_UntilFull)
+{
+  SkylinePacker packer(PxExtent2D::Create(64, 64));
+
+  std::vector<PxRectangleU32> rects;
+  while (true)
+  {
+    const auto rectPx = packer.TryAllocate(PxExtent2D::Create(7 + static_cast<uint32_t>(rects.size() % 5), 9));
+    if (!rectPx.has_value())
+    {
+      break;
+    }
+    rects.push_back(rectPx.value());
+  }
+
+  ASSERT_FALSE(rects.empty());
+  for (std::size_t i = 0; i < rects.size(); ++i)
+  {
+    EXPECT_LE(rects[i].RawRight(), 64u);
+    EXPECT_LE(rects[i].RawBottom(), 64u);
+    for (std::size_t j = i + 1; j < rects.size(); ++j)
+    {
+      EXPECT_FALSE(Overlaps(rects[i], rects[j]));
+    }
+  }
+  // The packer should be able to use most of the area
+  EXPECT_GE(packer.GetUsedArea(), static_cast<uint64_t>(64 * 64 * 3 / 4));
+}
+
+
+TEST(TestSkylinePacker, Clear)
+{
+  SkylinePacker packer(PxExtent2D::Create(64, 32));
+  EXPECT_TRUE(packer.TryAllocate(PxExtent2D::Create(64, 32)).has_value());
+  EXPECT_FALSE(packer.TryAllocate(PxExtent2D::Create(1, 1)).has_value());
+
+  packer.Clear();
+
+  EXPECT_EQ(0u, packer.GetUsedArea());
+  EXPECT_EQ(PxRectangleU32::Create(0, 0, 64, 32), packer.TryAllocate(PxExtent2D::Create(64, 32)));
+}
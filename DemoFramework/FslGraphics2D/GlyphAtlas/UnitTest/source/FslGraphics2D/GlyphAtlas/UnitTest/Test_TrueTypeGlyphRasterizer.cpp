@@ -0,0 +1,171 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/File.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Log/Math/Pixel/LogPxExtent2D.hpp>
+#include <FslBase/Log/Math/Pixel/LogPxPoint2.hpp>
+#include <FslGraphics/UnitTest/Helper/Common.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphicsContent.hpp>
+#include <FslGraphics2D/GlyphAtlas/TrueTypeGlyphRasterizer.hpp>
+#include <algorithm>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr IO::PathView FontPath("Font/Lato/Lato-Regular.ttf");
+    constexpr uint16_t FontSizePx = 32;
+    constexpr uint16_t SdfSpread = 4;
+    constexpr uint8_t SdfOnEdgeValue = 128;
+
+    // Lato-Regular: ascent 1974, descent -426, line gap 0 and 'A' has the box (10, 0)-(1353, 1433) and a advance of 1360 font units.
+    // At 32px the scale is 32 / 2400, which gives the values below (see stbtt_GetGlyphBitmapBox for the rounding)
+    constexpr int32_t LineSpacingPx = 32;
+    constexpr int32_t BaseLinePx = 26;
+    constexpr PxPoint2 GlyphAOffsetPx = PxPoint2::Create(0, BaseLinePx - 20);
+    constexpr PxExtent2D GlyphAExtentPx = PxExtent2D::Create(19, 20);
+    constexpr int32_t GlyphAXAdvancePx = 18;
+    // Space has no outline and a advance of 386 font units
+    constexpr int32_t SpaceXAdvancePx = 5;
+  }
+
+  class TestTrueTypeGlyphRasterizer : public TestFixtureFslGraphicsContent
+  {
+  protected:
+    std::vector<uint8_t> m_fontData;
+
+  public:
+    TestTrueTypeGlyphRasterizer()
+      : m_fontData(IO::File::ReadAllBytes(IO::Path::Combine(GetContentPath(), LocalConfig::FontPath)))
+    {
+    }
+  };
+
+  uint8_t GetPixel(const RasterizedGlyph& glyph, const uint32_t x, const uint32_t y)
+  {
+    return glyph.Pixels[(y * glyph.Metrics.ExtentPx.Width.Value) + x];
+  }
+}
+
+
+TEST_F(TestTrueTypeGlyphRasterizer, Construct_Invalid)
+{
+  EXPECT_THROW(TrueTypeGlyphRasterizer(std::vector<uint8_t>(), LocalConfig::FontSizePx), FormatException);
+  // Too small to contain the offset table
+  EXPECT_THROW(TrueTypeGlyphRasterizer(std::vector<uint8_t>(m_fontData.begin(), m_fontData.begin() + 4), LocalConfig::FontSizePx),
+               FormatException);
+  // The offset table is there, but the table records it references are not
+  EXPECT_THROW(TrueTypeGlyphRasterizer(std::vector<uint8_t>(m_fontData.begin(), m_fontData.begin() + 64), LocalConfig::FontSizePx),
+               FormatException);
+  // A collection header without room for the offset of the first font
+  EXPECT_THROW(TrueTypeGlyphRasterizer(std::vector<uint8_t>({'t', 't', 'c', 'f', 0, 1, 0, 0, 0, 0, 0, 1}), LocalConfig::FontSizePx), FormatException);
+  EXPECT_THROW(TrueTypeGlyphRasterizer(std::vector<uint8_t>(64, 0xFF), LocalConfig::FontSizePx), FormatException);
+  EXPECT_THROW(TrueTypeGlyphRasterizer(std::vector<uint8_t>(m_fontData), 0), std::invalid_argument);
+}
+
+
+TEST_F(TestTrueTypeGlyphRasterizer, FontMetrics)
+{
+  const TrueTypeGlyphRasterizer rasterizer(m_fontData, LocalConfig::FontSizePx);
+
+  EXPECT_EQ(BitmapFontType::Bitmap, rasterizer.GetFontType());
+  EXPECT_EQ(0u, rasterizer.GetSdfSpread());
+  const GlyphAtlasFontMetrics fontMetrics = rasterizer.GetFontMetrics();
+  EXPECT_EQ(LocalConfig::LineSpacingPx, fontMetrics.LineSpacingPx.RawValue());
+  EXPECT_EQ(LocalConfig::BaseLinePx, fontMetrics.BaseLinePx.RawValue());
+}
+
+
+TEST_F(TestTrueTypeGlyphRasterizer, GlyphMetrics)
+{
+  const TrueTypeGlyphRasterizer rasterizer(m_fontData, LocalConfig::FontSizePx);
+
+  const GlyphAtlasGlyphMetrics metricsA = rasterizer.GetGlyphMetrics('A');
+  EXPECT_EQ(LocalConfig::GlyphAOffsetPx, metricsA.OffsetPx);
+  EXPECT_EQ(LocalConfig::GlyphAExtentPx, metricsA.ExtentPx);
+  EXPECT_EQ(LocalConfig::GlyphAXAdvancePx, metricsA.XAdvancePx.Value);
+
+  const GlyphAtlasGlyphMetrics metricsSpace = rasterizer.GetGlyphMetrics(' ');
+  EXPECT_EQ(PxExtent2D(), metricsSpace.ExtentPx);
+  EXPECT_EQ(LocalConfig::SpaceXAdvancePx, metricsSpace.XAdvancePx.Value);
+}
+
+
+TEST_F(TestTrueTypeGlyphRasterizer, Rasterize_Coverage)
+{
+  const TrueTypeGlyphRasterizer rasterizer(m_fontData, LocalConfig::FontSizePx);
+
+  const RasterizedGlyph glyph = rasterizer.Rasterize('A');
+  EXPECT_EQ(static_cast<uint32_t>('A'), glyph.CodePoint);
+  EXPECT_EQ(LocalConfig::GlyphAExtentPx, glyph.Metrics.ExtentPx);
+  ASSERT_EQ(LocalConfig::GlyphAExtentPx.Width.Value * LocalConfig::GlyphAExtentPx.Height.Value, glyph.Pixels.size());
+
+  // The top corners of a 'A' are empty while the strokes and the bar are at least two pixels wide, so some pixels are fully covered
+  EXPECT_EQ(0u, GetPixel(glyph, 0, 0));
+  EXPECT_EQ(0u, GetPixel(glyph, glyph.Metrics.ExtentPx.Width.Value - 1u, 0));
+  EXPECT_EQ(255u, *std::max_element(glyph.Pixels.begin(), glyph.Pixels.end()));
+
+  const RasterizedGlyph space = rasterizer.Rasterize(' ');
+  EXPECT_TRUE(space.Pixels.empty());
+  EXPECT_EQ(LocalConfig::SpaceXAdvancePx, space.Metrics.XAdvancePx.Value);
+}
+
+
+TEST_F(TestTrueTypeGlyphRasterizer, Rasterize_Sdf)
+{
+  const TrueTypeGlyphRasterizer rasterizer(m_fontData, LocalConfig::FontSizePx, BitmapFontType::SDF, LocalConfig::SdfSpread);
+  EXPECT_EQ(BitmapFontType::SDF, rasterizer.GetFontType());
+  EXPECT_EQ(LocalConfig::SdfSpread, rasterizer.GetSdfSpread());
+
+  // The SDF image is padded with the spread on all sides
+  const RasterizedGlyph glyph = rasterizer.Rasterize('A');
+  const auto spread = static_cast<int32_t>(LocalConfig::SdfSpread);
+  EXPECT_EQ(PxPoint2::Create(LocalConfig::GlyphAOffsetPx.X.Value - spread, LocalConfig::GlyphAOffsetPx.Y.Value - spread), glyph.Metrics.OffsetPx);
+  EXPECT_EQ(PxExtent2D::Create(LocalConfig::GlyphAExtentPx.Width.Value + (2u * LocalConfig::SdfSpread),
+                               LocalConfig::GlyphAExtentPx.Height.Value + (2u * LocalConfig::SdfSpread)),
+            glyph.Metrics.ExtentPx);
+  EXPECT_EQ(LocalConfig::GlyphAXAdvancePx, glyph.Metrics.XAdvancePx.Value);
+  ASSERT_EQ(glyph.Metrics.ExtentPx.Width.Value * glyph.Metrics.ExtentPx.Height.Value, glyph.Pixels.size());
+
+  // The padding is outside the glyph so it is below the edge value, while the inside of the strokes is above it
+  const uint32_t lastX = glyph.Metrics.ExtentPx.Width.Value - 1u;
+  const uint32_t lastY = glyph.Metrics.ExtentPx.Height.Value - 1u;
+  EXPECT_LT(GetPixel(glyph, 0, 0), LocalConfig::SdfOnEdgeValue);
+  EXPECT_LT(GetPixel(glyph, lastX, 0), LocalConfig::SdfOnEdgeValue);
+  EXPECT_LT(GetPixel(glyph, 0, lastY), LocalConfig::SdfOnEdgeValue);
+  EXPECT_LT(GetPixel(glyph, lastX, lastY), LocalConfig::SdfOnEdgeValue);
+  EXPECT_GT(*std::max_element(glyph.Pixels.begin(), glyph.Pixels.end()), LocalConfig::SdfOnEdgeValue);
+}
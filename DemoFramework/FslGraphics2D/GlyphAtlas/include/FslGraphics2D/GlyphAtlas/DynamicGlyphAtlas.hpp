@@ -0,0 +1,222 @@
+#ifndef FSLGRAPHICS2D_GLYPHATLAS_DYNAMICGLYPHATLAS_HPP
+#define FSLGRAPHICS2D_GLYPHATLAS_DYNAMICGLYPHATLAS_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxExtent2D.hpp>
+#include <FslBase/Math/Pixel/PxRectangleU32.hpp>
+#include <FslBase/Math/Pixel/PxSize2D.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <FslBase/System/Threading/JobHandle.hpp>
+#include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
+#include <FslGraphics/Font/BitmapFontType.hpp>
+#include <FslGraphics/NativeTextureArea.hpp>
+#include <FslGraphics/Sprite/SpriteNativeAreaCalc.hpp>
+#include <FslGraphics2D/GlyphAtlas/DynamicGlyphAtlasConfig.hpp>
+#include <FslGraphics2D/GlyphAtlas/DynamicGlyphAtlasGlyphPosition.hpp>
+#include <FslGraphics2D/GlyphAtlas/DynamicGlyphAtlasStats.hpp>
+#include <FslGraphics2D/GlyphAtlas/GlyphAtlasFontMetrics.hpp>
+#include <FslGraphics2D/GlyphAtlas/GlyphAtlasGlyphMetrics.hpp>
+#include <FslGraphics2D/GlyphAtlas/RasterizedGlyph.hpp>
+#include <FslGraphics2D/GlyphAtlas/SkylinePacker.hpp>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Fsl
+{
+  class IGlyphRasterizer;
+  class JobSystem;
+
+  //! @brief A glyph atlas that rasterizes glyphs the first time they are used instead of relying on a pre-baked font texture.
+  //!        This makes it possible to render large character sets (like CJK) without baking a gigantic atlas.
+  //!
+  //!        Missing glyphs are requested by RequestGlyphs and ExtractRenderRules and rasterized on the job system (MeasureString only
+  //!        needs the glyph metrics so it does not request them).
+  //!        Update adds the finished glyphs to the atlas pages (packed with a skyline packer). New pages are added as needed
+  //!        until MaxPageCount is reached, after that the least recently used page is cleared to make room for the new glyphs.
+  //!        Upload a page to its texture when its version changes (the pages are R8_UNORM bitmaps).
+  //! @note  The atlas must only be accessed from one thread, only the rasterization runs on the worker threads.
+  class DynamicGlyphAtlas
+  {
+  public:
+    static constexpr uint32_t InvalidPageIndex = 0xFFFFFFFF;
+
+  private:
+    enum class GlyphState : uint8_t
+    {
+      NotResident,
+      //! The glyph has been requested, but it has not been added to a page yet
+      Pending,
+      Resident
+    };
+
+    struct GlyphRecord
+    {
+      GlyphAtlasGlyphMetrics Metrics;
+      GlyphState State{GlyphState::NotResident};
+      //! InvalidPageIndex for resident glyphs without a image (like space)
+      uint32_t PageIndex{InvalidPageIndex};
+      NativeTextureArea TextureArea;
+
+      GlyphRecord() = default;
+      explicit GlyphRecord(const GlyphAtlasGlyphMetrics& metrics)
+        : Metrics(metrics)
+      {
+      }
+    };
+
+    struct Page
+    {
+      SkylinePacker Packer;
+      //! R8_UNORM pixels with a stride of the page width
+      std::vector<uint8_t> Pixels;
+      //! The code points of the glyphs stored on this page
+      std::vector<uint32_t> CodePoints;
+      uint64_t LastUsedFrame{0};
+      uint32_t Version{0};
+
+      explicit Page(const PxExtent2D extentPx);
+    };
+
+    //! Shared with the rasterization jobs so they can complete after the atlas has been destroyed
+    struct CompletedQueue
+    {
+      std::mutex Lock;
+      std::vector<RasterizedGlyph> Glyphs;
+    };
+
+    SpriteNativeAreaCalc m_spriteNativeAreaCalc;
+    std::shared_ptr<IGlyphRasterizer> m_rasterizer;
+    DynamicGlyphAtlasConfig m_config;
+    std::shared_ptr<JobSystem> m_jobSystem;
+    BitmapFontType m_fontType;
+    uint16_t m_sdfSpread;
+    GlyphAtlasFontMetrics m_fontMetrics;
+
+    std::unordered_map<uint32_t, GlyphRecord> m_glyphs;
+    std::vector<Page> m_pages;
+    //! The glyphs that need to be scheduled for rasterization
+    std::vector<uint32_t> m_requested;
+    std::vector<JobHandle> m_jobs;
+    std::shared_ptr<CompletedQueue> m_completedQueue;
+    //! The rasterized glyphs that have not been added to a page yet
+    std::vector<RasterizedGlyph> m_completed;
+    uint64_t m_frame{1};
+    DynamicGlyphAtlasStats m_stats;
+
+  public:
+    DynamicGlyphAtlas(const DynamicGlyphAtlas&) = delete;
+    DynamicGlyphAtlas& operator=(const DynamicGlyphAtlas&) = delete;
+
+    //! @param spriteNativeAreaCalc used to calculate the native texture areas of the glyphs on the atlas pages.
+    //! @param rasterizer the rasterizer used to create the glyph images.
+    //! @param config the atlas configuration.
+    //! @param jobSystem the job system that the glyphs are rasterized on, if this is null the glyphs are rasterized by Update.
+    DynamicGlyphAtlas(const SpriteNativeAreaCalc& spriteNativeAreaCalc, std::shared_ptr<IGlyphRasterizer> rasterizer,
+                      const DynamicGlyphAtlasConfig& config, std::shared_ptr<JobSystem> jobSystem = {});
+    ~DynamicGlyphAtlas();
+
+    BitmapFontType GetFontType() const noexcept
+    {
+      return m_fontType;
+    }
+
+    //! @brief The spread (in pixels) of the signed distance field glyphs (use it for the BatchSdfRenderConfig)
+    uint16_t GetSdfSpread() const noexcept
+    {
+      return m_sdfSpread;
+    }
+
+    const GlyphAtlasFontMetrics& GetFontMetrics() const noexcept
+    {
+      return m_fontMetrics;
+    }
+
+    const DynamicGlyphAtlasConfig& GetConfig() const noexcept
+    {
+      return m_config;
+    }
+
+    const DynamicGlyphAtlasStats& GetStats() const noexcept
+    {
+      return m_stats;
+    }
+
+    uint32_t GetPageCount() const noexcept
+    {
+      return static_cast<uint32_t>(m_pages.size());
+    }
+
+    //! @brief Get the content of a page
+    ReadOnlyRawBitmap GetPageBitmap(const uint32_t pageIndex) const;
+
+    //! @brief Get the version of a page, it changes every time the content of the page is modified
+    uint32_t GetPageVersion(const uint32_t pageIndex) const;
+
+    //! @brief Get the metrics of a glyph (this does not request the glyph image)
+    const GlyphAtlasGlyphMetrics& GetGlyphMetrics(const uint32_t codePoint);
+
+    //! @brief Request all glyphs used by the UTF8 string
+    //! @return true if all the glyphs are stored in the atlas
+    bool RequestGlyphs(const StringViewLite& strView);
+
+    //! @brief Measure the UTF8 string size in pixels (this does not request the glyph images)
+    PxSize2D MeasureString(const StringViewLite& strView);
+
+    //! @brief Extract render rules for the supplied UTF8 string.
+    //! @param dst a span that can contain at least strView.size() entries, strView.size() entries are always written.
+    //! @return true if all glyphs were stored in the atlas. If false the missing glyphs were requested and written as empty rectangles,
+    //!         so the string should be laid out again once they have been added by Update.
+    [[nodiscard]] bool ExtractRenderRules(Span<DynamicGlyphAtlasGlyphPosition> dst, const StringViewLite& strView);
+
+    //! @brief Schedule the requested glyphs for rasterization and add the rasterized glyphs to the atlas pages.
+    //!        Call this once per frame before drawing.
+    void Update();
+
+    //! @brief Wait for all requested glyphs to be rasterized and add them to the atlas pages (useful during loading)
+    void WaitForPendingGlyphs();
+
+  private:
+    GlyphRecord& AcquireGlyphRecord(const uint32_t codePoint);
+    bool MarkAsUsed(const uint32_t codePoint, GlyphRecord& rRecord);
+    void ScheduleRequestedGlyphs();
+    void CollectCompletedGlyphs();
+    bool TryAddGlyph(const RasterizedGlyph& glyph);
+    uint32_t TryAllocate(const PxExtent2D sizePx, PxRectangleU32& rRectPx);
+    void EvictPage(const uint32_t pageIndex);
+  };
+}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef FSLGRAPHICS2D_GLYPHATLAS_DYNAMICGLYPHATLASCONFIG_HPP
+#define FSLGRAPHICS2D_GLYPHATLAS_DYNAMICGLYPHATLASCONFIG_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxExtent2D.hpp>
+
+namespace Fsl
+{
+  struct DynamicGlyphAtlasConfig
+  {
+    //! The size of each atlas page
+    PxExtent2D PageExtentPx{PxExtent2D::Create(1024, 1024)};
+    //! The maximum number of atlas pages, once they are all full the least recently used page is evicted
+    uint32_t MaxPageCount{4};
+    //! The number of empty pixels added to the right and bottom of each glyph to prevent bleeding between glyphs when sampling
+    uint16_t GlyphPaddingPx{1};
+
+    constexpr DynamicGlyphAtlasConfig() noexcept = default;
+    constexpr DynamicGlyphAtlasConfig(const PxExtent2D pageExtentPx, const uint32_t maxPageCount, const uint16_t glyphPaddingPx = 1) noexcept
+      : PageExtentPx(pageExtentPx)
+      , MaxPageCount(maxPageCount)
+      , GlyphPaddingPx(glyphPaddingPx)
+    {
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef FSLGRAPHICS2D_GLYPHATLAS_GLYPHATLASGLYPHMETRICS_HPP
+#define FSLGRAPHICS2D_GLYPHATLAS_GLYPHATLASGLYPHMETRICS_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Pixel/PxExtent2D.hpp>
+#include <FslBase/Math/Pixel/PxPoint2.hpp>
+#include <FslBase/Math/Pixel/PxValue.hpp>
+
+namespace Fsl
+{
+  struct GlyphAtlasGlyphMetrics
+  {
+    //! The offset from the current position (at the top of the line) to the top left corner of the glyph image
+    PxPoint2 OffsetPx;
+    //! The size of the glyph image (zero for glyphs like space)
+    PxExtent2D ExtentPx;
+    //! How much the current position should be advanced after drawing the glyph
+    PxValue XAdvancePx;
+
+    constexpr GlyphAtlasGlyphMetrics() noexcept = default;
+    constexpr GlyphAtlasGlyphMetrics(const PxPoint2 offsetPx, const PxExtent2D extentPx, const PxValue xAdvancePx) noexcept
+      : OffsetPx(offsetPx)
+      , ExtentPx(extentPx)
+      , XAdvancePx(xAdvancePx)
+    {
+    }
+
+    constexpr bool operator==(const GlyphAtlasGlyphMetrics& rhs) const noexcept = default;
+  };
+}
+
+#endif
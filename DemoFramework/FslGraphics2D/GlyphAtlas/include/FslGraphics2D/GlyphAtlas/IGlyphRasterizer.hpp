@@ -0,0 +1,70 @@
+#ifndef FSLGRAPHICS2D_GLYPHATLAS_IGLYPHRASTERIZER_HPP
+#define FSLGRAPHICS2D_GLYPHATLAS_IGLYPHRASTERIZER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxValue.hpp>
+#include <FslGraphics/Font/BitmapFontType.hpp>
+#include <FslGraphics2D/GlyphAtlas/GlyphAtlasFontMetrics.hpp>
+#include <FslGraphics2D/GlyphAtlas/GlyphAtlasGlyphMetrics.hpp>
+#include <FslGraphics2D/GlyphAtlas/RasterizedGlyph.hpp>
+
+namespace Fsl
+{
+  //! @brief Creates glyph images on demand.
+  //! @note  All methods must be thread safe as glyphs are rasterized on worker threads.
+  class IGlyphRasterizer
+  {
+  public:
+    virtual ~IGlyphRasterizer() = default;
+
+    //! @brief Get the type of the images created by Rasterize
+    virtual BitmapFontType GetFontType() const = 0;
+
+    //! @brief The spread (in pixels) of the signed distance field images (zero if the font type is not SDF)
+    virtual uint16_t GetSdfSpread() const = 0;
+
+    virtual GlyphAtlasFontMetrics GetFontMetrics() const = 0;
+
+    //! @brief Get the metrics of a glyph, this is expected to be a lot cheaper than Rasterize.
+    //! @note  The metrics must match the ones returned by Rasterize for the same code point.
+    virtual GlyphAtlasGlyphMetrics GetGlyphMetrics(const uint32_t codePoint) const = 0;
+
+    //! @brief Get the kerning adjustment between two code points
+    virtual PxValue GetKerning(const uint32_t first, const uint32_t second) const = 0;
+
+    //! @brief Create the image of a glyph
+    virtual RasterizedGlyph Rasterize(const uint32_t codePoint) const = 0;
+  };
+}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef FSLGRAPHICS2D_GLYPHATLAS_RASTERIZEDGLYPH_HPP
+#define FSLGRAPHICS2D_GLYPHATLAS_RASTERIZEDGLYPH_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslGraphics2D/GlyphAtlas/GlyphAtlasGlyphMetrics.hpp>
+#include <utility>
+#include <vector>
+
+namespace Fsl
+{
+  struct RasterizedGlyph
+  {
+    uint32_t CodePoint{0};
+    GlyphAtlasGlyphMetrics Metrics;
+    //! The glyph image in R8_UNORM format with a stride of Metrics.ExtentPx.Width (coverage or signed distance depending on the font type)
+    std::vector<uint8_t> Pixels;
+
+    RasterizedGlyph() = default;
+    RasterizedGlyph(const uint32_t codePoint, const GlyphAtlasGlyphMetrics& metrics, std::vector<uint8_t> pixels)
+      : CodePoint(codePoint)
+      , Metrics(metrics)
+      , Pixels(std::move(pixels))
+    {
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef FSLGRAPHICS2D_GLYPHATLAS_SKYLINEPACKER_HPP
+#define FSLGRAPHICS2D_GLYPHATLAS_SKYLINEPACKER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxExtent2D.hpp>
+#include <FslBase/Math/Pixel/PxRectangleU32.hpp>
+#include <optional>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief A rectangle packer that tracks the top edge (skyline) of the allocated area.
+  //!        Rectangles are placed at the position that results in the lowest top edge (bottom left heuristic).
+  //!        Individual rectangles can not be freed, use Clear to reset the packer.
+  class SkylinePacker
+  {
+    struct Node
+    {
+      uint32_t X{0};
+      uint32_t Y{0};
+      uint32_t Width{0};
+
+      constexpr Node() noexcept = default;
+      constexpr Node(const uint32_t x, const uint32_t y, const uint32_t width) noexcept
+        : X(x)
+        , Y(y)
+        , Width(width)
+      {
+      }
+    };
+
+    PxExtent2D m_extentPx;
+    std::vector<Node> m_skyline;
+    uint64_t m_usedArea{0};
+
+  public:
+    explicit SkylinePacker(const PxExtent2D extentPx);
+
+    PxExtent2D GetExtent() const noexcept
+    {
+      return m_extentPx;
+    }
+
+    //! @brief Get the area covered by the allocated rectangles
+    uint64_t GetUsedArea() const noexcept
+    {
+      return m_usedArea;
+    }
+
+    //! @brief Remove all allocations
+    void Clear();
+
+    //! @brief Try to allocate a rectangle of the given size.
+    //! @return the allocated rectangle or nullopt if there was not enough space (a empty size always fails).
+    std::optional<PxRectangleU32> TryAllocate(const PxExtent2D sizePx);
+
+  private:
+    //! @return the y position a rectangle of the given size would be placed at if it starts at the given node
+    std::optional<uint32_t> TryFit(const std::size_t nodeIndex, const PxExtent2D sizePx) const noexcept;
+    void AddSkylineLevel(const std::size_t nodeIndex, const PxRectangleU32& rectPx);
+  };
+}
+
+#endif
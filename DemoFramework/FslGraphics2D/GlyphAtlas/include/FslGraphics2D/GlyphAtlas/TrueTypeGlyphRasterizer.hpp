@@ -0,0 +1,73 @@
+#ifndef FSLGRAPHICS2D_GLYPHATLAS_TRUETYPEGLYPHRASTERIZER_HPP
+#define FSLGRAPHICS2D_GLYPHATLAS_TRUETYPEGLYPHRASTERIZER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslGraphics2D/GlyphAtlas/IGlyphRasterizer.hpp>
+#include <memory>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief Rasterize the glyphs of a true type font using stb_truetype.
+  //!        The font type Bitmap creates anti aliased coverage images, SDF creates signed distance field images that can be rendered
+  //!        using a BatchSdfRenderConfig with the same spread.
+  class TrueTypeGlyphRasterizer final : public IGlyphRasterizer
+  {
+    struct FontRecord;
+
+    std::unique_ptr<FontRecord> m_font;
+
+  public:
+    static constexpr uint16_t DefaultSdfSpread = 4;
+
+    TrueTypeGlyphRasterizer(const TrueTypeGlyphRasterizer&) = delete;
+    TrueTypeGlyphRasterizer& operator=(const TrueTypeGlyphRasterizer&) = delete;
+
+    //! @param fontData the content of a ttf or otf file.
+    //! @param fontSizePx the height of the font in pixels.
+    //! @param fontType the type of glyph images to create.
+    //! @param sdfSpread the spread of the signed distance field in pixels (only used for BitmapFontType::SDF).
+    TrueTypeGlyphRasterizer(std::vector<uint8_t> fontData, const uint16_t fontSizePx, const BitmapFontType fontType = BitmapFontType::Bitmap,
+                            const uint16_t sdfSpread = DefaultSdfSpread);
+    ~TrueTypeGlyphRasterizer() final;
+
+    BitmapFontType GetFontType() const final;
+    uint16_t GetSdfSpread() const final;
+    GlyphAtlasFontMetrics GetFontMetrics() const final;
+    GlyphAtlasGlyphMetrics GetGlyphMetrics(const uint32_t codePoint) const final;
+    PxValue GetKerning(const uint32_t first, const uint32_t second) const final;
+    RasterizedGlyph Rasterize(const uint32_t codePoint) const final;
+  };
+}
+
+#endif
@@ -0,0 +1,487 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/PixelFormat.hpp>
+#include <FslGraphics2D/GlyphAtlas/DynamicGlyphAtlas.hpp>
+#include <FslGraphics2D/GlyphAtlas/IGlyphRasterizer.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace Fsl
+{
+  namespace
+  {
+    //! Decode the code points of a UTF8 string, invalid encodings are returned as code point zero
+    class Utf8CodePointReader
+    {
+      const uint8_t* m_pStr;
+      const uint8_t* const m_pStrEnd;
+
+    public:
+      explicit Utf8CodePointReader(const StringViewLite& strView) noexcept
+        : m_pStr(reinterpret_cast<const uint8_t*>(strView.data()))
+        , m_pStrEnd(m_pStr != nullptr ? m_pStr + strView.size() : nullptr)
+      {
+      }
+
+      bool IsEmpty() const noexcept
+      {
+        return m_pStr == m_pStrEnd;
+      }
+
+      uint32_t NextCodePoint() noexcept
+      {
+        assert(m_pStr < m_pStrEnd);
+        const uint32_t char0 = *m_pStr;
+        ++m_pStr;
+        if (char0 < 0x80)
+        {
+          return char0;
+        }
+        const auto remaining = static_cast<std::size_t>(m_pStrEnd - m_pStr);
+        if ((char0 & 0xE0) == 0xC0 && remaining >= 1u)
+        {
+          const uint32_t result = ((char0 & 0x1F) << 6) | (m_pStr[0] & 0x3F);
+          m_pStr += 1;
+          return result;
+        }
+        if ((char0 & 0xF0) == 0xE0 && remaining >= 2u)
+        {
+          const uint32_t result = ((char0 & 0x0F) << 12) | ((m_pStr[0] & 0x3F) << 6) | (m_pStr[1] & 0x3F);
+          m_pStr += 2;
+          return result;
+        }
+        if ((char0 & 0xF8) == 0xF0 && remaining >= 3u)
+        {
+          const uint32_t result = ((char0 & 0x07) << 18) | ((m_pStr[0] & 0x3F) << 12) | ((m_pStr[1] & 0x3F) << 6) | (m_pStr[2] & 0x3F);
+          m_pStr += 3;
+          return result;
+        }
+        return 0;
+      }
+    };
+
+    void PadResult(Span<DynamicGlyphAtlasGlyphPosition> dst, const std::size_t dstIndex, const std::size_t endDstIndex)
+    {
+      for (std::size_t i = dstIndex; i < endDstIndex; ++i)
+      {
+        dst[i] = {};
+      }
+    }
+
+    void CopyGlyphImage(std::vector<uint8_t>& rDstPixels, const uint32_t dstStride, const PxRectangleU32& dstRectPx, const RasterizedGlyph& glyph)
+    {
+      const uint32_t width = glyph.Metrics.ExtentPx.Width.Value;
+      const uint32_t height = glyph.Metrics.ExtentPx.Height.Value;
+      assert(width <= dstRectPx.Width.Value && height <= dstRectPx.Height.Value);
+      assert(glyph.Pixels.size() >= (static_cast<std::size_t>(width) * height));
+      for (uint32_t y = 0; y < height; ++y)
+      {
+        std::memcpy(rDstPixels.data() + ((static_cast<std::size_t>(dstRectPx.Y.Value) + y) * dstStride) + dstRectPx.X.Value,
+                    glyph.Pixels.data() + (static_cast<std::size_t>(y) * width), width);
+      }
+    }
+
+    //! Rasterize the glyph, a glyph that fails to rasterize is returned without an image so it is not requested again
+    RasterizedGlyph SafeRasterize(const IGlyphRasterizer& rasterizer, const uint32_t codePoint)
+    {
+      try
+      {
+        return rasterizer.Rasterize(codePoint);
+      }
+      catch (const std::exception& ex)
+      {
+        FSLLOG3_ERROR("Failed to rasterize glyph {}: {}", codePoint, ex.what());
+        return {codePoint, {}, {}};
+      }
+    }
+  }
+
+
+  DynamicGlyphAtlas::Page::Page(const PxExtent2D extentPx)
+    : Packer(extentPx)
+    , Pixels(static_cast<std::size_t>(extentPx.Width.Value) * extentPx.Height.Value)
+  {
+  }
+
+
+  DynamicGlyphAtlas::DynamicGlyphAtlas(const SpriteNativeAreaCalc& spriteNativeAreaCalc, std::shared_ptr<IGlyphRasterizer> rasterizer,
+                                       const DynamicGlyphAtlasConfig& config, std::shared_ptr<JobSystem> jobSystem)
+    : m_spriteNativeAreaCalc(spriteNativeAreaCalc)
+    , m_rasterizer(std::move(rasterizer))
+    , m_config(config)
+    , m_jobSystem(std::move(jobSystem))
+    , m_completedQueue(std::make_shared<CompletedQueue>())
+  {
+    if (!m_rasterizer)
+    {
+      throw std::invalid_argument("rasterizer can not be null");
+    }
+    if (config.PageExtentPx.Width.Value <= 0u || config.PageExtentPx.Height.Value <= 0u)
+    {
+      throw std::invalid_argument("PageExtentPx can not be empty");
+    }
+    if (config.MaxPageCount <= 0u)
+    {
+      throw std::invalid_argument("MaxPageCount must be at least one");
+    }
+    m_fontType = m_rasterizer->GetFontType();
+    m_sdfSpread = m_rasterizer->GetSdfSpread();
+    m_fontMetrics = m_rasterizer->GetFontMetrics();
+  }
+
+
+  // The rasterization jobs only reference the shared rasterizer and completed queue, so there is no need to wait for them
+  DynamicGlyphAtlas::~DynamicGlyphAtlas() = default;
+
+
+  ReadOnlyRawBitmap DynamicGlyphAtlas::GetPageBitmap(const uint32_t pageIndex) const
+  {
+    const Page& page = m_pages.at(pageIndex);
+    return ReadOnlyRawBitmap::Create(SpanUtil::AsReadOnlySpan(page.Pixels), m_config.PageExtentPx, PixelFormat::R8_UNORM, BitmapOrigin::UpperLeft);
+  }
+
+
+  uint32_t DynamicGlyphAtlas::GetPageVersion(const uint32_t pageIndex) const
+  {
+    return m_pages.at(pageIndex).Version;
+  }
+
+
+  const GlyphAtlasGlyphMetrics& DynamicGlyphAtlas::GetGlyphMetrics(const uint32_t codePoint)
+  {
+    return AcquireGlyphRecord(codePoint).Metrics;
+  }
+
+
+  bool DynamicGlyphAtlas::RequestGlyphs(const StringViewLite& strView)
+  {
+    bool allResident = true;
+    Utf8CodePointReader reader(strView);
+    while (!reader.IsEmpty())
+    {
+      const uint32_t codePoint = reader.NextCodePoint();
+      allResident = MarkAsUsed(codePoint, AcquireGlyphRecord(codePoint)) && allResident;
+    }
+    return allResident;
+  }
+
+
+  PxSize2D DynamicGlyphAtlas::MeasureString(const StringViewLite& strView)
+  {
+    int32_t renderRightPx = 0;
+    int32_t renderBottomPx = 0;
+    int32_t layoutXOffsetPx = 0;
+    uint32_t previousCodePoint = 0;
+    Utf8CodePointReader reader(strView);
+    while (!reader.IsEmpty())
+    {
+      const uint32_t codePoint = reader.NextCodePoint();
+      const GlyphAtlasGlyphMetrics& metrics = AcquireGlyphRecord(codePoint).Metrics;
+      if (previousCodePoint != 0u)
+      {
+        layoutXOffsetPx += m_rasterizer->GetKerning(previousCodePoint, codePoint).Value;
+      }
+      if (metrics.ExtentPx.Width.Value > 0u && metrics.ExtentPx.Height.Value > 0u)
+      {
+        renderRightPx = std::max(renderRightPx, layoutXOffsetPx + metrics.OffsetPx.X.Value + static_cast<int32_t>(metrics.ExtentPx.Width.Value));
+        renderBottomPx = std::max(renderBottomPx, metrics.OffsetPx.Y.Value + static_cast<int32_t>(metrics.ExtentPx.Height.Value));
+      }
+      layoutXOffsetPx += metrics.XAdvancePx.Value;
+      previousCodePoint = codePoint;
+    }
+    return PxSize2D::Create(renderRightPx, renderBottomPx);
+  }
+
+
+  bool DynamicGlyphAtlas::ExtractRenderRules(Span<DynamicGlyphAtlasGlyphPosition> dst, const StringViewLite& strView)
+  {
+    if (dst.size() < strView.size())
+    {
+      throw std::invalid_argument("dst is too small");
+    }
+
+    bool allResident = true;
+    int32_t layoutXOffsetPx = 0;
+    uint32_t previousCodePoint = 0;
+    std::size_t dstIndex = 0;
+    Utf8CodePointReader reader(strView);
+    while (!reader.IsEmpty())
+    {
+      const uint32_t codePoint = reader.NextCodePoint();
+      GlyphRecord& rRecord = AcquireGlyphRecord(codePoint);
+      if (previousCodePoint != 0u)
+      {
+        layoutXOffsetPx += m_rasterizer->GetKerning(previousCodePoint, codePoint).Value;
+      }
+      if (MarkAsUsed(codePoint, rRecord) && rRecord.PageIndex != InvalidPageIndex)
+      {
+        const GlyphAtlasGlyphMetrics& metrics = rRecord.Metrics;
+        dst[dstIndex] = DynamicGlyphAtlasGlyphPosition(PxAreaRectangleF::Create(static_cast<float>(layoutXOffsetPx + metrics.OffsetPx.X.Value),
+                                                                                static_cast<float>(metrics.OffsetPx.Y.Value),
+                                                                                static_cast<float>(metrics.ExtentPx.Width.Value),
+                                                                                static_cast<float>(metrics.ExtentPx.Height.Value)),
+                                                       rRecord.TextureArea, rRecord.PageIndex);
+      }
+      else
+      {
+        allResident = allResident && rRecord.State == GlyphState::Resident;
+        dst[dstIndex] = {};
+      }
+      layoutXOffsetPx += rRecord.Metrics.XAdvancePx.Value;
+      previousCodePoint = codePoint;
+      ++dstIndex;
+    }
+    PadResult(dst, dstIndex, strView.size());
+    return allResident;
+  }
+
+
+  void DynamicGlyphAtlas::Update()
+  {
+    ScheduleRequestedGlyphs();
+    CollectCompletedGlyphs();
+
+    // Add the completed glyphs to the pages, the glyphs that did not fit are kept for the next frame
+    std::size_t keepCount = 0;
+    for (std::size_t i = 0; i < m_completed.size(); ++i)
+    {
+      if (!TryAddGlyph(m_completed[i]))
+      {
+        if (keepCount != i)
+        {
+          m_completed[keepCount] = std::move(m_completed[i]);
+        }
+        ++keepCount;
+      }
+    }
+    m_completed.resize(keepCount);
+    ++m_frame;
+  }
+
+
+  void DynamicGlyphAtlas::WaitForPendingGlyphs()
+  {
+    ScheduleRequestedGlyphs();
+    if (m_jobSystem)
+    {
+      m_jobSystem->WaitAll(SpanUtil::AsReadOnlySpan(m_jobs));
+      m_jobs.clear();
+    }
+    Update();
+  }
+
+
+  DynamicGlyphAtlas::GlyphRecord& DynamicGlyphAtlas::AcquireGlyphRecord(const uint32_t codePoint)
+  {
+    auto itrFind = m_glyphs.find(codePoint);
+    if (itrFind == m_glyphs.end())
+    {
+      itrFind = m_glyphs.emplace(codePoint, GlyphRecord(m_rasterizer->GetGlyphMetrics(codePoint))).first;
+    }
+    return itrFind->second;
+  }
+
+
+  bool DynamicGlyphAtlas::MarkAsUsed(const uint32_t codePoint, GlyphRecord& rRecord)
+  {
+    switch (rRecord.State)
+    {
+    case GlyphState::Resident:
+      if (rRecord.PageIndex != InvalidPageIndex)
+      {
+        m_pages[rRecord.PageIndex].LastUsedFrame = m_frame;
+      }
+      return true;
+    case GlyphState::NotResident:
+      rRecord.State = GlyphState::Pending;
+      m_requested.push_back(codePoint);
+      ++m_stats.PendingGlyphCount;
+      return false;
+    case GlyphState::Pending:
+    default:
+      return false;
+    }
+  }
+
+
+  void DynamicGlyphAtlas::ScheduleRequestedGlyphs()
+  {
+    // Forget the jobs that are done
+    m_jobs.erase(std::remove_if(m_jobs.begin(), m_jobs.end(), [](const JobHandle& job) { return job.IsCompleted(); }), m_jobs.end());
+
+    for (const uint32_t codePoint : m_requested)
+    {
+      if (m_jobSystem)
+      {
+        m_jobs.push_back(m_jobSystem->Schedule(
+          [rasterizer = m_rasterizer, completedQueue = m_completedQueue, codePoint]()
+          {
+            RasterizedGlyph glyph = SafeRasterize(*rasterizer, codePoint);
+            std::lock_guard<std::mutex> lock(completedQueue->Lock);
+            completedQueue->Glyphs.push_back(std::move(glyph));
+          }));
+      }
+      else
+      {
+        m_completed.push_back(SafeRasterize(*m_rasterizer, codePoint));
+      }
+    }
+    m_requested.clear();
+  }
+
+
+  void DynamicGlyphAtlas::CollectCompletedGlyphs()
+  {
+    std::lock_guard<std::mutex> lock(m_completedQueue->Lock);
+    for (RasterizedGlyph& rGlyph : m_completedQueue->Glyphs)
+    {
+      m_completed.push_back(std::move(rGlyph));
+    }
+    m_completedQueue->Glyphs.clear();
+  }
+
+
+  bool DynamicGlyphAtlas::TryAddGlyph(const RasterizedGlyph& glyph)
+  {
+    GlyphRecord& rRecord = AcquireGlyphRecord(glyph.CodePoint);
+    assert(rRecord.State == GlyphState::Pending);
+
+    const PxExtent2D extentPx = glyph.Metrics.ExtentPx;
+    const auto paddedExtentPx = PxExtent2D::Create(extentPx.Width.Value + m_config.GlyphPaddingPx, extentPx.Height.Value + m_config.GlyphPaddingPx);
+    const bool hasImage = extentPx.Width.Value > 0u && extentPx.Height.Value > 0u && !glyph.Pixels.empty();
+    uint32_t pageIndex = InvalidPageIndex;
+    if (hasImage)
+    {
+      if (paddedExtentPx.Width > m_config.PageExtentPx.Width || paddedExtentPx.Height > m_config.PageExtentPx.Height)
+      {
+        FSLLOG3_WARNING("Glyph {} is larger than the atlas page, it will not be rendered", glyph.CodePoint);
+      }
+      else
+      {
+        PxRectangleU32 rectPx;
+        pageIndex = TryAllocate(paddedExtentPx, rectPx);
+        if (pageIndex == InvalidPageIndex)
+        {
+          // All pages are in use by the current frame
+          return false;
+        }
+        Page& rPage = m_pages[pageIndex];
+        const auto glyphRectPx = PxRectangleU32(rectPx.X, rectPx.Y, extentPx.Width, extentPx.Height);
+        CopyGlyphImage(rPage.Pixels, m_config.PageExtentPx.Width.Value, glyphRectPx, glyph);
+        rPage.CodePoints.push_back(glyph.CodePoint);
+        rPage.LastUsedFrame = m_frame;
+        ++rPage.Version;
+        rRecord.TextureArea = m_spriteNativeAreaCalc.CalcNativeTextureArea(glyphRectPx, m_config.PageExtentPx);
+      }
+    }
+    rRecord.State = GlyphState::Resident;
+    rRecord.PageIndex = pageIndex;
+    --m_stats.PendingGlyphCount;
+    ++m_stats.ResidentGlyphCount;
+    ++m_stats.RasterizedGlyphCount;
+    return true;
+  }
+
+
+  uint32_t DynamicGlyphAtlas::TryAllocate(const PxExtent2D sizePx, PxRectangleU32& rRectPx)
+  {
+    for (std::size_t i = 0; i < m_pages.size(); ++i)
+    {
+      const std::optional<PxRectangleU32> rectPx = m_pages[i].Packer.TryAllocate(sizePx);
+      if (rectPx.has_value())
+      {
+        rRectPx = rectPx.value();
+        return static_cast<uint32_t>(i);
+      }
+    }
+
+    uint32_t pageIndex = InvalidPageIndex;
+    if (m_pages.size() < m_config.MaxPageCount)
+    {
+      pageIndex = static_cast<uint32_t>(m_pages.size());
+      m_pages.emplace_back(m_config.PageExtentPx);
+    }
+    else
+    {
+      // Find the least recently used page that is not used by the current frame
+      uint64_t oldestFrame = m_frame;
+      for (std::size_t i = 0; i < m_pages.size(); ++i)
+      {
+        if (m_pages[i].LastUsedFrame < oldestFrame)
+        {
+          oldestFrame = m_pages[i].LastUsedFrame;
+          pageIndex = static_cast<uint32_t>(i);
+        }
+      }
+      if (pageIndex == InvalidPageIndex)
+      {
+        return InvalidPageIndex;
+      }
+      EvictPage(pageIndex);
+    }
+
+    const std::optional<PxRectangleU32> rectPx = m_pages[pageIndex].Packer.TryAllocate(sizePx);
+    assert(rectPx.has_value());
+    rRectPx = rectPx.value();
+    return pageIndex;
+  }
+
+
+  void DynamicGlyphAtlas::EvictPage(const uint32_t pageIndex)
+  {
+    Page& rPage = m_pages[pageIndex];
+    for (const uint32_t codePoint : rPage.CodePoints)
+    {
+      GlyphRecord& rRecord = m_glyphs[codePoint];
+      rRecord.State = GlyphState::NotResident;
+      rRecord.PageIndex = InvalidPageIndex;
+      rRecord.TextureArea = {};
+    }
+    m_stats.ResidentGlyphCount -= UncheckedNumericCast<uint32_t>(rPage.CodePoints.size());
+    m_stats.EvictedGlyphCount += rPage.CodePoints.size();
+    ++m_stats.EvictedPageCount;
+
+    rPage.CodePoints.clear();
+    rPage.Packer.Clear();
+    std::fill(rPage.Pixels.begin(), rPage.Pixels.end(), static_cast<uint8_t>(0));
+    ++rPage.Version;
+  }
+}
@@ -0,0 +1,156 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics2D/GlyphAtlas/SkylinePacker.hpp>
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+namespace Fsl
+{
+  SkylinePacker::SkylinePacker(const PxExtent2D extentPx)
+    : m_extentPx(extentPx)
+  {
+    Clear();
+  }
+
+
+  void SkylinePacker::Clear()
+  {
+    m_skyline.clear();
+    m_skyline.emplace_back(0u, 0u, m_extentPx.Width.Value);
+    m_usedArea = 0;
+  }
+
+
+  std::optional<PxRectangleU32> SkylinePacker::TryAllocate(const PxExtent2D sizePx)
+  {
+    if (sizePx.Width.Value <= 0u || sizePx.Height.Value <= 0u)
+    {
+      return {};
+    }
+
+    std::size_t bestIndex = m_skyline.size();
+    uint32_t bestY = 0;
+    uint32_t bestBottom = std::numeric_limits<uint32_t>::max();
+    uint32_t bestWidth = std::numeric_limits<uint32_t>::max();
+    for (std::size_t i = 0; i < m_skyline.size(); ++i)
+    {
+      const std::optional<uint32_t> y = TryFit(i, sizePx);
+      if (y.has_value())
+      {
+        const uint32_t bottom = y.value() + sizePx.Height.Value;
+        // Prefer the lowest bottom, then the narrowest node to reduce the wasted space
+        if (bottom < bestBottom || (bottom == bestBottom && m_skyline[i].Width < bestWidth))
+        {
+          bestIndex = i;
+          bestY = y.value();
+          bestBottom = bottom;
+          bestWidth = m_skyline[i].Width;
+        }
+      }
+    }
+    if (bestIndex >= m_skyline.size())
+    {
+      return {};
+    }
+
+    const auto rectPx = PxRectangleU32::Create(m_skyline[bestIndex].X, bestY, sizePx.Width.Value, sizePx.Height.Value);
+    AddSkylineLevel(bestIndex, rectPx);
+    m_usedArea += static_cast<uint64_t>(sizePx.Width.Value) * sizePx.Height.Value;
+    return rectPx;
+  }
+
+
+  std::optional<uint32_t> SkylinePacker::TryFit(const std::size_t nodeIndex, const PxExtent2D sizePx) const noexcept
+  {
+    const uint32_t x = m_skyline[nodeIndex].X;
+    if (sizePx.Width.Value > (m_extentPx.Width.Value - x))
+    {
+      return {};
+    }
+    uint32_t y = m_skyline[nodeIndex].Y;
+    uint32_t widthLeft = sizePx.Width.Value;
+    std::size_t index = nodeIndex;
+    while (widthLeft > 0u)
+    {
+      assert(index < m_skyline.size());
+      y = std::max(y, m_skyline[index].Y);
+      if (sizePx.Height.Value > (m_extentPx.Height.Value - std::min(y, m_extentPx.Height.Value)))
+      {
+        return {};
+      }
+      widthLeft -= std::min(widthLeft, m_skyline[index].Width);
+      ++index;
+    }
+    return y;
+  }
+
+
+  void SkylinePacker::AddSkylineLevel(const std::size_t nodeIndex, const PxRectangleU32& rectPx)
+  {
+    const uint32_t rectRight = rectPx.RawRight();
+    m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(nodeIndex), Node(rectPx.X.Value, rectPx.RawBottom(), rectPx.Width.Value));
+
+    // Shrink or remove the nodes that are now covered by the new node
+    std::size_t index = nodeIndex + 1;
+    while (index < m_skyline.size() && m_skyline[index].X < rectRight)
+    {
+      Node& rNode = m_skyline[index];
+      const uint32_t nodeRight = rNode.X + rNode.Width;
+      if (nodeRight <= rectRight)
+      {
+        m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(index));
+      }
+      else
+      {
+        rNode.Width = nodeRight - rectRight;
+        rNode.X = rectRight;
+        break;
+      }
+    }
+
+    // Merge neighbouring nodes at the same height
+    index = 0;
+    while ((index + 1) < m_skyline.size())
+    {
+      if (m_skyline[index].Y == m_skyline[index + 1].Y)
+      {
+        m_skyline[index].Width += m_skyline[index + 1].Width;
+        m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(index + 1));
+      }
+      else
+      {
+        ++index;
+      }
+    }
+  }
+}
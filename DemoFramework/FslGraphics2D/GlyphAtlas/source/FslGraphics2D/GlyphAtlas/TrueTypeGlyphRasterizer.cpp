@@ -0,0 +1,292 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslGraphics2D/GlyphAtlas/TrueTypeGlyphRasterizer.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#define STB_TRUETYPE_IMPLEMENTATION
+#define STBTT_STATIC
+#include <stb_truetype.h>
+
+namespace Fsl
+{
+  namespace
+  {
+    //! The SDF value at the glyph edge
+    constexpr uint8_t SdfOnEdgeValue = 128;
+
+    //! The offset table that starts every font: sfnt version, table count, search range, entry selector and range shift
+    constexpr std::size_t OffsetTableSize = 12;
+    //! A table record in the offset table: tag, checksum, offset and length
+    constexpr std::size_t TableRecordSize = 16;
+    //! A font collection header up to and including the offset of the first font: tag, version, font count and font offset
+    constexpr std::size_t CollectionHeaderSize = 16;
+
+    constexpr uint32_t ReadUInt16BE(const uint8_t* const pSrc) noexcept
+    {
+      return (static_cast<uint32_t>(pSrc[0]) << 8) | static_cast<uint32_t>(pSrc[1]);
+    }
+
+    constexpr uint32_t ReadUInt32BE(const uint8_t* const pSrc) noexcept
+    {
+      return (static_cast<uint32_t>(pSrc[0]) << 24) | (static_cast<uint32_t>(pSrc[1]) << 16) | (static_cast<uint32_t>(pSrc[2]) << 8) |
+             static_cast<uint32_t>(pSrc[3]);
+    }
+
+    //! @brief Check that the header stb_truetype reads to locate the first font is inside the buffer
+    bool HasValidFileHeader(const std::vector<uint8_t>& fontData) noexcept
+    {
+      if (fontData.size() < OffsetTableSize)
+      {
+        return false;
+      }
+      const bool isCollection = std::memcmp(fontData.data(), "ttcf", 4) == 0;
+      return !isCollection || fontData.size() >= CollectionHeaderSize;
+    }
+
+    //! @brief Check that the offset table of the font and all the tables it references are inside the buffer
+    //! @note  stb_truetype does no bounds checking at all, so this at least ensures that the table lookups stay inside the font data.
+    bool HasValidTableDirectory(const std::vector<uint8_t>& fontData, const int fontOffset) noexcept
+    {
+      const auto offset = static_cast<std::size_t>(fontOffset);
+      if (fontOffset < 0 || offset > fontData.size() || (fontData.size() - offset) < OffsetTableSize)
+      {
+        return false;
+      }
+      const std::size_t tableCount = ReadUInt16BE(fontData.data() + offset + 4);
+      if (((fontData.size() - offset - OffsetTableSize) / TableRecordSize) < tableCount)
+      {
+        return false;
+      }
+      for (std::size_t i = 0; i < tableCount; ++i)
+      {
+        const uint8_t* const pRecord = fontData.data() + offset + OffsetTableSize + (i * TableRecordSize);
+        const std::size_t tableOffset = ReadUInt32BE(pRecord + 8);
+        const std::size_t tableLength = ReadUInt32BE(pRecord + 12);
+        if (tableOffset > fontData.size() || tableLength > (fontData.size() - tableOffset))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    class ScopedSdfBitmap
+    {
+      unsigned char* m_pBitmap;
+
+    public:
+      ScopedSdfBitmap(const ScopedSdfBitmap&) = delete;
+      ScopedSdfBitmap& operator=(const ScopedSdfBitmap&) = delete;
+
+      explicit ScopedSdfBitmap(unsigned char* pBitmap) noexcept
+        : m_pBitmap(pBitmap)
+      {
+      }
+
+      ~ScopedSdfBitmap() noexcept
+      {
+        if (m_pBitmap != nullptr)
+        {
+          stbtt_FreeSDF(m_pBitmap, nullptr);
+        }
+      }
+
+      const unsigned char* Get() const noexcept
+      {
+        return m_pBitmap;
+      }
+    };
+  }
+
+  struct TrueTypeGlyphRasterizer::FontRecord
+  {
+    std::vector<uint8_t> FontData;
+    stbtt_fontinfo FontInfo{};
+    BitmapFontType FontType{BitmapFontType::Bitmap};
+    uint16_t SdfSpread{0};
+    float Scale{1.0f};
+    GlyphAtlasFontMetrics FontMetrics;
+
+    //! Calculate the bounding box of the glyph image in pixels relative to the baseline (stb_truetype uses a y-axis that points down)
+    //! @return false if the glyph has no image
+    bool TryGetGlyphBox(const int glyphIndex, int& rX0, int& rY0, int& rX1, int& rY1) const noexcept
+    {
+      stbtt_GetGlyphBitmapBox(&FontInfo, glyphIndex, Scale, Scale, &rX0, &rY0, &rX1, &rY1);
+      if (rX1 <= rX0 || rY1 <= rY0)
+      {
+        return false;
+      }
+      if (FontType == BitmapFontType::SDF)
+      {
+        // stbtt_GetGlyphSDF pads the glyph box with the spread on all sides
+        rX0 -= SdfSpread;
+        rY0 -= SdfSpread;
+        rX1 += SdfSpread;
+        rY1 += SdfSpread;
+      }
+      return true;
+    }
+
+    GlyphAtlasGlyphMetrics GetGlyphMetrics(const int glyphIndex) const noexcept
+    {
+      int advanceWidth = 0;
+      int leftSideBearing = 0;
+      stbtt_GetGlyphHMetrics(&FontInfo, glyphIndex, &advanceWidth, &leftSideBearing);
+      const auto xAdvancePx = PxValue(static_cast<int32_t>(std::round(static_cast<float>(advanceWidth) * Scale)));
+
+      int x0 = 0;
+      int y0 = 0;
+      int x1 = 0;
+      int y1 = 0;
+      if (!TryGetGlyphBox(glyphIndex, x0, y0, x1, y1))
+      {
+        return {PxPoint2(), PxExtent2D(), xAdvancePx};
+      }
+      return {PxPoint2::Create(x0, FontMetrics.BaseLinePx.RawValue() + y0),
+              PxExtent2D::Create(UncheckedNumericCast<uint32_t>(x1 - x0), UncheckedNumericCast<uint32_t>(y1 - y0)), xAdvancePx};
+    }
+  };
+
+
+  TrueTypeGlyphRasterizer::TrueTypeGlyphRasterizer(std::vector<uint8_t> fontData, const uint16_t fontSizePx, const BitmapFontType fontType,
+                                                   const uint16_t sdfSpread)
+    : m_font(std::make_unique<FontRecord>())
+  {
+    if (fontSizePx <= 0u)
+    {
+      throw std::invalid_argument("fontSizePx must be larger than zero");
+    }
+    m_font->FontData = std::move(fontData);
+    // stb_truetype reads the headers without knowing the size of the buffer, so validate them before calling into it
+    if (!HasValidFileHeader(m_font->FontData))
+    {
+      throw FormatException("Not a supported true type font");
+    }
+    const int fontOffset = stbtt_GetFontOffsetForIndex(m_font->FontData.data(), 0);
+    if (!HasValidTableDirectory(m_font->FontData, fontOffset) || stbtt_InitFont(&m_font->FontInfo, m_font->FontData.data(), fontOffset) == 0)
+    {
+      throw FormatException("Not a supported true type font");
+    }
+    m_font->FontType = fontType;
+    m_font->SdfSpread = fontType == BitmapFontType::SDF ? std::max(sdfSpread, static_cast<uint16_t>(1u)) : 0u;
+    m_font->Scale = stbtt_ScaleForPixelHeight(&m_font->FontInfo, static_cast<float>(fontSizePx));
+
+    int ascent = 0;
+    int descent = 0;
+    int lineGap = 0;
+    stbtt_GetFontVMetrics(&m_font->FontInfo, &ascent, &descent, &lineGap);
+    const auto lineSpacingPx = static_cast<int32_t>(std::round(static_cast<float>(ascent - descent + lineGap) * m_font->Scale));
+    const auto baseLinePx = static_cast<int32_t>(std::round(static_cast<float>(ascent) * m_font->Scale));
+    m_font->FontMetrics = GlyphAtlasFontMetrics(PxSize1D::Create(lineSpacingPx), PxSize1D::Create(baseLinePx));
+  }
+
+
+  TrueTypeGlyphRasterizer::~TrueTypeGlyphRasterizer() = default;
+
+
+  BitmapFontType TrueTypeGlyphRasterizer::GetFontType() const
+  {
+    return m_font->FontType;
+  }
+
+
+  uint16_t TrueTypeGlyphRasterizer::GetSdfSpread() const
+  {
+    return m_font->SdfSpread;
+  }
+
+
+  GlyphAtlasFontMetrics TrueTypeGlyphRasterizer::GetFontMetrics() const
+  {
+    return m_font->FontMetrics;
+  }
+
+
+  GlyphAtlasGlyphMetrics TrueTypeGlyphRasterizer::GetGlyphMetrics(const uint32_t codePoint) const
+  {
+    return m_font->GetGlyphMetrics(stbtt_FindGlyphIndex(&m_font->FontInfo, static_cast<int>(codePoint)));
+  }
+
+
+  PxValue TrueTypeGlyphRasterizer::GetKerning(const uint32_t first, const uint32_t second) const
+  {
+    const int kerning = stbtt_GetCodepointKernAdvance(&m_font->FontInfo, static_cast<int>(first), static_cast<int>(second));
+    return PxValue(static_cast<int32_t>(std::round(static_cast<float>(kerning) * m_font->Scale)));
+  }
+
+
+  RasterizedGlyph TrueTypeGlyphRasterizer::Rasterize(const uint32_t codePoint) const
+  {
+    const FontRecord& font = *m_font;
+    const int glyphIndex = stbtt_FindGlyphIndex(&font.FontInfo, static_cast<int>(codePoint));
+    const GlyphAtlasGlyphMetrics metrics = font.GetGlyphMetrics(glyphIndex);
+    const int width = UncheckedNumericCast<int>(metrics.ExtentPx.Width.Value);
+    const int height = UncheckedNumericCast<int>(metrics.ExtentPx.Height.Value);
+    if (width <= 0 || height <= 0)
+    {
+      return {codePoint, metrics, {}};
+    }
+
+    std::vector<uint8_t> pixels(static_cast<std::size_t>(width) * static_cast<std::size_t>(height));
+    if (font.FontType == BitmapFontType::SDF)
+    {
+      const float pixelDistScale = static_cast<float>(SdfOnEdgeValue) / static_cast<float>(font.SdfSpread);
+      int sdfWidth = 0;
+      int sdfHeight = 0;
+      int sdfXOffset = 0;
+      int sdfYOffset = 0;
+      const ScopedSdfBitmap sdfBitmap(stbtt_GetGlyphSDF(&font.FontInfo, font.Scale, glyphIndex, font.SdfSpread, SdfOnEdgeValue, pixelDistScale,
+                                                        &sdfWidth, &sdfHeight, &sdfXOffset, &sdfYOffset));
+      if (sdfBitmap.Get() != nullptr)
+      {
+        // The metrics box is calculated the same way as stb_truetype does it, but never copy more than we allocated
+        const int copyWidth = std::min(width, sdfWidth);
+        const int copyHeight = std::min(height, sdfHeight);
+        for (int y = 0; y < copyHeight; ++y)
+        {
+          std::memcpy(pixels.data() + (static_cast<std::size_t>(y) * static_cast<std::size_t>(width)),
+                      sdfBitmap.Get() + (static_cast<std::size_t>(y) * static_cast<std::size_t>(sdfWidth)), static_cast<std::size_t>(copyWidth));
+        }
+      }
+    }
+    else
+    {
+      stbtt_MakeGlyphBitmap(&font.FontInfo, pixels.data(), width, height, width, font.Scale, font.Scale, glyphIndex);
+    }
+    return {codePoint, metrics, std::move(pixels)};
+  }
+}
@@ -39,6 +39,10 @@
 #include <FslGraphics2D/PixelFormatConverter/Bitmap/RawBitmapConverterFunctions.hpp>
 #include <half.hpp>
 #include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
 #include "UnitTestRawBitmapHelper.hpp"
 
 using namespace Fsl;
@@ -46,6 +50,65 @@ using namespace Fsl;
 namespace
 {
   using TestBitmap_RawBitmapConverterFunctions = TestFixtureFslGraphics;
+
+  template <typename T>
+  std::vector<uint8_t> ToByteVector(const std::vector<T>& values)
+  {
+    std::vector<uint8_t> content(values.size() * sizeof(T));
+    std::memcpy(content.data(), values.data(), content.size());
+    return content;
+  }
+
+  bool IsHalfNaN(const uint16_t value) noexcept
+  {
+    return (value & 0x7C00u) == 0x7C00u && (value & 0x03FFu) != 0u;
+  }
+
+  uint32_t ToBits(const float value) noexcept
+  {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+  //! Contains special values, values that are exactly halfway between two fp16 values and values outside the fp16 range
+  std::vector<float> CreateFloatToHalfTestValues()
+  {
+    std::vector<float> values = {0.0f,
+                                 -0.0f,
+                                 1.0f,
+                                 -1.0f,
+                                 65504.0f,
+                                 65519.99f,
+                                 65520.0f,
+                                 -65520.0f,
+                                 1e10f,
+                                 std::numeric_limits<float>::infinity(),
+                                 -std::numeric_limits<float>::infinity(),
+                                 std::numeric_limits<float>::min(),
+                                 std::numeric_limits<float>::denorm_min(),
+                                 5.960464477539063e-08f,
+                                 2.980232238769531e-08f,
+                                 2.9802326e-08f,
+                                 6.103515625e-05f,
+                                 6.0975552e-05f,
+                                 1.00048828125f,
+                                 1.00146484375f,
+                                 -1.00048828125f};
+    uint32_t seed = 0x12345678u;
+    while (values.size() < (4u * 257u))
+    {
+      // Simple LCG so the test is deterministic, the bit pattern is used directly to cover all exponents
+      seed = (seed * 1664525u) + 1013904223u;
+      float value = 0.0f;
+      std::memcpy(&value, &seed, sizeof(value));
+      if (!std::isnan(value))
+      {
+        values.push_back(value);
+      }
+    }
+    return values;
+  }
 }
 
 // ---------------------------------------------------------------------------------------------------------------------------------------------------
@@ -456,6 +519,36 @@ TEST(TestBitmap_RawBitmapConverterFunctions, UncheckedR16G16B16A16FloatToR32G32B
 }
 
 
+TEST(TestBitmap_RawBitmapConverterFunctions, UncheckedR16G16B16A16FloatToR32G32B32A32Float_AllValues)
+{
+  // 128 * 128 * 4 = 65536 so every fp16 value is converted once
+  std::vector<uint16_t> values(0x10000u);
+  for (uint32_t i = 0; i < values.size(); ++i)
+  {
+    values[i] = static_cast<uint16_t>(i);
+  }
+  const TightBitmap srcBitmap(ToByteVector(values), PxSize2D::Create(128, 128), PixelFormat::R16G16B16A16_SFLOAT, BitmapOrigin::UpperLeft);
+  TightBitmap dstBitmap(srcBitmap.GetSize(), PixelFormat::R32G32B32A32_SFLOAT, BitmapOrigin::UpperLeft);
+
+  FslGraphics2D::RawBitmapConverterFunctions::UncheckedR16G16B16A16FloatToR32G32B32A32Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
+
+  const ReadOnlySpan<float> dstSpan = UnitTestRawBitmapHelper::ReinterpretSpanToFloat(dstBitmap.AsSpan());
+  ASSERT_EQ(values.size(), dstSpan.size());
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    const float expected = UnitTestRawBitmapHelper::ConvertLinearFP16ToLinearFloat(values[i]);
+    if (IsHalfNaN(values[i]))
+    {
+      EXPECT_TRUE(std::isnan(dstSpan[i])) << "index: " << i;
+    }
+    else
+    {
+      EXPECT_EQ(ToBits(expected), ToBits(dstSpan[i])) << "index: " << i;
+    }
+  }
+}
+
+
 TEST(TestBitmap_RawBitmapConverterFunctions, UncheckedR32G32B32FloatToR16G16B16Float_Empty)
 {
   const TightBitmap srcBitmap(PxSize2D(), PixelFormat::R32G32B32_SFLOAT, BitmapOrigin::UpperLeft);
@@ -508,6 +601,35 @@ TEST(TestBitmap_RawBitmapConverterFunctions, UncheckedR32G32B32A32FloatToR16G16B
 }
 
 
+TEST(TestBitmap_RawBitmapConverterFunctions, UncheckedR32G32B32A32FloatToR16G16B16A16Float_Rounding)
+{
+  const std::vector<float> values = CreateFloatToHalfTestValues();
+  const TightBitmap srcBitmap(ToByteVector(values), PxSize2D::Create(257, 1), PixelFormat::R32G32B32A32_SFLOAT, BitmapOrigin::UpperLeft);
+  TightBitmap dstBitmap(srcBitmap.GetSize(), PixelFormat::R16G16B16A16_SFLOAT, BitmapOrigin::UpperLeft);
+
+  FslGraphics2D::RawBitmapConverterFunctions::UncheckedR32G32B32A32FloatToR16G16B16A16Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
+
+  UnitTestRawBitmapHelper::CheckIfTransformMatch<float, uint16_t>(UnitTestRawBitmapHelper::ReinterpretSpanToFloat(srcBitmap.AsSpan()),
+                                                                  UnitTestRawBitmapHelper::ReinterpretSpanToUInt16(dstBitmap.AsSpan()),
+                                                                  UnitTestRawBitmapHelper::ConvertLinearFloatToLinearFp16);
+}
+
+
+TEST(TestBitmap_RawBitmapConverterFunctions, UncheckedR32G32B32FloatToR16G16B16Float_Rounding)
+{
+  std::vector<float> values = CreateFloatToHalfTestValues();
+  values.resize(3u * 257u);
+  const TightBitmap srcBitmap(ToByteVector(values), PxSize2D::Create(257, 1), PixelFormat::R32G32B32_SFLOAT, BitmapOrigin::UpperLeft);
+  TightBitmap dstBitmap(srcBitmap.GetSize(), PixelFormat::R16G16B16_SFLOAT, BitmapOrigin::UpperLeft);
+
+  FslGraphics2D::RawBitmapConverterFunctions::UncheckedR32G32B32FloatToR16G16B16Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
+
+  UnitTestRawBitmapHelper::CheckIfTransformMatch<float, uint16_t>(UnitTestRawBitmapHelper::ReinterpretSpanToFloat(srcBitmap.AsSpan()),
+                                                                  UnitTestRawBitmapHelper::ReinterpretSpanToUInt16(dstBitmap.AsSpan()),
+                                                                  UnitTestRawBitmapHelper::ConvertLinearFloatToLinearFp16);
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------------------------------------
 
 TEST(TestBitmap_RawBitmapConverterFunctions, UncheckedR16G16B16UNormToR32G32B32Float_Empty)
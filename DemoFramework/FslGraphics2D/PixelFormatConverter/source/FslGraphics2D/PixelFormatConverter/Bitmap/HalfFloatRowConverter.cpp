@@ -0,0 +1,152 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/CpuFeatures.hpp>
+#include <half.hpp>
+#include "HalfFloatRowConverter.hpp"
+#if defined(FSL_CPU_X86)
+#include <immintrin.h>
+#elif defined(FSL_CPU_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace Fsl::FslGraphics2D::HalfFloatRowConverter
+{
+  namespace
+  {
+    using HalfToFloatFunc = void (*)(float*, const uint16_t*, const uint32_t) noexcept;
+    using FloatToHalfFunc = void (*)(uint16_t*, const float*, const uint32_t) noexcept;
+
+    void HalfToFloatScalar(float* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        pDst[i] = half_float::detail::half2float<float>(pSrc[i]);
+      }
+    }
+
+    void FloatToHalfScalar(uint16_t* pDst, const float* pSrc, const uint32_t count) noexcept
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        pDst[i] = half_float::detail::float2half<std::float_round_style::round_to_nearest>(pSrc[i]);
+      }
+    }
+
+#if defined(FSL_CPU_X86)
+    FSL_TARGET_F16C void HalfToFloatF16C(float* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      uint32_t i = 0;
+      for (; (i + 8) <= count; i += 8)
+      {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i));
+        _mm256_storeu_ps(pDst + i, _mm256_cvtph_ps(values));
+      }
+      HalfToFloatScalar(pDst + i, pSrc + i, count - i);
+    }
+
+    FSL_TARGET_F16C void FloatToHalfF16C(uint16_t* pDst, const float* pSrc, const uint32_t count) noexcept
+    {
+      uint32_t i = 0;
+      for (; (i + 8) <= count; i += 8)
+      {
+        const __m256 values = _mm256_loadu_ps(pSrc + i);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+      }
+      FloatToHalfScalar(pDst + i, pSrc + i, count - i);
+    }
+#elif defined(FSL_CPU_ARM64)
+    void HalfToFloatNeon(float* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+    {
+      uint32_t i = 0;
+      for (; (i + 4) <= count; i += 4)
+      {
+        vst1q_f32(pDst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(pSrc + i))));
+      }
+      HalfToFloatScalar(pDst + i, pSrc + i, count - i);
+    }
+
+    void FloatToHalfNeon(uint16_t* pDst, const float* pSrc, const uint32_t count) noexcept
+    {
+      // Relies on the default FPCR rounding mode (round to nearest even)
+      uint32_t i = 0;
+      for (; (i + 4) <= count; i += 4)
+      {
+        vst1_u16(pDst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(pSrc + i))));
+      }
+      FloatToHalfScalar(pDst + i, pSrc + i, count - i);
+    }
+#endif
+
+    struct Converters
+    {
+      HalfToFloatFunc FnHalfToFloat{HalfToFloatScalar};
+      FloatToHalfFunc FnFloatToHalf{FloatToHalfScalar};
+    };
+
+    Converters SelectConverters() noexcept
+    {
+      Converters converters;
+#if defined(FSL_CPU_X86)
+      if (CpuFeatures::HasF16C())
+      {
+        converters.FnHalfToFloat = HalfToFloatF16C;
+        converters.FnFloatToHalf = FloatToHalfF16C;
+      }
+#elif defined(FSL_CPU_ARM64)
+      if (CpuFeatures::HasNeon())
+      {
+        converters.FnHalfToFloat = HalfToFloatNeon;
+        converters.FnFloatToHalf = FloatToHalfNeon;
+      }
+#endif
+      return converters;
+    }
+
+    const Converters& GetConverters() noexcept
+    {
+      static const Converters g_converters = SelectConverters();
+      return g_converters;
+    }
+  }
+
+
+  void HalfToFloat(float* pDst, const uint16_t* pSrc, const uint32_t count) noexcept
+  {
+    GetConverters().FnHalfToFloat(pDst, pSrc, count);
+  }
+
+
+  void FloatToHalf(uint16_t* pDst, const float* pSrc, const uint32_t count) noexcept
+  {
+    GetConverters().FnFloatToHalf(pDst, pSrc, count);
+  }
+}
@@ -34,9 +34,11 @@
 #include <FslGraphics/ColorChannelConverter.hpp>
 #include <FslGraphics2D/PixelFormatConverter/Bitmap/RawBitmapConverterFunctions.hpp>
 #include <half.hpp>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <limits>
+#include "HalfFloatRowConverter.hpp"
 
 namespace Fsl::FslGraphics2D::RawBitmapConverterFunctions
 {
@@ -173,6 +175,63 @@ namespace Fsl::FslGraphics2D::RawBitmapConverterFunctions
     {
       return ConvertLinearFloatToLinearUInt8(ConvertLinearFP16ToLinearFloat(valueLinear));
     }
+
+    //! All 8bit source conversions only have 256 possible inputs, so we precalculate them once using the scalar conversion functions.
+    //! This makes the lookup bit exact with the scalar code while avoiding the per channel pow call.
+    struct UInt8LookupTables
+    {
+      std::array<uint16_t, 256> SRGBToLinearUInt16{};
+      std::array<uint16_t, 256> SRGBToLinearFP16{};
+      std::array<uint16_t, 256> LinearToLinearFP16{};
+      std::array<float, 256> SRGBToLinearFloat{};
+
+      UInt8LookupTables()
+      {
+        for (uint32_t i = 0; i < 256u; ++i)
+        {
+          const auto value = static_cast<uint8_t>(i);
+          SRGBToLinearUInt16[i] = ConvertSRGBToLinearUInt16(value);
+          SRGBToLinearFP16[i] = ConvertSRGBToLinearFP16AsUInt16(value);
+          LinearToLinearFP16[i] = ConvertLinearUInt8ToLinearFP16(value);
+          SRGBToLinearFloat[i] = ConvertUInt8SRGBToLinearFloat(value);
+        }
+      }
+    };
+
+    const UInt8LookupTables& GetUInt8LookupTables()
+    {
+      static const UInt8LookupTables g_tables;
+      return g_tables;
+    }
+
+    //! Convert all channels of each row using a row converter function
+    //! Must be true
+    //! - IsSafeInplaceModificationOrNoMemoryOverlap(rDstBitmap, srcBitmap) == true
+    template <typename TDstChannel, typename TSrcChannel, typename TRowConverter>
+    void ConvertAllChannelRows(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap, const uint32_t numChannels,
+                               TRowConverter fnRowConverter) noexcept
+    {
+      assert(dstBitmap.GetOrigin() == srcBitmap.GetOrigin());
+      assert(dstBitmap.GetSize() == srcBitmap.GetSize());
+      assert(UncheckedRawBitmapTransformer::IsSafeInplaceModificationOrNoMemoryOverlap(dstBitmap, srcBitmap));
+      assert((srcBitmap.Stride() % sizeof(TSrcChannel)) == 0);
+      assert((dstBitmap.Stride() % sizeof(TDstChannel)) == 0);
+      assert(srcBitmap.RawUnsignedWidth() <= (std::numeric_limits<uint32_t>::max() / numChannels));
+
+      const uint32_t srcStride = srcBitmap.Stride() / sizeof(TSrcChannel);
+      const uint32_t dstStride = dstBitmap.Stride() / sizeof(TDstChannel);
+      const uint32_t rowEntries = srcBitmap.RawUnsignedWidth() * numChannels;
+
+      const auto* pSrc = static_cast<const TSrcChannel*>(srcBitmap.Content());
+      auto* pDst = static_cast<TDstChannel*>(dstBitmap.Content());
+      const TDstChannel* const pDstEnd = pDst + (dstBitmap.RawUnsignedHeight() * dstStride);
+      while (pDst < pDstEnd)
+      {
+        fnRowConverter(pDst, pSrc, rowEntries);
+        pSrc += srcStride;
+        pDst += dstStride;
+      }
+    }
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -191,43 +250,50 @@ namespace Fsl::FslGraphics2D::RawBitmapConverterFunctions
 
   void UncheckedR8G8B8SrgbToR16G16B16UNorm(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
   {
+    const auto& lut = GetUInt8LookupTables().SRGBToLinearUInt16;
     UncheckedRawBitmapTransformer::TransformThreeChannels<uint16_t, PixelFormat::R16G16B16_UNORM, uint8_t, PixelFormat::R8G8B8_SRGB>(
-      dstBitmap, srcBitmap, ConvertSRGBToLinearUInt16);
+      dstBitmap, srcBitmap, [&lut](const uint8_t value) { return lut[value]; });
   }
 
 
   void UncheckedR8G8B8A8SrgbToR16G16B16A16UNorm(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
   {
+    const auto& lut = GetUInt8LookupTables().SRGBToLinearUInt16;
     UncheckedRawBitmapTransformer::TransformThreeChannelsTransformFourth<uint16_t, PixelFormat::R16G16B16A16_UNORM, uint8_t,
-                                                                         PixelFormat::R8G8B8A8_SRGB>(dstBitmap, srcBitmap, ConvertSRGBToLinearUInt16,
-                                                                                                     ConvertLinearUInt8ToLinearUInt16);
+                                                                         PixelFormat::R8G8B8A8_SRGB>(
+      dstBitmap, srcBitmap, [&lut](const uint8_t value) { return lut[value]; }, ConvertLinearUInt8ToLinearUInt16);
   }
 
 
   void UncheckedR8G8B8SrgbToR16G16B16Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
+    const auto& lut = GetUInt8LookupTables().SRGBToLinearFP16;
     UncheckedRawBitmapTransformer::TransformThreeChannels<uint16_t, PixelFormat::R16G16B16_SFLOAT, uint8_t, PixelFormat::R8G8B8_SRGB>(
-      dstBitmap, srcBitmap, ConvertSRGBToLinearFP16AsUInt16);
+      dstBitmap, srcBitmap, [&lut](const uint8_t value) { return lut[value]; });
   }
 
   void UncheckedR8G8B8A8SrgbToR16G16B16A16Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
+    const auto& tables = GetUInt8LookupTables();
     UncheckedRawBitmapTransformer::TransformThreeChannelsTransformFourth<uint16_t, PixelFormat::R16G16B16A16_SFLOAT, uint8_t,
                                                                          PixelFormat::R8G8B8A8_SRGB>(
-      dstBitmap, srcBitmap, ConvertSRGBToLinearFP16AsUInt16, ConvertLinearUInt8ToLinearFP16);
+      dstBitmap, srcBitmap, [&tables](const uint8_t value) { return tables.SRGBToLinearFP16[value]; },
+      [&tables](const uint8_t value) { return tables.LinearToLinearFP16[value]; });
   }
 
   void UncheckedR8G8B8SrgbToR32G32B32Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
   {
+    const auto& lut = GetUInt8LookupTables().SRGBToLinearFloat;
     UncheckedRawBitmapTransformer::TransformThreeChannels<float, PixelFormat::R32G32B32_SFLOAT, uint8_t, PixelFormat::R8G8B8_SRGB>(
-      dstBitmap, srcBitmap, ConvertUInt8SRGBToLinearFloat);
+      dstBitmap, srcBitmap, [&lut](const uint8_t value) { return lut[value]; });
   }
 
   void UncheckedR8G8B8A8SrgbToR32G32B32A32Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap) noexcept
   {
+    const auto& lut = GetUInt8LookupTables().SRGBToLinearFloat;
     UncheckedRawBitmapTransformer::TransformThreeChannelsTransformFourth<float, PixelFormat::R32G32B32A32_SFLOAT, uint8_t,
                                                                          PixelFormat::R8G8B8A8_SRGB>(
-      dstBitmap, srcBitmap, ConvertUInt8SRGBToLinearFloat, ConvertLinearUInt8ToLinearFloat);
+      dstBitmap, srcBitmap, [&lut](const uint8_t value) { return lut[value]; }, ConvertLinearUInt8ToLinearFloat);
   }
 
   // Linear to SRGB (clamp)
@@ -278,29 +344,33 @@ namespace Fsl::FslGraphics2D::RawBitmapConverterFunctions
 
   void UncheckedR16G16B16FloatToR32G32B32Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannels<float, PixelFormat::R32G32B32_SFLOAT, uint16_t, PixelFormat::R16G16B16_SFLOAT>(
-      dstBitmap, srcBitmap, ConvertLinearFP16ToLinearFloat);
+    assert(srcBitmap.GetPixelFormat() == PixelFormat::R16G16B16_SFLOAT);
+    assert(dstBitmap.GetPixelFormat() == PixelFormat::R32G32B32_SFLOAT);
+    ConvertAllChannelRows<float, uint16_t>(dstBitmap, srcBitmap, 3u, HalfFloatRowConverter::HalfToFloat);
   }
 
 
   void UncheckedR16G16B16A16FloatToR32G32B32A32Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformFourChannels<float, PixelFormat::R32G32B32A32_SFLOAT, uint16_t, PixelFormat::R16G16B16A16_SFLOAT>(
-      dstBitmap, srcBitmap, ConvertLinearFP16ToLinearFloat);
+    assert(srcBitmap.GetPixelFormat() == PixelFormat::R16G16B16A16_SFLOAT);
+    assert(dstBitmap.GetPixelFormat() == PixelFormat::R32G32B32A32_SFLOAT);
+    ConvertAllChannelRows<float, uint16_t>(dstBitmap, srcBitmap, 4u, HalfFloatRowConverter::HalfToFloat);
   }
 
 
   void UncheckedR32G32B32FloatToR16G16B16Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformThreeChannels<uint16_t, PixelFormat::R16G16B16_SFLOAT, float, PixelFormat::R32G32B32_SFLOAT>(
-      dstBitmap, srcBitmap, ConvertLinearFloatToLinearFP16);
+    assert(srcBitmap.GetPixelFormat() == PixelFormat::R32G32B32_SFLOAT);
+    assert(dstBitmap.GetPixelFormat() == PixelFormat::R16G16B16_SFLOAT);
+    ConvertAllChannelRows<uint16_t, float>(dstBitmap, srcBitmap, 3u, HalfFloatRowConverter::FloatToHalf);
   }
 
 
   void UncheckedR32G32B32A32FloatToR16G16B16A16Float(RawBitmapEx dstBitmap, const ReadOnlyRawBitmap& srcBitmap)
   {
-    UncheckedRawBitmapTransformer::TransformFourChannels<uint16_t, PixelFormat::R16G16B16A16_SFLOAT, float, PixelFormat::R32G32B32A32_SFLOAT>(
-      dstBitmap, srcBitmap, ConvertLinearFloatToLinearFP16);
+    assert(srcBitmap.GetPixelFormat() == PixelFormat::R32G32B32A32_SFLOAT);
+    assert(dstBitmap.GetPixelFormat() == PixelFormat::R16G16B16A16_SFLOAT);
+    ConvertAllChannelRows<uint16_t, float>(dstBitmap, srcBitmap, 4u, HalfFloatRowConverter::FloatToHalf);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,132 @@
+#ifndef FSLGRAPHICS3D_BASICRENDER_UNITTEST_BUFFER_FSLGRAPHICS3D_BASICRENDER_UNITTEST_NATIVEBUFFERTESTFACTORY_HPP
+#define FSLGRAPHICS3D_BASICRENDER_UNITTEST_BUFFER_FSLGRAPHICS3D_BASICRENDER_UNITTEST_NATIVEBUFFERTESTFACTORY_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/HandleVector.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslGraphics3D/BasicRender/Adapter/INativeBufferFactory.hpp>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace Fsl
+{
+  //! CPU only buffer factory that stores the buffer content so it can be inspected by the tests
+  class NativeBufferTestFactory final : public Graphics3D::INativeBufferFactory
+  {
+  public:
+    struct Record
+    {
+      BasicBufferType Type{BasicBufferType::Index};
+      uint32_t ElementStride{0};
+      uint32_t ElementCapacity{0};
+      bool IsDynamic{false};
+      std::vector<uint8_t> Content;
+    };
+
+  private:
+    Graphics3D::NativeBufferFactoryCaps m_caps;
+    HandleVector<Record> m_buffers;
+    uint32_t m_createCount{0};
+    uint32_t m_setDataCount{0};
+
+  public:
+    explicit NativeBufferTestFactory(const Graphics3D::NativeBufferFactoryCaps caps = Graphics3D::NativeBufferFactoryCaps::Dynamic)
+      : m_caps(caps)
+    {
+    }
+
+    uint32_t BufferCount() const noexcept
+    {
+      return m_buffers.Count();
+    }
+
+    uint32_t CreateCount() const noexcept
+    {
+      return m_createCount;
+    }
+
+    uint32_t SetDataCount() const noexcept
+    {
+      return m_setDataCount;
+    }
+
+    const Record& Get(const BasicNativeBufferHandle hBuffer) const
+    {
+      return m_buffers.Get(hBuffer.Value);
+    }
+
+    Graphics3D::NativeBufferFactoryCaps GetBufferCaps() const noexcept final
+    {
+      return m_caps;
+    }
+
+    BasicNativeBufferHandle CreateBuffer(const BasicBufferType bufferType, ReadOnlyFlexSpan bufferData, const uint32_t bufferElementCapacity,
+                                         const bool isDynamic) final
+    {
+      if (bufferData.size() > bufferElementCapacity)
+      {
+        throw NotSupportedException("bufferData does not fit within bufferElementCapacity");
+      }
+      const auto stride = static_cast<uint32_t>(bufferData.stride());
+      Record record{bufferType, stride, bufferElementCapacity, isDynamic, std::vector<uint8_t>(std::size_t(bufferElementCapacity) * stride)};
+      if (!bufferData.empty())
+      {
+        std::memcpy(record.Content.data(), bufferData.data(), bufferData.byte_size());
+      }
+      ++m_createCount;
+      return BasicNativeBufferHandle(m_buffers.Add(std::move(record)));
+    }
+
+    bool DestroyBuffer(const BasicNativeBufferHandle hBuffer) noexcept final
+    {
+      return m_buffers.Remove(hBuffer.Value);
+    }
+
+    void SetBufferData(const BasicNativeBufferHandle hBuffer, const uint32_t dstIndex, ReadOnlyFlexSpan bufferData) final
+    {
+      Record& rRecord = m_buffers.Get(hBuffer.Value);
+      if (!rRecord.IsDynamic || bufferData.stride() != rRecord.ElementStride)
+      {
+        throw std::invalid_argument("Supplied buffer is not compatible");
+      }
+      if ((std::size_t(dstIndex) + bufferData.size()) > rRecord.ElementCapacity)
+      {
+        throw IndexOutOfRangeException("SetBufferData");
+      }
+      std::memcpy(rRecord.Content.data() + (std::size_t(dstIndex) * rRecord.ElementStride), bufferData.data(), bufferData.byte_size());
+      ++m_setDataCount;
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,528 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Span/ReadOnlyFlexSpanUtil_Array.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <FslGraphics3D/BasicRender/Buffer/BasicBufferManager.hpp>
+#include <FslGraphics3D/BasicRender/Buffer/BasicBufferRingAllocator.hpp>
+#include <array>
+#include <cstring>
+#include <memory>
+#include "NativeBufferTestFactory.hpp"
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t MaxFramesInFlight = 2;
+    constexpr uint32_t ChunkByteCapacity = 256;
+    constexpr uint32_t MinAlignment = 16;
+  }
+
+  struct TestVertex
+  {
+    float X{0};
+    float Y{0};
+    float Z{0};
+  };
+
+  class TestBasicBufferRingAllocator : public TestFixtureFslGraphics
+  {
+  public:
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    std::shared_ptr<NativeBufferTestFactory> m_testFactory;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    Graphics3D::BasicBufferRingAllocator m_allocator;
+
+    TestBasicBufferRingAllocator()
+      : m_testFactory(std::make_shared<NativeBufferTestFactory>())
+      , m_allocator(LocalConfig::MaxFramesInFlight, m_testFactory, LocalConfig::ChunkByteCapacity, LocalConfig::MinAlignment)
+    {
+    }
+  };
+
+  template <std::size_t TSize>
+  bool ContentEquals(const NativeBufferTestFactory& factory, const Graphics3D::BasicBufferRingAllocation& allocation,
+                     const std::array<TestVertex, TSize>& expected)
+  {
+    const auto& record = factory.Get(allocation.NativeHandle);
+    return allocation.ByteSize == sizeof(expected) &&
+           std::memcmp(record.Content.data() + allocation.ByteOffset, expected.data(), sizeof(expected)) == 0;
+  }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+TEST_F(TestBasicBufferRingAllocator, Construct_Default)
+{
+  const auto& stats = m_allocator.GetStats();
+  EXPECT_EQ(0u, stats.NativeBufferCount);
+  EXPECT_EQ(0u, stats.ReservedBytes);
+  EXPECT_EQ(0u, m_testFactory->BufferCount());
+  EXPECT_EQ(LocalConfig::ChunkByteCapacity, m_allocator.GetChunkByteCapacity());
+}
+
+TEST_F(TestBasicBufferRingAllocator, Construct_InvalidArguments)
+{
+  EXPECT_THROW(Graphics3D::BasicBufferRingAllocator(0, m_testFactory), std::invalid_argument);
+  EXPECT_THROW(Graphics3D::BasicBufferRingAllocator(1, {}), std::invalid_argument);
+  EXPECT_THROW(Graphics3D::BasicBufferRingAllocator(1, m_testFactory, 0), std::invalid_argument);
+  EXPECT_THROW(Graphics3D::BasicBufferRingAllocator(1, m_testFactory, 16, 0), std::invalid_argument);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+TEST_F(TestBasicBufferRingAllocator, Allocate_Empty)
+{
+  EXPECT_THROW(m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpan()), std::invalid_argument);
+}
+
+TEST_F(TestBasicBufferRingAllocator, Allocate_Single)
+{
+  const std::array<TestVertex, 2> vertices = {TestVertex{1, 2, 3}, TestVertex{4, 5, 6}};
+  const auto allocation = m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+
+  EXPECT_TRUE(allocation.IsValid());
+  EXPECT_EQ(0u, allocation.ByteOffset);
+  EXPECT_EQ(sizeof(TestVertex), allocation.ElementStride);
+  EXPECT_EQ(2u, allocation.ElementCount());
+  EXPECT_TRUE(ContentEquals(*m_testFactory, allocation, vertices));
+  EXPECT_EQ(BasicBufferType::Vertex, m_testFactory->Get(allocation.NativeHandle).Type);
+
+  const auto& stats = m_allocator.GetStats();
+  EXPECT_EQ(1u, stats.NativeBufferCount);
+  EXPECT_EQ(LocalConfig::ChunkByteCapacity, stats.ReservedBytes);
+  EXPECT_EQ(1u, stats.CurrentFrame.AllocationCount);
+  EXPECT_EQ(sizeof(vertices), stats.CurrentFrame.AllocatedBytes);
+}
+
+TEST_F(TestBasicBufferRingAllocator, Allocate_SharesNativeBuffer)
+{
+  // lcm(16, 12) = 48 byte alignment
+  const std::array<TestVertex, 1> vertices0 = {TestVertex{1, 2, 3}};
+  const std::array<TestVertex, 2> vertices1 = {TestVertex{4, 5, 6}, TestVertex{7, 8, 9}};
+  const std::array<TestVertex, 1> vertices2 = {TestVertex{10, 11, 12}};
+  const auto allocation0 = m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices0));
+  const auto allocation1 = m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices1));
+  const auto allocation2 = m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices2));
+
+  EXPECT_EQ(allocation0.NativeHandle, allocation1.NativeHandle);
+  EXPECT_EQ(allocation0.NativeHandle, allocation2.NativeHandle);
+  EXPECT_EQ(0u, allocation0.ByteOffset);
+  EXPECT_EQ(48u, allocation1.ByteOffset);
+  EXPECT_EQ(96u, allocation2.ByteOffset);
+  EXPECT_EQ(4u, allocation1.FirstElement());
+  EXPECT_EQ(8u, allocation2.FirstElement());
+  EXPECT_TRUE(ContentEquals(*m_testFactory, allocation0, vertices0));
+  EXPECT_TRUE(ContentEquals(*m_testFactory, allocation1, vertices1));
+  EXPECT_TRUE(ContentEquals(*m_testFactory, allocation2, vertices2));
+
+  const auto& stats = m_allocator.GetStats();
+  EXPECT_EQ(1u, stats.NativeBufferCount);
+  EXPECT_EQ(3u, stats.CurrentFrame.AllocationCount);
+  EXPECT_EQ(48u, stats.CurrentFrame.AllocatedBytes);
+  EXPECT_EQ((48u - 12u) + (48u - 24u), stats.CurrentFrame.PaddingBytes);
+  EXPECT_EQ(0u, stats.CurrentFrame.WastedBytes);
+}
+
+TEST_F(TestBasicBufferRingAllocator, Allocate_IndexAndVertexUseSeparateBuffers)
+{
+  const std::array<uint16_t, 3> indices = {0, 1, 2};
+  const std::array<TestVertex, 1> vertices = {TestVertex{1, 2, 3}};
+  const auto indexAllocation = m_allocator.Allocate(BasicBufferType::Index, ReadOnlyFlexSpanUtil::AsSpan(indices));
+  const auto vertexAllocation = m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+
+  EXPECT_NE(indexAllocation.NativeHandle, vertexAllocation.NativeHandle);
+  EXPECT_EQ(BasicBufferType::Index, m_testFactory->Get(indexAllocation.NativeHandle).Type);
+  EXPECT_EQ(BasicBufferType::Vertex, m_testFactory->Get(vertexAllocation.NativeHandle).Type);
+  EXPECT_EQ(2u, m_allocator.GetStats().NativeBufferCount);
+}
+
+TEST_F(TestBasicBufferRingAllocator, Allocate_ChunkFull)
+{
+  // 16 vertices = 192 bytes, so two allocations can not share a 256 byte chunk
+  std::array<TestVertex, 16> vertices{};
+  const auto allocation0 = m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+  const auto allocation1 = m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+
+  EXPECT_NE(allocation0.NativeHandle, allocation1.NativeHandle);
+  EXPECT_EQ(0u, allocation1.ByteOffset);
+
+  const auto& stats = m_allocator.GetStats();
+  EXPECT_EQ(2u, stats.NativeBufferCount);
+  EXPECT_EQ(LocalConfig::ChunkByteCapacity - 192u, stats.CurrentFrame.WastedBytes);
+  EXPECT_GT(stats.CurrentFrame.Fragmentation(), 0.0f);
+}
+
+TEST_F(TestBasicBufferRingAllocator, Allocate_Dedicated)
+{
+  std::array<TestVertex, 32> vertices{};
+  vertices[31] = TestVertex{1, 2, 3};
+  const auto allocation = m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+
+  EXPECT_EQ(0u, allocation.ByteOffset);
+  EXPECT_TRUE(ContentEquals(*m_testFactory, allocation, vertices));
+  EXPECT_EQ(1u, m_allocator.GetStats().NativeBufferCount);
+  EXPECT_EQ(sizeof(vertices), m_allocator.GetStats().ReservedBytes);
+
+  // The dedicated buffer is destroyed once the frame slot is recycled
+  for (uint32_t i = 0; i < LocalConfig::MaxFramesInFlight; ++i)
+  {
+    EXPECT_EQ(1u, m_testFactory->BufferCount());
+    m_allocator.BeginFrame();
+  }
+  EXPECT_EQ(0u, m_testFactory->BufferCount());
+  EXPECT_EQ(0u, m_allocator.GetStats().NativeBufferCount);
+  EXPECT_EQ(sizeof(vertices), m_allocator.GetStats().HighWaterMarkReservedBytes);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+TEST_F(TestBasicBufferRingAllocator, BeginFrame_RecyclesChunks)
+{
+  std::array<TestVertex, 16> vertices{};
+
+  // Steady state: every frame needs two chunks, but the chunks get reused once their frame slot comes around again
+  for (uint32_t frame = 0; frame < 10; ++frame)
+  {
+    m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+    m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+    m_allocator.BeginFrame();
+  }
+
+  const auto& stats = m_allocator.GetStats();
+  EXPECT_LE(stats.NativeBufferCount, 2u * (LocalConfig::MaxFramesInFlight + 1u));
+  EXPECT_EQ(stats.NativeBufferCount, m_testFactory->CreateCount());
+  EXPECT_EQ(stats.NativeBufferCount, stats.HighWaterMarkNativeBufferCount);
+  EXPECT_EQ(2u, stats.LastFrame.AllocationCount);
+  EXPECT_EQ(0u, stats.CurrentFrame.AllocationCount);
+  EXPECT_EQ(2u * 192u, stats.HighWaterMarkFrameBytes);
+}
+
+TEST_F(TestBasicBufferRingAllocator, BeginFrame_AllocationsUntouchedWhileInFlight)
+{
+  const std::array<TestVertex, 16> vertices0 = {TestVertex{1, 2, 3}};
+  const std::array<TestVertex, 16> vertices1 = {TestVertex{4, 5, 6}};
+  const auto allocation0 = m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices0));
+
+  // Fill the following frames and ensure that the data of the first frame is not overwritten while it might be in flight
+  for (uint32_t frame = 1; frame < LocalConfig::MaxFramesInFlight; ++frame)
+  {
+    m_allocator.BeginFrame();
+    const auto allocation1 = m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices1));
+    EXPECT_NE(allocation0.NativeHandle, allocation1.NativeHandle);
+    EXPECT_TRUE(ContentEquals(*m_testFactory, allocation0, vertices0));
+  }
+}
+
+TEST_F(TestBasicBufferRingAllocator, ReleaseAll)
+{
+  std::array<TestVertex, 16> vertices{};
+  m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+  m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+  m_allocator.ReleaseAll();
+
+  // Both chunks are now available again
+  m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+  m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+  EXPECT_EQ(2u, m_testFactory->CreateCount());
+}
+
+TEST_F(TestBasicBufferRingAllocator, Destroy)
+{
+  std::array<TestVertex, 32> vertices{};
+  m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+  m_allocator.Allocate(BasicBufferType::Index, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+  m_allocator.BeginFrame();
+  m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+  m_allocator.Destroy();
+
+  EXPECT_EQ(0u, m_testFactory->BufferCount());
+  EXPECT_EQ(0u, m_allocator.GetStats().NativeBufferCount);
+  EXPECT_EQ(0u, m_allocator.GetStats().ReservedBytes);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+TEST_F(TestBasicBufferRingAllocator, AllocatePersistent_Empty)
+{
+  const auto allocation = m_allocator.AllocatePersistent(BasicBufferType::Vertex, ReadOnlyFlexSpan(nullptr, 0u, sizeof(TestVertex)));
+
+  EXPECT_TRUE(allocation.IsValid());
+  EXPECT_EQ(0u, allocation.ByteSize);
+  EXPECT_EQ(0u, allocation.ElementCount());
+  EXPECT_EQ(0u, m_testFactory->SetDataCount());
+  EXPECT_EQ(1u, m_allocator.GetStats().LiveAllocationCount);
+}
+
+TEST_F(TestBasicBufferRingAllocator, AllocatePersistent_StaysValidAcrossFrames)
+{
+  const std::array<TestVertex, 2> vertices0 = {TestVertex{1, 2, 3}, TestVertex{4, 5, 6}};
+  const std::array<TestVertex, 16> vertices1{};
+  const auto allocation0 = m_allocator.AllocatePersistent(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices0));
+
+  for (uint32_t frame = 0; frame < 10; ++frame)
+  {
+    m_allocator.BeginFrame();
+    m_allocator.Allocate(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices1));
+    EXPECT_TRUE(ContentEquals(*m_testFactory, allocation0, vertices0));
+  }
+
+  const auto& stats = m_allocator.GetStats();
+  // The persistent allocation and the frame allocations of the frames that might still be in flight
+  EXPECT_EQ(1u + LocalConfig::MaxFramesInFlight, stats.LiveAllocationCount);
+  EXPECT_EQ(sizeof(vertices0) + (LocalConfig::MaxFramesInFlight * sizeof(vertices1)), stats.LiveBytes);
+}
+
+TEST_F(TestBasicBufferRingAllocator, Release_DeferredWhileInFlight)
+{
+  const std::array<TestVertex, 2> vertices0 = {TestVertex{1, 2, 3}, TestVertex{4, 5, 6}};
+  const std::array<TestVertex, 2> vertices1 = {TestVertex{7, 8, 9}, TestVertex{10, 11, 12}};
+  const auto allocation0 = m_allocator.AllocatePersistent(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices0));
+  m_allocator.Release(BasicBufferType::Vertex, allocation0);
+
+  // The released range is not reused while frames that might reference it are in flight
+  for (uint32_t frame = 1; frame < LocalConfig::MaxFramesInFlight; ++frame)
+  {
+    m_allocator.BeginFrame();
+    const auto allocation1 = m_allocator.AllocatePersistent(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices1));
+    EXPECT_NE(allocation0.ByteOffset, allocation1.ByteOffset);
+    EXPECT_TRUE(ContentEquals(*m_testFactory, allocation0, vertices0));
+    m_allocator.Release(BasicBufferType::Vertex, allocation1);
+  }
+  EXPECT_GT(m_allocator.GetStats().LiveAllocationCount, 0u);
+
+  for (uint32_t frame = 0; frame < LocalConfig::MaxFramesInFlight; ++frame)
+  {
+    m_allocator.BeginFrame();
+  }
+  const auto& stats = m_allocator.GetStats();
+  EXPECT_EQ(0u, stats.LiveAllocationCount);
+  EXPECT_EQ(0u, stats.LiveBytes);
+  EXPECT_EQ(0u, stats.ConsumedBytes);
+
+  // As nothing references the chunk anymore it is allocated from the start again
+  const auto allocation2 = m_allocator.AllocatePersistent(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices1));
+  EXPECT_EQ(allocation0.NativeHandle, allocation2.NativeHandle);
+  EXPECT_EQ(0u, allocation2.ByteOffset);
+  EXPECT_EQ(1u, m_testFactory->CreateCount());
+}
+
+TEST_F(TestBasicBufferRingAllocator, Release_Invalid)
+{
+  m_allocator.Release(BasicBufferType::Vertex, {});
+  m_allocator.BeginFrame();
+  m_allocator.BeginFrame();
+  EXPECT_EQ(0u, m_allocator.GetStats().LiveAllocationCount);
+}
+
+TEST_F(TestBasicBufferRingAllocator, Release_Dedicated)
+{
+  std::array<TestVertex, 32> vertices{};
+  const auto allocation = m_allocator.AllocatePersistent(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+  for (uint32_t i = 0; i < 4; ++i)
+  {
+    m_allocator.BeginFrame();
+  }
+  EXPECT_EQ(1u, m_testFactory->BufferCount());
+
+  m_allocator.Release(BasicBufferType::Vertex, allocation);
+  for (uint32_t i = 0; i < LocalConfig::MaxFramesInFlight; ++i)
+  {
+    EXPECT_EQ(1u, m_testFactory->BufferCount());
+    m_allocator.BeginFrame();
+  }
+  EXPECT_EQ(0u, m_testFactory->BufferCount());
+  EXPECT_EQ(0u, m_allocator.GetStats().ConsumedBytes);
+}
+
+TEST_F(TestBasicBufferRingAllocator, Stats_FragmentationAndHighWaterMark)
+{
+  // 16 vertices = 192 bytes, so two allocations can not share a 256 byte chunk
+  std::array<TestVertex, 16> vertices{};
+  const auto allocation0 = m_allocator.AllocatePersistent(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+  const auto allocation1 = m_allocator.AllocatePersistent(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+  EXPECT_NE(allocation0.NativeHandle, allocation1.NativeHandle);
+
+  {
+    const auto& stats = m_allocator.GetStats();
+    EXPECT_EQ(2u, stats.LiveAllocationCount);
+    EXPECT_EQ(2u * 192u, stats.LiveBytes);
+    // The first chunk is retired, so its unused tail is consumed as well
+    EXPECT_EQ(LocalConfig::ChunkByteCapacity + 192u, stats.ConsumedBytes);
+    EXPECT_FLOAT_EQ(64.0f / 448.0f, stats.Fragmentation());
+  }
+
+  m_allocator.Release(BasicBufferType::Vertex, allocation0);
+  for (uint32_t i = 0; i < LocalConfig::MaxFramesInFlight; ++i)
+  {
+    m_allocator.BeginFrame();
+  }
+
+  const auto& stats = m_allocator.GetStats();
+  EXPECT_EQ(1u, stats.LiveAllocationCount);
+  EXPECT_EQ(192u, stats.LiveBytes);
+  EXPECT_EQ(192u, stats.ConsumedBytes);
+  EXPECT_FLOAT_EQ(0.0f, stats.Fragmentation());
+  EXPECT_EQ(2u * 192u, stats.HighWaterMarkLiveBytes);
+  // The retired chunk was recycled, not destroyed
+  EXPECT_EQ(2u, stats.NativeBufferCount);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+TEST_F(TestBasicBufferRingAllocator, BufferManager_AllocateFrameBuffer)
+{
+  auto factory = std::make_shared<NativeBufferTestFactory>();
+  {
+    Graphics3D::BasicBufferManager manager(LocalConfig::MaxFramesInFlight, factory);
+    manager.CreateDependentResources();
+
+    const std::array<TestVertex, 2> vertices = {TestVertex{1, 2, 3}, TestVertex{4, 5, 6}};
+    const auto allocation0 = manager.AllocateFrameBuffer(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+    const auto allocation1 = manager.AllocateFrameBuffer(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices));
+    EXPECT_EQ(allocation0.NativeHandle, allocation1.NativeHandle);
+    EXPECT_TRUE(ContentEquals(*factory, allocation1, vertices));
+    EXPECT_EQ(2u, manager.GetFrameBufferStats().CurrentFrame.AllocationCount);
+
+    manager.PreUpdate();
+    EXPECT_EQ(2u, manager.GetFrameBufferStats().LastFrame.AllocationCount);
+    manager.DestroyDependentResources();
+  }
+  EXPECT_EQ(0u, factory->BufferCount());
+}
+
+TEST_F(TestBasicBufferRingAllocator, BufferManager_AllocateFrameBuffer_NotSupported)
+{
+  auto factory = std::make_shared<NativeBufferTestFactory>(Graphics3D::NativeBufferFactoryCaps::NotDefined);
+  Graphics3D::BasicBufferManager manager(LocalConfig::MaxFramesInFlight, factory);
+
+  const std::array<TestVertex, 1> vertices = {TestVertex{1, 2, 3}};
+  EXPECT_THROW(manager.AllocateFrameBuffer(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices)), NotSupportedException);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+TEST_F(TestBasicBufferRingAllocator, BufferManager_CreateDynamicBuffer_SubAllocated)
+{
+  auto factory = std::make_shared<NativeBufferTestFactory>();
+  {
+    Graphics3D::BasicBufferManager manager(LocalConfig::MaxFramesInFlight, factory);
+    manager.CreateDependentResources();
+
+    const std::array<TestVertex, 2> vertices0 = {TestVertex{1, 2, 3}, TestVertex{4, 5, 6}};
+    const std::array<TestVertex, 2> vertices1 = {TestVertex{7, 8, 9}, TestVertex{10, 11, 12}};
+    auto buffer0 = manager.CreateDynamicBuffer(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices0), 4);
+    auto buffer1 = manager.CreateDynamicBuffer(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices1), 4);
+
+    // Both buffers share one native buffer
+    EXPECT_EQ(1u, factory->BufferCount());
+    EXPECT_EQ(buffer0->TryGetNativeHandle(), buffer1->TryGetNativeHandle());
+    EXPECT_NE(buffer0->GetNativeByteOffset(), buffer1->GetNativeByteOffset());
+    EXPECT_EQ(4u, buffer0->Capacity());
+    EXPECT_TRUE(ContentEquals(*factory, {buffer0->TryGetNativeHandle(), buffer0->GetNativeByteOffset(), sizeof(vertices0), sizeof(TestVertex)},
+                              vertices0));
+    EXPECT_TRUE(ContentEquals(*factory, {buffer1->TryGetNativeHandle(), buffer1->GetNativeByteOffset(), sizeof(vertices1), sizeof(TestVertex)},
+                              vertices1));
+    EXPECT_EQ(2u, manager.GetFrameBufferStats().LiveAllocationCount);
+
+    // SetData writes to a new range and leaves the old one untouched as it might still be in flight
+    const uint32_t oldByteOffset = buffer0->GetNativeByteOffset();
+    buffer0->SetData(ReadOnlyFlexSpanUtil::AsSpan(vertices1));
+    EXPECT_NE(oldByteOffset, buffer0->GetNativeByteOffset());
+    EXPECT_TRUE(ContentEquals(*factory, {buffer0->TryGetNativeHandle(), oldByteOffset, sizeof(vertices0), sizeof(TestVertex)}, vertices0));
+    EXPECT_TRUE(ContentEquals(*factory, {buffer0->TryGetNativeHandle(), buffer0->GetNativeByteOffset(), sizeof(vertices1), sizeof(TestVertex)},
+                              vertices1));
+    EXPECT_EQ(3u, manager.GetFrameBufferStats().LiveAllocationCount);
+
+    // Once the frames that might reference the old range have completed it is released
+    for (uint32_t i = 0; i < LocalConfig::MaxFramesInFlight; ++i)
+    {
+      manager.PreUpdate();
+    }
+    EXPECT_EQ(2u, manager.GetFrameBufferStats().LiveAllocationCount);
+    EXPECT_EQ(1u, factory->BufferCount());
+
+    // Destroying the buffers releases their ranges
+    buffer0.reset();
+    buffer1.reset();
+    for (uint32_t i = 0; i < (2u * LocalConfig::MaxFramesInFlight) + 1u; ++i)
+    {
+      manager.PreUpdate();
+    }
+    EXPECT_EQ(0u, manager.GetFrameBufferStats().LiveAllocationCount);
+    manager.DestroyDependentResources();
+  }
+  EXPECT_EQ(0u, factory->BufferCount());
+}
+
+TEST_F(TestBasicBufferRingAllocator, BufferManager_CreateDynamicBuffer_LargeNotSubAllocated)
+{
+  auto factory = std::make_shared<NativeBufferTestFactory>();
+  Graphics3D::BasicBufferManager manager(LocalConfig::MaxFramesInFlight, factory, 64);
+
+  const std::array<TestVertex, 2> vertices = {TestVertex{1, 2, 3}, TestVertex{4, 5, 6}};
+  // 6 * 12 = 72 bytes exceeds the 64 byte limit
+  auto buffer = manager.CreateDynamicBuffer(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices), 6);
+
+  EXPECT_EQ(0u, buffer->GetNativeByteOffset());
+  EXPECT_EQ(0u, manager.GetFrameBufferStats().LiveAllocationCount);
+  EXPECT_EQ(6u, factory->Get(buffer->TryGetNativeHandle()).ElementCapacity);
+}
+
+TEST_F(TestBasicBufferRingAllocator, BufferManager_CreateDynamicBuffer_SubAllocationDisabled)
+{
+  auto factory = std::make_shared<NativeBufferTestFactory>();
+  Graphics3D::BasicBufferManager manager(LocalConfig::MaxFramesInFlight, factory, 0);
+
+  const std::array<TestVertex, 1> vertices = {TestVertex{1, 2, 3}};
+  auto buffer0 = manager.CreateDynamicBuffer(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices), 1);
+  auto buffer1 = manager.CreateDynamicBuffer(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices), 1);
+
+  EXPECT_NE(buffer0->TryGetNativeHandle(), buffer1->TryGetNativeHandle());
+  EXPECT_EQ(0u, manager.GetFrameBufferStats().LiveAllocationCount);
+}
+
+TEST_F(TestBasicBufferRingAllocator, BufferManager_CreateDynamicBuffer_FactoryNotDynamic)
+{
+  auto factory = std::make_shared<NativeBufferTestFactory>(Graphics3D::NativeBufferFactoryCaps::NotDefined);
+  Graphics3D::BasicBufferManager manager(LocalConfig::MaxFramesInFlight, factory);
+
+  const std::array<TestVertex, 1> vertices = {TestVertex{1, 2, 3}};
+  auto buffer0 = manager.CreateDynamicBuffer(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices), 1);
+  auto buffer1 = manager.CreateDynamicBuffer(BasicBufferType::Vertex, ReadOnlyFlexSpanUtil::AsSpan(vertices), 1);
+
+  EXPECT_NE(buffer0->TryGetNativeHandle(), buffer1->TryGetNativeHandle());
+  EXPECT_EQ(0u, manager.GetFrameBufferStats().LiveAllocationCount);
+}
@@ -70,10 +70,12 @@ namespace Fsl
       virtual void BeginCmds() = 0;
       virtual void EndCmds() noexcept = 0;
       virtual void CmdSetCamera(const BasicCameraInfo& cameraInfo) = 0;
-      virtual void CmdBindIndexBuffer(const BasicNativeBufferHandle indexBuffer) = 0;
+      //! @param byteOffset the byte offset of the first index inside the native buffer
+      virtual void CmdBindIndexBuffer(const BasicNativeBufferHandle indexBuffer, const uint32_t byteOffset) = 0;
       virtual void CmdBindMaterial(const BasicNativeMaterialHandle material, const BasicMaterialVariables& materialVariables,
                                    const ReadOnlySpan<BasicNativeTextureHandle> textures) = 0;
-      virtual void CmdBindVertexBuffer(const BasicNativeBufferHandle vertexBuffer) = 0;
+      //! @param byteOffset the byte offset of the first vertex inside the native buffer
+      virtual void CmdBindVertexBuffer(const BasicNativeBufferHandle vertexBuffer, const uint32_t byteOffset) = 0;
       virtual void CmdDraw(const uint32_t vertexCount, const uint32_t firstVertex) noexcept = 0;
       virtual void CmdDrawIndexed(const uint32_t indexCount, const uint32_t firstIndex) noexcept = 0;
     };
@@ -35,6 +35,7 @@
 #include <FslGraphics/Render/Basic/BasicBufferType.hpp>
 #include <FslGraphics/Render/Basic/BasicRenderSystemEvent.hpp>
 #include <FslGraphics3D/BasicRender/Adapter/NativeBufferFactoryCaps.hpp>
+#include <FslGraphics3D/BasicRender/Buffer/BasicBufferRingAllocator.hpp>
 #include <FslGraphics3D/BasicRender/Buffer/BasicDynamicBufferTracker.hpp>
 #include <FslGraphics3D/BasicRender/Buffer/BasicStaticBufferTracker.hpp>
 #include <memory>
@@ -96,15 +97,24 @@ namespace Fsl::Graphics3D
     };
 
 
+  public:
+    //! Dynamic buffers up to this size are sub-allocated from the shared native buffers of the ring allocator by default
+    static constexpr uint32_t DefaultSubAllocationMaxByteCapacity = BasicBufferRingAllocator::DefaultChunkByteCapacity / 4;
+
+  private:
     uint32_t m_maxFramesInFlight;
     std::shared_ptr<INativeBufferFactory> m_factory;
     NativeBufferFactoryCaps m_factoryCaps;
+    uint32_t m_subAllocationMaxByteCapacity;
+    BasicBufferRingAllocator m_ringAllocator;
     std::vector<StaticRecord> m_staticRecords;
     std::vector<DynamicRecord> m_dynamicRecords;
     DependentResources m_dependentResources;
 
   public:
-    explicit BasicBufferManager(const uint32_t maxFramesInFlight, std::shared_ptr<INativeBufferFactory> factory);
+    //! @param subAllocationMaxByteCapacity dynamic buffers with a byte capacity up to this are sub-allocated (zero disables sub-allocation).
+    explicit BasicBufferManager(const uint32_t maxFramesInFlight, std::shared_ptr<INativeBufferFactory> factory,
+                                const uint32_t subAllocationMaxByteCapacity = DefaultSubAllocationMaxByteCapacity);
     ~BasicBufferManager();
 
     void CreateDependentResources();
@@ -112,8 +122,18 @@ namespace Fsl::Graphics3D
     void DestroyDependentResources();
 
     std::shared_ptr<IBasicStaticBuffer> CreateStaticBuffer(const BasicBufferType bufferType, ReadOnlyFlexSpan bufferData);
+    //! @brief Create a dynamic buffer, small buffers are sub-allocated from shared native buffers when the factory supports dynamic buffers.
     std::shared_ptr<IBasicDynamicBuffer> CreateDynamicBuffer(const BasicBufferType bufferType, ReadOnlyFlexSpan bufferData, const uint32_t capacity);
 
+    //! @brief Copy the data into a range of a shared native buffer that is valid for the current frame only.
+    //!        This avoids creating a set of native buffers for data that is rebuilt every frame.
+    BasicBufferRingAllocation AllocateFrameBuffer(const BasicBufferType bufferType, ReadOnlyFlexSpan bufferData);
+
+    //! @brief Get the stats of the allocator used for frame buffers and sub-allocated dynamic buffers
+    const BasicBufferRingAllocatorStats& GetFrameBufferStats() const noexcept
+    {
+      return m_ringAllocator.GetStats();
+    }
 
     //! We expect this to be called once, early in the frame
     void PreUpdate();
@@ -0,0 +1,88 @@
+#ifndef FSLGRAPHICS3D_BASICRENDER_BUFFER_BASICBUFFERRINGALLOCATION_HPP
+#define FSLGRAPHICS3D_BASICRENDER_BUFFER_BASICBUFFERRINGALLOCATION_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/Render/Basic/Adapter/BasicNativeBufferHandle.hpp>
+#include <cstdint>
+
+namespace Fsl::Graphics3D
+{
+  //! A range inside a shared native buffer handed out by the BasicBufferRingAllocator.
+  //! A frame allocation is only valid for the frame it was allocated in, a persistent allocation until it is released.
+  struct BasicBufferRingAllocation
+  {
+    BasicNativeBufferHandle NativeHandle;
+    //! The byte offset of the first element inside the native buffer (always a multiple of ElementStride).
+    uint32_t ByteOffset{0};
+    uint32_t ByteSize{0};
+    uint32_t ElementStride{0};
+
+    BasicBufferRingAllocation() noexcept = default;
+
+    constexpr BasicBufferRingAllocation(const BasicNativeBufferHandle nativeHandle, const uint32_t byteOffset, const uint32_t byteSize,
+                                        const uint32_t elementStride) noexcept
+      : NativeHandle(nativeHandle)
+      , ByteOffset(byteOffset)
+      , ByteSize(byteSize)
+      , ElementStride(elementStride)
+    {
+    }
+
+    constexpr bool IsValid() const noexcept
+    {
+      return NativeHandle.IsValid();
+    }
+
+    //! @brief The index of the first element inside the native buffer (can be used as firstVertex / firstIndex)
+    constexpr uint32_t FirstElement() const noexcept
+    {
+      return ElementStride > 0u ? ByteOffset / ElementStride : 0u;
+    }
+
+    constexpr uint32_t ElementCount() const noexcept
+    {
+      return ElementStride > 0u ? ByteSize / ElementStride : 0u;
+    }
+
+    constexpr bool operator==(const BasicBufferRingAllocation& rhs) const noexcept
+    {
+      return NativeHandle == rhs.NativeHandle && ByteOffset == rhs.ByteOffset && ByteSize == rhs.ByteSize && ElementStride == rhs.ElementStride;
+    }
+
+    constexpr bool operator!=(const BasicBufferRingAllocation& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef FSLGRAPHICS3D_BASICRENDER_BUFFER_BASICBUFFERRINGALLOCATOR_HPP
+#define FSLGRAPHICS3D_BASICRENDER_BUFFER_BASICBUFFERRINGALLOCATOR_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/ReadOnlyFlexSpan.hpp>
+#include <FslGraphics/Render/Basic/Adapter/BasicNativeBufferHandle.hpp>
+#include <FslGraphics/Render/Basic/BasicBufferType.hpp>
+#include <FslGraphics3D/BasicRender/Buffer/BasicBufferRingAllocation.hpp>
+#include <FslGraphics3D/BasicRender/Buffer/BasicBufferRingAllocatorStats.hpp>
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace Fsl::Graphics3D
+{
+  class INativeBufferFactory;
+
+  //! Sub-allocates buffer data from a small set of large dynamic native buffers (chunks).
+  //! Allocations are placed linearly in the active chunk of their buffer type, when it runs full the chunk is retired and a free one is picked
+  //! (or created). A retired chunk becomes free again once all of its allocations have been released.
+  //! Released allocations are kept untouched until maxFramesInFlight frames have passed, so frames that might still reference them can complete.
+  //! - Frame allocations (Allocate) are released automatically at the end of the frame they were allocated in.
+  //! - Persistent allocations (AllocatePersistent) stay valid until they are released by calling Release.
+  //! Allocations larger than the chunk capacity get a dedicated native buffer that is destroyed when the allocation is no longer referenced.
+  class BasicBufferRingAllocator final
+  {
+  public:
+    static constexpr uint32_t DefaultChunkByteCapacity = 256 * 1024;
+    static constexpr uint32_t DefaultMinAlignment = 16;
+
+  private:
+    struct Chunk
+    {
+      BasicNativeBufferHandle NativeHandle;
+      uint32_t ByteCapacity{0};
+      uint32_t ByteOffset{0};
+      //! The number of allocations in the chunk that are still referenced (this includes released allocations that might be in flight)
+      uint32_t LiveAllocationCount{0};
+      bool IsDedicated{false};
+
+      Chunk() = default;
+      Chunk(const BasicNativeBufferHandle nativeHandle, const uint32_t byteCapacity, const bool isDedicated)
+        : NativeHandle(nativeHandle)
+        , ByteCapacity(byteCapacity)
+        , IsDedicated(isDedicated)
+      {
+      }
+    };
+
+    struct Pool
+    {
+      Chunk Active;
+      //! Chunks that are full (or dedicated) but still contain live allocations
+      std::vector<Chunk> Retired;
+      std::vector<Chunk> Free;
+    };
+
+    struct PendingRelease
+    {
+      BasicNativeBufferHandle NativeHandle;
+      uint32_t ByteSize{0};
+
+      PendingRelease() = default;
+      PendingRelease(const BasicNativeBufferHandle nativeHandle, const uint32_t byteSize)
+        : NativeHandle(nativeHandle)
+        , ByteSize(byteSize)
+      {
+      }
+    };
+
+    struct FrameRecord
+    {
+      //! The allocations released during the frame indexed by BasicBufferType
+      std::array<std::vector<PendingRelease>, 2> Released;
+    };
+
+    std::shared_ptr<INativeBufferFactory> m_factory;
+    uint32_t m_chunkByteCapacity;
+    uint32_t m_minAlignment;
+    std::array<Pool, 2> m_pools;
+    std::vector<FrameRecord> m_frames;
+    uint32_t m_frameIndex{0};
+    BasicBufferRingAllocatorStats m_stats;
+
+  public:
+    BasicBufferRingAllocator(const uint32_t maxFramesInFlight, std::shared_ptr<INativeBufferFactory> factory,
+                             const uint32_t chunkByteCapacity = DefaultChunkByteCapacity, const uint32_t minAlignment = DefaultMinAlignment);
+    ~BasicBufferRingAllocator();
+
+    //! @brief Destroy all native buffers, only call this when the device is idle
+    void Destroy() noexcept;
+
+    //! @brief Start a new frame, the allocations released in the oldest frame slot are no longer referenced so their memory can be reused.
+    void BeginFrame();
+
+    //! @brief Finish all pending releases (only call this when the device is idle).
+    void ReleaseAll();
+
+    //! @brief Copy the data to a range of a shared native buffer.
+    //! @note The returned range is only valid until the frame slot is recycled (maxFramesInFlight calls to BeginFrame).
+    BasicBufferRingAllocation Allocate(const BasicBufferType bufferType, ReadOnlyFlexSpan bufferData);
+
+    //! @brief Copy the data to a range of a shared native buffer that stays valid until Release is called.
+    //! @note Unlike Allocate the data can be empty, the allocation then refers to a empty range of a valid native buffer.
+    BasicBufferRingAllocation AllocatePersistent(const BasicBufferType bufferType, ReadOnlyFlexSpan bufferData);
+
+    //! @brief Release a allocation returned by AllocatePersistent, its memory is reused once maxFramesInFlight frames have passed.
+    //!        Releasing a invalid allocation does nothing.
+    void Release(const BasicBufferType bufferType, const BasicBufferRingAllocation& allocation);
+
+    const BasicBufferRingAllocatorStats& GetStats() const noexcept
+    {
+      return m_stats;
+    }
+
+    uint32_t GetChunkByteCapacity() const noexcept
+    {
+      return m_chunkByteCapacity;
+    }
+
+  private:
+    BasicBufferRingAllocation DoAllocate(const std::size_t poolIndex, const BasicBufferType bufferType, ReadOnlyFlexSpan bufferData);
+    Chunk AcquireChunk(Pool& rPool, const BasicBufferType bufferType, const uint32_t minByteCapacity);
+    void RetireActiveChunk(Pool& rPool) noexcept;
+    void RecycleChunk(Pool& rPool, Chunk chunk) noexcept;
+    void RecycleFrame(FrameRecord& rFrame) noexcept;
+    void FinishRelease(Pool& rPool, const PendingRelease& release) noexcept;
+    void DestroyChunk(Chunk& rChunk) noexcept;
+  };
+}
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef FSLGRAPHICS3D_BASICRENDER_BUFFER_BASICBUFFERRINGALLOCATORSTATS_HPP
+#define FSLGRAPHICS3D_BASICRENDER_BUFFER_BASICBUFFERRINGALLOCATORSTATS_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <cstdint>
+
+namespace Fsl::Graphics3D
+{
+  struct BasicBufferRingAllocatorFrameStats
+  {
+    uint32_t AllocationCount{0};
+    //! The number of bytes requested by the allocations
+    uint64_t AllocatedBytes{0};
+    //! The number of bytes lost to alignment
+    uint64_t PaddingBytes{0};
+    //! The number of bytes left unused at the end of native buffers that had to be retired early because the next allocation did not fit
+    uint64_t WastedBytes{0};
+
+    //! @brief The fraction of the consumed native buffer memory that could not be used for data (0 = no fragmentation).
+    constexpr float Fragmentation() const noexcept
+    {
+      const uint64_t lostBytes = PaddingBytes + WastedBytes;
+      const uint64_t totalBytes = AllocatedBytes + lostBytes;
+      return totalBytes > 0u ? static_cast<float>(static_cast<double>(lostBytes) / static_cast<double>(totalBytes)) : 0.0f;
+    }
+  };
+
+  struct BasicBufferRingAllocatorStats
+  {
+    //! The current number of native buffers owned by the allocator
+    uint32_t NativeBufferCount{0};
+    //! The combined capacity of all native buffers owned by the allocator
+    uint64_t ReservedBytes{0};
+
+    uint32_t HighWaterMarkNativeBufferCount{0};
+    uint64_t HighWaterMarkReservedBytes{0};
+    //! The highest number of bytes (including padding) consumed by a single frame
+    uint64_t HighWaterMarkFrameBytes{0};
+
+    //! The number of allocations whose memory can not be reused yet (this includes released allocations that might still be in flight)
+    uint32_t LiveAllocationCount{0};
+    //! The number of bytes requested by the live allocations
+    uint64_t LiveBytes{0};
+    //! The number of native buffer bytes that can not be allocated from until their chunk is recycled.
+    //! This is the live bytes plus the alignment padding, the unused chunk tails and the space of the released allocations in chunks that are
+    //! still in use.
+    uint64_t ConsumedBytes{0};
+    uint64_t HighWaterMarkLiveBytes{0};
+
+    BasicBufferRingAllocatorFrameStats CurrentFrame;
+    BasicBufferRingAllocatorFrameStats LastFrame;
+
+    //! @brief The fraction of the consumed native buffer memory that is not used by live allocations (0 = no fragmentation).
+    constexpr float Fragmentation() const noexcept
+    {
+      return ConsumedBytes > LiveBytes ? static_cast<float>(static_cast<double>(ConsumedBytes - LiveBytes) / static_cast<double>(ConsumedBytes))
+                                       : 0.0f;
+    }
+  };
+}
+
+#endif
@@ -35,6 +35,7 @@
 #include <FslGraphics/Render/Basic/Adapter/BasicNativeBufferHandle.hpp>
 #include <FslGraphics/Render/Basic/BasicBufferType.hpp>
 #include <FslGraphics/Render/Basic/BasicRenderSystemEvent.hpp>
+#include <FslGraphics3D/BasicRender/Buffer/BasicBufferRingAllocation.hpp>
 #include <cassert>
 #include <memory>
 #include <utility>
@@ -42,8 +43,11 @@
 
 namespace Fsl::Graphics3D
 {
+  class BasicBufferRingAllocator;
   class INativeBufferFactory;
 
+  //! A dynamic buffer is either backed by its own set of native buffers (one per frame in flight) or sub-allocated from the shared native buffers
+  //! of a BasicBufferRingAllocator.
   class BasicDynamicBufferLink final
   {
     struct Record
@@ -57,6 +61,9 @@ namespace Fsl::Graphics3D
     std::shared_ptr<INativeBufferFactory> m_factory;
     BasicBufferType m_bufferType;
     std::vector<Record> m_buffers;
+    //! Only valid when the buffer is sub-allocated
+    BasicBufferRingAllocator* m_pAllocator{nullptr};
+    BasicBufferRingAllocation m_allocation;
     uint32_t m_activeIndex{0};
     bool m_setDataSupported{false};
     bool m_swapchainValid{true};
@@ -66,6 +73,10 @@ namespace Fsl::Graphics3D
   public:
     BasicDynamicBufferLink(const uint32_t maxFramesInFlight, std::shared_ptr<INativeBufferFactory> factory, const BasicBufferType bufferType,
                            ReadOnlyFlexSpan bufferData, const uint32_t bufferElementCapacity, const bool setDataSupported);
+    //! @brief Create a buffer that is sub-allocated from the given allocator.
+    //! @note The allocator must outlive the link or Destroy must be called before the allocator is destroyed.
+    BasicDynamicBufferLink(BasicBufferRingAllocator& rAllocator, const BasicBufferType bufferType, ReadOnlyFlexSpan bufferData,
+                           const uint32_t bufferElementCapacity);
     ~BasicDynamicBufferLink();
     void Destroy();
 
@@ -91,9 +102,24 @@ namespace Fsl::Graphics3D
     //! @brief Try to get the native texture
     BasicNativeBufferHandle TryGetNativeHandle() const noexcept
     {
+      if (m_pAllocator != nullptr)
+      {
+        return m_allocation.NativeHandle;
+      }
       return m_activeIndex < m_buffers.size() ? m_buffers[m_activeIndex].NativeHandle : BasicNativeBufferHandle::Invalid();
     }
 
+    //! @brief Get the byte offset of the content inside the native buffer
+    uint32_t GetNativeByteOffset() const noexcept
+    {
+      return m_allocation.ByteOffset;
+    }
+
+    bool IsSubAllocated() const noexcept
+    {
+      return m_pAllocator != nullptr;
+    }
+
   private:
     static void SetData(Record& rRecord, INativeBufferFactory& factory, const BasicBufferType bufferType, ReadOnlyFlexSpan bufferData,
                         const uint32_t bufferElementCapacity, const bool setDataSupported);
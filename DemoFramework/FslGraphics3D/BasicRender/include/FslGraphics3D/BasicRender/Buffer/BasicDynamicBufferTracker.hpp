@@ -80,6 +80,12 @@ namespace Fsl::Graphics3D
       return pLink != nullptr ? pLink->TryGetNativeHandle() : BasicNativeBufferHandle();
     }
 
+    uint32_t GetNativeByteOffset() const noexcept final
+    {
+      const BasicDynamicBufferLink* const pLink = m_link.get();
+      return pLink != nullptr ? pLink->GetNativeByteOffset() : 0u;
+    }
+
     uint32_t Capacity() const noexcept final
     {
       const BasicDynamicBufferLink* const pLink = m_link.get();
@@ -81,6 +81,11 @@ namespace Fsl::Graphics3D
     {
       return m_nativeHandle;
     }
+
+    uint32_t GetNativeByteOffset() const noexcept final
+    {
+      return 0u;
+    }
   };
 }
 
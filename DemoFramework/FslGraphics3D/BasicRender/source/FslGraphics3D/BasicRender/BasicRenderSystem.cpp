@@ -572,7 +572,7 @@ namespace Fsl::Graphics3D
       return;
     }
 
-    pDeviceResources->Device->CmdBindIndexBuffer(hNative);
+    pDeviceResources->Device->CmdBindIndexBuffer(hNative, indexBuffer->GetNativeByteOffset());
   }
 
   // -----------------------------------------------------------------------------------------------------------------------------------------------
@@ -602,7 +602,7 @@ namespace Fsl::Graphics3D
       return;
     }
 
-    pDeviceResources->Device->CmdBindVertexBuffer(hNative);
+    pDeviceResources->Device->CmdBindVertexBuffer(hNative, vertexBuffer->GetNativeByteOffset());
   }
 
   // -----------------------------------------------------------------------------------------------------------------------------------------------
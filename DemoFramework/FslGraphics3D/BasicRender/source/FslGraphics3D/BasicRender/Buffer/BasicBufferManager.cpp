@@ -41,9 +41,12 @@
 
 namespace Fsl::Graphics3D
 {
-  BasicBufferManager::BasicBufferManager(const uint32_t maxFramesInFlight, std::shared_ptr<INativeBufferFactory> factory)
+  BasicBufferManager::BasicBufferManager(const uint32_t maxFramesInFlight, std::shared_ptr<INativeBufferFactory> factory,
+                                         const uint32_t subAllocationMaxByteCapacity)
     : m_maxFramesInFlight(maxFramesInFlight)
     , m_factory(std::move(factory))
+    , m_subAllocationMaxByteCapacity(std::min(subAllocationMaxByteCapacity, BasicBufferRingAllocator::DefaultChunkByteCapacity))
+    , m_ringAllocator(maxFramesInFlight, m_factory)
   {
     FSLLOG3_VERBOSE5("BasicBufferManager::BasicBufferManager({})", maxFramesInFlight);
     if (maxFramesInFlight < 1)
@@ -83,6 +86,7 @@ namespace Fsl::Graphics3D
     m_dependentResources = {};
     // As we are currently destroying dependent resources, we dont have any rendering operation pending, so we can just use a defer count of zero
     CollectGarbage(0, true);
+    m_ringAllocator.ReleaseAll();
   }
 
 
@@ -94,6 +98,7 @@ namespace Fsl::Graphics3D
     case BasicRenderSystemEvent::SwapchainLost:
       // We know the device is idle when this occurs so we can just force free everything (and therefore also use a defer count of zero)
       CollectGarbage(0, true);
+      m_ringAllocator.ReleaseAll();
       break;
     case BasicRenderSystemEvent::SwapchainRecreated:
       break;
@@ -131,21 +136,49 @@ namespace Fsl::Graphics3D
     assert(m_factory);
 
     const bool setDataSupported = NativeBufferFactoryCapsUtil::IsEnabled(m_factoryCaps, NativeBufferFactoryCaps::Dynamic);
+    const uint64_t byteCapacity = static_cast<uint64_t>(capacity) * bufferData.stride();
 
-    auto link = std::make_shared<BasicDynamicBufferLink>(m_maxFramesInFlight, m_factory, bufferType, bufferData, capacity, setDataSupported);
+    // Small dynamic buffers share native buffers, which saves the native buffer per frame in flight that a standalone dynamic buffer needs
+    std::shared_ptr<BasicDynamicBufferLink> link;
+    if (setDataSupported && byteCapacity <= m_subAllocationMaxByteCapacity && bufferData.stride() > 0u)
+    {
+      link = std::make_shared<BasicDynamicBufferLink>(m_ringAllocator, bufferType, bufferData, capacity);
+    }
+    else
+    {
+      link = std::make_shared<BasicDynamicBufferLink>(m_maxFramesInFlight, m_factory, bufferType, bufferData, capacity, setDataSupported);
+    }
     auto basic = std::make_shared<BasicDynamicBufferTracker>(link);
     m_dynamicRecords.emplace_back(basic, link, m_maxFramesInFlight);
 
-    FSLLOG3_VERBOSE5("BasicBufferManager: CreateDynamicBuffer ({}) count: {} capacity: {}", reinterpret_cast<intptr_t>(link.get()),
-                     m_dynamicRecords.size(), capacity);
+    FSLLOG3_VERBOSE5("BasicBufferManager: CreateDynamicBuffer ({}) count: {} capacity: {} sub-allocated: {}", reinterpret_cast<intptr_t>(link.get()),
+                     m_dynamicRecords.size(), capacity, link->IsSubAllocated());
     return basic;
   }
 
+  BasicBufferRingAllocation BasicBufferManager::AllocateFrameBuffer(const BasicBufferType bufferType, ReadOnlyFlexSpan bufferData)
+  {
+    if (!NativeBufferFactoryCapsUtil::IsEnabled(m_factoryCaps, NativeBufferFactoryCaps::Dynamic))
+    {
+      throw NotSupportedException("AllocateFrameBuffer requires a factory that supports dynamic buffers");
+    }
+    return m_ringAllocator.Allocate(bufferType, bufferData);
+  }
+
+
   void BasicBufferManager::PreUpdate()
   {
     // If the dependent resources are invalid then we can instantly collect all garbage
     const uint32_t deferCount = m_dependentResources.IsValid ? m_maxFramesInFlight : 0;
     CollectGarbage(deferCount);
+    if (m_dependentResources.IsValid)
+    {
+      m_ringAllocator.BeginFrame();
+    }
+    else
+    {
+      m_ringAllocator.ReleaseAll();
+    }
   }
 
 
@@ -241,6 +274,7 @@ namespace Fsl::Graphics3D
         itr = m_dynamicRecords.erase(itr);
       }
     }
+    m_ringAllocator.Destroy();
     FSLLOG3_VERBOSE5("BasicBufferManager::ForceFreeAllBuffers done {} normal, {} dynamic", m_staticRecords.size(), m_dynamicRecords.size());
   }
 }
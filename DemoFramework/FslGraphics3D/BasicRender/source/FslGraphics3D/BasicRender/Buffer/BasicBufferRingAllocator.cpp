@@ -0,0 +1,368 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Bits/AlignmentUtil.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslGraphics3D/BasicRender/Adapter/INativeBufferFactory.hpp>
+#include <FslGraphics3D/BasicRender/Buffer/BasicBufferRingAllocator.hpp>
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <utility>
+
+namespace Fsl::Graphics3D
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr auto LogType = Fsl::LogType::Verbose6;
+    }
+
+    std::size_t ToPoolIndex(const BasicBufferType bufferType)
+    {
+      switch (bufferType)
+      {
+      case BasicBufferType::Index:
+        return 0u;
+      case BasicBufferType::Vertex:
+        return 1u;
+      default:
+        throw NotSupportedException("Unsupported bufferType");
+      }
+    }
+  }
+
+  BasicBufferRingAllocator::BasicBufferRingAllocator(const uint32_t maxFramesInFlight, std::shared_ptr<INativeBufferFactory> factory,
+                                                     const uint32_t chunkByteCapacity, const uint32_t minAlignment)
+    : m_factory(std::move(factory))
+    , m_chunkByteCapacity(chunkByteCapacity)
+    , m_minAlignment(minAlignment)
+    , m_frames(std::max(maxFramesInFlight, 2u))
+  {
+    if (maxFramesInFlight < 1)
+    {
+      throw std::invalid_argument("maxFramesInFlight needs to be at least 1");
+    }
+    if (!m_factory)
+    {
+      throw std::invalid_argument("factory can not be null");
+    }
+    if (chunkByteCapacity < 1u)
+    {
+      throw std::invalid_argument("chunkByteCapacity needs to be at least 1");
+    }
+    if (minAlignment < 1u)
+    {
+      throw std::invalid_argument("minAlignment needs to be at least 1");
+    }
+  }
+
+
+  BasicBufferRingAllocator::~BasicBufferRingAllocator()
+  {
+    Destroy();
+  }
+
+
+  void BasicBufferRingAllocator::Destroy() noexcept
+  {
+    for (FrameRecord& rFrame : m_frames)
+    {
+      for (auto& rReleased : rFrame.Released)
+      {
+        rReleased.clear();
+      }
+    }
+    for (Pool& rPool : m_pools)
+    {
+      DestroyChunk(rPool.Active);
+      for (Chunk& rChunk : rPool.Retired)
+      {
+        DestroyChunk(rChunk);
+      }
+      rPool.Retired.clear();
+      for (Chunk& rChunk : rPool.Free)
+      {
+        DestroyChunk(rChunk);
+      }
+      rPool.Free.clear();
+    }
+    m_stats.LiveAllocationCount = 0u;
+    m_stats.LiveBytes = 0u;
+    m_stats.ConsumedBytes = 0u;
+    assert(m_stats.NativeBufferCount == 0u);
+    assert(m_stats.ReservedBytes == 0u);
+  }
+
+
+  void BasicBufferRingAllocator::BeginFrame()
+  {
+    const BasicBufferRingAllocatorFrameStats& currentFrame = m_stats.CurrentFrame;
+    m_stats.HighWaterMarkFrameBytes = std::max(m_stats.HighWaterMarkFrameBytes, currentFrame.AllocatedBytes + currentFrame.PaddingBytes);
+    m_stats.LastFrame = currentFrame;
+    m_stats.CurrentFrame = {};
+
+    m_frameIndex = (m_frameIndex + 1u) % static_cast<uint32_t>(m_frames.size());
+    // The frame slot was last used m_frames.size() frames ago, so the allocations released in it are no longer referenced
+    RecycleFrame(m_frames[m_frameIndex]);
+  }
+
+
+  void BasicBufferRingAllocator::ReleaseAll()
+  {
+    for (FrameRecord& rFrame : m_frames)
+    {
+      RecycleFrame(rFrame);
+    }
+  }
+
+
+  BasicBufferRingAllocation BasicBufferRingAllocator::Allocate(const BasicBufferType bufferType, ReadOnlyFlexSpan bufferData)
+  {
+    if (bufferData.empty())
+    {
+      throw std::invalid_argument("bufferData can not be empty");
+    }
+    const std::size_t poolIndex = ToPoolIndex(bufferType);
+    const BasicBufferRingAllocation allocation = DoAllocate(poolIndex, bufferType, bufferData);
+    // A frame allocation is released right away, which keeps it alive until the frame slot is recycled
+    m_frames[m_frameIndex].Released[poolIndex].emplace_back(allocation.NativeHandle, allocation.ByteSize);
+    return allocation;
+  }
+
+
+  BasicBufferRingAllocation BasicBufferRingAllocator::AllocatePersistent(const BasicBufferType bufferType, ReadOnlyFlexSpan bufferData)
+  {
+    return DoAllocate(ToPoolIndex(bufferType), bufferType, bufferData);
+  }
+
+
+  void BasicBufferRingAllocator::Release(const BasicBufferType bufferType, const BasicBufferRingAllocation& allocation)
+  {
+    if (allocation.IsValid())
+    {
+      m_frames[m_frameIndex].Released[ToPoolIndex(bufferType)].emplace_back(allocation.NativeHandle, allocation.ByteSize);
+    }
+  }
+
+
+  BasicBufferRingAllocation BasicBufferRingAllocator::DoAllocate(const std::size_t poolIndex, const BasicBufferType bufferType,
+                                                                 ReadOnlyFlexSpan bufferData)
+  {
+    const auto elementStride = NumericCast<uint32_t>(bufferData.stride());
+    const auto byteSize = NumericCast<uint32_t>(bufferData.byte_size());
+    // The offset needs to be a multiple of the stride so the allocation can be addressed by element index
+    const uint32_t alignment = std::lcm(m_minAlignment, std::max(elementStride, 1u));
+    const ReadOnlyFlexSpan byteSpan(bufferData.data(), byteSize, 1u, OptimizationCheckFlag::NoCheck);
+
+    Pool& rPool = m_pools[poolIndex];
+    BasicBufferRingAllocatorFrameStats& rFrameStats = m_stats.CurrentFrame;
+
+    uint32_t byteOffset = 0u;
+    BasicNativeBufferHandle hNative;
+    if (byteSize > m_chunkByteCapacity)
+    {
+      Chunk chunk = AcquireChunk(rPool, bufferType, byteSize);
+      assert(chunk.IsDedicated);
+      m_factory->SetBufferData(chunk.NativeHandle, 0u, byteSpan);
+      chunk.ByteOffset = byteSize;
+      chunk.LiveAllocationCount = 1u;
+      hNative = chunk.NativeHandle;
+      rPool.Retired.push_back(chunk);
+    }
+    else
+    {
+      uint64_t alignedOffset = AlignmentUtil::GetByteSize(static_cast<uint64_t>(rPool.Active.ByteOffset), static_cast<uint64_t>(alignment));
+      if (!rPool.Active.NativeHandle.IsValid() || (alignedOffset + byteSize) > rPool.Active.ByteCapacity)
+      {
+        RetireActiveChunk(rPool);
+        rPool.Active = AcquireChunk(rPool, bufferType, m_chunkByteCapacity);
+        alignedOffset = 0u;
+      }
+
+      Chunk& rActive = rPool.Active;
+      byteOffset = static_cast<uint32_t>(alignedOffset);
+      if (byteSize > 0u)
+      {
+        m_factory->SetBufferData(rActive.NativeHandle, byteOffset, byteSpan);
+      }
+      const uint32_t paddingBytes = byteOffset - rActive.ByteOffset;
+      rFrameStats.PaddingBytes += paddingBytes;
+      m_stats.ConsumedBytes += paddingBytes;
+      rActive.ByteOffset = byteOffset + byteSize;
+      ++rActive.LiveAllocationCount;
+      hNative = rActive.NativeHandle;
+    }
+
+    ++rFrameStats.AllocationCount;
+    rFrameStats.AllocatedBytes += byteSize;
+    ++m_stats.LiveAllocationCount;
+    m_stats.LiveBytes += byteSize;
+    m_stats.ConsumedBytes += byteSize;
+    m_stats.HighWaterMarkLiveBytes = std::max(m_stats.HighWaterMarkLiveBytes, m_stats.LiveBytes);
+    return {hNative, byteOffset, byteSize, elementStride};
+  }
+
+
+  BasicBufferRingAllocator::Chunk BasicBufferRingAllocator::AcquireChunk(Pool& rPool, const BasicBufferType bufferType,
+                                                                         const uint32_t minByteCapacity)
+  {
+    const bool isDedicated = minByteCapacity > m_chunkByteCapacity;
+    if (!isDedicated && !rPool.Free.empty())
+    {
+      Chunk chunk = rPool.Free.back();
+      rPool.Free.pop_back();
+      return chunk;
+    }
+
+    const uint32_t byteCapacity = isDedicated ? minByteCapacity : m_chunkByteCapacity;
+    const BasicNativeBufferHandle hNative =
+      m_factory->CreateBuffer(bufferType, ReadOnlyFlexSpan(nullptr, 0u, 1u, OptimizationCheckFlag::NoCheck), byteCapacity, true);
+
+    ++m_stats.NativeBufferCount;
+    m_stats.ReservedBytes += byteCapacity;
+    m_stats.HighWaterMarkNativeBufferCount = std::max(m_stats.HighWaterMarkNativeBufferCount, m_stats.NativeBufferCount);
+    m_stats.HighWaterMarkReservedBytes = std::max(m_stats.HighWaterMarkReservedBytes, m_stats.ReservedBytes);
+
+    FSLLOG3(LocalConfig::LogType, "BasicBufferRingAllocator: Created native buffer ({}) capacity: {} dedicated: {}", hNative.Value, byteCapacity,
+            isDedicated);
+    return {hNative, byteCapacity, isDedicated};
+  }
+
+
+  void BasicBufferRingAllocator::RetireActiveChunk(Pool& rPool) noexcept
+  {
+    Chunk& rActive = rPool.Active;
+    if (!rActive.NativeHandle.IsValid())
+    {
+      return;
+    }
+    // The unused tail can not be allocated from until the chunk is recycled
+    const uint32_t wastedBytes = rActive.ByteCapacity - rActive.ByteOffset;
+    m_stats.CurrentFrame.WastedBytes += wastedBytes;
+    m_stats.ConsumedBytes += wastedBytes;
+    rActive.ByteOffset = rActive.ByteCapacity;
+    if (rActive.LiveAllocationCount > 0u)
+    {
+      rPool.Retired.push_back(rActive);
+    }
+    else
+    {
+      RecycleChunk(rPool, rActive);
+    }
+    rActive = {};
+  }
+
+
+  void BasicBufferRingAllocator::RecycleChunk(Pool& rPool, Chunk chunk) noexcept
+  {
+    assert(chunk.LiveAllocationCount == 0u);
+    assert(m_stats.ConsumedBytes >= chunk.ByteOffset);
+    m_stats.ConsumedBytes -= chunk.ByteOffset;
+    if (chunk.IsDedicated)
+    {
+      DestroyChunk(chunk);
+      return;
+    }
+    chunk.ByteOffset = 0u;
+    rPool.Free.push_back(chunk);
+  }
+
+
+  void BasicBufferRingAllocator::RecycleFrame(FrameRecord& rFrame) noexcept
+  {
+    for (std::size_t i = 0; i < rFrame.Released.size(); ++i)
+    {
+      for (const PendingRelease& release : rFrame.Released[i])
+      {
+        FinishRelease(m_pools[i], release);
+      }
+      rFrame.Released[i].clear();
+    }
+  }
+
+
+  void BasicBufferRingAllocator::FinishRelease(Pool& rPool, const PendingRelease& release) noexcept
+  {
+    assert(m_stats.LiveAllocationCount > 0u);
+    assert(m_stats.LiveBytes >= release.ByteSize);
+    --m_stats.LiveAllocationCount;
+    m_stats.LiveBytes -= release.ByteSize;
+
+    Chunk& rActive = rPool.Active;
+    if (rActive.NativeHandle == release.NativeHandle)
+    {
+      assert(rActive.LiveAllocationCount > 0u);
+      --rActive.LiveAllocationCount;
+      if (rActive.LiveAllocationCount == 0u)
+      {
+        // Nothing references the chunk anymore, so allocate from the start again
+        assert(m_stats.ConsumedBytes >= rActive.ByteOffset);
+        m_stats.ConsumedBytes -= rActive.ByteOffset;
+        rActive.ByteOffset = 0u;
+      }
+      return;
+    }
+
+    auto itrFind = std::find_if(rPool.Retired.begin(), rPool.Retired.end(),
+                                [&release](const Chunk& entry) { return entry.NativeHandle == release.NativeHandle; });
+    if (itrFind == rPool.Retired.end())
+    {
+      FSLLOG3_ERROR("BasicBufferRingAllocator: Released a unknown allocation ({})", release.NativeHandle.Value);
+      return;
+    }
+    assert(itrFind->LiveAllocationCount > 0u);
+    --itrFind->LiveAllocationCount;
+    if (itrFind->LiveAllocationCount == 0u)
+    {
+      const Chunk chunk = *itrFind;
+      rPool.Retired.erase(itrFind);
+      RecycleChunk(rPool, chunk);
+    }
+  }
+
+
+  void BasicBufferRingAllocator::DestroyChunk(Chunk& rChunk) noexcept
+  {
+    if (rChunk.NativeHandle.IsValid())
+    {
+      FSLLOG3(LocalConfig::LogType, "BasicBufferRingAllocator: Destroying native buffer ({})", rChunk.NativeHandle.Value);
+      m_factory->DestroyBuffer(rChunk.NativeHandle);
+      assert(m_stats.NativeBufferCount > 0u);
+      --m_stats.NativeBufferCount;
+      m_stats.ReservedBytes -= rChunk.ByteCapacity;
+    }
+    rChunk = {};
+  }
+}
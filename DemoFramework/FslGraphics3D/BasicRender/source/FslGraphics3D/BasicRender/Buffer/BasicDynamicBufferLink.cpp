@@ -34,6 +34,7 @@
 #include <FslBase/NumericCast.hpp>
 #include <FslGraphics/Render/Basic/Adapter/BasicNativeBufferHandle.hpp>
 #include <FslGraphics3D/BasicRender/Adapter/INativeBufferFactory.hpp>
+#include <FslGraphics3D/BasicRender/Buffer/BasicBufferRingAllocator.hpp>
 #include <FslGraphics3D/BasicRender/Buffer/BasicDynamicBufferLink.hpp>
 #include <fmt/format.h>
 #include <algorithm>
@@ -74,6 +75,22 @@ namespace Fsl::Graphics3D
   }
 
 
+  BasicDynamicBufferLink::BasicDynamicBufferLink(BasicBufferRingAllocator& rAllocator, const BasicBufferType bufferType, ReadOnlyFlexSpan bufferData,
+                                                 const uint32_t bufferElementCapacity)
+    : m_bufferType(bufferType)
+    , m_bufferElementCapacity(bufferElementCapacity)
+  {
+    FSLLOG3(LocalConfig::LogType, "BasicDynamicBufferLink::Construct (sub-allocated)");
+    if (bufferData.size() > bufferElementCapacity)
+    {
+      throw std::invalid_argument(
+        fmt::format("Current buffer capacity of {} can not contain the requested buffer data of size {}", bufferElementCapacity, bufferData.size()));
+    }
+    m_allocation = rAllocator.AllocatePersistent(bufferType, bufferData);
+    m_pAllocator = &rAllocator;
+  }
+
+
   BasicDynamicBufferLink::~BasicDynamicBufferLink()
   {
     uint32_t useCount = 0;
@@ -85,6 +102,7 @@ namespace Fsl::Graphics3D
       }
     }
     FSLLOG3_ERROR_IF(useCount > 0, "Found {} unfreed native buffers", useCount);
+    FSLLOG3_ERROR_IF(m_pAllocator != nullptr, "Found a unreleased sub-allocation");
   }
 
 
@@ -102,6 +120,13 @@ namespace Fsl::Graphics3D
       }
     }
     m_buffers.clear();
+    if (m_pAllocator != nullptr)
+    {
+      FSLLOG3(LocalConfig::LogType, "BasicDynamicBufferLink::Released sub-allocation");
+      m_pAllocator->Release(m_bufferType, m_allocation);
+      m_pAllocator = nullptr;
+      m_allocation = {};
+    }
     m_bufferElementCapacity = 0u;
     m_activeIndex = 0u;
     m_isDestroyed = true;
@@ -170,6 +195,16 @@ namespace Fsl::Graphics3D
       throw UsageErrorException("bufferData can not exceed the capacity");
     }
 
+    if (m_pAllocator != nullptr)
+    {
+      // Frames in flight might still reference the old range, so write the data to a new range and let the allocator defer the release
+      const BasicBufferRingAllocation newAllocation = m_pAllocator->AllocatePersistent(m_bufferType, bufferData);
+      m_pAllocator->Release(m_bufferType, m_allocation);
+      m_allocation = newAllocation;
+      FSLLOG3(LocalConfig::LogType, "BasicDynamicBufferLink::SetData (sub-allocated) offset: {}", m_allocation.ByteOffset);
+      return;
+    }
+
     if (!m_swapchainValid)
     {
       if (m_activeIndex > m_buffers.size())
@@ -0,0 +1,321 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/MemoryMappedFile.hpp>
+#include <FslBase/Log/Math/LogMatrix.hpp>
+#include <FslBase/Log/Math/LogVector2.hpp>
+#include <FslBase/Log/Math/LogVector3.hpp>
+#include <FslBase/Log/String/LogUTF8String.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics/UnitTest/Helper/Common.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <FslGraphics/Vertices/VertexPositionNormalTexture.hpp>
+#include <FslGraphics/Vertices/VertexPositionTexture.hpp>
+#include <FslGraphics3D/BasicScene/GenericMesh.hpp>
+#include <FslGraphics3D/BasicScene/GenericScene.hpp>
+#include <FslGraphics3D/BasicScene/SceneAllocator.hpp>
+#include <FslGraphics3D/BasicScene/SceneNode.hpp>
+#include <FslGraphics3D/SceneFormat/BasicSceneFormat.hpp>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using StoredMesh = Graphics3D::GenericMesh<VertexPositionNormalTexture, uint16_t>;
+  using StoredScene = Graphics3D::GenericScene<StoredMesh>;
+  using ConvertedVertexMesh = Graphics3D::GenericMesh<VertexPositionTexture, uint16_t>;
+  using ConvertedVertexScene = Graphics3D::GenericScene<ConvertedVertexMesh>;
+  using ConvertedIndexMesh = Graphics3D::GenericMesh<VertexPositionNormalTexture, uint8_t>;
+  using ConvertedIndexScene = Graphics3D::GenericScene<ConvertedIndexMesh>;
+
+  class TestSceneFormat_BasicSceneFormat : public TestFixtureFslGraphics
+  {
+  protected:
+    std::filesystem::path m_path;
+    StoredScene m_scene;
+
+  public:
+    TestSceneFormat_BasicSceneFormat()
+      : m_path(std::filesystem::temp_directory_path() /
+               (std::string("FslGraphics3D.SceneFormat.UnitTest.") + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".fsf"))
+      , m_scene(2)
+    {
+      m_scene.AddMesh(CreateMesh(3, 3, 0));
+      m_scene.AddMesh(CreateMesh(5, 7, 100));
+      m_scene.GetMeshAt(0)->SetName("first");
+      m_scene.GetMeshAt(1)->SetName("second");
+      m_scene.GetMeshAt(1)->SetMaterialIndex(3);
+
+      auto rootNode = std::make_shared<Graphics3D::SceneNode>();
+      rootNode->SetName("root");
+      rootNode->AddMesh(0);
+      auto childNode = std::make_shared<Graphics3D::SceneNode>();
+      childNode->SetName("child");
+      childNode->SetTransformation(Matrix::CreateTranslation(1.0f, 2.0f, 3.0f));
+      childNode->AddMesh(1);
+      rootNode->AddChild(childNode);
+      m_scene.SetRootNode(rootNode);
+    }
+
+    ~TestSceneFormat_BasicSceneFormat() override
+    {
+      std::error_code error;
+      std::filesystem::remove(m_path, error);
+    }
+
+  protected:
+    IO::Path GetPath() const
+    {
+      return IO::Path(m_path.string());
+    }
+
+    std::vector<uint8_t> SaveToMemory()
+    {
+      SceneFormat::BasicSceneFormat sceneFormat;
+      sceneFormat.Save(GetPath(), m_scene);
+      const IO::MemoryMappedFile file(GetPath(), true);
+      const auto span = file.AsReadOnlySpan();
+      return {span.begin(), span.end()};
+    }
+
+    void WriteFile(const ReadOnlySpan<uint8_t> content) const
+    {
+      std::ofstream stream(m_path, std::ios::out | std::ios::binary | std::ios::trunc);
+      stream.write(reinterpret_cast<const char*>(content.data()), static_cast<std::streamsize>(content.size()));
+    }
+
+    static std::shared_ptr<StoredMesh> CreateMesh(const uint16_t vertexCount, const uint16_t indexCount, const uint16_t seed)
+    {
+      std::vector<VertexPositionNormalTexture> vertices(vertexCount);
+      for (uint16_t i = 0; i < vertexCount; ++i)
+      {
+        const auto value = static_cast<float>(seed + i);
+        vertices[i] = VertexPositionNormalTexture(Vector3(value, value + 0.5f, -value), Vector3(0.0f, 1.0f, value),
+                                                  Vector2(value * 0.25f, 1.0f - value));
+      }
+      std::vector<uint16_t> indices(indexCount);
+      for (uint16_t i = 0; i < indexCount; ++i)
+      {
+        indices[i] = static_cast<uint16_t>((i * 7u) % vertexCount);
+      }
+      return std::make_shared<StoredMesh>(vertices, indices, PrimitiveType::TriangleList);
+    }
+
+    template <typename TScene>
+    static std::shared_ptr<TScene> LoadSpan(const ReadOnlySpan<uint8_t> content)
+    {
+      SceneFormat::BasicSceneFormat sceneFormat;
+      typename TScene::mesh_type::vertex_type defaultVertex;
+      return std::dynamic_pointer_cast<TScene>(
+        sceneFormat.GenericLoad(content, Graphics3D::SceneAllocator::Allocate<TScene>, &defaultVertex, sizeof(defaultVertex)));
+    }
+
+    template <typename TScene>
+    void ExpectSameStructure(const TScene& loadedScene) const
+    {
+      ASSERT_EQ(m_scene.GetMeshCount(), loadedScene.GetMeshCount());
+      for (int32_t meshIndex = 0; meshIndex < m_scene.GetMeshCount(); ++meshIndex)
+      {
+        const auto& srcMesh = *m_scene.Meshes[meshIndex];
+        const auto& dstMesh = *loadedScene.Meshes[meshIndex];
+        EXPECT_EQ(srcMesh.GetName(), dstMesh.GetName());
+        EXPECT_EQ(srcMesh.GetMaterialIndex(), dstMesh.GetMaterialIndex());
+        EXPECT_EQ(srcMesh.GetPrimitiveType(), dstMesh.GetPrimitiveType());
+        ASSERT_EQ(srcMesh.GetVertexCount(), dstMesh.GetVertexCount());
+        ASSERT_EQ(srcMesh.GetIndexCount(), dstMesh.GetIndexCount());
+
+        const auto& srcIndices = srcMesh.GetIndexArray();
+        const auto& dstIndices = dstMesh.GetIndexArray();
+        for (std::size_t i = 0; i < srcIndices.size(); ++i)
+        {
+          EXPECT_EQ(static_cast<uint32_t>(srcIndices[i]), static_cast<uint32_t>(dstIndices[i]));
+        }
+      }
+
+      const auto srcRoot = m_scene.GetRootNode();
+      const auto dstRoot = loadedScene.GetRootNode();
+      ASSERT_TRUE(dstRoot);
+      EXPECT_EQ(srcRoot->GetName(), dstRoot->GetName());
+      EXPECT_EQ(srcRoot->GetTransformation(), dstRoot->GetTransformation());
+      ASSERT_EQ(srcRoot->GetMeshCount(), dstRoot->GetMeshCount());
+      EXPECT_EQ(srcRoot->GetMeshAt(0), dstRoot->GetMeshAt(0));
+      ASSERT_EQ(srcRoot->GetChildCount(), dstRoot->GetChildCount());
+      const auto srcChild = srcRoot->GetChildAt(0);
+      const auto dstChild = dstRoot->GetChildAt(0);
+      EXPECT_EQ(srcChild->GetName(), dstChild->GetName());
+      EXPECT_EQ(srcChild->GetTransformation(), dstChild->GetTransformation());
+      ASSERT_EQ(srcChild->GetMeshCount(), dstChild->GetMeshCount());
+      EXPECT_EQ(srcChild->GetMeshAt(0), dstChild->GetMeshAt(0));
+    }
+
+    template <typename TScene>
+    void ExpectSameVertices(const TScene& loadedScene) const
+    {
+      ASSERT_EQ(m_scene.GetMeshCount(), loadedScene.GetMeshCount());
+      for (int32_t meshIndex = 0; meshIndex < m_scene.GetMeshCount(); ++meshIndex)
+      {
+        const auto& srcVertices = m_scene.Meshes[meshIndex]->GetVertexArray();
+        const auto& dstVertices = loadedScene.Meshes[meshIndex]->GetVertexArray();
+        ASSERT_EQ(srcVertices.size(), dstVertices.size());
+        for (std::size_t i = 0; i < srcVertices.size(); ++i)
+        {
+          EXPECT_EQ(srcVertices[i].Position, dstVertices[i].Position);
+          EXPECT_EQ(srcVertices[i].Normal, dstVertices[i].Normal);
+          EXPECT_EQ(srcVertices[i].TextureCoordinate, dstVertices[i].TextureCoordinate);
+        }
+      }
+    }
+  };
+}
+
+
+TEST_F(TestSceneFormat_BasicSceneFormat, SaveLoad_File)
+{
+  SceneFormat::BasicSceneFormat sceneFormat;
+  sceneFormat.Save(GetPath(), m_scene);
+
+  // The file overload memory maps the file where supported
+  const auto loadedScene = sceneFormat.Load<StoredScene>(GetPath());
+
+  ASSERT_TRUE(loadedScene);
+  ExpectSameStructure(*loadedScene);
+  ExpectSameVertices(*loadedScene);
+}
+
+
+TEST_F(TestSceneFormat_BasicSceneFormat, SaveLoad_Stream)
+{
+  SceneFormat::BasicSceneFormat sceneFormat;
+  sceneFormat.Save(GetPath(), m_scene);
+
+  std::ifstream stream(m_path, std::ios::in | std::ios::binary);
+  StoredMesh::vertex_type defaultVertex;
+  const auto loadedScene = std::dynamic_pointer_cast<StoredScene>(
+    sceneFormat.GenericLoad(stream, Graphics3D::SceneAllocator::Allocate<StoredScene>, &defaultVertex, sizeof(defaultVertex)));
+
+  ASSERT_TRUE(loadedScene);
+  ExpectSameStructure(*loadedScene);
+  ExpectSameVertices(*loadedScene);
+}
+
+
+TEST_F(TestSceneFormat_BasicSceneFormat, SaveLoad_ReadIntoMemory)
+{
+  const std::vector<uint8_t> content = SaveToMemory();
+
+  const auto loadedScene = LoadSpan<StoredScene>(SpanUtil::AsReadOnlySpan(content));
+
+  ASSERT_TRUE(loadedScene);
+  ExpectSameStructure(*loadedScene);
+  ExpectSameVertices(*loadedScene);
+}
+
+
+TEST_F(TestSceneFormat_BasicSceneFormat, SaveLoad_ConvertVertexDeclaration)
+{
+  const std::vector<uint8_t> content = SaveToMemory();
+
+  // The stored vertex declaration does not match the mesh so the vertices are converted
+  const auto loadedScene = LoadSpan<ConvertedVertexScene>(SpanUtil::AsReadOnlySpan(content));
+
+  ASSERT_TRUE(loadedScene);
+  ExpectSameStructure(*loadedScene);
+  for (int32_t meshIndex = 0; meshIndex < m_scene.GetMeshCount(); ++meshIndex)
+  {
+    const auto& srcVertices = m_scene.Meshes[meshIndex]->GetVertexArray();
+    const auto& dstVertices = loadedScene->Meshes[meshIndex]->GetVertexArray();
+    ASSERT_EQ(srcVertices.size(), dstVertices.size());
+    for (std::size_t i = 0; i < srcVertices.size(); ++i)
+    {
+      EXPECT_EQ(srcVertices[i].Position, dstVertices[i].Position);
+      EXPECT_EQ(srcVertices[i].TextureCoordinate, dstVertices[i].TextureCoordinate);
+    }
+  }
+}
+
+
+TEST_F(TestSceneFormat_BasicSceneFormat, SaveLoad_ConvertIndices_Unaligned)
+{
+  const std::vector<uint8_t> content = SaveToMemory();
+
+  // Load the content from both a even and a odd address so the 16bit index data that is narrowed to 8bit is read unaligned in one of them
+  for (std::size_t padding = 0; padding < 2u; ++padding)
+  {
+    std::vector<uint8_t> paddedContent(padding + content.size());
+    std::copy(content.begin(), content.end(), paddedContent.begin() + static_cast<std::ptrdiff_t>(padding));
+
+    const auto loadedScene = LoadSpan<ConvertedIndexScene>(SpanUtil::AsReadOnlySpan(paddedContent).subspan(padding));
+
+    ASSERT_TRUE(loadedScene);
+    ExpectSameStructure(*loadedScene);
+    ExpectSameVertices(*loadedScene);
+  }
+}
+
+
+TEST_F(TestSceneFormat_BasicSceneFormat, Load_Truncated)
+{
+  const std::vector<uint8_t> content = SaveToMemory();
+  ASSERT_FALSE(content.empty());
+
+  // Every possible truncation must be rejected without reading past the end of the content
+  for (std::size_t byteSize = 0; byteSize < content.size(); ++byteSize)
+  {
+    std::vector<uint8_t> truncatedContent(content.begin(), content.begin() + static_cast<std::ptrdiff_t>(byteSize));
+    EXPECT_THROW(LoadSpan<StoredScene>(SpanUtil::AsReadOnlySpan(truncatedContent)), FormatException);
+  }
+}
+
+
+TEST_F(TestSceneFormat_BasicSceneFormat, Load_Truncated_FileAndStream)
+{
+  const std::vector<uint8_t> content = SaveToMemory();
+  ASSERT_FALSE(content.empty());
+
+  SceneFormat::BasicSceneFormat sceneFormat;
+  StoredMesh::vertex_type defaultVertex;
+  for (const std::size_t byteSize : {std::size_t(1u), content.size() / 2u, content.size() - 1u})
+  {
+    WriteFile(SpanUtil::AsReadOnlySpan(content).subspan(0u, byteSize));
+
+    EXPECT_THROW(sceneFormat.Load<StoredScene>(GetPath()), FormatException);
+
+    std::ifstream stream(m_path, std::ios::in | std::ios::binary);
+    EXPECT_THROW(sceneFormat.GenericLoad(stream, Graphics3D::SceneAllocator::Allocate<StoredScene>, &defaultVertex, sizeof(defaultVertex)),
+                 FormatException);
+  }
+}
@@ -33,6 +33,7 @@
 
 #include <FslBase/BasicTypes.hpp>
 #include <FslBase/IO/Path.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
 #include <FslGraphics3D/BasicScene/Scene.hpp>
 #include <FslGraphics3D/BasicScene/SceneAllocator.hpp>
 #include <FslGraphics3D/BasicScene/SceneAllocatorFunc.hpp>
@@ -58,7 +59,7 @@ namespace Fsl::SceneFormat
 
 
     //! @brief Load the given file
-    //! @param filename the file to load.
+    //! @param filename the file to load (the file is memory mapped while loading where the platform supports it).
     std::shared_ptr<Graphics3D::Scene> GenericLoad(const IO::Path& filename, const Graphics3D::SceneAllocatorFunc& sceneAllocator,
                                                    const void* const pDstDefaultValues, const int32_t cbDstDefaultValues);
 
@@ -67,6 +68,11 @@ namespace Fsl::SceneFormat
     std::shared_ptr<Graphics3D::Scene> GenericLoad(std::ifstream& rStream, const Graphics3D::SceneAllocatorFunc& sceneAllocator,
                                                    const void* const pDstDefaultValues, const int32_t cbDstDefaultValues);
 
+    //! @brief Load the scene from memory
+    //! @param content the complete file content, it only needs to stay valid for the duration of the call.
+    std::shared_ptr<Graphics3D::Scene> GenericLoad(const ReadOnlySpan<uint8_t> content, const Graphics3D::SceneAllocatorFunc& sceneAllocator,
+                                                   const void* const pDstDefaultValues, const int32_t cbDstDefaultValues);
+
 
     //! @brief Load the given file
     //! @param filename the file to load.
@@ -31,11 +31,13 @@
 
 #include <FslBase/Bits/ByteArrayUtil.hpp>
 #include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/MemoryMappedFile.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
 #include <FslBase/NumericCast.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
 #include <FslBase/System/Platform/PlatformPathTransform.hpp>
 #include <FslGraphics/Vertices/IndexConverter.hpp>
-#include <FslGraphics/Vertices/VertexConverter.hpp>
+#include <FslGraphics/Vertices/VertexConversionPlan.hpp>
 #include <FslGraphics3D/SceneFormat/BasicSceneFormat.hpp>
 #include <FslGraphics3D/SceneFormat/ChunkType.hpp>
 #include <FslGraphics3D/SceneFormat/PrimitiveType.hpp>
@@ -44,6 +46,7 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstring>
 #include <deque>
 #include <fstream>
 #include <limits>
@@ -67,8 +70,10 @@
 //! - endianess of float and uint32_t must be equal
 //! We verify this at runtime!
 //!
+//! The loader parses the content directly from memory (memory mapped where supported) and bulk copies the mesh content when the
+//! stored vertex declaration and index size matches the destination mesh.
+//!
 //! WARNING:
-//! - The mesh conversion process has not been optimized at all.
 //! - Since there are no standard compiler flags containing endian information the code here uses some very basic endian assumptions that are
 //! verified at runtime.
 
@@ -252,8 +257,6 @@ namespace Fsl::SceneFormat
     constexpr uint32_t MeshOffsetIndexByteSize = MeshOffsetVertexDeclarationIndex + sizeof(uint8_t);
     constexpr uint32_t SizeofMeshHeader = MeshOffsetIndexByteSize + sizeof(uint8_t);
 
-    constexpr uint32_t MeshHeaders = (SizeofMeshHeader > SizeofMeshListHeader ? SizeofMeshHeader : SizeofMeshListHeader);
-
     // struct ChunkMeshHeader
     //{
     //  uint32_t MaterialIndex;
@@ -282,15 +285,9 @@ namespace Fsl::SceneFormat
     //};
 
 
-    FormatHeader ReadHeader(std::ifstream& rStream)
+    FormatHeader DecodeHeader(const ReadOnlySpan<uint8_t> buffer)
     {
-      std::array<uint8_t, SizeOfFormatheader> buffer{};
-      rStream.read(reinterpret_cast<char*>(buffer.data()), SizeOfFormatheader);
-      if (!rStream.good())
-      {
-        throw FormatException("Failed to read the expected data");
-      }
-
+      assert(buffer.size() == SizeOfFormatheader);
       const uint32_t magic = ByteArrayUtil::ReadUInt32LE(buffer.data(), buffer.size(), FormatheaderOffsetMagic);
       const uint32_t version = ByteArrayUtil::ReadUInt32LE(buffer.data(), buffer.size(), FormatheaderOffsetVersion);
 
@@ -311,15 +308,9 @@ namespace Fsl::SceneFormat
     }
 
 
-    ChunkHeader ReadChunkHeader(std::ifstream& rStream)
+    ChunkHeader DecodeChunkHeader(const ReadOnlySpan<uint8_t> buffer)
     {
-      std::array<uint8_t, SizeOfChunkheader> buffer{};
-      rStream.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
-      if (!rStream.good())
-      {
-        throw FormatException("Failed to read the expected data");
-      }
-
+      assert(buffer.size() == SizeOfChunkheader);
       const uint32_t byteSize = ByteArrayUtil::ReadUInt32LE(buffer.data(), buffer.size(), ChunkheaderOffsetByteSize);
       const uint8_t chunkType = ByteArrayUtil::ReadUInt8LE(buffer.data(), buffer.size(), ChunkheaderOffsetType);
       // const uint8_t reserved = ByteArrayUtil::ReadUInt8LE(buffer.data(), buffer.size(), CHUNKHEADER_OFFSET_Reserved);
@@ -328,6 +319,105 @@ namespace Fsl::SceneFormat
     }
 
 
+    //! @brief Simple forward only reader that consumes a block of memory
+    class ContentReader
+    {
+      ReadOnlySpan<uint8_t> m_content;
+      std::size_t m_position{0};
+
+    public:
+      explicit ContentReader(const ReadOnlySpan<uint8_t> content) noexcept
+        : m_content(content)
+      {
+      }
+
+      std::size_t Position() const noexcept
+      {
+        return m_position;
+      }
+
+      std::size_t Remaining() const noexcept
+      {
+        return m_content.size() - m_position;
+      }
+
+      //! @brief Consume the next byteCount bytes
+      ReadOnlySpan<uint8_t> Read(const std::size_t byteCount)
+      {
+        if (byteCount > Remaining())
+        {
+          throw FormatException("Failed to read the expected data");
+        }
+        const auto result = m_content.subspan(m_position, byteCount);
+        m_position += byteCount;
+        return result;
+      }
+    };
+
+
+    //! @brief Reads the chunks directly from memory without copying them
+    class MemoryChunkSource
+    {
+      ContentReader m_reader;
+
+    public:
+      explicit MemoryChunkSource(const ReadOnlySpan<uint8_t> content) noexcept
+        : m_reader(content)
+      {
+      }
+
+      FormatHeader ReadHeader()
+      {
+        return DecodeHeader(m_reader.Read(SizeOfFormatheader));
+      }
+
+      ChunkHeader ReadChunk(ReadOnlySpan<uint8_t>& rContent)
+      {
+        const ChunkHeader header = DecodeChunkHeader(m_reader.Read(SizeOfChunkheader));
+        rContent = m_reader.Read(header.ByteSize);
+        return header;
+      }
+    };
+
+
+    //! @brief Reads the chunks from a stream, each chunk is read into a buffer that is reused for the next chunk
+    class StreamChunkSource
+    {
+      std::ifstream& m_rStream;
+      std::vector<uint8_t> m_buffer;
+
+    public:
+      explicit StreamChunkSource(std::ifstream& rStream)
+        : m_rStream(rStream)
+      {
+      }
+
+      FormatHeader ReadHeader()
+      {
+        return DecodeHeader(Read(SizeOfFormatheader));
+      }
+
+      ChunkHeader ReadChunk(ReadOnlySpan<uint8_t>& rContent)
+      {
+        const ChunkHeader header = DecodeChunkHeader(Read(SizeOfChunkheader));
+        rContent = Read(header.ByteSize);
+        return header;
+      }
+
+    private:
+      ReadOnlySpan<uint8_t> Read(const std::size_t byteCount)
+      {
+        m_buffer.resize(byteCount);
+        m_rStream.read(reinterpret_cast<char*>(m_buffer.data()), NumericCast<std::streamsize>(byteCount));
+        if (!m_rStream.good())
+        {
+          throw FormatException("Failed to read the expected data");
+        }
+        return SpanUtil::AsReadOnlySpan(m_buffer);
+      }
+    };
+
+
     void WriteChunkHeader(std::ofstream& rStream, const ChunkHeader& header)
     {
       std::array<uint8_t, SizeOfChunkheader> buffer{};
@@ -417,9 +507,9 @@ namespace Fsl::SceneFormat
 
 
     //! @brief Read the unique vertex declarations
-    void ReadVertexDeclarationsChunk(std::ifstream& rStream, std::deque<InternalVertexDeclaration>& rUniqueEntries)
+    void ReadVertexDeclarationsChunk(const ChunkHeader& header, const ReadOnlySpan<uint8_t> content,
+                                     std::deque<InternalVertexDeclaration>& rUniqueEntries)
     {
-      const ChunkHeader header = ReadChunkHeader(rStream);
       if (header.Type != ChunkType::VertexDeclarations)
       {
         throw NotSupportedException("format not correct");
@@ -429,37 +519,21 @@ namespace Fsl::SceneFormat
         throw FormatException("Unsupported vertex declaration chunk version");
       }
 
-      const auto startPos = rStream.tellg();
-
-      // Read the vertex declarations
-      std::array<uint8_t, BufferEntrySize> buffer{};
-      rStream.read(reinterpret_cast<char*>(buffer.data()), SizeofVertexDeclarationListHeader);
-      if (!rStream.good())
-      {
-        throw FormatException("Failed to read the expected data");
-      }
+      ContentReader reader(content);
 
       // Read the number of vertex declarations
-      const uint32_t numVertexDeclarations = ByteArrayUtil::ReadUInt32LE(buffer.data(), buffer.size(), 0);
+      const uint32_t numVertexDeclarations = ByteArrayUtil::ReadUInt32LE(reader.Read(SizeofVertexDeclarationListHeader).data(),
+                                                                         SizeofVertexDeclarationListHeader, 0);
 
       for (uint32_t declarationIndex = 0; declarationIndex < numVertexDeclarations; ++declarationIndex)
       {
         SFVertexDeclaration vertexDecl;
 
-        rStream.read(reinterpret_cast<char*>(buffer.data()), SizeofVertexDeclarationHeader);
-        if (!rStream.good())
-        {
-          throw FormatException("Failed to read the expected data");
-        }
-
-        const uint16_t elementCount = ByteArrayUtil::ReadUInt16LE(buffer.data(), buffer.size(), 0);
+        const uint16_t elementCount =
+          ByteArrayUtil::ReadUInt16LE(reader.Read(SizeofVertexDeclarationHeader).data(), SizeofVertexDeclarationHeader, 0);
         for (uint16_t elementIndex = 0; elementIndex < elementCount; ++elementIndex)
         {
-          rStream.read(reinterpret_cast<char*>(buffer.data()), SizeOfVertexelement);
-          if (!rStream.good())
-          {
-            throw FormatException("Failed to read the expected data");
-          }
+          const ReadOnlySpan<uint8_t> buffer = reader.Read(SizeOfVertexelement);
 
           const uint8_t format = ByteArrayUtil::ReadUInt8LE(buffer.data(), buffer.size(), VertexelementOffsetFormat);
           const uint8_t usage = ByteArrayUtil::ReadUInt8LE(buffer.data(), buffer.size(), VertexelementOffsetUsage);
@@ -471,9 +545,7 @@ namespace Fsl::SceneFormat
         rUniqueEntries.emplace_back(vertexDecl);
       }
 
-      const auto endPos = rStream.tellg();
-      assert(endPos >= startPos);
-      if (static_cast<uint32_t>(endPos - startPos) != header.ByteSize)
+      if (reader.Remaining() != 0u)
       {
         throw FormatException("VertexDeclarationChunk was of a unexpected size");
       }
@@ -552,31 +624,6 @@ namespace Fsl::SceneFormat
     }
 
 
-    void ConvertFloat1ArrayLE(uint8_t* const pSrcArray, const std::size_t cbSrc, const uint32_t srcStride, const std::size_t srcInterleaveOffset,
-                              [[maybe_unused]] const std::size_t entries)
-    {
-      const std::size_t REMOVE_WARNING_VARIABLE_IS_NOT_USED elementSize = 4;
-      assert(pSrcArray != nullptr);
-      assert((srcInterleaveOffset + elementSize) <= srcStride);
-      assert((entries * srcStride) <= cbSrc);
-
-      uint8_t* pSrc = pSrcArray + srcInterleaveOffset;
-      const uint8_t* const pSrcEnd = pSrcArray + cbSrc;
-
-      std::size_t currentSrcIndex = srcInterleaveOffset;
-      while (pSrc < pSrcEnd)
-      {
-        assert((currentSrcIndex + elementSize) <= cbSrc);
-
-        // NOTE: this code assumes that a float is stored in the same endian format as a uint32 that is unfortunately not always the case :/
-        //       But we do a runtime check earlier to verify that, so it ought to be detected before we get here
-        *reinterpret_cast<uint32_t*>(pSrc) = ByteArrayUtil::ReadUInt32LE(pSrcArray, cbSrc, currentSrcIndex);
-        pSrc += srcStride;
-        currentSrcIndex += srcStride;
-      }
-    }
-
-
     void WriteFloat1ArrayLE(uint8_t* pDst, const std::size_t cbDst, const std::size_t dstIndex, const std::size_t dstStride,
                             const std::size_t dstInterleaveOffset, const uint8_t* const pSrcArray, const std::size_t cbSrc, const uint32_t srcStride,
                             const std::size_t srcInterleaveOffset, [[maybe_unused]] const std::size_t entries)
@@ -607,32 +654,6 @@ namespace Fsl::SceneFormat
     }
 
 
-    void ConvertFloat2ArrayLE(uint8_t* const pSrcArray, const std::size_t cbSrc, const uint32_t srcStride, const std::size_t srcInterleaveOffset,
-                              [[maybe_unused]] const std::size_t entries)
-    {
-      const std::size_t REMOVE_WARNING_VARIABLE_IS_NOT_USED elementSize = 4 * 2;
-      assert(pSrcArray != nullptr);
-      assert((srcInterleaveOffset + elementSize) <= srcStride);
-      assert((entries * srcStride) <= cbSrc);
-
-      uint8_t* pSrc = pSrcArray + srcInterleaveOffset;
-      const uint8_t* const pSrcEnd = pSrcArray + cbSrc;
-
-      std::size_t currentSrcIndex = srcInterleaveOffset;
-      while (pSrc < pSrcEnd)
-      {
-        assert((currentSrcIndex + elementSize) <= cbSrc);
-
-        // NOTE: this code assumes that a float is stored in the same endian format as a uint32 that is unfortunately not always the case :/
-        //       But we do a runtime check earlier to verify that, so it ought to be detected before we get here
-        *reinterpret_cast<uint32_t*>(pSrc) = ByteArrayUtil::ReadUInt32LE(pSrcArray, cbSrc, currentSrcIndex);
-        *reinterpret_cast<uint32_t*>(pSrc + 4) = ByteArrayUtil::ReadUInt32LE(pSrcArray, cbSrc, currentSrcIndex + 4);
-        pSrc += srcStride;
-        currentSrcIndex += srcStride;
-      }
-    }
-
-
     void WriteFloat2ArrayLE(uint8_t* pDst, const std::size_t cbDst, const std::size_t dstIndex, const std::size_t dstStride,
                             const std::size_t dstInterleaveOffset, const uint8_t* const pSrcArray, const std::size_t cbSrc, const uint32_t srcStride,
                             const std::size_t srcInterleaveOffset, [[maybe_unused]] const std::size_t entries)
@@ -664,33 +685,6 @@ namespace Fsl::SceneFormat
     }
 
 
-    void ConvertFloat3ArrayLE(uint8_t* const pSrcArray, const std::size_t cbSrc, const uint32_t srcStride, const std::size_t srcInterleaveOffset,
-                              [[maybe_unused]] const std::size_t entries)
-    {
-      const std::size_t REMOVE_WARNING_VARIABLE_IS_NOT_USED elementSize = 4 * 3;
-      assert(pSrcArray != nullptr);
-      assert((srcInterleaveOffset + elementSize) <= srcStride);
-      assert((entries * srcStride) <= cbSrc);
-
-      uint8_t* pSrc = pSrcArray + srcInterleaveOffset;
-      const uint8_t* const pSrcEnd = pSrcArray + cbSrc;
-
-      std::size_t currentSrcIndex = srcInterleaveOffset;
-      while (pSrc < pSrcEnd)
-      {
-        assert((currentSrcIndex + elementSize) <= cbSrc);
-
-        // NOTE: this code assumes that a float is stored in the same endian format as a uint32 that is unfortunately not always the case :/
-        //       But we do a runtime check earlier to verify that, so it ought to be detected before we get here
-        *reinterpret_cast<uint32_t*>(pSrc) = ByteArrayUtil::ReadUInt32LE(pSrcArray, cbSrc, currentSrcIndex);
-        *reinterpret_cast<uint32_t*>(pSrc + 4) = ByteArrayUtil::ReadUInt32LE(pSrcArray, cbSrc, currentSrcIndex + 4);
-        *reinterpret_cast<uint32_t*>(pSrc + 8) = ByteArrayUtil::ReadUInt32LE(pSrcArray, cbSrc, currentSrcIndex + 8);
-        pSrc += srcStride;
-        currentSrcIndex += srcStride;
-      }
-    }
-
-
     void WriteFloat3ArrayLE(uint8_t* pDst, const std::size_t cbDst, const std::size_t dstIndex, const std::size_t dstStride,
                             const std::size_t dstInterleaveOffset, const uint8_t* const pSrcArray, const std::size_t cbSrc, const uint32_t srcStride,
                             const std::size_t srcInterleaveOffset, [[maybe_unused]] const std::size_t entries)
@@ -722,34 +716,6 @@ namespace Fsl::SceneFormat
     }
 
 
-    void ConvertFloat4ArrayLE(uint8_t* const pSrcArray, const std::size_t cbSrc, const uint32_t srcStride, const std::size_t srcInterleaveOffset,
-                              [[maybe_unused]] const std::size_t entries)
-    {
-      const std::size_t REMOVE_WARNING_VARIABLE_IS_NOT_USED elementSize = 4 * 4;
-      assert(pSrcArray != nullptr);
-      assert((srcInterleaveOffset + elementSize) <= srcStride);
-      assert((entries * srcStride) <= cbSrc);
-
-      uint8_t* pSrc = pSrcArray + srcInterleaveOffset;
-      const uint8_t* const pSrcEnd = pSrcArray + cbSrc;
-
-      std::size_t currentSrcIndex = srcInterleaveOffset;
-      while (pSrc < pSrcEnd)
-      {
-        assert((currentSrcIndex + elementSize) <= cbSrc);
-
-        // NOTE: this code assumes that a float is stored in the same endian format as a uint32 that is unfortunately not always the case :/
-        //       But we do a runtime check earlier to verify that, so it ought to be detected before we get here
-        *reinterpret_cast<uint32_t*>(pSrc) = ByteArrayUtil::ReadUInt32LE(pSrcArray, cbSrc, currentSrcIndex);
-        *reinterpret_cast<uint32_t*>(pSrc + 4) = ByteArrayUtil::ReadUInt32LE(pSrcArray, cbSrc, currentSrcIndex + 4);
-        *reinterpret_cast<uint32_t*>(pSrc + 8) = ByteArrayUtil::ReadUInt32LE(pSrcArray, cbSrc, currentSrcIndex + 8);
-        *reinterpret_cast<uint32_t*>(pSrc + 12) = ByteArrayUtil::ReadUInt32LE(pSrcArray, cbSrc, currentSrcIndex + 12);
-        pSrc += srcStride;
-        currentSrcIndex += srcStride;
-      }
-    }
-
-
     void WriteFloat4ArrayLE(uint8_t* pDst, const std::size_t cbDst, const std::size_t dstIndex, const std::size_t dstStride,
                             const std::size_t dstInterleaveOffset, const uint8_t* const pSrcArray, const std::size_t cbSrc, const uint32_t srcStride,
                             const std::size_t srcInterleaveOffset, [[maybe_unused]] const std::size_t entries)
@@ -796,42 +762,6 @@ namespace Fsl::SceneFormat
     }
 
 
-    //! @brief Convert the vertices in place from little endian format into the host format
-    void ConvertVerticesLE(uint8_t* const pSrc, const std::size_t srcLength, const InternalVertexDeclaration& srcVertexDeclaration,
-                           const std::size_t vertexCount)
-    {
-      assert(pSrc != nullptr);
-
-      const auto srcVertexStride = srcVertexDeclaration.VertexByteSize;
-
-      std::size_t srcInterleaveOffset = 0;
-      for (auto itr = srcVertexDeclaration.Elements.begin(); itr != srcVertexDeclaration.Elements.end(); ++itr)
-      {
-        switch (itr->Format)
-        {
-        case SceneFormat::VertexElementFormat::Single:
-          ConvertFloat1ArrayLE(pSrc, srcLength, srcVertexStride, srcInterleaveOffset, vertexCount);
-          srcInterleaveOffset += 4;
-          break;
-        case SceneFormat::VertexElementFormat::Vector2:
-          ConvertFloat2ArrayLE(pSrc, srcLength, srcVertexStride, srcInterleaveOffset, vertexCount);
-          srcInterleaveOffset += 4 * 2;
-          break;
-        case SceneFormat::VertexElementFormat::Vector3:
-          ConvertFloat3ArrayLE(pSrc, srcLength, srcVertexStride, srcInterleaveOffset, vertexCount);
-          srcInterleaveOffset += 4 * 3;
-          break;
-        case SceneFormat::VertexElementFormat::Vector4:
-          ConvertFloat4ArrayLE(pSrc, srcLength, srcVertexStride, srcInterleaveOffset, vertexCount);
-          srcInterleaveOffset += 4 * 4;
-          break;
-        default:
-          throw NotSupportedException("Vertex element format not supported");
-        }
-      }
-    }
-
-
     //! @brief Read the vertices in the host format and write them in little endian format
     //!        While at the same time compacting the vertex data to its minimal byte size.
     std::size_t WriteVerticesLE(uint8_t* pDst, const std::size_t dstLength, const std::size_t dstIndex, const InternalMeshRecord& record,
@@ -882,30 +812,6 @@ namespace Fsl::SceneFormat
     }
 
 
-    //! @brief Read the indices in little endian format writing them in host format
-    void ConvertIndicesLE(uint8_t* const pSrc, const std::size_t srcLength, const std::size_t srcIndexByteSize, const std::size_t indexCount)
-    {
-      assert(pSrc != nullptr);
-      const std::size_t indexOffsetEnd = indexCount * srcIndexByteSize;
-
-      if (srcIndexByteSize == 1)
-      {
-        return;
-      }
-      if (srcIndexByteSize == 2)
-      {
-        for (std::size_t indexOffset = 0; indexOffset < indexOffsetEnd; indexOffset += srcIndexByteSize)
-        {
-          *reinterpret_cast<uint16_t*>(pSrc + indexOffset) = ByteArrayUtil::ReadUInt16LE(pSrc, srcLength, indexOffset);
-        }
-      }
-      else
-      {
-        throw NotSupportedException("Index byte size not supported");
-      }
-    }
-
-
     //! @brief Read the indices in the host format and write them in little endian format
     std::size_t WriteIndicesLE(uint8_t* pDst, const std::size_t dstLength, const std::size_t dstIndex, const InternalMeshRecord& record)
     {
@@ -978,10 +884,11 @@ namespace Fsl::SceneFormat
     }
 
 
-    void AddMeshToScene(Scene& rScene, const MeshAllocatorFunc& meshAllocator, const void* const pVertices, const std::size_t vertexCount,
-                        const InternalVertexDeclaration& srcInternalVertexDeclaration, const void* const pIndices, const std::size_t indexCount,
+    void AddMeshToScene(Scene& rScene, const MeshAllocatorFunc& meshAllocator, const uint8_t* const pVertices, const std::size_t vertexCount,
+                        const InternalVertexDeclaration& srcInternalVertexDeclaration, const uint8_t* const pIndices, const std::size_t indexCount,
                         const uint8_t indexByteSize, const SceneFormat::PrimitiveType primitiveType, const uint32_t materialIndex,
-                        const char* const pszName, const void* const pDstDefaultValues, const int32_t cbDstDefaultValues)
+                        const char* const pszName, const void* const pDstDefaultValues, const int32_t cbDstDefaultValues,
+                        VertexConversionPlan& rVertexConversionPlan, std::vector<uint16_t>& rIndexScratchpad, const bool hostIsLittleEndian)
     {
       if (materialIndex >= static_cast<uint32_t>(std::numeric_limits<int32_t>::max()))
       {
@@ -1000,20 +907,53 @@ namespace Fsl::SceneFormat
       const auto cbSrcIndices = indexByteSize * indexCount;
 
       RawMeshContentEx rawDst = mesh->GenericDirectAccess();
-      VertexConverter::GenericConvert(rawDst.pVertices, rawDst.VertexStride * rawDst.VertexCount, mesh->AsVertexDeclarationSpan(), pVertices,
-                                      cbSrcVertices, srcVertexDeclaration.AsSpan(), vertexCount, pDstDefaultValues, cbDstDefaultValues);
-      IndexConverter::GenericConvert(rawDst.pIndices, rawDst.IndexStride * rawDst.IndexCount, rawDst.IndexStride, pIndices, cbSrcIndices,
-                                     indexByteSize, indexCount);
+      const std::size_t cbDstVertices = rawDst.VertexStride * rawDst.VertexCount;
+      const std::size_t cbDstIndices = rawDst.IndexStride * rawDst.IndexCount;
+
+      // The source content is not guaranteed to be aligned so it is only accessed using memcpy or as bytes
+      const VertexDeclarationSpan dstVertexDeclaration = mesh->AsVertexDeclarationSpan();
+      if (hostIsLittleEndian && dstVertexDeclaration == srcVertexDeclaration.AsSpan() && cbSrcVertices <= cbDstVertices)
+      {
+        // The stored vertex layout is identical to the mesh vertex layout
+        std::memcpy(rawDst.pVertices, pVertices, cbSrcVertices);
+      }
+      else
+      {
+        // Meshes that share a vertex declaration reuse the conversion plan
+        if (!rVertexConversionPlan.IsPlanFor(dstVertexDeclaration, srcVertexDeclaration.AsSpan()))
+        {
+          rVertexConversionPlan =
+            VertexConversionPlan(dstVertexDeclaration, srcVertexDeclaration.AsSpan(), pDstDefaultValues, NumericCast<uint32_t>(cbDstDefaultValues));
+        }
+        rVertexConversionPlan.Apply(rawDst.pVertices, cbDstVertices, pVertices, cbSrcVertices, vertexCount);
+      }
+
+      if (rawDst.IndexStride == indexByteSize && cbSrcIndices <= cbDstIndices)
+      {
+        std::memcpy(rawDst.pIndices, pIndices, cbSrcIndices);
+      }
+      else if (indexByteSize == sizeof(uint16_t) && (reinterpret_cast<std::uintptr_t>(pIndices) % alignof(uint16_t)) != 0u)
+      {
+        // The index converter requires aligned indices
+        rIndexScratchpad.resize(indexCount);
+        std::memcpy(rIndexScratchpad.data(), pIndices, cbSrcIndices);
+        IndexConverter::GenericConvert(rawDst.pIndices, cbDstIndices, rawDst.IndexStride, rIndexScratchpad.data(), cbSrcIndices, indexByteSize,
+                                       indexCount);
+      }
+      else
+      {
+        IndexConverter::GenericConvert(rawDst.pIndices, cbDstIndices, rawDst.IndexStride, pIndices, cbSrcIndices, indexByteSize, indexCount);
+      }
 
       rScene.AddMesh(mesh);
     }
 
 
-    std::shared_ptr<Scene> ReadMeshesChunk(std::ifstream& rStream, const std::deque<InternalVertexDeclaration>& vertexDeclarations,
+    std::shared_ptr<Scene> ReadMeshesChunk(const ChunkHeader& header, const ReadOnlySpan<uint8_t> content,
+                                           const std::deque<InternalVertexDeclaration>& vertexDeclarations,
                                            const Graphics3D::SceneAllocatorFunc& sceneAllocator, const void* const pDstDefaultValues,
                                            const int32_t cbDstDefaultValues, const bool hostIsLittleEndian)
     {
-      const ChunkHeader header = ReadChunkHeader(rStream);
       if (header.Type != ChunkType::Meshes)
       {
         throw FormatException("Did not find the expected mesh chunk");
@@ -1023,28 +963,20 @@ namespace Fsl::SceneFormat
         throw FormatException("Unsupported mesh chunk version");
       }
 
-      const auto startPos = rStream.tellg();
-
-      std::array<uint8_t, MeshHeaders> buffer{};
-      rStream.read(reinterpret_cast<char*>(buffer.data()), SizeofMeshListHeader);
-      if (!rStream.good())
-      {
-        throw FormatException("Failed to read the expected data");
-      }
+      ContentReader reader(content);
 
-      const uint32_t meshCount = ByteArrayUtil::ReadUInt32LE(buffer.data(), SizeofMeshListHeader, 0);
+      const uint32_t meshCount = ByteArrayUtil::ReadUInt32LE(reader.Read(SizeofMeshListHeader).data(), SizeofMeshListHeader, 0);
 
       // Create the scene
       std::shared_ptr<Scene> scene = sceneAllocator(meshCount);
       MeshAllocatorFunc meshAllocator = scene->GetMeshAllocator();
 
+      std::vector<uint16_t> indexScratchpad;
+      // One conversion plan per source vertex declaration
+      std::vector<VertexConversionPlan> vertexConversionPlans(vertexDeclarations.size());
       for (uint32_t meshIndex = 0; meshIndex < meshCount; ++meshIndex)
       {
-        rStream.read(reinterpret_cast<char*>(buffer.data()), SizeofMeshHeader);
-        if (!rStream.good())
-        {
-          throw FormatException("Failed to read the expected data");
-        }
+        const ReadOnlySpan<uint8_t> buffer = reader.Read(SizeofMeshHeader);
 
         const uint32_t materialIndex = ByteArrayUtil::ReadUInt32LE(buffer.data(), buffer.size(), MeshOffsetMaterialIndex);
         const uint32_t vertexCount = ByteArrayUtil::ReadUInt32LE(buffer.data(), buffer.size(), MeshOffsetVertexCount);
@@ -1063,47 +995,21 @@ namespace Fsl::SceneFormat
           throw FormatException("the name is expected to be zero terminated, so a min length of 1 is expected");
         }
 
-        const uint32_t cbVertex = vertexDeclarations[vertexDeclarationIndex].VertexByteSize;
-        const uint32_t cbVertices = cbVertex * vertexCount;
-        const uint32_t cbIndices = indexByteSize * indexCount;
-        std::vector<uint8_t> content(cbVertices + cbIndices + nameLength);
-
-        uint8_t* pContent = content.data();
-
-        // Read the actual data
-        rStream.read(reinterpret_cast<char*>(pContent), NumericCast<std::streamsize>(content.size()));
-        if (!rStream.good())
-        {
-          throw FormatException("Failed to read the vertices");
-        }
-
-        const uint8_t* const pVertices = pContent;
-        const uint8_t* const pIndices = pContent + cbVertices;
-        if (hostIsLittleEndian)
-        {
-          ConvertVerticesLE(pContent, cbVertices, vertexDeclarations[vertexDeclarationIndex], vertexCount);
-          pContent += cbVertices;
-
-          assert(pContent == pIndices);
-          ConvertIndicesLE(pContent, cbIndices, indexByteSize, indexCount);
-          pContent += cbIndices;
-        }
-        else
-        {
-          pContent += cbVertices + cbIndices;
-        }
+        const std::size_t cbVertex = vertexDeclarations[vertexDeclarationIndex].VertexByteSize;
+        const ReadOnlySpan<uint8_t> vertices = reader.Read(cbVertex * vertexCount);
+        const ReadOnlySpan<uint8_t> indices = reader.Read(std::size_t(indexByteSize) * indexCount);
+        const ReadOnlySpan<uint8_t> name = reader.Read(nameLength);
 
         // Update mesh with the name
-        ValidateStringLength(pContent, nameLength - 1);
+        ValidateStringLength(name.data(), nameLength - 1);
 
         // Create the mesh and add it to the scene
-        AddMeshToScene(*scene, meshAllocator, pVertices, vertexCount, vertexDeclarations[vertexDeclarationIndex], pIndices, indexCount, indexByteSize,
-                       primitiveType, materialIndex, reinterpret_cast<const char*>(pContent), pDstDefaultValues, cbDstDefaultValues);
+        AddMeshToScene(*scene, meshAllocator, vertices.data(), vertexCount, vertexDeclarations[vertexDeclarationIndex], indices.data(), indexCount,
+                       indexByteSize, primitiveType, materialIndex, reinterpret_cast<const char*>(name.data()), pDstDefaultValues,
+                       cbDstDefaultValues, vertexConversionPlans[vertexDeclarationIndex], indexScratchpad, hostIsLittleEndian);
       }
 
-      const auto endPos = rStream.tellg();
-      assert(endPos >= startPos);
-      if (static_cast<uint32_t>(endPos - startPos) != header.ByteSize)
+      if (reader.Remaining() != 0u)
       {
         throw FormatException("MeshesChunk was of a unexpected size");
       }
@@ -1227,11 +1133,13 @@ namespace Fsl::SceneFormat
     };
 
 
-    std::size_t ReadNode(std::ifstream& rStream, std::deque<std::shared_ptr<SceneNode>>& rNodes, const std::vector<uint8_t>& srcBuffer,
-                         const std::size_t srcOffset, const uint32_t sceneMeshCount, const bool hostIsLittleEndian)
+    std::size_t ReadNode(std::deque<std::shared_ptr<SceneNode>>& rNodes, const ReadOnlySpan<uint8_t> srcBuffer, const std::size_t srcOffset,
+                         const uint32_t sceneMeshCount)
     {
-      FSL_PARAM_NOT_USED(rStream);
-      FSL_PARAM_NOT_USED(hostIsLittleEndian);
+      if (SizeofNodeHeader > (srcBuffer.size() - srcOffset))
+      {
+        throw FormatException("Failed to read the expected data");
+      }
 
       Matrix transform;
       auto* pTransform = reinterpret_cast<uint32_t*>(transform.DirectAccess());
@@ -1271,8 +1179,13 @@ namespace Fsl::SceneFormat
       {
         throw FormatException("the name is expected to be zero terminated, so a min length of 1 is expected");
       }
+      if ((((std::size_t(nodeMeshCount) + nodeChildCount) * sizeof(uint32_t)) + nameLength) > (srcBuffer.size() - srcIndex))
+      {
+        throw FormatException("Failed to read the expected data");
+      }
 
       auto node = std::make_shared<SceneNode>(nodeMeshCount);
+      node->SetTransformation(transform);
 
       // Read mesh indices
       for (std::size_t i = 0; i < nodeMeshCount; ++i)
@@ -1392,9 +1305,8 @@ namespace Fsl::SceneFormat
     }
 
 
-    void ReadNodesChunk(std::ifstream& rStream, Scene& rScene, const bool hostIsLittleEndian)
+    void ReadNodesChunk(const ChunkHeader& header, const ReadOnlySpan<uint8_t> content, Scene& rScene)
     {
-      const ChunkHeader header = ReadChunkHeader(rStream);
       if (header.Type != ChunkType::Nodes)
       {
         throw FormatException("Did not find the expected nodes chunk");
@@ -1403,29 +1315,22 @@ namespace Fsl::SceneFormat
       {
         throw FormatException("Unsupported node chunk version");
       }
-
-      const auto startPos = rStream.tellg();
-
-      std::vector<uint8_t> buffer(header.ByteSize);
-      rStream.read(reinterpret_cast<char*>(buffer.data()), header.ByteSize);
-      if (!rStream.good())
+      if (content.size() < SizeofNodelistHeader)
       {
         throw FormatException("Failed to read the expected data");
       }
 
-      const uint32_t nodeCount = ByteArrayUtil::ReadUInt32LE(buffer.data(), SizeofNodelistHeader, 0);
+      const uint32_t nodeCount = ByteArrayUtil::ReadUInt32LE(content.data(), SizeofNodelistHeader, 0);
 
       const auto sceneMeshCount = static_cast<uint32_t>(rScene.GetMeshCount());
       std::deque<std::shared_ptr<SceneNode>> nodes;
       std::size_t srcOffset = SizeofNodelistHeader;
       for (uint32_t childIndex = 0; childIndex < nodeCount; ++childIndex)
       {
-        srcOffset += ReadNode(rStream, nodes, buffer, srcOffset, sceneMeshCount, hostIsLittleEndian);
+        srcOffset += ReadNode(nodes, content, srcOffset, sceneMeshCount);
       }
 
-      const auto endPos = rStream.tellg();
-      assert(endPos >= startPos);
-      if (static_cast<uint32_t>(endPos - startPos) != header.ByteSize)
+      if (srcOffset != content.size())
       {
         throw FormatException("NodeChunk was of a unexpected size");
       }
@@ -1508,6 +1413,27 @@ namespace Fsl::SceneFormat
     }
 
 
+    template <typename TChunkSource>
+    std::shared_ptr<Scene> ReadScene(TChunkSource& rSource, InternalSceneRecord& rSceneScratchpad, const Graphics3D::SceneAllocatorFunc& sceneAllocator,
+                                     const void* const pDstDefaultValues, const int32_t cbDstDefaultValues, const bool hostIsLittleEndian)
+    {
+      // Read and validate header
+      rSource.ReadHeader();
+
+      ReadOnlySpan<uint8_t> content;
+      ChunkHeader header = rSource.ReadChunk(content);
+      ReadVertexDeclarationsChunk(header, content, rSceneScratchpad.VertexDeclarations);
+
+      header = rSource.ReadChunk(content);
+      std::shared_ptr<Scene> scene = ReadMeshesChunk(header, content, rSceneScratchpad.VertexDeclarations, sceneAllocator, pDstDefaultValues,
+                                                     cbDstDefaultValues, hostIsLittleEndian);
+
+      header = rSource.ReadChunk(content);
+      ReadNodesChunk(header, content, *scene);
+      return scene;
+    }
+
+
     //! @brief Verify that a float is 4bytes big and that the endian used by float and uint32_t is the same.
     //! @return true if the host is little endian
     bool CheckEndianAssumptions()
@@ -1561,26 +1487,39 @@ namespace Fsl::SceneFormat
   std::shared_ptr<Graphics3D::Scene> BasicSceneFormat::GenericLoad(const IO::Path& filename, const Graphics3D::SceneAllocatorFunc& sceneAllocator,
                                                                    const void* const pDstDefaultValues, const int32_t cbDstDefaultValues)
   {
-    std::ifstream fileStream(PlatformPathTransform::ToSystemPath(filename), std::ios::in | std::ios::binary);
-    return GenericLoad(fileStream, sceneAllocator, pDstDefaultValues, cbDstDefaultValues);
+    const IO::MemoryMappedFile file(filename);
+    return GenericLoad(file.AsReadOnlySpan(), sceneAllocator, pDstDefaultValues, cbDstDefaultValues);
   }
 
 
   std::shared_ptr<Graphics3D::Scene> BasicSceneFormat::GenericLoad(std::ifstream& rStream, const Graphics3D::SceneAllocatorFunc& sceneAllocator,
                                                                    const void* const pDstDefaultValues, const int32_t cbDstDefaultValues)
   {
+    m_sceneScratchpad->Clear();
     try
     {
-      // Read and validate header
-      ReadHeader(rStream);
+      StreamChunkSource source(rStream);
+      std::shared_ptr<Scene> scene = ReadScene(source, *m_sceneScratchpad, sceneAllocator, pDstDefaultValues, cbDstDefaultValues, m_hostIsLittleEndian);
       m_sceneScratchpad->Clear();
-      ReadVertexDeclarationsChunk(rStream, m_sceneScratchpad->VertexDeclarations);
-
-      std::shared_ptr<Scene> scene =
-        ReadMeshesChunk(rStream, m_sceneScratchpad->VertexDeclarations, sceneAllocator, pDstDefaultValues, cbDstDefaultValues, m_hostIsLittleEndian);
+      return scene;
+    }
+    catch (const std::exception&)
+    {
+      m_sceneScratchpad->Clear();
+      throw;
+    }
+  }
 
-      ReadNodesChunk(rStream, *scene, m_hostIsLittleEndian);
 
+  std::shared_ptr<Graphics3D::Scene> BasicSceneFormat::GenericLoad(const ReadOnlySpan<uint8_t> content,
+                                                                   const Graphics3D::SceneAllocatorFunc& sceneAllocator,
+                                                                   const void* const pDstDefaultValues, const int32_t cbDstDefaultValues)
+  {
+    m_sceneScratchpad->Clear();
+    try
+    {
+      MemoryChunkSource source(content);
+      std::shared_ptr<Scene> scene = ReadScene(source, *m_sceneScratchpad, sceneAllocator, pDstDefaultValues, cbDstDefaultValues, m_hostIsLittleEndian);
       m_sceneScratchpad->Clear();
       return scene;
     }
@@ -0,0 +1,187 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/HandleVector.hpp>
+#include <FslBase/Span/ReadOnlyFlexSpan.hpp>
+#include <FslGraphics/Render/Basic/IBasicDynamicBuffer.hpp>
+#include <FslGraphics3D/BasicRender/Adapter/INativeBufferFactory.hpp>
+#include <FslGraphics3D/BasicRender/Buffer/BasicBufferManager.hpp>
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t MaxFramesInFlight = 2;
+    constexpr uint32_t FrameCount = 64;
+    constexpr uint32_t VertexStride = 24;
+  }
+
+  //! A CPU only native buffer factory, so the benchmark measures the buffer management and copy cost without a GPU
+  class StubNativeBufferFactory final : public Graphics3D::INativeBufferFactory
+  {
+    struct Record
+    {
+      uint32_t ElementStride{0};
+      std::vector<uint8_t> Content;
+    };
+
+    HandleVector<Record> m_buffers;
+
+  public:
+    uint32_t BufferCount() const noexcept
+    {
+      return m_buffers.Count();
+    }
+
+    Graphics3D::NativeBufferFactoryCaps GetBufferCaps() const noexcept final
+    {
+      return Graphics3D::NativeBufferFactoryCaps::Dynamic;
+    }
+
+    BasicNativeBufferHandle CreateBuffer(const BasicBufferType /*bufferType*/, ReadOnlyFlexSpan bufferData, const uint32_t bufferElementCapacity,
+                                         const bool /*isDynamic*/) final
+    {
+      const auto stride = static_cast<uint32_t>(bufferData.stride());
+      Record record{stride, std::vector<uint8_t>(std::size_t(bufferElementCapacity) * stride)};
+      if (!bufferData.empty())
+      {
+        std::memcpy(record.Content.data(), bufferData.data(), bufferData.byte_size());
+      }
+      return BasicNativeBufferHandle(m_buffers.Add(std::move(record)));
+    }
+
+    bool DestroyBuffer(const BasicNativeBufferHandle hBuffer) noexcept final
+    {
+      return m_buffers.Remove(hBuffer.Value);
+    }
+
+    void SetBufferData(const BasicNativeBufferHandle hBuffer, const uint32_t dstIndex, ReadOnlyFlexSpan bufferData) final
+    {
+      Record& rRecord = m_buffers.Get(hBuffer.Value);
+      std::memcpy(rRecord.Content.data() + (std::size_t(dstIndex) * rRecord.ElementStride), bufferData.data(), bufferData.byte_size());
+    }
+  };
+
+  ReadOnlyFlexSpan AsVertexSpan(const std::vector<uint8_t>& data, const uint32_t vertexCount)
+  {
+    return ReadOnlyFlexSpan(data.data(), vertexCount, LocalConfig::VertexStride, OptimizationCheckFlag::NoCheck);
+  }
+
+  void SetCounters(benchmark::State& state, const uint32_t nativeBufferCount)
+  {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * LocalConfig::FrameCount * state.range(0));
+    state.counters["NativeBuffers"] = static_cast<double>(nativeBufferCount);
+  }
+
+  //! @brief Update 'range(0)' dynamic buffers of 'range(1)' vertices each frame.
+  void UpdateDynamicBuffers(benchmark::State& state, const uint32_t subAllocationMaxByteCapacity)
+  {
+    const auto bufferCount = static_cast<uint32_t>(state.range(0));
+    const auto vertexCount = static_cast<uint32_t>(state.range(1));
+    const std::vector<uint8_t> data(std::size_t(vertexCount) * LocalConfig::VertexStride, 0x42);
+
+    auto factory = std::make_shared<StubNativeBufferFactory>();
+    Graphics3D::BasicBufferManager manager(LocalConfig::MaxFramesInFlight, factory, subAllocationMaxByteCapacity);
+    manager.CreateDependentResources();
+    std::vector<std::shared_ptr<IBasicDynamicBuffer>> buffers(bufferCount);
+    for (auto& rBuffer : buffers)
+    {
+      rBuffer = manager.CreateDynamicBuffer(BasicBufferType::Vertex, AsVertexSpan(data, vertexCount), vertexCount);
+    }
+
+    for (auto _ : state)
+    {
+      for (uint32_t frame = 0; frame < LocalConfig::FrameCount; ++frame)
+      {
+        manager.PreUpdate();
+        for (auto& rBuffer : buffers)
+        {
+          rBuffer->SetData(AsVertexSpan(data, vertexCount));
+        }
+      }
+    }
+    SetCounters(state, factory->BufferCount());
+    state.counters["Fragmentation"] = static_cast<double>(manager.GetFrameBufferStats().Fragmentation());
+    buffers.clear();
+    manager.DestroyDependentResources();
+  }
+
+  //! @brief Every dynamic buffer owns a set of native buffers.
+  void DynamicBuffer_SetData(benchmark::State& state)
+  {
+    UpdateDynamicBuffers(state, 0u);
+  }
+
+  //! @brief The dynamic buffers are sub-allocated from the shared native buffers of the ring allocator.
+  void DynamicBuffer_SetData_SubAllocated(benchmark::State& state)
+  {
+    UpdateDynamicBuffers(state, Graphics3D::BasicBufferManager::DefaultSubAllocationMaxByteCapacity);
+  }
+
+  //! @brief Upload 'range(0)' ranges of 'range(1)' vertices each frame via the shared ring allocator.
+  void RingAllocator_AllocateFrameBuffer(benchmark::State& state)
+  {
+    const auto bufferCount = static_cast<uint32_t>(state.range(0));
+    const auto vertexCount = static_cast<uint32_t>(state.range(1));
+    const std::vector<uint8_t> data(std::size_t(vertexCount) * LocalConfig::VertexStride, 0x42);
+
+    auto factory = std::make_shared<StubNativeBufferFactory>();
+    Graphics3D::BasicBufferManager manager(LocalConfig::MaxFramesInFlight, factory);
+    manager.CreateDependentResources();
+
+    for (auto _ : state)
+    {
+      for (uint32_t frame = 0; frame < LocalConfig::FrameCount; ++frame)
+      {
+        manager.PreUpdate();
+        for (uint32_t i = 0; i < bufferCount; ++i)
+        {
+          benchmark::DoNotOptimize(manager.AllocateFrameBuffer(BasicBufferType::Vertex, AsVertexSpan(data, vertexCount)));
+        }
+      }
+    }
+    SetCounters(state, factory->BufferCount());
+    const auto& stats = manager.GetFrameBufferStats();
+    state.counters["HighWaterMarkBytes"] = static_cast<double>(stats.HighWaterMarkReservedBytes);
+    state.counters["Fragmentation"] = static_cast<double>(stats.LastFrame.Fragmentation());
+    manager.DestroyDependentResources();
+  }
+}
+
+BENCHMARK(DynamicBuffer_SetData)->ArgsProduct({{16, 256}, {64, 1024}})->Unit(benchmark::kMicrosecond);
+BENCHMARK(DynamicBuffer_SetData_SubAllocated)->ArgsProduct({{16, 256}, {64, 1024}})->Unit(benchmark::kMicrosecond);
+BENCHMARK(RingAllocator_AllocateFrameBuffer)->ArgsProduct({{16, 256}, {64, 1024}})->Unit(benchmark::kMicrosecond);
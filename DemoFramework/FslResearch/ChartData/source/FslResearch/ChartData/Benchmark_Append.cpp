@@ -0,0 +1,169 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartData.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataWindowMinMax.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t ChannelCount = 2;
+    constexpr uint32_t SampleCount = 4 * 1024 * 1024;
+    // The samples are generated once and then reused as a repeating pattern, so keep it large to avoid it becoming a simple pattern
+    constexpr uint32_t SampleSetCount = 64 * 1024 + 7;
+  }
+
+  enum class SamplePattern
+  {
+    //! Uniform noise
+    Noise = 0,
+    //! A slowly falling noisy ramp, so the evicted entry is very often the current max (the worst case for a rescan on eviction)
+    FallingRamp = 1
+  };
+
+  std::vector<UI::ChartDataEntry> CreateSamples(const SamplePattern pattern)
+  {
+    std::vector<UI::ChartDataEntry> entries(LocalConfig::SampleSetCount);
+    std::mt19937 random(1337);
+    std::uniform_int_distribution<uint32_t> distribution(0, pattern == SamplePattern::Noise ? 100000 : 4);
+    for (std::size_t entryIndex = 0; entryIndex < entries.size(); ++entryIndex)
+    {
+      const uint32_t offset = pattern == SamplePattern::Noise ? 0u : static_cast<uint32_t>((entries.size() - entryIndex) * 8u);
+      for (uint32_t i = 0; i < LocalConfig::ChannelCount; ++i)
+      {
+        entries[entryIndex].Values[i] = offset + distribution(random);
+      }
+    }
+    return entries;
+  }
+
+  const std::vector<UI::ChartDataEntry>& GetSamples(const int64_t pattern)
+  {
+    static const std::vector<UI::ChartDataEntry> g_noise = CreateSamples(SamplePattern::Noise);
+    static const std::vector<UI::ChartDataEntry> g_fallingRamp = CreateSamples(SamplePattern::FallingRamp);
+    return pattern == static_cast<int64_t>(SamplePattern::Noise) ? g_noise : g_fallingRamp;
+  }
+
+  void SetItemsProcessed(benchmark::State& state)
+  {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * LocalConfig::SampleCount);
+  }
+
+  //! @brief Append SampleCount samples into a full ChartData window of 'range(0)' entries using the SamplePattern 'range(1)'.
+  void ChartData_Append(benchmark::State& state)
+  {
+    const auto windowSize = static_cast<uint32_t>(state.range(0));
+    const auto& samples = GetSamples(state.range(1));
+    auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+    UI::ChartData chartData(dataBinding, windowSize, LocalConfig::ChannelCount, {});
+    for (uint32_t i = 0; i < windowSize; ++i)
+    {
+      chartData.Append(samples[i % samples.size()]);
+    }
+
+    for (auto _ : state)
+    {
+      std::size_t sampleIndex = 0;
+      for (uint32_t i = 0; i < LocalConfig::SampleCount; ++i)
+      {
+        chartData.Append(samples[sampleIndex]);
+        sampleIndex = (sampleIndex + 1) < samples.size() ? sampleIndex + 1 : 0;
+      }
+      benchmark::DoNotOptimize(chartData.CalculateDataStats());
+    }
+    SetItemsProcessed(state);
+  }
+
+
+  //! @brief Append SampleCount samples into a full ChartData window of 'range(0)' entries using the SamplePattern 'range(1)' and query the stats of a view
+  //!        showing a quarter of the window after every append (as a chart bound to the data would do every frame).
+  void ChartData_AppendAndQueryView(benchmark::State& state)
+  {
+    const auto windowSize = static_cast<uint32_t>(state.range(0));
+    const auto& samples = GetSamples(state.range(1));
+    auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+    UI::ChartData chartData(dataBinding, windowSize, LocalConfig::ChannelCount, {});
+    for (uint32_t i = 0; i < windowSize; ++i)
+    {
+      chartData.Append(samples[i % samples.size()]);
+    }
+    const auto viewConfig = chartData.CreateViewConfig(windowSize / 4, false);
+
+    for (auto _ : state)
+    {
+      std::size_t sampleIndex = 0;
+      for (uint32_t i = 0; i < LocalConfig::SampleCount; ++i)
+      {
+        chartData.Append(samples[sampleIndex]);
+        sampleIndex = (sampleIndex + 1) < samples.size() ? sampleIndex + 1 : 0;
+        benchmark::DoNotOptimize(chartData.CalculateDataStats(viewConfig));
+      }
+    }
+    SetItemsProcessed(state);
+  }
+
+
+  //! @brief The raw window min max tracking without the ChartData overhead.
+  void ChartDataWindowMinMax_PushBack(benchmark::State& state)
+  {
+    const auto windowSize = static_cast<uint32_t>(state.range(0));
+    const auto& samples = GetSamples(state.range(1));
+    UI::ChartDataWindowMinMax window(windowSize);
+    for (uint32_t i = 0; i < windowSize; ++i)
+    {
+      window.PushBack(samples[i % samples.size()].Values[0]);
+    }
+
+    for (auto _ : state)
+    {
+      std::size_t sampleIndex = 0;
+      for (uint32_t i = 0; i < LocalConfig::SampleCount; ++i)
+      {
+        window.PushBack(samples[sampleIndex].Values[0]);
+        sampleIndex = (sampleIndex + 1) < samples.size() ? sampleIndex + 1 : 0;
+      }
+      benchmark::DoNotOptimize(window.GetMinMax());
+    }
+    SetItemsProcessed(state);
+  }
+}
+
+BENCHMARK(ChartData_Append)->ArgsProduct({{1000, 10000, 100000}, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(ChartData_AppendAndQueryView)->ArgsProduct({{1000, 10000, 100000}, {0, 1}})->Unit(benchmark::kMillisecond);
+BENCHMARK(ChartDataWindowMinMax_PushBack)->ArgsProduct({{1000, 10000, 100000}, {0, 1}})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,133 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartData.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataView.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartSortedDataChannelView.hpp>
+#include <FslSimpleUI/Controls/Charts/Util/BoxPlotHelper.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t SampleCount = 16 * 1024;
+  }
+
+  struct BoxPlotScene
+  {
+    std::shared_ptr<DataBinding::DataBindingService> DataBinding;
+    std::shared_ptr<UI::ChartData> Data;
+    std::shared_ptr<UI::ChartDataView> DataView;
+    std::mt19937 Random{1337};
+    std::uniform_int_distribution<uint32_t> Distribution{0, 100000};
+
+    explicit BoxPlotScene(const uint32_t windowSize)
+      : DataBinding(std::make_shared<DataBinding::DataBindingService>())
+      , Data(std::make_shared<UI::ChartData>(DataBinding, windowSize, 1, UI::ChartData::Constraints()))
+      , DataView(std::make_shared<UI::ChartDataView>(Data))
+    {
+      for (uint32_t i = 0; i < windowSize; ++i)
+      {
+        AppendSample();
+      }
+    }
+
+    void AppendSample()
+    {
+      Data->Append(UI::ChartDataEntry(Distribution(Random)));
+    }
+  };
+
+  void SetItemsProcessed(benchmark::State& state)
+  {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * LocalConfig::SampleCount);
+  }
+
+
+  //! @brief Append a sample to a full window of 'range(0)' entries and calculate the box plot after every append (like a box plot chart
+  //!        does when the data changes every frame).
+  void ChartSortedDataChannelView_AppendBoxPlot(benchmark::State& state)
+  {
+    BoxPlotScene scene(static_cast<uint32_t>(state.range(0)));
+    UI::ChartSortedDataChannelView sortedView(scene.DataView, 0);
+    benchmark::DoNotOptimize(sortedView.CalculateBoxPlot());
+
+    for (auto _ : state)
+    {
+      for (uint32_t i = 0; i < LocalConfig::SampleCount; ++i)
+      {
+        scene.AppendSample();
+        benchmark::DoNotOptimize(sortedView.CalculateBoxPlot());
+      }
+    }
+    SetItemsProcessed(state);
+  }
+
+
+  //! @brief Reference: the same work done by copying the channel and resorting it after every append.
+  void ChartData_AppendResortBoxPlot(benchmark::State& state)
+  {
+    BoxPlotScene scene(static_cast<uint32_t>(state.range(0)));
+    std::vector<uint32_t> sorted;
+
+    for (auto _ : state)
+    {
+      for (uint32_t i = 0; i < LocalConfig::SampleCount; ++i)
+      {
+        scene.AppendSample();
+        sorted.clear();
+        const auto dataInfo = scene.DataView->DataInfo();
+        for (uint32_t segmentIndex = 0; segmentIndex < dataInfo.SegmentCount; ++segmentIndex)
+        {
+          for (const auto& entry : scene.DataView->SegmentDataAsReadOnlySpan(segmentIndex))
+          {
+            sorted.push_back(entry.Values[0]);
+          }
+        }
+        std::sort(sorted.begin(), sorted.end());
+        benchmark::DoNotOptimize(UI::BoxPlotHelper::Calculate(SpanUtil::AsReadOnlySpan(sorted)));
+      }
+    }
+    SetItemsProcessed(state);
+  }
+}
+
+BENCHMARK(ChartSortedDataChannelView_AppendBoxPlot)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(ChartData_AppendResortBoxPlot)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond)->Iterations(1);
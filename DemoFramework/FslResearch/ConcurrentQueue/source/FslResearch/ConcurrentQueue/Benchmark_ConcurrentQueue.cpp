@@ -0,0 +1,206 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/Concurrent/ConcurrentBoundedQueue.hpp>
+#include <FslBase/Collections/Concurrent/ConcurrentQueue.hpp>
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#define LOCAL_BENCH_CONCURRENTQUEUE
+#define LOCAL_BENCH_CONCURRENTBOUNDEDQUEUE
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t MessageCount = 100000;
+    constexpr std::size_t BoundedCapacity = 1024;
+    constexpr uint32_t MaxProducers = 8;
+    constexpr uint32_t MaxConsumers = 2;
+    constexpr std::chrono::milliseconds ConsumerWait(5);
+  }
+
+  struct Message
+  {
+    uint64_t Value{0};
+    uint64_t Payload0{0};
+    uint64_t Payload1{0};
+    uint64_t Payload2{0};
+  };
+
+  template <typename TQueue>
+  struct QueueFactory;
+
+  template <>
+  struct QueueFactory<ConcurrentQueue<Message>>
+  {
+    static std::unique_ptr<ConcurrentQueue<Message>> Create()
+    {
+      return std::make_unique<ConcurrentQueue<Message>>();
+    }
+  };
+
+  template <>
+  struct QueueFactory<ConcurrentBoundedQueue<Message>>
+  {
+    static std::unique_ptr<ConcurrentBoundedQueue<Message>> Create()
+    {
+      return std::make_unique<ConcurrentBoundedQueue<Message>>(LocalConfig::BoundedCapacity);
+    }
+  };
+
+  // -------------------------------------------------------------------------------------------------------------------------------------------------
+
+  template <typename TQueue>
+  uint64_t RunProducersAndConsumers(TQueue& rQueue, const uint32_t producerCount, const uint32_t consumerCount)
+  {
+    const uint32_t messagesPerProducer = LocalConfig::MessageCount / producerCount;
+    const uint64_t totalMessages = uint64_t(messagesPerProducer) * producerCount;
+
+    std::atomic<uint64_t> consumedCount{0};
+    std::atomic<uint64_t> consumedSum{0};
+
+    std::vector<std::thread> threads;
+    threads.reserve(producerCount + consumerCount);
+    for (uint32_t i = 0; i < consumerCount; ++i)
+    {
+      threads.emplace_back(
+        [&rQueue, &consumedCount, &consumedSum, totalMessages]()
+        {
+          Message message;
+          uint64_t sum = 0;
+          while (consumedCount.load(std::memory_order_relaxed) < totalMessages)
+          {
+            if (rQueue.TryDequeueWait(message, LocalConfig::ConsumerWait))
+            {
+              sum += message.Value;
+              consumedCount.fetch_add(1u, std::memory_order_relaxed);
+            }
+          }
+          consumedSum.fetch_add(sum);
+        });
+    }
+    for (uint32_t i = 0; i < producerCount; ++i)
+    {
+      threads.emplace_back(
+        [&rQueue, messagesPerProducer]()
+        {
+          for (uint32_t messageIndex = 0; messageIndex < messagesPerProducer; ++messageIndex)
+          {
+            Message message;
+            message.Value = messageIndex;
+            rQueue.Enqueue(std::move(message));
+          }
+        });
+    }
+    for (auto& rThread : threads)
+    {
+      rThread.join();
+    }
+    return consumedSum.load();
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------------------------------------
+
+  template <typename TQueue>
+  void BmQueueProducerConsumer(benchmark::State& state)
+  {
+    const auto producerCount = static_cast<uint32_t>(state.range(0));
+    const auto consumerCount = static_cast<uint32_t>(state.range(1));
+    auto queue = QueueFactory<TQueue>::Create();
+
+    for (auto _ : state)
+    {
+      // This code gets timed
+      benchmark::DoNotOptimize(RunProducersAndConsumers(*queue, producerCount, consumerCount));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * (LocalConfig::MessageCount / producerCount) * producerCount);
+  }
+
+  template <typename TQueue>
+  void BmQueueSingleThreadRoundTrip(benchmark::State& state)
+  {
+    auto queue = QueueFactory<TQueue>::Create();
+
+    Message message;
+    for (auto _ : state)
+    {
+      // This code gets timed
+      message.Value = 1;
+      queue->Enqueue(std::move(message));
+      queue->TryDequeueWait(message, std::chrono::milliseconds(0));
+      benchmark::DoNotOptimize(message);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  }
+
+  void ProducerConsumerArguments(benchmark::internal::Benchmark* pBenchmark)
+  {
+    for (uint32_t consumerCount = 1; consumerCount <= LocalConfig::MaxConsumers; consumerCount *= 2)
+    {
+      for (uint32_t producerCount = 1; producerCount <= LocalConfig::MaxProducers; producerCount *= 2)
+      {
+        pBenchmark->Args({producerCount, consumerCount});
+      }
+    }
+    pBenchmark->ArgNames({"producers", "consumers"});
+    pBenchmark->UseRealTime();
+    pBenchmark->Unit(benchmark::kMillisecond);
+  }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+// SingleThreadRoundTrip
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef LOCAL_BENCH_CONCURRENTQUEUE
+BENCHMARK(BmQueueSingleThreadRoundTrip<ConcurrentQueue<Message>>);
+#endif
+#ifdef LOCAL_BENCH_CONCURRENTBOUNDEDQUEUE
+BENCHMARK(BmQueueSingleThreadRoundTrip<ConcurrentBoundedQueue<Message>>);
+#endif
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+// ProducerConsumer
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef LOCAL_BENCH_CONCURRENTQUEUE
+BENCHMARK(BmQueueProducerConsumer<ConcurrentQueue<Message>>)->Apply(ProducerConsumerArguments);
+#endif
+#ifdef LOCAL_BENCH_CONCURRENTBOUNDEDQUEUE
+BENCHMARK(BmQueueProducerConsumer<ConcurrentBoundedQueue<Message>>)->Apply(ProducerConsumerArguments);
+#endif
@@ -0,0 +1,238 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslDataBinding/Base/Object/DependencyObject.hpp>
+#include <FslDataBinding/Base/Object/DependencyObjectHelper.hpp>
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinition.hpp>
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinitionFactory.hpp>
+#include <FslDataBinding/Base/Property/TypedDependencyProperty.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t TwoWayGroupSize = 4;
+    constexpr uint32_t RepeatedChangeCount = 8;
+  }
+
+  class BenchObject final : public DataBinding::DependencyObject
+  {
+    DataBinding::TypedDependencyProperty<uint32_t> m_property0;
+
+  public:
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition Property0;
+
+    explicit BenchObject(const std::shared_ptr<DataBinding::DataBindingService>& dataBinding)
+      : DataBinding::DependencyObject(dataBinding)
+    {
+    }
+
+    uint32_t GetProperty0Value() const noexcept
+    {
+      return m_property0.Get();
+    }
+
+    bool SetProperty0Value(const uint32_t value)
+    {
+      return m_property0.Set(ThisDependencyObject(), value, DataBinding::PropertyChangeReason::Modified);
+    }
+
+  protected:
+    DataBinding::DataBindingInstanceHandle TryGetPropertyHandleNow(const DataBinding::DependencyPropertyDefinition& sourceDef) final
+    {
+      using namespace DataBinding;
+      auto res = DependencyObjectHelper::TryGetPropertyHandle(this, ThisDependencyObject(), sourceDef, PropLinkRefs(Property0, m_property0));
+      return res.IsValid() ? res : DependencyObject::TryGetPropertyHandleNow(sourceDef);
+    }
+
+    DataBinding::PropertySetBindingResult TrySetBindingNow(const DataBinding::DependencyPropertyDefinition& targetDef,
+                                                           const DataBinding::Binding& binding) final
+    {
+      using namespace DataBinding;
+      auto res = DependencyObjectHelper::TrySetBinding(this, ThisDependencyObject(), targetDef, binding, PropLinkRefs(Property0, m_property0));
+      return res != PropertySetBindingResult::NotFound ? res : DependencyObject::TrySetBindingNow(targetDef, binding);
+    }
+  };
+
+  DataBinding::DependencyPropertyDefinition BenchObject::Property0 =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<uint32_t, BenchObject, &BenchObject::GetProperty0Value,
+                                                             &BenchObject::SetProperty0Value>("Property0");
+
+
+  //! @brief 'count' sources that each drive one one-way bound target
+  struct OneWayScene
+  {
+    std::shared_ptr<DataBinding::DataBindingService> Service;
+    std::vector<std::unique_ptr<BenchObject>> Sources;
+    std::vector<std::unique_ptr<BenchObject>> Targets;
+
+    explicit OneWayScene(const uint32_t count)
+      : Service(std::make_shared<DataBinding::DataBindingService>())
+    {
+      Sources.reserve(count);
+      Targets.reserve(count);
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        Sources.push_back(std::make_unique<BenchObject>(Service));
+        Targets.push_back(std::make_unique<BenchObject>(Service));
+        Targets.back()->SetBinding(BenchObject::Property0, Sources.back()->GetPropertyHandle(BenchObject::Property0));
+      }
+      Service->ExecuteChanges();
+    }
+
+    ~OneWayScene()
+    {
+      // Destroy in reverse creation order as that is the cheapest order to remove the instances in
+      while (!Targets.empty())
+      {
+        Targets.pop_back();
+        Sources.pop_back();
+      }
+    }
+  };
+
+
+  //! @brief 'count' groups of 'LocalConfig::TwoWayGroupSize' objects that are two-way bound to the first object of the group
+  struct TwoWayScene
+  {
+    std::shared_ptr<DataBinding::DataBindingService> Service;
+    std::vector<std::unique_ptr<BenchObject>> Objects;
+
+    explicit TwoWayScene(const uint32_t count)
+      : Service(std::make_shared<DataBinding::DataBindingService>())
+    {
+      Objects.reserve(count * LocalConfig::TwoWayGroupSize);
+      for (uint32_t groupIndex = 0; groupIndex < count; ++groupIndex)
+      {
+        Objects.push_back(std::make_unique<BenchObject>(Service));
+        const DataBinding::DataBindingInstanceHandle hHub = Objects.back()->GetPropertyHandle(BenchObject::Property0);
+        for (uint32_t i = 1; i < LocalConfig::TwoWayGroupSize; ++i)
+        {
+          Objects.push_back(std::make_unique<BenchObject>(Service));
+          Objects.back()->SetBinding(BenchObject::Property0, hHub, DataBinding::BindingMode::TwoWay);
+        }
+      }
+      Service->ExecuteChanges();
+    }
+
+    ~TwoWayScene()
+    {
+      // Destroy in reverse creation order as that is the cheapest order to remove the instances in
+      while (!Objects.empty())
+      {
+        Objects.pop_back();
+      }
+    }
+  };
+
+
+  // --------------------------------------------------------------------------------------------------------------------------------------------------
+
+
+  //! @brief Modify 'changeCount' of the one-way bound sources and execute the changes
+  void OneWayExecuteChanges(benchmark::State& state)
+  {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    const auto changeCount = static_cast<uint32_t>(state.range(1));
+    OneWayScene scene(count);
+
+    const uint32_t step = count / changeCount;
+    uint32_t frame = 0;
+    for (auto _ : state)
+    {
+      ++frame;
+      for (uint32_t i = 0; i < changeCount; ++i)
+      {
+        scene.Sources[i * step]->SetProperty0Value(frame);
+      }
+      scene.Service->ExecuteChanges();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * changeCount);
+  }
+
+
+  //! @brief Modify one member of 'changeCount' two-way groups and execute the changes
+  void TwoWayExecuteChanges(benchmark::State& state)
+  {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    const auto changeCount = static_cast<uint32_t>(state.range(1));
+    TwoWayScene scene(count);
+
+    const uint32_t step = count / changeCount;
+    uint32_t frame = 0;
+    for (auto _ : state)
+    {
+      ++frame;
+      for (uint32_t i = 0; i < changeCount; ++i)
+      {
+        // Alternate between the members of the group so the 'last change' moves around
+        const uint32_t memberIndex = 1 + (frame % (LocalConfig::TwoWayGroupSize - 1));
+        scene.Objects[(i * step * LocalConfig::TwoWayGroupSize) + memberIndex]->SetProperty0Value(frame);
+      }
+      scene.Service->ExecuteChanges();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * changeCount);
+  }
+
+
+  //! @brief Modify the same sources several times before the changes are executed
+  void RepeatedChangesExecuteChanges(benchmark::State& state)
+  {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    OneWayScene scene(count);
+
+    uint32_t frame = 0;
+    for (auto _ : state)
+    {
+      ++frame;
+      for (uint32_t changeIndex = 0; changeIndex < LocalConfig::RepeatedChangeCount; ++changeIndex)
+      {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+          scene.Sources[i]->SetProperty0Value((frame * LocalConfig::RepeatedChangeCount) + changeIndex);
+        }
+      }
+      scene.Service->ExecuteChanges();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count * LocalConfig::RepeatedChangeCount);
+  }
+}
+
+BENCHMARK(OneWayExecuteChanges)->Args({20000, 16})->Args({20000, 20000})->Unit(benchmark::kMicrosecond);
+BENCHMARK(TwoWayExecuteChanges)->Args({5000, 16})->Args({5000, 5000})->Unit(benchmark::kMicrosecond);
+BENCHMARK(RepeatedChangesExecuteChanges)->Arg(1000)->Arg(5000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,220 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/BoundingBoxSoA.hpp>
+#include <FslBase/Math/BoundingFrustum.hpp>
+#include <FslBase/Math/BoundingFrustumBatch.hpp>
+#include <FslBase/Math/BoundingSphereSoA.hpp>
+#include <FslBase/Math/MathHelper.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  BoundingFrustum CreateFrustum()
+  {
+    const Matrix view = Matrix::CreateLookAt(Vector3(5.0f, 2.0f, 20.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3::Up());
+    const Matrix projection = Matrix::CreatePerspectiveFieldOfView(MathHelper::ToRadians(60.0f), 16.0f / 9.0f, 0.5f, 200.0f);
+    return BoundingFrustum(view * projection);
+  }
+
+  //! Objects scattered around the camera, roughly a quarter of them are visible
+  std::vector<BoundingBox> CreateBoxes(const int64_t count)
+  {
+    std::mt19937 random(1337);
+    std::uniform_real_distribution<float> positionDistribution(-200.0f, 200.0f);
+    std::uniform_real_distribution<float> extentDistribution(0.1f, 2.0f);
+    std::vector<BoundingBox> boxes(static_cast<std::size_t>(count));
+    for (auto& rBox : boxes)
+    {
+      const Vector3 center(positionDistribution(random), positionDistribution(random), positionDistribution(random));
+      const Vector3 extent(extentDistribution(random), extentDistribution(random), extentDistribution(random));
+      rBox = BoundingBox(center - extent, center + extent);
+    }
+    return boxes;
+  }
+
+  std::vector<BoundingSphere> CreateSpheres(const int64_t count)
+  {
+    std::vector<BoundingSphere> spheres;
+    spheres.reserve(static_cast<std::size_t>(count));
+    for (const auto& box : CreateBoxes(count))
+    {
+      spheres.push_back(BoundingSphere::CreateFromBoundingBox(box));
+    }
+    return spheres;
+  }
+
+  JobSystem& GetJobSystem()
+  {
+    static JobSystem g_jobSystem;
+    return g_jobSystem;
+  }
+
+  void SetItemsProcessed(benchmark::State& state)
+  {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+  //! @brief The per object BoundingFrustum::Intersects loop
+  void Box_PerObject(benchmark::State& state)
+  {
+    const BoundingFrustum frustum = CreateFrustum();
+    const auto boxes = CreateBoxes(state.range(0));
+    std::vector<uint32_t> indices(boxes.size());
+    for (auto _ : state)
+    {
+      uint32_t count = 0;
+      for (uint32_t i = 0; i < boxes.size(); ++i)
+      {
+        if (frustum.Intersects(boxes[i]))
+        {
+          indices[count] = i;
+          ++count;
+        }
+      }
+      benchmark::DoNotOptimize(count);
+    }
+    SetItemsProcessed(state);
+  }
+
+  //! @brief The bulk visibility mask using the kernel set 'range(1)'
+  void Box_VisibilityMask(benchmark::State& state)
+  {
+    const auto kernelSet = static_cast<BoundingFrustumBatchKernelSet>(state.range(1));
+    if (!BoundingFrustumBatch::IsSupported(kernelSet))
+    {
+      state.SkipWithError("Kernel set not supported");
+      return;
+    }
+    const BoundingFrustum frustum = CreateFrustum();
+    const BoundingBoxSoA boxes(SpanUtil::AsReadOnlySpan(CreateBoxes(state.range(0))));
+    std::vector<uint32_t> mask(BoundingFrustumBatch::CalcVisibilityMaskLength(boxes.Count()));
+    for (auto _ : state)
+    {
+      BoundingFrustumBatch::CalcVisibilityMask(kernelSet, frustum, boxes, SpanUtil::AsSpan(mask));
+      benchmark::DoNotOptimize(mask.data());
+    }
+    SetItemsProcessed(state);
+  }
+
+  void Box_VisibleIndices(benchmark::State& state)
+  {
+    const BoundingFrustum frustum = CreateFrustum();
+    const BoundingBoxSoA boxes(SpanUtil::AsReadOnlySpan(CreateBoxes(state.range(0))));
+    std::vector<uint32_t> indices(boxes.Count());
+    for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(BoundingFrustumBatch::CalcVisibleIndices(frustum, boxes, SpanUtil::AsSpan(indices)));
+    }
+    SetItemsProcessed(state);
+  }
+
+  void Box_VisibilityMask_JobSystem(benchmark::State& state)
+  {
+    const BoundingFrustum frustum = CreateFrustum();
+    const BoundingBoxSoA boxes(SpanUtil::AsReadOnlySpan(CreateBoxes(state.range(0))));
+    std::vector<uint32_t> mask(BoundingFrustumBatch::CalcVisibilityMaskLength(boxes.Count()));
+    for (auto _ : state)
+    {
+      BoundingFrustumBatch::CalcVisibilityMask(GetJobSystem(), frustum, boxes, SpanUtil::AsSpan(mask));
+      benchmark::DoNotOptimize(mask.data());
+    }
+    SetItemsProcessed(state);
+  }
+
+  void Sphere_PerObject(benchmark::State& state)
+  {
+    const BoundingFrustum frustum = CreateFrustum();
+    const auto spheres = CreateSpheres(state.range(0));
+    std::vector<uint32_t> indices(spheres.size());
+    for (auto _ : state)
+    {
+      uint32_t count = 0;
+      for (uint32_t i = 0; i < spheres.size(); ++i)
+      {
+        if (frustum.Intersects(spheres[i]))
+        {
+          indices[count] = i;
+          ++count;
+        }
+      }
+      benchmark::DoNotOptimize(count);
+    }
+    SetItemsProcessed(state);
+  }
+
+  void Sphere_VisibilityMask(benchmark::State& state)
+  {
+    const auto kernelSet = static_cast<BoundingFrustumBatchKernelSet>(state.range(1));
+    if (!BoundingFrustumBatch::IsSupported(kernelSet))
+    {
+      state.SkipWithError("Kernel set not supported");
+      return;
+    }
+    const BoundingFrustum frustum = CreateFrustum();
+    const BoundingSphereSoA spheres(SpanUtil::AsReadOnlySpan(CreateSpheres(state.range(0))));
+    std::vector<uint32_t> mask(BoundingFrustumBatch::CalcVisibilityMaskLength(spheres.Count()));
+    for (auto _ : state)
+    {
+      BoundingFrustumBatch::CalcVisibilityMask(kernelSet, frustum, spheres, SpanUtil::AsSpan(mask));
+      benchmark::DoNotOptimize(mask.data());
+    }
+    SetItemsProcessed(state);
+  }
+
+  void Sphere_VisibilityMask_JobSystem(benchmark::State& state)
+  {
+    const BoundingFrustum frustum = CreateFrustum();
+    const BoundingSphereSoA spheres(SpanUtil::AsReadOnlySpan(CreateSpheres(state.range(0))));
+    std::vector<uint32_t> mask(BoundingFrustumBatch::CalcVisibilityMaskLength(spheres.Count()));
+    for (auto _ : state)
+    {
+      BoundingFrustumBatch::CalcVisibilityMask(GetJobSystem(), frustum, spheres, SpanUtil::AsSpan(mask));
+      benchmark::DoNotOptimize(mask.data());
+    }
+    SetItemsProcessed(state);
+  }
+}
+
+// range(1) is the BoundingFrustumBatchKernelSet: 0 = Scalar, 1 = SSE41, 2 = AVX2, 3 = Neon
+BENCHMARK(Box_PerObject)->Arg(10000)->Arg(100000)->Arg(1000000);
+BENCHMARK(Box_VisibilityMask)->ArgsProduct({{10000, 100000, 1000000}, {0, 1, 2, 3}});
+BENCHMARK(Box_VisibleIndices)->Arg(10000)->Arg(100000)->Arg(1000000);
+BENCHMARK(Box_VisibilityMask_JobSystem)->Arg(100000)->Arg(1000000)->UseRealTime();
+BENCHMARK(Sphere_PerObject)->Arg(10000)->Arg(100000)->Arg(1000000);
+BENCHMARK(Sphere_VisibilityMask)->ArgsProduct({{10000, 100000, 1000000}, {0, 1, 2, 3}});
+BENCHMARK(Sphere_VisibilityMask_JobSystem)->Arg(100000)->Arg(1000000)->UseRealTime();
@@ -0,0 +1,273 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/MathHelper.hpp>
+#include <FslBase/Math/MatrixBatch.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  Matrix CreateViewProjection()
+  {
+    const Matrix view = Matrix::CreateLookAt(Vector3(5.0f, 2.0f, 20.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3::Up());
+    const Matrix projection = Matrix::CreatePerspectiveFieldOfView(MathHelper::ToRadians(60.0f), 16.0f / 9.0f, 0.5f, 200.0f);
+    return view * projection;
+  }
+
+  std::vector<Vector3> CreateVector3(const int64_t count)
+  {
+    std::mt19937 random(1337);
+    std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+    std::vector<Vector3> vectors(static_cast<std::size_t>(count));
+    for (auto& rVector : vectors)
+    {
+      rVector = Vector3(distribution(random), distribution(random), distribution(random));
+    }
+    return vectors;
+  }
+
+  std::vector<Vector4> CreateVector4(const int64_t count)
+  {
+    std::mt19937 random(1337);
+    std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+    std::vector<Vector4> vectors(static_cast<std::size_t>(count));
+    for (auto& rVector : vectors)
+    {
+      rVector = Vector4(distribution(random), distribution(random), distribution(random), 1.0f);
+    }
+    return vectors;
+  }
+
+  //! Scale, rotation and translation matrices similar to a typical world transform
+  std::vector<Matrix> CreateMatrices(const int64_t count)
+  {
+    std::mt19937 random(1337);
+    std::uniform_real_distribution<float> angleDistribution(0.0f, MathHelper::TO_RADS * 360.0f);
+    std::uniform_real_distribution<float> scaleDistribution(0.5f, 2.0f);
+    std::uniform_real_distribution<float> positionDistribution(-100.0f, 100.0f);
+    std::vector<Matrix> matrices(static_cast<std::size_t>(count));
+    for (auto& rMatrix : matrices)
+    {
+      rMatrix = Matrix::CreateScale(scaleDistribution(random)) *
+                Matrix::CreateFromYawPitchRoll(angleDistribution(random), angleDistribution(random), angleDistribution(random)) *
+                Matrix::CreateTranslation(positionDistribution(random), positionDistribution(random), positionDistribution(random));
+    }
+    return matrices;
+  }
+
+  bool TryGetKernelSet(benchmark::State& state, MatrixBatchKernelSet& rKernelSet)
+  {
+    rKernelSet = static_cast<MatrixBatchKernelSet>(state.range(1));
+    if (!MatrixBatch::IsSupported(rKernelSet))
+    {
+      state.SkipWithError("Kernel set not supported");
+      return false;
+    }
+    return true;
+  }
+
+  void SetItemsProcessed(benchmark::State& state)
+  {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+  //! @brief The per element Vector3::Transform loop
+  void TransformVector3_PerElement(benchmark::State& state)
+  {
+    const Matrix matrix = CreateViewProjection();
+    const auto src = CreateVector3(state.range(0));
+    std::vector<Vector3> dst(src.size());
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < src.size(); ++i)
+      {
+        dst[i] = Vector3::Transform(src[i], matrix);
+      }
+      benchmark::DoNotOptimize(dst.data());
+    }
+    SetItemsProcessed(state);
+  }
+
+  void TransformVector3_Batch(benchmark::State& state)
+  {
+    MatrixBatchKernelSet kernelSet{};
+    if (!TryGetKernelSet(state, kernelSet))
+    {
+      return;
+    }
+    const Matrix matrix = CreateViewProjection();
+    const auto src = CreateVector3(state.range(0));
+    std::vector<Vector3> dst(src.size());
+    for (auto _ : state)
+    {
+      MatrixBatch::Transform(kernelSet, SpanUtil::AsReadOnlySpan(src), matrix, SpanUtil::AsSpan(dst));
+      benchmark::DoNotOptimize(dst.data());
+    }
+    SetItemsProcessed(state);
+  }
+
+  void TransformNormalVector3_Batch(benchmark::State& state)
+  {
+    MatrixBatchKernelSet kernelSet{};
+    if (!TryGetKernelSet(state, kernelSet))
+    {
+      return;
+    }
+    const Matrix matrix = CreateViewProjection();
+    const auto src = CreateVector3(state.range(0));
+    std::vector<Vector3> dst(src.size());
+    for (auto _ : state)
+    {
+      MatrixBatch::TransformNormal(kernelSet, SpanUtil::AsReadOnlySpan(src), matrix, SpanUtil::AsSpan(dst));
+      benchmark::DoNotOptimize(dst.data());
+    }
+    SetItemsProcessed(state);
+  }
+
+  void TransformVector4_Batch(benchmark::State& state)
+  {
+    MatrixBatchKernelSet kernelSet{};
+    if (!TryGetKernelSet(state, kernelSet))
+    {
+      return;
+    }
+    const Matrix matrix = CreateViewProjection();
+    const auto src = CreateVector4(state.range(0));
+    std::vector<Vector4> dst(src.size());
+    for (auto _ : state)
+    {
+      MatrixBatch::Transform(kernelSet, SpanUtil::AsReadOnlySpan(src), matrix, SpanUtil::AsSpan(dst));
+      benchmark::DoNotOptimize(dst.data());
+    }
+    SetItemsProcessed(state);
+  }
+
+  //! @brief The per element world * viewProjection loop using the Matrix operator
+  void Multiply_PerElement(benchmark::State& state)
+  {
+    const Matrix viewProjection = CreateViewProjection();
+    const auto src = CreateMatrices(state.range(0));
+    std::vector<Matrix> dst(src.size());
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < src.size(); ++i)
+      {
+        dst[i] = src[i] * viewProjection;
+      }
+      benchmark::DoNotOptimize(dst.data());
+    }
+    SetItemsProcessed(state);
+  }
+
+  void Multiply_Batch(benchmark::State& state)
+  {
+    MatrixBatchKernelSet kernelSet{};
+    if (!TryGetKernelSet(state, kernelSet))
+    {
+      return;
+    }
+    const Matrix viewProjection = CreateViewProjection();
+    const auto src = CreateMatrices(state.range(0));
+    std::vector<Matrix> dst(src.size());
+    for (auto _ : state)
+    {
+      MatrixBatch::Multiply(kernelSet, SpanUtil::AsReadOnlySpan(src), viewProjection, SpanUtil::AsSpan(dst));
+      benchmark::DoNotOptimize(dst.data());
+    }
+    SetItemsProcessed(state);
+  }
+
+  void Transpose_Batch(benchmark::State& state)
+  {
+    MatrixBatchKernelSet kernelSet{};
+    if (!TryGetKernelSet(state, kernelSet))
+    {
+      return;
+    }
+    const auto src = CreateMatrices(state.range(0));
+    std::vector<Matrix> dst(src.size());
+    for (auto _ : state)
+    {
+      MatrixBatch::Transpose(kernelSet, SpanUtil::AsReadOnlySpan(src), SpanUtil::AsSpan(dst));
+      benchmark::DoNotOptimize(dst.data());
+    }
+    SetItemsProcessed(state);
+  }
+
+  //! @brief The per element Matrix::Invert loop
+  void Invert_PerElement(benchmark::State& state)
+  {
+    const auto src = CreateMatrices(state.range(0));
+    std::vector<Matrix> dst(src.size());
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < src.size(); ++i)
+      {
+        Matrix::Invert(src[i], dst[i]);
+      }
+      benchmark::DoNotOptimize(dst.data());
+    }
+    SetItemsProcessed(state);
+  }
+
+  void Invert_Batch(benchmark::State& state)
+  {
+    MatrixBatchKernelSet kernelSet{};
+    if (!TryGetKernelSet(state, kernelSet))
+    {
+      return;
+    }
+    const auto src = CreateMatrices(state.range(0));
+    std::vector<Matrix> dst(src.size());
+    for (auto _ : state)
+    {
+      MatrixBatch::Invert(kernelSet, SpanUtil::AsReadOnlySpan(src), SpanUtil::AsSpan(dst));
+      benchmark::DoNotOptimize(dst.data());
+    }
+    SetItemsProcessed(state);
+  }
+}
+
+// range(1) is the MatrixBatchKernelSet: 0 = Scalar, 1 = SSE41, 2 = Neon
+BENCHMARK(TransformVector3_PerElement)->Arg(1000)->Arg(100000);
+BENCHMARK(TransformVector3_Batch)->ArgsProduct({{1000, 100000}, {0, 1, 2}});
+BENCHMARK(TransformNormalVector3_Batch)->ArgsProduct({{1000, 100000}, {0, 1, 2}});
+BENCHMARK(TransformVector4_Batch)->ArgsProduct({{1000, 100000}, {0, 1, 2}});
+BENCHMARK(Multiply_PerElement)->Arg(1000)->Arg(100000);
+BENCHMARK(Multiply_Batch)->ArgsProduct({{1000, 100000}, {0, 1, 2}});
+BENCHMARK(Transpose_Batch)->ArgsProduct({{1000, 100000}, {0, 1, 2}});
+BENCHMARK(Invert_PerElement)->Arg(1000)->Arg(100000);
+BENCHMARK(Invert_Batch)->ArgsProduct({{1000, 100000}, {0, 1, 2}});
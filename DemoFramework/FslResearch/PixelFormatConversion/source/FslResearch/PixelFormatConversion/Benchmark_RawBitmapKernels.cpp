@@ -0,0 +1,155 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/Bitmap/RawBitmapKernels.hpp>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  constexpr uint32_t BenchWidth = 4000;
+  constexpr uint32_t BenchHeight = 3000;
+
+  // Run the benchmark for each kernel set, the unsupported sets will be skipped
+  void KernelSetArguments(benchmark::internal::Benchmark* pBenchmark)
+  {
+    pBenchmark->ArgName("KernelSet");
+    pBenchmark->Arg(static_cast<int64_t>(RawBitmapKernelSet::Scalar));
+    pBenchmark->Arg(static_cast<int64_t>(RawBitmapKernelSet::SSE41));
+    pBenchmark->Arg(static_cast<int64_t>(RawBitmapKernelSet::AVX2));
+    pBenchmark->Arg(static_cast<int64_t>(RawBitmapKernelSet::Neon));
+  }
+
+  const RawBitmapRowKernels* TryGetKernels(benchmark::State& state)
+  {
+    const auto kernelSet = static_cast<RawBitmapKernelSet>(state.range(0));
+    if (!RawBitmapKernels::IsSupported(kernelSet))
+    {
+      state.SkipWithError("Kernel set not supported by the CPU");
+      return nullptr;
+    }
+    return &RawBitmapKernels::GetKernels(kernelSet);
+  }
+
+  std::vector<uint8_t> CreateBuffer(const uint32_t bytesPerPixel)
+  {
+    std::vector<uint8_t> buffer(std::size_t(BenchWidth) * BenchHeight * bytesPerPixel);
+    for (std::size_t i = 0; i < buffer.size(); ++i)
+    {
+      buffer[i] = static_cast<uint8_t>(i * 31u);
+    }
+    return buffer;
+  }
+
+  //! Process all rows of the bitmap using the row kernel and report the throughput as the number of bytes read and written
+  template <typename TRowFunc>
+  void RunRows(benchmark::State& state, const uint32_t srcBytesPerPixel, const uint32_t dstBytesPerPixel, TRowFunc fnRow)
+  {
+    const std::vector<uint8_t> src = CreateBuffer(srcBytesPerPixel);
+    std::vector<uint8_t> dst = CreateBuffer(dstBytesPerPixel);
+    const uint32_t srcStride = BenchWidth * srcBytesPerPixel;
+    const uint32_t dstStride = BenchWidth * dstBytesPerPixel;
+
+    for (auto _ : state)
+    {
+      // This code gets timed
+      const uint8_t* pSrc = src.data();
+      uint8_t* pDst = dst.data();
+      for (uint32_t y = 0; y < BenchHeight; ++y)
+      {
+        fnRow(pDst, pSrc);
+        pSrc += srcStride;
+        pDst += dstStride;
+      }
+      benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(src.size() + dst.size()));
+  }
+
+
+  void Kernel_Swizzle24(benchmark::State& state)
+  {
+    const RawBitmapRowKernels* pKernels = TryGetKernels(state);
+    if (pKernels != nullptr)
+    {
+      RunRows(state, 3, 3, [pKernels](uint8_t* pDst, const uint8_t* pSrc) { pKernels->Swizzle24(pDst, pSrc, BenchWidth, 2, 1, 0); });
+    }
+  }
+
+
+  void Kernel_Swizzle32(benchmark::State& state)
+  {
+    const RawBitmapRowKernels* pKernels = TryGetKernels(state);
+    if (pKernels != nullptr)
+    {
+      RunRows(state, 4, 4, [pKernels](uint8_t* pDst, const uint8_t* pSrc) { pKernels->Swizzle32(pDst, pSrc, BenchWidth, 2, 1, 0, 3); });
+    }
+  }
+
+
+  void Kernel_Swizzle32To24(benchmark::State& state)
+  {
+    const RawBitmapRowKernels* pKernels = TryGetKernels(state);
+    if (pKernels != nullptr)
+    {
+      RunRows(state, 4, 3, [pKernels](uint8_t* pDst, const uint8_t* pSrc) { pKernels->Swizzle32To24(pDst, pSrc, BenchWidth, 2, 1, 0); });
+    }
+  }
+
+
+  void Kernel_Swizzle24To32(benchmark::State& state)
+  {
+    const RawBitmapRowKernels* pKernels = TryGetKernels(state);
+    if (pKernels != nullptr)
+    {
+      RunRows(state, 3, 4,
+              [pKernels](uint8_t* pDst, const uint8_t* pSrc) { pKernels->Swizzle24To32(pDst, pSrc, BenchWidth, 2, 1, 0, 3, 0xFF); });
+    }
+  }
+
+
+  void Kernel_Expand1ByteTo4Bytes(benchmark::State& state)
+  {
+    const RawBitmapRowKernels* pKernels = TryGetKernels(state);
+    if (pKernels != nullptr)
+    {
+      RunRows(state, 1, 4, [pKernels](uint8_t* pDst, const uint8_t* pSrc) { pKernels->Expand1ByteToNBytes(pDst, pSrc, BenchWidth, 4); });
+    }
+  }
+}
+
+BENCHMARK(Kernel_Swizzle24)->Apply(KernelSetArguments);
+BENCHMARK(Kernel_Swizzle32)->Apply(KernelSetArguments);
+BENCHMARK(Kernel_Swizzle32To24)->Apply(KernelSetArguments);
+BENCHMARK(Kernel_Swizzle24To32)->Apply(KernelSetArguments);
+BENCHMARK(Kernel_Expand1ByteTo4Bytes)->Apply(KernelSetArguments);
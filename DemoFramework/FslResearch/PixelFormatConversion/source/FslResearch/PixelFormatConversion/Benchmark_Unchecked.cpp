@@ -45,6 +45,13 @@ namespace
     return {PxSize2D::Create(4000, 3000), pixelFormat, BitmapOrigin::UpperLeft};
   }
 
+  //! Report the throughput as the number of bytes read and written per iteration
+  void SetBytesProcessed(benchmark::State& state, const TightBitmap& dstBitmap, const TightBitmap& srcBitmap)
+  {
+    const auto bytesPerIteration = static_cast<int64_t>(dstBitmap.AsSpan().size() + srcBitmap.AsSpan().size());
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * bytesPerIteration);
+  }
+
   uint8_t TestOp(const uint8_t val)
   {
     return val + 10;
@@ -63,6 +70,7 @@ namespace
       UncheckedRawBitmapTransformer::TransformChannelsRAWNoMemoryOverlap<uint8_t, uint8_t, 3>(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap(),
                                                                                               TestOp);
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
 
@@ -77,6 +85,7 @@ namespace
       // This code gets timed
       UncheckedRawBitmapTransformer::TransformThreeChannelsRAW<uint8_t, uint8_t>(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap(), TestOp);
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -93,6 +102,7 @@ namespace
       UncheckedRawBitmapTransformer::TransformChannelsRAWNoMemoryOverlap<uint8_t, uint8_t, 4>(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap(),
                                                                                               TestOp);
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
 
@@ -107,6 +117,7 @@ namespace
       // This code gets timed
       UncheckedRawBitmapTransformer::TransformFourChannelsRAW<uint8_t, uint8_t>(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap(), TestOp);
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -122,6 +133,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR8G8B8SrgbToR16G16B16UNorm(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -136,6 +148,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR8G8B8A8SrgbToR16G16B16A16UNorm(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -151,6 +164,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR8G8B8SrgbToR16G16B16Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -165,6 +179,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR8G8B8A8SrgbToR16G16B16A16Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -180,6 +195,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR8G8B8SrgbToR32G32B32Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -194,6 +210,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR8G8B8A8SrgbToR32G32B32A32Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -209,6 +226,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR16G16B16FloatToR32G32B32Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
 
@@ -222,6 +240,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR32G32B32FloatToR16G16B16Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -237,6 +256,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR16G16B16A16FloatToR32G32B32A32Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
 
@@ -250,6 +270,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR32G32B32A32FloatToR16G16B16A16Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
   // -------------------------------------------------------------------------------------------------------------------------------------------------
@@ -265,6 +286,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR32G32B32A32FloatToR16G16B16A16UNorm(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
   void UncheckedR16G16B16A16UNormToR32G32B32A32Float(benchmark::State& state)
@@ -277,6 +299,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR16G16B16A16UNormToR32G32B32A32Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
 
@@ -290,6 +313,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR32G32B32FloatToR16G16B16UNorm(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
   void UncheckedR16G16B16UNormToR32G32B32Float(benchmark::State& state)
@@ -302,6 +326,7 @@ namespace
       // This code gets timed
       FslGraphics2D::RawBitmapConverterFunctions::UncheckedR16G16B16UNormToR32G32B32Float(dstBitmap.AsRawBitmap(), srcBitmap.AsRawBitmap());
     }
+    SetBytesProcessed(state, dstBitmap, srcBitmap);
   }
 
 }
@@ -0,0 +1,210 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/MemoryMappedFile.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Math/Vector2.hpp>
+#include <FslBase/Math/Vector3.hpp>
+#include <FslGraphics/Vertices/VertexPositionNormalTexture.hpp>
+#include <FslGraphics/Vertices/VertexPositionTexture.hpp>
+#include <FslGraphics3D/BasicScene/GenericMesh.hpp>
+#include <FslGraphics3D/BasicScene/GenericScene.hpp>
+#include <FslGraphics3D/BasicScene/SceneAllocator.hpp>
+#include <FslGraphics3D/BasicScene/SceneNode.hpp>
+#include <FslGraphics3D/SceneFormat/BasicSceneFormat.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    // 64 meshes of 131072 vertices is 256MB of vertex data + 48MB of index data
+    constexpr uint32_t MeshCount = 64;
+    constexpr uint32_t VertexCountPerMesh = 131072;
+    constexpr uint32_t IndexCountPerMesh = 196608;
+  }
+
+  using StoredMesh = Graphics3D::GenericMesh<VertexPositionNormalTexture, uint16_t>;
+  using StoredScene = Graphics3D::GenericScene<StoredMesh>;
+  using ConvertedMesh = Graphics3D::GenericMesh<VertexPositionTexture, uint16_t>;
+  using ConvertedScene = Graphics3D::GenericScene<ConvertedMesh>;
+
+
+  //! @brief Writes a synthetic scene to a temporary file that is deleted when the benchmark exits
+  class SyntheticSceneFile
+  {
+    std::filesystem::path m_path;
+    uint64_t m_byteSize{0};
+
+  public:
+    SyntheticSceneFile()
+      : m_path(std::filesystem::temp_directory_path() / "FslResearch.SceneFormat.fsf")
+    {
+      std::vector<VertexPositionNormalTexture> vertices(LocalConfig::VertexCountPerMesh);
+      for (uint32_t i = 0; i < LocalConfig::VertexCountPerMesh; ++i)
+      {
+        const auto value = static_cast<float>(i);
+        vertices[i] = VertexPositionNormalTexture(Vector3(value, value + 1.0f, value + 2.0f), Vector3(0.0f, 1.0f, 0.0f), Vector2(value, -value));
+      }
+      std::vector<uint16_t> indices(LocalConfig::IndexCountPerMesh);
+      for (uint32_t i = 0; i < LocalConfig::IndexCountPerMesh; ++i)
+      {
+        indices[i] = static_cast<uint16_t>(i);
+      }
+
+      StoredScene scene(LocalConfig::MeshCount);
+      auto rootNode = std::make_shared<Graphics3D::SceneNode>(LocalConfig::MeshCount);
+      for (uint32_t i = 0; i < LocalConfig::MeshCount; ++i)
+      {
+        scene.AddMesh(std::make_shared<StoredMesh>(vertices, indices, PrimitiveType::TriangleList));
+        rootNode->AddMesh(i);
+      }
+      scene.SetRootNode(rootNode);
+
+      SceneFormat::BasicSceneFormat sceneFormat;
+      sceneFormat.Save(GetPath(), scene);
+      m_byteSize = std::filesystem::file_size(m_path);
+    }
+
+    ~SyntheticSceneFile()
+    {
+      std::error_code error;
+      std::filesystem::remove(m_path, error);
+    }
+
+    SyntheticSceneFile(const SyntheticSceneFile&) = delete;
+    SyntheticSceneFile& operator=(const SyntheticSceneFile&) = delete;
+
+    IO::Path GetPath() const
+    {
+      return IO::Path(m_path.string());
+    }
+
+    uint64_t ByteSize() const noexcept
+    {
+      return m_byteSize;
+    }
+
+    static const SyntheticSceneFile& Get()
+    {
+      static SyntheticSceneFile g_file;
+      return g_file;
+    }
+  };
+
+
+  template <typename TScene>
+  std::shared_ptr<Graphics3D::Scene> LoadSpan(SceneFormat::BasicSceneFormat& rSceneFormat, const ReadOnlySpan<uint8_t> content)
+  {
+    typename TScene::mesh_type::vertex_type defaultVertex;
+    return rSceneFormat.GenericLoad(content, Graphics3D::SceneAllocator::Allocate<TScene>, &defaultVertex, sizeof(defaultVertex));
+  }
+
+
+  void SetCounters(benchmark::State& state, const SyntheticSceneFile& file)
+  {
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * file.ByteSize()));
+    state.counters["FileMB"] = static_cast<double>(file.ByteSize()) / (1024.0 * 1024.0);
+  }
+}
+
+
+//! @brief The stream based loader
+static void LoadStream(benchmark::State& state)
+{
+  const SyntheticSceneFile& file = SyntheticSceneFile::Get();
+  SceneFormat::BasicSceneFormat sceneFormat;
+  StoredMesh::vertex_type defaultVertex;
+  for (auto _ : state)
+  {
+    std::ifstream stream(file.GetPath().ToUTF8String(), std::ios::in | std::ios::binary);
+    auto scene = sceneFormat.GenericLoad(stream, Graphics3D::SceneAllocator::Allocate<StoredScene>, &defaultVertex, sizeof(defaultVertex));
+    benchmark::DoNotOptimize(scene);
+  }
+  SetCounters(state, file);
+}
+
+
+//! @brief Read the entire file into memory and parse it from there
+static void LoadRead(benchmark::State& state)
+{
+  const SyntheticSceneFile& file = SyntheticSceneFile::Get();
+  SceneFormat::BasicSceneFormat sceneFormat;
+  for (auto _ : state)
+  {
+    const IO::MemoryMappedFile content(file.GetPath(), true);
+    auto scene = LoadSpan<StoredScene>(sceneFormat, content.AsReadOnlySpan());
+    benchmark::DoNotOptimize(scene);
+  }
+  SetCounters(state, file);
+}
+
+
+//! @brief Memory map the file and parse it directly (the default path based load)
+static void LoadMapped(benchmark::State& state)
+{
+  const SyntheticSceneFile& file = SyntheticSceneFile::Get();
+  SceneFormat::BasicSceneFormat sceneFormat;
+  for (auto _ : state)
+  {
+    auto scene = sceneFormat.Load<StoredScene>(file.GetPath());
+    benchmark::DoNotOptimize(scene);
+  }
+  SetCounters(state, file);
+}
+
+
+//! @brief Memory map the file and convert the vertices to a different vertex format while loading
+static void LoadMappedConvert(benchmark::State& state)
+{
+  const SyntheticSceneFile& file = SyntheticSceneFile::Get();
+  SceneFormat::BasicSceneFormat sceneFormat;
+  for (auto _ : state)
+  {
+    auto scene = sceneFormat.Load<ConvertedScene>(file.GetPath());
+    benchmark::DoNotOptimize(scene);
+  }
+  SetCounters(state, file);
+}
+
+
+// Register the function as a benchmark
+BENCHMARK(LoadStream)->Unit(benchmark::kMillisecond);
+BENCHMARK(LoadRead)->Unit(benchmark::kMillisecond);
+BENCHMARK(LoadMapped)->Unit(benchmark::kMillisecond);
+BENCHMARK(LoadMappedConvert)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,167 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/Vertices/VertexConversionPlan.hpp>
+#include <FslGraphics/Vertices/VertexConverter.hpp>
+#include <FslGraphics/Vertices/VertexElementFormatUtil.hpp>
+#include <FslGraphics/Vertices/VertexPositionColor.hpp>
+#include <FslGraphics/Vertices/VertexPositionColorNormalTexture.hpp>
+#include <FslGraphics/Vertices/VertexPositionNormalTexture.hpp>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  std::vector<VertexPositionColorNormalTexture> CreateVertices(const std::size_t count)
+  {
+    std::vector<VertexPositionColorNormalTexture> vertices(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const auto value = static_cast<float>(i & 0xFFFF);
+      vertices[i] = VertexPositionColorNormalTexture(Vector3(value, value, value), Vector4(0.25f, 0.5f, 0.75f, 1.0f), Vector3(0.0f, 1.0f, 0.0f),
+                                                     Vector2(value, value));
+    }
+    return vertices;
+  }
+
+  //! The element by element conversion that VertexConverter::GenericConvert used before the conversion plans
+  template <typename TDst, typename TSrc>
+  void ElementConvert(std::vector<TDst>& rDst, const std::vector<TSrc>& src, const TDst& defaultValue)
+  {
+    const VertexDeclarationSpan dstVertexDeclaration = TDst::AsVertexDeclarationSpan();
+    const VertexDeclarationSpan srcVertexDeclaration = TSrc::AsVertexDeclarationSpan();
+    const std::size_t cbDst = rDst.size() * sizeof(TDst);
+    const std::size_t cbSrc = src.size() * sizeof(TSrc);
+    for (uint32_t i = 0; i < dstVertexDeclaration.Count(); ++i)
+    {
+      const VertexElement& dstElement = dstVertexDeclaration[i];
+      const auto cbEntry = VertexElementFormatUtil::GetBytesPerElement(dstElement.Format);
+      const int32_t srcIndex = srcVertexDeclaration.VertexElementIndexOf(dstElement.Usage, dstElement.UsageIndex);
+      if (srcIndex >= 0)
+      {
+        VertexConverter::GenericElementCopy(rDst.data(), cbDst, sizeof(TDst), dstElement.Offset, src.data(), cbSrc, sizeof(TSrc),
+                                            srcVertexDeclaration[srcIndex].Offset, cbEntry, src.size());
+      }
+      else
+      {
+        VertexConverter::GenericElementFill(rDst.data(), cbDst, sizeof(TDst), dstElement.Offset, &defaultValue, sizeof(TDst), dstElement.Offset,
+                                            cbEntry, src.size());
+      }
+    }
+  }
+
+  template <typename TDst>
+  void SetCounters(benchmark::State& state)
+  {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * state.range(0) *
+                                                 static_cast<int64_t>(sizeof(VertexPositionColorNormalTexture) + sizeof(TDst))));
+  }
+}
+
+
+//! @brief Drop the color element using the element by element copy
+static void ElementCopyDropColor(benchmark::State& state)
+{
+  const auto src = CreateVertices(static_cast<std::size_t>(state.range(0)));
+  std::vector<VertexPositionNormalTexture> dst(src.size());
+  const VertexPositionNormalTexture defaultValue;
+  for (auto _ : state)
+  {
+    ElementConvert(dst, src, defaultValue);
+    benchmark::DoNotOptimize(dst.data());
+  }
+  SetCounters<VertexPositionNormalTexture>(state);
+}
+
+
+//! @brief Drop the color element using a prebuilt conversion plan (the normal and texture coordinate copies are merged)
+static void PlanDropColor(benchmark::State& state)
+{
+  const auto src = CreateVertices(static_cast<std::size_t>(state.range(0)));
+  std::vector<VertexPositionNormalTexture> dst(src.size());
+  const VertexPositionNormalTexture defaultValue;
+  const VertexConversionPlan plan(VertexPositionNormalTexture::AsVertexDeclarationSpan(), VertexPositionColorNormalTexture::AsVertexDeclarationSpan(),
+                                  &defaultValue, sizeof(defaultValue));
+  for (auto _ : state)
+  {
+    plan.Apply(dst.data(), dst.size() * sizeof(VertexPositionNormalTexture), src.data(), src.size() * sizeof(VertexPositionColorNormalTexture),
+               src.size());
+    benchmark::DoNotOptimize(dst.data());
+  }
+  SetCounters<VertexPositionNormalTexture>(state);
+}
+
+
+//! @brief Convert the float color to a packed UNORM8 color using a prebuilt conversion plan
+static void PlanPackColor(benchmark::State& state)
+{
+  const auto src = CreateVertices(static_cast<std::size_t>(state.range(0)));
+  std::vector<VertexPositionColor> dst(src.size());
+  const VertexPositionColor defaultValue;
+  const VertexConversionPlan plan(VertexPositionColor::AsVertexDeclarationSpan(), VertexPositionColorNormalTexture::AsVertexDeclarationSpan(),
+                                  &defaultValue, sizeof(defaultValue));
+  for (auto _ : state)
+  {
+    plan.Apply(dst.data(), dst.size() * sizeof(VertexPositionColor), src.data(), src.size() * sizeof(VertexPositionColorNormalTexture), src.size());
+    benchmark::DoNotOptimize(dst.data());
+  }
+  SetCounters<VertexPositionColor>(state);
+}
+
+
+//! @brief Convert the float color to a packed UNORM8 color using a prebuilt conversion plan applied in parallel
+static void PlanPackColorParallel(benchmark::State& state)
+{
+  const auto src = CreateVertices(static_cast<std::size_t>(state.range(0)));
+  std::vector<VertexPositionColor> dst(src.size());
+  const VertexPositionColor defaultValue;
+  const VertexConversionPlan plan(VertexPositionColor::AsVertexDeclarationSpan(), VertexPositionColorNormalTexture::AsVertexDeclarationSpan(),
+                                  &defaultValue, sizeof(defaultValue));
+  JobSystem jobSystem;
+  for (auto _ : state)
+  {
+    plan.Apply(jobSystem, dst.data(), dst.size() * sizeof(VertexPositionColor), src.data(), src.size() * sizeof(VertexPositionColorNormalTexture),
+               src.size());
+    benchmark::DoNotOptimize(dst.data());
+  }
+  SetCounters<VertexPositionColor>(state);
+}
+
+
+// Register the function as a benchmark
+BENCHMARK(ElementCopyDropColor)->Arg(1024)->Arg(1 << 20);
+BENCHMARK(PlanDropColor)->Arg(1024)->Arg(1 << 20);
+BENCHMARK(PlanPackColor)->Arg(1024)->Arg(1 << 20);
+BENCHMARK(PlanPackColorParallel)->Arg(1 << 20);
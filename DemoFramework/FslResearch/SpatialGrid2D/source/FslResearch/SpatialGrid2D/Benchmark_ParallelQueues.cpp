@@ -0,0 +1,82 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Pixel/PxSize2D.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslSimpleUI/Render/IMBatch/Benchmark/DrawReorderBenchmark.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <utility>
+
+// The SpatialGrid draw reorder keeps the opaque and transparent queues in separate grids, which allows the two queues to be processed
+// concurrently while producing the exact same result as processing them one after the other.
+// These benchmarks compare the real serial and parallel preprocessors of FslSimpleUI.Render.IMBatch on the same random command stream.
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t Seed = 1337;
+    constexpr PxSize2D WindowSizePx = PxSize2D::Create(1920, 1080);
+  }
+
+  void RunDrawReorder(benchmark::State& state, const UI::RenderIMBatch::DrawReorderMethod method, std::shared_ptr<JobSystem> jobSystem)
+  {
+    UI::RenderIMBatch::DrawReorderBenchmarkCreateInfo createInfo;
+    createInfo.Method = method;
+    createInfo.WindowSizePx = LocalConfig::WindowSizePx;
+    createInfo.CommandCount = static_cast<uint32_t>(state.range(0));
+    createInfo.Seed = LocalConfig::Seed;
+    createInfo.JobSystem = std::move(jobSystem);
+    const std::unique_ptr<UI::RenderIMBatch::IDrawReorderBenchmark> reorder = UI::RenderIMBatch::DrawReorderBenchmarkFactory::Create(createInfo);
+
+    for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(reorder->Process());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+  void BmDrawReorderSpatialGrid(benchmark::State& state)
+  {
+    RunDrawReorder(state, UI::RenderIMBatch::DrawReorderMethod::SpatialGrid, {});
+  }
+
+  void BmDrawReorderSpatialGridParallel(benchmark::State& state)
+  {
+    RunDrawReorder(state, UI::RenderIMBatch::DrawReorderMethod::SpatialGridParallel, std::make_shared<JobSystem>());
+  }
+}
+
+BENCHMARK(BmDrawReorderSpatialGrid)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BmDrawReorderSpatialGridParallel)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMicrosecond)->UseRealTime();
@@ -0,0 +1,393 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/BasicWindowMetrics.hpp>
+#include <FslBase/Math/Dp/DpPoint2F.hpp>
+#include <FslBase/Math/Pixel/PxRectangle.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslBase/Time/MillisecondTickCount32.hpp>
+#include <FslBase/Time/TimeSpan.hpp>
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslSimpleUI/Base/BaseWindow.hpp>
+#include <FslSimpleUI/Base/BaseWindowContext.hpp>
+#include <FslSimpleUI/Base/IWindowManager.hpp>
+#include <FslSimpleUI/Base/Layout/CanvasLayout.hpp>
+#include <FslSimpleUI/Base/Layout/StackLayout.hpp>
+#include <FslSimpleUI/Base/System/UIManager.hpp>
+#include <FslSimpleUI/Base/UIContext.hpp>
+#include <FslSimpleUI/Base/UIDrawContext.hpp>
+#include <FslSimpleUI/Render/Base/DrawCommandBuffer.hpp>
+#include <FslSimpleUI/Render/Stub/RenderSystem.hpp>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <deque>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t Fanout = 10;
+    constexpr uint32_t DensityDpi = 160;
+    constexpr int32_t Width = 1920;
+    constexpr int32_t Height = 1080;
+    constexpr uint32_t HitPositionCount = 4096;
+    constexpr uint32_t DrawWindowsPerLayout = 100;
+    constexpr uint32_t DrawCommandsPerWindow = 4;
+  }
+
+  enum class RebuildMode
+  {
+    //! Force the entire deques to be regenerated every frame (the same amount of work as the old full rebuild)
+    Full,
+    //! Only the dirty subtree is patched
+    Incremental
+  };
+
+  class BenchLeafWindow final : public UI::BaseWindow
+  {
+  public:
+    explicit BenchLeafWindow(const std::shared_ptr<UI::BaseWindowContext>& context)
+      : UI::BaseWindow(context)
+    {
+      Enable(UI::WindowFlags(UI::WindowFlags::DrawEnabled | UI::WindowFlags::ClickInput));
+      SetHeight(UI::DpLayoutSize1D::Create(2.0f));
+    }
+
+    void ToggleUpdate()
+    {
+      Set(UI::WindowFlags::UpdateEnabled, !IsUpdateEnabled());
+    }
+
+    void ToggleHeight(const bool alternate)
+    {
+      SetHeight(UI::DpLayoutSize1D::Create(alternate ? 3.0f : 2.0f));
+    }
+  };
+
+
+  //! @brief A UIManager with a tree of 'nodeCount' windows
+  struct BenchUI
+  {
+    UI::UIManager Manager;
+    std::shared_ptr<UI::BaseWindowContext> WindowContext;
+    std::vector<std::shared_ptr<BenchLeafWindow>> Leafs;
+
+    explicit BenchUI(const uint32_t nodeCount)
+      : Manager(std::make_shared<DataBinding::DataBindingService>(), std::make_unique<UI::RenderStub::RenderSystem>(), UI::UIColorSpace::SRGBNonLinear,
+                false, BasicWindowMetrics(PxExtent2D::Create(LocalConfig::Width, LocalConfig::Height), Vector2(LocalConfig::DensityDpi, LocalConfig::DensityDpi), LocalConfig::DensityDpi))
+      , WindowContext(std::make_shared<UI::BaseWindowContext>(Manager.GetUIContext(), LocalConfig::DensityDpi, UI::UIColorSpace::SRGBNonLinear))
+    {
+      auto windowManager = Manager.GetWindowManager();
+      auto root = std::make_shared<UI::StackLayout>(WindowContext);
+      windowManager->Add(root);
+
+      // Build the tree breadth first, roughly one in 'Fanout' windows is a layout
+      const uint32_t layoutCount = nodeCount / LocalConfig::Fanout;
+      uint32_t createdCount = 1;
+      uint32_t createdLayoutCount = 1;
+      std::deque<std::shared_ptr<UI::StackLayout>> pendingLayouts;
+      pendingLayouts.push_back(root);
+      while (createdCount < nodeCount && !pendingLayouts.empty())
+      {
+        auto layout = pendingLayouts.front();
+        pendingLayouts.pop_front();
+        for (uint32_t i = 0; i < LocalConfig::Fanout && createdCount < nodeCount; ++i)
+        {
+          if (createdLayoutCount < layoutCount)
+          {
+            auto childLayout = std::make_shared<UI::StackLayout>(WindowContext);
+            layout->AddChild(childLayout);
+            pendingLayouts.push_back(childLayout);
+            ++createdLayoutCount;
+          }
+          else
+          {
+            auto leaf = std::make_shared<BenchLeafWindow>(WindowContext);
+            layout->AddChild(leaf);
+            Leafs.push_back(leaf);
+          }
+          ++createdCount;
+        }
+      }
+      Manager.Update(TimeSpan(0));
+    }
+
+    void ForceFullRebuild(const bool alternate)
+    {
+      // A root clip rectangle change affects every window
+      const PxRectangle clipRectPx(PxValue(0), PxValue(0), PxValue(LocalConfig::Width), PxValue(LocalConfig::Height));
+      Manager.SetClipRectangle(alternate, clipRectPx);
+    }
+  };
+
+
+  class BenchHitWindow final : public UI::BaseWindow
+  {
+  public:
+    explicit BenchHitWindow(const std::shared_ptr<UI::BaseWindowContext>& context, const float widthDp, const float heightDp)
+      : UI::BaseWindow(context)
+    {
+      Enable(UI::WindowFlags(UI::WindowFlags::DrawEnabled | UI::WindowFlags::ClickInput | UI::WindowFlags::MouseOver));
+      SetWidth(UI::DpLayoutSize1D::Create(widthDp));
+      SetHeight(UI::DpLayoutSize1D::Create(heightDp));
+    }
+  };
+
+
+  //! @brief A UIManager with 'targetCount' input targets placed in a grid that covers the screen
+  struct BenchHitUI
+  {
+    UI::UIManager Manager;
+    std::shared_ptr<UI::BaseWindowContext> WindowContext;
+
+    explicit BenchHitUI(const uint32_t targetCount)
+      : Manager(std::make_shared<DataBinding::DataBindingService>(), std::make_unique<UI::RenderStub::RenderSystem>(), UI::UIColorSpace::SRGBNonLinear,
+                false, BasicWindowMetrics(PxExtent2D::Create(LocalConfig::Width, LocalConfig::Height), Vector2(LocalConfig::DensityDpi, LocalConfig::DensityDpi), LocalConfig::DensityDpi))
+      , WindowContext(std::make_shared<UI::BaseWindowContext>(Manager.GetUIContext(), LocalConfig::DensityDpi, UI::UIColorSpace::SRGBNonLinear))
+    {
+      auto canvas = std::make_shared<UI::CanvasLayout>(WindowContext);
+      Manager.GetWindowManager()->Add(canvas);
+
+      // A full screen background followed by a grid of slightly overlapping windows
+      const auto widthDp = static_cast<float>(LocalConfig::Width);
+      const auto heightDp = static_cast<float>(LocalConfig::Height);
+      canvas->AddChild(std::make_shared<BenchHitWindow>(WindowContext, widthDp, heightDp));
+      const auto columns = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(targetCount))));
+      const float cellWidthDp = widthDp / static_cast<float>(columns);
+      const float cellHeightDp = heightDp / static_cast<float>(columns);
+      for (uint32_t i = 1; i < targetCount; ++i)
+      {
+        auto window = std::make_shared<BenchHitWindow>(WindowContext, cellWidthDp * 1.25f, cellHeightDp * 1.25f);
+        canvas->AddChild(window);
+        const auto positionDp = DpPoint2F::Create(static_cast<float>(i % columns) * cellWidthDp, static_cast<float>(i / columns) * cellHeightDp);
+        canvas->SetChildPosition(window, positionDp);
+      }
+      Manager.Update(TimeSpan(0));
+    }
+  };
+
+
+  //! @brief A window that simulates the mesh generation work of a custom drawn control (like a chart) before it records its commands
+  class BenchDrawWindow final : public UI::BaseWindow
+  {
+    uint32_t m_workIterations;
+
+  public:
+    explicit BenchDrawWindow(const std::shared_ptr<UI::BaseWindowContext>& context, const uint32_t workIterations)
+      : UI::BaseWindow(context)
+      , m_workIterations(workIterations)
+    {
+      Enable(UI::WindowFlags::DrawEnabled);
+      SetHeight(UI::DpLayoutSize1D::Create(2.0f));
+    }
+
+    void WinDraw(const UI::UIDrawContext& context) final
+    {
+      UI::BaseWindow::WinDraw(context);
+
+      float value = context.TargetRect.Top().Value;
+      for (uint32_t i = 0; i < m_workIterations; ++i)
+      {
+        value = std::sin(value + static_cast<float>(i));
+      }
+      benchmark::DoNotOptimize(value);
+
+      const UI::UIRenderColor color = UI::UIRenderColor::CreateR8G8B8A8UNorm(255, 255, 255, 255);
+      PxVector2 positionPxf = context.TargetRect.TopLeft();
+      for (uint32_t i = 0; i < LocalConfig::DrawCommandsPerWindow; ++i)
+      {
+        context.CommandBuffer.Draw(UI::MeshHandle(1), positionPxf, PxSize2D::Create(16, 16), color, context.ClipContext);
+        positionPxf.X += PxValueF(16.0f);
+      }
+    }
+  };
+
+
+  //! @brief A UIManager with 'windowCount' draw windows split into stack layouts of 'DrawWindowsPerLayout' windows
+  struct BenchDrawUI
+  {
+    UI::UIManager Manager;
+    std::shared_ptr<UI::BaseWindowContext> WindowContext;
+
+    explicit BenchDrawUI(const uint32_t windowCount, const uint32_t workIterations)
+      : Manager(std::make_shared<DataBinding::DataBindingService>(), std::make_unique<UI::RenderStub::RenderSystem>(), UI::UIColorSpace::SRGBNonLinear,
+                false, BasicWindowMetrics(PxExtent2D::Create(LocalConfig::Width, LocalConfig::Height), Vector2(LocalConfig::DensityDpi, LocalConfig::DensityDpi), LocalConfig::DensityDpi))
+      , WindowContext(std::make_shared<UI::BaseWindowContext>(Manager.GetUIContext(), LocalConfig::DensityDpi, UI::UIColorSpace::SRGBNonLinear))
+    {
+      auto root = std::make_shared<UI::StackLayout>(WindowContext);
+      Manager.GetWindowManager()->Add(root);
+      std::shared_ptr<UI::StackLayout> layout;
+      for (uint32_t i = 0; i < windowCount; ++i)
+      {
+        if ((i % LocalConfig::DrawWindowsPerLayout) == 0u)
+        {
+          layout = std::make_shared<UI::StackLayout>(WindowContext);
+          root->AddChild(layout);
+        }
+        layout->AddChild(std::make_shared<BenchDrawWindow>(WindowContext, workIterations));
+      }
+      Manager.SetUseDrawCache(false);
+      Manager.Update(TimeSpan(0));
+    }
+  };
+
+
+  std::vector<PxPoint2> CreateHitPositions()
+  {
+    std::mt19937 random(1337);
+    std::uniform_int_distribution<int32_t> xDistribution(0, LocalConfig::Width - 1);
+    std::uniform_int_distribution<int32_t> yDistribution(0, LocalConfig::Height - 1);
+    std::vector<PxPoint2> positions(LocalConfig::HitPositionCount);
+    for (auto& rPosition : positions)
+    {
+      rPosition = PxPoint2::Create(xDistribution(random), yDistribution(random));
+    }
+    return positions;
+  }
+
+
+  // --------------------------------------------------------------------------------------------------------------------------------------------------
+
+
+  //! @brief A window toggles a flag, this requires the deques to be rebuilt but no layout
+  template <RebuildMode TMode>
+  void BmUITreeFlagChange(benchmark::State& state)
+  {
+    BenchUI ui(static_cast<uint32_t>(state.range(0)));
+    BenchLeafWindow& rLeaf = *ui.Leafs[ui.Leafs.size() / 2];
+    bool alternate = false;
+    for (auto _ : state)
+    {
+      alternate = !alternate;
+      rLeaf.ToggleUpdate();
+      if constexpr (TMode == RebuildMode::Full)
+      {
+        ui.ForceFullRebuild(alternate);
+      }
+      ui.Manager.Update(TimeSpan(0));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  }
+
+
+  //! @brief Two sibling windows swap their sizes which causes their parent to arrange its children (without changing its own size)
+  template <RebuildMode TMode>
+  void BmUITreeLayoutChange(benchmark::State& state)
+  {
+    BenchUI ui(static_cast<uint32_t>(state.range(0)));
+    // The leafs are created breadth first so this is two siblings
+    const std::size_t leafIndex = (ui.Leafs.size() / LocalConfig::Fanout / 2) * LocalConfig::Fanout;
+    BenchLeafWindow& rLeaf0 = *ui.Leafs[leafIndex];
+    BenchLeafWindow& rLeaf1 = *ui.Leafs[leafIndex + 1];
+    bool alternate = false;
+    for (auto _ : state)
+    {
+      alternate = !alternate;
+      rLeaf0.ToggleHeight(alternate);
+      rLeaf1.ToggleHeight(!alternate);
+      if constexpr (TMode == RebuildMode::Full)
+      {
+        ui.ForceFullRebuild(alternate);
+      }
+      ui.Manager.Update(TimeSpan(0));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  }
+
+
+  //! @brief Move the mouse to random positions, every move performs a mouse over hit test against the input targets
+  void BmUITreeMouseMoveHitTest(benchmark::State& state)
+  {
+    BenchHitUI ui(static_cast<uint32_t>(state.range(0)));
+    const std::vector<PxPoint2> positions = CreateHitPositions();
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(ui.Manager.SendMouseMoveEvent(MillisecondTickCount32(), positions[index], false));
+      index = (index + 1) % positions.size();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  }
+
+
+  //! @brief Click at random positions, every button down performs a click input hit test against the input targets
+  void BmUITreeClickHitTest(benchmark::State& state)
+  {
+    BenchHitUI ui(static_cast<uint32_t>(state.range(0)));
+    const std::vector<PxPoint2> positions = CreateHitPositions();
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(ui.Manager.SendMouseButtonEvent(MillisecondTickCount32(), positions[index], true, false));
+      benchmark::DoNotOptimize(ui.Manager.SendMouseButtonEvent(MillisecondTickCount32(), positions[index], false, false));
+      index = (index + 1) % positions.size();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  }
+
+
+  //! @brief Record the draw commands of 'range(0)' windows that each perform 'range(1)' iterations of work.
+  //!        range(2) is the number of job system worker threads, zero records the commands serially.
+  void BmUITreeDraw(benchmark::State& state)
+  {
+    BenchDrawUI ui(static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(1)));
+    if (state.range(2) > 0)
+    {
+      ui.Manager.SetDrawJobSystem(std::make_shared<JobSystem>(static_cast<uint32_t>(state.range(2))));
+    }
+    for (auto _ : state)
+    {
+      ui.Manager.PreDraw();
+      ui.Manager.Draw(nullptr);
+      ui.Manager.PostDraw();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+
+  void NodeCountArguments(benchmark::internal::Benchmark* pBenchmark)
+  {
+    pBenchmark->Arg(1000)->Arg(10000)->Arg(100000);
+  }
+}
+
+BENCHMARK(BmUITreeFlagChange<RebuildMode::Full>)->Apply(NodeCountArguments);
+BENCHMARK(BmUITreeFlagChange<RebuildMode::Incremental>)->Apply(NodeCountArguments);
+BENCHMARK(BmUITreeLayoutChange<RebuildMode::Full>)->Apply(NodeCountArguments);
+BENCHMARK(BmUITreeLayoutChange<RebuildMode::Incremental>)->Apply(NodeCountArguments);
+BENCHMARK(BmUITreeMouseMoveHitTest)->Arg(1000)->Arg(10000);
+BENCHMARK(BmUITreeClickHitTest)->Arg(1000)->Arg(10000);
+BENCHMARK(BmUITreeDraw)->ArgsProduct({{10000}, {0, 256}, {0, 1, 3, 7}})->UseRealTime();
@@ -51,6 +51,7 @@ namespace Fsl::UI
 
     void SetUseDrawCache(const bool useDrawCache);
     void SetClipRectangle(const bool enabled, const PxRectangle& clipRectanglePx);
+    void SetDrawJobSystem(std::shared_ptr<JobSystem> jobSystem);
 
     std::shared_ptr<AExternalModule> GetExternalModule(const ExternalModuleId& moduleId) const;
 
@@ -67,6 +67,12 @@ namespace Fsl::UI
   }
 
 
+  void ActivitySystem::SetDrawJobSystem(std::shared_ptr<JobSystem> jobSystem)
+  {
+    m_uiManager.SetDrawJobSystem(std::move(jobSystem));
+  }
+
+
   std::shared_ptr<AExternalModule> ActivitySystem::GetExternalModule(const ExternalModuleId& moduleId) const
   {
     return m_uiManager.GetExternalModule(moduleId);
@@ -41,6 +41,7 @@ namespace Fsl
 {
   class DemoPerformanceCapture;
   class IProfilerService;
+  class JobSystem;
   struct PxRectangle;
   struct PxViewport;
   struct UIDemoAppExtensionCreateInfo;
@@ -60,6 +61,17 @@ namespace Fsl
 
   class UIDemoAppExtensionBase : public DataBindingDemoAppExtension
   {
+    //! The UI render times in microseconds and render stats, only registered when the host is benchmarking
+    struct BenchmarkCounters
+    {
+      ScopedProfilerCustomCounterHandle PreprocessDrawCommands;
+      ScopedProfilerCustomCounterHandle GenerateMeshes;
+      ScopedProfilerCustomCounterHandle UpdateBuffers;
+      ScopedProfilerCustomCounterHandle ScheduleDraw;
+      ScopedProfilerCustomCounterHandle BatchCount;
+      ScopedProfilerCustomCounterHandle VertexCount;
+    };
+
     std::unique_ptr<UI::ActivitySystem> m_activitySystem;
     std::shared_ptr<DemoPerformanceCapture> m_demoPerformanceCapture;
 
@@ -68,6 +80,7 @@ namespace Fsl
     ScopedProfilerCustomCounterHandle m_hProfileCounterResolve;
     ScopedProfilerCustomCounterHandle m_hProfileCounterDraw;
     ScopedProfilerCustomCounterHandle m_hProfileCounterWin;
+    std::unique_ptr<BenchmarkCounters> m_benchmarkCounters;
     std::shared_ptr<UI::BaseWindow> m_mainWindow;
 
   public:
@@ -86,6 +99,11 @@ namespace Fsl
     }
 
     void SetUseDrawCache(const bool useDrawCache);
+    //! @brief Record the draw commands of large UI trees in parallel using the given job system (nullptr disables it).
+    //!        The job system is also used by render systems that support parallel draw command reordering.
+    //!        When the job service is available its job system is set on construction.
+    //! @note  This requires that WinDraw of every window is thread safe (it may only modify the window's own state).
+    void SetDrawJobSystem(std::shared_ptr<JobSystem> jobSystem);
 
     // NOLINTNEXTLINE(readability-identifier-naming)
     virtual void SYS_SetRenderSystemViewport(const PxViewport& viewportPx);
@@ -32,7 +32,9 @@
 #include <FslBase/Time/TimeSpan.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslDemoApp/Base/DemoAppConfig.hpp>
+#include <FslDemoApp/Base/Service/Host/IHostInfo.hpp>
 #include <FslDemoService/Graphics/IGraphicsService.hpp>
+#include <FslDemoService/JobSystem/IJobService.hpp>
 #include <FslDemoService/Profiler/DefaultProfilerColors.hpp>
 #include <FslDemoService/Profiler/IProfilerService.hpp>
 #include <FslGraphics/Render/Adapter/INativeBatch2D.hpp>
@@ -43,9 +45,14 @@
 #include <FslSimpleUI/Base/BaseWindow.hpp>
 #include <FslSimpleUI/Base/IWindowManager.hpp>
 #include <FslSimpleUI/Render/Base/IRenderSystem.hpp>
+#include <FslSimpleUI/Render/Base/RenderPerformanceCapture.hpp>
 #include <FslSimpleUI/Render/Base/RenderSystemCreateInfo.hpp>
+#include <FslSimpleUI/Render/IMBatch/IFlexRenderSystemConfig.hpp>
 #include <FslSimpleUI/Render/IMBatch/RenderSystemFactory.hpp>
 // #include <FslSimpleUI/Render/IMBatch/DefaultRenderSystemFactory.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <utility>
 
 namespace Fsl
@@ -62,6 +69,25 @@ namespace Fsl
       return TimeSpan(time.ElapsedTime.Ticks());
     }
 
+    bool IsBenchmarking(const ServiceProvider& serviceProvider)
+    {
+      const auto hostInfo = serviceProvider.TryGet<IHostInfo>();
+      return hostInfo && hostInfo->GetConfig().Benchmark;
+    }
+
+    int32_t ToCounterValue(const uint32_t value) noexcept
+    {
+      return static_cast<int32_t>(std::min(value, static_cast<uint32_t>(std::numeric_limits<int32_t>::max())));
+    }
+
+    int32_t ToMicroseconds(const UI::RenderPerformanceCapture& capture, const UI::RenderPerformanceCaptureId id)
+    {
+      const BasicPerformanceCaptureRecord& record = capture.Get(id);
+      const double frequency = DemoPerformanceCapture::CalcFrequency(capture.GetFrequency());
+      const double microseconds = std::round(static_cast<double>(record.End - record.Begin) * frequency);
+      return static_cast<int32_t>(std::min(microseconds, static_cast<double>(std::numeric_limits<int32_t>::max())));
+    }
+
     std::unique_ptr<UI::IRenderSystem> CreateUIRenderSystem(const UI::IRenderSystemFactory& factory, IGraphicsService& graphicsService,
                                                             const UIDemoAppExtensionCreateInfo& createInfo,
                                                             const SpriteMaterialInfo& defaultMaterialInfo)
@@ -105,6 +131,30 @@ namespace Fsl
     , m_hProfileCounterWin(m_profilerService, m_profilerService->CreateCustomCounter("win", 0, 200, DefaultProfilerColors::UIWinCount))
   {
     m_activitySystem->RegisterEventListener(eventListener);
+
+    // Let the UI draw and the draw reorder spread their work over the shared job system (if the job service is available)
+    const auto jobService = createInfo.DemoServiceProvider.TryGet<IJobService>();
+    if (jobService)
+    {
+      SetDrawJobSystem(jobService->GetJobSystem());
+    }
+
+    if (IsBenchmarking(createInfo.DemoServiceProvider))
+    {
+      m_benchmarkCounters = std::make_unique<BenchmarkCounters>();
+      m_benchmarkCounters->PreprocessDrawCommands.Reset(
+        m_profilerService, m_profilerService->CreateCustomCounter("ui.preprocess", 0, 2000, DefaultProfilerColors::UIDraw));
+      m_benchmarkCounters->GenerateMeshes.Reset(m_profilerService,
+                                                m_profilerService->CreateCustomCounter("ui.meshes", 0, 2000, DefaultProfilerColors::UIDraw));
+      m_benchmarkCounters->UpdateBuffers.Reset(m_profilerService,
+                                               m_profilerService->CreateCustomCounter("ui.buffers", 0, 2000, DefaultProfilerColors::UIDraw));
+      m_benchmarkCounters->ScheduleDraw.Reset(m_profilerService,
+                                              m_profilerService->CreateCustomCounter("ui.schedule", 0, 2000, DefaultProfilerColors::UIDraw));
+      m_benchmarkCounters->BatchCount.Reset(m_profilerService,
+                                            m_profilerService->CreateCustomCounter("ui.batches", 0, 200, DefaultProfilerColors::BatchDrawCalls));
+      m_benchmarkCounters->VertexCount.Reset(
+        m_profilerService, m_profilerService->CreateCustomCounter("ui.vertices", 0, 100000, DefaultProfilerColors::BatchVertices));
+    }
   }
 
 
@@ -128,6 +178,20 @@ namespace Fsl
   }
 
 
+  void UIDemoAppExtensionBase::SetDrawJobSystem(std::shared_ptr<JobSystem> jobSystem)
+  {
+    if (m_activitySystem)
+    {
+      auto* pFlexRenderSystemConfig = dynamic_cast<UI::RenderIMBatch::IFlexRenderSystemConfig*>(m_activitySystem->TryGetRenderSystem());
+      if (pFlexRenderSystemConfig != nullptr)
+      {
+        pFlexRenderSystemConfig->SetJobSystem(jobSystem);
+      }
+      m_activitySystem->SetDrawJobSystem(std::move(jobSystem));
+    }
+  }
+
+
   void UIDemoAppExtensionBase::SYS_SetRenderSystemViewport(const PxViewport& viewportPx)
   {
     FSL_PARAM_NOT_USED(viewportPx);
@@ -313,17 +377,36 @@ namespace Fsl
     m_activitySystem->PreDraw();
     DemoPerformanceCapture* pDemoPerformanceCapture = TryGetDemoPerformanceCapture();
 
-    if (pDemoPerformanceCapture == nullptr)
+    if (pDemoPerformanceCapture == nullptr && !m_benchmarkCounters)
     {
       m_activitySystem->Draw(nullptr);
     }
     else
     {
       UI::RenderPerformanceCapture performanceCapture;
-      pDemoPerformanceCapture->BeginProfile(DemoPerformanceCaptureId::UIDraw);
-      m_activitySystem->Draw(&performanceCapture);
-      pDemoPerformanceCapture->EndProfile(DemoPerformanceCaptureId::UIDraw);
-      pDemoPerformanceCapture->SetRenderPerformanceCapture(performanceCapture);
+      if (pDemoPerformanceCapture != nullptr)
+      {
+        pDemoPerformanceCapture->BeginProfile(DemoPerformanceCaptureId::UIDraw);
+        m_activitySystem->Draw(&performanceCapture);
+        pDemoPerformanceCapture->EndProfile(DemoPerformanceCaptureId::UIDraw);
+        pDemoPerformanceCapture->SetRenderPerformanceCapture(performanceCapture);
+      }
+      else
+      {
+        m_activitySystem->Draw(&performanceCapture);
+      }
+      if (m_benchmarkCounters)
+      {
+        const UI::RenderSystemStats renderStats = m_activitySystem->GetRenderSystem().GetStats();
+        m_profilerService->Set(m_benchmarkCounters->PreprocessDrawCommands,
+                               ToMicroseconds(performanceCapture, UI::RenderPerformanceCaptureId::PreprocessDrawCommands));
+        m_profilerService->Set(m_benchmarkCounters->GenerateMeshes,
+                               ToMicroseconds(performanceCapture, UI::RenderPerformanceCaptureId::GenerateMeshes));
+        m_profilerService->Set(m_benchmarkCounters->UpdateBuffers, ToMicroseconds(performanceCapture, UI::RenderPerformanceCaptureId::UpdateBuffers));
+        m_profilerService->Set(m_benchmarkCounters->ScheduleDraw, ToMicroseconds(performanceCapture, UI::RenderPerformanceCaptureId::ScheduleDraw));
+        m_profilerService->Set(m_benchmarkCounters->BatchCount, ToCounterValue(renderStats.BatchCount));
+        m_profilerService->Set(m_benchmarkCounters->VertexCount, ToCounterValue(renderStats.VertexCount));
+      }
     }
 
     m_activitySystem->PostDraw();
@@ -0,0 +1,211 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslSimpleUI/Base/System/UITreeHitGrid.hpp>
+#include <optional>
+#include <random>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_UITreeHitGrid = TestFixtureFslBase;
+
+  void Add(UI::UITreeInputTargetVector& rTargets, const PxRectangle& rectPx)
+  {
+    rTargets.emplace_back(rectPx, std::shared_ptr<UI::TreeNode>());
+  }
+
+  //! @brief The original reverse scan of the deque
+  std::optional<uint32_t> TryFindLinear(const UI::UITreeInputTargetVector& targets, const PxPoint2& positionPx)
+  {
+    for (auto i = static_cast<uint32_t>(targets.size()); i > 0; --i)
+    {
+      if (targets[i - 1].VisibleRectPx.Contains(positionPx))
+      {
+        return i - 1;
+      }
+    }
+    return {};
+  }
+
+  UI::UITreeInputTargetVector CreateRandomTargets(const uint32_t count, const uint32_t seed)
+  {
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int32_t> positionDistribution(-50, 1000);
+    std::uniform_int_distribution<int32_t> sizeDistribution(0, 80);
+    UI::UITreeInputTargetVector targets;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      const PxPoint2 positionPx = PxPoint2::Create(positionDistribution(random), positionDistribution(random));
+      Add(targets, PxRectangle::Create(positionPx.X.Value, positionPx.Y.Value, sizeDistribution(random), sizeDistribution(random)));
+    }
+    return targets;
+  }
+
+  void ExpectSameAsLinear(const UI::UITreeInputTargetVector& targets, const UI::UITreeHitGrid& grid, const uint32_t seed)
+  {
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int32_t> positionDistribution(-100, 1100);
+    for (uint32_t i = 0; i < 20000; ++i)
+    {
+      const PxPoint2 positionPx = PxPoint2::Create(positionDistribution(random), positionDistribution(random));
+      ASSERT_EQ(TryFindLinear(targets, positionPx), grid.TryFind(positionPx));
+    }
+  }
+}
+
+
+TEST(Test_UITreeHitGrid, Construct)
+{
+  UI::UITreeHitGrid grid;
+  EXPECT_TRUE(grid.IsDirty());
+  EXPECT_FALSE(grid.IsGridEnabled());
+}
+
+
+TEST(Test_UITreeHitGrid, Build_Empty)
+{
+  UI::UITreeHitGrid grid;
+  grid.Build({});
+
+  EXPECT_FALSE(grid.IsDirty());
+  EXPECT_FALSE(grid.TryFind(PxPoint2::Create(0, 0)).has_value());
+}
+
+
+TEST(Test_UITreeHitGrid, MarkDirty)
+{
+  UI::UITreeHitGrid grid;
+  grid.Build({});
+  grid.MarkDirty();
+
+  EXPECT_TRUE(grid.IsDirty());
+}
+
+
+TEST(Test_UITreeHitGrid, TryFind_Small_LastWins)
+{
+  UI::UITreeInputTargetVector targets;
+  Add(targets, PxRectangle::Create(0, 0, 100, 100));
+  Add(targets, PxRectangle::Create(10, 10, 20, 20));
+  Add(targets, PxRectangle::Create(15, 15, 20, 20));
+
+  UI::UITreeHitGrid grid;
+  grid.Build(targets);
+
+  EXPECT_FALSE(grid.IsGridEnabled());
+  EXPECT_EQ(std::optional<uint32_t>(0u), grid.TryFind(PxPoint2::Create(5, 5)));
+  EXPECT_EQ(std::optional<uint32_t>(1u), grid.TryFind(PxPoint2::Create(12, 12)));
+  EXPECT_EQ(std::optional<uint32_t>(2u), grid.TryFind(PxPoint2::Create(20, 20)));
+  EXPECT_EQ(std::optional<uint32_t>(2u), grid.TryFind(PxPoint2::Create(34, 34)));
+  EXPECT_EQ(std::optional<uint32_t>(0u), grid.TryFind(PxPoint2::Create(35, 35)));
+  EXPECT_FALSE(grid.TryFind(PxPoint2::Create(100, 100)).has_value());
+}
+
+
+TEST(Test_UITreeHitGrid, TryFind_Grid_LastWins)
+{
+  // A background followed by a grid of buttons where every second button has a overlapping badge
+  UI::UITreeInputTargetVector targets;
+  Add(targets, PxRectangle::Create(0, 0, 1000, 1000));
+  for (int32_t y = 0; y < 10; ++y)
+  {
+    for (int32_t x = 0; x < 10; ++x)
+    {
+      Add(targets, PxRectangle::Create(x * 100, y * 100, 90, 90));
+      if (((x + y) % 2) == 0)
+      {
+        Add(targets, PxRectangle::Create((x * 100) + 80, (y * 100) + 80, 20, 20));
+      }
+    }
+  }
+
+  UI::UITreeHitGrid grid;
+  grid.Build(targets);
+
+  EXPECT_TRUE(grid.IsGridEnabled());
+  // Button (0,0), its badge and the background
+  EXPECT_EQ(std::optional<uint32_t>(1u), grid.TryFind(PxPoint2::Create(0, 0)));
+  EXPECT_EQ(std::optional<uint32_t>(2u), grid.TryFind(PxPoint2::Create(85, 85)));
+  EXPECT_EQ(std::optional<uint32_t>(2u), grid.TryFind(PxPoint2::Create(95, 95)));
+  EXPECT_EQ(std::optional<uint32_t>(0u), grid.TryFind(PxPoint2::Create(95, 5)));
+  EXPECT_EQ(std::optional<uint32_t>(0u), grid.TryFind(PxPoint2::Create(995, 905)));
+  EXPECT_FALSE(grid.TryFind(PxPoint2::Create(1000, 999)).has_value());
+  EXPECT_FALSE(grid.TryFind(PxPoint2::Create(-1, 0)).has_value());
+  ExpectSameAsLinear(targets, grid, 42);
+}
+
+
+TEST(Test_UITreeHitGrid, TryFind_Random_SameAsLinear)
+{
+  const auto targets = CreateRandomTargets(5000, 1337);
+
+  UI::UITreeHitGrid grid;
+  grid.Build(targets);
+
+  EXPECT_TRUE(grid.IsGridEnabled());
+  ExpectSameAsLinear(targets, grid, 7);
+}
+
+
+TEST(Test_UITreeHitGrid, TryFind_LargeOverlappingTargets_SameAsLinear)
+{
+  // Every target covers the entire area so the grid is not worth it
+  UI::UITreeInputTargetVector targets;
+  for (int32_t i = 0; i < 1000; ++i)
+  {
+    Add(targets, PxRectangle::Create(-(i % 7), -(i % 5), 1000, 1000));
+  }
+
+  UI::UITreeHitGrid grid;
+  grid.Build(targets);
+
+  EXPECT_FALSE(grid.IsGridEnabled());
+  EXPECT_EQ(std::optional<uint32_t>(999u), grid.TryFind(PxPoint2::Create(500, 500)));
+  ExpectSameAsLinear(targets, grid, 3);
+}
+
+
+TEST(Test_UITreeHitGrid, Rebuild)
+{
+  auto targets = CreateRandomTargets(1000, 1);
+  UI::UITreeHitGrid grid;
+  grid.Build(targets);
+
+  targets = CreateRandomTargets(800, 2);
+  grid.MarkDirty();
+  grid.Build(targets);
+
+  ExpectSameAsLinear(targets, grid, 5);
+}
@@ -0,0 +1,241 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Time/TimeSpan.hpp>
+#include <FslSimpleUI/Base/Layout/StackLayout.hpp>
+#include <FslSimpleUI/Base/System/TreeNode.hpp>
+#include <FslSimpleUI/Base/System/UITree.hpp>
+#include <FslSimpleUI/Base/UnitTest/BaseWindowTest.hpp>
+#include <FslSimpleUI/Base/UnitTest/TestUITree_Window.hpp>
+#include <array>
+#include <memory>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  struct DrawRecord
+  {
+    const UI::BaseWindow* pWindow{nullptr};
+    PxAreaRectangleF TargetRect;
+  };
+
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  class TestUITree_IncrementalDeques : public TestUITree_Window
+  {
+  protected:
+    static constexpr uint32_t ChildCount = 3;
+
+    std::shared_ptr<UI::StackLayout> m_stack;
+    std::array<std::shared_ptr<UI::BaseWindowTest>, ChildCount> m_children;
+    std::shared_ptr<std::vector<DrawRecord>> m_drawRecords;
+
+  public:
+    TestUITree_IncrementalDeques()
+      : m_stack(std::make_shared<UI::StackLayout>(m_windowContext))
+      , m_drawRecords(std::make_shared<std::vector<DrawRecord>>())
+    {
+      m_stack->SetOrientation(UI::LayoutOrientation::Vertical);
+      m_tree->Add(m_stack);
+      for (auto& rChild : m_children)
+      {
+        rChild = CreateChild();
+        m_stack->AddChild(rChild);
+      }
+      UpdateAndDraw();
+    }
+
+    std::shared_ptr<UI::BaseWindowTest> CreateChild()
+    {
+      auto child = std::make_shared<UI::BaseWindowTest>(m_windowContext, UI::WindowFlags(UI::WindowFlags::DrawEnabled | UI::WindowFlags::ClickInput));
+      child->SetWidth(UI::DpLayoutSize1D::Create(10.0f));
+      child->SetHeight(UI::DpLayoutSize1D::Create(10.0f));
+      const UI::BaseWindow* const pWindow = child.get();
+      auto drawRecords = m_drawRecords;
+      child->Callbacks.HookWinDraw = [pWindow, drawRecords](const UI::UIDrawContext& context)
+      { drawRecords->push_back(DrawRecord{pWindow, context.TargetRect}); };
+      return child;
+    }
+
+    void UpdateAndDraw()
+    {
+      m_drawRecords->clear();
+      m_tree->Update(TimeSpan(0));
+      m_tree->Draw(m_buffer);
+    }
+
+    const UI::BaseWindow* TryGetClickInputWindow(const PxAreaRectangleF& rect) const
+    {
+      const PxPoint2 hitPositionPx = PxPoint2::Create(static_cast<int32_t>(rect.RawLeft() + (rect.RawWidth() / 2.0f)),
+                                                      static_cast<int32_t>(rect.RawTop() + (rect.RawHeight() / 2.0f)));
+      auto node = m_tree->TryGetClickInputWindow(hitPositionPx);
+      return node ? node->GetWindowPointer() : nullptr;
+    }
+
+    //! @brief Verify that the recorded draws match the windows and that they are stacked on top of each other (so they were all arranged)
+    void CheckStackedDraws(const std::vector<const UI::BaseWindow*>& expectedWindows) const
+    {
+      ASSERT_EQ(expectedWindows.size(), m_drawRecords->size());
+      for (std::size_t i = 0; i < expectedWindows.size(); ++i)
+      {
+        const DrawRecord& record = (*m_drawRecords)[i];
+        EXPECT_EQ(expectedWindows[i], record.pWindow);
+        if (i > 0)
+        {
+          EXPECT_EQ((*m_drawRecords)[i - 1].TargetRect.Bottom(), record.TargetRect.Top());
+        }
+        // The input rectangles must have been patched as well
+        EXPECT_EQ(expectedWindows[i], TryGetClickInputWindow(record.TargetRect));
+      }
+    }
+  };
+}
+
+
+TEST_F(TestUITree_IncrementalDeques, Initial)
+{
+  CheckStackedDraws({m_children[0].get(), m_children[1].get(), m_children[2].get()});
+}
+
+
+TEST_F(TestUITree_IncrementalDeques, NoChange)
+{
+  const std::vector<DrawRecord> oldRecords = *m_drawRecords;
+  UpdateAndDraw();
+
+  ASSERT_EQ(oldRecords.size(), m_drawRecords->size());
+  for (std::size_t i = 0; i < oldRecords.size(); ++i)
+  {
+    EXPECT_EQ(oldRecords[i].pWindow, (*m_drawRecords)[i].pWindow);
+    EXPECT_EQ(oldRecords[i].TargetRect, (*m_drawRecords)[i].TargetRect);
+  }
+}
+
+
+// Resizing the first window makes the stack move its siblings even though their layout isn't dirty
+TEST_F(TestUITree_IncrementalDeques, ResizeMovesSiblings)
+{
+  const PxValueF oldTopPx = (*m_drawRecords)[1].TargetRect.Top();
+
+  // Keep the total height so the stack itself is not moved or resized (which would regenerate its entire subtree)
+  m_children[0]->SetHeight(UI::DpLayoutSize1D::Create(15.0f));
+  m_children[2]->SetHeight(UI::DpLayoutSize1D::Create(5.0f));
+  UpdateAndDraw();
+
+  CheckStackedDraws({m_children[0].get(), m_children[1].get(), m_children[2].get()});
+  EXPECT_NE(oldTopPx, (*m_drawRecords)[1].TargetRect.Top());
+}
+
+
+TEST_F(TestUITree_IncrementalDeques, Collapse)
+{
+  m_children[1]->SetVisibility(UI::ItemVisibility::Collapsed);
+  UpdateAndDraw();
+  CheckStackedDraws({m_children[0].get(), m_children[2].get()});
+
+  m_children[1]->SetVisibility(UI::ItemVisibility::Visible);
+  UpdateAndDraw();
+  CheckStackedDraws({m_children[0].get(), m_children[1].get(), m_children[2].get()});
+}
+
+
+TEST_F(TestUITree_IncrementalDeques, Hidden)
+{
+  // A hidden window still takes up its space
+  m_children[0]->SetVisibility(UI::ItemVisibility::Hidden);
+  UpdateAndDraw();
+
+  ASSERT_EQ(2u, m_drawRecords->size());
+  EXPECT_EQ(m_children[1].get(), (*m_drawRecords)[0].pWindow);
+  EXPECT_EQ(m_children[2].get(), (*m_drawRecords)[1].pWindow);
+  EXPECT_EQ((*m_drawRecords)[0].TargetRect.Bottom(), (*m_drawRecords)[1].TargetRect.Top());
+}
+
+
+TEST_F(TestUITree_IncrementalDeques, EnableUpdate)
+{
+  ASSERT_EQ(0u, m_children[1]->GetCallCount().WinUpdate);
+
+  ASSERT_TRUE(m_tree->TrySetWindowFlags(m_children[1].get(), UI::WindowFlags::UpdateEnabled, true));
+  UpdateAndDraw();
+  EXPECT_EQ(1u, m_children[1]->GetCallCount().WinUpdate);
+  EXPECT_EQ(0u, m_children[0]->GetCallCount().WinUpdate);
+  EXPECT_EQ(0u, m_children[2]->GetCallCount().WinUpdate);
+
+  ASSERT_TRUE(m_tree->TrySetWindowFlags(m_children[1].get(), UI::WindowFlags::UpdateEnabled, false));
+  UpdateAndDraw();
+  EXPECT_EQ(1u, m_children[1]->GetCallCount().WinUpdate);
+  CheckStackedDraws({m_children[0].get(), m_children[1].get(), m_children[2].get()});
+}
+
+
+TEST_F(TestUITree_IncrementalDeques, RemoveChild)
+{
+  m_stack->RemoveChild(m_children[1]);
+  UpdateAndDraw();
+
+  CheckStackedDraws({m_children[0].get(), m_children[2].get()});
+}
+
+
+TEST_F(TestUITree_IncrementalDeques, AddChild)
+{
+  auto newChild = CreateChild();
+  m_stack->AddChild(newChild);
+  UpdateAndDraw();
+
+  CheckStackedDraws({m_children[0].get(), m_children[1].get(), m_children[2].get(), newChild.get()});
+}
+
+
+TEST_F(TestUITree_IncrementalDeques, AddNestedChild)
+{
+  auto nestedStack = std::make_shared<UI::StackLayout>(m_windowContext);
+  nestedStack->SetOrientation(UI::LayoutOrientation::Vertical);
+  m_stack->AddChild(nestedStack);
+  UpdateAndDraw();
+
+  auto newChild = CreateChild();
+  nestedStack->AddChild(newChild);
+  UpdateAndDraw();
+
+  CheckStackedDraws({m_children[0].get(), m_children[1].get(), m_children[2].get(), newChild.get()});
+}
+
+
+TEST_F(TestUITree_IncrementalDeques, ClipRectangle)
+{
+  const PxRectangle clipRectPx(PxValue(0), PxValue(0), PxValue(1000), PxValue(1000));
+  m_tree->SetClipRectangle(true, clipRectPx);
+  UpdateAndDraw();
+  CheckStackedDraws({m_children[0].get(), m_children[1].get(), m_children[2].get()});
+}
@@ -0,0 +1,179 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Dp/DpSize1DF.hpp>
+#include <FslBase/Time/TimeSpan.hpp>
+#include <FslSimpleUI/Base/BaseWindowContext.hpp>
+#include <FslSimpleUI/Base/Layout/StackLayout.hpp>
+#include <FslSimpleUI/Base/System/UITree.hpp>
+#include <FslSimpleUI/Base/UnitTest/BaseWindowTest.hpp>
+#include <FslSimpleUI/Base/UnitTest/TestUITree_Window.hpp>
+#include <memory>
+
+using namespace Fsl;
+
+namespace
+{
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  class TestUITree_LayoutInvalidation : public TestUITree_Window
+  {
+  protected:
+    // Tree:
+    // - m_outerStack
+    //   - m_innerStack
+    //     - m_childA
+    //     - m_childB
+    //   - m_childC
+    std::shared_ptr<UI::StackLayout> m_outerStack;
+    std::shared_ptr<UI::StackLayout> m_innerStack;
+    std::shared_ptr<UI::BaseWindowTest> m_childA;
+    std::shared_ptr<UI::BaseWindowTest> m_childB;
+    std::shared_ptr<UI::BaseWindowTest> m_childC;
+
+  public:
+    TestUITree_LayoutInvalidation()
+      : m_outerStack(std::make_shared<UI::StackLayout>(m_windowContext))
+      , m_innerStack(std::make_shared<UI::StackLayout>(m_windowContext))
+      , m_childA(CreateChild())
+      , m_childB(CreateChild())
+      , m_childC(CreateChild())
+    {
+      m_outerStack->SetOrientation(UI::LayoutOrientation::Vertical);
+      m_innerStack->SetOrientation(UI::LayoutOrientation::Vertical);
+      m_tree->Add(m_outerStack);
+      m_outerStack->AddChild(m_innerStack);
+      m_outerStack->AddChild(m_childC);
+      m_innerStack->AddChild(m_childA);
+      m_innerStack->AddChild(m_childB);
+      Update();
+    }
+
+    std::shared_ptr<UI::BaseWindowTest> CreateChild()
+    {
+      auto child = std::make_shared<UI::BaseWindowTest>(m_windowContext);
+      child->SetWidth(UI::DpLayoutSize1D::Create(20.0f));
+      child->SetHeight(UI::DpLayoutSize1D::Create(10.0f));
+      return child;
+    }
+
+    UI::LayoutCallCounter Update()
+    {
+      m_windowContext->LayoutCounter->Clear();
+      m_tree->Update(TimeSpan(0));
+      return *m_windowContext->LayoutCounter;
+    }
+  };
+}
+
+
+TEST_F(TestUITree_LayoutInvalidation, NoChange)
+{
+  const UI::LayoutCallCounter counter = Update();
+
+  EXPECT_EQ(0u, counter.MeasureCalls);
+  EXPECT_EQ(0u, counter.ArrangeCalls);
+}
+
+
+// A change that does not modify the desired size of the window only requires the window itself to be laid out
+TEST_F(TestUITree_LayoutInvalidation, DesiredSizeUnchanged)
+{
+  const auto oldCountA = m_childA->GetCallCount();
+  const auto oldCountB = m_childB->GetCallCount();
+  const auto oldCountC = m_childC->GetCallCount();
+  const PxRectangle oldRectA = m_childA->WinGetContentRectanglePx();
+
+  // The min width is smaller than the requested width so the desired size is unaffected
+  m_childA->SetMinWidth(DpSize1DF::Create(10.0f));
+  const UI::LayoutCallCounter counter = Update();
+
+  EXPECT_EQ(1u, counter.MeasureCalls);
+  EXPECT_EQ(1u, counter.ArrangeCalls);
+  EXPECT_EQ(oldCountA.MeasureOverride + 1, m_childA->GetCallCount().MeasureOverride);
+  EXPECT_EQ(oldCountA.ArrangeOverride + 1, m_childA->GetCallCount().ArrangeOverride);
+  EXPECT_EQ(oldCountB.MeasureOverride, m_childB->GetCallCount().MeasureOverride);
+  EXPECT_EQ(oldCountC.MeasureOverride, m_childC->GetCallCount().MeasureOverride);
+  EXPECT_EQ(oldRectA, m_childA->WinGetContentRectanglePx());
+
+  // Nothing was left dirty
+  const UI::LayoutCallCounter counter2 = Update();
+  EXPECT_EQ(0u, counter2.MeasureCalls);
+  EXPECT_EQ(0u, counter2.ArrangeCalls);
+}
+
+
+// A change to the desired size invalidates the parents until the sizes stop changing
+TEST_F(TestUITree_LayoutInvalidation, DesiredSizeChanged)
+{
+  const PxRectangle oldRectC = m_childC->WinGetContentRectanglePx();
+
+  m_childA->SetHeight(UI::DpLayoutSize1D::Create(20.0f));
+  const UI::LayoutCallCounter counter = Update();
+
+  EXPECT_LT(1u, counter.MeasureCalls);
+  EXPECT_LT(1u, counter.ArrangeCalls);
+  // Child B and C must have been moved down
+  EXPECT_EQ(m_childA->WinGetContentRectanglePx().Bottom(), m_childB->WinGetContentRectanglePx().Top());
+  EXPECT_EQ(m_childB->WinGetContentRectanglePx().Bottom(), m_childC->WinGetContentRectanglePx().Top());
+  EXPECT_LT(oldRectC.Top(), m_childC->WinGetContentRectanglePx().Top());
+
+  // Nothing was left dirty
+  const UI::LayoutCallCounter counter2 = Update();
+  EXPECT_EQ(0u, counter2.MeasureCalls);
+  EXPECT_EQ(0u, counter2.ArrangeCalls);
+}
+
+
+// Two windows trading sizes changes their desired sizes, but not the desired size of their parent
+TEST_F(TestUITree_LayoutInvalidation, DesiredSizeChangedParentUnchanged)
+{
+  const PxRectangle oldRectC = m_childC->WinGetContentRectanglePx();
+  const auto oldCountC = m_childC->GetCallCount();
+
+  m_childA->SetHeight(UI::DpLayoutSize1D::Create(15.0f));
+  m_childB->SetHeight(UI::DpLayoutSize1D::Create(5.0f));
+  Update();
+
+  EXPECT_EQ(m_childA->WinGetContentRectanglePx().Bottom(), m_childB->WinGetContentRectanglePx().Top());
+  EXPECT_EQ(oldRectC, m_childC->WinGetContentRectanglePx());
+  EXPECT_EQ(oldCountC.MeasureOverride, m_childC->GetCallCount().MeasureOverride);
+  EXPECT_EQ(oldCountC.ArrangeOverride, m_childC->GetCallCount().ArrangeOverride);
+}
+
+
+TEST_F(TestUITree_LayoutInvalidation, Collapse)
+{
+  m_childA->SetVisibility(UI::ItemVisibility::Collapsed);
+  Update();
+
+  EXPECT_EQ(m_innerStack->WinGetContentRectanglePx().Top(), m_childB->WinGetContentRectanglePx().Top());
+  EXPECT_EQ(m_childB->WinGetContentRectanglePx().Bottom(), m_childC->WinGetContentRectanglePx().Top());
+}
@@ -0,0 +1,226 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Pixel/PxAreaRectangleF.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslBase/Time/TimeSpan.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslSimpleUI/Base/System/UITree.hpp>
+#include <FslSimpleUI/Base/UnitTest/BaseWindowTest.hpp>
+#include <FslSimpleUI/Base/UnitTest/TestFixtureFslSimpleUIUITree.hpp>
+#include <FslSimpleUI/Render/Base/DrawCommandBufferEx.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  class TestUITree_ParallelDraw : public TestFixtureFslSimpleUIUITree
+  {
+  protected:
+    std::vector<std::shared_ptr<UI::BaseWindowTest>> m_windows;
+    std::vector<std::thread::id> m_drawThreadIds;
+    std::shared_ptr<UI::ICustomDrawData> m_customData{std::make_shared<UI::ICustomDrawData>()};
+
+    //! @brief Create groupCount windows that each have childCount children
+    void CreateWindows(const uint32_t groupCount, const uint32_t childCount)
+    {
+      m_drawThreadIds.resize(std::size_t(groupCount) * (childCount + 1u));
+      for (uint32_t groupIndex = 0; groupIndex < groupCount; ++groupIndex)
+      {
+        auto group = CreateWindow();
+        m_tree->Add(group);
+        for (uint32_t i = 0; i < childCount; ++i)
+        {
+          m_tree->AddChild(group, CreateWindow());
+        }
+      }
+      m_tree->Update(TimeSpan(0));
+    }
+
+  private:
+    std::shared_ptr<UI::BaseWindowTest> CreateWindow()
+    {
+      const auto index = static_cast<uint32_t>(m_windows.size());
+      auto window = std::make_shared<UI::BaseWindowTest>(m_windowContext, UI::WindowFlags::DrawEnabled);
+      window->Callbacks.HookWinDraw = [this, index](const UI::UIDrawContext& context)
+      {
+        m_drawThreadIds[index] = std::this_thread::get_id();
+        RecordCommands(context.CommandBuffer, index);
+      };
+      m_windows.push_back(window);
+      return window;
+    }
+
+    static void DrawCustomBasicImage(UI::UIRawMeshBuilder2D& /*rBuilder*/, const PxVector2 /*dstPositionPxf*/, const PxSize2D /*dstSizePx*/,
+                                     const UI::DrawClipContext& /*clipContext*/, const RenderBasicImageInfo& /*renderInfo*/,
+                                     const UI::ICustomDrawData* const /*pCustomData*/)
+    {
+    }
+
+    static void DrawCustomText(UI::ScopedCustomUITextMeshBuilder2D& /*rBuilder*/, const PxVector2 /*dstPositionPxf*/, const PxSize2D /*dstSizePx*/,
+                               const UI::ICustomDrawData* const /*pCustomData*/)
+    {
+    }
+
+    //! @brief Record a mix of normal, rotated and custom commands. Runs of windows share a clip rectangle like the windows of a clipped subtree.
+    void RecordCommands(UI::DrawCommandBuffer& rBuffer, const uint32_t index) const
+    {
+      const UI::MeshHandle hMesh(static_cast<int32_t>(1u + (index % 7u)));
+      const PxVector2 positionPxf = PxVector2::Create(static_cast<float>(index % 50u), static_cast<float>(index / 50u));
+      const PxSize2D sizePx = PxSize2D::Create(10, 10);
+      const UI::UIRenderColor color = UI::UIRenderColor::CreateR8G8B8A8UNorm(255, 255, 255, 255);
+      const UI::DrawClipContext clipContext =
+        (index % 5u) == 0u ? UI::DrawClipContext() : UI::DrawClipContext(true, PxAreaRectangleF::Create(0, 0, 100.0f + float(index / 8u), 100));
+
+      rBuffer.Draw(hMesh, positionPxf, sizePx, color, clipContext);
+      switch (index % 4u)
+      {
+      case 1:
+        rBuffer.DrawCustom(hMesh, positionPxf, sizePx, color, clipContext, DrawCustomText, m_customData);
+        break;
+      case 2:
+        rBuffer.DrawCustom(hMesh, positionPxf, sizePx, color, clipContext, DrawCustomBasicImage, m_customData);
+        break;
+      case 3:
+        rBuffer.DrawRotated90CW(hMesh, positionPxf, sizePx, color, clipContext);
+        break;
+      default:
+        break;
+      }
+    }
+  };
+
+
+  void ExpectEqual(const UI::DrawCommandBufferEx& expected, const UI::DrawCommandBufferEx& actual)
+  {
+    const ReadOnlySpan<UI::EncodedCommand> expectedCommands = expected.AsReadOnlySpan();
+    const ReadOnlySpan<UI::EncodedCommand> actualCommands = actual.AsReadOnlySpan();
+    ASSERT_EQ(expectedCommands.size(), actualCommands.size());
+    ASSERT_EQ(expected.AsReadOnlyClipRectangleSpan().size(), actual.AsReadOnlyClipRectangleSpan().size());
+    for (std::size_t i = 0; i < expected.AsReadOnlyClipRectangleSpan().size(); ++i)
+    {
+      EXPECT_EQ(expected.AsReadOnlyClipRectangleSpan()[i], actual.AsReadOnlyClipRectangleSpan()[i]);
+    }
+    for (uint32_t i = 0; i < expectedCommands.size(); ++i)
+    {
+      EXPECT_EQ(expectedCommands[i], actualCommands[i]);
+      const UI::EncodedCommandParams& params = expected.FastGetCommandParams(i);
+      EXPECT_EQ(params, actual.FastGetCommandParams(i));
+      switch (expectedCommands[i].State.Type())
+      {
+      case UI::DrawCommandType::DrawCustomBasicImageAtOffsetAndSize:
+        EXPECT_EQ(expected.FastGetCustomDrawBasicImageInfo(params.Custom0).FnDraw, actual.FastGetCustomDrawBasicImageInfo(params.Custom0).FnDraw);
+        EXPECT_EQ(expected.FastGetCustomDrawBasicImageInfo(params.Custom0).CustomData,
+                  actual.FastGetCustomDrawBasicImageInfo(params.Custom0).CustomData);
+        break;
+      case UI::DrawCommandType::DrawCustomTextAtOffsetAndSize:
+        EXPECT_EQ(expected.FastGetCustomDrawTextInfo(params.Custom0).FnDraw, actual.FastGetCustomDrawTextInfo(params.Custom0).FnDraw);
+        EXPECT_EQ(expected.FastGetCustomDrawTextInfo(params.Custom0).CustomData, actual.FastGetCustomDrawTextInfo(params.Custom0).CustomData);
+        break;
+      default:
+        break;
+      }
+    }
+  }
+}
+
+
+TEST_F(TestUITree_ParallelDraw, SameAsSerial)
+{
+  CreateWindows(16, 63);
+
+  UI::DrawCommandBufferEx serialBuffer;
+  m_tree->Draw(serialBuffer);
+  ASSERT_GT(serialBuffer.Count(), 1024u);
+
+  m_tree->SetDrawJobSystem(std::make_shared<JobSystem>(3));
+  // Draw twice to ensure that the reused chunk buffers are cleared
+  for (uint32_t i = 0; i < 2; ++i)
+  {
+    UI::DrawCommandBufferEx parallelBuffer;
+    m_tree->Draw(parallelBuffer);
+    ExpectEqual(serialBuffer, parallelBuffer);
+  }
+}
+
+
+TEST_F(TestUITree_ParallelDraw, SameAsSerial_AppendToExistingCommands)
+{
+  CreateWindows(9, 99);
+
+  // The first recorded command shares its clip rectangle with the content that is already in the buffer
+  const UI::DrawClipContext clipContext(true, PxAreaRectangleF::Create(0, 0, 100, 100));
+  const UI::UIRenderColor color = UI::UIRenderColor::CreateR8G8B8A8UNorm(255, 255, 255, 255);
+  UI::DrawCommandBufferEx serialBuffer;
+  serialBuffer.Draw(UI::MeshHandle(1), PxVector2(), PxSize2D::Create(1, 1), color, clipContext);
+  m_tree->Draw(serialBuffer);
+
+  m_tree->SetDrawJobSystem(std::make_shared<JobSystem>(2));
+  UI::DrawCommandBufferEx parallelBuffer;
+  parallelBuffer.Draw(UI::MeshHandle(1), PxVector2(), PxSize2D::Create(1, 1), color, clipContext);
+  m_tree->Draw(parallelBuffer);
+
+  ExpectEqual(serialBuffer, parallelBuffer);
+}
+
+
+TEST_F(TestUITree_ParallelDraw, SmallTreeIsDrawnOnTheCallingThread)
+{
+  CreateWindows(4, 9);
+  m_tree->SetDrawJobSystem(std::make_shared<JobSystem>(3));
+
+  UI::DrawCommandBufferEx buffer;
+  m_tree->Draw(buffer);
+
+  for (const auto threadId : m_drawThreadIds)
+  {
+    EXPECT_EQ(std::this_thread::get_id(), threadId);
+  }
+}
+
+
+TEST_F(TestUITree_ParallelDraw, DrawCallsAreCountedOnce)
+{
+  CreateWindows(8, 127);
+  m_tree->SetDrawJobSystem(std::make_shared<JobSystem>(3));
+
+  UI::DrawCommandBufferEx buffer;
+  m_tree->Draw(buffer);
+
+  for (const auto& window : m_windows)
+  {
+    EXPECT_EQ(1u, window->GetCallCount().WinDraw);
+  }
+  EXPECT_EQ(m_windows.size(), m_tree->GetStats().DrawCalls);
+}
@@ -128,6 +128,25 @@ TEST_F(TestUIManager, DrawEmpty)
 }
 
 
+TEST_F(TestUIManager, GetStats_LayoutCalls)
+{
+  m_manager.Update(TimeSpan::FromMicroseconds(1));
+
+  // Nothing changed so the layout is cached
+  m_manager.Update(TimeSpan::FromMicroseconds(1));
+  const UI::UIStats stats0 = m_manager.GetStats();
+  EXPECT_EQ(0u, stats0.MeasureCalls);
+  EXPECT_EQ(0u, stats0.ArrangeCalls);
+
+  // A resize forces the root window to be laid out
+  m_manager.Resized(BasicWindowMetrics(PxExtent2D::Create(640, 480), Vector2(160, 160), 160));
+  m_manager.Update(TimeSpan::FromMicroseconds(1));
+  const UI::UIStats stats1 = m_manager.GetStats();
+  EXPECT_LE(1u, stats1.MeasureCalls);
+  EXPECT_LE(1u, stats1.ArrangeCalls);
+}
+
+
 // TEST_F(Test_UIManager, RegisterEventListener)
 //{
 //  // void RegisterEventListener(const std::weak_ptr<IEventListener>& eventListener);
@@ -160,6 +160,24 @@ namespace Fsl
         return m_layoutCache.ContentRectPx;
       }
 
+      //! @brief The final rectangle supplied to the last Arrange call
+      const PxRectangle& WinGetArrangeFinalRectanglePx() const noexcept
+      {
+        return m_layoutCache.ArrangeLastFinalRectPx;
+      }
+
+      //! @brief The available size supplied to the last Measure call
+      const PxAvailableSize& WinGetMeasureAvailableSizePx() const noexcept
+      {
+        return m_layoutCache.MeasureLastAvailableSizePx;
+      }
+
+      //! @brief Check if the window has been arranged at least once (so the last measure and arrange input is valid)
+      bool WinIsArranged() const noexcept
+      {
+        return m_flags.IsEnabled(BaseWindowFlags::Arranged);
+      }
+
       virtual void WinHandleEvent(const RoutedEvent& routedEvent);
 
       //! @note This is only called if enabled.
@@ -169,6 +187,8 @@ namespace Fsl
       //! @brief Called by the UITree to request a draw operation.
       //! @param drawContext the UIDrawContext.
       //! @note This is only called if enabled.
+      //!       If the UI draw job system is set WinDraw can be called concurrently for different windows, so it should only record commands
+      //!       and modify the window's own state.
       virtual void WinDraw(const UIDrawContext& context)
       {
         FSL_PARAM_NOT_USED(context);
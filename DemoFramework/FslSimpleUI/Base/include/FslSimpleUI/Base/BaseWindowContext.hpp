@@ -60,6 +60,9 @@ namespace Fsl
       SpriteUnitConverter UnitConverter;
       UIColorConverter ColorConverter;
 
+      //! Keep a strong reference to the counter so the windows can update it without locking the UI context
+      std::shared_ptr<LayoutCallCounter> LayoutCounter;
+
       explicit BaseWindowContext(const std::shared_ptr<UIContext>& uiContext, const uint32_t densityDpi, const UIColorSpace colorSpace);
       ~BaseWindowContext();
 
@@ -55,7 +55,9 @@ namespace Fsl::UI
       InBatchPropertyUpdate = (0x01 << BitShiftBaseWindowFlags),
       InLayoutArrange = (0x02 << BitShiftBaseWindowFlags),
       InLayoutMeasure = (0x04 << BitShiftBaseWindowFlags),
-      CachedEventReady = (0x08 << BitShiftBaseWindowFlags)
+      CachedEventReady = (0x08 << BitShiftBaseWindowFlags),
+      //! The window has been arranged at least once
+      Arranged = (0x10 << BitShiftBaseWindowFlags)
     };
 
     uint32_t Value{0};
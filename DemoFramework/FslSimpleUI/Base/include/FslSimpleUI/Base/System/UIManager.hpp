@@ -41,6 +41,7 @@
 
 namespace Fsl
 {
+  class JobSystem;
   struct PxPoint2;
   struct PxRectangle;
   struct TimeSpan;
@@ -106,6 +107,9 @@ namespace Fsl
 
       void SetUseDrawCache(const bool useDrawCache);
       void SetClipRectangle(const bool enabled, const PxRectangle& clipRectanglePx);
+      //! @brief Record the draw commands of large UI trees in parallel using the given job system (nullptr disables it).
+      //! @note  This requires that WinDraw of every window is thread safe (it may only modify the window's own state).
+      void SetDrawJobSystem(std::shared_ptr<JobSystem> jobSystem);
 
       std::shared_ptr<AExternalModule> GetExternalModule(const ExternalModuleId& moduleId) const;
 
@@ -31,6 +31,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslSimpleUI/Base/LayoutCallCounter.hpp>
 #include <memory>
 
 namespace Fsl
@@ -53,6 +54,8 @@ namespace Fsl
       const std::shared_ptr<IWindowManager> WindowManager;
       const std::shared_ptr<WindowEventSender> EventSender;
       const std::shared_ptr<IMeshManager> MeshManager;
+      //! Shared by all windows so the layout work can be tracked
+      const std::shared_ptr<LayoutCallCounter> LayoutCounter;
 
       UIContext(std::shared_ptr<DataBinding::DataBindingService> dataBindingService, std::shared_ptr<IWindowManager> windowManager,
                 std::shared_ptr<WindowEventSender> eventSender, std::shared_ptr<IMeshManager> meshManager);
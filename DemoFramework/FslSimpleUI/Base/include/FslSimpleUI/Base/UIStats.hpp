@@ -42,6 +42,10 @@ namespace Fsl::UI
     uint32_t PostLayoutCalls{0};
     uint32_t DrawCalls{0};
     uint32_t WindowCount{0};
+    //! The number of windows that were measured (cache misses only)
+    uint32_t MeasureCalls{0};
+    //! The number of windows that were arranged (cache misses only)
+    uint32_t ArrangeCalls{0};
 
     constexpr UIStats() noexcept = default;
     constexpr UIStats(const uint32_t updateCalls, const uint32_t resolveCalls, const uint32_t postLayoutCalls, const uint32_t drawCalls,
@@ -53,6 +57,18 @@ namespace Fsl::UI
       , WindowCount(windowCount)
     {
     }
+
+    constexpr UIStats(const uint32_t updateCalls, const uint32_t resolveCalls, const uint32_t postLayoutCalls, const uint32_t drawCalls,
+                      const uint32_t windowCount, const uint32_t measureCalls, const uint32_t arrangeCalls) noexcept
+      : UpdateCalls(updateCalls)
+      , ResolveCalls(resolveCalls)
+      , PostLayoutCalls(postLayoutCalls)
+      , DrawCalls(drawCalls)
+      , WindowCount(windowCount)
+      , MeasureCalls(measureCalls)
+      , ArrangeCalls(arrangeCalls)
+    {
+    }
   };
 }
 
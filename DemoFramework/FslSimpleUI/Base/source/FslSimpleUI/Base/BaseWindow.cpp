@@ -190,6 +190,8 @@ namespace Fsl::UI
     if (IsLayoutDirty() || finalRectPx != m_layoutCache.ArrangeLastFinalRectPx)
     {
       m_layoutCache.ArrangeLastFinalRectPx = finalRectPx;
+      m_flags.Enable(BaseWindowFlags::Arranged);
+      ++m_context->LayoutCounter->ArrangeCalls;
 
       MarkLayoutArrangeBegin();
       try
@@ -253,6 +255,7 @@ namespace Fsl::UI
     if (IsLayoutDirty() || availableSizePx != m_layoutCache.MeasureLastAvailableSizePx)
     {
       m_layoutCache.MeasureLastAvailableSizePx = availableSizePx;
+      ++m_context->LayoutCounter->MeasureCalls;
 
       MarkLayoutMeasureBegin();
       try
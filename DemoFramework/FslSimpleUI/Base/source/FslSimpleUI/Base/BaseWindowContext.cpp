@@ -42,6 +42,7 @@ namespace Fsl::UI
     , TheUIContext(uiContext)
     , UnitConverter(densityDpi)
     , ColorConverter(colorSpace)
+    , LayoutCounter(uiContext->LayoutCounter)
   {
   }
 
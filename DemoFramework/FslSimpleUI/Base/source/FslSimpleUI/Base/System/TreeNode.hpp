@@ -36,6 +36,7 @@
 #include <deque>
 #include <memory>
 #include <utility>
+#include "TreeNodeDequeCache.hpp"
 #include "TreeNodeFlags.hpp"
 
 namespace Fsl::UI
@@ -53,6 +54,9 @@ namespace Fsl::UI
   public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     std::deque<std::shared_ptr<TreeNode>> m_children;
+    //! Managed by the UITree
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    TreeNodeDequeCache m_dequeCache;
 
     explicit TreeNode(const std::shared_ptr<BaseWindow>& window)
       : m_window(window)
@@ -184,6 +188,24 @@ namespace Fsl::UI
       return m_window->WinGetContentRectanglePx();
     }
 
+    inline const PxRectangle& WinGetArrangeFinalRectanglePx() const
+    {
+      assert(m_flags.IsRunning());
+      return m_window->WinGetArrangeFinalRectanglePx();
+    }
+
+    inline bool WinIsLayoutDirty() const
+    {
+      assert(m_flags.IsRunning());
+      return m_window->WinGetFlags().IsEnabled(WindowFlags::LayoutDirty);
+    }
+
+    inline bool WinIsArranged() const
+    {
+      assert(m_flags.IsRunning());
+      return m_window->WinIsArranged();
+    }
+
     inline void WinHandleEvent(const RoutedEvent& routedEvent)
     {
       assert(m_flags.IsRunning());
@@ -0,0 +1,170 @@
+#ifndef FSLSIMPLEUI_BASE_SYSTEM_TREENODEDEQUECACHE_HPP
+#define FSLSIMPLEUI_BASE_SYSTEM_TREENODEDEQUECACHE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxRectangle.hpp>
+#include <FslSimpleUI/Base/ItemVisibility.hpp>
+#include <FslSimpleUI/Render/Base/DrawClipContext.hpp>
+
+namespace Fsl::UI
+{
+  //! @brief The number of entries in each of the UITree deques
+  struct TreeNodeDequeCount
+  {
+    uint32_t Update{0};
+    uint32_t Resolve{0};
+    uint32_t PostLayout{0};
+    uint32_t Draw{0};
+    uint32_t ClickInput{0};
+    uint32_t MouseOver{0};
+
+    constexpr TreeNodeDequeCount() noexcept = default;
+
+    constexpr TreeNodeDequeCount(const uint32_t update, const uint32_t resolve, const uint32_t postLayout, const uint32_t draw,
+                                 const uint32_t clickInput, const uint32_t mouseOver) noexcept
+      : Update(update)
+      , Resolve(resolve)
+      , PostLayout(postLayout)
+      , Draw(draw)
+      , ClickInput(clickInput)
+      , MouseOver(mouseOver)
+    {
+    }
+
+    constexpr TreeNodeDequeCount& operator+=(const TreeNodeDequeCount& rhs) noexcept
+    {
+      Update += rhs.Update;
+      Resolve += rhs.Resolve;
+      PostLayout += rhs.PostLayout;
+      Draw += rhs.Draw;
+      ClickInput += rhs.ClickInput;
+      MouseOver += rhs.MouseOver;
+      return *this;
+    }
+
+    constexpr TreeNodeDequeCount operator-(const TreeNodeDequeCount& rhs) const noexcept
+    {
+      return {Update - rhs.Update, Resolve - rhs.Resolve, PostLayout - rhs.PostLayout, Draw - rhs.Draw, ClickInput - rhs.ClickInput,
+              MouseOver - rhs.MouseOver};
+    }
+
+    constexpr bool operator==(const TreeNodeDequeCount& rhs) const noexcept
+    {
+      return Update == rhs.Update && Resolve == rhs.Resolve && PostLayout == rhs.PostLayout && Draw == rhs.Draw && ClickInput == rhs.ClickInput &&
+             MouseOver == rhs.MouseOver;
+    }
+
+    constexpr bool operator!=(const TreeNodeDequeCount& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+
+
+  //! @brief Describes why a node needs to be revisited when the UITree deques are patched
+  struct TreeNodeDequeDirtyFlags
+  {
+    enum Enum : uint8_t
+    {
+      Clean = 0,
+      //! The entries of the node itself needs to be recalculated (flags or visibility changed)
+      Self = 0x01,
+      //! The node was arranged so its children might have been moved
+      Arranged = 0x02,
+      //! The children were added or removed so the entire subtree needs to be regenerated
+      Subtree = 0x04,
+      //! A descendant of the node is dirty
+      Descendant = 0x08
+    };
+
+    uint8_t Value{Clean};
+
+    constexpr TreeNodeDequeDirtyFlags() noexcept = default;
+
+    constexpr TreeNodeDequeDirtyFlags(const Enum flag) noexcept    // NOLINT(google-explicit-constructor)
+      : Value(static_cast<uint8_t>(flag))
+    {
+    }
+
+    explicit constexpr TreeNodeDequeDirtyFlags(const uint32_t flags) noexcept
+      : Value(static_cast<uint8_t>(flags))
+    {
+    }
+
+    constexpr bool IsClean() const noexcept
+    {
+      return Value == Clean;
+    }
+
+    constexpr bool IsFlagged(const Enum flag) const noexcept
+    {
+      return (Value & flag) != 0;
+    }
+
+    constexpr void Enable(const TreeNodeDequeDirtyFlags flags) noexcept
+    {
+      Value |= flags.Value;
+    }
+  };
+
+
+  //! @brief Information about the last time a node (and its subtree) was added to the UITree deques.
+  //!        It allows the tree to patch the deques of a dirty subtree in place instead of rebuilding everything.
+  struct TreeNodeDequeCache
+  {
+    //! @brief false until the node has been added to the deques
+    bool IsValid{false};
+    TreeNodeDequeDirtyFlags Dirty;
+    //! @brief The entries of the node itself (zero or one in each deque)
+    TreeNodeDequeCount SelfCount;
+    //! @brief The entries of the node and all its descendants
+    TreeNodeDequeCount SubtreeCount;
+    //! @brief The final rect the window was arranged with (lets us detect if the parent moved it)
+    PxRectangle ArrangeFinalRectPx;
+    //! @brief The screen rectangle of the node (this is the parent rectangle of the children)
+    PxRectangle RectPx;
+    //! @brief The inherited visibility of the node
+    ItemVisibility Visibility{ItemVisibility::Visible};
+    //! @brief The clip context inherited by the children
+    DrawClipContext ClipContext;
+
+    //! @brief Check if the values inherited by the children are equal
+    bool IsChildContextEqual(const PxRectangle& rectPx, const ItemVisibility visibility, const DrawClipContext& clipContext) const noexcept
+    {
+      return rectPx == RectPx && visibility == Visibility && clipContext.Enabled == ClipContext.Enabled &&
+             clipContext.ClipRectanglePxf == ClipContext.ClipRectanglePxf;
+    }
+  };
+}
+
+#endif
@@ -37,6 +37,7 @@
 #include <FslSimpleUI/Base/UIContext.hpp>
 #include <FslSimpleUI/Render/Base/IRenderSystem.hpp>
 #include <cassert>
+#include <utility>
 #include "Event/EventRouter.hpp"
 #include "Event/SimpleEventSender.hpp"
 #include "Event/WindowEventQueueEx.hpp"
@@ -149,6 +150,15 @@ namespace Fsl::UI
   }
 
 
+  void UIManager::SetDrawJobSystem(std::shared_ptr<JobSystem> jobSystem)
+  {
+    if (m_tree)
+    {
+      m_tree->SetDrawJobSystem(std::move(jobSystem));
+    }
+  }
+
+
   std::shared_ptr<AExternalModule> UIManager::GetExternalModule(const ExternalModuleId& moduleId) const
   {
     if (m_externalModules)
@@ -229,7 +239,14 @@ namespace Fsl::UI
 
   UIStats UIManager::GetStats() const noexcept
   {
-    return m_tree ? m_tree->GetStats() : UIStats();
+    UIStats stats = m_tree ? m_tree->GetStats() : UIStats();
+    if (m_uiContext)
+    {
+      // The layout is performed by the windows themselves, so the counts are collected in the context they share
+      stats.MeasureCalls = m_uiContext->LayoutCounter->MeasureCalls;
+      stats.ArrangeCalls = m_uiContext->LayoutCounter->ArrangeCalls;
+    }
+    return stats;
   }
 
   void UIManager::ProcessEvents()
@@ -265,6 +282,7 @@ namespace Fsl::UI
 
   void UIManager::Update(const TimeSpan& timespan)
   {
+    m_uiContext->LayoutCounter->Clear();
     m_tree->Update(timespan);
   }
 
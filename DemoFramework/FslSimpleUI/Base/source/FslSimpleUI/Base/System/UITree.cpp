@@ -35,12 +35,16 @@
 #include <FslBase/Math/Pixel/PxAreaRectangleF.hpp>
 #include <FslBase/Math/Pixel/TypeConverter.hpp>
 #include <FslBase/Math/Point2.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslSimpleUI/Base/Event/WindowEvent.hpp>
 #include <FslSimpleUI/Base/Event/WindowEventPool.hpp>
 #include <FslSimpleUI/Base/LayoutHelperPxfConverter.hpp>
 #include <FslSimpleUI/Base/ResolutionChangedInfo.hpp>
+#include <FslSimpleUI/Render/Base/DrawCommandBufferEx.hpp>
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <utility>
 #include "Event/WindowEventQueueEx.hpp"
 #include "Modules/ModuleCallbackRegistry.hpp"
@@ -53,16 +57,177 @@ namespace Fsl::UI
   {
     constexpr std::size_t MaxEventLoops = 1024;
 
-    inline void MarkWindowAndParentsAsDirty(const std::shared_ptr<TreeNode>& node)
+    //! The minimum number of draw records before the draw commands are recorded in parallel
+    constexpr std::size_t MinParallelDrawRecords = 256;
+    constexpr std::size_t MinParallelDrawRecordsPerChunk = 64;
+    //! Use more chunks than threads so a chunk with a few expensive windows does not leave the other threads idle
+    constexpr std::size_t ParallelDrawChunksPerThread = 2;
+
+    //! @brief Mark the node as needing a deque patch and let all its ancestors know that they have a dirty descendant
+    inline void MarkDequeDirty(const std::shared_ptr<TreeNode>& node, const TreeNodeDequeDirtyFlags flags)
     {
-      std::shared_ptr<TreeNode> currentNode = node;
-      while (currentNode && currentNode->WinMarkLayoutAsDirty())
+      node->m_dequeCache.Dirty.Enable(flags);
+      std::shared_ptr<TreeNode> currentNode = node->GetParent();
+      while (currentNode && !currentNode->m_dequeCache.Dirty.IsFlagged(TreeNodeDequeDirtyFlags::Descendant))
       {
+        currentNode->m_dequeCache.Dirty.Enable(TreeNodeDequeDirtyFlags::Descendant);
         currentNode = currentNode->GetParent();
       }
     }
 
 
+    //! @brief Mark the window layout as dirty
+    //! @return true if the window was marked as dirty, false if it was already dirty.
+    inline bool MarkWindowAsDirty(const std::shared_ptr<TreeNode>& node)
+    {
+      if (!node->WinMarkLayoutAsDirty())
+      {
+        return false;
+      }
+      // The window will be arranged, so its children might move
+      MarkDequeDirty(node, TreeNodeDequeDirtyFlags(TreeNodeDequeDirtyFlags::Self | TreeNodeDequeDirtyFlags::Arranged));
+      return true;
+    }
+
+
+    //! @brief The values a node inherits from its parent combined with its own
+    struct NodeDequeContext
+    {
+      PxRectangle RectPx;
+      PxRectangle InputRectPx;
+      ItemVisibility Visibility{ItemVisibility::Visible};
+      DrawClipContext ClipContext;
+    };
+
+
+    NodeDequeContext CalcNodeDequeContext(const TreeNode& node, const PxRectangle& parentRectPx, const ItemVisibility parentVisibility,
+                                          const DrawClipContext& parentClipContext)
+    {
+      NodeDequeContext result;
+      result.RectPx = node.WinGetContentRectanglePx();
+      result.RectPx.Add(parentRectPx.Location());
+      result.InputRectPx = result.RectPx;
+
+      const TreeNodeFlags flags = node.GetFlags();
+      const ItemVisibility visibility = flags.GetVisibility();
+      result.Visibility = parentVisibility <= visibility ? visibility : parentVisibility;
+
+      if (flags.IsFlagged(WindowFlags::ClipEnabled))
+      {
+        PxAreaRectangleF currentClipRectPxf(TypeConverter::UncheckedTo<PxAreaRectangleF>(result.RectPx));
+        // parentContext.Clip.Enabled == false -> parent doesn't require clipping, but this window does
+        // parentContext.Clip.Enabled == true  -> parent require clipping and this window require clipping
+        result.ClipContext = DrawClipContext(
+          true, !parentClipContext.Enabled ? currentClipRectPxf : PxAreaRectangleF::Intersect(parentClipContext.ClipRectanglePxf, currentClipRectPxf));
+
+        // Use the clipped input rectangle
+        result.InputRectPx = TypeConverter::UncheckedChangeTo<PxRectangle>(result.ClipContext.ClipRectanglePxf);
+      }
+      else
+      {
+        result.ClipContext = parentClipContext;
+        if (parentClipContext.Enabled)
+        {
+          PxAreaRectangleF currentInputRectPxf =
+            PxAreaRectangleF::Intersect(parentClipContext.ClipRectanglePxf, TypeConverter::UncheckedTo<PxAreaRectangleF>(result.InputRectPx));
+          // Use the clipped input rectangle
+          result.InputRectPx = TypeConverter::UncheckedChangeTo<PxRectangle>(currentInputRectPxf);
+        }
+      }
+      return result;
+    }
+
+
+    //! @brief Append the entries of the node itself to the deques
+    void AppendNodeEntries(UITreeDeques& rDeques, const std::shared_ptr<TreeNode>& node, const NodeDequeContext& context)
+    {
+      const TreeNodeFlags flags = node->GetFlags();
+      const ItemVisibility visibility = context.Visibility;
+      if (flags.IsFlagged(TreeNodeFlags::UpdateEnabled))
+      {
+        rDeques.Update.push_back(node.get());
+      }
+      if (visibility != ItemVisibility::Collapsed && flags.IsFlagged(TreeNodeFlags::ResolveEnabled))
+      {
+        rDeques.Resolve.push_back(node.get());
+      }
+      if (visibility != ItemVisibility::Collapsed && flags.IsFlagged(TreeNodeFlags::PostLayoutEnabled))
+      {
+        rDeques.PostLayout.push_back(node.get());
+      }
+      if (visibility == ItemVisibility::Visible && flags.IsFlagged(TreeNodeFlags::DrawEnabled))
+      {
+        rDeques.Draw.emplace_back(TreeNodeDrawContext(TypeConverter::UncheckedTo<PxAreaRectangleF>(context.RectPx), context.ClipContext),
+                                  node->GetWindowPointer());
+      }
+      if (visibility == ItemVisibility::Visible && flags.IsFlagged(TreeNodeFlags::ClickInput))
+      {
+        rDeques.ClickInputTarget.emplace_back(context.InputRectPx, node);
+      }
+      if (visibility == ItemVisibility::Visible && flags.IsFlagged(TreeNodeFlags::MouseOver))
+      {
+        rDeques.MouseOverTarget.emplace_back(context.InputRectPx, node);
+      }
+    }
+
+
+    //! @brief Windows that have not been laid out yet will be moved by a upcoming arrange, so they stay dirty until that has happened.
+    TreeNodeDequeDirtyFlags CalcPendingLayoutDirtyFlags(const TreeNode& node, const bool childPendingLayout)
+    {
+      TreeNodeDequeDirtyFlags flags;
+      if (node.WinIsLayoutDirty())
+      {
+        flags.Enable(TreeNodeDequeDirtyFlags(TreeNodeDequeDirtyFlags::Self | TreeNodeDequeDirtyFlags::Arranged));
+      }
+      if (childPendingLayout)
+      {
+        flags.Enable(TreeNodeDequeDirtyFlags::Descendant);
+      }
+      return flags;
+    }
+
+
+    //! @brief Replace 'count' entries at 'offset' with the content of rSource (moving the content out of rSource)
+    template <typename T>
+    void ReplaceRange(std::vector<T>& rTarget, const uint32_t offset, const uint32_t count, std::vector<T>& rSource)
+    {
+      assert((static_cast<std::size_t>(offset) + count) <= rTarget.size());
+      const std::size_t overwriteCount = std::min(static_cast<std::size_t>(count), rSource.size());
+      std::move(rSource.begin(), rSource.begin() + overwriteCount, rTarget.begin() + offset);
+      if (rSource.size() > count)
+      {
+        rTarget.insert(rTarget.begin() + offset + overwriteCount, std::make_move_iterator(rSource.begin() + overwriteCount),
+                       std::make_move_iterator(rSource.end()));
+      }
+      else if (rSource.size() < count)
+      {
+        rTarget.erase(rTarget.begin() + offset + overwriteCount, rTarget.begin() + offset + count);
+      }
+    }
+
+
+    void ReplaceRange(UITreeDeques& rTarget, const TreeNodeDequeCount& offset, const TreeNodeDequeCount& count, UITreeDeques& rSource)
+    {
+      ReplaceRange(rTarget.Update, offset.Update, count.Update, rSource.Update);
+      ReplaceRange(rTarget.Resolve, offset.Resolve, count.Resolve, rSource.Resolve);
+      ReplaceRange(rTarget.PostLayout, offset.PostLayout, count.PostLayout, rSource.PostLayout);
+      ReplaceRange(rTarget.Draw, offset.Draw, count.Draw, rSource.Draw);
+      ReplaceRange(rTarget.ClickInputTarget, offset.ClickInput, count.ClickInput, rSource.ClickInputTarget);
+      ReplaceRange(rTarget.MouseOverTarget, offset.MouseOver, count.MouseOver, rSource.MouseOverTarget);
+    }
+
+
+    std::shared_ptr<TreeNode> TryGetInputTarget(const UITreeInputTargetVector& targets, UITreeHitGrid& rHitGrid, const PxPoint2& hitPositionPx)
+    {
+      if (rHitGrid.IsDirty())
+      {
+        rHitGrid.Build(targets);
+      }
+      const std::optional<uint32_t> index = rHitGrid.TryFind(hitPositionPx);
+      return index.has_value() ? targets[index.value()].Node : std::shared_ptr<TreeNode>();
+    }
+
+
     inline void RemoveDictEntry(WindowToNodeMap& rDict, const std::shared_ptr<BaseWindow>& window)
     {
       auto itrNode = rDict.find(window.get());
@@ -77,6 +242,8 @@ namespace Fsl::UI
                                 const std::shared_ptr<TreeNode>& node, FastTreeNodeVector* pNewWindows, const TreeNodeFlags filterFlags)
     {
       TreeNode::AddChild(parentNode, node);
+      // The new node has never been added to the deques, so it will be inserted when its parent is patched
+      MarkDequeDirty(node, TreeNodeDequeDirtyFlags::Subtree);
       rModuleCallbackRegistry.ModuleOnTreeNodeAdd(node);
       if (pNewWindows != nullptr)
       {
@@ -121,7 +288,7 @@ namespace Fsl::UI
       // remove it from the lookup dict
       RemoveDictEntry(rDict, node->GetWindow());
 
-      // Maybe we should force remove the entry from  "m_vectorClickInputTarget and m_vectorMouseOverTarget";
+      // Maybe we should force remove the entry from  "ClickInputTarget and MouseOverTarget";
       // However it should not be necessary as we mark them as dirty and rebuild them
     }
 
@@ -136,6 +303,7 @@ namespace Fsl::UI
       if (parent)
       {
         parent->RemoveChild(node);
+        MarkDequeDirty(parent, TreeNodeDequeDirtyFlags::Subtree);
       }
       assert(node->IsDisposed());
     }
@@ -151,6 +319,7 @@ namespace Fsl::UI
         assert(childNode->IsDisposed());
       }
       node->ClearChildren();
+      MarkDequeDirty(node, TreeNodeDequeDirtyFlags::Subtree);
     }
 
 
@@ -313,12 +482,11 @@ namespace Fsl::UI
         m_drawCacheDirty = true;
         m_clickInputCacheDirty = true;
         m_layoutIsDirty = true;
-        m_vectorUpdate.clear();
-        m_vectorResolve.clear();
-        m_vectorPostLayout.clear();
-        m_vectorDraw.clear();
-        m_vectorClickInputTarget.clear();
-        m_vectorMouseOverTarget.clear();
+        m_deques.Clear();
+        m_dequesScratchpad.Clear();
+        m_clickInputHitGrid.MarkDirty();
+        m_mouseOverHitGrid.MarkDirty();
+        m_pendingLayoutNodes.clear();
       }
 
       if (m_moduleCallbackRegistry && m_root)
@@ -366,10 +534,25 @@ namespace Fsl::UI
     m_clipEnabled = enabled;
     m_rootClipRectPx = clipRectanglePx;
     m_drawCacheDirty = true;
+    if (m_root)
+    {
+      // The root clip context is inherited by everything
+      m_root->m_dequeCache.Dirty.Enable(TreeNodeDequeDirtyFlags::Subtree);
+    }
     m_contentRenderingIsDirty = true;
   }
 
 
+  void UITree::SetDrawJobSystem(std::shared_ptr<JobSystem> jobSystem)
+  {
+    m_drawJobSystem = std::move(jobSystem);
+    if (!m_drawJobSystem)
+    {
+      m_drawChunkBuffers.clear();
+    }
+  }
+
+
   void UITree::ProcessEvents()
   {
     if (m_state != State::Ready)
@@ -397,6 +580,8 @@ namespace Fsl::UI
       auto sizePx = TypeConverter::UncheckedTo<PxPoint2>(extentPx);
       m_rootRectPx = PxRectangle(PxValue(0), PxValue(0), sizePx.X, sizePx.Y);
       m_layoutIsDirty = true;
+      // All windows were marked as layout dirty by the resolution change so everything needs to be regenerated
+      m_root->m_dequeCache.Dirty.Enable(TreeNodeDequeDirtyFlags::Subtree);
     }
   }
 
@@ -413,33 +598,33 @@ namespace Fsl::UI
     ProcessEventsPreUpdate();
 
     {    // Update all the existing windows
-      for (TreeNode* pNode : m_vectorUpdate)
+      for (TreeNode* pNode : m_deques.Update)
       {
         pNode->Update(timespan);
       }
-      m_stats.UpdateCalls = UncheckedNumericCast<uint32_t>(m_vectorUpdate.size());
+      m_stats.UpdateCalls = UncheckedNumericCast<uint32_t>(m_deques.Update.size());
     }
 
     ProcessEventsPostUpdate(timespan);
 
 
     {    // Resolve all the existing windows
-      for (TreeNode* pNode : m_vectorResolve)
+      for (TreeNode* pNode : m_deques.Resolve)
       {
         pNode->Resolve(timespan);
       }
-      m_stats.ResolveCalls = UncheckedNumericCast<uint32_t>(m_vectorResolve.size());
+      m_stats.ResolveCalls = UncheckedNumericCast<uint32_t>(m_deques.Resolve.size());
     }
 
     ProcessEventsPostResolve(timespan);
 
     if (PerformLayout())
     {    // PostLayout all the existing windows
-      for (TreeNode* pNode : m_vectorPostLayout)
+      for (TreeNode* pNode : m_deques.PostLayout)
       {
         pNode->PostLayout();
       }
-      m_stats.PostLayoutCalls = UncheckedNumericCast<uint32_t>(m_vectorPostLayout.size());
+      m_stats.PostLayoutCalls = UncheckedNumericCast<uint32_t>(m_deques.PostLayout.size());
     }
     else
     {
@@ -457,16 +642,60 @@ namespace Fsl::UI
 
     ScopedContextChange scopedContextChange(this, Context::Internal);
 
-    for (const auto& record : m_vectorDraw)
+    if (m_drawJobSystem && m_deques.Draw.size() >= MinParallelDrawRecords)
+    {
+      DrawParallel(drawCommandBuffer, *m_drawJobSystem);
+    }
+    else
     {
-      record.pWindow->WinDraw(UIDrawContext(drawCommandBuffer, record.DrawContext.TargetRect, record.DrawContext.ClipContext));
+      for (const auto& record : m_deques.Draw)
+      {
+        record.pWindow->WinDraw(UIDrawContext(drawCommandBuffer, record.DrawContext.TargetRect, record.DrawContext.ClipContext));
+      }
     }
 
-    m_stats.DrawCalls = UncheckedNumericCast<uint32_t>(m_vectorDraw.size());
+    m_stats.DrawCalls = UncheckedNumericCast<uint32_t>(m_deques.Draw.size());
     m_stats.WindowCount = UncheckedNumericCast<uint32_t>(GetNodeCount());
     m_contentRenderingIsDirty = false;
   }
 
+
+  void UITree::DrawParallel(DrawCommandBuffer& rDrawCommandBuffer, JobSystem& rJobSystem)
+  {
+    // The draw deque is in depth first order, so each chunk is a consecutive run of subtrees.
+    // Appending the chunk buffers in chunk order produces exactly the same commands as the serial draw.
+    const std::size_t drawCount = m_deques.Draw.size();
+    const std::size_t maxChunkCount = (static_cast<std::size_t>(rJobSystem.GetWorkerThreadCount()) + 1u) * ParallelDrawChunksPerThread;
+    const std::size_t chunkCount = std::min(maxChunkCount, drawCount / MinParallelDrawRecordsPerChunk);
+    while (m_drawChunkBuffers.size() < chunkCount)
+    {
+      m_drawChunkBuffers.push_back(std::make_unique<DrawCommandBufferEx>());
+    }
+
+    const auto drawChunks = [this, drawCount, chunkCount](const std::size_t begin, const std::size_t end)
+    {
+      for (std::size_t chunkIndex = begin; chunkIndex < end; ++chunkIndex)
+      {
+        DrawCommandBufferEx& rChunkBuffer = *m_drawChunkBuffers[chunkIndex];
+        rChunkBuffer.Clear();
+        const std::size_t recordEnd = (drawCount * (chunkIndex + 1u)) / chunkCount;
+        for (std::size_t i = (drawCount * chunkIndex) / chunkCount; i < recordEnd; ++i)
+        {
+          const UITreeDrawRecord& record = m_deques.Draw[i];
+          record.pWindow->WinDraw(UIDrawContext(rChunkBuffer, record.DrawContext.TargetRect, record.DrawContext.ClipContext));
+        }
+      }
+    };
+    rJobSystem.ParallelFor(chunkCount, 1u, drawChunks);
+
+    for (std::size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+    {
+      rDrawCommandBuffer.Append(*m_drawChunkBuffers[chunkIndex]);
+      // Release the custom draw data references
+      m_drawChunkBuffers[chunkIndex]->Clear();
+    }
+  }
+
   std::size_t UITree::GetNodeCount() const noexcept
   {
     if (m_state != State::Ready)
@@ -693,7 +922,7 @@ namespace Fsl::UI
   bool UITree::IsIdle() const noexcept
   {
     return (m_state == State::Ready && m_eventQueue->IsEmpty() && !m_updateCacheDirty && !m_resolveCacheDirty && !m_postLayoutCacheIsDirty &&
-            !m_drawCacheDirty && !m_clickInputCacheDirty && !m_layoutIsDirty && m_vectorUpdate.empty()) ||
+            !m_drawCacheDirty && !m_clickInputCacheDirty && !m_layoutIsDirty && m_deques.Update.empty()) ||
            (m_state == State::Shutdown);
   }
 
@@ -759,7 +988,11 @@ namespace Fsl::UI
     {
       if (flags.IsEnabled(WindowFlags::LayoutDirty))
       {
-        MarkWindowAndParentsAsDirty(itrNode->second);
+        // The parents are only invalidated if the window's desired size changes (see ResolvePendingLayouts)
+        if (MarkWindowAsDirty(itrNode->second))
+        {
+          m_pendingLayoutNodes.push_back(itrNode->second);
+        }
         m_layoutIsDirty = true;
       }
       if (flags.IsEnabled(WindowFlags::ContentRenderingDirty))
@@ -769,26 +1002,31 @@ namespace Fsl::UI
       if (flags.IsEnabled(WindowFlags::UpdateEnabled))
       {
         itrNode->second->EnableFlags(TreeNodeFlags::UpdateEnabled);
+        MarkDequeDirty(itrNode->second, TreeNodeDequeDirtyFlags::Self);
         m_updateCacheDirty = true;
       }
       if (flags.IsEnabled(WindowFlags::ResolveEnabled))
       {
         itrNode->second->EnableFlags(TreeNodeFlags::ResolveEnabled);
+        MarkDequeDirty(itrNode->second, TreeNodeDequeDirtyFlags::Self);
         m_resolveCacheDirty = true;
       }
       if (flags.IsEnabled(WindowFlags::PostLayoutEnabled))
       {
         itrNode->second->EnableFlags(TreeNodeFlags::PostLayoutEnabled);
+        MarkDequeDirty(itrNode->second, TreeNodeDequeDirtyFlags::Self);
         m_postLayoutCacheIsDirty = true;
       }
       if (flags.IsEnabled(WindowFlags::DrawEnabled))
       {
         itrNode->second->EnableFlags(TreeNodeFlags::DrawEnabled);
+        MarkDequeDirty(itrNode->second, TreeNodeDequeDirtyFlags::Self);
         m_drawCacheDirty = true;
       }
       if (flags.IsEnabled(WindowFlags::ClickInput))
       {
         itrNode->second->EnableFlags(TreeNodeFlags::ClickInput);
+        MarkDequeDirty(itrNode->second, TreeNodeDequeDirtyFlags::Self);
         m_clickInputCacheDirty = true;
       }
     }
@@ -801,6 +1039,7 @@ namespace Fsl::UI
       if (flags.IsEnabled(WindowFlags::UpdateEnabled))
       {
         itrNode->second->DisableFlags(TreeNodeFlags::UpdateEnabled);
+        MarkDequeDirty(itrNode->second, TreeNodeDequeDirtyFlags::Self);
         m_updateCacheDirty = true;
       }
       if (flags.IsEnabled(WindowFlags::ResolveEnabled))
@@ -844,7 +1083,11 @@ namespace Fsl::UI
       return false;
     }
 
-    itrNode->second->SetVisibility(visibility);
+    if (itrNode->second->GetFlags().GetVisibility() != visibility)
+    {
+      itrNode->second->SetVisibility(visibility);
+      MarkDequeDirty(itrNode->second, TreeNodeDequeDirtyFlags::Self);
+    }
     return true;
   }
 
@@ -938,17 +1181,7 @@ namespace Fsl::UI
       throw UsageErrorException("Internal state must be ready");
     }
 
-    auto itr = m_vectorMouseOverTarget.rbegin();
-    const auto itrEnd = m_vectorMouseOverTarget.rend();
-    while (itr != itrEnd)
-    {
-      if (itr->VisibleRectPx.Contains(hitPositionPx.X, hitPositionPx.Y))
-      {
-        return itr->Node;
-      }
-      ++itr;
-    }
-    return {};
+    return TryGetInputTarget(m_deques.MouseOverTarget, m_mouseOverHitGrid, hitPositionPx);
   }
 
 
@@ -958,17 +1191,7 @@ namespace Fsl::UI
     {
       throw UsageErrorException("Internal state must be ready");
     }
-    auto itr = m_vectorClickInputTarget.rbegin();
-    const auto itrEnd = m_vectorClickInputTarget.rend();
-    while (itr != itrEnd)
-    {
-      if (itr->VisibleRectPx.Contains(hitPositionPx.X, hitPositionPx.Y))
-      {
-        return itr->Node;
-      }
-      ++itr;
-    }
-    return {};
+    return TryGetInputTarget(m_deques.ClickInputTarget, m_clickInputHitGrid, hitPositionPx);
   }
 
   PxRectangle UITree::GetWindowRectanglePx(const IWindowId* const pWindowId) const
@@ -1072,6 +1295,8 @@ namespace Fsl::UI
       m_postLayoutCacheIsDirty = true;
       m_clickInputCacheDirty = true;
 
+      ResolvePendingLayouts();
+
       const auto sizePx = LayoutHelperPxfConverter::ToPxAvailableSize(m_rootRectPx.GetSize());
       m_rootWindow->Measure(sizePx);
       m_rootWindow->Arrange(m_rootRectPx);
@@ -1091,7 +1316,56 @@ namespace Fsl::UI
   }
 
 
-  // TODO: we need to use a more complex algorithm for rebuilding
+  void UITree::ResolvePendingLayouts()
+  {
+    // Use a index as the vector could be modified if a window marks itself as dirty during layout
+    for (std::size_t i = 0; i < m_pendingLayoutNodes.size(); ++i)
+    {
+      // Work on a copy as the vector could be resized
+      const std::shared_ptr<TreeNode> node = m_pendingLayoutNodes[i];
+      if (node->IsDisposed())
+      {
+        continue;
+      }
+
+      std::shared_ptr<TreeNode> currentNode = node;
+      while (currentNode->WinIsLayoutDirty())
+      {
+        // The children of the root are always laid out by PerformLayout
+        std::shared_ptr<TreeNode> parentNode = currentNode->GetParent();
+        if (!parentNode || parentNode == m_root)
+        {
+          break;
+        }
+
+        // A window that never was arranged has no previous layout input, so its parent needs to lay it out
+        if (currentNode->WinIsArranged())
+        {
+          // Re-measure the window using the same input its parent gave it last time
+          BaseWindow* const pWindow = currentNode->GetWindowPointer();
+          const PxSize2D oldDesiredSizePx = pWindow->DesiredSizePx();
+          pWindow->Measure(pWindow->WinGetMeasureAvailableSizePx());
+          if (pWindow->DesiredSizePx() == oldDesiredSizePx)
+          {
+            // The parent layout is unaffected, so this is as far as the invalidation needs to go
+            pWindow->Arrange(pWindow->WinGetArrangeFinalRectanglePx());
+            break;
+          }
+        }
+
+        // The desired size changed so the parent needs to redo its layout
+        if (!MarkWindowAsDirty(parentNode))
+        {
+          // The parent was already dirty, so it will be laid out
+          break;
+        }
+        currentNode = parentNode;
+      }
+    }
+    m_pendingLayoutNodes.clear();
+  }
+
+
   void UITree::RebuildDeques()
   {
     assert(m_state == State::Ready);
@@ -1105,86 +1379,120 @@ namespace Fsl::UI
     m_postLayoutCacheIsDirty = false;
     m_drawCacheDirty = false;
     m_clickInputCacheDirty = false;
-
-    // Lots of optimization possibilities here
-    m_vectorUpdate.clear();
-    m_vectorResolve.clear();
-    m_vectorPostLayout.clear();
-    m_vectorDraw.clear();
-    m_vectorClickInputTarget.clear();
-    m_vectorMouseOverTarget.clear();
+    m_clickInputHitGrid.MarkDirty();
+    m_mouseOverHitGrid.MarkDirty();
 
     DrawClipContext clipContext(m_clipEnabled, TypeConverter::UncheckedTo<PxAreaRectangleF>(!m_clipEnabled ? m_rootRectPx : m_rootClipRectPx));
-    RebuildDeques(m_root, m_rootRectPx, ItemVisibility::Visible, clipContext);
+    if (!m_root->m_dequeCache.IsValid)
+    {
+      m_deques.Clear();
+      BuildDeques(m_deques, m_root, m_rootRectPx, ItemVisibility::Visible, clipContext);
+    }
+    else
+    {
+      // Only visit the dirty subtrees and patch their entries in place
+      TreeNodeDequeCount cursor;
+      PatchDeques(m_root, m_rootRectPx, ItemVisibility::Visible, clipContext, false, cursor);
+      assert(cursor == m_deques.GetCount());
+    }
   }
 
 
-  void UITree::RebuildDeques(const std::shared_ptr<TreeNode>& node, const PxRectangle& parentRectPx, const ItemVisibility parentVisibility,
-                             DrawClipContext drawClipContext)
+  bool UITree::BuildDeques(UITreeDeques& rDeques, const std::shared_ptr<TreeNode>& node, const PxRectangle& parentRectPx,
+                           const ItemVisibility parentVisibility, const DrawClipContext& parentClipContext)
   {
     assert(m_state == State::Ready);
-    PxRectangle currentRectPx = node->WinGetContentRectanglePx();
-    currentRectPx.Add(parentRectPx.Location());
-
-    PxRectangle currentInputRectPx = currentRectPx;
+    const NodeDequeContext context = CalcNodeDequeContext(*node, parentRectPx, parentVisibility, parentClipContext);
+    const TreeNodeDequeCount startCount = rDeques.GetCount();
 
-    const TreeNodeFlags flags = node->GetFlags();
-    ItemVisibility visibility = flags.GetVisibility();
-    visibility = parentVisibility <= visibility ? visibility : parentVisibility;
+    AppendNodeEntries(rDeques, node, context);
+    const TreeNodeDequeCount selfEndCount = rDeques.GetCount();
 
-    if (flags.IsFlagged(WindowFlags::ClipEnabled))
-    {
-      PxAreaRectangleF currentClipRectPxf(TypeConverter::UncheckedTo<PxAreaRectangleF>(currentRectPx));
-      // parentContext.Clip.Enabled == false -> parent doesn't require clipping, but this window does
-      // parentContext.Clip.Enabled == true  -> parent require clipping and this window require clipping
-      drawClipContext = DrawClipContext(
-        true, !drawClipContext.Enabled ? currentClipRectPxf : PxAreaRectangleF::Intersect(drawClipContext.ClipRectanglePxf, currentClipRectPxf));
-
-      // Use the clipped input rectangle
-      currentInputRectPx = TypeConverter::UncheckedChangeTo<PxRectangle>(drawClipContext.ClipRectanglePxf);
-    }
-    else if (drawClipContext.Enabled)
+    bool childPendingLayout = false;
+    auto& nodeChildren = node->m_children;
+    for (auto& entry : nodeChildren)
     {
-      PxAreaRectangleF currentInputRectPxf =
-        PxAreaRectangleF::Intersect(drawClipContext.ClipRectanglePxf, TypeConverter::UncheckedTo<PxAreaRectangleF>(currentInputRectPx));
-      // Use the clipped input rectangle
-      currentInputRectPx = TypeConverter::UncheckedChangeTo<PxRectangle>(currentInputRectPxf);
+      childPendingLayout |= BuildDeques(rDeques, entry, context.RectPx, context.Visibility, context.ClipContext);
     }
 
-    // WARNING: at this point the original parent drawClipContext might have been replaced
+    TreeNodeDequeCache& rCache = node->m_dequeCache;
+    rCache.IsValid = true;
+    rCache.Dirty = CalcPendingLayoutDirtyFlags(*node, childPendingLayout);
+    rCache.SelfCount = selfEndCount - startCount;
+    rCache.SubtreeCount = rDeques.GetCount() - startCount;
+    rCache.ArrangeFinalRectPx = node->WinGetArrangeFinalRectanglePx();
+    rCache.RectPx = context.RectPx;
+    rCache.Visibility = context.Visibility;
+    rCache.ClipContext = context.ClipContext;
+    return !rCache.Dirty.IsClean();
+  }
 
-    if (flags.IsFlagged(TreeNodeFlags::UpdateEnabled))
-    {
-      m_vectorUpdate.push_back(node.get());
-    }
-    if (visibility != ItemVisibility::Collapsed && flags.IsFlagged(TreeNodeFlags::ResolveEnabled))
+
+  bool UITree::PatchDeques(const std::shared_ptr<TreeNode>& node, const PxRectangle& parentRectPx, const ItemVisibility parentVisibility,
+                           const DrawClipContext& parentClipContext, const bool parentArranged, TreeNodeDequeCount& rCursor)
+  {
+    assert(m_state == State::Ready);
+    TreeNodeDequeCache& rCache = node->m_dequeCache;
+    TreeNodeDequeDirtyFlags dirty = rCache.Dirty;
+    if (!rCache.IsValid || dirty.IsFlagged(TreeNodeDequeDirtyFlags::Subtree))
     {
-      m_vectorResolve.push_back(node.get());
+      return RegenerateDeques(node, parentRectPx, parentVisibility, parentClipContext, rCursor);
     }
-    if (visibility != ItemVisibility::Collapsed && flags.IsFlagged(TreeNodeFlags::PostLayoutEnabled))
+    if (parentArranged && node->WinGetArrangeFinalRectanglePx() != rCache.ArrangeFinalRectPx)
     {
-      m_vectorPostLayout.push_back(node.get());
+      // The parent moved or resized this window during its arrange, which means the window itself was arranged too
+      dirty.Enable(TreeNodeDequeDirtyFlags(TreeNodeDequeDirtyFlags::Self | TreeNodeDequeDirtyFlags::Arranged));
     }
-    if (visibility == ItemVisibility::Visible && flags.IsFlagged(TreeNodeFlags::DrawEnabled))
+    if (dirty.IsClean())
     {
-      m_vectorDraw.emplace_back(TreeNodeDrawContext(TypeConverter::UncheckedTo<PxAreaRectangleF>(currentRectPx), drawClipContext),
-                                node->GetWindowPointer());
+      rCursor += rCache.SubtreeCount;
+      return false;
     }
 
-    if (visibility == ItemVisibility::Visible && flags.IsFlagged(TreeNodeFlags::ClickInput))
-    {
-      m_vectorClickInputTarget.emplace_back(currentInputRectPx, node);
-    }
-    if (visibility == ItemVisibility::Visible && flags.IsFlagged(TreeNodeFlags::MouseOver))
+    const TreeNodeDequeCount startCursor = rCursor;
+    if (dirty.IsFlagged(TreeNodeDequeDirtyFlags::Self))
     {
-      m_vectorMouseOverTarget.emplace_back(currentInputRectPx, node);
-    }
-
+      const NodeDequeContext context = CalcNodeDequeContext(*node, parentRectPx, parentVisibility, parentClipContext);
+      if (!rCache.IsChildContextEqual(context.RectPx, context.Visibility, context.ClipContext))
+      {
+        // Everything inherited by the subtree changed, so there is nothing to gain by patching it
+        return RegenerateDeques(node, parentRectPx, parentVisibility, parentClipContext, rCursor);
+      }
+      // Only the node flags can have changed the node's own entries
+      m_dequesScratchpad.Clear();
+      AppendNodeEntries(m_dequesScratchpad, node, context);
+      const TreeNodeDequeCount newSelfCount = m_dequesScratchpad.GetCount();
+      ReplaceRange(m_deques, rCursor, rCache.SelfCount, m_dequesScratchpad);
+      rCache.SelfCount = newSelfCount;
+      rCache.ArrangeFinalRectPx = node->WinGetArrangeFinalRectanglePx();
+    }
+    rCursor += rCache.SelfCount;
+
+    const bool arranged = dirty.IsFlagged(TreeNodeDequeDirtyFlags::Arranged);
+    bool childPendingLayout = false;
     auto& nodeChildren = node->m_children;
     for (auto& entry : nodeChildren)
     {
-      RebuildDeques(entry, currentRectPx, visibility, drawClipContext);
+      childPendingLayout |= PatchDeques(entry, rCache.RectPx, rCache.Visibility, rCache.ClipContext, arranged, rCursor);
     }
+
+    rCache.SubtreeCount = rCursor - startCursor;
+    rCache.Dirty = CalcPendingLayoutDirtyFlags(*node, childPendingLayout);
+    return !rCache.Dirty.IsClean();
+  }
+
+
+  bool UITree::RegenerateDeques(const std::shared_ptr<TreeNode>& node, const PxRectangle& parentRectPx, const ItemVisibility parentVisibility,
+                                const DrawClipContext& parentClipContext, TreeNodeDequeCount& rCursor)
+  {
+    // A node that was never added has no entries yet
+    const TreeNodeDequeCount oldCount = node->m_dequeCache.IsValid ? node->m_dequeCache.SubtreeCount : TreeNodeDequeCount();
+
+    m_dequesScratchpad.Clear();
+    const bool pendingLayout = BuildDeques(m_dequesScratchpad, node, parentRectPx, parentVisibility, parentClipContext);
+    ReplaceRange(m_deques, rCursor, oldCount, m_dequesScratchpad);
+    rCursor += node->m_dequeCache.SubtreeCount;
+    return pendingLayout;
   }
 
 
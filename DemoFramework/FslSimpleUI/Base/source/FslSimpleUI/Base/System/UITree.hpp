@@ -52,17 +52,22 @@
 #include "ITreeNodeBasicInfo.hpp"
 #include "ITreeNodeClickInputTargetLocater.hpp"
 #include "ITreeNodeLocator.hpp"
+#include "TreeNodeDequeCache.hpp"
 #include "TreeNodeDrawContext.hpp"
 #include "TreeNodeFlags.hpp"
+#include "UITreeHitGrid.hpp"
+#include "UITreeInputTargetRecord.hpp"
 
 namespace Fsl
 {
+  class JobSystem;
   struct Point2;
   struct TimeSpan;
 
   namespace UI
   {
     class DrawCommandBuffer;
+    class DrawCommandBufferEx;
     class IEventListener;
     class ModuleCallbackRegistry;
     class RootWindow;
@@ -88,22 +93,36 @@ namespace Fsl
       }
     };
 
-    struct UITreeInputTargetRecord
-    {
-      PxRectangle VisibleRectPx;
-      std::shared_ptr<TreeNode> Node;
+    using UITreeDrawVector = std::vector<UITreeDrawRecord>;
 
-      UITreeInputTargetRecord() = default;
+    //! @brief The cached tree traversal order for each type of operation (stored in depth first pre-order)
+    struct UITreeDeques
+    {
+      FastTreeNodeVector Update;
+      FastTreeNodeVector Resolve;
+      FastTreeNodeVector PostLayout;
+      UITreeDrawVector Draw;
+      UITreeInputTargetVector ClickInputTarget;
+      UITreeInputTargetVector MouseOverTarget;
+
+      void Clear() noexcept
+      {
+        Update.clear();
+        Resolve.clear();
+        PostLayout.clear();
+        Draw.clear();
+        ClickInputTarget.clear();
+        MouseOverTarget.clear();
+      }
 
-      UITreeInputTargetRecord(const PxRectangle& visibleRectPx, std::shared_ptr<TreeNode> node)
-        : VisibleRectPx(visibleRectPx)
-        , Node(std::move(node))
+      TreeNodeDequeCount GetCount() const noexcept
       {
+        return {static_cast<uint32_t>(Update.size()),           static_cast<uint32_t>(Resolve.size()),
+                static_cast<uint32_t>(PostLayout.size()),       static_cast<uint32_t>(Draw.size()),
+                static_cast<uint32_t>(ClickInputTarget.size()), static_cast<uint32_t>(MouseOverTarget.size())};
       }
     };
 
-    using UITreeDrawVector = std::vector<UITreeDrawRecord>;
-
 
     //! @note This tree is designed with the assumption that windows will NOT be reused.
     class UITree final
@@ -158,13 +177,20 @@ namespace Fsl
       bool m_layoutIsDirty{true};
       bool m_contentRenderingIsDirty{true};
 
-      FastTreeNodeVector m_vectorUpdate;
-      FastTreeNodeVector m_vectorResolve;
-      FastTreeNodeVector m_vectorPostLayout;
-      UITreeDrawVector m_vectorDraw;
-      std::vector<UITreeInputTargetRecord> m_vectorClickInputTarget;
-      std::vector<UITreeInputTargetRecord> m_vectorMouseOverTarget;
+      UITreeDeques m_deques;
+      //! Used to build the new content of a dirty subtree before it is patched into m_deques
+      UITreeDeques m_dequesScratchpad;
+      //! Hit test acceleration for m_deques.ClickInputTarget and MouseOverTarget (rebuilt on the first query after the deques changed)
+      mutable UITreeHitGrid m_clickInputHitGrid;
+      mutable UITreeHitGrid m_mouseOverHitGrid;
 
+      //! If set the draw commands are recorded in parallel using this job system
+      std::shared_ptr<JobSystem> m_drawJobSystem;
+      //! The draw command buffer of each parallel draw chunk (reused between frames)
+      std::vector<std::unique_ptr<DrawCommandBufferEx>> m_drawChunkBuffers;
+
+      //! The windows that requested a layout since the last layout pass
+      std::vector<std::shared_ptr<TreeNode>> m_pendingLayoutNodes;
       FastTreeNodeVector m_nodeScratchpad;
       FastTreeNodeVector m_nodeScratchpadPostResolve;
       mutable Context m_context;
@@ -198,6 +224,12 @@ namespace Fsl
 
       void SetClipRectangle(const bool enabled, const PxRectangle& clipRectanglePx);
 
+      //! @brief Record the draw commands of large trees in parallel using the given job system (nullptr disables it).
+      //!        The draw deque is split into consecutive chunks that are recorded into separate buffers and then appended in order,
+      //!        so the resulting command buffer is identical to the one produced by a serial draw.
+      //! @note  This requires that WinDraw of every window in the tree is thread safe (it may only modify the window's own state).
+      void SetDrawJobSystem(std::shared_ptr<JobSystem> jobSystem);
+
 
       void ProcessEvents();
       void Resized(const PxExtent2D& extentPx, const uint32_t densityDpi);
@@ -256,10 +288,22 @@ namespace Fsl
       void UnregisterEventListener(const std::weak_ptr<IEventListener>& eventListener);
 
     private:
+      void DrawParallel(DrawCommandBuffer& rDrawCommandBuffer, JobSystem& rJobSystem);
       inline bool PerformLayout();
+      //! @brief Try to lay out the dirty windows directly and only invalidate the parents of the windows whose desired size changed
+      inline void ResolvePendingLayouts();
       inline void RebuildDeques();
-      void RebuildDeques(const std::shared_ptr<TreeNode>& node, const PxRectangle& parentRectPx, const ItemVisibility parentVisibility,
-                         DrawClipContext drawClipContext);
+      //! @brief Append the entries of the node and its entire subtree to rDeques
+      //! @return true if a window in the subtree is still waiting to be laid out (so it needs to be revisited)
+      bool BuildDeques(UITreeDeques& rDeques, const std::shared_ptr<TreeNode>& node, const PxRectangle& parentRectPx,
+                       const ItemVisibility parentVisibility, const DrawClipContext& parentClipContext);
+      //! @brief Patch the dirty parts of the node's subtree in m_deques
+      //! @param rCursor the index of the node's first entry in each of the deques, on return it points to the entry after the subtree.
+      //! @return true if a window in the subtree is still waiting to be laid out (so it needs to be revisited)
+      bool PatchDeques(const std::shared_ptr<TreeNode>& node, const PxRectangle& parentRectPx, const ItemVisibility parentVisibility,
+                       const DrawClipContext& parentClipContext, const bool parentArranged, TreeNodeDequeCount& rCursor);
+      bool RegenerateDeques(const std::shared_ptr<TreeNode>& node, const PxRectangle& parentRectPx, const ItemVisibility parentVisibility,
+                            const DrawClipContext& parentClipContext, TreeNodeDequeCount& rCursor);
       inline void ProcessEventsPreUpdate();
       inline void ProcessEventsPostUpdate(const TimeSpan& timespan);
       inline void ProcessEventsPostResolve(const TimeSpan& timespan);
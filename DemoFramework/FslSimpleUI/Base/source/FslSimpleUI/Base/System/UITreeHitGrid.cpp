@@ -0,0 +1,250 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include "UITreeHitGrid.hpp"
+
+namespace Fsl::UI
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! Below this number of targets a linear scan is as fast as the grid
+      constexpr std::size_t MinGridTargets = 64;
+      //! The desired average number of targets per cell
+      constexpr std::size_t TargetsPerCell = 4;
+      constexpr int64_t MaxCellsPerAxis = 128;
+      //! If the targets would be duplicated into more cell entries than this (per target) we fall back to a linear scan
+      constexpr std::size_t MaxEntriesPerTarget = 16;
+    }
+
+    struct CellRange
+    {
+      int32_t Left{0};
+      int32_t Top{0};
+      int32_t Right{0};
+      int32_t Bottom{0};
+    };
+
+    constexpr bool IsHitable(const PxRectangle& rectPx) noexcept
+    {
+      return rectPx.RawWidth() > 0 && rectPx.RawHeight() > 0;
+    }
+  }
+
+
+  void UITreeHitGrid::Build(const UITreeInputTargetVector& targets)
+  {
+    m_isDirty = false;
+    ClearGrid();
+    m_rectsPx.clear();
+    m_rectsPx.reserve(targets.size());
+    for (const auto& target : targets)
+    {
+      m_rectsPx.push_back(target.VisibleRectPx);
+    }
+    if (m_rectsPx.size() < LocalConfig::MinGridTargets || m_rectsPx.size() > std::numeric_limits<uint32_t>::max())
+    {
+      return;
+    }
+
+    // Calculate the bounds of all the rectangles that can be hit
+    int64_t minX = std::numeric_limits<int32_t>::max();
+    int64_t minY = std::numeric_limits<int32_t>::max();
+    int64_t maxX = std::numeric_limits<int32_t>::min();
+    int64_t maxY = std::numeric_limits<int32_t>::min();
+    std::size_t hitableCount = 0;
+    for (const PxRectangle& rectPx : m_rectsPx)
+    {
+      if (IsHitable(rectPx))
+      {
+        minX = std::min(minX, static_cast<int64_t>(rectPx.RawLeft()));
+        minY = std::min(minY, static_cast<int64_t>(rectPx.RawTop()));
+        maxX = std::max(maxX, static_cast<int64_t>(rectPx.RawLeft()) + rectPx.RawWidth());
+        maxY = std::max(maxY, static_cast<int64_t>(rectPx.RawTop()) + rectPx.RawHeight());
+        ++hitableCount;
+      }
+    }
+    const int64_t boundsWidth = maxX - minX;
+    const int64_t boundsHeight = maxY - minY;
+    if (hitableCount < LocalConfig::MinGridTargets || boundsWidth > std::numeric_limits<int32_t>::max() ||
+        boundsHeight > std::numeric_limits<int32_t>::max())
+    {
+      return;
+    }
+
+    // Pick a cell count that matches the aspect ratio of the bounds
+    const auto desiredCellCount = static_cast<double>(std::max(hitableCount / LocalConfig::TargetsPerCell, std::size_t(1)));
+    const auto desiredColumns =
+      static_cast<int64_t>(std::round(std::sqrt(desiredCellCount * static_cast<double>(boundsWidth) / static_cast<double>(boundsHeight))));
+    const int64_t columns = std::clamp(desiredColumns, int64_t(1), std::min(LocalConfig::MaxCellsPerAxis, boundsWidth));
+    const int64_t rows = std::clamp(static_cast<int64_t>(std::round(desiredCellCount / static_cast<double>(columns))), int64_t(1),
+                                    std::min(LocalConfig::MaxCellsPerAxis, boundsHeight));
+
+    m_originX = static_cast<int32_t>(minX);
+    m_originY = static_cast<int32_t>(minY);
+    m_cellWidth = static_cast<int32_t>((boundsWidth + columns - 1) / columns);
+    m_cellHeight = static_cast<int32_t>((boundsHeight + rows - 1) / rows);
+    m_columns = static_cast<int32_t>((boundsWidth + m_cellWidth - 1) / m_cellWidth);
+    m_rows = static_cast<int32_t>((boundsHeight + m_cellHeight - 1) / m_cellHeight);
+
+    const auto calcCellRange = [this](const PxRectangle& rectPx)
+    {
+      // The last pixel inside the rectangle is Right - 1 and Bottom - 1
+      return CellRange{(rectPx.RawLeft() - m_originX) / m_cellWidth, (rectPx.RawTop() - m_originY) / m_cellHeight,
+                       (rectPx.RawRight() - 1 - m_originX) / m_cellWidth, (rectPx.RawBottom() - 1 - m_originY) / m_cellHeight};
+    };
+
+    // Count the entries of each cell (stored one entry ahead so the prefix sum produces the offsets)
+    const auto cellCount = static_cast<std::size_t>(m_columns) * static_cast<std::size_t>(m_rows);
+    m_cellOffsets.assign(cellCount + 1, 0u);
+    std::size_t entryCount = 0;
+    for (const PxRectangle& rectPx : m_rectsPx)
+    {
+      if (IsHitable(rectPx))
+      {
+        const CellRange range = calcCellRange(rectPx);
+        for (int32_t y = range.Top; y <= range.Bottom; ++y)
+        {
+          const auto rowOffset = static_cast<std::size_t>(y) * static_cast<std::size_t>(m_columns);
+          for (int32_t x = range.Left; x <= range.Right; ++x)
+          {
+            ++m_cellOffsets[rowOffset + static_cast<std::size_t>(x) + 1u];
+          }
+        }
+        entryCount += static_cast<std::size_t>(range.Right - range.Left + 1) * static_cast<std::size_t>(range.Bottom - range.Top + 1);
+      }
+    }
+    if (entryCount > (m_rectsPx.size() * LocalConfig::MaxEntriesPerTarget) || entryCount > std::numeric_limits<uint32_t>::max())
+    {
+      // Too many large overlapping targets for the grid to be worth it
+      ClearGrid();
+      return;
+    }
+
+    for (std::size_t i = 1; i < m_cellOffsets.size(); ++i)
+    {
+      m_cellOffsets[i] += m_cellOffsets[i - 1];
+    }
+
+    // Fill the cells, the targets are visited in deque order so the entries of each cell end up in ascending order
+    m_cellEntries.resize(entryCount);
+    m_cellCursorScratchpad.assign(m_cellOffsets.begin(), m_cellOffsets.end() - 1);
+    for (std::size_t i = 0; i < m_rectsPx.size(); ++i)
+    {
+      const PxRectangle& rectPx = m_rectsPx[i];
+      if (IsHitable(rectPx))
+      {
+        const CellRange range = calcCellRange(rectPx);
+        for (int32_t y = range.Top; y <= range.Bottom; ++y)
+        {
+          const auto rowOffset = static_cast<std::size_t>(y) * static_cast<std::size_t>(m_columns);
+          for (int32_t x = range.Left; x <= range.Right; ++x)
+          {
+            uint32_t& rCursor = m_cellCursorScratchpad[rowOffset + static_cast<std::size_t>(x)];
+            m_cellEntries[rCursor] = static_cast<uint32_t>(i);
+            ++rCursor;
+          }
+        }
+      }
+    }
+  }
+
+
+  std::optional<uint32_t> UITreeHitGrid::TryFind(const PxPoint2& positionPx) const noexcept
+  {
+    assert(!m_isDirty);
+    if (!IsGridEnabled())
+    {
+      return TryFindLinear(positionPx);
+    }
+
+    // Positions outside the grid can not be inside any of the rectangles
+    const int64_t localX = static_cast<int64_t>(positionPx.X.Value) - m_originX;
+    const int64_t localY = static_cast<int64_t>(positionPx.Y.Value) - m_originY;
+    if (localX < 0 || localY < 0)
+    {
+      return {};
+    }
+    const int64_t cellX = localX / m_cellWidth;
+    const int64_t cellY = localY / m_cellHeight;
+    if (cellX >= m_columns || cellY >= m_rows)
+    {
+      return {};
+    }
+
+    const auto cellIndex = static_cast<std::size_t>((cellY * m_columns) + cellX);
+    const uint32_t cellStart = m_cellOffsets[cellIndex];
+    uint32_t entryIndex = m_cellOffsets[cellIndex + 1];
+    while (entryIndex > cellStart)
+    {
+      --entryIndex;
+      const uint32_t targetIndex = m_cellEntries[entryIndex];
+      if (m_rectsPx[targetIndex].Contains(positionPx))
+      {
+        return targetIndex;
+      }
+    }
+    return {};
+  }
+
+
+  void UITreeHitGrid::ClearGrid() noexcept
+  {
+    m_cellOffsets.clear();
+    m_cellEntries.clear();
+    m_originX = 0;
+    m_originY = 0;
+    m_cellWidth = 0;
+    m_cellHeight = 0;
+    m_columns = 0;
+    m_rows = 0;
+  }
+
+
+  std::optional<uint32_t> UITreeHitGrid::TryFindLinear(const PxPoint2& positionPx) const noexcept
+  {
+    auto index = static_cast<uint32_t>(m_rectsPx.size());
+    while (index > 0)
+    {
+      --index;
+      if (m_rectsPx[index].Contains(positionPx))
+      {
+        return index;
+      }
+    }
+    return {};
+  }
+}
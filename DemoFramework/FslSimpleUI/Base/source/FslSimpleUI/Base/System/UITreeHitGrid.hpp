@@ -0,0 +1,94 @@
+#ifndef FSLSIMPLEUI_BASE_SYSTEM_UITREEHITGRID_HPP
+#define FSLSIMPLEUI_BASE_SYSTEM_UITREEHITGRID_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxPoint2.hpp>
+#include <FslBase/Math/Pixel/PxRectangle.hpp>
+#include <optional>
+#include <vector>
+#include "UITreeInputTargetRecord.hpp"
+
+namespace Fsl::UI
+{
+  //! @brief A uniform grid that accelerates hit testing against a UITree input target deque.
+  //!        Each cell stores the indices of the targets that overlap it in ascending (deque) order, so a query only scans the targets in the
+  //!        cell of the hit position in reverse order. This gives the same 'last wins' result as a reverse scan of the entire deque.
+  //!        Small deques and deques where the targets would be duplicated into too many cells are scanned linearly instead.
+  class UITreeHitGrid
+  {
+    std::vector<PxRectangle> m_rectsPx;
+    //! The first entry of each cell in m_cellEntries (one extra entry marks the end of the last cell)
+    std::vector<uint32_t> m_cellOffsets;
+    std::vector<uint32_t> m_cellEntries;
+    std::vector<uint32_t> m_cellCursorScratchpad;
+    int32_t m_originX{0};
+    int32_t m_originY{0};
+    int32_t m_cellWidth{0};
+    int32_t m_cellHeight{0};
+    int32_t m_columns{0};
+    int32_t m_rows{0};
+    bool m_isDirty{true};
+
+  public:
+    //! @brief Check if the grid needs to be rebuilt before it can be queried
+    bool IsDirty() const noexcept
+    {
+      return m_isDirty;
+    }
+
+    //! @brief Check if the grid is used (if not, queries are resolved with a linear scan)
+    bool IsGridEnabled() const noexcept
+    {
+      return m_columns > 0;
+    }
+
+    //! @brief Mark the grid as out of date, this should be called every time the deque it was built from is modified
+    void MarkDirty() noexcept
+    {
+      m_isDirty = true;
+    }
+
+    //! @brief Rebuild the grid from the given deque
+    void Build(const UITreeInputTargetVector& targets);
+
+    //! @brief Find the last target in the deque whose rectangle contains the position
+    //! @return the index of the target in the deque the grid was built from or nullopt if no target contains the position.
+    std::optional<uint32_t> TryFind(const PxPoint2& positionPx) const noexcept;
+
+  private:
+    void ClearGrid() noexcept;
+    std::optional<uint32_t> TryFindLinear(const PxPoint2& positionPx) const noexcept;
+  };
+}
+
+#endif
@@ -35,6 +35,7 @@
 #include <FslSimpleUI/Base/IWindowManager.hpp>
 #include <FslSimpleUI/Base/UIContext.hpp>
 #include <FslSimpleUI/Render/Base/IMeshManager.hpp>
+#include <memory>
 #include <utility>
 
 namespace Fsl::UI
@@ -45,6 +46,7 @@ namespace Fsl::UI
     , WindowManager(std::move(windowManager))
     , EventSender(std::move(eventSender))
     , MeshManager(std::move(meshManager))
+    , LayoutCounter(std::make_shared<LayoutCallCounter>())
   {
     if (!DataBindingService)
     {
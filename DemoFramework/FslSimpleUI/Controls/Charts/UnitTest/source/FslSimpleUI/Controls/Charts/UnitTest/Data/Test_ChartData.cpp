@@ -893,3 +893,55 @@ TEST(Test_Data_ChartData, Append3_Capacity2_ViewEntries2)
     EXPECT_EQ(value2, segmentData[0].Values[0]);
   }
 }
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+TEST(Test_Data_ChartData, Append_EvictMinMax_TwoChannels)
+{
+  const uint32_t channelCount = 2;
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  UI::ChartData chartData(dataBinding, 3, channelCount, {});
+
+  // The min max is tracked for the sum of all channels
+  chartData.Append(UI::ChartDataEntry({10, 90}));
+  chartData.Append(UI::ChartDataEntry({1, 2}));
+  chartData.Append(UI::ChartDataEntry({20, 30}));
+
+  const auto viewConfig = chartData.CreateViewConfig();
+  EXPECT_EQ(MinMax<uint32_t>(3, 100), chartData.CalculateDataStats(viewConfig).ValueMinMax);
+
+  // Evicts the max
+  chartData.Append(UI::ChartDataEntry({5, 5}));
+  EXPECT_EQ(MinMax<uint32_t>(3, 50), chartData.CalculateDataStats(viewConfig).ValueMinMax);
+
+  // Evicts the min
+  chartData.Append(UI::ChartDataEntry({20, 20}));
+  EXPECT_EQ(MinMax<uint32_t>(10, 50), chartData.CalculateDataStats(viewConfig).ValueMinMax);
+
+  // A view of the newest two entries
+  const auto viewConfig2 = chartData.CreateViewConfig(2, false);
+  EXPECT_EQ(MinMax<uint32_t>(10, 40), chartData.CalculateDataStats(viewConfig2).ValueMinMax);
+}
+
+
+TEST(Test_Data_ChartData, SetCapacity_Shrink_Grow)
+{
+  const uint32_t channelCount = 1;
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  UI::ChartData chartData(dataBinding, 4, channelCount, {});
+  chartData.Append(UI::ChartDataEntry(100));
+  chartData.Append(UI::ChartDataEntry(1));
+  chartData.Append(UI::ChartDataEntry(20));
+  chartData.Append(UI::ChartDataEntry(30));
+
+  chartData.SetCapacity(2);
+  EXPECT_EQ(2u, chartData.GetCapacity());
+  EXPECT_EQ(2u, chartData.GetSize());
+  EXPECT_EQ(MinMax<uint32_t>(20, 30), chartData.CalculateDataStats(chartData.CreateViewConfig()).ValueMinMax);
+
+  chartData.SetCapacity(3);
+  EXPECT_EQ(3u, chartData.GetCapacity());
+  chartData.Append(UI::ChartDataEntry(5));
+  EXPECT_EQ(3u, chartData.GetSize());
+  EXPECT_EQ(MinMax<uint32_t>(5, 30), chartData.CalculateDataStats(chartData.CreateViewConfig()).ValueMinMax);
+}
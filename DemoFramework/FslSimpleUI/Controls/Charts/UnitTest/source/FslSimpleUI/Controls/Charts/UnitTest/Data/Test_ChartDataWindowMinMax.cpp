@@ -0,0 +1,159 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Math/LogMinMax.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataWindowMinMax.hpp>
+#include <FslUnitTest/TestFixture.hpp>
+#include <algorithm>
+#include <deque>
+#include <random>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_Data_ChartDataWindowMinMax = TestFixture;
+
+  MinMax<uint32_t> CalcReferenceMinMax(const std::deque<uint32_t>& values, const std::size_t maxEntries)
+  {
+    const std::size_t count = std::min(values.size(), maxEntries);
+    if (count <= 0u)
+    {
+      return MinMax<uint32_t>(0, 0);
+    }
+    auto [itrMin, itrMax] = std::minmax_element(values.end() - static_cast<std::ptrdiff_t>(count), values.end());
+    return MinMax<uint32_t>(*itrMin, *itrMax);
+  }
+}
+
+
+TEST(Test_Data_ChartDataWindowMinMax, Construct)
+{
+  UI::ChartDataWindowMinMax window(4);
+
+  EXPECT_TRUE(window.Empty());
+  EXPECT_EQ(0u, window.Size());
+  EXPECT_EQ(4u, window.Capacity());
+  EXPECT_EQ(MinMax<uint32_t>(0, 0), window.GetMinMax());
+  EXPECT_EQ(MinMax<uint32_t>(0, 0), window.GetMinMax(2));
+}
+
+
+TEST(Test_Data_ChartDataWindowMinMax, PushBack_EvictsFront)
+{
+  UI::ChartDataWindowMinMax window(3);
+
+  window.PushBack(5);
+  window.PushBack(1);
+  window.PushBack(9);
+  EXPECT_EQ(MinMax<uint32_t>(1, 9), window.GetMinMax());
+  EXPECT_EQ(MinMax<uint32_t>(9, 9), window.GetMinMax(1));
+  EXPECT_EQ(MinMax<uint32_t>(1, 9), window.GetMinMax(2));
+
+  // Evicts 5
+  window.PushBack(3);
+  EXPECT_EQ(3u, window.Size());
+  EXPECT_EQ(MinMax<uint32_t>(1, 9), window.GetMinMax());
+
+  // Evicts 1
+  window.PushBack(4);
+  EXPECT_EQ(MinMax<uint32_t>(3, 9), window.GetMinMax());
+
+  // Evicts 9
+  window.PushBack(4);
+  EXPECT_EQ(MinMax<uint32_t>(3, 4), window.GetMinMax());
+  EXPECT_EQ(MinMax<uint32_t>(4, 4), window.GetMinMax(2));
+}
+
+
+TEST(Test_Data_ChartDataWindowMinMax, Clear)
+{
+  UI::ChartDataWindowMinMax window(3);
+  window.PushBack(5);
+  window.PushBack(1);
+  window.Clear();
+
+  EXPECT_TRUE(window.Empty());
+  EXPECT_EQ(MinMax<uint32_t>(0, 0), window.GetMinMax());
+
+  window.PushBack(7);
+  EXPECT_EQ(MinMax<uint32_t>(7, 7), window.GetMinMax());
+}
+
+
+TEST(Test_Data_ChartDataWindowMinMax, ResizePopFront)
+{
+  UI::ChartDataWindowMinMax window(4);
+  window.PushBack(1);
+  window.PushBack(9);
+  window.PushBack(4);
+  window.PushBack(5);
+
+  window.ResizePopFront(2);
+  EXPECT_EQ(2u, window.Size());
+  EXPECT_EQ(2u, window.Capacity());
+  EXPECT_EQ(MinMax<uint32_t>(4, 5), window.GetMinMax());
+
+  window.Grow(2);
+  EXPECT_EQ(4u, window.Capacity());
+  window.PushBack(2);
+  window.PushBack(3);
+  EXPECT_EQ(4u, window.Size());
+  EXPECT_EQ(MinMax<uint32_t>(2, 5), window.GetMinMax());
+}
+
+
+TEST(Test_Data_ChartDataWindowMinMax, Random_MatchesReference)
+{
+  constexpr std::size_t Capacity = 37;
+  UI::ChartDataWindowMinMax window(Capacity);
+  std::deque<uint32_t> reference;
+
+  std::mt19937 random(1337);
+  std::uniform_int_distribution<uint32_t> distribution(0, 50);
+  for (uint32_t i = 0; i < 2000; ++i)
+  {
+    const uint32_t value = distribution(random);
+    window.PushBack(value);
+    reference.push_back(value);
+    if (reference.size() > Capacity)
+    {
+      reference.pop_front();
+    }
+
+    ASSERT_EQ(reference.size(), window.Size());
+    ASSERT_EQ(CalcReferenceMinMax(reference, Capacity), window.GetMinMax());
+    for (std::size_t maxEntries = 0; maxEntries <= Capacity + 1; ++maxEntries)
+    {
+      ASSERT_EQ(CalcReferenceMinMax(reference, maxEntries), window.GetMinMax(maxEntries));
+    }
+  }
+}
@@ -37,9 +37,14 @@
 #include <FslSimpleUI/Controls/Charts/Data/ChartData.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataView.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartSortedDataChannelView.hpp>
+#include <FslSimpleUI/Controls/Charts/Util/BoxPlotHelper.hpp>
 #include <FslUnitTest/TestFixture.hpp>
+#include <algorithm>
 #include <array>
+#include <deque>
 #include <memory>
+#include <random>
+#include <vector>
 
 using namespace Fsl;
 
@@ -152,3 +157,100 @@ TEST(Test_Data_ChartSortedDataChannelView, ConstructFromUnsorted)
   EXPECT_EQ(4u, sortedSpan[3]);
   EXPECT_EQ(5u, sortedSpan[4]);
 }
+
+
+TEST(Test_Data_ChartSortedDataChannelView, SlidingWindow_MatchesFullSort)
+{
+  constexpr uint32_t Capacity = 23;
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto chartData = std::make_shared<UI::ChartData>(dataBinding, Capacity, 2, UI::ChartData::Constraints());
+  auto dataView = std::make_shared<UI::ChartDataView>(chartData);
+  UI::ChartSortedDataChannelView testSortedDataView(dataView, 1);
+
+  std::deque<uint32_t> reference;
+  std::mt19937 random(42);
+  std::uniform_int_distribution<uint32_t> distribution(0, 30);
+  std::vector<uint32_t> sortedReference;
+  for (uint32_t i = 0; i < 500; ++i)
+  {
+    // Append a varying number of entries between each refresh
+    const uint32_t appendCount = (i % 7) == 6 ? 30 : (i % 3);
+    for (uint32_t appendIndex = 0; appendIndex < appendCount; ++appendIndex)
+    {
+      const uint32_t value = distribution(random);
+      chartData->Append(UI::ChartDataEntry({distribution(random), value}));
+      reference.push_back(value);
+      if (reference.size() > Capacity)
+      {
+        reference.pop_front();
+      }
+    }
+    if ((i % 50) == 49)
+    {
+      chartData->Clear();
+      reference.clear();
+    }
+
+    sortedReference.assign(reference.begin(), reference.end());
+    std::sort(sortedReference.begin(), sortedReference.end());
+
+    const auto sortedSpan = testSortedDataView.GetChannelViewSpan();
+    ASSERT_EQ(sortedReference.size(), sortedSpan.size());
+    for (std::size_t index = 0; index < sortedReference.size(); ++index)
+    {
+      ASSERT_EQ(sortedReference[index], sortedSpan[index]);
+    }
+    if (!sortedReference.empty())
+    {
+      EXPECT_EQ(MinMax<uint32_t>(sortedReference.front(), sortedReference.back()), testSortedDataView.GetAxisRange());
+    }
+    if (sortedReference.size() >= UI::BoxPlotHelper::MinimumEntries)
+    {
+      EXPECT_EQ(UI::BoxPlotHelper::Calculate(SpanUtil::AsReadOnlySpan(sortedReference)), testSortedDataView.CalculateBoxPlot());
+    }
+  }
+}
+
+
+TEST(Test_Data_ChartSortedDataChannelView, SetMaxViewEntries)
+{
+  std::array<uint32_t, 6> source = {6, 1, 5, 2, 4, 3};
+
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto dataView = CreateDataViewFromSpan(dataBinding, source);
+  UI::ChartSortedDataChannelView testSortedDataView(dataView, 0);
+  EXPECT_EQ(6u, testSortedDataView.GetSortedValues().size());
+
+  // Shrink the view to the newest three entries
+  dataView->SetMaxViewEntries(3);
+  {
+    const auto& sortedValues = testSortedDataView.GetSortedValues();
+    ASSERT_EQ(3u, sortedValues.size());
+    EXPECT_EQ(2u, sortedValues[0]);
+    EXPECT_EQ(3u, sortedValues[1]);
+    EXPECT_EQ(4u, sortedValues[2]);
+  }
+
+  // Grow it again
+  dataView->SetMaxViewEntries(5);
+  {
+    const auto& sortedValues = testSortedDataView.GetSortedValues();
+    ASSERT_EQ(5u, sortedValues.size());
+    EXPECT_EQ(1u, sortedValues[0]);
+    EXPECT_EQ(5u, sortedValues[4]);
+  }
+}
+
+
+TEST(Test_Data_ChartSortedDataChannelView, CalculatePercentile)
+{
+  std::array<uint32_t, 5> source = {40, 10, 30, 20, 50};
+
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  UI::ChartSortedDataChannelView testSortedDataView(CreateDataViewFromSpan(dataBinding, source), 0);
+
+  EXPECT_EQ(10.0, testSortedDataView.CalculatePercentile(0.0));
+  EXPECT_EQ(30.0, testSortedDataView.CalculatePercentile(0.5));
+  EXPECT_EQ(35.0, testSortedDataView.CalculatePercentile(0.625));
+  EXPECT_EQ(50.0, testSortedDataView.CalculatePercentile(1.0));
+}
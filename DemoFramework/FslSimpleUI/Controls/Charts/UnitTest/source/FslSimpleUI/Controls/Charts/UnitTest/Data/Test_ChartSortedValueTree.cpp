@@ -0,0 +1,158 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslSimpleUI/Controls/Charts/Data/ChartSortedValueTree.hpp>
+#include <FslUnitTest/TestFixture.hpp>
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_Data_ChartSortedValueTree = TestFixture;
+
+  void ExpectEqual(const std::vector<uint32_t>& sortedReference, const UI::ChartSortedValueTree& tree)
+  {
+    ASSERT_EQ(sortedReference.size(), tree.size());
+    for (uint32_t i = 0; i < sortedReference.size(); ++i)
+    {
+      ASSERT_EQ(sortedReference[i], tree[i]);
+    }
+    std::vector<uint32_t> copy;
+    tree.CopyTo(copy);
+    EXPECT_EQ(sortedReference, copy);
+  }
+}
+
+
+TEST(Test_Data_ChartSortedValueTree, Construct)
+{
+  UI::ChartSortedValueTree tree;
+
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(0u, tree.size());
+}
+
+
+TEST(Test_Data_ChartSortedValueTree, Insert)
+{
+  UI::ChartSortedValueTree tree;
+  tree.Insert(5);
+  tree.Insert(1);
+  tree.Insert(3);
+  tree.Insert(3);
+
+  ExpectEqual({1, 3, 3, 5}, tree);
+  EXPECT_EQ(1u, tree.front());
+  EXPECT_EQ(5u, tree.back());
+}
+
+
+TEST(Test_Data_ChartSortedValueTree, Erase)
+{
+  UI::ChartSortedValueTree tree;
+  tree.Insert(5);
+  tree.Insert(1);
+  tree.Insert(3);
+  tree.Insert(3);
+
+  EXPECT_FALSE(tree.Erase(4));
+  EXPECT_TRUE(tree.Erase(3));
+  ExpectEqual({1, 3, 5}, tree);
+  EXPECT_TRUE(tree.Erase(3));
+  ExpectEqual({1, 5}, tree);
+  EXPECT_FALSE(tree.Erase(3));
+  EXPECT_TRUE(tree.Erase(1));
+  EXPECT_TRUE(tree.Erase(5));
+  EXPECT_TRUE(tree.empty());
+}
+
+
+TEST(Test_Data_ChartSortedValueTree, Clear)
+{
+  UI::ChartSortedValueTree tree;
+  tree.Insert(5);
+  tree.Insert(1);
+  tree.clear();
+
+  EXPECT_TRUE(tree.empty());
+  tree.Insert(7);
+  ExpectEqual({7}, tree);
+}
+
+
+TEST(Test_Data_ChartSortedValueTree, Move)
+{
+  UI::ChartSortedValueTree tree;
+  tree.Insert(5);
+  tree.Insert(1);
+
+  UI::ChartSortedValueTree tree2(std::move(tree));
+  ExpectEqual({1, 5}, tree2);
+  // NOLINTNEXTLINE(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+  EXPECT_TRUE(tree.empty());
+}
+
+
+TEST(Test_Data_ChartSortedValueTree, Random_MatchesReference)
+{
+  UI::ChartSortedValueTree tree;
+  std::vector<uint32_t> reference;
+
+  std::mt19937 random(1337);
+  std::uniform_int_distribution<uint32_t> valueDistribution(0, 200);
+  for (uint32_t i = 0; i < 3000; ++i)
+  {
+    // Grow for a while, then shrink
+    const bool insert = reference.empty() || ((i / 500) % 2 == 0 ? (random() % 4) != 0 : (random() % 4) == 0);
+    if (insert)
+    {
+      const uint32_t value = valueDistribution(random);
+      tree.Insert(value);
+      reference.insert(std::lower_bound(reference.begin(), reference.end(), value), value);
+    }
+    else
+    {
+      const auto index = random() % reference.size();
+      const uint32_t value = reference[index];
+      ASSERT_TRUE(tree.Erase(value));
+      reference.erase(reference.begin() + static_cast<std::ptrdiff_t>(index));
+    }
+    if ((i % 37) == 0)
+    {
+      ExpectEqual(reference, tree);
+    }
+  }
+  ExpectEqual(reference, tree);
+}
@@ -77,3 +77,25 @@ TEST(Test_Util_BoxPlotHelper, Calculate_Odd)
   EXPECT_EQ(140.0, result.Q3);
   EXPECT_EQ(150.0, result.Max);
 }
+
+
+TEST(Test_Util_BoxPlotHelper, CalculatePercentile)
+{
+  std::array<uint32_t, 5> sortedData = {10, 20, 30, 40, 50};
+  const auto span = SpanUtil::AsReadOnlySpan(sortedData);
+
+  EXPECT_EQ(10.0, UI::BoxPlotHelper::CalculatePercentile(span, 0.0));
+  EXPECT_EQ(15.0, UI::BoxPlotHelper::CalculatePercentile(span, 0.125));
+  EXPECT_EQ(30.0, UI::BoxPlotHelper::CalculatePercentile(span, 0.5));
+  EXPECT_EQ(50.0, UI::BoxPlotHelper::CalculatePercentile(span, 1.0));
+  // Out of range values are clamped
+  EXPECT_EQ(10.0, UI::BoxPlotHelper::CalculatePercentile(span, -1.0));
+  EXPECT_EQ(50.0, UI::BoxPlotHelper::CalculatePercentile(span, 2.0));
+}
+
+
+TEST(Test_Util_BoxPlotHelper, CalculatePercentile_Empty)
+{
+  std::array<uint32_t, 0> sortedData = {};
+  EXPECT_THROW(UI::BoxPlotHelper::CalculatePercentile(SpanUtil::AsReadOnlySpan(sortedData), 0.5), NotSupportedException);
+}
@@ -52,6 +52,10 @@ namespace Fsl::UI
     ~AChartData() override = default;
 
     virtual uint32_t ChangeId() const noexcept = 0;
+    //! The total number of entries that has been appended during the lifetime of the data (it is never reset, not even by a clear).
+    //! Entries are only ever appended at the back and removed from the front, so a view of 'n' entries always contains the entries appended
+    //! as number [AppendCount() - n, AppendCount()). This allows views to update incrementally instead of rebuilding on every change.
+    virtual uint64_t AppendCount() const noexcept = 0;
     virtual uint32_t ChannelCount() const noexcept = 0;
     //! Create a view that is a 1:1 mapping of the data
     virtual ChartDataViewConfig CreateViewConfig() = 0;
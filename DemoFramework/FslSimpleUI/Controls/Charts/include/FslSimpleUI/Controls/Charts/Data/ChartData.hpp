@@ -39,6 +39,7 @@
 #include <FslSimpleUI/Controls/Charts/Data/AChartData.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartChannelMetaData.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataStats.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataWindowMinMax.hpp>
 #include <FslSimpleUI/Controls/Charts/Grid/ChartGridLineInfo.hpp>
 #include <fmt/format.h>
 #include <array>
@@ -70,31 +71,15 @@ namespace Fsl::UI
     };
 
   private:
-    struct Record
-    {
-      value_type CurrentMin{0};
-      value_type CurrentMax{0};
-
-      void Clear()
-      {
-        CurrentMin = 0;
-        CurrentMax = 0;
-      }
-
-      void SetMinMax(const MinMax<value_type> minMax)
-      {
-        CurrentMin = minMax.Min();
-        CurrentMax = minMax.Max();
-      }
-    };
-
     CircularFixedSizeBuffer<ChartDataEntry> m_buffer;
+    //! Tracks the min max of the channel sum of every entry in m_buffer
+    ChartDataWindowMinMax m_windowMinMax;
     uint32_t m_dataChannelCount;
     uint32_t m_changeId{0};
+    uint64_t m_appendCount{0};
 
     Constraints m_constraints;
 
-    Record m_viewInfo;
     ChartDataStats m_cachedDataStats;
     std::optional<MinMax<value_type>> m_customViewMinMax;
     std::array<ChartChannelMetaData, ChartDataLimits::MaxChannels> m_channelMetaData;
@@ -143,6 +128,11 @@ namespace Fsl::UI
       return m_changeId;
     }
 
+    uint64_t AppendCount() const noexcept final
+    {
+      return m_appendCount;
+    }
+
     ChartDataViewConfig CreateViewConfig() final;
     ChartDataViewConfig CreateViewConfig(const uint32_t maxEntries, const bool allowCapacityToGrow) final;
     ChartDataStats CalculateDataStats(const ChartDataViewConfig viewConfig) const final;
@@ -159,10 +149,7 @@ namespace Fsl::UI
 
   private:
     void UpdateCachedValues(const MinMax<value_type> minMax);
-    MinMax<value_type> CalculateMinMax() const noexcept;
-    MinMax<value_type> CalculateMinMax(const uint32_t maxEntries) const noexcept;
     MinMax<value_type> ApplyConstraints(const MinMax<value_type> minMax) const;
-    static MinMax<uint32_t> CalcSpanMinMax(ReadOnlySpan<ChartDataEntry> span, const uint32_t dataEntries, value_type min, value_type max) noexcept;
     static value_type CalcSum(const ChartDataEntry& entry, const uint32_t dataEntries) noexcept;
     void MarkAsChanged();
   };
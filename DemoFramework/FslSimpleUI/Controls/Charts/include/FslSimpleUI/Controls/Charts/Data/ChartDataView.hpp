@@ -92,6 +92,9 @@ namespace Fsl::UI
 
     uint64_t ChangeId() const noexcept;
 
+    //! The total number of entries that has been appended to the chart data (see AChartData::AppendCount)
+    uint64_t AppendCount() const noexcept;
+
     void ClearCustomMinMax();
     void SetCustomMinMax(MinMax<value_type> customViewMinMax);
 
@@ -0,0 +1,171 @@
+#ifndef FSLSIMPLEUI_CONTROLS_CHARTS_DATA_CHARTDATAWINDOWMINMAX_HPP
+#define FSLSIMPLEUI_CONTROLS_CHARTS_DATA_CHARTDATAWINDOWMINMAX_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/MinMax.hpp>
+#include <cassert>
+#include <vector>
+
+namespace Fsl::UI
+{
+  //! @brief Tracks the min and max of a sliding window of values using two monotonic queues.
+  //!        - PushBack and PopFront are amortized O(1).
+  //!        - The min/max of the full window is O(1).
+  //!        - The min/max of the newest 'n' entries of the window is O(log n) as the queues are sorted by their insertion index.
+  //!        Once the capacity has been reached a PushBack will do a PopFront first (just like CircularFixedSizeBuffer).
+  class ChartDataWindowMinMax
+  {
+  public:
+    using value_type = uint32_t;
+    using size_type = std::size_t;
+
+  private:
+    struct Record
+    {
+      uint64_t Index{0};
+      value_type Value{0};
+    };
+
+    //! @brief A minimal double ended queue stored in a power of two sized ring buffer so wrapping is a simple mask operation.
+    class RecordQueue
+    {
+      std::vector<Record> m_records;
+      size_type m_mask{0};
+      size_type m_frontIndex{0};
+      size_type m_count{0};
+
+    public:
+      explicit RecordQueue(const size_type minCapacity);
+
+      bool Empty() const noexcept
+      {
+        return m_count == 0u;
+      }
+
+      size_type Size() const noexcept
+      {
+        return m_count;
+      }
+
+      const Record& Front() const noexcept
+      {
+        assert(m_count > 0u);
+        return m_records[m_frontIndex];
+      }
+
+      const Record& Back() const noexcept
+      {
+        assert(m_count > 0u);
+        return m_records[(m_frontIndex + m_count - 1u) & m_mask];
+      }
+
+      const Record& operator[](const size_type pos) const noexcept
+      {
+        assert(pos < m_count);
+        return m_records[(m_frontIndex + pos) & m_mask];
+      }
+
+      void Clear() noexcept
+      {
+        m_frontIndex = 0;
+        m_count = 0;
+      }
+
+      void PushBack(const uint64_t index, const value_type value) noexcept
+      {
+        assert(m_count < m_records.size());
+        m_records[(m_frontIndex + m_count) & m_mask] = Record{index, value};
+        ++m_count;
+      }
+
+      void PopBack() noexcept
+      {
+        assert(m_count > 0u);
+        --m_count;
+      }
+
+      void PopFront() noexcept
+      {
+        assert(m_count > 0u);
+        m_frontIndex = (m_frontIndex + 1u) & m_mask;
+        --m_count;
+      }
+
+      //! @brief Ensure that the queue can hold at least minCapacity records
+      void Reserve(const size_type minCapacity);
+    };
+
+    //! The values are strictly increasing from front to back
+    RecordQueue m_minQueue;
+    //! The values are strictly decreasing from front to back
+    RecordQueue m_maxQueue;
+    //! The index that will be assigned to the next value
+    uint64_t m_nextIndex{0};
+    //! The number of values in the window
+    size_type m_count{0};
+    //! The max number of values in the window
+    size_type m_capacity;
+
+  public:
+    explicit ChartDataWindowMinMax(const size_type capacity);
+
+    bool Empty() const noexcept
+    {
+      return m_count == 0u;
+    }
+
+    size_type Size() const noexcept
+    {
+      return m_count;
+    }
+
+    size_type Capacity() const noexcept
+    {
+      return m_capacity;
+    }
+
+    void Clear() noexcept;
+    void PushBack(const value_type value);
+    void PopFront() noexcept;
+    void Grow(const size_type growCapacityBy);
+    void ResizePopFront(const size_type newSize);
+
+    //! @brief Get the min max of all values in the window (returns 0,0 if empty)
+    MinMax<value_type> GetMinMax() const noexcept;
+
+    //! @brief Get the min max of the newest 'maxEntries' in the window (returns 0,0 if empty or maxEntries is zero)
+    MinMax<value_type> GetMinMax(const size_type maxEntries) const noexcept;
+  };
+}
+
+#endif
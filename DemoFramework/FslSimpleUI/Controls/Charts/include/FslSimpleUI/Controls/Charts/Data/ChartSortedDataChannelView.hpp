@@ -34,6 +34,9 @@
 #include <FslBase/BasicTypes.hpp>
 #include <FslBase/Math/MinMax.hpp>
 #include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/BoxPlotData.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartSortedValueTree.hpp>
+#include <deque>
 #include <memory>
 #include <vector>
 
@@ -42,6 +45,9 @@ namespace Fsl::UI
   class ChartDataView;
 
   /// <summary>
+  /// A sorted (low to high) view of one channel of a ChartDataView.
+  /// The sorted values are maintained incrementally, so each entry appended to (or evicted from) the view costs O(log n) instead of a
+  /// full resort of the view.
   /// </summary>
   class ChartSortedDataChannelView final
   {
@@ -50,6 +56,13 @@ namespace Fsl::UI
 
     mutable uint64_t m_cachedViewChangeId{0};
     mutable MinMax<uint32_t> m_cachedAxisRange;
+    //! The ChartDataView::AppendCount that m_cachedValues was last synchronized with
+    mutable uint64_t m_cachedAppendCount{0};
+    //! The channel values of the view in the order they were appended (so we know which value to erase once a entry is evicted)
+    mutable std::deque<uint32_t> m_cachedValues;
+    mutable ChartSortedValueTree m_cachedSortedValues;
+    //! m_cachedSortedData is only created on demand by GetChannelViewSpan
+    mutable bool m_cachedSortedDataIsValid{false};
     mutable std::vector<uint32_t> m_cachedSortedData;
 
   public:
@@ -72,8 +85,22 @@ namespace Fsl::UI
     }
 
     MinMax<uint32_t> GetAxisRange() const;
+
+    //! @brief Get the sorted values (low to high), accessing a value by rank is O(log n).
+    //! @note  The reference is valid until the next call to a method on this object.
+    const ChartSortedValueTree& GetSortedValues() const;
+
+    //! @brief Get a span of the sorted values (low to high).
+    //! @note  This creates a copy of all the values each time the view has changed, so prefer GetSortedValues, CalculateBoxPlot or
+    //!        CalculatePercentile for large views that change often.
     ReadOnlySpan<uint32_t> GetChannelViewSpan() const;
 
+    //! @brief Calculate the box plot of the view directly from the sorted values (requires at least BoxPlotHelper::MinimumEntries values)
+    BoxPlotData CalculateBoxPlot() const;
+
+    //! @brief Calculate the given percentile [0..1] of the view directly from the sorted values (requires at least one value)
+    double CalculatePercentile(const double percentile) const;
+
   private:
     void RefreshCacheIfNecessary() const;
   };
@@ -0,0 +1,142 @@
+#ifndef FSLSIMPLEUI_CONTROLS_CHARTS_DATA_CHARTSORTEDVALUETREE_HPP
+#define FSLSIMPLEUI_CONTROLS_CHARTS_DATA_CHARTSORTEDVALUETREE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <cassert>
+#include <limits>
+#include <vector>
+
+namespace Fsl::UI
+{
+  //! @brief A order statistic tree (a treap where every node knows the size of its sub tree) that stores a sorted multiset of values.
+  //!        - Insert and Erase are O(log n).
+  //!        - Accessing the value at a given rank in the sorted order (operator[]) is O(log n).
+  //!        Duplicated values are stored once with a count, so data with many equal samples stays compact.
+  //!        The nodes are stored in a pool so once the tree has grown to its working size no further allocations are done.
+  class ChartSortedValueTree
+  {
+  public:
+    using value_type = uint32_t;
+    using size_type = uint32_t;
+
+  private:
+    static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+    struct Node
+    {
+      value_type Value{0};
+      //! The number of times the value was inserted
+      uint32_t Count{0};
+      //! The total number of values in the sub tree (including this nodes Count)
+      uint32_t Size{0};
+      uint32_t Priority{0};
+      uint32_t Left{InvalidIndex};
+      uint32_t Right{InvalidIndex};
+    };
+
+    std::vector<Node> m_nodes;
+    uint32_t m_rootIndex{InvalidIndex};
+    //! Linked list of free nodes (linked using Node::Left)
+    uint32_t m_freeIndex{InvalidIndex};
+    uint32_t m_randomState{0x9E3779B9u};
+
+  public:
+    ChartSortedValueTree() = default;
+    ChartSortedValueTree(const ChartSortedValueTree&) = default;
+    ChartSortedValueTree& operator=(const ChartSortedValueTree&) = default;
+
+    // move assignment operator
+    ChartSortedValueTree& operator=(ChartSortedValueTree&& other) noexcept;
+
+    // move constructor
+    ChartSortedValueTree(ChartSortedValueTree&& other) noexcept;
+
+    bool empty() const noexcept
+    {
+      return m_rootIndex == InvalidIndex;
+    }
+
+    size_type size() const noexcept
+    {
+      return m_rootIndex != InvalidIndex ? m_nodes[m_rootIndex].Size : 0u;
+    }
+
+    void clear() noexcept;
+
+    void Insert(const value_type value);
+
+    //! @brief Erase one instance of the value
+    //! @return true if the value was found and erased
+    bool Erase(const value_type value) noexcept;
+
+    //! @brief Get the value at the given rank in the sorted order (low to high). O(log n)
+    value_type operator[](const size_type rank) const noexcept;
+
+    value_type front() const noexcept
+    {
+      assert(!empty());
+      return (*this)[0];
+    }
+
+    value_type back() const noexcept
+    {
+      assert(!empty());
+      return (*this)[size() - 1u];
+    }
+
+    //! @brief Copy all values in sorted order (low to high) to the vector, replacing its content.
+    void CopyTo(std::vector<value_type>& rDst) const;
+
+  private:
+    uint32_t AllocateNode(const value_type value);
+    void FreeNode(const uint32_t nodeIndex) noexcept;
+    uint32_t NodeSize(const uint32_t nodeIndex) const noexcept
+    {
+      return nodeIndex != InvalidIndex ? m_nodes[nodeIndex].Size : 0u;
+    }
+    void UpdateSize(const uint32_t nodeIndex) noexcept
+    {
+      Node& rNode = m_nodes[nodeIndex];
+      rNode.Size = NodeSize(rNode.Left) + rNode.Count + NodeSize(rNode.Right);
+    }
+    uint32_t RotateLeft(const uint32_t nodeIndex) noexcept;
+    uint32_t RotateRight(const uint32_t nodeIndex) noexcept;
+    uint32_t InsertNode(const uint32_t nodeIndex, const uint32_t newNodeIndex) noexcept;
+    uint32_t EraseNode(const uint32_t nodeIndex, const value_type value) noexcept;
+    uint32_t MergeNodes(const uint32_t leftIndex, const uint32_t rightIndex) noexcept;
+    uint32_t FindNode(const value_type value) const noexcept;
+    void AddToCountOnPath(const value_type value, const int32_t delta) noexcept;
+  };
+}
+
+#endif
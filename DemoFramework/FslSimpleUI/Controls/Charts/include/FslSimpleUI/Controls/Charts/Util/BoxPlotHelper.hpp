@@ -45,17 +45,17 @@ namespace Fsl::UI::BoxPlotHelper
   /// </summary>
   constexpr uint32_t MinimumEntries = 5;
 
-  //! @brief Calculate the median in a sorted span (low to high).
-  //! @param span a span of sorted values (sorting is expected to be low to high).
-  template <typename T>
-  inline double CalculateMedian(const ReadOnlySpan<T> span)
+  //! @brief Calculate the median of 'count' elements starting at 'offset' in a sorted container (low to high).
+  //! @param sorted a container of sorted values (sorting is expected to be low to high) that supports operator[] by rank.
+  //! @note  This works for spans but also for containers like ChartSortedValueTree where operator[] is not O(1).
+  template <typename TSorted>
+  inline double CalculateMedian(const TSorted& sorted, const std::size_t offset, const std::size_t count)
   {
-    // A median is found by arranging the numbers in the list in numerical order from low to high (this is what we expect to be in span)
-    // if the span.size() is odd -> take the two middle members and add together then divide by two
+    // A median is found by arranging the numbers in the list in numerical order from low to high (this is what we expect to be in sorted)
+    // if the count is odd -> take the two middle members and add together then divide by two
     //
 
-    assert(span.size() >= 2);
-    const auto size = span.size();
+    assert(count >= 2);
 
     // 2 | 0+1 | 2/2=1
     // 3 | 1   | 3/2=1
@@ -63,66 +63,117 @@ namespace Fsl::UI::BoxPlotHelper
     // 5 | 2   | 5/2=2
     // 6 | 2+3 | 6/2=3
     // 7 | 3   | 7/2=3
-    const auto halfSize = size / 2;
-    //                         even                                        : odd
-    return ((size & 1) == 0) ? (static_cast<double>((span[halfSize - 1] + span[halfSize])) / 2.0) : static_cast<double>(span[halfSize]);
+    const auto halfSize = count / 2;
+    //                          even                                                                             : odd
+    return ((count & 1) == 0) ? ((static_cast<double>(sorted[offset + halfSize - 1]) + static_cast<double>(sorted[offset + halfSize])) / 2.0)
+                              : static_cast<double>(sorted[offset + halfSize]);
   }
 
-  //! @brief Calculate the box plot data from a sorted span. (low to high)
+  //! @brief Calculate the median in a sorted span (low to high).
   //! @param span a span of sorted values (sorting is expected to be low to high).
   template <typename T>
-  inline BoxPlotData Calculate(const ReadOnlySpan<T> span)
+  inline double CalculateMedian(const ReadOnlySpan<T> span)
+  {
+    return CalculateMedian(span, 0, span.size());
+  }
+
+  //! @brief Calculate the given percentile of a sorted container (low to high) using linear interpolation between the closest ranks.
+  //! @param sorted a container of sorted values (sorting is expected to be low to high) that supports operator[] by rank and size().
+  //! @param percentile the percentile to calculate in the range [0..1] (values outside the range are clamped)
+  template <typename TSorted>
+  inline double CalculatePercentile(const TSorted& sorted, const double percentile)
   {
-    const auto size = span.size();
+    const std::size_t size = sorted.size();
+    if (size <= 0u)
+    {
+      throw NotSupportedException("we expect at least one entry");
+    }
+    const double clampedPercentile = percentile >= 0.0 ? (percentile <= 1.0 ? percentile : 1.0) : 0.0;
+    const double position = clampedPercentile * static_cast<double>(size - 1u);
+    const auto lowIndex = static_cast<std::size_t>(position);
+    if ((lowIndex + 1u) >= size)
+    {
+      return static_cast<double>(sorted[size - 1u]);
+    }
+    const double fraction = position - static_cast<double>(lowIndex);
+    const auto low = static_cast<double>(sorted[lowIndex]);
+    const auto high = static_cast<double>(sorted[lowIndex + 1u]);
+    return low + ((high - low) * fraction);
+  }
+
+  //! @brief Calculate the box plot data from a sorted container (low to high).
+  //! @param sorted a container of sorted values (sorting is expected to be low to high) that supports operator[] by rank and size().
+  //!               For example a ReadOnlySpan or a ChartSortedValueTree.
+  //! @note  Only O(log n) elements are accessed, so it stays cheap for containers where operator[] is O(log n).
+  template <typename TSorted>
+  inline BoxPlotData Calculate(const TSorted& sorted)
+  {
+    const std::size_t size = sorted.size();
     if (size < MinimumEntries)
     {
       throw NotSupportedException("we expect at least five entries");
     }
 
     // Find the median of the span
-    const auto q2 = CalculateMedian(span);
+    const auto q2 = CalculateMedian(sorted, 0, size);
 
     // create two equally size spans (split on the middle), if the original size was uneven we skip the middle number.
     // since we calc on integers this will be equal to half rounded down.
     const auto halfSize = size / 2;
 
     // find the median of the first half
-    const double q1 = CalculateMedian(span.subspan(0, halfSize));
+    const double q1 = CalculateMedian(sorted, 0, halfSize);
     // find the median of the second half
-    const double q3 = CalculateMedian(span.subspan(size - halfSize, halfSize));
+    const double q3 = CalculateMedian(sorted, size - halfSize, halfSize);
 
     assert(q1 <= q3);
     const double iqr = q3 - q1;
     const double lowerLimit = q1 - (1.5 * iqr);
     const double upperLimit = q3 + (1.5 * iqr);
 
-    // find the first element that is greater or equal from the beginning of the span
+    const auto front = static_cast<double>(sorted[0]);
+    const auto back = static_cast<double>(sorted[size - 1]);
+
+    // find the first element that is greater or equal to the lower limit (binary search)
     // We expect the search to always find a element in the list (due to the way the value we search for is calculated).
-    assert(span.back() >= lowerLimit);
-    auto min = lowerLimit;    // just to have a default value
-    for (std::size_t i = 0; i < span.size(); ++i)
+    assert(back >= lowerLimit);
+    std::size_t low = 0;
+    std::size_t high = size - 1;
+    while (low < high)
     {
-      min = span[i];
-      if (min >= lowerLimit)
+      const std::size_t mid = low + ((high - low) / 2);
+      if (static_cast<double>(sorted[mid]) < lowerLimit)
       {
-        break;
+        low = mid + 1;
+      }
+      else
+      {
+        high = mid;
       }
     }
+    const auto min = static_cast<double>(sorted[low]);
 
-    // find the last element that is less or equal from the end of the span
+    // find the last element that is less or equal to the upper limit (binary search)
     // We expect the search to always find a element in the list (due to the way the value we search for is calculated).
-    assert(span.front() <= upperLimit);
-    auto max = upperLimit;    // just to have a default value
-    for (std::size_t i = span.size(); i > 0; --i)
+    assert(front <= upperLimit);
+    low = 0;
+    high = size - 1;
+    while (low < high)
     {
-      max = span[i - 1];
-      if (max <= upperLimit)
+      const std::size_t mid = low + ((high - low + 1) / 2);
+      if (static_cast<double>(sorted[mid]) > upperLimit)
       {
-        break;
+        high = mid - 1;
+      }
+      else
+      {
+        low = mid;
       }
     }
-    return {static_cast<float>(span.front()), static_cast<float>(min), static_cast<float>(q1),         static_cast<float>(q2),
-            static_cast<float>(q3),           static_cast<float>(max), static_cast<float>(span.back())};
+    const auto max = static_cast<double>(sorted[low]);
+
+    return {static_cast<float>(front), static_cast<float>(min), static_cast<float>(q1),  static_cast<float>(q2),
+            static_cast<float>(q3),    static_cast<float>(max), static_cast<float>(back)};
   }
 }
 
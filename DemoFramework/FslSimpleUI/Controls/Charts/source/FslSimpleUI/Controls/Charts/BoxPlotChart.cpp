@@ -573,9 +573,8 @@ namespace Fsl::UI
         rDrawData.Clear();
         for (uint32_t i = 0; i < channels.size(); ++i)
         {
-          auto viewSpan = channels[i].GetChannelViewSpan();
-          assert(viewSpan.size() >= BoxPlotHelper::MinimumEntries);
-          auto boxPlot = BoxPlotHelper::Calculate(viewSpan);
+          assert(channels[i].GetSortedValues().size() >= BoxPlotHelper::MinimumEntries);
+          auto boxPlot = channels[i].CalculateBoxPlot();
           rDrawData.Add(boxPlot, colorConverter.Convert(pDataView->GetChannelMetaDataInfo(i).PrimaryColor));
         }
       }
@@ -57,6 +57,7 @@ namespace Fsl::UI
                        const Constraints constraints)
     : AChartData(dataBinding)
     , m_buffer(entries > 0 ? entries : 1u)
+    , m_windowMinMax(entries > 0 ? entries : 1u)
     , m_dataChannelCount(dataChannelCount)
     , m_constraints(constraints)
   {
@@ -75,41 +76,23 @@ namespace Fsl::UI
   void ChartData::Clear()
   {
     m_buffer.clear();
+    m_windowMinMax.Clear();
     MarkAsChanged();
     m_cachedDataStats = {};
-    m_viewInfo.Clear();
     UpdateCachedValues({});
   }
 
 
   void ChartData::Append(const ChartDataEntry& value)
   {
-    const auto currentValue = CalcSum(value, m_dataChannelCount);
-    if (!m_buffer.empty() && m_buffer.size() == m_buffer.capacity())
-    {
-      const bool canAffectMinCache = currentValue > m_viewInfo.CurrentMin;
-      const bool canAffectMaxCache = currentValue < m_viewInfo.CurrentMax;
-      if (canAffectMinCache || canAffectMaxCache)
-      {
-        const auto frontValue = CalcSum(m_buffer.front(), m_dataChannelCount);
-        if (frontValue <= m_viewInfo.CurrentMin || frontValue >= m_viewInfo.CurrentMax)
-        {
-          m_buffer.pop_front();
-          m_viewInfo.SetMinMax(CalculateMinMax());
-        }
-      }
-    }
-
-    if (m_buffer.empty())
-    {
-      // As the buffer was empty, the current value becomes the min max
-      m_viewInfo.SetMinMax(MinMax<value_type>(currentValue, currentValue));
-    }
-
+    // Both buffers have the same capacity so they evict the same front entry when full
     m_buffer.push_back(value);
+    m_windowMinMax.PushBack(CalcSum(value, m_dataChannelCount));
+    ++m_appendCount;
+    assert(m_windowMinMax.Size() == m_buffer.size());
     MarkAsChanged();
 
-    UpdateCachedValues(MinMax<value_type>(std::min(m_viewInfo.CurrentMin, currentValue), std::max(m_viewInfo.CurrentMax, currentValue)));
+    UpdateCachedValues(m_windowMinMax.GetMinMax());
   }
 
 
@@ -150,13 +133,15 @@ namespace Fsl::UI
     if (newCapacity < m_buffer.capacity())
     {
       m_buffer.resize_pop_front(newCapacity);
-      auto newMinMax = CalculateMinMax();
-      UpdateCachedValues(newMinMax);
+      m_windowMinMax.ResizePopFront(newCapacity);
+      UpdateCachedValues(m_windowMinMax.GetMinMax());
       MarkAsChanged();
     }
     else if (newCapacity > m_buffer.capacity())
     {
-      m_buffer.grow(newCapacity);
+      const auto growBy = newCapacity - m_buffer.capacity();
+      m_buffer.grow(growBy);
+      m_windowMinMax.Grow(growBy);
     }
   }
 
@@ -228,7 +213,7 @@ namespace Fsl::UI
       return m_cachedDataStats;
     }
     // This view shows less entries than we have cached stats for so we need to calculate some custom stats for the view.
-    auto minMax = ApplyConstraints(CalculateMinMax(viewConfig.MaxEntries));
+    auto minMax = ApplyConstraints(m_windowMinMax.GetMinMax(viewConfig.MaxEntries));
     return ChartDataStats(minMax);
   }
 
@@ -342,70 +327,10 @@ namespace Fsl::UI
   void ChartData::UpdateCachedValues(const MinMax<value_type> minMax)
   {
     auto constrainedMinMax = ApplyConstraints(minMax);
-    m_viewInfo.SetMinMax(constrainedMinMax);
     m_cachedDataStats.ValueMinMax = constrainedMinMax;
   }
 
 
-  MinMax<ChartData::value_type> ChartData::CalculateMinMax() const noexcept
-  {
-    if (m_buffer.empty())
-    {
-      return MinMax<value_type>(0, 0);
-    }
-
-    value_type min = std::numeric_limits<value_type>::max();
-    value_type max = std::numeric_limits<value_type>::min();
-    for (uint32_t segmentIndex = 0; segmentIndex < m_buffer.segment_count(); ++segmentIndex)
-    {
-      auto span = m_buffer.AsReadOnlySpan(segmentIndex);
-      assert(span.size() > 0);
-      auto minMax = CalcSpanMinMax(span, m_dataChannelCount, min, max);
-      min = minMax.Min();
-      max = minMax.Max();
-    }
-    return MinMax<value_type>(min, max);
-  }
-
-
-  MinMax<ChartData::value_type> ChartData::CalculateMinMax(const uint32_t maxEntries) const noexcept
-  {
-    if (m_buffer.empty() || maxEntries <= 0)
-    {
-      return MinMax<value_type>(0, 0);
-    }
-    if (maxEntries >= m_buffer.size())
-    {
-      return CalculateMinMax();
-    }
-
-    // We only expect there to ever be 0,1 or two segments, and we already check for zero.
-    assert(m_buffer.segment_count() == 1u || m_buffer.segment_count() == 2u);
-
-    value_type min = std::numeric_limits<value_type>::max();
-    value_type max = std::numeric_limits<value_type>::min();
-
-    uint32_t entriesLeft = maxEntries;
-    uint32_t segmentIndex = m_buffer.segment_count();
-    while (segmentIndex > 0 && entriesLeft > 0)
-    {
-      --segmentIndex;
-      auto span = m_buffer.AsReadOnlySpan(segmentIndex);
-      if (entriesLeft < span.size())
-      {
-        span = span.unchecked_subspan(span.size() - entriesLeft, entriesLeft);
-      }
-      assert(span.size() > 0);
-      auto minMax = CalcSpanMinMax(span, m_dataChannelCount, min, max);
-      assert(entriesLeft >= span.size());
-      entriesLeft -= UncheckedNumericCast<uint32_t>(span.size());
-      min = minMax.Min();
-      max = minMax.Max();
-    }
-    return MinMax<value_type>(min, max);
-  }
-
-
   MinMax<ChartData::value_type> ChartData::ApplyConstraints(const MinMax<value_type> minMax) const
   {
     auto min = minMax.Min();
@@ -423,25 +348,6 @@ namespace Fsl::UI
   }
 
 
-  MinMax<ChartData::value_type> ChartData::CalcSpanMinMax(ReadOnlySpan<ChartDataEntry> span, const uint32_t dataEntries, value_type min,
-                                                          value_type max) noexcept
-  {
-    for (std::size_t i = 0; i < span.size(); ++i)
-    {
-      const value_type val = CalcSum(span[i], dataEntries);
-      if (val < min)
-      {
-        min = val;
-      }
-      if (val > max)
-      {
-        max = val;
-      }
-    }
-    return MinMax<value_type>(min, max);
-  }
-
-
   ChartData::value_type ChartData::CalcSum(const ChartDataEntry& entry, const uint32_t dataEntries) noexcept
   {
     static_assert(std::tuple_size<ChartDataEntry::array_type>() <= 0xFFFFFFFF, "array size assumption failed");
@@ -86,6 +86,13 @@ namespace Fsl::UI
     return (dataChangeId | (viewChangeId << 32));
   }
 
+
+  uint64_t ChartDataView::AppendCount() const noexcept
+  {
+    return m_chartData->AppendCount();
+  }
+
+
   void ChartDataView::ClearCustomMinMax()
   {
     if (m_customViewMinMax.has_value())
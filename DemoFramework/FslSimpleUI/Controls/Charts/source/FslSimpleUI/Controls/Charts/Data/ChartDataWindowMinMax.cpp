@@ -0,0 +1,209 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataWindowMinMax.hpp>
+#include <stdexcept>
+
+namespace Fsl::UI
+{
+  namespace
+  {
+    //! Find the first entry in the queue with a index greater or equal to firstIndex.
+    //! The queue is sorted by index and must contain at least one entry with a index >= firstIndex.
+    template <typename TQueue>
+    std::size_t FindFirst(const TQueue& queue, const uint64_t firstIndex) noexcept
+    {
+      assert(!queue.Empty());
+      assert(queue.Back().Index >= firstIndex);
+      std::size_t low = 0;
+      std::size_t high = queue.Size() - 1u;
+      while (low < high)
+      {
+        const std::size_t mid = low + ((high - low) / 2u);
+        if (queue[mid].Index < firstIndex)
+        {
+          low = mid + 1u;
+        }
+        else
+        {
+          high = mid;
+        }
+      }
+      return low;
+    }
+
+    std::size_t CalcRingCapacity(const std::size_t minCapacity) noexcept
+    {
+      std::size_t capacity = 1u;
+      while (capacity < minCapacity)
+      {
+        capacity <<= 1u;
+      }
+      return capacity;
+    }
+  }
+
+
+  ChartDataWindowMinMax::RecordQueue::RecordQueue(const size_type minCapacity)
+    : m_records(CalcRingCapacity(minCapacity))
+    , m_mask(m_records.size() - 1u)
+  {
+  }
+
+
+  void ChartDataWindowMinMax::RecordQueue::Reserve(const size_type minCapacity)
+  {
+    const auto newCapacity = CalcRingCapacity(minCapacity);
+    if (newCapacity <= m_records.size())
+    {
+      return;
+    }
+    std::vector<Record> newRecords(newCapacity);
+    for (size_type i = 0; i < m_count; ++i)
+    {
+      newRecords[i] = (*this)[i];
+    }
+    m_records = std::move(newRecords);
+    m_mask = newCapacity - 1u;
+    m_frontIndex = 0;
+  }
+
+
+  ChartDataWindowMinMax::ChartDataWindowMinMax(const size_type capacity)
+    : m_minQueue(capacity)
+    , m_maxQueue(capacity)
+    , m_capacity(capacity)
+  {
+    if (capacity <= 0u)
+    {
+      throw std::invalid_argument("capacity must be greater than zero");
+    }
+  }
+
+
+  void ChartDataWindowMinMax::Clear() noexcept
+  {
+    m_minQueue.Clear();
+    m_maxQueue.Clear();
+    m_count = 0;
+  }
+
+
+  void ChartDataWindowMinMax::PushBack(const value_type value)
+  {
+    if (m_count >= m_capacity)
+    {
+      PopFront();
+    }
+
+    // Any older value that is not smaller than the new value can never be the min of a window that contains the new value
+    while (!m_minQueue.Empty() && m_minQueue.Back().Value >= value)
+    {
+      m_minQueue.PopBack();
+    }
+    // Any older value that is not larger than the new value can never be the max of a window that contains the new value
+    while (!m_maxQueue.Empty() && m_maxQueue.Back().Value <= value)
+    {
+      m_maxQueue.PopBack();
+    }
+    m_minQueue.PushBack(m_nextIndex, value);
+    m_maxQueue.PushBack(m_nextIndex, value);
+    ++m_nextIndex;
+    ++m_count;
+  }
+
+
+  void ChartDataWindowMinMax::PopFront() noexcept
+  {
+    assert(m_count > 0u);
+    const uint64_t frontIndex = m_nextIndex - m_count;
+    if (!m_minQueue.Empty() && m_minQueue.Front().Index == frontIndex)
+    {
+      m_minQueue.PopFront();
+    }
+    if (!m_maxQueue.Empty() && m_maxQueue.Front().Index == frontIndex)
+    {
+      m_maxQueue.PopFront();
+    }
+    --m_count;
+  }
+
+
+  void ChartDataWindowMinMax::Grow(const size_type growCapacityBy)
+  {
+    m_capacity += growCapacityBy;
+    m_minQueue.Reserve(m_capacity);
+    m_maxQueue.Reserve(m_capacity);
+  }
+
+
+  void ChartDataWindowMinMax::ResizePopFront(const size_type newSize)
+  {
+    if (newSize <= 0u)
+    {
+      throw std::invalid_argument("newSize must be greater than zero");
+    }
+    while (m_count > newSize)
+    {
+      PopFront();
+    }
+    // The queues never contain more entries than the window, so we only need to ensure they can hold the new window.
+    // Shrinking the window keeps the existing ring storage.
+    m_capacity = newSize;
+    m_minQueue.Reserve(m_capacity);
+    m_maxQueue.Reserve(m_capacity);
+  }
+
+
+  MinMax<ChartDataWindowMinMax::value_type> ChartDataWindowMinMax::GetMinMax() const noexcept
+  {
+    if (m_count <= 0u)
+    {
+      return MinMax<value_type>(0, 0);
+    }
+    return MinMax<value_type>(m_minQueue.Front().Value, m_maxQueue.Front().Value);
+  }
+
+
+  MinMax<ChartDataWindowMinMax::value_type> ChartDataWindowMinMax::GetMinMax(const size_type maxEntries) const noexcept
+  {
+    if (m_count <= 0u || maxEntries <= 0u)
+    {
+      return MinMax<value_type>(0, 0);
+    }
+    if (maxEntries >= m_count)
+    {
+      return GetMinMax();
+    }
+    const uint64_t firstIndex = m_nextIndex - maxEntries;
+    return MinMax<value_type>(m_minQueue[FindFirst(m_minQueue, firstIndex)].Value, m_maxQueue[FindFirst(m_maxQueue, firstIndex)].Value);
+  }
+}
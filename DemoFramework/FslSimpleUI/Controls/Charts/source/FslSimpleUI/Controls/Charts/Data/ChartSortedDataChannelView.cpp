@@ -33,8 +33,8 @@
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataEntry.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataView.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartSortedDataChannelView.hpp>
-#include <algorithm>
-#include <limits>
+#include <FslSimpleUI/Controls/Charts/Util/BoxPlotHelper.hpp>
+#include <cassert>
 #include <utility>
 
 namespace Fsl::UI
@@ -49,12 +49,19 @@ namespace Fsl::UI
       m_dataChannelIndex = other.m_dataChannelIndex;
       m_cachedViewChangeId = other.m_cachedViewChangeId;
       m_cachedAxisRange = other.m_cachedAxisRange;
+      m_cachedAppendCount = other.m_cachedAppendCount;
+      m_cachedValues = std::move(other.m_cachedValues);
+      m_cachedSortedValues = std::move(other.m_cachedSortedValues);
+      m_cachedSortedDataIsValid = other.m_cachedSortedDataIsValid;
       m_cachedSortedData = std::move(other.m_cachedSortedData);
 
       // Remove the data from other
       other.m_dataChannelIndex = 0;
       other.m_cachedViewChangeId = 0;
       other.m_cachedAxisRange = {};
+      other.m_cachedAppendCount = 0;
+      other.m_cachedValues.clear();
+      other.m_cachedSortedDataIsValid = false;
     }
     return *this;
   }
@@ -65,12 +72,19 @@ namespace Fsl::UI
     , m_dataChannelIndex(other.m_dataChannelIndex)
     , m_cachedViewChangeId(other.m_cachedViewChangeId)
     , m_cachedAxisRange(other.m_cachedAxisRange)
+    , m_cachedAppendCount(other.m_cachedAppendCount)
+    , m_cachedValues(std::move(other.m_cachedValues))
+    , m_cachedSortedValues(std::move(other.m_cachedSortedValues))
+    , m_cachedSortedDataIsValid(other.m_cachedSortedDataIsValid)
     , m_cachedSortedData(std::move(other.m_cachedSortedData))
   {
     // Remove the data from other
     other.m_dataChannelIndex = 0;
     other.m_cachedViewChangeId = 0;
     other.m_cachedAxisRange = {};
+    other.m_cachedAppendCount = 0;
+    other.m_cachedValues.clear();
+    other.m_cachedSortedDataIsValid = false;
   }
 
 
@@ -94,13 +108,39 @@ namespace Fsl::UI
   ChartSortedDataChannelView::~ChartSortedDataChannelView() = default;
 
 
+  const ChartSortedValueTree& ChartSortedDataChannelView::GetSortedValues() const
+  {
+    RefreshCacheIfNecessary();
+    return m_cachedSortedValues;
+  }
+
+
   ReadOnlySpan<uint32_t> ChartSortedDataChannelView::GetChannelViewSpan() const
   {
     RefreshCacheIfNecessary();
+    if (!m_cachedSortedDataIsValid)
+    {
+      m_cachedSortedValues.CopyTo(m_cachedSortedData);
+      m_cachedSortedDataIsValid = true;
+    }
     return SpanUtil::AsReadOnlySpan(m_cachedSortedData);
   }
 
 
+  BoxPlotData ChartSortedDataChannelView::CalculateBoxPlot() const
+  {
+    RefreshCacheIfNecessary();
+    return BoxPlotHelper::Calculate(m_cachedSortedValues);
+  }
+
+
+  double ChartSortedDataChannelView::CalculatePercentile(const double percentile) const
+  {
+    RefreshCacheIfNecessary();
+    return BoxPlotHelper::CalculatePercentile(m_cachedSortedValues, percentile);
+  }
+
+
   MinMax<uint32_t> ChartSortedDataChannelView::GetAxisRange() const
   {
     RefreshCacheIfNecessary();
@@ -113,39 +153,64 @@ namespace Fsl::UI
     const ChartDataView* pDataView = m_dataView.get();
     assert(pDataView != nullptr);
     auto currentViewChangeId = m_dataView->ChangeId();
-    if (currentViewChangeId != m_cachedViewChangeId)
+    if (currentViewChangeId == m_cachedViewChangeId)
     {
-      // Resort the view data
-      m_cachedViewChangeId = currentViewChangeId;
-
-      const auto dataInfo = pDataView->DataInfo();
+      return;
+    }
+    m_cachedViewChangeId = currentViewChangeId;
+    m_cachedSortedDataIsValid = false;
+
+    const auto dataInfo = pDataView->DataInfo();
+    // The view contains the entries that was appended as number [firstIndex, appendCount)
+    const uint64_t appendCount = pDataView->AppendCount();
+    const uint64_t viewCount = dataInfo.TotalElementCount;
+    assert(viewCount <= appendCount);
+    const uint64_t firstIndex = appendCount - viewCount;
+    const uint64_t cachedFirstIndex = m_cachedAppendCount - m_cachedValues.size();
+
+    if (appendCount < m_cachedAppendCount || firstIndex < cachedFirstIndex || firstIndex >= m_cachedAppendCount)
+    {
+      // The view grew to include older entries or none of the cached entries are part of the view anymore, so start from scratch.
+      m_cachedValues.clear();
+      m_cachedSortedValues.clear();
+      m_cachedAppendCount = firstIndex;
+    }
+    else
+    {
+      // Evict the entries that are no longer part of the view
+      for (uint64_t i = cachedFirstIndex; i < firstIndex; ++i)
+      {
+        [[maybe_unused]] const bool erased = m_cachedSortedValues.Erase(m_cachedValues.front());
+        assert(erased);
+        m_cachedValues.pop_front();
+      }
+    }
 
-      m_cachedSortedData.clear();
-      m_cachedSortedData.reserve(dataInfo.TotalElementCount);
-      if (dataInfo.SegmentCount > 0)
+    // Insert the entries appended since the last refresh, they are the newest entries of the view
+    const uint64_t newEntryCount = appendCount - m_cachedAppendCount;
+    assert(newEntryCount <= viewCount);
+    uint64_t entriesToSkip = viewCount - newEntryCount;
+    for (uint32_t segmentIndex = 0; segmentIndex < dataInfo.SegmentCount; ++segmentIndex)
+    {
+      const auto span = pDataView->SegmentDataAsReadOnlySpan(segmentIndex);
+      if (entriesToSkip >= span.size())
       {
-        auto min = std::numeric_limits<uint32_t>::max();
-        auto max = std::numeric_limits<uint32_t>::min();
-        // Insert all the elements from the view into our cached sorted list (low to high)
-        for (uint32_t segmentIndex = 0; segmentIndex < dataInfo.SegmentCount; ++segmentIndex)
-        {
-          const auto span = pDataView->SegmentDataAsReadOnlySpan(segmentIndex);
-          for (uint32_t spanIndex = 0; spanIndex < span.size(); ++spanIndex)
-          {
-            const auto newValue = span[spanIndex].Values[m_dataChannelIndex];
-            m_cachedSortedData.insert(std::lower_bound(m_cachedSortedData.begin(), m_cachedSortedData.end(), newValue), newValue);
-            min = min <= newValue ? min : newValue;
-            max = max >= newValue ? max : newValue;
-          }
-        }
-        assert(min <= max);
-        m_cachedAxisRange = MinMax<uint32_t>(min, max);
+        entriesToSkip -= span.size();
+        continue;
       }
-      else
+      for (std::size_t spanIndex = static_cast<std::size_t>(entriesToSkip); spanIndex < span.size(); ++spanIndex)
       {
-        m_cachedAxisRange = {};
+        const auto newValue = span[spanIndex].Values[m_dataChannelIndex];
+        m_cachedValues.push_back(newValue);
+        m_cachedSortedValues.Insert(newValue);
       }
+      entriesToSkip = 0;
     }
-  }
+    m_cachedAppendCount = appendCount;
+    assert(m_cachedValues.size() == viewCount);
+    assert(m_cachedSortedValues.size() == viewCount);
 
+    m_cachedAxisRange =
+      !m_cachedSortedValues.empty() ? MinMax<uint32_t>(m_cachedSortedValues.front(), m_cachedSortedValues.back()) : MinMax<uint32_t>();
+  }
 }
@@ -0,0 +1,336 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslSimpleUI/Controls/Charts/Data/ChartSortedValueTree.hpp>
+#include <stdexcept>
+#include <utility>
+
+namespace Fsl::UI
+{
+  // move assignment operator
+  ChartSortedValueTree& ChartSortedValueTree::operator=(ChartSortedValueTree&& other) noexcept
+  {
+    if (this != &other)
+    {
+      // Claim ownership here
+      m_nodes = std::move(other.m_nodes);
+      m_rootIndex = other.m_rootIndex;
+      m_freeIndex = other.m_freeIndex;
+      m_randomState = other.m_randomState;
+
+      // Remove the data from other
+      other.m_nodes.clear();
+      other.m_rootIndex = InvalidIndex;
+      other.m_freeIndex = InvalidIndex;
+    }
+    return *this;
+  }
+
+  // move constructor
+  ChartSortedValueTree::ChartSortedValueTree(ChartSortedValueTree&& other) noexcept
+    : m_nodes(std::move(other.m_nodes))
+    , m_rootIndex(other.m_rootIndex)
+    , m_freeIndex(other.m_freeIndex)
+    , m_randomState(other.m_randomState)
+  {
+    // Remove the data from other
+    other.m_nodes.clear();
+    other.m_rootIndex = InvalidIndex;
+    other.m_freeIndex = InvalidIndex;
+  }
+
+
+  void ChartSortedValueTree::clear() noexcept
+  {
+    m_nodes.clear();
+    m_rootIndex = InvalidIndex;
+    m_freeIndex = InvalidIndex;
+  }
+
+
+  void ChartSortedValueTree::Insert(const value_type value)
+  {
+    if (FindNode(value) != InvalidIndex)
+    {
+      // The value already exist, so we just need to increase its count (no structural change)
+      AddToCountOnPath(value, 1);
+      return;
+    }
+    if (size() >= std::numeric_limits<size_type>::max())
+    {
+      throw std::overflow_error("ChartSortedValueTree capacity exceeded");
+    }
+    const uint32_t newNodeIndex = AllocateNode(value);
+    m_rootIndex = InsertNode(m_rootIndex, newNodeIndex);
+  }
+
+
+  bool ChartSortedValueTree::Erase(const value_type value) noexcept
+  {
+    const uint32_t nodeIndex = FindNode(value);
+    if (nodeIndex == InvalidIndex)
+    {
+      return false;
+    }
+    if (m_nodes[nodeIndex].Count > 1u)
+    {
+      AddToCountOnPath(value, -1);
+    }
+    else
+    {
+      m_rootIndex = EraseNode(m_rootIndex, value);
+    }
+    return true;
+  }
+
+
+  ChartSortedValueTree::value_type ChartSortedValueTree::operator[](const size_type rank) const noexcept
+  {
+    assert(rank < size());
+    size_type remaining = rank;
+    uint32_t nodeIndex = m_rootIndex;
+    while (nodeIndex != InvalidIndex)
+    {
+      const Node& node = m_nodes[nodeIndex];
+      const uint32_t leftSize = NodeSize(node.Left);
+      if (remaining < leftSize)
+      {
+        nodeIndex = node.Left;
+      }
+      else if (remaining < (leftSize + node.Count))
+      {
+        return node.Value;
+      }
+      else
+      {
+        remaining -= leftSize + node.Count;
+        nodeIndex = node.Right;
+      }
+    }
+    assert(false);
+    return 0;
+  }
+
+
+  void ChartSortedValueTree::CopyTo(std::vector<value_type>& rDst) const
+  {
+    rDst.clear();
+    rDst.reserve(size());
+
+    // Iterative in order traversal
+    std::vector<uint32_t> stack;
+    uint32_t nodeIndex = m_rootIndex;
+    while (nodeIndex != InvalidIndex || !stack.empty())
+    {
+      while (nodeIndex != InvalidIndex)
+      {
+        stack.push_back(nodeIndex);
+        nodeIndex = m_nodes[nodeIndex].Left;
+      }
+      nodeIndex = stack.back();
+      stack.pop_back();
+      const Node& node = m_nodes[nodeIndex];
+      rDst.insert(rDst.end(), node.Count, node.Value);
+      nodeIndex = node.Right;
+    }
+  }
+
+
+  uint32_t ChartSortedValueTree::AllocateNode(const value_type value)
+  {
+    // xorshift32
+    m_randomState ^= m_randomState << 13;
+    m_randomState ^= m_randomState >> 17;
+    m_randomState ^= m_randomState << 5;
+
+    uint32_t nodeIndex = m_freeIndex;
+    if (nodeIndex != InvalidIndex)
+    {
+      m_freeIndex = m_nodes[nodeIndex].Left;
+    }
+    else
+    {
+      if (m_nodes.size() >= InvalidIndex)
+      {
+        throw std::overflow_error("ChartSortedValueTree capacity exceeded");
+      }
+      nodeIndex = static_cast<uint32_t>(m_nodes.size());
+      m_nodes.emplace_back();
+    }
+    Node& rNode = m_nodes[nodeIndex];
+    rNode.Value = value;
+    rNode.Count = 1;
+    rNode.Size = 1;
+    rNode.Priority = m_randomState;
+    rNode.Left = InvalidIndex;
+    rNode.Right = InvalidIndex;
+    return nodeIndex;
+  }
+
+
+  void ChartSortedValueTree::FreeNode(const uint32_t nodeIndex) noexcept
+  {
+    Node& rNode = m_nodes[nodeIndex];
+    rNode.Count = 0;
+    rNode.Size = 0;
+    rNode.Right = InvalidIndex;
+    rNode.Left = m_freeIndex;
+    m_freeIndex = nodeIndex;
+  }
+
+
+  uint32_t ChartSortedValueTree::RotateLeft(const uint32_t nodeIndex) noexcept
+  {
+    const uint32_t rightIndex = m_nodes[nodeIndex].Right;
+    m_nodes[nodeIndex].Right = m_nodes[rightIndex].Left;
+    m_nodes[rightIndex].Left = nodeIndex;
+    UpdateSize(nodeIndex);
+    UpdateSize(rightIndex);
+    return rightIndex;
+  }
+
+
+  uint32_t ChartSortedValueTree::RotateRight(const uint32_t nodeIndex) noexcept
+  {
+    const uint32_t leftIndex = m_nodes[nodeIndex].Left;
+    m_nodes[nodeIndex].Left = m_nodes[leftIndex].Right;
+    m_nodes[leftIndex].Right = nodeIndex;
+    UpdateSize(nodeIndex);
+    UpdateSize(leftIndex);
+    return leftIndex;
+  }
+
+
+  uint32_t ChartSortedValueTree::InsertNode(const uint32_t nodeIndex, const uint32_t newNodeIndex) noexcept
+  {
+    if (nodeIndex == InvalidIndex)
+    {
+      return newNodeIndex;
+    }
+    // Duplicates are handled by Insert, so the value is never equal to the node value here
+    assert(m_nodes[newNodeIndex].Value != m_nodes[nodeIndex].Value);
+    if (m_nodes[newNodeIndex].Value < m_nodes[nodeIndex].Value)
+    {
+      const uint32_t leftIndex = InsertNode(m_nodes[nodeIndex].Left, newNodeIndex);
+      m_nodes[nodeIndex].Left = leftIndex;
+      if (m_nodes[leftIndex].Priority > m_nodes[nodeIndex].Priority)
+      {
+        return RotateRight(nodeIndex);
+      }
+    }
+    else
+    {
+      const uint32_t rightIndex = InsertNode(m_nodes[nodeIndex].Right, newNodeIndex);
+      m_nodes[nodeIndex].Right = rightIndex;
+      if (m_nodes[rightIndex].Priority > m_nodes[nodeIndex].Priority)
+      {
+        return RotateLeft(nodeIndex);
+      }
+    }
+    UpdateSize(nodeIndex);
+    return nodeIndex;
+  }
+
+
+  uint32_t ChartSortedValueTree::EraseNode(const uint32_t nodeIndex, const value_type value) noexcept
+  {
+    assert(nodeIndex != InvalidIndex);
+    if (value < m_nodes[nodeIndex].Value)
+    {
+      m_nodes[nodeIndex].Left = EraseNode(m_nodes[nodeIndex].Left, value);
+    }
+    else if (value > m_nodes[nodeIndex].Value)
+    {
+      m_nodes[nodeIndex].Right = EraseNode(m_nodes[nodeIndex].Right, value);
+    }
+    else
+    {
+      const uint32_t mergedIndex = MergeNodes(m_nodes[nodeIndex].Left, m_nodes[nodeIndex].Right);
+      FreeNode(nodeIndex);
+      return mergedIndex;
+    }
+    UpdateSize(nodeIndex);
+    return nodeIndex;
+  }
+
+
+  uint32_t ChartSortedValueTree::MergeNodes(const uint32_t leftIndex, const uint32_t rightIndex) noexcept
+  {
+    // All values in the left tree are less than the values in the right tree
+    if (leftIndex == InvalidIndex)
+    {
+      return rightIndex;
+    }
+    if (rightIndex == InvalidIndex)
+    {
+      return leftIndex;
+    }
+    if (m_nodes[leftIndex].Priority > m_nodes[rightIndex].Priority)
+    {
+      m_nodes[leftIndex].Right = MergeNodes(m_nodes[leftIndex].Right, rightIndex);
+      UpdateSize(leftIndex);
+      return leftIndex;
+    }
+    m_nodes[rightIndex].Left = MergeNodes(leftIndex, m_nodes[rightIndex].Left);
+    UpdateSize(rightIndex);
+    return rightIndex;
+  }
+
+
+  uint32_t ChartSortedValueTree::FindNode(const value_type value) const noexcept
+  {
+    uint32_t nodeIndex = m_rootIndex;
+    while (nodeIndex != InvalidIndex && m_nodes[nodeIndex].Value != value)
+    {
+      nodeIndex = value < m_nodes[nodeIndex].Value ? m_nodes[nodeIndex].Left : m_nodes[nodeIndex].Right;
+    }
+    return nodeIndex;
+  }
+
+
+  void ChartSortedValueTree::AddToCountOnPath(const value_type value, const int32_t delta) noexcept
+  {
+    // The value is expected to exist in the tree
+    uint32_t nodeIndex = m_rootIndex;
+    while (nodeIndex != InvalidIndex)
+    {
+      Node& rNode = m_nodes[nodeIndex];
+      rNode.Size = static_cast<uint32_t>(static_cast<int64_t>(rNode.Size) + delta);
+      if (rNode.Value == value)
+      {
+        rNode.Count = static_cast<uint32_t>(static_cast<int64_t>(rNode.Count) + delta);
+        return;
+      }
+      nodeIndex = value < rNode.Value ? rNode.Left : rNode.Right;
+    }
+    assert(false);
+  }
+}
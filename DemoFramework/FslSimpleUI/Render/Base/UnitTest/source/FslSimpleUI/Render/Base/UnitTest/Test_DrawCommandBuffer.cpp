@@ -0,0 +1,247 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Math/Pixel/LogPxAreaRectangleF.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslSimpleUI/Render/Base/DrawCommandBufferEx.hpp>
+#include <memory>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestDrawCommandBuffer = TestFixtureFslBase;
+
+  class TestCustomDrawData final : public UI::ICustomDrawData
+  {
+  };
+
+  void DrawCustomImage(UI::UIRawMeshBuilder2D& /*rBuilder*/, const PxVector2 /*dstPositionPxf*/, const PxSize2D /*dstSizePx*/,
+                       const UI::DrawClipContext& /*clipContext*/, const RenderBasicImageInfo& /*renderInfo*/,
+                       const UI::ICustomDrawData* const /*pCustomData*/)
+  {
+  }
+
+  void DrawCustomText(UI::ScopedCustomUITextMeshBuilder2D& /*rBuilder*/, const PxVector2 /*dstPositionPxf*/, const PxSize2D /*dstSizePx*/,
+                      const UI::ICustomDrawData* const /*pCustomData*/)
+  {
+  }
+
+  const UI::MeshHandle g_hMesh(1);
+  const UI::UIRenderColor g_color(UI::UIRenderColor::CreateR8G8B8A8UNorm(255, 255, 255, 255));
+  const PxSize2D g_sizePx(PxSize2D::Create(10, 10));
+
+  const UI::DrawClipContext g_noClip;
+  const UI::DrawClipContext g_clipA(true, PxAreaRectangleF::Create(0, 0, 100, 100));
+  const UI::DrawClipContext g_clipB(true, PxAreaRectangleF::Create(10, 10, 50, 50));
+
+  void Draw(UI::DrawCommandBuffer& rBuffer, const int32_t x, const UI::DrawClipContext& clipContext)
+  {
+    rBuffer.Draw(g_hMesh, PxVector2::Create(static_cast<float>(x), 0), g_sizePx, g_color, clipContext);
+  }
+
+  //! Check that the two buffers contain the same commands, params and tables
+  void ExpectEqual(const UI::DrawCommandBufferEx& expected, const UI::DrawCommandBufferEx& actual)
+  {
+    const ReadOnlySpan<UI::EncodedCommand> expectedCommands = expected.AsReadOnlySpan();
+    const ReadOnlySpan<UI::EncodedCommand> actualCommands = actual.AsReadOnlySpan();
+    ASSERT_EQ(expectedCommands.size(), actualCommands.size());
+    for (std::size_t i = 0; i < expectedCommands.size(); ++i)
+    {
+      EXPECT_TRUE(expectedCommands[i] == actualCommands[i]);
+      EXPECT_TRUE(expected.AsReadOnlyParamsSpan()[i] == actual.AsReadOnlyParamsSpan()[i]);
+    }
+    const ReadOnlySpan<PxAreaRectangleF> expectedClip = expected.AsReadOnlyClipRectangleSpan();
+    const ReadOnlySpan<PxAreaRectangleF> actualClip = actual.AsReadOnlyClipRectangleSpan();
+    ASSERT_EQ(expectedClip.size(), actualClip.size());
+    for (std::size_t i = 0; i < expectedClip.size(); ++i)
+    {
+      EXPECT_EQ(expectedClip[i], actualClip[i]);
+    }
+  }
+}
+
+
+TEST(TestDrawCommandBuffer, Construct)
+{
+  UI::DrawCommandBufferEx buffer;
+
+  EXPECT_EQ(0u, buffer.Count());
+  EXPECT_EQ(0u, buffer.AsReadOnlyClipRectangleSpan().size());
+}
+
+
+TEST(TestDrawCommandBuffer, AddClipRectangle_ConsecutiveEqualShareEntry)
+{
+  UI::DrawCommandBufferEx buffer;
+
+  Draw(buffer, 0, g_clipA);
+  Draw(buffer, 1, g_clipA);
+  // Commands without clipping do not touch the table
+  Draw(buffer, 2, g_noClip);
+  Draw(buffer, 3, g_clipA);
+  Draw(buffer, 4, g_clipB);
+  // Only the last entry is compared, so returning to an earlier rectangle adds a new entry
+  Draw(buffer, 5, g_clipA);
+
+  const ReadOnlySpan<PxAreaRectangleF> clipSpan = buffer.AsReadOnlyClipRectangleSpan();
+  ASSERT_EQ(3u, clipSpan.size());
+  EXPECT_EQ(g_clipA.ClipRectanglePxf, clipSpan[0]);
+  EXPECT_EQ(g_clipB.ClipRectanglePxf, clipSpan[1]);
+  EXPECT_EQ(g_clipA.ClipRectanglePxf, clipSpan[2]);
+
+  const ReadOnlySpan<UI::EncodedCommandParams> params = buffer.AsReadOnlyParamsSpan();
+  ASSERT_EQ(6u, params.size());
+  EXPECT_EQ(0u, params[0].ClipRectangleIndex);
+  EXPECT_EQ(0u, params[1].ClipRectangleIndex);
+  EXPECT_FALSE(buffer.AsReadOnlySpan()[2].State.IsClipEnabled());
+  EXPECT_EQ(0u, params[3].ClipRectangleIndex);
+  EXPECT_EQ(1u, params[4].ClipRectangleIndex);
+  EXPECT_EQ(2u, params[5].ClipRectangleIndex);
+}
+
+
+TEST(TestDrawCommandBuffer, Clear)
+{
+  UI::DrawCommandBufferEx buffer;
+  Draw(buffer, 0, g_clipA);
+
+  buffer.Clear();
+
+  EXPECT_EQ(0u, buffer.Count());
+  EXPECT_EQ(0u, buffer.AsReadOnlyClipRectangleSpan().size());
+
+  // The shared entry must not survive the clear
+  Draw(buffer, 0, g_clipB);
+  ASSERT_EQ(1u, buffer.AsReadOnlyClipRectangleSpan().size());
+  EXPECT_EQ(g_clipB.ClipRectanglePxf, buffer.AsReadOnlyClipRectangleSpan()[0]);
+}
+
+
+TEST(TestDrawCommandBuffer, Append_RemapsClipAndCustomIndices)
+{
+  auto customData0 = std::make_shared<TestCustomDrawData>();
+  auto customData1 = std::make_shared<TestCustomDrawData>();
+  auto customData2 = std::make_shared<TestCustomDrawData>();
+
+  UI::DrawCommandBufferEx dst;
+  Draw(dst, 0, g_clipA);
+  dst.DrawCustom(g_hMesh, PxVector2(), g_sizePx, g_color, g_noClip, DrawCustomImage, customData0);
+
+  UI::DrawCommandBufferEx src;
+  src.DrawCustom(g_hMesh, PxVector2(), g_sizePx, g_color, g_clipB, DrawCustomImage, customData1);
+  src.DrawCustom(g_hMesh, PxVector2(), g_sizePx, g_color, g_noClip, DrawCustomText, customData2);
+
+  dst.Append(src);
+
+  ASSERT_EQ(4u, dst.Count());
+  const ReadOnlySpan<UI::EncodedCommandParams> params = dst.AsReadOnlyParamsSpan();
+
+  // The clip rectangle of the appended command is added after the existing entry
+  ASSERT_EQ(2u, dst.AsReadOnlyClipRectangleSpan().size());
+  EXPECT_EQ(1u, params[2].ClipRectangleIndex);
+  EXPECT_EQ(g_clipB.ClipRectanglePxf, dst.FastGetClipRectanglePxf(params[2].ClipRectangleIndex));
+
+  // The custom draw indices point to the copied entries
+  EXPECT_EQ(0u, params[1].Custom0);
+  EXPECT_EQ(1u, params[2].Custom0);
+  EXPECT_EQ(customData0, dst.FastGetCustomDrawBasicImageInfo(params[1].Custom0).CustomData);
+  EXPECT_EQ(customData1, dst.FastGetCustomDrawBasicImageInfo(params[2].Custom0).CustomData);
+  // Each custom draw type has its own table
+  EXPECT_EQ(0u, params[3].Custom0);
+  EXPECT_EQ(customData2, dst.FastGetCustomDrawTextInfo(params[3].Custom0).CustomData);
+}
+
+
+TEST(TestDrawCommandBuffer, Append_SharesMatchingClipRectangleAtTheSeam)
+{
+  UI::DrawCommandBufferEx dst;
+  Draw(dst, 0, g_clipA);
+
+  UI::DrawCommandBufferEx src;
+  Draw(src, 1, g_clipA);
+  Draw(src, 2, g_clipB);
+
+  dst.Append(src);
+
+  // The first appended command uses the same clip rectangle as the last command of dst so it reuses its entry
+  const ReadOnlySpan<PxAreaRectangleF> clipSpan = dst.AsReadOnlyClipRectangleSpan();
+  ASSERT_EQ(2u, clipSpan.size());
+  EXPECT_EQ(g_clipA.ClipRectanglePxf, clipSpan[0]);
+  EXPECT_EQ(g_clipB.ClipRectanglePxf, clipSpan[1]);
+
+  const ReadOnlySpan<UI::EncodedCommandParams> params = dst.AsReadOnlyParamsSpan();
+  ASSERT_EQ(3u, params.size());
+  EXPECT_EQ(0u, params[0].ClipRectangleIndex);
+  EXPECT_EQ(0u, params[1].ClipRectangleIndex);
+  EXPECT_EQ(1u, params[2].ClipRectangleIndex);
+}
+
+
+TEST(TestDrawCommandBuffer, Append_EqualsDirectRecording)
+{
+  auto customData = std::make_shared<TestCustomDrawData>();
+  const auto record = [&customData](UI::DrawCommandBuffer& rBuffer, const int32_t offset)
+  {
+    Draw(rBuffer, offset, g_clipA);
+    rBuffer.DrawCustom(g_hMesh, PxVector2(), g_sizePx, g_color, g_clipA, DrawCustomImage, customData);
+    Draw(rBuffer, offset + 1, g_noClip);
+    Draw(rBuffer, offset + 2, g_clipB);
+  };
+
+  UI::DrawCommandBufferEx expected;
+  record(expected, 0);
+  record(expected, 10);
+  record(expected, 20);
+
+  UI::DrawCommandBufferEx dst;
+  UI::DrawCommandBufferEx chunk1;
+  UI::DrawCommandBufferEx chunk2;
+  record(dst, 0);
+  record(chunk1, 10);
+  record(chunk2, 20);
+  dst.Append(chunk1);
+  dst.Append(chunk2);
+
+  ExpectEqual(expected, dst);
+}
+
+
+TEST(TestDrawCommandBuffer, Append_Empty)
+{
+  UI::DrawCommandBufferEx dst;
+  Draw(dst, 0, g_clipA);
+
+  dst.Append(UI::DrawCommandBufferEx());
+
+  EXPECT_EQ(1u, dst.Count());
+  EXPECT_EQ(1u, dst.AsReadOnlyClipRectangleSpan().size());
+}
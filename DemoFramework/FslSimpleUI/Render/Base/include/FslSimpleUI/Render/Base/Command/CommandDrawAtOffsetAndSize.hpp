@@ -63,15 +63,10 @@ namespace Fsl::UI
       return DstColor;
     }
 
-    constexpr PxAreaRectangleF GetClipRectanglePxf() const noexcept
-    {
-      return ClipRectanglePxf;
-    }
-
     inline constexpr static EncodedCommand Encode(const MeshHandle hMesh, const PxVector2& dstPositionPxf, const PxSize2D dstSizePx,
-                                                  const UIRenderColor dstColor, const DrawClipContext& clipContext) noexcept
+                                                  const UIRenderColor dstColor, const bool clipEnabled) noexcept
     {
-      return {DrawCommandType::DrawAtOffsetAndSize, hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext};
+      return {DrawCommandType::DrawAtOffsetAndSize, hMesh, dstPositionPxf, dstSizePx, dstColor, clipEnabled};
     }
   };
 }
@@ -32,13 +32,19 @@
  ****************************************************************************************************************************************************/
 
 #include <FslSimpleUI/Render/Base/Command/EncodedCommand.hpp>
+#include <FslSimpleUI/Render/Base/Command/EncodedCommandParams.hpp>
 
 namespace Fsl::UI
 {
   struct CommandDrawCustomNineSliceAtOffsetAndSize final : private EncodedCommand
   {
-    constexpr explicit CommandDrawCustomNineSliceAtOffsetAndSize(const EncodedCommand& command) noexcept
+  private:
+    uint32_t m_customDrawFunctionIndex{0};
+
+  public:
+    constexpr CommandDrawCustomNineSliceAtOffsetAndSize(const EncodedCommand& command, const EncodedCommandParams& params) noexcept
       : EncodedCommand(command)
+      , m_customDrawFunctionIndex(params.Custom0)
     {
       assert(command.State.Type() == DrawCommandType::DrawCustomNineSliceAtOffsetAndSize);
     }
@@ -65,14 +71,13 @@ namespace Fsl::UI
 
     constexpr uint32_t CustomDrawFunctionIndex() const noexcept
     {
-      return Custom0;
+      return m_customDrawFunctionIndex;
     }
 
     inline constexpr static EncodedCommand Encode(const MeshHandle hMesh, const PxVector2& dstPositionPxf, const PxSize2D dstSizePx,
-                                                  const UIRenderColor dstColor, const DrawClipContext& clipContext,
-                                                  const uint32_t customDrawFunctionIndex) noexcept
+                                                  const UIRenderColor dstColor, const bool clipEnabled) noexcept
     {
-      return {DrawCommandType::DrawCustomNineSliceAtOffsetAndSize, hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext, customDrawFunctionIndex};
+      return {DrawCommandType::DrawCustomNineSliceAtOffsetAndSize, hMesh, dstPositionPxf, dstSizePx, dstColor, clipEnabled};
     }
   };
 }
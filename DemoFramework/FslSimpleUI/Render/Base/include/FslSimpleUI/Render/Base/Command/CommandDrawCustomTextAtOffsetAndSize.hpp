@@ -32,13 +32,19 @@
  ****************************************************************************************************************************************************/
 
 #include <FslSimpleUI/Render/Base/Command/EncodedCommand.hpp>
+#include <FslSimpleUI/Render/Base/Command/EncodedCommandParams.hpp>
 
 namespace Fsl::UI
 {
   struct CommandDrawCustomTextAtOffsetAndSize final : private EncodedCommand
   {
-    constexpr explicit CommandDrawCustomTextAtOffsetAndSize(const EncodedCommand& command) noexcept
+  private:
+    uint32_t m_customDrawFunctionIndex{0};
+
+  public:
+    constexpr CommandDrawCustomTextAtOffsetAndSize(const EncodedCommand& command, const EncodedCommandParams& params) noexcept
       : EncodedCommand(command)
+      , m_customDrawFunctionIndex(params.Custom0)
     {
       assert(command.State.Type() == DrawCommandType::DrawCustomTextAtOffsetAndSize);
     }
@@ -65,19 +71,13 @@ namespace Fsl::UI
 
     constexpr uint32_t CustomDrawFunctionIndex() const noexcept
     {
-      return Custom0;
-    }
-
-    constexpr PxAreaRectangleF GetClipRectanglePxf() const noexcept
-    {
-      return ClipRectanglePxf;
+      return m_customDrawFunctionIndex;
     }
 
     inline constexpr static EncodedCommand Encode(const MeshHandle hMesh, const PxVector2& dstPositionPxf, const PxSize2D dstSizePx,
-                                                  const UIRenderColor dstColor, const DrawClipContext& clipContext,
-                                                  const uint32_t customDrawFunctionIndex) noexcept
+                                                  const UIRenderColor dstColor, const bool clipEnabled) noexcept
     {
-      return {DrawCommandType::DrawCustomTextAtOffsetAndSize, hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext, customDrawFunctionIndex};
+      return {DrawCommandType::DrawCustomTextAtOffsetAndSize, hMesh, dstPositionPxf, dstSizePx, dstColor, clipEnabled};
     }
   };
 }
@@ -64,9 +64,9 @@ namespace Fsl::UI
     }
 
     inline constexpr static EncodedCommand Encode(const MeshHandle hMesh, const PxVector2& dstPositionPxf, const PxSize2D dstSizePx,
-                                                  const UIRenderColor dstColor, const DrawClipContext& clipContext) noexcept
+                                                  const UIRenderColor dstColor, const bool clipEnabled) noexcept
     {
-      return {DrawCommandType::DrawRot90CWAtOffsetAndSize, hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext};
+      return {DrawCommandType::DrawRot90CWAtOffsetAndSize, hMesh, dstPositionPxf, dstSizePx, dstColor, clipEnabled};
     }
   };
 }
@@ -32,6 +32,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Log/Log3Core.hpp>
+#include <FslBase/Math/Pixel/PxAreaRectangleF.hpp>
 #include <FslBase/Math/Pixel/PxSize2D.hpp>
 #include <FslBase/Math/Pixel/PxVector2.hpp>
 #include <FslBase/Span/ReadOnlySpan.hpp>
@@ -46,6 +47,8 @@
 #include <FslSimpleUI/Render/Base/Command/CustomDrawNineSliceInfo.hpp>
 #include <FslSimpleUI/Render/Base/Command/CustomDrawTextInfo.hpp>
 #include <FslSimpleUI/Render/Base/Command/EncodedCommand.hpp>
+#include <FslSimpleUI/Render/Base/Command/EncodedCommandParams.hpp>
+#include <FslSimpleUI/Render/Base/DrawClipContext.hpp>
 #include <FslSimpleUI/Render/Base/ICustomDrawData.hpp>
 #include <FslSimpleUI/Render/Base/MeshHandle.hpp>
 #include <FslSimpleUI/Render/Base/UIRenderColor.hpp>
@@ -54,10 +57,16 @@
 
 namespace Fsl::UI
 {
+  //! @brief The commands are stored as two parallel arrays, the frequently accessed EncodedCommand and the rarely accessed EncodedCommandParams.
+  //!        The clip rectangles are stored in a table that the params reference. Consecutive commands with the same clip rectangle share the
+  //!        table entry, which is the common case as all windows in a clipped subtree use the same clip rectangle.
   class DrawCommandBuffer
   {
     std::vector<EncodedCommand> m_commandRecords;
+    std::vector<EncodedCommandParams> m_commandParams;
     std::size_t m_commandCount{0};
+    std::vector<PxAreaRectangleF> m_clipRectangles;
+    uint32_t m_clipRectangleCount{0};
     std::vector<CustomDrawBasicImageInfo> m_customDrawBasicImage;
     std::vector<CustomDrawBasicImageBasicMeshInfo> m_customDrawBasicImageBasicMesh;
     std::vector<CustomDrawNineSliceInfo> m_customDrawNineSlice;
@@ -70,6 +79,8 @@ namespace Fsl::UI
   public:
     DrawCommandBuffer()
       : m_commandRecords(2048u)
+      , m_commandParams(2048u)
+      , m_clipRectangles(128u)
       , m_customDrawBasicImage(128u)
       , m_customDrawBasicImageBasicMesh(128u)
       , m_customDrawNineSlice(128u)
@@ -94,7 +105,7 @@ namespace Fsl::UI
     {
       if (Check(hMesh, dstColor, dstSizePx))
       {
-        AddCommand(CommandDrawAtOffsetAndSize::Encode(hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext));
+        AddCommand(CommandDrawAtOffsetAndSize::Encode(hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext.Enabled), clipContext);
       }
     }
 
@@ -103,7 +114,7 @@ namespace Fsl::UI
     {
       if (Check(hMesh, dstColor, dstSizePx))
       {
-        AddCommand(CommandDrawRot90CWAtOffsetAndSize::Encode(hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext));
+        AddCommand(CommandDrawRot90CWAtOffsetAndSize::Encode(hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext.Enabled), clipContext);
       }
     }
 
@@ -114,7 +125,8 @@ namespace Fsl::UI
       if (Check(hMesh, dstColor, dstSizePx) && fnDrawCustomMesh != nullptr)
       {
         const uint32_t customDrawIndex = AddCustomDraw(CustomDrawBasicImageInfo(fnDrawCustomMesh, customData));
-        AddCommand(CommandDrawCustomBasicImageAtOffsetAndSize::Encode(hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext, customDrawIndex));
+        AddCommand(CommandDrawCustomBasicImageAtOffsetAndSize::Encode(hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext.Enabled), clipContext,
+                   customDrawIndex);
       }
     }
 
@@ -125,8 +137,8 @@ namespace Fsl::UI
       if (Check(hMesh, dstColor, dstSizePx) && fnDrawCustomMesh != nullptr)
       {
         const uint32_t customDrawIndex = AddCustomDraw(CustomDrawBasicImageBasicMeshInfo(fnDrawCustomMesh, customData));
-        AddCommand(
-          CommandDrawCustomBasicImageAtOffsetAndSizeBasicMesh::Encode(hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext, customDrawIndex));
+        AddCommand(CommandDrawCustomBasicImageAtOffsetAndSizeBasicMesh::Encode(hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext.Enabled),
+                   clipContext, customDrawIndex);
       }
     }
 
@@ -137,7 +149,8 @@ namespace Fsl::UI
       if (Check(hMesh, dstColor, dstSizePx) && fnDrawCustomMesh != nullptr)
       {
         const uint32_t customDrawIndex = AddCustomDraw(CustomDrawNineSliceInfo(fnDrawCustomMesh, customData));
-        AddCommand(CommandDrawCustomNineSliceAtOffsetAndSize::Encode(hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext, customDrawIndex));
+        AddCommand(CommandDrawCustomNineSliceAtOffsetAndSize::Encode(hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext.Enabled), clipContext,
+                   customDrawIndex);
       }
     }
 
@@ -148,7 +161,50 @@ namespace Fsl::UI
       if (Check(hMesh, dstColor, dstSizePx) && fnDrawCustomMesh != nullptr)
       {
         const uint32_t customDrawIndex = AddCustomTextDraw(CustomDrawTextInfo(fnDrawCustomMesh, customData));
-        AddCommand(CommandDrawCustomTextAtOffsetAndSize::Encode(hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext, customDrawIndex));
+        AddCommand(CommandDrawCustomTextAtOffsetAndSize::Encode(hMesh, dstPositionPxf, dstSizePx, dstColor, clipContext.Enabled), clipContext,
+                   customDrawIndex);
+      }
+    }
+
+    //! @brief Append all commands of the source buffer to this buffer.
+    //!        The clip rectangle and custom draw indices are remapped so the result is identical to recording the source commands directly
+    //!        into this buffer (this allows commands to be recorded into separate buffers in parallel and then be concatenated in order).
+    void Append(const DrawCommandBuffer& src)
+    {
+      assert(&src != this);
+      const std::size_t requiredCapacity = m_commandCount + src.m_commandCount;
+      if (requiredCapacity > m_commandRecords.size())
+      {
+        m_commandRecords.resize(((requiredCapacity + 2047u) / 2048u) * 2048u);
+        m_commandParams.resize(m_commandRecords.size());
+      }
+      for (std::size_t i = 0; i < src.m_commandCount; ++i)
+      {
+        const EncodedCommand& command = src.m_commandRecords[i];
+        const EncodedCommandParams& srcParams = src.m_commandParams[i];
+        const uint32_t clipRectangleIndex =
+          command.State.IsClipEnabled() ? AddClipRectangle(src.m_clipRectangles[srcParams.ClipRectangleIndex]) : 0u;
+        uint32_t custom0 = srcParams.Custom0;
+        switch (command.State.Type())
+        {
+        case DrawCommandType::DrawCustomBasicImageAtOffsetAndSize:
+          custom0 = AddCustomDraw(src.m_customDrawBasicImage[custom0]);
+          break;
+        case DrawCommandType::DrawCustomBasicImageAtOffsetAndSizeBasicMesh:
+          custom0 = AddCustomDraw(src.m_customDrawBasicImageBasicMesh[custom0]);
+          break;
+        case DrawCommandType::DrawCustomNineSliceAtOffsetAndSize:
+          custom0 = AddCustomDraw(src.m_customDrawNineSlice[custom0]);
+          break;
+        case DrawCommandType::DrawCustomTextAtOffsetAndSize:
+          custom0 = AddCustomTextDraw(src.m_customDrawText[custom0]);
+          break;
+        default:
+          break;
+        }
+        m_commandRecords[m_commandCount] = command;
+        m_commandParams[m_commandCount] = EncodedCommandParams(clipRectangleIndex, custom0);
+        ++m_commandCount;
       }
     }
 
@@ -191,6 +247,7 @@ namespace Fsl::UI
         m_customDrawText[i] = {};
       }
       m_commandCount = 0;
+      m_clipRectangleCount = 0;
       m_customDrawBasicImageCount = 0;
       m_customDrawBasicImageBasicMeshCount = 0;
       m_customDrawNineSliceCount = 0;
@@ -202,6 +259,29 @@ namespace Fsl::UI
       return ReadOnlySpan<EncodedCommand>(m_commandRecords.data(), m_commandCount);
     }
 
+    //! @brief The params of each command (same order as the commands)
+    inline ReadOnlySpan<EncodedCommandParams> DoAsReadOnlyParamsSpan() const
+    {
+      return ReadOnlySpan<EncodedCommandParams>(m_commandParams.data(), m_commandCount);
+    }
+
+    inline ReadOnlySpan<PxAreaRectangleF> DoAsReadOnlyClipRectangleSpan() const
+    {
+      return ReadOnlySpan<PxAreaRectangleF>(m_clipRectangles.data(), m_clipRectangleCount);
+    }
+
+    inline const EncodedCommandParams& DoFastGetCommandParams(const uint32_t commandIndex) const noexcept
+    {
+      assert(commandIndex < m_commandCount);
+      return m_commandParams[commandIndex];
+    }
+
+    inline const PxAreaRectangleF& DoFastGetClipRectanglePxf(const uint32_t index) const noexcept
+    {
+      assert(index < m_clipRectangleCount);
+      return m_clipRectangles[index];
+    }
+
     inline const CustomDrawBasicImageInfo& DoFastGetCustomDrawBasicImageInfo(const uint32_t index) const noexcept
     {
       assert(index < m_customDrawBasicImageCount);
@@ -227,16 +307,35 @@ namespace Fsl::UI
     }
 
   private:
-    inline void AddCommand(EncodedCommand record)
+    inline void AddCommand(EncodedCommand record, const DrawClipContext& clipContext, const uint32_t custom0 = 0)
     {
       if (m_commandCount >= m_commandRecords.size())
       {
         m_commandRecords.resize(m_commandRecords.size() + 2048u);
+        m_commandParams.resize(m_commandRecords.size());
       }
+      const uint32_t clipRectangleIndex = clipContext.Enabled ? AddClipRectangle(clipContext.ClipRectanglePxf) : 0u;
       m_commandRecords[m_commandCount] = record;
+      m_commandParams[m_commandCount] = EncodedCommandParams(clipRectangleIndex, custom0);
       ++m_commandCount;
     }
 
+    inline uint32_t AddClipRectangle(const PxAreaRectangleF& clipRectanglePxf)
+    {
+      // Consecutive commands normally share the clip rectangle so we only compare against the last entry
+      if (m_clipRectangleCount > 0u && m_clipRectangles[m_clipRectangleCount - 1u] == clipRectanglePxf)
+      {
+        return m_clipRectangleCount - 1u;
+      }
+      if (m_clipRectangleCount >= m_clipRectangles.size())
+      {
+        m_clipRectangles.resize(m_clipRectangles.size() + 128u);
+      }
+      m_clipRectangles[m_clipRectangleCount] = clipRectanglePxf;
+      ++m_clipRectangleCount;
+      return m_clipRectangleCount - 1u;
+    }
+
     inline uint32_t AddCustomDraw(CustomDrawBasicImageInfo customRecord)
     {
       if (m_customDrawBasicImageCount >= m_customDrawBasicImage.size())
@@ -48,6 +48,26 @@ namespace Fsl::UI
       return DoAsReadOnlySpan();
     }
 
+    inline ReadOnlySpan<EncodedCommandParams> AsReadOnlyParamsSpan() const
+    {
+      return DoAsReadOnlyParamsSpan();
+    }
+
+    inline ReadOnlySpan<PxAreaRectangleF> AsReadOnlyClipRectangleSpan() const
+    {
+      return DoAsReadOnlyClipRectangleSpan();
+    }
+
+    inline const EncodedCommandParams& FastGetCommandParams(const uint32_t commandIndex) const noexcept
+    {
+      return DoFastGetCommandParams(commandIndex);
+    }
+
+    inline const PxAreaRectangleF& FastGetClipRectanglePxf(const uint32_t index) const noexcept
+    {
+      return DoFastGetClipRectanglePxf(index);
+    }
+
     inline const CustomDrawBasicImageInfo& FastGetCustomDrawBasicImageInfo(const uint32_t index) const noexcept
     {
       return DoFastGetCustomDrawBasicImageInfo(index);
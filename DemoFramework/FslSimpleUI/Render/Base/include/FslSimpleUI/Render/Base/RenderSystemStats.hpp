@@ -45,6 +45,12 @@ namespace Fsl::UI
     uint32_t DrawIndexCalls{0};
     uint32_t VertexBufferCount{0};
     uint32_t IndexBufferCount{0};
+    //! The number of draw commands
+    uint32_t CommandCount{0};
+    //! The number of draw commands that reused the meshes build during a earlier frame
+    uint32_t ReusedCommandCount{0};
+    //! The number of vertex and index buffers that were not uploaded because their content was unchanged
+    uint32_t ReusedBufferCount{0};
 
     constexpr RenderSystemStats() noexcept = default;
     constexpr RenderSystemStats(const uint32_t meshCount, const uint32_t batchCount, const uint32_t vertexCount, const uint32_t indexCount,
@@ -60,6 +66,12 @@ namespace Fsl::UI
       , IndexBufferCount(indexBufferCount)
     {
     }
+
+    //! @brief The ratio of draw commands that reused the meshes from a earlier frame (0.0 to 1.0)
+    constexpr float ReuseRatio() const noexcept
+    {
+      return CommandCount > 0 ? static_cast<float>(ReusedCommandCount) / static_cast<float>(CommandCount) : 0.0f;
+    }
   };
 }
 
@@ -0,0 +1,237 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Math/Pixel/LogPxAreaRectangleF.hpp>
+#include <FslBase/Math/Pixel/PxRectangleU16.hpp>
+#include <FslBase/Math/Pixel/PxSize2D.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/Sprite/BasicImageSprite.hpp>
+#include <FslGraphics/Sprite/SpriteDpConfig.hpp>
+#include <FslGraphics/Sprite/SpriteNativeAreaCalc.hpp>
+#include <FslGraphics/UnitTest/Helper/Sprite/Material/Test/SpriteMaterialImpl.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <FslSimpleUI/Render/IMBatch/MeshManager.hpp>
+#include <FslSimpleUI/Render/IMBatch/Preprocess/SpatialGrid/ParallelSpatialGridPreprocessor.hpp>
+#include <FslSimpleUI/Render/IMBatch/Preprocess/SpatialGrid/SpatialGridPreprocessor.hpp>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr PxSize2D WindowSizePx = PxSize2D::Create(1920, 1080);
+    constexpr PxExtent2D TextureExtentPx = PxExtent2D::Create(256, 256);
+    constexpr uint32_t OpaqueMaterialCount = 4;
+    constexpr uint32_t TransparentMaterialCount = 4;
+    constexpr uint32_t SpritesPerMaterial = 2;
+    //! Large enough to take the parallel path and to split the gather into multiple chunks
+    constexpr uint32_t LargeCommandCount = 20000;
+    constexpr uint32_t WorkerThreadCount = 3;
+  }
+
+  SpriteMaterialInfo CreateMaterialInfo(const uint32_t materialId, const bool isOpaque)
+  {
+    const SpriteMaterialId spriteMaterialId(materialId);
+    return {spriteMaterialId, LocalConfig::TextureExtentPx, isOpaque, BasicPrimitiveTopology::TriangleList,
+            std::make_shared<SpriteMaterialImpl>(spriteMaterialId, LocalConfig::TextureExtentPx)};
+  }
+
+  class Test_ParallelSpatialGridPreprocessor : public TestFixtureFslGraphics
+  {
+  protected:
+    std::shared_ptr<UI::RenderIMBatch::MeshManager> m_meshManager;
+    std::vector<UI::MeshHandle> m_meshes;
+    std::shared_ptr<JobSystem> m_jobSystem;
+
+  public:
+    Test_ParallelSpatialGridPreprocessor()
+      : m_meshManager(std::make_shared<UI::RenderIMBatch::MeshManager>(CreateMaterialInfo(0u, true)))
+      , m_jobSystem(std::make_shared<JobSystem>(LocalConfig::WorkerThreadCount))
+    {
+      const SpriteNativeAreaCalc spriteNativeAreaCalc(false);
+      const uint32_t materialCount = LocalConfig::OpaqueMaterialCount + LocalConfig::TransparentMaterialCount;
+      for (uint32_t materialIndex = 0; materialIndex < materialCount; ++materialIndex)
+      {
+        const SpriteMaterialInfo materialInfo = CreateMaterialInfo(1u + materialIndex, materialIndex < LocalConfig::OpaqueMaterialCount);
+        for (uint32_t spriteIndex = 0; spriteIndex < LocalConfig::SpritesPerMaterial; ++spriteIndex)
+        {
+          const auto rectanglePx = PxRectangleU16::Create(static_cast<uint16_t>(spriteIndex * 32u), 0, 32, 32);
+          auto sprite = std::make_shared<BasicImageSprite>(spriteNativeAreaCalc, materialInfo, rectanglePx, SpriteDpConfig::BaseDpi, "test",
+                                                           SpriteDpConfig::BaseDpi);
+          m_meshes.push_back(m_meshManager->CreateMesh(sprite));
+        }
+      }
+    }
+
+    ~Test_ParallelSpatialGridPreprocessor() override
+    {
+      for (const UI::MeshHandle hMesh : m_meshes)
+      {
+        m_meshManager->DestroyMesh(hMesh);
+      }
+    }
+
+    //! @brief Create a random command stream where some commands are partially or fully outside the window
+    std::vector<UI::EncodedCommand> CreateCommands(const uint32_t count, const uint32_t seed) const
+    {
+      std::mt19937 random(seed);
+      std::uniform_int_distribution<std::size_t> randomMesh(0, m_meshes.size() - 1u);
+      std::uniform_real_distribution<float> randomPositionX(-64.0f, static_cast<float>(LocalConfig::WindowSizePx.RawWidth()) + 16.0f);
+      std::uniform_real_distribution<float> randomPositionY(-64.0f, static_cast<float>(LocalConfig::WindowSizePx.RawHeight()) + 16.0f);
+      std::uniform_int_distribution<int32_t> randomSize(1, 160);
+      std::uniform_int_distribution<int32_t> randomAlpha(0, 255);
+
+      std::vector<UI::EncodedCommand> commands(count);
+      for (auto& rCommand : commands)
+      {
+        const PxVector2 positionPxf = PxVector2::Create(randomPositionX(random), randomPositionY(random));
+        const PxSize2D sizePx = PxSize2D::Create(randomSize(random), randomSize(random));
+        const auto color = UI::UIRenderColor::CreateR8G8B8A8UNorm(255, 255, 255, randomAlpha(random));
+        rCommand = UI::EncodedCommand(UI::DrawCommandType::DrawAtOffsetAndSize, m_meshes[randomMesh(random)], positionPxf, sizePx, color, false);
+      }
+      return commands;
+    }
+  };
+
+
+  void ExpectEqual(const ReadOnlySpan<UI::RenderIMBatch::ProcessedCommandRecord> expected,
+                   const ReadOnlySpan<UI::RenderIMBatch::ProcessedCommandRecord> actual)
+  {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+      EXPECT_EQ(expected[i].MaterialId.Value, actual[i].MaterialId.Value);
+      EXPECT_EQ(expected[i].DstAreaRectanglePxf, actual[i].DstAreaRectanglePxf);
+      EXPECT_TRUE(expected[i].FinalColor == actual[i].FinalColor);
+      EXPECT_EQ(expected[i].OriginalCommandIndex, actual[i].OriginalCommandIndex);
+      EXPECT_EQ(expected[i].LegacyCommandSpanIndex, actual[i].LegacyCommandSpanIndex);
+    }
+  }
+
+  void ExpectSameResult(const std::shared_ptr<JobSystem>& jobSystem, const UI::RenderIMBatch::MeshManager& meshManager,
+                        const ReadOnlySpan<UI::EncodedCommand> commandSpan, const bool allowDepthBuffer)
+  {
+    UI::RenderIMBatch::SpatialGridPreprocessor expectedPreprocessor(LocalConfig::WindowSizePx, allowDepthBuffer);
+    UI::RenderIMBatch::ParallelSpatialGridPreprocessor preprocessor(LocalConfig::WindowSizePx, allowDepthBuffer);
+    preprocessor.SetJobSystem(jobSystem);
+
+    std::vector<UI::RenderIMBatch::ProcessedCommandRecord> expectedRecords;
+    std::vector<UI::RenderIMBatch::ProcessedCommandRecord> records;
+    expectedPreprocessor.Process(expectedRecords, commandSpan, meshManager);
+    preprocessor.Process(records, commandSpan, meshManager);
+
+    // Sanity check that the stream actually exercises both queues (unless everything is forced into the transparent queue)
+    if (allowDepthBuffer)
+    {
+      EXPECT_FALSE(expectedPreprocessor.GetOpaqueSpan(expectedRecords).empty());
+    }
+    EXPECT_FALSE(expectedPreprocessor.GetTransparentSpan(expectedRecords).empty());
+
+    ExpectEqual(expectedPreprocessor.GetOpaqueSpan(expectedRecords), preprocessor.GetOpaqueSpan(records));
+    ExpectEqual(expectedPreprocessor.GetTransparentSpan(expectedRecords), preprocessor.GetTransparentSpan(records));
+  }
+}
+
+
+TEST_F(Test_ParallelSpatialGridPreprocessor, Process_Empty)
+{
+  UI::RenderIMBatch::ParallelSpatialGridPreprocessor preprocessor(LocalConfig::WindowSizePx, true);
+  preprocessor.SetJobSystem(m_jobSystem);
+
+  std::vector<UI::RenderIMBatch::ProcessedCommandRecord> records;
+  preprocessor.Process(records, ReadOnlySpan<UI::EncodedCommand>(), *m_meshManager);
+
+  EXPECT_TRUE(preprocessor.GetOpaqueSpan(records).empty());
+  EXPECT_TRUE(preprocessor.GetTransparentSpan(records).empty());
+}
+
+
+TEST_F(Test_ParallelSpatialGridPreprocessor, Process_Small)
+{
+  // Small command buffers are processed on the calling thread
+  const std::vector<UI::EncodedCommand> commands = CreateCommands(500, 1);
+  ExpectSameResult(m_jobSystem, *m_meshManager, SpanUtil::AsReadOnlySpan(commands), true);
+}
+
+
+TEST_F(Test_ParallelSpatialGridPreprocessor, Process_Large_DepthBuffer)
+{
+  for (uint32_t seed = 0; seed < 4; ++seed)
+  {
+    const std::vector<UI::EncodedCommand> commands = CreateCommands(LocalConfig::LargeCommandCount, seed);
+    ExpectSameResult(m_jobSystem, *m_meshManager, SpanUtil::AsReadOnlySpan(commands), true);
+  }
+}
+
+
+TEST_F(Test_ParallelSpatialGridPreprocessor, Process_Large_NoDepthBuffer)
+{
+  for (uint32_t seed = 10; seed < 14; ++seed)
+  {
+    const std::vector<UI::EncodedCommand> commands = CreateCommands(LocalConfig::LargeCommandCount, seed);
+    ExpectSameResult(m_jobSystem, *m_meshManager, SpanUtil::AsReadOnlySpan(commands), false);
+  }
+}
+
+
+TEST_F(Test_ParallelSpatialGridPreprocessor, Process_Large_NoJobSystem)
+{
+  const std::vector<UI::EncodedCommand> commands = CreateCommands(LocalConfig::LargeCommandCount, 42);
+  ExpectSameResult(std::shared_ptr<JobSystem>(), *m_meshManager, SpanUtil::AsReadOnlySpan(commands), true);
+}
+
+
+TEST_F(Test_ParallelSpatialGridPreprocessor, Process_Repeated)
+{
+  // The preprocessor reuses its grids and buffers between frames, so process a few different streams with the same instances
+  UI::RenderIMBatch::SpatialGridPreprocessor expectedPreprocessor(LocalConfig::WindowSizePx, true);
+  UI::RenderIMBatch::ParallelSpatialGridPreprocessor preprocessor(LocalConfig::WindowSizePx, true);
+  preprocessor.SetJobSystem(m_jobSystem);
+
+  std::vector<UI::RenderIMBatch::ProcessedCommandRecord> expectedRecords;
+  std::vector<UI::RenderIMBatch::ProcessedCommandRecord> records;
+  const uint32_t commandCounts[] = {LocalConfig::LargeCommandCount, 3000, 100, LocalConfig::LargeCommandCount / 2};
+  uint32_t seed = 100;
+  for (const uint32_t commandCount : commandCounts)
+  {
+    const std::vector<UI::EncodedCommand> commands = CreateCommands(commandCount, seed++);
+    expectedPreprocessor.Process(expectedRecords, SpanUtil::AsReadOnlySpan(commands), *m_meshManager);
+    preprocessor.Process(records, SpanUtil::AsReadOnlySpan(commands), *m_meshManager);
+
+    ExpectEqual(expectedPreprocessor.GetOpaqueSpan(expectedRecords), preprocessor.GetOpaqueSpan(records));
+    ExpectEqual(expectedPreprocessor.GetTransparentSpan(expectedRecords), preprocessor.GetTransparentSpan(records));
+  }
+}
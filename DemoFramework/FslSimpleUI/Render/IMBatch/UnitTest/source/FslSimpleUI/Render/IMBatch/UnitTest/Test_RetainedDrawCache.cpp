@@ -0,0 +1,323 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Pixel/PxRectangleU16.hpp>
+#include <FslBase/Math/Pixel/PxRectangleU32.hpp>
+#include <FslBase/Math/Pixel/PxThicknessU16.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics/Font/BitmapFont.hpp>
+#include <FslGraphics/Sprite/BasicImageSprite.hpp>
+#include <FslGraphics/Sprite/Font/SpriteFont.hpp>
+#include <FslGraphics/Sprite/Font/SpriteFontConfig.hpp>
+#include <FslGraphics/Sprite/SpriteDpConfig.hpp>
+#include <FslGraphics/Sprite/SpriteNativeAreaCalc.hpp>
+#include <FslGraphics/UnitTest/Helper/Sprite/Material/Test/SpriteMaterialImpl.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <FslSimpleUI/Render/IMBatch/MeshManager.hpp>
+#include <FslSimpleUI/Render/IMBatch/RetainedDrawCache.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr PxExtent2D TextureExtentPx = PxExtent2D::Create(256, 256);
+    constexpr uint32_t CommandsPerSegment = 4;
+    constexpr uint32_t SegmentCount = 3;
+    constexpr uint32_t CommandCount = CommandsPerSegment * SegmentCount;
+  }
+
+  SpriteMaterialInfo CreateMaterialInfo(const uint32_t materialId, const bool isOpaque)
+  {
+    const SpriteMaterialId spriteMaterialId(materialId);
+    return {spriteMaterialId, LocalConfig::TextureExtentPx, isOpaque, BasicPrimitiveTopology::TriangleList,
+            std::make_shared<SpriteMaterialImpl>(spriteMaterialId, LocalConfig::TextureExtentPx)};
+  }
+
+  std::shared_ptr<SpriteFont> CreateFont(const SpriteMaterialInfo& materialInfo)
+  {
+    std::vector<BitmapFontChar> chars = {
+      BitmapFontChar('a', PxRectangleU32::Create(0, 0, 8, 10), PxPoint2::Create(0, 0), PxValueU16(8)),
+      BitmapFontChar('b', PxRectangleU32::Create(8, 0, 8, 10), PxPoint2::Create(0, 0), PxValueU16(8)),
+    };
+    const BitmapFont bitmapFont(StringViewLite("font"), static_cast<uint16_t>(SpriteDpConfig::BaseDpi), 10, PxValueU16(10), PxValueU16(8),
+                                PxThicknessU16(), StringViewLite("texture"), BitmapFontType::Bitmap, BitmapFont::SdfParams(), std::move(chars),
+                                std::vector<BitmapFontKerning>());
+    return std::make_shared<SpriteFont>(SpriteNativeAreaCalc(false), materialInfo, bitmapFont, SpriteFontConfig(), SpriteDpConfig::BaseDpi,
+                                        "font");
+  }
+
+  //! A recorded frame of draw commands
+  struct Frame
+  {
+    std::vector<UI::EncodedCommand> Commands;
+    std::vector<UI::EncodedCommandParams> Params;
+    std::vector<PxAreaRectangleF> ClipRectangles;
+
+    void Add(const UI::EncodedCommand& command, const UI::EncodedCommandParams& params = {})
+    {
+      Commands.push_back(command);
+      Params.push_back(params);
+    }
+  };
+
+  class Test_RetainedDrawCache : public TestFixtureFslGraphics
+  {
+  protected:
+    std::shared_ptr<UI::RenderIMBatch::MeshManager> m_meshManager;
+    std::vector<UI::MeshHandle> m_meshes;
+    UI::MeshHandle m_hFont;
+    UI::RenderIMBatch::RetainedDrawCache m_cache;
+
+  public:
+    Test_RetainedDrawCache()
+      : m_meshManager(std::make_shared<UI::RenderIMBatch::MeshManager>(CreateMaterialInfo(0u, true)))
+    {
+      const SpriteNativeAreaCalc spriteNativeAreaCalc(false);
+      const SpriteMaterialInfo materialInfo = CreateMaterialInfo(1u, false);
+      for (uint16_t i = 0; i < 2u; ++i)
+      {
+        auto sprite = std::make_shared<BasicImageSprite>(spriteNativeAreaCalc, materialInfo, PxRectangleU16::Create(i * 32u, 0, 32, 32),
+                                                         SpriteDpConfig::BaseDpi, "test", SpriteDpConfig::BaseDpi);
+        m_meshes.push_back(m_meshManager->CreateMesh(sprite));
+      }
+      m_hFont = m_meshManager->CreateMesh(CreateFont(materialInfo));
+      m_hFont = m_meshManager->SetMeshText(m_hFont, "ab");
+    }
+
+    ~Test_RetainedDrawCache() override
+    {
+      for (const UI::MeshHandle hMesh : m_meshes)
+      {
+        m_meshManager->DestroyMesh(hMesh);
+      }
+      m_meshManager->DestroyMesh(m_hFont);
+    }
+
+    UI::EncodedCommand CreateCommand(const uint32_t index, const UI::DrawCommandType type = UI::DrawCommandType::DrawAtOffsetAndSize,
+                                     const bool clipEnabled = false) const
+    {
+      const PxVector2 positionPxf = PxVector2::Create(static_cast<float>(index * 10u), 0.0f);
+      return {type, m_meshes[index % m_meshes.size()], positionPxf, PxSize2D::Create(32, 32), UI::UIRenderColor::CreateR8G8B8A8UNorm(255, 255, 255, 255), clipEnabled};
+    }
+
+    Frame CreateFrame(const uint32_t commandCount = LocalConfig::CommandCount) const
+    {
+      Frame frame;
+      for (uint32_t i = 0; i < commandCount; ++i)
+      {
+        frame.Add(CreateCommand(i));
+      }
+      return frame;
+    }
+
+    bool TryReuse(const Frame& frame)
+    {
+      return m_cache.TryReuse(SpanUtil::AsReadOnlySpan(frame.Commands), SpanUtil::AsReadOnlySpan(frame.Params),
+                              SpanUtil::AsReadOnlySpan(frame.ClipRectangles), *m_meshManager);
+    }
+
+    //! @brief Emulate the batcher by placing a fixed number of commands in each segment
+    void Build(const Frame& frame)
+    {
+      for (uint32_t i = 0; i < frame.Commands.size(); ++i)
+      {
+        const UI::RenderIMBatch::ProcessedCommandRecord record(BatchMaterialId(1), PxAreaRectangleF::Create(static_cast<float>(i), 0.0f, 32.0f, 32.0f),
+                                                               frame.Commands[i].DstColor, i, i);
+        m_cache.AddDrawnCommand(record, i / LocalConfig::CommandsPerSegment);
+      }
+    }
+
+    //! @brief Run a frame and return the number of commands reused by each segment (empty if the whole frame was reused)
+    std::vector<uint32_t> DrawFrame(const Frame& frame)
+    {
+      std::vector<uint32_t> reusedCommands;
+      if (!TryReuse(frame))
+      {
+        Build(frame);
+        const auto segmentCount = static_cast<uint32_t>((frame.Commands.size() + LocalConfig::CommandsPerSegment - 1) / LocalConfig::CommandsPerSegment);
+        for (uint32_t i = 0; i < segmentCount; ++i)
+        {
+          reusedCommands.push_back(m_cache.TryReuseSegment(i));
+        }
+      }
+      m_cache.Commit();
+      return reusedCommands;
+    }
+  };
+}
+
+
+TEST_F(Test_RetainedDrawCache, TryReuse_FirstFrame)
+{
+  const Frame frame = CreateFrame();
+  EXPECT_EQ(std::vector<uint32_t>({0u, 0u, 0u}), DrawFrame(frame));
+}
+
+
+TEST_F(Test_RetainedDrawCache, TryReuse_Unchanged)
+{
+  const Frame frame = CreateFrame();
+  DrawFrame(frame);
+
+  EXPECT_TRUE(TryReuse(frame));
+  m_cache.Commit();
+  EXPECT_TRUE(TryReuse(frame));
+}
+
+
+TEST_F(Test_RetainedDrawCache, TryReuse_NotCommitted)
+{
+  const Frame frame = CreateFrame();
+  EXPECT_FALSE(TryReuse(frame));
+  Build(frame);
+
+  // The meshes were never successfully build, so nothing can be reused
+  EXPECT_FALSE(TryReuse(frame));
+  Build(frame);
+  EXPECT_EQ(0u, m_cache.TryReuseSegment(0));
+  m_cache.Commit();
+
+  EXPECT_TRUE(TryReuse(frame));
+}
+
+
+TEST_F(Test_RetainedDrawCache, Invalidate)
+{
+  const Frame frame = CreateFrame();
+  DrawFrame(frame);
+
+  m_cache.Invalidate();
+  EXPECT_EQ(std::vector<uint32_t>({0u, 0u, 0u}), DrawFrame(frame));
+  EXPECT_TRUE(TryReuse(frame));
+}
+
+
+TEST_F(Test_RetainedDrawCache, ChangedCommand_OnlyItsSegmentIsRebuild)
+{
+  Frame frame = CreateFrame();
+  DrawFrame(frame);
+
+  frame.Commands[LocalConfig::CommandsPerSegment + 1].DstColor = UI::UIRenderColor::CreateR8G8B8A8UNorm(0, 0, 0, 255);
+  EXPECT_EQ(std::vector<uint32_t>({LocalConfig::CommandsPerSegment, 0u, LocalConfig::CommandsPerSegment}), DrawFrame(frame));
+
+  // The changed frame is now the retained one
+  EXPECT_TRUE(TryReuse(frame));
+}
+
+
+TEST_F(Test_RetainedDrawCache, AddedCommand)
+{
+  Frame frame = CreateFrame();
+  DrawFrame(frame);
+
+  frame.Add(CreateCommand(LocalConfig::CommandCount));
+  EXPECT_EQ(std::vector<uint32_t>({LocalConfig::CommandsPerSegment, LocalConfig::CommandsPerSegment, LocalConfig::CommandsPerSegment, 0u}),
+            DrawFrame(frame));
+}
+
+
+TEST_F(Test_RetainedDrawCache, RemovedCommand)
+{
+  Frame frame = CreateFrame();
+  DrawFrame(frame);
+
+  frame.Commands.pop_back();
+  frame.Params.pop_back();
+  EXPECT_EQ(std::vector<uint32_t>({LocalConfig::CommandsPerSegment, LocalConfig::CommandsPerSegment, 0u}), DrawFrame(frame));
+}
+
+
+TEST_F(Test_RetainedDrawCache, ContentChanged)
+{
+  Frame frame = CreateFrame();
+  frame.Commands[LocalConfig::CommandCount - 1].Mesh = m_hFont;
+  DrawFrame(frame);
+
+  // Changing the text does not change the command but it does change the mesh content
+  m_hFont = m_meshManager->SetMeshText(m_hFont, "ba");
+  frame.Commands[LocalConfig::CommandCount - 1].Mesh = m_hFont;
+  EXPECT_EQ(std::vector<uint32_t>({LocalConfig::CommandsPerSegment, LocalConfig::CommandsPerSegment, 0u}), DrawFrame(frame));
+
+  // Setting the same text again is not a change
+  m_hFont = m_meshManager->SetMeshText(m_hFont, "ba");
+  frame.Commands[LocalConfig::CommandCount - 1].Mesh = m_hFont;
+  EXPECT_TRUE(TryReuse(frame));
+}
+
+
+TEST_F(Test_RetainedDrawCache, StructureChanged)
+{
+  const Frame frame = CreateFrame();
+  DrawFrame(frame);
+
+  // Destroying a mesh allows its handle to be reused, so none of the commands can be trusted
+  auto sprite = std::make_shared<BasicImageSprite>(SpriteNativeAreaCalc(false), CreateMaterialInfo(1u, false), PxRectangleU16::Create(0, 0, 8, 8),
+                                                   SpriteDpConfig::BaseDpi, "test", SpriteDpConfig::BaseDpi);
+  m_meshManager->DestroyMesh(m_meshManager->CreateMesh(sprite));
+
+  EXPECT_EQ(std::vector<uint32_t>({0u, 0u, 0u}), DrawFrame(frame));
+}
+
+
+TEST_F(Test_RetainedDrawCache, VolatileCommand)
+{
+  Frame frame = CreateFrame();
+  frame.Commands[0] = CreateCommand(0, UI::DrawCommandType::DrawCustomBasicImageAtOffsetAndSize);
+  DrawFrame(frame);
+
+  // Custom draw commands are never considered unchanged
+  EXPECT_EQ(std::vector<uint32_t>({0u, LocalConfig::CommandsPerSegment, LocalConfig::CommandsPerSegment}), DrawFrame(frame));
+}
+
+
+TEST_F(Test_RetainedDrawCache, ClipRectangle_ComparedByValue)
+{
+  const PxAreaRectangleF clipRectanglePxf = PxAreaRectangleF::Create(0.0f, 0.0f, 100.0f, 100.0f);
+  Frame frame = CreateFrame();
+  frame.ClipRectangles.push_back(clipRectanglePxf);
+  frame.Commands[1] = CreateCommand(1, UI::DrawCommandType::DrawAtOffsetAndSize, true);
+  frame.Params[1] = UI::EncodedCommandParams(0u, 0u);
+  DrawFrame(frame);
+
+  // Inserting a unrelated clip rectangle in front of the used one changes the index but not the clip rectangle
+  frame.ClipRectangles.insert(frame.ClipRectangles.begin(), PxAreaRectangleF::Create(1.0f, 1.0f, 2.0f, 2.0f));
+  frame.Params[1] = UI::EncodedCommandParams(1u, 0u);
+  EXPECT_TRUE(TryReuse(frame));
+
+  // Changing the used clip rectangle is a change
+  frame.ClipRectangles[1] = PxAreaRectangleF::Create(0.0f, 0.0f, 50.0f, 100.0f);
+  EXPECT_EQ(std::vector<uint32_t>({0u, LocalConfig::CommandsPerSegment, LocalConfig::CommandsPerSegment}), DrawFrame(frame));
+}
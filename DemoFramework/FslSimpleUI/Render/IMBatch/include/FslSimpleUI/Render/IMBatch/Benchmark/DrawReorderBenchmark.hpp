@@ -0,0 +1,74 @@
+#ifndef FSLSIMPLEUI_RENDER_IMBATCH_BENCHMARK_DRAWREORDERBENCHMARK_HPP
+#define FSLSIMPLEUI_RENDER_IMBATCH_BENCHMARK_DRAWREORDERBENCHMARK_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Pixel/PxSize2D.hpp>
+#include <FslSimpleUI/Render/IMBatch/DrawReorderMethod.hpp>
+#include <memory>
+
+namespace Fsl
+{
+  class JobSystem;
+}
+
+namespace Fsl::UI::RenderIMBatch
+{
+  //! Benchmark facing access to the draw reorder preprocessors, which are internal to the library.
+  //! The preprocessor is fed a random command stream through a real MeshManager.
+  class IDrawReorderBenchmark
+  {
+  public:
+    virtual ~IDrawReorderBenchmark() = default;
+
+    //! @brief Reorder the command stream once.
+    //! @return the number of reordered draw commands (opaque + transparent)
+    virtual uint32_t Process() = 0;
+  };
+
+  struct DrawReorderBenchmarkCreateInfo
+  {
+    DrawReorderMethod Method{DrawReorderMethod::SpatialGrid};
+    PxSize2D WindowSizePx;
+    uint32_t CommandCount{0};
+    uint32_t Seed{0};
+    //! Only used by DrawReorderMethod::SpatialGridParallel (if null it runs on the calling thread)
+    std::shared_ptr<Fsl::JobSystem> JobSystem;
+  };
+
+  namespace DrawReorderBenchmarkFactory
+  {
+    //! @brief Create a benchmark for the given method (DrawReorderMethod::Disabled is not supported)
+    std::unique_ptr<IDrawReorderBenchmark> Create(const DrawReorderBenchmarkCreateInfo& createInfo);
+  }
+}
+
+#endif
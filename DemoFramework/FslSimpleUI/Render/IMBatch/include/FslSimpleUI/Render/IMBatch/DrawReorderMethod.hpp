@@ -38,6 +38,8 @@ namespace Fsl::UI::RenderIMBatch
     Disabled,
     LinearConstrained,
     SpatialGrid,
+    //! Produces the same result as SpatialGrid but spreads the work over the job system set with IFlexRenderSystemConfig::SetJobSystem
+    SpatialGridParallel,
   };
 }
 
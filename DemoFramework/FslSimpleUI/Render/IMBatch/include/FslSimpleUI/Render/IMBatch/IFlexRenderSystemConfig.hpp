@@ -32,6 +32,12 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/BasicTypes.hpp>
+#include <memory>
+
+namespace Fsl
+{
+  class JobSystem;
+}
 
 namespace Fsl::UI::RenderIMBatch
 {
@@ -47,6 +53,9 @@ namespace Fsl::UI::RenderIMBatch
 
     virtual uint32_t GetMaxDrawCalls() const = 0;
     virtual void SetMaxDrawCalls(const uint32_t maxDrawCalls) = 0;
+
+    //! @brief Set the job system used by the parallel reorder methods (nullptr to run them on the render thread)
+    virtual void SetJobSystem(std::shared_ptr<JobSystem> jobSystem) = 0;
   };
 }
 
@@ -0,0 +1,171 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Math/Pixel/PxRectangleU16.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslGraphics/Sprite/BasicImageSprite.hpp>
+#include <FslGraphics/Sprite/Material/ISpriteMaterial.hpp>
+#include <FslGraphics/Sprite/SpriteDpConfig.hpp>
+#include <FslGraphics/Sprite/SpriteNativeAreaCalc.hpp>
+#include <FslSimpleUI/Render/IMBatch/Benchmark/DrawReorderBenchmark.hpp>
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+#include "../MeshManager.hpp"
+#include "../Preprocess/Linear/LinearPreprocessor.hpp"
+#include "../Preprocess/SpatialGrid/ParallelSpatialGridPreprocessor.hpp"
+#include "../Preprocess/SpatialGrid/SpatialGridPreprocessor.hpp"
+
+namespace Fsl::UI::RenderIMBatch
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr PxExtent2D TextureExtentPx = PxExtent2D::Create(256, 256);
+      constexpr uint32_t OpaqueMaterialCount = 4;
+      constexpr uint32_t TransparentMaterialCount = 4;
+      constexpr uint32_t SpritesPerMaterial = 2;
+      constexpr bool AllowDepthBuffer = true;
+    }
+
+    class BenchSpriteMaterial final : public ISpriteMaterial
+    {
+    };
+
+    SpriteMaterialInfo CreateMaterialInfo(const uint32_t materialId, const bool isOpaque)
+    {
+      return {SpriteMaterialId(materialId), LocalConfig::TextureExtentPx, isOpaque, BasicPrimitiveTopology::TriangleList,
+              std::make_shared<BenchSpriteMaterial>()};
+    }
+
+    //! A random command stream of sprites that use a mix of opaque and transparent materials
+    class CommandContext
+    {
+    public:
+      RenderIMBatch::MeshManager MeshManager;
+      std::vector<MeshHandle> Meshes;
+      std::vector<EncodedCommand> Commands;
+      std::vector<ProcessedCommandRecord> ProcessedCommandRecords;
+
+      explicit CommandContext(const DrawReorderBenchmarkCreateInfo& createInfo)
+        : MeshManager(CreateMaterialInfo(0u, true))
+        , Commands(createInfo.CommandCount)
+      {
+        const SpriteNativeAreaCalc spriteNativeAreaCalc(false);
+        const uint32_t materialCount = LocalConfig::OpaqueMaterialCount + LocalConfig::TransparentMaterialCount;
+        for (uint32_t materialIndex = 0; materialIndex < materialCount; ++materialIndex)
+        {
+          const SpriteMaterialInfo materialInfo = CreateMaterialInfo(1u + materialIndex, materialIndex < LocalConfig::OpaqueMaterialCount);
+          for (uint32_t spriteIndex = 0; spriteIndex < LocalConfig::SpritesPerMaterial; ++spriteIndex)
+          {
+            const auto rectanglePx = PxRectangleU16::Create(static_cast<uint16_t>(spriteIndex * 32u), 0, 32, 32);
+            auto sprite = std::make_shared<BasicImageSprite>(spriteNativeAreaCalc, materialInfo, rectanglePx, SpriteDpConfig::BaseDpi, "bench",
+                                                             SpriteDpConfig::BaseDpi);
+            Meshes.push_back(MeshManager.CreateMesh(sprite));
+          }
+        }
+
+        std::mt19937 random(createInfo.Seed);
+        std::uniform_int_distribution<std::size_t> randomMesh(0, Meshes.size() - 1u);
+        std::uniform_real_distribution<float> randomPositionX(0.0f, static_cast<float>(std::max(createInfo.WindowSizePx.RawWidth() - 1, 0)));
+        std::uniform_real_distribution<float> randomPositionY(0.0f, static_cast<float>(std::max(createInfo.WindowSizePx.RawHeight() - 1, 0)));
+        std::uniform_int_distribution<int32_t> randomSize(4, 120);
+        const auto color = UIRenderColor::CreateR8G8B8A8UNorm(255, 255, 255, 255);
+        for (auto& rCommand : Commands)
+        {
+          const PxVector2 positionPxf = PxVector2::Create(randomPositionX(random), randomPositionY(random));
+          const PxSize2D sizePx = PxSize2D::Create(randomSize(random), randomSize(random));
+          rCommand = EncodedCommand(DrawCommandType::DrawAtOffsetAndSize, Meshes[randomMesh(random)], positionPxf, sizePx, color, false);
+        }
+      }
+
+      ~CommandContext()
+      {
+        for (const MeshHandle hMesh : Meshes)
+        {
+          MeshManager.DestroyMesh(hMesh);
+        }
+      }
+
+      CommandContext(const CommandContext&) = delete;
+      CommandContext& operator=(const CommandContext&) = delete;
+    };
+
+    template <typename TPreprocessor>
+    class DrawReorderBenchmark final : public IDrawReorderBenchmark
+    {
+      CommandContext m_context;
+
+    public:
+      TPreprocessor Preprocessor;
+
+      template <typename... TArgs>
+      explicit DrawReorderBenchmark(const DrawReorderBenchmarkCreateInfo& createInfo, TArgs&&... args)
+        : m_context(createInfo)
+        , Preprocessor(std::forward<TArgs>(args)...)
+      {
+      }
+
+      uint32_t Process() final
+      {
+        Preprocessor.Process(m_context.ProcessedCommandRecords, SpanUtil::AsReadOnlySpan(m_context.Commands), m_context.MeshManager);
+        return static_cast<uint32_t>(Preprocessor.GetOpaqueSpan(m_context.ProcessedCommandRecords).size() +
+                                     Preprocessor.GetTransparentSpan(m_context.ProcessedCommandRecords).size());
+      }
+    };
+  }
+
+
+  std::unique_ptr<IDrawReorderBenchmark> DrawReorderBenchmarkFactory::Create(const DrawReorderBenchmarkCreateInfo& createInfo)
+  {
+    switch (createInfo.Method)
+    {
+    case DrawReorderMethod::LinearConstrained:
+      return std::make_unique<DrawReorderBenchmark<LinearPreprocessor>>(createInfo, LocalConfig::AllowDepthBuffer, createInfo.WindowSizePx);
+    case DrawReorderMethod::SpatialGrid:
+      return std::make_unique<DrawReorderBenchmark<SpatialGridPreprocessor>>(createInfo, createInfo.WindowSizePx, LocalConfig::AllowDepthBuffer);
+    case DrawReorderMethod::SpatialGridParallel:
+      {
+        auto benchmark =
+          std::make_unique<DrawReorderBenchmark<ParallelSpatialGridPreprocessor>>(createInfo, createInfo.WindowSizePx, LocalConfig::AllowDepthBuffer);
+        benchmark->Preprocessor.SetJobSystem(createInfo.JobSystem);
+        return benchmark;
+      }
+    case DrawReorderMethod::Disabled:
+    default:
+      throw NotSupportedException("Unsupported draw reorder method");
+    }
+  }
+}
@@ -31,6 +31,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/Log/Log3Core.hpp>
 #include <FslGraphics2D/Procedural/Batcher/FlexibleImmediateModeBatcher.hpp>
 #include <FslSimpleUI/Render/Base/RenderSystemCreateInfo.hpp>
 #include <FslSimpleUI/Render/Builder/UIRawBasicMeshBuilder2D.hpp>
@@ -39,6 +40,7 @@
 #include <FslSimpleUI/Render/IMBatch/FlexRenderSystemConfig.hpp>
 #include <FslSimpleUI/Render/IMBatch/IFlexRenderSystemConfig.hpp>
 #include "Preprocess/Linear/LinearPreprocessor.hpp"
+#include "Preprocess/SpatialGrid/ParallelSpatialGridPreprocessor.hpp"
 #include "Preprocess/SpatialGrid/SpatialGridPreprocessor.hpp"
 #include "RenderSystemBase.hpp"
 
@@ -52,6 +54,7 @@ namespace Fsl::UI::RenderIMBatch
     FlexRenderSystemConfig m_config;
     LinearPreprocessor m_preprocessor;
     SpatialGridPreprocessor m_spatialGridPreprocessor;
+    ParallelSpatialGridPreprocessor m_parallelSpatialGridPreprocessor;
     uint32_t m_maxDrawCalls{0xFFFFFFFF};
 
   public:
@@ -73,6 +76,7 @@ namespace Fsl::UI::RenderIMBatch
       m_batcher.SetLimitOnlyOneBatchPerSegment(!config.FillBuffers);
       m_config = config;
       InvalidateDrawCache();
+      WarnIfParallelReorderHasNoJobSystem();
     }
 
     uint32_t GetMaxDrawCalls() const final
@@ -85,7 +89,20 @@ namespace Fsl::UI::RenderIMBatch
       m_maxDrawCalls = maxDrawCalls;
     }
 
+    void SetJobSystem(std::shared_ptr<JobSystem> jobSystem) final
+    {
+      m_parallelSpatialGridPreprocessor.SetJobSystem(std::move(jobSystem));
+      WarnIfParallelReorderHasNoJobSystem();
+    }
+
     void Draw(RenderPerformanceCapture* const pPerformanceCapture) final;
+
+  private:
+    void WarnIfParallelReorderHasNoJobSystem() const
+    {
+      FSLLOG3_WARNING_IF(m_config.ReorderMethod == DrawReorderMethod::SpatialGridParallel && !m_parallelSpatialGridPreprocessor.HasJobSystem(),
+                         "DrawReorderMethod::SpatialGridParallel has no job system, the reorder will run on the render thread");
+    }
   };
 }
 
@@ -402,6 +402,7 @@ namespace Fsl::UI::RenderIMBatch
     UpdateConfiguration(m_materialLookup, m_meshesNineSliceSprite);
     UpdateConfiguration(m_materialLookup, m_meshesOptimizedNineSliceSprite);
     UpdateConfiguration(m_materialLookup, m_meshesSpriteFont);
+    ++m_structureChangeId;
   }
 
 
@@ -560,6 +561,11 @@ namespace Fsl::UI::RenderIMBatch
       FSLLOG3_ERROR("Handle has unknown/unsupported mesh type");
       break;
     }
+    if (found)
+    {
+      // The handle can be reused by the next mesh that is created
+      ++m_structureChangeId;
+    }
     SANITY_CHECK_ALL();
     return found;
   }
@@ -611,7 +617,10 @@ namespace Fsl::UI::RenderIMBatch
 
     m_materialLookup.Release(rMeshRecord.MaterialHandle);
     rMeshRecord.MaterialHandle = m_materialLookup.Acquire(sprite.get(), rMeshRecord.SpriteMaterialIndex);
-    rMeshRecord.SetSprite(sprite);
+    if (rMeshRecord.SetSprite(sprite))
+    {
+      rMeshRecord.ContentChangeId = ++m_contentChangeId;
+    }
 
     assert(m_capacity.VertexCapacity >= rMeshRecord.Primitive.MeshVertexCapacity);
     assert(m_capacity.IndexCapacity >= rMeshRecord.Primitive.MeshIndexCapacity);
@@ -633,7 +642,10 @@ namespace Fsl::UI::RenderIMBatch
     }
     SpriteFontMeshRecord& rMeshRecord = m_meshesSpriteFont.Get(HandleCoding::GetOriginalHandle(hMesh));
 
-    rMeshRecord.SetText(text);
+    if (rMeshRecord.SetText(text))
+    {
+      rMeshRecord.ContentChangeId = ++m_contentChangeId;
+    }
 
     SANITY_CHECK_ALL();
     return hMesh;
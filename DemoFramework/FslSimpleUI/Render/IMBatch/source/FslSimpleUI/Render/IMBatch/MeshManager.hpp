@@ -45,6 +45,7 @@
 #include <memory>
 #include <utility>
 #include <vector>
+#include "HandleCoding.hpp"
 #include "MaterialLookup.hpp"
 #include "MeshTransparencyFlags.hpp"
 #include "Primitive/ImageRenderPrimitive.hpp"
@@ -246,6 +247,8 @@ namespace Fsl::UI::RenderIMBatch
       BatchMaterialHandle MaterialHandle;
       uint32_t SpriteMaterialIndex{0};
       bool IsOpaque{false};
+      //! The change id of the last modification of the text or font (as this modifies the mesh without changing its handle)
+      uint32_t ContentChangeId{0};
 
       SpriteFontMeshRecord() = default;
       SpriteFontMeshRecord(const SpriteFontRenderPrimitive& primitive, std::shared_ptr<SpriteFont> sprite, const BatchMaterialHandle materialHandle,
@@ -289,6 +292,10 @@ namespace Fsl::UI::RenderIMBatch
     HandleVector<SpriteFontMeshRecord> m_meshesSpriteFont;
     Capacity m_capacity;
     std::shared_ptr<UITextMeshBuilder> m_textMeshBuilder;
+    //! Changed every time a handle might have been reused or the content of all meshes might have been modified
+    uint32_t m_structureChangeId{0};
+    //! Used to tag meshes whose content was modified in place
+    uint32_t m_contentChangeId{0};
 
   public:
     explicit MeshManager(const SpriteMaterialInfo& defaultMaterialInfo);
@@ -334,6 +341,20 @@ namespace Fsl::UI::RenderIMBatch
     //  return m_meshes.FastGet(handle);
     //}
 
+    //! @brief Get a id that changes every time a mesh handle might have been reused or all meshes might have been modified.
+    uint32_t GetStructureChangeId() const noexcept
+    {
+      return m_structureChangeId;
+    }
+
+    //! @brief Get the id of the last in place content modification of the given mesh (zero if it never happened).
+    uint32_t UncheckedGetContentChangeId(const MeshHandle hMesh) const noexcept
+    {
+      return HandleCoding::GetType(hMesh) == RenderDrawSpriteType::SpriteFont
+               ? m_meshesSpriteFont.FastGet(HandleCoding::GetOriginalHandle(hMesh)).ContentChangeId
+               : 0u;
+    }
+
     const MaterialLookup& GetMaterialLookup() const
     {
       return m_materialLookup;
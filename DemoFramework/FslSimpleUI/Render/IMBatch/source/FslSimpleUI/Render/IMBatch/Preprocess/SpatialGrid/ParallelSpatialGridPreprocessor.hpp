@@ -0,0 +1,242 @@
+#ifndef FSLSIMPLEUI_RENDER_IMBATCH_PREPROCESS_SPATIALGRID_PARALLELSPATIALGRIDPREPROCESSOR_HPP
+#define FSLSIMPLEUI_RENDER_IMBATCH_PREPROCESS_SPATIALGRID_PARALLELSPATIALGRIDPREPROCESSOR_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxSize2D.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/JobSystem.hpp>
+#include <FslSimpleUI/Render/Base/Command/EncodedCommand.hpp>
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "../../MeshManager.hpp"
+#include "../Linear/MaterialCache.hpp"
+#include "../Linear/PreprocessUtil2_ForceTransparent.hpp"
+#include "../Linear/PreprocessUtil2_TwoQueues.hpp"
+#include "../PreprocessConfig.hpp"
+#include "../PreprocessResult.hpp"
+#include "../ProcessedCommandRecord.hpp"
+#include "SpatialGridReorder.hpp"
+#include "SpatialHashGrid2D.hpp"
+
+namespace Fsl::UI::RenderIMBatch
+{
+  //! @brief Produces the exact same draw order as the SpatialGridPreprocessor, but spreads the work over the supplied job system.
+  //!
+  //! The reorder of a single queue is a greedy scan where every decision depends on the previous ones (a command can be moved behind any
+  //! earlier command with the same material no matter where it is on screen), so splitting one queue into screen tiles would change the result.
+  //! Instead the work is split where it is independent:
+  //! - The opaque and transparent queues have their own grid and material cache, so they are reordered concurrently.
+  //! - The final copy of the records into draw order is split into chunks.
+  //! Without a job system everything is processed on the calling thread.
+  class ParallelSpatialGridPreprocessor
+  {
+    struct LocalConfig
+    {
+      //! Command buffers smaller than this are processed on the calling thread as the cost of waking the workers outweighs the gain
+      static constexpr uint32_t MinParallelCommandCount = 2048;
+      //! The minimum amount of records copied by each gather task
+      static constexpr uint32_t MinGatherChunkSize = 4096;
+    };
+
+    struct GatherTask
+    {
+      Span<ProcessedCommandRecord> DstSpan;
+      ReadOnlySpan<ProcessedCommandRecord> SrcSpan;
+      std::size_t StartIndex{0};
+      std::size_t EndIndex{0};
+    };
+
+    struct ReorderTask
+    {
+      SpatialHashGrid2D* pGrid{nullptr};
+      Span<MaterialCacheRecord> MaterialCache;
+      Span<ProcessedCommandRecord> DstSpan;
+      ReadOnlySpan<ProcessedCommandRecord> SrcSpan;
+    };
+
+    SpatialHashGrid2D m_opaqueGrid;
+    SpatialHashGrid2D m_transparentGrid;
+    MaterialCache m_cache;
+    PxSize2D m_windowSizePx;
+    std::vector<ProcessedCommandRecord> m_finalEntries;
+    uint32_t m_finalOpaqueCount{0};
+    uint32_t m_finalTransparentCount{0};
+    bool m_allowDepthBuffer{false};
+    std::shared_ptr<JobSystem> m_jobSystem;
+    std::vector<ReorderTask> m_reorderTasks;
+    std::vector<GatherTask> m_gatherTasks;
+
+  public:
+    explicit ParallelSpatialGridPreprocessor(const PxSize2D windowSizePx, const bool allowDepthBuffer)
+      : m_opaqueGrid(SpatialGridReorder::CreateGrid(windowSizePx, 8, 8))
+      , m_transparentGrid(SpatialGridReorder::CreateGrid(windowSizePx, 8, 8))
+      , m_windowSizePx(windowSizePx)
+      , m_allowDepthBuffer(allowDepthBuffer)
+    {
+    }
+
+    void OnConfigurationChanged(const PxSize2D windowSizePx)
+    {
+      m_windowSizePx = windowSizePx;
+      m_opaqueGrid = SpatialGridReorder::CreateGrid(windowSizePx, 8, 8);
+      m_transparentGrid = SpatialGridReorder::CreateGrid(windowSizePx, 8, 8);
+    }
+
+    void SetAllowDepthBuffer(const bool allowDepthBuffer)
+    {
+      m_allowDepthBuffer = allowDepthBuffer;
+    }
+
+    //! @brief Set the job system used to process large command buffers (nullptr to process everything on the calling thread)
+    void SetJobSystem(std::shared_ptr<JobSystem> jobSystem)
+    {
+      m_jobSystem = std::move(jobSystem);
+    }
+
+    bool HasJobSystem() const noexcept
+    {
+      return static_cast<bool>(m_jobSystem);
+    }
+
+    void Process(std::vector<ProcessedCommandRecord>& rProcessedCommandRecords, ReadOnlySpan<EncodedCommand> commandSpan,
+                 const MeshManager& meshManager)
+    {
+      if (commandSpan.empty())
+      {
+        m_finalOpaqueCount = 0;
+        m_finalTransparentCount = 0;
+        return;
+      }
+
+      // Ensure that we have enough space in the material cache
+      const uint32_t currentMaterialCount = meshManager.GetMaterialLookup().GetCount();
+      m_cache.EnsureCapacity(currentMaterialCount);
+      Span<MaterialCacheRecord> opaqueMaterialCache = m_cache.GetOpaqueCacheSpan(currentMaterialCount);
+      Span<MaterialCacheRecord> transparentMaterialCache = m_cache.GetTransparentCacheSpan(currentMaterialCount);
+
+      PreprocessResult result = m_allowDepthBuffer
+                                  ? PreprocessUtil2::PreprocessTwoQueues(rProcessedCommandRecords, opaqueMaterialCache, transparentMaterialCache,
+                                                                         commandSpan, meshManager, m_windowSizePx)
+                                  : PreprocessUtil2::PreprocessForceTransparent(rProcessedCommandRecords, opaqueMaterialCache,
+                                                                                transparentMaterialCache, commandSpan, meshManager, m_windowSizePx);
+
+      const uint32_t totalCount = result.OpaqueCount + result.TransparentCount;
+      if (totalCount > m_finalEntries.size())
+      {
+        m_finalEntries.resize(static_cast<std::size_t>(totalCount) + PreprocessConfig::ProcessedGrowBy);
+      }
+
+      m_reorderTasks.clear();
+      if (result.OpaqueCount > 0u)
+      {
+        m_reorderTasks.push_back({&m_opaqueGrid, opaqueMaterialCache, SpanUtil::UncheckedAsSpan(m_finalEntries, 0u, result.OpaqueCount),
+                                  SpanUtil::UncheckedAsReadOnlySpan(rProcessedCommandRecords, result.OpaqueStartIndex, result.OpaqueCount)});
+      }
+      if (result.TransparentCount > 0u)
+      {
+        m_reorderTasks.push_back(
+          {&m_transparentGrid, transparentMaterialCache, SpanUtil::UncheckedAsSpan(m_finalEntries, result.OpaqueCount, result.TransparentCount),
+           SpanUtil::UncheckedAsReadOnlySpan(rProcessedCommandRecords, result.TransparentStartIndex, result.TransparentCount)});
+      }
+
+      if (!m_jobSystem || totalCount < LocalConfig::MinParallelCommandCount)
+      {
+        for (const ReorderTask& task : m_reorderTasks)
+        {
+          SpatialGridReorder::Reorder(*task.pGrid, m_windowSizePx, task.MaterialCache, task.DstSpan, task.SrcSpan);
+        }
+      }
+      else
+      {
+        ProcessParallel(*m_jobSystem);
+      }
+      m_finalOpaqueCount = result.OpaqueCount;
+      m_finalTransparentCount = result.TransparentCount;
+    }
+
+    inline ReadOnlySpan<ProcessedCommandRecord> GetOpaqueSpan(std::vector<ProcessedCommandRecord>& /*rProcessedCommandRecords*/) const noexcept
+    {
+      return SpanUtil::UncheckedAsReadOnlySpan(m_finalEntries, 0u, m_finalOpaqueCount);
+    }
+
+    inline ReadOnlySpan<ProcessedCommandRecord> GetTransparentSpan(std::vector<ProcessedCommandRecord>& /*rProcessedCommandRecords*/) const noexcept
+    {
+      return SpanUtil::UncheckedAsReadOnlySpan(m_finalEntries, m_finalOpaqueCount, m_finalTransparentCount);
+    }
+
+  private:
+    void ProcessParallel(JobSystem& rJobSystem)
+    {
+      // Each reorder task is a single chunk, so the opaque and transparent queues are processed concurrently
+      rJobSystem.ParallelFor(m_reorderTasks.size(), 1u,
+                             [this](const std::size_t begin, const std::size_t end)
+                             {
+                               for (std::size_t i = begin; i < end; ++i)
+                               {
+                                 const ReorderTask& task = m_reorderTasks[i];
+                                 SpatialGridReorder::ReorderIndices(*task.pGrid, m_windowSizePx, task.MaterialCache, task.DstSpan, task.SrcSpan);
+                               }
+                             });
+
+      // Split the gathering of the final records into chunks (the calling thread participates so it counts as one of the threads)
+      m_gatherTasks.clear();
+      const std::size_t minChunkSize = LocalConfig::MinGatherChunkSize;
+      const std::size_t concurrency = static_cast<std::size_t>(rJobSystem.GetWorkerThreadCount()) + 1u;
+      for (const ReorderTask& task : m_reorderTasks)
+      {
+        const std::size_t count = task.SrcSpan.size();
+        const std::size_t chunkCount = std::max(std::min(count / minChunkSize, concurrency), static_cast<std::size_t>(1u));
+        const std::size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+        for (std::size_t startIndex = 0; startIndex < count; startIndex += chunkSize)
+        {
+          m_gatherTasks.push_back({task.DstSpan, task.SrcSpan, startIndex, std::min(startIndex + chunkSize, count)});
+        }
+      }
+      rJobSystem.ParallelFor(m_gatherTasks.size(), 1u,
+                             [this](const std::size_t begin, const std::size_t end)
+                             {
+                               for (std::size_t i = begin; i < end; ++i)
+                               {
+                                 const GatherTask& task = m_gatherTasks[i];
+                                 SpatialGridReorder::Gather(task.DstSpan, task.SrcSpan, task.StartIndex, task.EndIndex);
+                               }
+                             });
+    }
+  };
+}
+
+#endif
@@ -50,6 +50,7 @@
 #include <FslSimpleUI/Render/Base/RenderPerformanceCapture.hpp>
 #include <FslSimpleUI/Render/Builder/ScopedCustomUITextMeshBuilder2D.hpp>
 #include <FslSimpleUI/Render/Builder/UITextMeshBuilder.hpp>
+#include <vector>
 #include "DefaultRenderSystem.hpp"
 #include "FlexRenderSystem.hpp"
 #include "HandleCoding.hpp"
@@ -57,6 +58,7 @@
 #include "MeshManager.hpp"
 #include "Preprocess/Basic/BasicPreprocessor.hpp"
 #include "RenderDrawCommandType.hpp"
+#include "RetainedDrawCache.hpp"
 
 
 namespace Fsl::UI::RenderIMBatch
@@ -83,6 +85,8 @@ namespace Fsl::UI::RenderIMBatch
     {
       uint32_t VertexBufferCount{0};
       uint32_t IndexBufferCount{0};
+      uint32_t ReusedBufferCount{0};
+      uint32_t ReusedCommandCount{0};
     };
 
     struct DrawStats
@@ -508,14 +512,15 @@ namespace Fsl::UI::RenderIMBatch
     // CommandDrawAtOffsetAndSize
     template <typename TBatcher>
     inline void AddSpriteFontWithClipping(TBatcher& rBatcher, const ProcessedCommandRecord& processedCmd, UITextMeshBuilder& textMeshBuilder,
-                                          const CommandDrawAtOffsetAndSize& cmd, const MeshManager::SpriteFontMeshRecord& meshRecord)
+                                          const CommandDrawAtOffsetAndSize& cmd, const MeshManager::SpriteFontMeshRecord& meshRecord,
+                                          const PxAreaRectangleF& clipRectanglePxf)
     {
       auto builder = rBatcher.BeginMeshBuildCustomZ(
         processedCmd.MaterialId, meshRecord.Primitive.MeshVertexCapacity, meshRecord.Primitive.MeshIndexCapacity,
         static_cast<float>(LocalConfig::ZStart - processedCmd.LegacyCommandSpanIndex), UIRenderColor::Premultiply(processedCmd.FinalColor));
       {
         assert(meshRecord.Sprite);
-        textMeshBuilder.AddString(builder, cmd.GetDstPositionPxf(), meshRecord.GetGlyphs(), cmd.GetClipRectanglePxf());
+        textMeshBuilder.AddString(builder, cmd.GetDstPositionPxf(), meshRecord.GetGlyphs(), clipRectanglePxf);
       }
       rBatcher.EndMeshBuild(builder);
     }
@@ -549,7 +554,7 @@ namespace Fsl::UI::RenderIMBatch
     template <typename TBatcher>
     inline void AddSpriteFontWithClipping(TBatcher& rBatcher, const ProcessedCommandRecord& processedCmd, UITextMeshBuilder& rTextMeshBuilder,
                                           const CommandDrawCustomTextAtOffsetAndSize& cmd, const CustomDrawTextInfo& customDrawInfo,
-                                          const MeshManager::SpriteFontMeshRecord& record)
+                                          const MeshManager::SpriteFontMeshRecord& record, const PxAreaRectangleF& clipRectanglePxf)
     {
       // The custom rendering functions gets called with non-premultiplied colors so its up to them to do the proper color conversion depending on
       // the chosen material
@@ -559,7 +564,7 @@ namespace Fsl::UI::RenderIMBatch
                                        static_cast<float>(LocalConfig::ZStart - processedCmd.LegacyCommandSpanIndex), processedCmd.FinalColor);
       {
         assert(record.Sprite);
-        ScopedCustomUITextMeshBuilder2D scopedTextBuilder(builder, rTextMeshBuilder, *record.Sprite, cmd.GetClipRectanglePxf());
+        ScopedCustomUITextMeshBuilder2D scopedTextBuilder(builder, rTextMeshBuilder, *record.Sprite, clipRectanglePxf);
         customDrawInfo.FnDraw(scopedTextBuilder, cmd.GetDstPositionPxf(), cmd.GetDstSizePx(), customDrawInfo.CustomData.get());
       }
       rBatcher.EndMeshBuild(builder);
@@ -572,13 +577,14 @@ namespace Fsl::UI::RenderIMBatch
     template <typename TBatcher>
     void ProcessDrawCommands(TBatcher& rBatcher, const MeshManager& meshManager, UITextMeshBuilder& rTextMeshBuilder,
                              const ReadOnlySpan<ProcessedCommandRecord> orderedSpan, const ReadOnlySpan<EncodedCommand> commandSpan,
-                             const DrawCommandBufferEx& commandBuffer)
+                             const DrawCommandBufferEx& commandBuffer, RetainedDrawCache& rRetainedDrawCache)
     {
       const std::size_t count = orderedSpan.size();
       for (std::size_t i = 0; i < count; ++i)
       {
         const ProcessedCommandRecord& record = orderedSpan[i];
         const EncodedCommand& command = commandSpan[record.LegacyCommandSpanIndex];
+        const EncodedCommandParams& commandParams = commandBuffer.FastGetCommandParams(record.LegacyCommandSpanIndex);
         const auto hMesh = HandleCoding::GetOriginalHandle(command.Mesh);
         if (!command.State.IsClipEnabled())
         {
@@ -590,7 +596,7 @@ namespace Fsl::UI::RenderIMBatch
             break;
           case RenderDrawCommandType::BasicImageSprite_DrawCustomBasicImageAtOffsetAndSize:
             {
-              CommandDrawCustomBasicImageAtOffsetAndSize cmdEx(command);
+              CommandDrawCustomBasicImageAtOffsetAndSize cmdEx(command, commandParams);
               const CustomDrawBasicImageInfo& customDrawInfo = commandBuffer.FastGetCustomDrawBasicImageInfo(cmdEx.CustomDrawFunctionIndex());
               if (customDrawInfo.FnDraw != nullptr)
               {
@@ -600,7 +606,7 @@ namespace Fsl::UI::RenderIMBatch
             }
           case RenderDrawCommandType::BasicImageSprite_DrawCustomBasicImageAtOffsetAndSizeBasicMesh:
             {
-              CommandDrawCustomBasicImageAtOffsetAndSizeBasicMesh cmdEx(command);
+              CommandDrawCustomBasicImageAtOffsetAndSizeBasicMesh cmdEx(command, commandParams);
               const CustomDrawBasicImageBasicMeshInfo& customDrawInfo =
                 commandBuffer.FastGetCustomDrawBasicImageBasicMeshInfo(cmdEx.CustomDrawFunctionIndex());
               if (customDrawInfo.FnDraw != nullptr)
@@ -618,7 +624,7 @@ namespace Fsl::UI::RenderIMBatch
             break;
           case RenderDrawCommandType::NineSliceSprite_DrawCustomNineSliceAtOffsetAndSize:
             {
-              CommandDrawCustomNineSliceAtOffsetAndSize cmdEx(command);
+              CommandDrawCustomNineSliceAtOffsetAndSize cmdEx(command, commandParams);
               const CustomDrawNineSliceInfo& customDrawInfo = commandBuffer.FastGetCustomDrawNineSliceInfo(cmdEx.CustomDrawFunctionIndex());
               if (customDrawInfo.FnDraw != nullptr)
               {
@@ -637,7 +643,7 @@ namespace Fsl::UI::RenderIMBatch
             break;
           case RenderDrawCommandType::SpriteFont_DrawCustomTextAtOffsetAndSize:
             {
-              CommandDrawCustomTextAtOffsetAndSize cmdEx(command);
+              CommandDrawCustomTextAtOffsetAndSize cmdEx(command, commandParams);
               const CustomDrawTextInfo& customDrawInfo = commandBuffer.FastGetCustomDrawTextInfo(cmdEx.CustomDrawFunctionIndex());
               if (customDrawInfo.FnDraw != nullptr)
               {
@@ -652,72 +658,74 @@ namespace Fsl::UI::RenderIMBatch
         }
         else
         {
+          const PxAreaRectangleF& clipRectanglePxf = commandBuffer.FastGetClipRectanglePxf(commandParams.ClipRectangleIndex);
           switch (ToRenderDrawCommandType(HandleCoding::GetType(command.Mesh), command.State.Type()))
           {
           case RenderDrawCommandType::BasicImageSprite_DrawAtOffsetAndSize:
           case RenderDrawCommandType::ImageSprite_DrawAtOffsetAndSize:
-            AddImageMeshWithClipping(rBatcher, record, meshManager.UncheckedGetImageSprite(hMesh), command.ClipRectanglePxf);
+            AddImageMeshWithClipping(rBatcher, record, meshManager.UncheckedGetImageSprite(hMesh), clipRectanglePxf);
             break;
           case RenderDrawCommandType::BasicImageSprite_DrawCustomBasicImageAtOffsetAndSize:
             {
-              CommandDrawCustomBasicImageAtOffsetAndSize cmdEx(command);
+              CommandDrawCustomBasicImageAtOffsetAndSize cmdEx(command, commandParams);
               const CustomDrawBasicImageInfo& customDrawInfo = commandBuffer.FastGetCustomDrawBasicImageInfo(cmdEx.CustomDrawFunctionIndex());
               if (customDrawInfo.FnDraw != nullptr)
               {
                 AddBasicImageSprite(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetImageSprite(hMesh),
-                                    DrawClipContext(true, command.ClipRectanglePxf));
+                                    DrawClipContext(true, clipRectanglePxf));
               }
               break;
             }
           case RenderDrawCommandType::BasicImageSprite_DrawCustomBasicImageAtOffsetAndSizeBasicMesh:
             {
-              CommandDrawCustomBasicImageAtOffsetAndSizeBasicMesh cmdEx(command);
+              CommandDrawCustomBasicImageAtOffsetAndSizeBasicMesh cmdEx(command, commandParams);
               const CustomDrawBasicImageBasicMeshInfo& customDrawInfo =
                 commandBuffer.FastGetCustomDrawBasicImageBasicMeshInfo(cmdEx.CustomDrawFunctionIndex());
               if (customDrawInfo.FnDraw != nullptr)
               {
                 AddBasicImageSpriteMesh(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetImageSprite(hMesh),
-                                        DrawClipContext(true, command.ClipRectanglePxf));
+                                        DrawClipContext(true, clipRectanglePxf));
               }
               break;
             }
           case RenderDrawCommandType::BasicNineSliceSprite_DrawAtOffsetAndSize:
           case RenderDrawCommandType::NineSliceSprite_DrawAtOffsetAndSize:
-            AddNineSliceSpriteWithClipping(rBatcher, record, meshManager.UncheckedGetNineSliceSprite(hMesh), command.ClipRectanglePxf);
+            AddNineSliceSpriteWithClipping(rBatcher, record, meshManager.UncheckedGetNineSliceSprite(hMesh), clipRectanglePxf);
             break;
           case RenderDrawCommandType::NineSliceSprite_DrawRot90CWAtOffsetAndSize:
-            AddNineSliceSpriteRot90WithClipping(rBatcher, record, meshManager.UncheckedGetNineSliceSprite(hMesh), command.ClipRectanglePxf);
+            AddNineSliceSpriteRot90WithClipping(rBatcher, record, meshManager.UncheckedGetNineSliceSprite(hMesh), clipRectanglePxf);
             break;
           case RenderDrawCommandType::NineSliceSprite_DrawCustomNineSliceAtOffsetAndSize:
             {
-              CommandDrawCustomNineSliceAtOffsetAndSize cmdEx(command);
+              CommandDrawCustomNineSliceAtOffsetAndSize cmdEx(command, commandParams);
               const CustomDrawNineSliceInfo& customDrawInfo = commandBuffer.FastGetCustomDrawNineSliceInfo(cmdEx.CustomDrawFunctionIndex());
               if (customDrawInfo.FnDraw != nullptr)
               {
                 AddNineSliceSprite(rBatcher, record, cmdEx, customDrawInfo, meshManager.UncheckedGetNineSliceSprite(hMesh),
-                                   DrawClipContext(true, command.ClipRectanglePxf));
+                                   DrawClipContext(true, clipRectanglePxf));
               }
               break;
             }
           case RenderDrawCommandType::OptimizedNineSliceSprite_DrawAtOffsetAndSize:
             AddOptimizedNineSliceSpriteWithClipping(rBatcher, record, meshManager.UncheckedGetOptimizedNineSliceSprite(hMesh),
-                                                    command.ClipRectanglePxf);
+                                                    clipRectanglePxf);
             break;
           case RenderDrawCommandType::OptimizedNineSliceSprite_DrawRot90CWAtOffsetAndSize:
             AddOptimizedNineSliceSpriteRot90WithClipping(rBatcher, record, meshManager.UncheckedGetOptimizedNineSliceSprite(hMesh),
-                                                         command.ClipRectanglePxf);
+                                                         clipRectanglePxf);
             break;
           case RenderDrawCommandType::SpriteFont_DrawAtOffsetAndSize:
             AddSpriteFontWithClipping(rBatcher, record, rTextMeshBuilder, CommandDrawAtOffsetAndSize(command),
-                                      meshManager.UncheckedGetSpriteFont(hMesh));
+                                      meshManager.UncheckedGetSpriteFont(hMesh), clipRectanglePxf);
             break;
           case RenderDrawCommandType::SpriteFont_DrawCustomTextAtOffsetAndSize:
             {
-              CommandDrawCustomTextAtOffsetAndSize cmdEx(command);
+              CommandDrawCustomTextAtOffsetAndSize cmdEx(command, commandParams);
               const CustomDrawTextInfo& customDrawInfo = commandBuffer.FastGetCustomDrawTextInfo(cmdEx.CustomDrawFunctionIndex());
               if (customDrawInfo.FnDraw != nullptr)
               {
-                AddSpriteFontWithClipping(rBatcher, record, rTextMeshBuilder, cmdEx, customDrawInfo, meshManager.UncheckedGetSpriteFont(hMesh));
+                AddSpriteFontWithClipping(rBatcher, record, rTextMeshBuilder, cmdEx, customDrawInfo, meshManager.UncheckedGetSpriteFont(hMesh),
+                                          clipRectanglePxf);
               }
               break;
             }
@@ -726,11 +734,14 @@ namespace Fsl::UI::RenderIMBatch
             break;
           }
         }
+        // The segment that is being build is finalized after all finalized segments, so its index is equal to the segment count
+        rRetainedDrawCache.AddDrawnCommand(record, rBatcher.GetSegmentCount());
       }
     }
 
     template <typename TBatcher>
-    UploadStats UploadMeshChanges(std::vector<RenderSystemBufferRecord>& rBuffers, IBasicRenderSystem& renderSystem, const TBatcher& batcher)
+    UploadStats UploadMeshChanges(std::vector<RenderSystemBufferRecord>& rBuffers, IBasicRenderSystem& renderSystem, const TBatcher& batcher,
+                                  const RetainedDrawCache& retainedDrawCache)
     {
       UploadStats stats;
       // Upload all the changes to the buffers (create + resize as required)
@@ -739,6 +750,8 @@ namespace Fsl::UI::RenderIMBatch
       {
         const typename TBatcher::SegmentSpans info = batcher.GetSegmentSpans(i);
         // FSLLOG3_INFO("Upload batch #{} vertices:{} indices:{}", i, info.Vertices.size(), info.Indices.size());
+        // A segment build from the exact same unchanged commands as last frame already has its content in the buffers
+        const uint32_t reusedCommandCount = i < rBuffers.size() ? retainedDrawCache.TryReuseSegment(i) : 0u;
         if (info.Indices.empty())
         {
           assert(!info.Vertices.empty());
@@ -749,6 +762,12 @@ namespace Fsl::UI::RenderIMBatch
               renderSystem.CreateDynamicBuffer(ReadOnlyFlexVertexSpanUtil::AsSpan(info.Vertices, OptimizationCheckFlag::NoCheck), vertexCapacity),
               vertexCapacity);
           }
+          else if (reusedCommandCount > 0u)
+          {
+            assert(info.Vertices.size() <= rBuffers[i].VertexCapacity);
+            stats.ReusedCommandCount += reusedCommandCount;
+            ++stats.ReusedBufferCount;
+          }
           else if (info.Vertices.size() > rBuffers[i].VertexCapacity)
           {
             const auto vertexCapacity = UncheckedNumericCast<uint32_t>(
@@ -776,6 +795,13 @@ namespace Fsl::UI::RenderIMBatch
               renderSystem.CreateDynamicBuffer(ReadOnlyFlexVertexSpanUtil::AsSpan(info.Vertices, OptimizationCheckFlag::NoCheck), vertexCapacity),
               vertexCapacity, renderSystem.CreateDynamicBuffer(info.Indices, indexCapacity), indexCapacity);
           }
+          else if (reusedCommandCount > 0u)
+          {
+            assert(info.Vertices.size() <= rBuffers[i].VertexCapacity);
+            assert(info.Indices.size() <= rBuffers[i].IndexCapacity);
+            stats.ReusedCommandCount += reusedCommandCount;
+            stats.ReusedBufferCount += 2;
+          }
           else if (info.Vertices.size() > rBuffers[i].VertexCapacity || info.Indices.size() > rBuffers[i].IndexCapacity)
           {
             const auto vertexCapacity = UncheckedNumericCast<uint32_t>(
@@ -799,9 +825,10 @@ namespace Fsl::UI::RenderIMBatch
 
 
     template <typename TBatcher>
-    UploadStats CalcUploadStats(const TBatcher& batcher)
+    UploadStats CalcUploadStats(const TBatcher& batcher, const uint32_t commandCount)
     {
       UploadStats stats;
+      stats.ReusedCommandCount = commandCount;
       // Upload all the changes to the buffers (create + resize as required)
       const uint32_t segmentCount = batcher.GetSegmentCount();
       for (uint32_t i = 0; i < segmentCount; ++i)
@@ -810,6 +837,7 @@ namespace Fsl::UI::RenderIMBatch
         if (info.Indices.empty())
         {
           ++stats.VertexBufferCount;
+          ++stats.ReusedBufferCount;
         }
         else
         {
@@ -817,6 +845,7 @@ namespace Fsl::UI::RenderIMBatch
           assert(!info.Indices.empty());
           ++stats.VertexBufferCount;
           ++stats.IndexBufferCount;
+          stats.ReusedBufferCount += 2;
         }
       }
       return stats;
@@ -897,14 +926,17 @@ namespace Fsl::UI::RenderIMBatch
       rStats.IndexCount = batcherStats.IndexCount;
       rStats.VertexBufferCount = uploadStats.VertexBufferCount;
       rStats.IndexBufferCount = uploadStats.IndexBufferCount;
+      rStats.ReusedBufferCount = uploadStats.ReusedBufferCount;
+      rStats.ReusedCommandCount = uploadStats.ReusedCommandCount;
       rStats.DrawCalls = drawStats.DrawCalls;
       rStats.DrawIndexCalls = drawStats.DrawIndexCalls;
     }
 
     template <typename TBatcher>
     void DrawNow(RenderSystemStats& rStats, IBasicRenderSystem& renderSystem, MeshManager& meshManager,
-                 std::vector<RenderSystemBufferRecord>& rBuffers, const TBatcher& batcher, const BasicCameraInfo& cameraInfo,
-                 RenderPerformanceCapture* const pPerformanceCapture, const uint32_t maxDrawCalls, const bool isNewCommandBuffer)
+                 std::vector<RenderSystemBufferRecord>& rBuffers, const TBatcher& batcher, const RetainedDrawCache& retainedDrawCache,
+                 const BasicCameraInfo& cameraInfo, RenderPerformanceCapture* const pPerformanceCapture, const uint32_t maxDrawCalls,
+                 const bool isNewCommandBuffer)
     {
       UploadStats uploadStats;
 
@@ -915,7 +947,7 @@ namespace Fsl::UI::RenderIMBatch
           pPerformanceCapture->Begin(RenderPerformanceCaptureId::UpdateBuffers);
         }
 
-        uploadStats = UploadMeshChanges(rBuffers, renderSystem, batcher);
+        uploadStats = UploadMeshChanges(rBuffers, renderSystem, batcher, retainedDrawCache);
 
         if (pPerformanceCapture != nullptr)
         {
@@ -925,7 +957,7 @@ namespace Fsl::UI::RenderIMBatch
       else
       {
         // Calculate the stats so they can be shown correctly
-        uploadStats = CalcUploadStats(batcher);
+        uploadStats = CalcUploadStats(batcher, rStats.CommandCount);
         if (pPerformanceCapture != nullptr)
         {
           pPerformanceCapture->Begin(RenderPerformanceCaptureId::UpdateBuffers);
@@ -950,8 +982,9 @@ namespace Fsl::UI::RenderIMBatch
     template <typename TBatcher, typename TPreprocessor>
     void DoDraw(RenderSystemStats& rStats, IBasicRenderSystem& renderSystem, MeshManager& rMeshManager,
                 std::vector<RenderSystemBufferRecord>& rBuffers, std::vector<ProcessedCommandRecord>& rProcessedCommandRecords, TBatcher& rBatcher,
-                DrawCommandBufferEx& rCommandBuffer, const BasicCameraInfo& cameraInfo, TPreprocessor& rPreprocessor,
-                RenderPerformanceCapture* const pPerformanceCapture, const uint32_t maxDrawCalls, const bool isNewCommandBuffer)
+                DrawCommandBufferEx& rCommandBuffer, RetainedDrawCache& rRetainedDrawCache, const BasicCameraInfo& cameraInfo,
+                TPreprocessor& rPreprocessor, RenderPerformanceCapture* const pPerformanceCapture, const uint32_t maxDrawCalls,
+                const bool isNewCommandBuffer)
     {
       if (isNewCommandBuffer)
       {
@@ -984,9 +1017,9 @@ namespace Fsl::UI::RenderIMBatch
               }
 
               ReadOnlySpan<ProcessedCommandRecord> opaqueSpan = rPreprocessor.GetOpaqueSpan(rProcessedCommandRecords);
-              ProcessDrawCommands(rBatcher, rMeshManager, rTextMeshBuilder, opaqueSpan, commandSpan, rCommandBuffer);
+              ProcessDrawCommands(rBatcher, rMeshManager, rTextMeshBuilder, opaqueSpan, commandSpan, rCommandBuffer, rRetainedDrawCache);
               ReadOnlySpan<ProcessedCommandRecord> transparentSpan = rPreprocessor.GetTransparentSpan(rProcessedCommandRecords);
-              ProcessDrawCommands(rBatcher, rMeshManager, rTextMeshBuilder, transparentSpan, commandSpan, rCommandBuffer);
+              ProcessDrawCommands(rBatcher, rMeshManager, rTextMeshBuilder, transparentSpan, commandSpan, rCommandBuffer, rRetainedDrawCache);
 
               // FSLLOG3_INFO("commandSpan:{} Opaque:{} Transparent:{}", commandSpan.size(), opaqueSpan.size(), transparentSpan.size());
 
@@ -1006,7 +1039,8 @@ namespace Fsl::UI::RenderIMBatch
         }
 
         // Time to upload and draw the meshes
-        DrawNow(rStats, renderSystem, rMeshManager, rBuffers, rBatcher, cameraInfo, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
+        DrawNow(rStats, renderSystem, rMeshManager, rBuffers, rBatcher, rRetainedDrawCache, cameraInfo, pPerformanceCapture, maxDrawCalls,
+                isNewCommandBuffer);
       }
       catch (std::exception& ex)
       {
@@ -1034,14 +1068,14 @@ namespace Fsl::UI::RenderIMBatch
 
   void RenderSystem::Draw(RenderPerformanceCapture* const pPerformanceCapture)
   {
-    const bool isNewCommandBuffer = IsNewCommandBuffer();
+    const bool isNewCommandBuffer = ResolveIsNewCommandBuffer();
 
     const BasicCameraInfo cameraInfo(GetMatrixProjection());
 
     m_preprocessor.SetAllowDepthBuffer(GetAllowDepthBuffer());
 
-    DoDraw(DoGetStats(), GetRenderSystem(), DoGetMeshManager(), GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(), cameraInfo,
-           m_preprocessor, pPerformanceCapture, 0xFFFFFFFF, isNewCommandBuffer);
+    DoDraw(DoGetStats(), GetRenderSystem(), DoGetMeshManager(), GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(),
+           GetRetainedDrawCache(), cameraInfo, m_preprocessor, pPerformanceCapture, 0xFFFFFFFF, isNewCommandBuffer);
   }
 
 
@@ -1060,12 +1094,12 @@ namespace Fsl::UI::RenderIMBatch
 
   void DefaultRenderSystem::Draw(RenderPerformanceCapture* const pPerformanceCapture)
   {
-    const bool isNewCommandBuffer = IsNewCommandBuffer();
+    const bool isNewCommandBuffer = ResolveIsNewCommandBuffer();
     const BasicCameraInfo cameraInfo(GetMatrixProjection());
 
     MeshManager& rMeshManager = DoGetMeshManager();
-    DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(), cameraInfo,
-           m_preprocessor, pPerformanceCapture, m_maxDrawCalls, isNewCommandBuffer);
+    DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(),
+           GetRetainedDrawCache(), cameraInfo, m_preprocessor, pPerformanceCapture, m_maxDrawCalls, isNewCommandBuffer);
   }
 
 
@@ -1075,6 +1109,7 @@ namespace Fsl::UI::RenderIMBatch
     , m_config(true, true, GetAllowDepthBuffer(), DrawReorderMethod::LinearConstrained)
     , m_preprocessor(createInfo.AllowDepthBuffer, GetWindowMetrics().GetSizePx())
     , m_spatialGridPreprocessor(createInfo.WindowMetrics.GetSizePx(), createInfo.AllowDepthBuffer)
+    , m_parallelSpatialGridPreprocessor(createInfo.WindowMetrics.GetSizePx(), createInfo.AllowDepthBuffer)
   {
     SetConfig(m_config);
   }
@@ -1085,11 +1120,12 @@ namespace Fsl::UI::RenderIMBatch
     RenderSystemBase::OnConfigurationChanged(windowMetrics);
     m_preprocessor.OnConfigurationChanged(windowMetrics.GetSizePx());
     m_spatialGridPreprocessor.OnConfigurationChanged(windowMetrics.GetSizePx());
+    m_parallelSpatialGridPreprocessor.OnConfigurationChanged(windowMetrics.GetSizePx());
   }
 
   void FlexRenderSystem::Draw(RenderPerformanceCapture* const pPerformanceCapture)
   {
-    const bool isNewCommandBuffer = IsNewCommandBuffer();
+    const bool isNewCommandBuffer = ResolveIsNewCommandBuffer();
 
     MeshManager& rMeshManager = DoGetMeshManager();
     const bool allowDepthBuffer = m_config.UseDepthBuffer;
@@ -1100,22 +1136,29 @@ namespace Fsl::UI::RenderIMBatch
     if (m_config.ReorderMethod == DrawReorderMethod::Disabled)
     {
       BasicPreprocessor preprocessor(allowDepthBuffer, GetWindowMetrics().GetSizePx());
-      DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(), cameraInfo,
-             preprocessor, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
+      DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(),
+             GetRetainedDrawCache(), cameraInfo, preprocessor, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
     }
     else if (m_config.ReorderMethod == DrawReorderMethod::LinearConstrained)
     {
       m_preprocessor.SetAllowDepthBuffer(allowDepthBuffer);
 
-      DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(), cameraInfo,
-             m_preprocessor, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
+      DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(),
+             GetRetainedDrawCache(), cameraInfo, m_preprocessor, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
     }
     else if (m_config.ReorderMethod == DrawReorderMethod::SpatialGrid)
     {
       m_spatialGridPreprocessor.SetAllowDepthBuffer(allowDepthBuffer);
 
-      DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(), cameraInfo,
-             m_spatialGridPreprocessor, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
+      DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(),
+             GetRetainedDrawCache(), cameraInfo, m_spatialGridPreprocessor, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
+    }
+    else if (m_config.ReorderMethod == DrawReorderMethod::SpatialGridParallel)
+    {
+      m_parallelSpatialGridPreprocessor.SetAllowDepthBuffer(allowDepthBuffer);
+
+      DoDraw(DoGetStats(), GetRenderSystem(), rMeshManager, GetBuffers(), m_processedCommandRecords, m_batcher, GetCommandBuffer(),
+             GetRetainedDrawCache(), cameraInfo, m_parallelSpatialGridPreprocessor, pPerformanceCapture, maxDrawCalls, isNewCommandBuffer);
     }
   }
 }
@@ -119,5 +119,20 @@ namespace Fsl::UI::RenderIMBatch
     m_renderSystem->EndCache();
     m_commandBufferCleared = false;
     m_commandBufferSizeLastFrame = m_commandBuffer.Count();
+    m_retainedDrawCache.Commit();
+  }
+
+
+  bool RenderSystemBase::ResolveIsNewCommandBuffer()
+  {
+    bool isNewCommandBuffer = IsNewCommandBuffer();
+    if (isNewCommandBuffer)
+    {
+      assert(m_meshManager);
+      isNewCommandBuffer = !m_retainedDrawCache.TryReuse(m_commandBuffer.AsReadOnlySpan(), m_commandBuffer.AsReadOnlyParamsSpan(),
+                                                          m_commandBuffer.AsReadOnlyClipRectangleSpan(), *m_meshManager);
+    }
+    m_stats.CommandCount = UncheckedNumericCast<uint32_t>(m_commandBuffer.Count());
+    return isNewCommandBuffer;
   }
 }
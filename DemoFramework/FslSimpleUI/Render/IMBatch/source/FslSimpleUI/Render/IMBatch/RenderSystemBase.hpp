@@ -47,6 +47,7 @@
 #include <utility>
 #include "Preprocess/ProcessedCommandRecord.hpp"
 #include "RenderSystemBufferRecord.hpp"
+#include "RetainedDrawCache.hpp"
 
 namespace Fsl
 {
@@ -76,6 +77,7 @@ namespace Fsl::UI::RenderIMBatch
     DrawCommandBufferEx m_commandBuffer;
     bool m_commandBufferCleared{false};
     std::size_t m_commandBufferSizeLastFrame{0};
+    RetainedDrawCache m_retainedDrawCache;
 
     Matrix m_matrixProjection;
     RenderSystemStats m_stats;
@@ -154,11 +156,20 @@ namespace Fsl::UI::RenderIMBatch
       return m_commandBufferCleared || m_commandBuffer.Count() != m_commandBufferSizeLastFrame;
     }
 
+    //! @brief Check if the meshes need to be rebuild from the command buffer.
+    //! @note  A re-recorded command buffer that is identical to the one used to build the current meshes allows the meshes to be reused.
+    bool ResolveIsNewCommandBuffer();
+
     DrawCommandBufferEx& GetCommandBuffer() noexcept
     {
       return m_commandBuffer;
     }
 
+    RetainedDrawCache& GetRetainedDrawCache() noexcept
+    {
+      return m_retainedDrawCache;
+    }
+
     RenderSystemStats& DoGetStats() noexcept
     {
       return m_stats;
@@ -168,6 +179,7 @@ namespace Fsl::UI::RenderIMBatch
     void InvalidateDrawCache() noexcept
     {
       m_commandBufferSizeLastFrame = 0;
+      m_retainedDrawCache.Invalidate();
     }
   };
 }
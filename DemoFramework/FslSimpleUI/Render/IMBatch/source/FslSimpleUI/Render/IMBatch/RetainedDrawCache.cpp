@@ -0,0 +1,150 @@
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include "RetainedDrawCache.hpp"
+#include <FslBase/UncheckedNumericCast.hpp>
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include "MeshManager.hpp"
+
+namespace Fsl::UI::RenderIMBatch
+{
+  namespace
+  {
+    constexpr bool IsEqual(const ProcessedCommandRecord& lhs, const ProcessedCommandRecord& rhs) noexcept
+    {
+      return lhs.MaterialId == rhs.MaterialId && lhs.DstAreaRectanglePxf == rhs.DstAreaRectanglePxf && lhs.FinalColor == rhs.FinalColor &&
+             lhs.OriginalCommandIndex == rhs.OriginalCommandIndex && lhs.LegacyCommandSpanIndex == rhs.LegacyCommandSpanIndex &&
+             lhs.Flags == rhs.Flags;
+    }
+  }
+
+  bool RetainedDrawCache::TryReuse(const ReadOnlySpan<EncodedCommand> commands, const ReadOnlySpan<EncodedCommandParams> commandParams,
+                                   const ReadOnlySpan<PxAreaRectangleF> clipRectangles, const MeshManager& meshManager)
+  {
+    assert(commands.size() == commandParams.size());
+    const uint32_t structureChangeId = meshManager.GetStructureChangeId();
+    const auto commandCount = UncheckedNumericCast<uint32_t>(commands.size());
+
+    // If a mesh handle might have been reused we can not trust any of the previous commands
+    const bool canCompare = m_isValid && structureChangeId == m_structureChangeId;
+    const uint32_t compareCount = canCompare ? std::min(commandCount, m_commandCount) : 0u;
+    if (commandCount > m_commands.size())
+    {
+      m_commands.resize(commandCount);
+      m_commandChanged.resize(commandCount);
+    }
+
+    // Compare against the previous commands while overwriting them with the new ones
+    bool isEqual = canCompare && commandCount == m_commandCount;
+    for (uint32_t i = 0; i < commandCount; ++i)
+    {
+      const EncodedCommand& command = commands[i];
+      const EncodedCommandParams& params = commandParams[i];
+      // The clip rectangle is stored by value so adding or removing a unrelated clip rectangle does not change the command
+      const PxAreaRectangleF clipRectanglePxf = command.State.IsClipEnabled() && params.ClipRectangleIndex < clipRectangles.size()
+                                                  ? clipRectangles[params.ClipRectangleIndex]
+                                                  : PxAreaRectangleF();
+      const uint32_t contentChangeId = command.State.Type() != DrawCommandType::Nop ? meshManager.UncheckedGetContentChangeId(command.Mesh) : 0u;
+      const CommandRecord record(command, clipRectanglePxf, params.Custom0, contentChangeId);
+      const bool changed = i >= compareCount || record != m_commands[i] || IsVolatile(command);
+      m_commandChanged[i] = changed ? 1u : 0u;
+      isEqual = isEqual && !changed;
+      m_commands[i] = record;
+    }
+    if (isEqual)
+    {
+      return true;
+    }
+    m_commandCount = commandCount;
+    m_structureChangeId = structureChangeId;
+    m_pending.Clear();
+    m_isValid = false;
+    m_isPending = true;
+    return false;
+  }
+
+
+  void RetainedDrawCache::AddDrawnCommand(const ProcessedCommandRecord& record, const uint32_t segmentIndex)
+  {
+    assert(m_isPending);
+    assert(record.LegacyCommandSpanIndex < m_commandCount);
+    assert(segmentIndex + 1u >= m_pending.Segments.size());
+    const auto commandIndex = UncheckedNumericCast<uint32_t>(m_pending.Commands.size());
+    while (segmentIndex >= m_pending.Segments.size())
+    {
+      m_pending.Segments.emplace_back(commandIndex, 0u);
+    }
+    m_pending.Commands.push_back(record);
+    ++m_pending.Segments.back().Length;
+  }
+
+
+  uint32_t RetainedDrawCache::TryReuseSegment(const uint32_t segmentIndex) const noexcept
+  {
+    if (!m_isPending || segmentIndex >= m_committed.Segments.size() || segmentIndex >= m_pending.Segments.size())
+    {
+      return 0u;
+    }
+    const SpanRange<uint32_t> committedRange = m_committed.Segments[segmentIndex];
+    const SpanRange<uint32_t> pendingRange = m_pending.Segments[segmentIndex];
+    if (pendingRange.Length == 0u || pendingRange.Length != committedRange.Length)
+    {
+      return 0u;
+    }
+    // The segment content is only equal if the exact same unchanged commands were processed the same way in the same order
+    for (uint32_t i = 0; i < pendingRange.Length; ++i)
+    {
+      const ProcessedCommandRecord& record = m_pending.Commands[pendingRange.Start + i];
+      if (m_commandChanged[record.LegacyCommandSpanIndex] != 0u || !IsEqual(record, m_committed.Commands[committedRange.Start + i]))
+      {
+        return 0u;
+      }
+    }
+    return pendingRange.Length;
+  }
+
+
+  bool RetainedDrawCache::IsVolatile(const EncodedCommand& command) noexcept
+  {
+    // The custom draw commands call user supplied functions with user supplied data, so we can not know if the output is the same
+    switch (command.State.Type())
+    {
+    case DrawCommandType::Nop:
+    case DrawCommandType::DrawAtOffsetAndSize:
+    case DrawCommandType::DrawRot90CWAtOffsetAndSize:
+      return false;
+    default:
+      return true;
+    }
+  }
+}
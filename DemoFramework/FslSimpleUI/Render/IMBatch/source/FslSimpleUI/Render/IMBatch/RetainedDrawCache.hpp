@@ -0,0 +1,149 @@
+#ifndef FSLSIMPLEUI_RENDER_IMBATCH_RETAINEDDRAWCACHE_HPP
+#define FSLSIMPLEUI_RENDER_IMBATCH_RETAINEDDRAWCACHE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2024 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxAreaRectangleF.hpp>
+#include <FslBase/Math/SpanRange.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslSimpleUI/Render/Base/Command/EncodedCommand.hpp>
+#include <FslSimpleUI/Render/Base/Command/EncodedCommandParams.hpp>
+#include <utility>
+#include <vector>
+#include "Preprocess/ProcessedCommandRecord.hpp"
+
+namespace Fsl::UI::RenderIMBatch
+{
+  class MeshManager;
+
+  //! @brief Keeps track of the draw commands that were used to build the current meshes.
+  //!        This allows the render system to reuse all meshes of the previous frame when a redraw records the exact same commands and
+  //!        to skip the upload of the individual mesh segments whose commands did not change when it does not.
+  class RetainedDrawCache
+  {
+    struct CommandRecord
+    {
+      EncodedCommand Command;
+      //! The clip rectangle used by the command (empty if clipping is disabled)
+      PxAreaRectangleF ClipRectanglePxf;
+      uint32_t Custom0{0};
+      uint32_t ContentChangeId{0};
+
+      constexpr CommandRecord() noexcept = default;
+      constexpr CommandRecord(const EncodedCommand& command, const PxAreaRectangleF& clipRectanglePxf, const uint32_t custom0,
+                              const uint32_t contentChangeId) noexcept
+        : Command(command)
+        , ClipRectanglePxf(clipRectanglePxf)
+        , Custom0(custom0)
+        , ContentChangeId(contentChangeId)
+      {
+      }
+
+      constexpr bool operator==(const CommandRecord& rhs) const noexcept
+      {
+        return Command == rhs.Command && ClipRectanglePxf == rhs.ClipRectanglePxf && Custom0 == rhs.Custom0 && ContentChangeId == rhs.ContentChangeId;
+      }
+
+      constexpr bool operator!=(const CommandRecord& rhs) const noexcept
+      {
+        return !(*this == rhs);
+      }
+    };
+
+    //! The processed commands in the order they were added to the batcher and the range of them that ended up in each mesh segment
+    struct SegmentsRecord
+    {
+      std::vector<ProcessedCommandRecord> Commands;
+      std::vector<SpanRange<uint32_t>> Segments;
+
+      void Clear() noexcept
+      {
+        Commands.clear();
+        Segments.clear();
+      }
+    };
+
+    std::vector<CommandRecord> m_commands;
+    //! One entry per command, non zero if the command differs from the one used to build the current meshes
+    std::vector<uint8_t> m_commandChanged;
+    uint32_t m_commandCount{0};
+    uint32_t m_structureChangeId{0};
+    //! The segments of the current meshes
+    SegmentsRecord m_committed;
+    //! The segments being build from the commands supplied to the last TryReuse
+    SegmentsRecord m_pending;
+    //! The cached commands match the current meshes
+    bool m_isValid{false};
+    //! The cached commands have been stored but the meshes have not been successfully build yet
+    bool m_isPending{false};
+
+  public:
+    //! @brief Compare the commands to the ones used to build the current meshes.
+    //! @return true if the current meshes can be reused, false if they need to be rebuild using the supplied commands.
+    //! @note   When false is returned the commands are stored and will be used for the comparison once Commit has been called.
+    //!         The meshes should then be rebuild while calling AddDrawnCommand for each processed command.
+    bool TryReuse(const ReadOnlySpan<EncodedCommand> commands, const ReadOnlySpan<EncodedCommandParams> commandParams,
+                  const ReadOnlySpan<PxAreaRectangleF> clipRectangles, const MeshManager& meshManager);
+
+    //! @brief Record that the given processed command was added to the mesh segment with the given index.
+    //! @note  The commands must be added in batch order, so the segment index can never decrease.
+    void AddDrawnCommand(const ProcessedCommandRecord& record, const uint32_t segmentIndex);
+
+    //! @brief Check if the segment being build contains the exact same unchanged commands as the same segment of the current meshes.
+    //! @return the number of commands in the segment if the previously uploaded segment content can be reused, zero if it can not.
+    uint32_t TryReuseSegment(const uint32_t segmentIndex) const noexcept;
+
+    //! @brief Mark the commands supplied to the last TryReuse as the ones used to build the current meshes.
+    void Commit() noexcept
+    {
+      if (m_isPending)
+      {
+        std::swap(m_committed, m_pending);
+        m_pending.Clear();
+        m_isValid = true;
+        m_isPending = false;
+      }
+    }
+
+    //! @brief Ensure that the next TryReuse call fails and that no segments are reused.
+    void Invalidate() noexcept
+    {
+      m_isValid = false;
+      m_isPending = false;
+      m_committed.Clear();
+    }
+
+    static bool IsVolatile(const EncodedCommand& command) noexcept;
+  };
+}
+
+#endif